@@ -50,13 +50,6 @@ void AFish::PostSpawnInitialize()
     CameraComp->SetupAttachment(SpringArmComp);
 }
 
-UObject* AFish::Duplicate(UObject* InOuter)
-{
-    ThisClass* NewActor = Cast<ThisClass>(Super::Duplicate(InOuter));
-
-    return NewActor;
-}
-
 void AFish::BeginPlay()
 {
     APlayer::BeginPlay();
@@ -195,7 +188,9 @@ void AFish::ActorBeginOverlap(AActor* OverlappedActor, AActor* OtherActor)
 {
     if (OtherActor->IsA<APlatformActor>())
     {
-        FSoundManager::GetInstance().PlaySound("sizzle");
+        FSoundPlayParams Params;
+        Params.Priority = 1;
+        FSoundManager::GetInstance().PlaySound("sizzle", Params);
 
         GetWorld()->GetPlayerController()->ClientStartCameraShake(UDamageCameraShake::StaticClass());
 
@@ -58,8 +58,6 @@ public:
 
     virtual void PostSpawnInitialize() override;
 
-    UObject* Duplicate(UObject* InOuter) override;
-
     void BeginPlay() override;
 
     void Tick(float DeltaTime) override;
@@ -97,26 +97,12 @@ public:
         CurrentKey = InCurrentKey;
     }
 
-    virtual void SetAnimState(EAnimState InAnimState) override;
-
-    UAnimSequence* GetAnimForState(EAnimState InAnimState);
-
     virtual UAnimStateMachine* GetStateMachine() const override { return StateMachine; }
 
-    virtual UAnimSequence* GetCurrAnim() const override { return CurrAnim; }
-
-    virtual UAnimSequence* GetPrevAnim() const override { return PrevAnim; }
+    /** 상태와 전이, Blend Space를 정의한 애니메이션 그래프 */
+    static const FString GraphPath;
 
-    virtual float GetBlendDuration() const override { return BlendDuration; }
-
-    virtual void SetBlendDuration(float InBlendDuration) override { BlendDuration = InBlendDuration; }
 private:
-    UAnimationAsset* IDLE;
-    UAnimationAsset* Dance;
-    UAnimationAsset* SlowRun;
-    UAnimationAsset* NarutoRun;
-    UAnimationAsset* FastRun;
-
     float ElapsedTime;
     
     float PlayRate;
@@ -133,17 +119,5 @@ private:
 
     int CurrentKey;
     
-    UAnimSequence* PrevAnim;
-    
-    UAnimSequence* CurrAnim;
-    
-    float BlendAlpha;
-
-    float BlendStartTime;
-    
-    float BlendDuration;
-
-    bool bIsBlending;
-    
     UAnimStateMachine* StateMachine;
 };
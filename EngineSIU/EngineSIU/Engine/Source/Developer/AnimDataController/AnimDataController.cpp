@@ -34,6 +34,7 @@ void UAnimDataController::ResizeNumberOfFrames(int32 NewLength, int32 T0, int32
             {
                 Model->NumberOfFrames = NewLength;
                 Model->NumberOfKeys = Model->NumberOfFrames + 1;
+                Model->CompressedData.Reset();
             }
         }
     }
@@ -79,6 +80,7 @@ int32 UAnimDataController::AddBoneTrack(FName BoneName)
                 NewTrack.BoneTreeIndex = BoneIndex;
 
                 Model->BoneAnimationTracks.Emplace(NewTrack);
+                Model->CompressedData.Reset();
 
                 return InsertIndex;
             }
@@ -113,6 +115,7 @@ bool UAnimDataController::RemoveBoneTrack(FName BoneName)
         Model->GetBoneTrackTransforms(BoneName, BoneTransforms);
 
         Model->BoneAnimationTracks.RemoveAt(TrackIndex);
+        Model->CompressedData.Reset();
 
         return true;
     }
@@ -169,6 +172,9 @@ bool UAnimDataController::SetBoneTrackKeys(FName BoneName, const TArray<FVector>
                     TrackPtr->InternalTrackData.RotKeys[KeyIndex] = FQuat(RotationalKeys[KeyIndex]);
                 }
 
+                // 압축 데이터는 원본과 달라졌으므로 다시 압축할 때까지 원본을 사용
+                Model->CompressedData.Reset();
+
                 return true;
             }
         }
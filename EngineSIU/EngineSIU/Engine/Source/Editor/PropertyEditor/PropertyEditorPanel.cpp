@@ -489,6 +489,15 @@ void PropertyEditorPanel::RenderForStaticMesh(UStaticMeshComponent* StaticMeshCo
             ImGui::EndCombo();
         }
 
+        if (UStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh())
+        {
+            if (const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData())
+            {
+                const FStaticMeshRenderData* LODData = RenderData->GetLOD(StaticMeshComp->GetLOD());
+                ImGui::Text("LOD %d / %d (%d Triangles)", StaticMeshComp->GetLOD(), RenderData->GetNumLODs(), LODData->Indices.Num() / 3);
+            }
+        }
+
         RenderForBoundingBody(StaticMeshComp);
 
         ImGui::TreePop();
@@ -606,6 +615,7 @@ void PropertyEditorPanel::RenderForSkeletalMesh(USkeletalMeshComponent* Skeletal
                 if (AnimInstance && AnimInstance->GetClass()->IsChildOf(SelectedClass))
                 {                    
                     UAnimStateMachine* AnimStateMachine = AnimInstance->GetStateMachine();
+                    ImGui::Text("State: %s", *AnimStateMachine->GetCurrentStateName());
                     if(ImGui::Button("MoveFast"))
                     {
                         AnimStateMachine->MoveFast();
@@ -625,8 +635,6 @@ void PropertyEditorPanel::RenderForSkeletalMesh(USkeletalMeshComponent* Skeletal
                     {
                         AnimStateMachine->StopDance();
                     }
-                    
-                    AnimInstance->SetAnimState(AnimStateMachine->GetState());
                 }
             }
         }
@@ -1049,17 +1057,16 @@ void PropertyEditorPanel::RenderForPointLightComponent(UPointLightComponent* Poi
 
         ImGui::Text("ShadowMap");
 
-        FShadowCubeMapArrayRHI* pointRHI = FEngineLoop::Renderer.ShadowManager->GetPointShadowCubeMapRHI();
+        ID3D11ShaderResourceView* atlasSRV = FEngineLoop::Renderer.ShadowManager->GetLocalLightShadowAtlasRHI()->ShadowSRV;
         const char* faceNames[] = { "+X", "-X", "+Y", "-Y", "+Z", "-Z" };
         float imageSize = 128.0f;
-        int index =  PointlightComponent->GetPointLightInfo().ShadowMapArrayIndex;
-        // CubeMap이므로 6개의 ShadowMap을 그립니다.
+        // 6개 면이 아틀라스의 각자 영역에 있으므로 영역의 UV로 잘라서 그립니다.
         for (int i = 0; i < 6; ++i)
         {
-            ID3D11ShaderResourceView* faceSRV = pointRHI->ShadowFaceSRVs[index][i];
-            if (faceSRV)
+            const FVector4& rect = PointlightComponent->GetPointLightInfo().ShadowAtlasRects[i];
+            if (atlasSRV && rect.Z > 0.0f)
             {
-                ImGui::Image(reinterpret_cast<ImTextureID>(faceSRV), ImVec2(imageSize, imageSize));
+                ImGui::Image(reinterpret_cast<ImTextureID>(atlasSRV), ImVec2(imageSize, imageSize), ImVec2(rect.X, rect.Y), ImVec2(rect.X + rect.Z, rect.Y + rect.W));
                 ImGui::SameLine(); 
                 ImGui::Text("%s", faceNames[i]);
             }
@@ -1124,7 +1131,12 @@ void PropertyEditorPanel::RenderForSpotLightComponent(USpotLightComponent* SpotL
         }
 
         ImGui::Text("ShadowMap");
-        ImGui::Image(reinterpret_cast<ImTextureID>(FEngineLoop::Renderer.ShadowManager->GetSpotShadowDepthRHI()->ShadowSRVs[0]), ImVec2(200, 200));
+        ID3D11ShaderResourceView* atlasSRV = FEngineLoop::Renderer.ShadowManager->GetLocalLightShadowAtlasRHI()->ShadowSRV;
+        const FVector4& rect = SpotLightComponent->GetSpotLightInfo().ShadowAtlasRect;
+        if (atlasSRV && rect.Z > 0.0f)
+        {
+            ImGui::Image(reinterpret_cast<ImTextureID>(atlasSRV), ImVec2(200, 200), ImVec2(rect.X, rect.Y), ImVec2(rect.X + rect.Z, rect.Y + rect.W));
+        }
 
         ImGui::TreePop();
     }
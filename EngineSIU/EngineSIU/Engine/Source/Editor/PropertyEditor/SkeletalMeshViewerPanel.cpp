@@ -692,23 +692,41 @@ void SkeletalMeshViewerPanel::RenderAnimationPanel(float PanelPosX, float PanelP
 
                 if (CompClasses.IsValidIndex(SelectedIndex))
                 {
-                    // CurrAnim (AnimA)
-                    FString CurrAnimName = AnimInstance->GetCurrAnim() ? AnimInstance->GetCurrAnim()->GetName() : TEXT("None");
-                    ImGui::Text("CurrAnim: %s", *CurrAnimName);
-
-                    // PrevAnim (AnimB)
-                    FString PrevAnimName = AnimInstance->GetPrevAnim() ? AnimInstance->GetPrevAnim()->GetName() : TEXT("None");
-                    ImGui::Text("PrevAnim: %s", *PrevAnimName);
-
-
-                    float BlendDuration = AnimInstance->GetBlendDuration();
-                    if (ImGui::SliderFloat("Blend Duration", &BlendDuration, 0.f, 1.f))
-                        AnimInstance->SetBlendDuration(BlendDuration);
-                    
                     UClass* SelectedClass = CompClasses[SelectedIndex];
-                    if (AnimInstance && AnimInstance->GetClass()->IsChildOf(SelectedClass))
+                    if (AnimInstance && AnimInstance->GetClass()->IsChildOf(SelectedClass) && AnimInstance->GetStateMachine())
                     {                    
                         UAnimStateMachine* AnimStateMachine = AnimInstance->GetStateMachine();
+                        FAnimGraphInstance& GraphInstance = AnimStateMachine->GetGraphInstance();
+
+                        // 현재 상태와 블렌딩 중인 이전 상태
+                        ImGui::Text("State: %s", *GraphInstance.GetCurrentStateName().ToString());
+                        if (GraphInstance.IsBlending())
+                        {
+                            const FName PrevStateName = GraphInstance.GetPreviousStateName();
+                            ImGui::Text("Blending from %s (%.2f)", PrevStateName == NAME_None ? "Snapshot" : *PrevStateName.ToString(), GraphInstance.GetBlendAlpha());
+                        }
+
+                        // 그래프 파라미터
+                        if (const FAnimGraphDefinition* GraphDefinition = GraphInstance.GetDefinition())
+                        {
+                            for (int32 ParamIndex = 0; ParamIndex < GraphDefinition->Parameters.Num(); ++ParamIndex)
+                            {
+                                const FAnimGraphParameter& Parameter = GraphDefinition->Parameters[ParamIndex];
+                                const FString ParameterName = Parameter.Name.ToString();
+                                if (Parameter.Type == EAnimGraphParameterType::Bool)
+                                {
+                                    bool bValue = GraphInstance.GetFloat(ParamIndex) != 0.f;
+                                    ImGui::BeginDisabled();
+                                    ImGui::Checkbox(*ParameterName, &bValue);
+                                    ImGui::EndDisabled();
+                                }
+                                else
+                                {
+                                    ImGui::Text("%s: %.2f", *ParameterName, GraphInstance.GetFloat(ParamIndex));
+                                }
+                            }
+                        }
+
                         if(ImGui::Button("MoveFast"))
                         {
                             AnimStateMachine->MoveFast();
@@ -728,8 +746,6 @@ void SkeletalMeshViewerPanel::RenderAnimationPanel(float PanelPosX, float PanelP
                         {
                             AnimStateMachine->StopDance();
                         }
-                        
-                        AnimInstance->SetAnimState(AnimStateMachine->GetState());
                     }
                 }
             }
@@ -0,0 +1,356 @@
+#include "JobSystem.h"
+
+#include "Math/MathUtility.h"
+
+namespace
+{
+    /** 현재 스레드의 Worker Index, Worker가 아니라면 INDEX_NONE */
+    thread_local int32 GCurrentWorkerIndex = -1;
+
+    /** GCurrentWorkerIndex가 가리키는 Queue를 가진 Job System, Worker 안에서 다른 Job System을 쓸 때 Index를 섞지 않기 위함 */
+    thread_local const FJobSystem* GCurrentWorkerOwner = nullptr;
+}
+
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem Instance;
+    return Instance;
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+void FJobSystem::Initialize(int32 InNumWorkers)
+{
+    if (IsInitialized())
+    {
+        return;
+    }
+
+    if (InNumWorkers <= 0)
+    {
+        const int32 NumCores = static_cast<int32>(std::thread::hardware_concurrency());
+        InNumWorkers = NumCores > 1 ? NumCores - 1 : 1;
+    }
+
+    Queues.Empty();
+    for (int32 Index = 0; Index < InNumWorkers + 1; ++Index)
+    {
+        Queues.Emplace(std::make_unique<FJobQueue>());
+    }
+
+    bRunning.store(true, std::memory_order_release);
+
+    Workers.Reserve(InNumWorkers);
+    for (int32 WorkerIndex = 0; WorkerIndex < InNumWorkers; ++WorkerIndex)
+    {
+        Workers.Emplace([this, WorkerIndex]() { WorkerMain(WorkerIndex); });
+    }
+}
+
+void FJobSystem::Shutdown()
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard Lock(WakeMutex);
+        bRunning.store(false, std::memory_order_release);
+    }
+    WakeCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+    Workers.Empty();
+
+    // Worker가 종료된 뒤 남은 Job은 호출한 스레드에서 처리
+    FJob Job;
+    for (std::unique_ptr<FJobQueue>& Queue : Queues)
+    {
+        while (PopFront(*Queue, Job))
+        {
+            ExecuteJob(Job);
+        }
+    }
+    Queues.Empty();
+}
+
+void FJobSystem::Dispatch(FJobFunction Job, FJobCounter* Counter)
+{
+    if (Counter)
+    {
+        Counter->Value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Enqueue(FJob{std::move(Job), Counter});
+}
+
+void FJobSystem::DispatchAfter(FJobCounter& Prerequisite, FJobFunction Job, FJobCounter* Counter)
+{
+    if (Counter)
+    {
+        Counter->Value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        // ReleaseCounter가 마지막 감소를 같은 잠금 안에서 하므로, 여기서 본 값이 0이 아니라면 반드시 나중에 깨워짐
+        std::lock_guard Lock(Prerequisite.Mutex);
+        if (!Prerequisite.IsDone())
+        {
+            Prerequisite.WaitingJobs.Emplace(std::move(Job), Counter);
+            return;
+        }
+    }
+
+    Enqueue(FJob{std::move(Job), Counter});
+}
+
+void FJobSystem::Wait(FJobCounter& Counter)
+{
+    FJob Job;
+    while (!Counter.IsDone())
+    {
+        if (IsInitialized() && FindJob(GetLocalWorkerIndex(), Job))
+        {
+            ExecuteJob(Job);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // 마지막 Job을 끝낸 스레드가 Counter의 잠금을 풀 때까지 기다려, 반환 직후 Counter를 파괴해도 안전하도록 함
+    std::lock_guard Lock(Counter.Mutex);
+}
+
+void FJobSystem::ParallelFor(int32 Num, const TFunction<void(int32)>& Body, int32 GrainSize)
+{
+    ParallelForRange(
+        Num,
+        [&Body](int32 Begin, int32 End)
+        {
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                Body(Index);
+            }
+        },
+        GrainSize
+    );
+}
+
+void FJobSystem::ParallelForRange(int32 Num, const TFunction<void(int32, int32)>& Body, int32 GrainSize)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    const int32 ChunkSize = ComputeGrainSize(Num, GrainSize);
+    if (ChunkSize >= Num || !IsInitialized())
+    {
+        Body(0, Num);
+        return;
+    }
+
+    FJobCounter Counter;
+
+    // 마지막 구간은 호출한 스레드가 직접 처리
+    int32 Start = 0;
+    for (; Start + ChunkSize < Num; Start += ChunkSize)
+    {
+        const int32 End = Start + ChunkSize;
+        Dispatch([&Body, Start, End]() { Body(Start, End); }, &Counter);
+    }
+    Body(Start, Num);
+
+    Wait(Counter);
+}
+
+bool FJobSystem::IsInWorkerThread()
+{
+    return GCurrentWorkerIndex >= 0;
+}
+
+int32 FJobSystem::GetLocalWorkerIndex() const
+{
+    return GCurrentWorkerOwner == this ? GCurrentWorkerIndex : -1;
+}
+
+void FJobSystem::WorkerMain(int32 WorkerIndex)
+{
+    GCurrentWorkerIndex = WorkerIndex;
+    GCurrentWorkerOwner = this;
+    if (OnWorkerThreadStarted)
+    {
+        OnWorkerThreadStarted(WorkerIndex);
+    }
+
+    FJob Job;
+    while (true)
+    {
+        if (FindJob(WorkerIndex, Job))
+        {
+            ExecuteJob(Job);
+            continue;
+        }
+
+        std::unique_lock Lock(WakeMutex);
+        if (!bRunning.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        // 다른 스레드가 Push한 직후의 알림을 놓치더라도 짧은 주기로 다시 확인
+        WakeCondition.wait_for(Lock, std::chrono::milliseconds(1), [this]()
+        {
+            return NumQueuedJobs.load(std::memory_order_acquire) > 0 || !bRunning.load(std::memory_order_acquire);
+        });
+    }
+
+    GCurrentWorkerIndex = -1;
+    GCurrentWorkerOwner = nullptr;
+}
+
+void FJobSystem::Enqueue(FJob&& Job)
+{
+    if (!IsInitialized())
+    {
+        ExecuteJob(Job);
+        return;
+    }
+
+    const int32 WorkerIndex = GetLocalWorkerIndex();
+    FJobQueue& Queue = WorkerIndex >= 0 ? *Queues[WorkerIndex] : GetSharedQueue();
+    {
+        std::lock_guard Lock(Queue.Mutex);
+        Queue.Jobs.push_back(std::move(Job));
+    }
+    NumQueuedJobs.fetch_add(1, std::memory_order_release);
+
+    WakeCondition.notify_one();
+}
+
+bool FJobSystem::FindJob(int32 WorkerIndex, FJob& OutJob)
+{
+    if (NumQueuedJobs.load(std::memory_order_acquire) <= 0)
+    {
+        return false;
+    }
+
+    // 자신의 Queue에서는 가장 최근에 넣은 Job부터 (캐시 지역성)
+    if (WorkerIndex >= 0 && PopBack(*Queues[WorkerIndex], OutJob))
+    {
+        return true;
+    }
+
+    if (PopFront(GetSharedQueue(), OutJob))
+    {
+        return true;
+    }
+
+    // 다른 Worker의 Queue에서는 가장 오래된 Job부터 훔쳐옴
+    const int32 NumWorkerQueues = Queues.Num() - 1;
+    const int32 StartIndex = WorkerIndex >= 0 ? WorkerIndex + 1 : 0;
+    for (int32 Offset = 0; Offset < NumWorkerQueues; ++Offset)
+    {
+        const int32 VictimIndex = (StartIndex + Offset) % NumWorkerQueues;
+        if (VictimIndex != WorkerIndex && PopFront(*Queues[VictimIndex], OutJob))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FJobSystem::PopBack(FJobQueue& Queue, FJob& OutJob)
+{
+    std::lock_guard Lock(Queue.Mutex);
+    if (Queue.Jobs.empty())
+    {
+        return false;
+    }
+
+    OutJob = std::move(Queue.Jobs.back());
+    Queue.Jobs.pop_back();
+    NumQueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+bool FJobSystem::PopFront(FJobQueue& Queue, FJob& OutJob)
+{
+    std::lock_guard Lock(Queue.Mutex);
+    if (Queue.Jobs.empty())
+    {
+        return false;
+    }
+
+    OutJob = std::move(Queue.Jobs.front());
+    Queue.Jobs.pop_front();
+    NumQueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+void FJobSystem::ExecuteJob(FJob& Job)
+{
+    Job.Task();
+    Job.Task.Reset();
+
+    if (Job.Counter)
+    {
+        FJobCounter* Counter = Job.Counter;
+        Job.Counter = nullptr;
+        ReleaseCounter(*Counter);
+    }
+}
+
+void FJobSystem::ReleaseCounter(FJobCounter& Counter)
+{
+    // 마지막 Job이 아니라면 잠금 없이 감소
+    int32 Current = Counter.Value.load(std::memory_order_relaxed);
+    while (Current > 1)
+    {
+        if (Counter.Value.compare_exchange_weak(Current, Current - 1, std::memory_order_acq_rel))
+        {
+            return;
+        }
+    }
+
+    TArray<FJobCounter::FWaitingJob> ReadyJobs;
+    {
+        std::lock_guard Lock(Counter.Mutex);
+        if (Counter.Value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ReadyJobs = std::move(Counter.WaitingJobs);
+            Counter.WaitingJobs.Empty();
+        }
+    }
+
+    for (FJobCounter::FWaitingJob& ReadyJob : ReadyJobs)
+    {
+        Enqueue(FJob{std::move(ReadyJob.Task), ReadyJob.Counter});
+    }
+}
+
+int32 FJobSystem::ComputeGrainSize(int32 Num, int32 GrainSize) const
+{
+    if (GrainSize > 0)
+    {
+        return GrainSize;
+    }
+
+    // 스레드 수보다 조금 더 잘게 나누어 Work Stealing이 부하를 고르게 분산할 수 있도록 함
+    const int32 NumThreads = GetNumWorkers() + 1;
+    const int32 NumChunks = FMath::Min(Num, NumThreads * 4);
+    return (Num + NumChunks - 1) / NumChunks;
+}
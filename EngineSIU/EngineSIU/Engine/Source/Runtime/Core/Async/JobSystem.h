@@ -0,0 +1,212 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Templates/Function.h"
+
+
+/**
+ * Dispatch된 Job들의 완료 여부를 추적하는 카운터입니다.
+ * Job이 Dispatch될 때 증가하고, Job이 끝나면 감소합니다.
+ *
+ * 다른 Job의 선행 조건(Fence)으로도 사용할 수 있습니다.
+ * FJobSystem::DispatchAfter로 예약된 Job은 이 카운터가 0이 되는 순간 실행 대기열에 들어갑니다.
+ *
+ * @note 카운터를 파괴하기 전에는 반드시 FJobSystem::Wait로 완료를 기다려야 합니다.
+ */
+class FJobCounter
+{
+public:
+    FJobCounter() = default;
+    ~FJobCounter() = default;
+
+    FJobCounter(const FJobCounter&) = delete;
+    FJobCounter& operator=(const FJobCounter&) = delete;
+    FJobCounter(FJobCounter&&) = delete;
+    FJobCounter& operator=(FJobCounter&&) = delete;
+
+    bool IsDone() const { return Value.load(std::memory_order_acquire) == 0; }
+
+    /** 아직 끝나지 않은 Job의 수를 반환합니다. */
+    int32 GetNumPending() const { return Value.load(std::memory_order_acquire); }
+
+private:
+    friend class FJobSystem;
+
+    struct FWaitingJob
+    {
+        TFunction<void()> Task;
+        FJobCounter* Counter = nullptr;
+    };
+
+    std::atomic<int32> Value = 0;
+
+    /** 마지막 Job의 완료와 WaitingJobs 접근을 직렬화 */
+    std::mutex Mutex;
+
+    /** 이 카운터가 0이 되기를 기다리는 Job들 */
+    TArray<FWaitingJob> WaitingJobs;
+};
+
+/**
+ * Work Stealing 방식의 범용 Job System입니다.
+ *
+ * 각 Worker는 자신의 Deque를 가지며, 자신의 Deque에서는 LIFO로 Job을 꺼내고
+ * 할 일이 없으면 다른 Worker의 Deque 앞쪽에서 Job을 훔쳐옵니다.
+ * Worker가 아닌 스레드(Game Thread 등)에서 Dispatch한 Job은 별도의 공용 Queue로 들어갑니다.
+ */
+class FJobSystem
+{
+public:
+    using FJobFunction = TFunction<void()>;
+
+    static FJobSystem& Get();
+
+    FJobSystem() = default;
+    ~FJobSystem();
+
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+    FJobSystem(FJobSystem&&) = delete;
+    FJobSystem& operator=(FJobSystem&&) = delete;
+
+    /**
+     * Worker Thread들을 생성합니다.
+     * @param InNumWorkers 생성할 Worker 수, 0 이하라면 (논리 코어 수 - 1)개를 생성합니다.
+     */
+    void Initialize(int32 InNumWorkers = 0);
+
+    /** 남은 Job을 모두 처리한 뒤 Worker Thread들을 종료합니다. */
+    void Shutdown();
+
+    /**
+     * Worker Thread가 시작될 때 그 스레드에서 호출될 함수를 정합니다. Initialize 전에 설정해야 합니다.
+     * Profiler 같은 엔진 서비스에 Worker를 등록할 때 사용하며, Job System은 이런 서비스에 의존하지 않습니다.
+     */
+    void SetOnWorkerThreadStarted(TFunction<void(int32)> InCallback) { OnWorkerThreadStarted = std::move(InCallback); }
+
+    bool IsInitialized() const { return bRunning.load(std::memory_order_acquire); }
+    int32 GetNumWorkers() const { return Workers.Num(); }
+
+    /**
+     * Job을 Dispatch합니다. Worker가 없다면 호출한 스레드에서 바로 실행합니다.
+     * @param Job 실행할 함수
+     * @param Counter 완료를 추적할 카운터, nullptr 가능
+     */
+    void Dispatch(FJobFunction Job, FJobCounter* Counter = nullptr);
+
+    /**
+     * Prerequisite의 모든 Job이 끝난 뒤에 실행될 Job을 예약합니다.
+     * Prerequisite가 이미 끝났다면 Dispatch와 같습니다.
+     * @param Prerequisite 선행 조건이 되는 카운터
+     * @param Job 실행할 함수
+     * @param Counter 완료를 추적할 카운터, nullptr 가능. 예약 시점에 바로 증가합니다.
+     */
+    void DispatchAfter(FJobCounter& Prerequisite, FJobFunction Job, FJobCounter* Counter = nullptr);
+
+    /** Counter가 0이 될 때까지 대기합니다. 대기하는 동안 호출한 스레드도 Job을 수행합니다. */
+    void Wait(FJobCounter& Counter);
+
+    /**
+     * [0, Num) 범위를 나누어 병렬로 실행하고, 모두 끝날 때까지 대기합니다.
+     * @param Num 반복 횟수
+     * @param Body 각 Index마다 호출될 함수
+     * @param GrainSize 하나의 Job이 처리할 최소 Index 수, 0 이하라면 스레드 수에 맞춰 자동으로 정합니다.
+     */
+    void ParallelFor(int32 Num, const TFunction<void(int32)>& Body, int32 GrainSize = 0);
+
+    /**
+     * [0, Num) 범위를 GrainSize 단위의 구간으로 나누어 병렬로 실행하고, 모두 끝날 때까지 대기합니다.
+     * 구간마다 한 번씩 호출되므로, Index마다 함수를 호출하는 비용이 부담될 때 사용합니다.
+     * @param Body [Begin, End) 구간을 처리할 함수
+     */
+    void ParallelForRange(int32 Num, const TFunction<void(int32, int32)>& Body, int32 GrainSize = 0);
+
+    /**
+     * TArray의 각 원소에 대해 병렬로 Body를 호출하고, 모두 끝날 때까지 대기합니다.
+     * 처리 도중 배열의 크기를 바꾸면 안 됩니다.
+     */
+    template <typename ElementType, typename AllocatorType, typename FuncType>
+        requires std::is_invocable_v<FuncType&, ElementType&>
+    void ParallelFor(TArray<ElementType, AllocatorType>& Array, FuncType&& Body, int32 GrainSize = 0);
+
+    /** 현재 스레드가 Job System의 Worker Thread인지 여부를 반환합니다. */
+    static bool IsInWorkerThread();
+
+private:
+    struct FJob
+    {
+        FJobFunction Task;
+        FJobCounter* Counter = nullptr;
+    };
+
+    struct FJobQueue
+    {
+        std::mutex Mutex;
+        std::deque<FJob> Jobs;
+    };
+
+    void WorkerMain(int32 WorkerIndex);
+
+    /** 카운터를 건드리지 않고 Job을 Queue에 넣습니다. */
+    void Enqueue(FJob&& Job);
+
+    /** 현재 스레드가 이 Job System의 Worker라면 그 Index, 다른 Job System의 Worker나 외부 스레드라면 -1 */
+    int32 GetLocalWorkerIndex() const;
+
+    /** 자신의 Queue, 공용 Queue, 다른 Worker의 Queue 순서로 Job을 찾습니다. */
+    bool FindJob(int32 WorkerIndex, FJob& OutJob);
+
+    bool PopBack(FJobQueue& Queue, FJob& OutJob);
+    bool PopFront(FJobQueue& Queue, FJob& OutJob);
+
+    void ExecuteJob(FJob& Job);
+
+    /** Job 하나의 완료를 Counter에 반영하고, 0이 되었다면 기다리던 Job들을 Queue에 넣습니다. */
+    void ReleaseCounter(FJobCounter& Counter);
+
+    /** Num개의 Index를 나눌 구간 크기를 계산합니다. */
+    int32 ComputeGrainSize(int32 Num, int32 GrainSize) const;
+
+    FJobQueue& GetSharedQueue() { return *Queues.Last(); }
+
+private:
+    TArray<std::thread> Workers;
+
+    /** [0, NumWorkers)는 각 Worker의 Queue, 마지막은 외부 스레드용 공용 Queue */
+    TArray<std::unique_ptr<FJobQueue>> Queues;
+
+    std::atomic<bool> bRunning = false;
+    std::atomic<int32> NumQueuedJobs = 0;
+
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+
+    /** Worker Index를 받아 Worker Thread에서 한 번 호출 */
+    TFunction<void(int32)> OnWorkerThreadStarted;
+};
+
+
+template <typename ElementType, typename AllocatorType, typename FuncType>
+    requires std::is_invocable_v<FuncType&, ElementType&>
+void FJobSystem::ParallelFor(TArray<ElementType, AllocatorType>& Array, FuncType&& Body, int32 GrainSize)
+{
+    ElementType* Data = Array.GetData();
+    ParallelForRange(
+        Array.Num(),
+        [Data, &Body](int32 Begin, int32 End)
+        {
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                Body(Data[Index]);
+            }
+        },
+        GrainSize
+    );
+}
@@ -0,0 +1,321 @@
+#include "JobSystemTest.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <thread>
+
+#include "JobSystem.h"
+#include "Math/MathUtility.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    using FClock = std::chrono::steady_clock;
+
+    double GetElapsedMs(FClock::time_point Start)
+    {
+        return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+    }
+
+    /** 원소 하나의 작업, 스레드 수에 따른 차이가 메모리 대역폭보다 연산에 좌우되도록 조금 무겁게 함 */
+    float ComputeItem(int32 Index)
+    {
+        float Value = static_cast<float>(Index & 1023);
+        for (int32 Step = 0; Step < 64; ++Step)
+        {
+            Value = std::sqrt(Value * Value + 1.0f) * 0.999f;
+        }
+        return Value;
+    }
+
+    bool CheckResult(bool bCondition, const char* TestName, int32 Iteration)
+    {
+        if (!bCondition)
+        {
+            UE_LOG(ELogLevel::Error, TEXT("Job stress test failed: %s (iteration %d)"), TestName, Iteration);
+        }
+        return bCondition;
+    }
+
+    /** 모든 Index가 정확히 한 번씩 처리되었는지 검사 */
+    bool TestParallelFor(FJobSystem& System, int32 Iteration)
+    {
+        const int32 Num = 100000 + Iteration * 37;
+        const int32 GrainSize = Iteration % 4 == 0 ? 0 : 1 + Iteration % 97;
+
+        std::unique_ptr<std::atomic<int32>[]> Visits(new std::atomic<int32>[Num]);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Visits[Index].store(0, std::memory_order_relaxed);
+        }
+
+        System.ParallelFor(Num, [&Visits](int32 Index) { Visits[Index].fetch_add(1, std::memory_order_relaxed); }, GrainSize);
+        System.ParallelForRange(
+            Num,
+            [&Visits](int32 Begin, int32 End)
+            {
+                for (int32 Index = Begin; Index < End; ++Index)
+                {
+                    Visits[Index].fetch_add(1, std::memory_order_relaxed);
+                }
+            },
+            GrainSize
+        );
+
+        TArray<int32> Values;
+        Values.SetNum(Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Values[Index] = Index;
+        }
+        System.ParallelFor(Values, [](int32& Value) { Value = -Value - 1; }, GrainSize);
+
+        bool bPassed = true;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            bPassed &= Visits[Index].load(std::memory_order_relaxed) == 2;
+            bPassed &= Values[Index] == -Index - 1;
+        }
+        return CheckResult(bPassed, "ParallelFor coverage", Iteration);
+    }
+
+    /** Job 안에서 같은 카운터로 Job을 Dispatch해도 모든 Job이 끝난 뒤에만 Wait가 반환되는지 검사 */
+    bool TestNestedDispatch(FJobSystem& System, int32 Iteration)
+    {
+        constexpr int32 NumOuterJobs = 64;
+        constexpr int32 NumInnerJobs = 64;
+
+        std::atomic<int32> NumExecuted = 0;
+        FJobCounter Counter;
+        for (int32 OuterIndex = 0; OuterIndex < NumOuterJobs; ++OuterIndex)
+        {
+            System.Dispatch([&System, &Counter, &NumExecuted]()
+            {
+                for (int32 InnerIndex = 0; InnerIndex < NumInnerJobs; ++InnerIndex)
+                {
+                    System.Dispatch([&NumExecuted]() { NumExecuted.fetch_add(1, std::memory_order_relaxed); }, &Counter);
+                }
+                NumExecuted.fetch_add(1, std::memory_order_relaxed);
+            }, &Counter);
+        }
+        System.Wait(Counter);
+
+        return CheckResult(NumExecuted.load() == NumOuterJobs * (NumInnerJobs + 1), "nested dispatch", Iteration);
+    }
+
+    /** DispatchAfter로 이어진 단계의 Job이 이전 단계의 모든 Job이 끝난 뒤에만 실행되는지 검사 */
+    bool TestDispatchAfterChain(FJobSystem& System, int32 Iteration)
+    {
+        constexpr int32 NumStages = 4;
+        constexpr int32 NumJobsPerStage = 32;
+
+        FJobCounter Stages[NumStages];
+        std::atomic<int32> NumCompleted[NumStages] = {};
+        std::atomic<int32> NumOrderViolations = 0;
+
+        for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
+        {
+            for (int32 JobIndex = 0; JobIndex < NumJobsPerStage; ++JobIndex)
+            {
+                auto Job = [&NumCompleted, &NumOrderViolations, StageIndex]()
+                {
+                    if (StageIndex > 0 && NumCompleted[StageIndex - 1].load(std::memory_order_acquire) != NumJobsPerStage)
+                    {
+                        NumOrderViolations.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    NumCompleted[StageIndex].fetch_add(1, std::memory_order_acq_rel);
+                };
+
+                if (StageIndex == 0)
+                {
+                    System.Dispatch(Job, &Stages[StageIndex]);
+                }
+                else
+                {
+                    System.DispatchAfter(Stages[StageIndex - 1], Job, &Stages[StageIndex]);
+                }
+            }
+        }
+
+        for (FJobCounter& Stage : Stages)
+        {
+            System.Wait(Stage);
+        }
+
+        return CheckResult(
+            NumOrderViolations.load() == 0 && NumCompleted[NumStages - 1].load() == NumJobsPerStage,
+            "DispatchAfter chain", Iteration
+        );
+    }
+
+    /** Wait 직후 파괴되는 스택 카운터와 Worker가 아닌 여러 스레드의 동시 Dispatch를 검사 */
+    bool TestExternalThreads(FJobSystem& System, int32 Iteration)
+    {
+        constexpr int32 NumThreads = 4;
+        constexpr int32 NumRounds = 250;
+
+        std::atomic<int32> NumExecuted = 0;
+        std::thread Threads[NumThreads];
+        for (std::thread& Thread : Threads)
+        {
+            Thread = std::thread([&System, &NumExecuted]()
+            {
+                for (int32 Round = 0; Round < NumRounds; ++Round)
+                {
+                    FJobCounter Counter;
+                    System.Dispatch([&NumExecuted]() { NumExecuted.fetch_add(1, std::memory_order_relaxed); }, &Counter);
+                    System.Dispatch([&NumExecuted]() { NumExecuted.fetch_add(1, std::memory_order_relaxed); }, &Counter);
+                    System.Wait(Counter);
+                }
+            });
+        }
+        for (std::thread& Thread : Threads)
+        {
+            Thread.join();
+        }
+
+        return CheckResult(NumExecuted.load() == NumThreads * NumRounds * 2, "external thread dispatch", Iteration);
+    }
+
+    /** Worker 수가 다른 Job System을 한 System의 Worker 안에서 사용, 바깥 System의 Worker Index로 안쪽 Queue를 찾으면 안 됨 */
+    bool TestNestedSystems(FJobSystem& System, FJobSystem& InnerSystem, int32 Iteration)
+    {
+        constexpr int32 NumOuterJobs = 16;
+        constexpr int32 NumInnerItems = 256;
+
+        std::atomic<int32> NumExecuted = 0;
+        FJobCounter Counter;
+        for (int32 Job = 0; Job < NumOuterJobs; ++Job)
+        {
+            System.Dispatch([&InnerSystem, &NumExecuted]()
+            {
+                InnerSystem.ParallelFor(NumInnerItems, [&NumExecuted](int32) { NumExecuted.fetch_add(1, std::memory_order_relaxed); }, 1);
+
+                FJobCounter InnerCounter;
+                InnerSystem.Dispatch([&NumExecuted]() { NumExecuted.fetch_add(1, std::memory_order_relaxed); }, &InnerCounter);
+                InnerSystem.Wait(InnerCounter);
+            }, &Counter);
+        }
+        System.Wait(Counter);
+
+        return CheckResult(NumExecuted.load() == NumOuterJobs * (NumInnerItems + 1), "nested job systems", Iteration);
+    }
+}
+
+bool FJobSystemTest::RunStressTest(int32 NumIterations, int32 NumWorkers)
+{
+    if (NumIterations <= 0)
+    {
+        return false;
+    }
+
+    FJobSystem System;
+    System.Initialize(NumWorkers);
+
+    FJobSystem InnerSystem;
+    InnerSystem.Initialize(1);
+
+    const FClock::time_point Start = FClock::now();
+
+    int32 NumFailures = 0;
+    for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+    {
+        NumFailures += TestParallelFor(System, Iteration) ? 0 : 1;
+        NumFailures += TestNestedDispatch(System, Iteration) ? 0 : 1;
+        NumFailures += TestDispatchAfterChain(System, Iteration) ? 0 : 1;
+        NumFailures += TestExternalThreads(System, Iteration) ? 0 : 1;
+        NumFailures += TestNestedSystems(System, InnerSystem, Iteration) ? 0 : 1;
+    }
+    InnerSystem.Shutdown();
+
+    NumWorkers = System.GetNumWorkers();
+    System.Shutdown();
+
+    UE_LOG(
+        NumFailures == 0 ? ELogLevel::Display : ELogLevel::Error,
+        TEXT("Job stress test %s: %d iterations on %d workers, %d failures, %.1f ms"),
+        NumFailures == 0 ? TEXT("PASS") : TEXT("FAIL"), NumIterations, NumWorkers, NumFailures, GetElapsedMs(Start)
+    );
+    return NumFailures == 0;
+}
+
+void FJobSystemTest::RunScalingBenchmark(int32 NumItems, int32 NumRepeats, int32 MaxThreads)
+{
+    if (NumItems <= 0 || NumRepeats <= 0)
+    {
+        return;
+    }
+
+    if (MaxThreads <= 0)
+    {
+        MaxThreads = FMath::Max(1, static_cast<int32>(std::thread::hardware_concurrency()));
+    }
+
+    TArray<float> Output;
+    Output.SetNum(NumItems);
+    float* OutputData = Output.GetData();
+
+    auto ComputeRange = [OutputData](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            OutputData[Index] = ComputeItem(Index);
+        }
+    };
+
+    double BaseComputeMs = 0.0;
+    double BaseFineGrainMs = 0.0;
+    double BaseChecksum = 0.0;
+
+    for (int32 NumThreads = 1; NumThreads <= MaxThreads; ++NumThreads)
+    {
+        // 1스레드는 Worker 없이 호출한 스레드에서 바로 실행
+        FJobSystem System;
+        if (NumThreads > 1)
+        {
+            System.Initialize(NumThreads - 1);
+        }
+
+        double ComputeMs = 0.0;
+        double FineGrainMs = 0.0;
+        for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            FClock::time_point Start = FClock::now();
+            System.ParallelForRange(NumItems, ComputeRange);
+            const double RepeatComputeMs = GetElapsedMs(Start);
+
+            // 작은 Job을 많이 만들어 Queue와 Stealing 비용까지 포함
+            Start = FClock::now();
+            System.ParallelForRange(NumItems, ComputeRange, 256);
+            const double RepeatFineGrainMs = GetElapsedMs(Start);
+
+            ComputeMs = Repeat == 0 ? RepeatComputeMs : FMath::Min(ComputeMs, RepeatComputeMs);
+            FineGrainMs = Repeat == 0 ? RepeatFineGrainMs : FMath::Min(FineGrainMs, RepeatFineGrainMs);
+        }
+
+        System.Shutdown();
+
+        double Checksum = 0.0;
+        for (int32 Index = 0; Index < NumItems; ++Index)
+        {
+            Checksum += OutputData[Index];
+        }
+
+        if (NumThreads == 1)
+        {
+            BaseComputeMs = ComputeMs;
+            BaseFineGrainMs = FineGrainMs;
+            BaseChecksum = Checksum;
+        }
+
+        UE_LOG(
+            Checksum == BaseChecksum ? ELogLevel::Display : ELogLevel::Error,
+            TEXT("Job scaling %2d threads: auto grain %.2f ms (x%.2f), grain 256 %.2f ms (x%.2f)%s"),
+            NumThreads,
+            ComputeMs, ComputeMs > 0.0 ? BaseComputeMs / ComputeMs : 0.0,
+            FineGrainMs, FineGrainMs > 0.0 ? BaseFineGrainMs / FineGrainMs : 0.0,
+            Checksum == BaseChecksum ? TEXT("") : TEXT(", result mismatch")
+        );
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * FJobSystem의 Stress Test와 코어 수에 따른 Scaling Benchmark
+ *
+ * - 전역 FJobSystem::Get()을 건드리지 않도록 별도의 FJobSystem 인스턴스를 만들어 실행
+ * - 시간 측정은 std::chrono만 사용하므로 Job System과 함께 Renderer나 Window 없이 실행 가능
+ */
+struct FJobSystemTest
+{
+    /**
+     * ParallelFor, 중첩 Dispatch, DispatchAfter 체인과 Fan-in, 스택 카운터 재사용, Worker 안에서 다른 Job System 사용을 NumIterations번 반복하며 결과를 검사합니다.
+     * @param NumWorkers 테스트용 Job System의 Worker 수, 0 이하라면 (논리 코어 수 - 1)
+     * @return 모든 검사를 통과하면 true
+     */
+    static bool RunStressTest(int32 NumIterations, int32 NumWorkers = 0);
+
+    /**
+     * 1개부터 MaxThreads개까지 스레드를 늘려가며 같은 작업의 시간을 측정하고 1스레드 대비 속도를 출력합니다.
+     * @param NumItems ParallelFor로 처리할 원소 수
+     * @param NumRepeats 스레드 수마다 반복할 횟수, 가장 빠른 결과를 사용
+     * @param MaxThreads 측정할 최대 스레드 수, 0 이하라면 논리 코어 수
+     */
+    static void RunScalingBenchmark(int32 NumItems, int32 NumRepeats, int32 MaxThreads = 0);
+};
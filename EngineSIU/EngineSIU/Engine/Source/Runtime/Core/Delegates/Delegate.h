@@ -1,6 +1,9 @@
 #pragma once
+#include <atomic>
 #include <functional>
+#include "Core/Container/Array.h"
 #include "Core/Container/Map.h"
+#include "Templates/Function.h"
 #include "UObject/WeakObjectPtr.h"
 #include "UserInterface/Console.h"
 
@@ -66,22 +69,44 @@ struct std::hash<FDelegateHandle>
 template <typename Signature>
 class TDelegate;
 
+/**
+ * 단일 바인딩 델리게이트
+ *
+ * - Callable은 TFunction에 저장되므로 작은 람다와 멤버 함수 바인딩은 힙 할당이 없음
+ * - BindRaw는 객체 포인터와 멤버 함수 포인터만 저장하고 호출 시 검사하지 않음
+ * - BindUObject, BindWeakLambda는 호출할 때마다 TWeakObjectPtr로 객체가 살아 있는지 확인
+ */
 template <typename ReturnType, typename... ParamTypes>
 class TDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
-	FuncType Func;
+    using FuncType = TFunction<ReturnType(ParamTypes...)>;
+    FuncType Func;
+
+    // 약한 참조 객체의 멤버 함수, 람다로 감싸지 않아서 TWeakObjectPtr와 멤버 함수 포인터만큼의 크기
+    template <typename UserClass, typename MethodType>
+    struct TWeakMethodCallable
+    {
+        TWeakObjectPtr<UserClass> Object;
+        MethodType Method;
+
+        ReturnType operator()(ParamTypes... Params) const
+        {
+            if (UserClass* Ptr = Object.Get())
+            {
+                return (Ptr->*Method)(std::forward<ParamTypes>(Params)...);
+            }
+
+            UE_LOG(ELogLevel::Warning, "TDelegate executing on invalid object. Returning default value.");
+            return ReturnType{};
+        }
+    };
 
 public:
-	template <typename FunctorType>
-	void BindLambda(FunctorType&& InFunctor)
-	{
-	    Func = [Func = std::forward<FunctorType>(InFunctor)](ParamTypes... Params) mutable
-	    {
-	        return Func(std::forward<ParamTypes>(Params)...);
-	    };
-	}
+    template <typename FunctorType>
+    void BindLambda(FunctorType&& InFunctor)
+    {
+        Func = FuncType(std::forward<FunctorType>(InFunctor));
+    }
 
     template <typename UserClass, typename FunctorType>
         requires std::derived_from<UserClass, UObject>
@@ -106,78 +131,196 @@ public:
         requires std::derived_from<UserClass, UObject> && std::is_member_function_pointer_v<MethodType>
     void BindUObject(UserClass* Obj, MethodType InMethod)
     {
-        Func = [SafeObj = TWeakObjectPtr<UserClass>(Obj), InMethod](ParamTypes... Params) mutable
-        {
-            if (SafeObj.IsValid())
-            {
-                return (SafeObj->*InMethod)(std::forward<ParamTypes>(Params)...);
-            }
+        Func = TWeakMethodCallable<UserClass, MethodType>{ TWeakObjectPtr<UserClass>(Obj), InMethod };
+    }
 
-            UE_LOG(ELogLevel::Warning, "TDelegate executing on invalid object. Returning default value.");
-            return ReturnType{};
-        };
+    /** 객체의 수명은 호출하는 쪽이 보장해야 함 */
+    template <typename UserClass, typename MethodType>
+        requires std::is_member_function_pointer_v<MethodType>
+    void BindRaw(UserClass* Obj, MethodType InMethod)
+    {
+        Func = FuncType(Obj, InMethod);
     }
 
     void UnBind()
-	{
-		Func = nullptr;
-	}
+    {
+        Func = nullptr;
+    }
 
-	bool IsBound() const
-	{
-	    return static_cast<bool>(Func);
-	}
+    bool IsBound() const
+    {
+        return Func.IsBound();
+    }
 
-	ReturnType Execute(ParamTypes... InArgs) const
-	{
-		return Func(std::forward<ParamTypes>(InArgs)...);
-	}
+    ReturnType Execute(ParamTypes... InArgs) const
+    {
+        return Func(std::forward<ParamTypes>(InArgs)...);
+    }
 
-	bool ExecuteIfBound(ParamTypes... InArgs) const
-	{
-		if (IsBound())
-		{
-			Execute(std::forward<ParamTypes>(InArgs)...);
-			return true;
-		}
-		return false;
-	}
+    bool ExecuteIfBound(ParamTypes... InArgs) const
+    {
+        if (IsBound())
+        {
+            Execute(std::forward<ParamTypes>(InArgs)...);
+            return true;
+        }
+        return false;
+    }
 };
 
 template <typename Signature>
 class TMulticastDelegate;
 
+/**
+ * 여러 Callable을 추가한 순서대로 호출하는 델리게이트
+ *
+ * - 호출 목록은 연속된 배열이고 Broadcast는 복사 없이 배열을 순회
+ * - Broadcast 중에 Remove하면 핸들만 무효화해 두고 가장 바깥 Broadcast가 끝날 때 배열에서 제거
+ * - Broadcast 중에 추가한 Callable은 별도 배열에 두었다가 Broadcast가 끝나면 합쳐서, 진행 중인 Broadcast에서는 호출되지 않음
+ * - AddUObject, AddWeakLambda의 객체가 사라지면 Broadcast가 바인딩을 제거, Callable이 델리게이트를 가리키지 않으므로 복사와 이동이 안전
+ */
 template <typename ReturnType, typename... ParamTypes>
 class TMulticastDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
-    TMap<FDelegateHandle, FuncType> DelegateHandles;
+    using FuncType = TFunction<ReturnType(ParamTypes...)>;
 
-public:
-    template <typename FunctorType>
-    FDelegateHandle AddLambda(FunctorType&& InFunctor)
+    struct FInvocation
+    {
+        FDelegateHandle Handle;
+        FuncType Func;
+
+        /** 약한 참조 바인딩의 객체, Broadcast가 호출 전에 확인 */
+        TWeakObjectPtr<UObject> WeakObject;
+        bool bIsWeak = false;
+    };
+
+    template <typename UserClass, typename MethodType>
+    struct TWeakMethodCallable
     {
-        FDelegateHandle Handle = FDelegateHandle::CreateHandle();
-        DelegateHandles.Add(
-            Handle,
-            [Func = std::forward<FunctorType>(InFunctor)](ParamTypes... Params) mutable
+        TWeakObjectPtr<UserClass> Object;
+        MethodType Method;
+
+        void operator()(ParamTypes... Params) const
+        {
+            if (UserClass* Ptr = Object.Get())
             {
-                Func(std::forward<ParamTypes>(Params)...);
+                (Ptr->*Method)(std::forward<ParamTypes>(Params)...);
             }
-        );
+        }
+    };
+
+    // Broadcast는 const이지만 그 안에서 Remove, Add가 불릴 수 있으므로 mutable
+    mutable TArray<FInvocation> Invocations;
+    mutable TArray<FInvocation> PendingInvocations;
+    mutable int32 BroadcastDepth = 0;
+    mutable bool bHasRemovedInvocations = false;
+
+    FDelegateHandle AddInvocation(FDelegateHandle Handle, FuncType&& Func, UObject* WeakObject = nullptr)
+    {
+        FInvocation Invocation{ Handle, std::move(Func), TWeakObjectPtr<UObject>(WeakObject), WeakObject != nullptr };
+        if (BroadcastDepth > 0)
+        {
+            PendingInvocations.Add(std::move(Invocation));
+        }
+        else
+        {
+            Invocations.Add(std::move(Invocation));
+        }
         return Handle;
     }
 
+    /** Broadcast 중인 델리게이트를 복사해도 무효화된 바인딩과 진행 중인 상태는 가져오지 않음 */
+    void CopyInvocationsFrom(const TMulticastDelegate& Other)
+    {
+        Invocations.Empty();
+        PendingInvocations.Empty();
+        for (const FInvocation& Invocation : Other.Invocations)
+        {
+            if (Invocation.Handle.IsValid())
+            {
+                Invocations.Add(Invocation);
+            }
+        }
+        for (const FInvocation& Invocation : Other.PendingInvocations)
+        {
+            Invocations.Add(Invocation);
+        }
+        BroadcastDepth = 0;
+        bHasRemovedInvocations = false;
+    }
+
+    void FinishBroadcast() const
+    {
+        if (--BroadcastDepth > 0)
+        {
+            return;
+        }
+
+        if (bHasRemovedInvocations)
+        {
+            Invocations.RemoveAll([](const FInvocation& Invocation) { return !Invocation.Handle.IsValid(); });
+            bHasRemovedInvocations = false;
+        }
+        if (PendingInvocations.Num() > 0)
+        {
+            for (FInvocation& Invocation : PendingInvocations)
+            {
+                Invocations.Add(std::move(Invocation));
+            }
+            PendingInvocations.Empty();
+        }
+    }
+
+public:
+    TMulticastDelegate() = default;
+    ~TMulticastDelegate() = default;
+
+    TMulticastDelegate(const TMulticastDelegate& Other)
+    {
+        CopyInvocationsFrom(Other);
+    }
+
+    TMulticastDelegate& operator=(const TMulticastDelegate& Other)
+    {
+        if (this != &Other)
+        {
+            CopyInvocationsFrom(Other);
+        }
+        return *this;
+    }
+
+    TMulticastDelegate(TMulticastDelegate&& Other) noexcept
+        : Invocations(std::move(Other.Invocations))
+        , PendingInvocations(std::move(Other.PendingInvocations))
+        , bHasRemovedInvocations(std::exchange(Other.bHasRemovedInvocations, false))
+    {
+    }
+
+    TMulticastDelegate& operator=(TMulticastDelegate&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Invocations = std::move(Other.Invocations);
+            PendingInvocations = std::move(Other.PendingInvocations);
+            BroadcastDepth = 0;
+            bHasRemovedInvocations = std::exchange(Other.bHasRemovedInvocations, false);
+        }
+        return *this;
+    }
+
+    template <typename FunctorType>
+    FDelegateHandle AddLambda(FunctorType&& InFunctor)
+    {
+        return AddInvocation(FDelegateHandle::CreateHandle(), FuncType(std::forward<FunctorType>(InFunctor)));
+    }
+
     template <typename UserClass, typename FunctorType>
         requires std::derived_from<UserClass, UObject>
     FDelegateHandle AddWeakLambda(UserClass* InUserObject, FunctorType&& InFunctor)
     {
-        FDelegateHandle Handle = FDelegateHandle::CreateHandle();
-        DelegateHandles.Add(
-            Handle,
+        return AddInvocation(
+            FDelegateHandle::CreateHandle(),
             [
-                this, Handle,
                 SafeObject = TWeakObjectPtr<UserClass>(InUserObject),
                 Func = std::forward<FunctorType>(InFunctor)
             ](ParamTypes... Params) mutable
@@ -186,55 +329,93 @@ public:
                 {
                     return Func(std::forward<ParamTypes>(Params)...);
                 }
-
-                Remove(Handle); // 유효한 포인터가 사라지면 델리게이트에서 제거
                 return ReturnType{};
-            }
+            },
+            InUserObject
         );
-        return Handle;
     }
 
     template <typename UserClass, typename MethodType>
         requires std::derived_from<UserClass, UObject> && std::is_member_function_pointer_v<MethodType>
     FDelegateHandle AddUObject(UserClass* InUserObject, MethodType InMethod)
     {
-        FDelegateHandle Handle = FDelegateHandle::CreateHandle();
-        DelegateHandles.Add(
-            Handle,
-            [
-                this, Handle,
-                SafeObj = TWeakObjectPtr<UserClass>(InUserObject),
-                InMethod
-            ](ParamTypes... Params)
+        return AddInvocation(
+            FDelegateHandle::CreateHandle(),
+            TWeakMethodCallable<UserClass, MethodType>{ TWeakObjectPtr<UserClass>(InUserObject), InMethod },
+            InUserObject
+        );
+    }
+
+    /** 객체의 수명은 호출하는 쪽이 보장해야 함 */
+    template <typename UserClass, typename MethodType>
+        requires std::is_member_function_pointer_v<MethodType>
+    FDelegateHandle AddRaw(UserClass* InUserObject, MethodType InMethod)
+    {
+        return AddInvocation(FDelegateHandle::CreateHandle(), FuncType(InUserObject, InMethod));
+    }
+
+    bool Remove(FDelegateHandle Handle)
+    {
+        if (!Handle.IsValid())
+        {
+            return false;
+        }
+
+        for (int32 Index = 0; Index < Invocations.Num(); ++Index)
+        {
+            if (Invocations[Index].Handle == Handle)
             {
-                if (SafeObj.IsValid())
+                // 실행 중인 Callable이 자기 자신을 제거할 수 있으므로 Broadcast 중에는 표시만 해 둠
+                if (BroadcastDepth > 0)
                 {
-                    return (SafeObj->*InMethod)(std::forward<ParamTypes>(Params)...);
+                    Invocations[Index].Handle.Invalidate();
+                    bHasRemovedInvocations = true;
                 }
-    
-                Remove(Handle); // 유효한 포인터가 사라지면 델리게이트에서 제거
-                return ReturnType{};
+                else
+                {
+                    Invocations.RemoveAt(Index);
+                }
+                return true;
             }
-        );
-        return Handle;
+        }
+
+        for (int32 Index = 0; Index < PendingInvocations.Num(); ++Index)
+        {
+            if (PendingInvocations[Index].Handle == Handle)
+            {
+                PendingInvocations.RemoveAt(Index);
+                return true;
+            }
+        }
+        return false;
     }
 
-	bool Remove(FDelegateHandle Handle)
-	{
-	    if (Handle.IsValid())
-	    {
-	        DelegateHandles.Remove(Handle);
-	        return true;
-	    }
-	    return false;
-	}
+    bool IsBound() const
+    {
+        return Invocations.Num() > 0 || PendingInvocations.Num() > 0;
+    }
 
-	void Broadcast(ParamTypes... Params) const
-	{
-		auto CopyDelegates = DelegateHandles;
-		for (const auto& [Handle, Delegate] : CopyDelegates)
-		{
-			Delegate(Params...);
-		}
-	}
+    void Broadcast(ParamTypes... Params) const
+    {
+        ++BroadcastDepth;
+        const int32 NumInvocations = Invocations.Num();
+        for (int32 Index = 0; Index < NumInvocations; ++Index)
+        {
+            FInvocation& Invocation = Invocations[Index];
+            if (!Invocation.Handle.IsValid())
+            {
+                continue;
+            }
+
+            // 유효한 객체가 사라지면 델리게이트에서 제거
+            if (Invocation.bIsWeak && !Invocation.WeakObject.IsValid())
+            {
+                Invocation.Handle.Invalidate();
+                bHasRemovedInvocations = true;
+                continue;
+            }
+            Invocation.Func(Params...);
+        }
+        FinishBroadcast();
+    }
 };
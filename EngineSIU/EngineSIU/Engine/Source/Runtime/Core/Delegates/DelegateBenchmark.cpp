@@ -0,0 +1,110 @@
+#include "DelegateBenchmark.h"
+#include <functional>
+
+#include "Delegate.h"
+#include "Container/Map.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    struct FBenchmarkListener
+    {
+        int64 Sum = 0;
+
+        void OnValue(int32 Value) { Sum += Value; }
+    };
+
+    /** Callable의 바인딩과 해제를 Count번 반복하는 동안 늘어난 힙 할당 수 */
+    template <typename BindFuncType>
+    uint64 CountBindAllocations(int32 Count, BindFuncType&& BindFunc)
+    {
+        const uint64 Before = FFunctionStorage::NumHeapAllocations.load(std::memory_order_relaxed);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            TDelegate<void(int32)> Delegate;
+            BindFunc(Delegate);
+        }
+        return FFunctionStorage::NumHeapAllocations.load(std::memory_order_relaxed) - Before;
+    }
+}
+
+void FDelegateBenchmark::Run(int32 NumListeners, int32 NumBroadcasts)
+{
+    if (NumListeners <= 0 || NumBroadcasts <= 0)
+    {
+        return;
+    }
+
+    FBenchmarkListener Listener;
+
+    // 바인딩 종류별 힙 할당, 큰 캡처만 힙에 할당되어야 함
+    const uint64 RawAllocs = CountBindAllocations(NumListeners, [&Listener](TDelegate<void(int32)>& Delegate)
+    {
+        Delegate.BindRaw(&Listener, &FBenchmarkListener::OnValue);
+    });
+    const uint64 LambdaAllocs = CountBindAllocations(NumListeners, [&Listener](TDelegate<void(int32)>& Delegate)
+    {
+        Delegate.BindLambda([&Listener](int32 Value) { Listener.Sum += Value; });
+    });
+    const uint64 LargeCaptureAllocs = CountBindAllocations(NumListeners, [&Listener](TDelegate<void(int32)>& Delegate)
+    {
+        int64 Padding[8] = {};
+        Delegate.BindLambda([&Listener, Padding](int32 Value) { Listener.Sum += Value + Padding[0]; });
+    });
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("Delegate bind x%d heap allocs: BindRaw %llu / small lambda %llu / %d byte capture %llu"),
+        NumListeners,
+        static_cast<unsigned long long>(RawAllocs), static_cast<unsigned long long>(LambdaAllocs),
+        static_cast<int32>(sizeof(int64) * 8 + sizeof(void*)), static_cast<unsigned long long>(LargeCaptureAllocs)
+    );
+    if (RawAllocs != 0 || LambdaAllocs != 0)
+    {
+        UE_LOG(ELogLevel::Warning, TEXT("Delegate bindings that fit in %d bytes must not allocate"), static_cast<int32>(FFunctionStorage::InlineSize));
+    }
+
+    // 이전 방식: std::function을 핸들 키 TMap에 담고 Broadcast마다 맵을 복사
+    double StdFunctionMs = 0.0;
+    {
+        TMap<FDelegateHandle, std::function<void(int32)>> DelegateHandles;
+        for (int32 Index = 0; Index < NumListeners; ++Index)
+        {
+            DelegateHandles.Add(FDelegateHandle::CreateHandle(), [&Listener](int32 Value) { Listener.OnValue(Value); });
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Count = 0; Count < NumBroadcasts; ++Count)
+        {
+            auto CopyDelegates = DelegateHandles;
+            for (const auto& [Handle, Delegate] : CopyDelegates)
+            {
+                Delegate(1);
+            }
+        }
+        StdFunctionMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    TMulticastDelegate<void(int32)> Multicast;
+    for (int32 Index = 0; Index < NumListeners; ++Index)
+    {
+        Multicast.AddRaw(&Listener, &FBenchmarkListener::OnValue);
+    }
+
+    const uint64 AllocsBeforeBroadcast = FFunctionStorage::NumHeapAllocations.load(std::memory_order_relaxed);
+    double MulticastMs = 0.0;
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Count = 0; Count < NumBroadcasts; ++Count)
+        {
+            Multicast.Broadcast(1);
+        }
+        MulticastMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+    const uint64 BroadcastAllocs = FFunctionStorage::NumHeapAllocations.load(std::memory_order_relaxed) - AllocsBeforeBroadcast;
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("Multicast %d listeners x%d: std::function map %.3f ms / TMulticastDelegate %.3f ms (%llu allocs), checksum %lld"),
+        NumListeners, NumBroadcasts, StdFunctionMs, MulticastMs,
+        static_cast<unsigned long long>(BroadcastAllocs), static_cast<long long>(Listener.Sum)
+    );
+}
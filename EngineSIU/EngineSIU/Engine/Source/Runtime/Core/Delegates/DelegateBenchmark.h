@@ -0,0 +1,14 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 델리게이트 바인딩의 힙 할당 수와 Broadcast 시간을 측정해서 로그로 출력
+ *
+ * - 바인딩 종류별로 FFunctionStorage::NumHeapAllocations가 얼마나 늘었는지 확인
+ * - Broadcast는 std::function을 TMap에 담고 호출할 때마다 복사하던 이전 방식과 비교
+ */
+struct FDelegateBenchmark
+{
+    static void Run(int32 NumListeners, int32 NumBroadcasts);
+};
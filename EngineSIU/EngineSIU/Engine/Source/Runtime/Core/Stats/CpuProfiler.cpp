@@ -0,0 +1,390 @@
+#include "CpuProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+
+#include "ProfilerStatsManager.h"
+#include "WindowsPlatformTime.h"
+#include "Math/MathUtility.h"
+#include "UserInterface/Console.h"
+
+thread_local FCpuProfiler::FThreadBuffer* FCpuProfiler::CurrentThreadBuffer = nullptr;
+
+namespace
+{
+    /** 캡처가 메모리를 무한히 사용하지 않도록 하는 상한, 넘으면 캡처를 자동으로 멈추고 저장 */
+    constexpr int32 MaxCapturedEvents = 4 * 1024 * 1024;
+
+    constexpr uint64 ThreadBufferMask = FCpuProfiler::ThreadBufferCapacity - 1;
+    static_assert((FCpuProfiler::ThreadBufferCapacity & ThreadBufferMask) == 0, "ThreadBufferCapacity must be a power of two");
+
+    /** JSON 문자열 안에 넣을 수 있도록 따옴표와 역슬래시, 제어 문자를 처리합니다. */
+    std::string EscapeJsonString(const std::string& InString)
+    {
+        std::string Result;
+        Result.reserve(InString.size());
+        for (const char Char : InString)
+        {
+            switch (Char)
+            {
+            case '"':  Result += "\\\""; break;
+            case '\\': Result += "\\\\"; break;
+            case '\n': Result += "\\n"; break;
+            case '\t': Result += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(Char) >= 0x20)
+                {
+                    Result += Char;
+                }
+                break;
+            }
+        }
+        return Result;
+    }
+
+    /** 정렬된 Samples에서 Nearest-Rank 방식으로 백분위 값을 구합니다. */
+    double GetPercentile(const TArray<double>& SortedSamples, double Percentile)
+    {
+        const int32 Num = SortedSamples.Num();
+        int32 Rank = static_cast<int32>(std::ceil(Percentile * Num)) - 1;
+        Rank = std::clamp(Rank, 0, Num - 1);
+        return SortedSamples[Rank];
+    }
+}
+
+FCpuProfiler& FCpuProfiler::Get()
+{
+    static FCpuProfiler Instance;
+    return Instance;
+}
+
+void FCpuProfiler::SetCurrentThreadName(const FString& InThreadName)
+{
+    FThreadBuffer& Buffer = GetThreadBuffer();
+
+    std::lock_guard Lock(BuffersMutex);
+    Buffer.ThreadName = InThreadName;
+}
+
+void FCpuProfiler::BeginScope()
+{
+    ++GetThreadBuffer().Depth;
+}
+
+void FCpuProfiler::EndScope(const TStatId& StatId, uint64 StartCycles, uint64 EndCycles)
+{
+    FThreadBuffer& Buffer = GetThreadBuffer();
+    if (Buffer.Depth > 0)
+    {
+        --Buffer.Depth;
+    }
+
+    // 소유 스레드만 기록하므로 WriteCount는 relaxed로 읽고, Event를 채운 뒤 release로 공개
+    const uint64 WriteCount = Buffer.WriteCount.load(std::memory_order_relaxed);
+    FCpuProfileEvent& Event = Buffer.Events[WriteCount & ThreadBufferMask];
+    Event.StatId = StatId;
+    Event.StartCycles = StartCycles;
+    Event.EndCycles = EndCycles;
+    Event.Depth = Buffer.Depth;
+    Buffer.WriteCount.store(WriteCount + 1, std::memory_order_release);
+}
+
+void FCpuProfiler::BeginFrame()
+{
+    ++FrameNumber;
+    FrameStartCycles = FPlatformTime::Cycles64();
+
+    if (bCapturing)
+    {
+        CapturedFrames.Add({ FrameNumber, FrameStartCycles });
+    }
+}
+
+void FCpuProfiler::EndFrame()
+{
+    const uint64 FrameEndCycles = FPlatformTime::Cycles64();
+
+    {
+        std::lock_guard Lock(BuffersMutex);
+        for (std::unique_ptr<FThreadBuffer>& Buffer : Buffers)
+        {
+            DrainBuffer(*Buffer);
+        }
+    }
+
+    if (FrameStartCycles != 0)
+    {
+        static const FName FrameStatName(TEXT("Frame"));
+        AddFrameSample(FrameStatName, FPlatformTime::ToMilliseconds(FrameEndCycles - FrameStartCycles));
+    }
+
+    // 프레임별 값만 쓰는 Profiler 창을 위해 끝난 프레임의 합계를 Game Thread에서 한 번에 채움
+    FProfilerStatsManager::BeginFrame();
+    for (auto& [StatName, History] : StatHistories)
+    {
+        if (!History.bTouchedThisFrame)
+        {
+            continue;
+        }
+
+        FProfilerStatsManager::AddCpuStat(TStatId(StatName), History.FrameMs);
+        History.Samples[History.NextIndex] = History.FrameMs;
+        History.NextIndex = (History.NextIndex + 1) % StatWindowSize;
+        History.NumSamples = FMath::Min(History.NumSamples + 1, StatWindowSize);
+        History.FrameMs = 0.0;
+        History.bTouchedThisFrame = false;
+    }
+
+    if (!bCapturing)
+    {
+        return;
+    }
+
+    if (MaxCaptureFrames > 0 && CapturedFrames.Num() >= MaxCaptureFrames)
+    {
+        bStopCaptureRequested = true;
+    }
+
+    if (CapturedEvents.Num() >= MaxCapturedEvents)
+    {
+        UE_LOG(ELogLevel::Warning, "CPU profiler capture reached %d events, stopping capture", MaxCapturedEvents);
+        bStopCaptureRequested = true;
+    }
+
+    if (bStopCaptureRequested)
+    {
+        const FString FilePath = CaptureFilePath.IsEmpty() ? MakeDefaultCaptureFilePath() : CaptureFilePath;
+        if (WriteChromeTrace(FilePath))
+        {
+            UE_LOG(ELogLevel::Display, "CPU profiler capture saved: %s (%d frames, %d events)",
+                FilePath.ToAnsiString().c_str(), CapturedFrames.Num(), CapturedEvents.Num());
+        }
+        else
+        {
+            UE_LOG(ELogLevel::Error, "Failed to save CPU profiler capture: %s", FilePath.ToAnsiString().c_str());
+        }
+
+        bCapturing = false;
+        bStopCaptureRequested = false;
+        CapturedEvents.Empty();
+        CapturedFrames.Empty();
+    }
+}
+
+void FCpuProfiler::StartCapture(int32 InMaxFrames)
+{
+    if (bCapturing)
+    {
+        return;
+    }
+
+    bCapturing = true;
+    bStopCaptureRequested = false;
+    MaxCaptureFrames = InMaxFrames;
+    CaptureFilePath = FString();
+    CaptureStartCycles = FPlatformTime::Cycles64();
+    CapturedEvents.Empty();
+    CapturedFrames.Empty();
+
+    // 이번 프레임 도중에 시작했더라도 첫 프레임 경계를 남겨둠
+    CapturedFrames.Add({ FrameNumber, CaptureStartCycles });
+}
+
+void FCpuProfiler::StopCapture(const FString& FilePath)
+{
+    if (!bCapturing)
+    {
+        return;
+    }
+
+    CaptureFilePath = FilePath;
+    bStopCaptureRequested = true;
+}
+
+bool FCpuProfiler::GetStatSummary(const FName& StatName, FCpuStatSummary& OutSummary) const
+{
+    const FStatHistory* History = StatHistories.Find(StatName);
+    if (!History || History->NumSamples == 0)
+    {
+        return false;
+    }
+
+    TArray<double> SortedSamples;
+    SortedSamples.Reserve(History->NumSamples);
+
+    double TotalMs = 0.0;
+    for (int32 Index = 0; Index < History->NumSamples; ++Index)
+    {
+        SortedSamples.Add(History->Samples[Index]);
+        TotalMs += History->Samples[Index];
+    }
+    std::sort(SortedSamples.begin(), SortedSamples.end());
+
+    const int32 LastIndex = (History->NextIndex + StatWindowSize - 1) % StatWindowSize;
+    OutSummary.LastMs = History->Samples[LastIndex];
+    OutSummary.MinMs = SortedSamples[0];
+    OutSummary.MaxMs = SortedSamples.Last();
+    OutSummary.AvgMs = TotalMs / History->NumSamples;
+    OutSummary.P50Ms = GetPercentile(SortedSamples, 0.50);
+    OutSummary.P95Ms = GetPercentile(SortedSamples, 0.95);
+    OutSummary.P99Ms = GetPercentile(SortedSamples, 0.99);
+    OutSummary.NumSamples = History->NumSamples;
+    return true;
+}
+
+FCpuProfiler::FThreadBuffer& FCpuProfiler::GetThreadBuffer()
+{
+    if (CurrentThreadBuffer)
+    {
+        return *CurrentThreadBuffer;
+    }
+
+    // 버퍼는 스레드가 끝난 뒤에도 남은 Event를 읽을 수 있도록 Profiler가 소유
+    FCpuProfiler& Profiler = Get();
+    std::lock_guard Lock(Profiler.BuffersMutex);
+
+    const int32 ThreadIndex = Profiler.Buffers.Emplace(std::make_unique<FThreadBuffer>());
+    FThreadBuffer* NewBuffer = Profiler.Buffers[ThreadIndex].get();
+    NewBuffer->ThreadIndex = ThreadIndex;
+    NewBuffer->ThreadName = FString::Printf(TEXT("Thread %d"), ThreadIndex);
+
+    CurrentThreadBuffer = NewBuffer;
+    return *NewBuffer;
+}
+
+void FCpuProfiler::DrainBuffer(FThreadBuffer& Buffer)
+{
+    const uint64 WriteCount = Buffer.WriteCount.load(std::memory_order_acquire);
+    uint64 ReadCount = Buffer.ReadCount;
+
+    if (WriteCount - ReadCount > ThreadBufferCapacity)
+    {
+        NumDroppedEvents += WriteCount - ReadCount - ThreadBufferCapacity;
+        ReadCount = WriteCount - ThreadBufferCapacity;
+    }
+
+    for (; ReadCount < WriteCount; ++ReadCount)
+    {
+        const FCpuProfileEvent Event = Buffer.Events[ReadCount & ThreadBufferMask];
+
+        // 읽는 동안 Producer가 한 바퀴를 돌아 덮어썼다면 이 Event는 버림
+        const uint64 LatestWriteCount = Buffer.WriteCount.load(std::memory_order_acquire);
+        if (LatestWriteCount - ReadCount > ThreadBufferCapacity)
+        {
+            ++NumDroppedEvents;
+            continue;
+        }
+
+        AddFrameSample(Event.StatId.GetName(), FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles));
+
+        if (bCapturing && Event.StartCycles >= CaptureStartCycles && CapturedEvents.Num() < MaxCapturedEvents)
+        {
+            CapturedEvents.Add({ Event, Buffer.ThreadIndex });
+        }
+    }
+
+    Buffer.ReadCount = ReadCount;
+}
+
+void FCpuProfiler::AddFrameSample(const FName& StatName, double TimeMs)
+{
+    FStatHistory& History = StatHistories.FindOrAdd(StatName);
+    History.FrameMs += TimeMs;
+    History.bTouchedThisFrame = true;
+}
+
+bool FCpuProfiler::WriteChromeTrace(const FString& FilePath) const
+{
+    const std::filesystem::path Path(FilePath.ToWideString());
+    if (Path.has_parent_path())
+    {
+        std::error_code ErrorCode;
+        std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+    }
+
+    std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    // Chrome Trace의 시간 단위는 마이크로초
+    const auto ToTraceMicroseconds = [this](uint64 Cycles)
+    {
+        return Cycles > CaptureStartCycles ? FPlatformTime::ToMilliseconds(Cycles - CaptureStartCycles) * 1000.0 : 0.0;
+    };
+
+    char Line[512];
+    bool bFirstEvent = true;
+    const auto WriteLine = [&File, &bFirstEvent](const char* InLine)
+    {
+        File << (bFirstEvent ? "\n" : ",\n") << InLine;
+        bFirstEvent = false;
+    };
+
+    File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    {
+        std::lock_guard Lock(BuffersMutex);
+        for (const std::unique_ptr<FThreadBuffer>& Buffer : Buffers)
+        {
+            const std::string ThreadName = EscapeJsonString(Buffer->ThreadName.ToAnsiString());
+            snprintf(Line, sizeof(Line),
+                R"({"name":"thread_name","ph":"M","pid":0,"tid":%u,"args":{"name":"%s"}})",
+                Buffer->ThreadIndex, ThreadName.c_str());
+            WriteLine(Line);
+
+            // Game Thread가 가장 위에 오도록 등록 순서대로 정렬
+            snprintf(Line, sizeof(Line),
+                R"({"name":"thread_sort_index","ph":"M","pid":0,"tid":%u,"args":{"sort_index":%u}})",
+                Buffer->ThreadIndex, Buffer->ThreadIndex);
+            WriteLine(Line);
+        }
+    }
+
+    for (const FCapturedFrame& Frame : CapturedFrames)
+    {
+        snprintf(Line, sizeof(Line),
+            R"({"name":"Frame %llu","ph":"i","s":"g","pid":0,"tid":0,"ts":%.3f})",
+            Frame.FrameNumber, ToTraceMicroseconds(Frame.StartCycles));
+        WriteLine(Line);
+    }
+
+    // 같은 Stat 이름을 매번 변환하지 않도록 캐시
+    TMap<FName, std::string> StatNames;
+    for (const FCapturedEvent& Captured : CapturedEvents)
+    {
+        const FName StatName = Captured.Event.StatId.GetName();
+        const std::string* Name = StatNames.Find(StatName);
+        if (!Name)
+        {
+            Name = &StatNames.Emplace(StatName, EscapeJsonString(StatName.ToString().ToAnsiString()));
+        }
+
+        const double StartUs = ToTraceMicroseconds(Captured.Event.StartCycles);
+        const double DurationUs = FPlatformTime::ToMilliseconds(Captured.Event.EndCycles - Captured.Event.StartCycles) * 1000.0;
+        snprintf(Line, sizeof(Line),
+            R"({"name":"%s","ph":"X","pid":0,"tid":%u,"ts":%.3f,"dur":%.3f,"args":{"depth":%u}})",
+            Name->c_str(), Captured.ThreadIndex, StartUs, DurationUs, Captured.Event.Depth);
+        WriteLine(Line);
+    }
+
+    File << "\n]}\n";
+    return File.good();
+}
+
+FString FCpuProfiler::MakeDefaultCaptureFilePath()
+{
+    const std::time_t Now = std::time(nullptr);
+    std::tm LocalTime = {};
+    localtime_s(&LocalTime, &Now);
+
+    char TimeString[32];
+    std::strftime(TimeString, sizeof(TimeString), "%Y%m%d_%H%M%S", &LocalTime);
+
+    return FString(std::string("Saved/Profiling/CpuProfile_") + TimeString + ".json");
+}
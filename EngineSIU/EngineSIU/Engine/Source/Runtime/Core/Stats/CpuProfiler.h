@@ -0,0 +1,175 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "StatDefine.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+
+/** Scope 하나의 실행 기록 */
+struct FCpuProfileEvent
+{
+    TStatId StatId;
+    uint64 StartCycles = 0;
+    uint64 EndCycles = 0;
+
+    /** 같은 스레드에서 열려있던 Scope의 수, 최상위 Scope는 0 */
+    uint32 Depth = 0;
+};
+
+/** 최근 StatWindowSize 프레임 동안 한 Stat이 프레임마다 사용한 시간의 통계 */
+struct FCpuStatSummary
+{
+    double LastMs = 0.0;
+    double MinMs = 0.0;
+    double AvgMs = 0.0;
+    double MaxMs = 0.0;
+    double P50Ms = 0.0;
+    double P95Ms = 0.0;
+    double P99Ms = 0.0;
+
+    /** 통계에 사용된 프레임 수 */
+    int32 NumSamples = 0;
+};
+
+/**
+ * 스레드별 Scope 기록을 모아 계층형 CPU 프로파일을 만듭니다.
+ *
+ * FScopeCycleCounter는 끝날 때 현재 스레드의 전용 버퍼에 Event를 하나 기록합니다.
+ * 버퍼는 스레드마다 하나씩 있는 Single Producer 링 버퍼이므로 기록할 때 잠금이 필요 없습니다.
+ * Game Thread가 EndFrame에서 모든 스레드의 버퍼를 비우며 프레임 통계를 갱신하고, 캡처 중이라면 Event를 보관합니다.
+ *
+ * 캡처 결과는 Chrome Trace(JSON) 형식으로 저장되므로 chrome://tracing이나 Perfetto에서 Flame Graph로 볼 수 있습니다.
+ */
+class FCpuProfiler
+{
+public:
+    /** 통계를 계산할 최근 프레임 수 */
+    static constexpr int32 StatWindowSize = 120;
+
+    /** 한 스레드가 EndFrame 사이에 기록할 수 있는 최대 Event 수, 넘치면 오래된 Event부터 버려짐 */
+    static constexpr uint32 ThreadBufferCapacity = 1 << 15;
+
+    static FCpuProfiler& Get();
+
+    FCpuProfiler() = default;
+    ~FCpuProfiler() = default;
+
+    FCpuProfiler(const FCpuProfiler&) = delete;
+    FCpuProfiler& operator=(const FCpuProfiler&) = delete;
+    FCpuProfiler(FCpuProfiler&&) = delete;
+    FCpuProfiler& operator=(FCpuProfiler&&) = delete;
+
+    /** 캡처 파일에 표시될 현재 스레드의 이름을 정합니다. */
+    void SetCurrentThreadName(const FString& InThreadName);
+
+    /** Scope를 엽니다. 어느 스레드에서든 호출할 수 있습니다. */
+    static void BeginScope();
+
+    /** BeginScope로 연 Scope를 닫고 현재 스레드의 버퍼에 기록합니다. */
+    static void EndScope(const TStatId& StatId, uint64 StartCycles, uint64 EndCycles);
+
+    /** 프레임의 시작을 표시합니다. Game Thread에서만 호출해야 합니다. */
+    void BeginFrame();
+
+    /** 모든 스레드의 버퍼를 비우고 통계와 캡처를 갱신합니다. Game Thread에서만 호출해야 합니다. */
+    void EndFrame();
+
+    /**
+     * 캡처를 시작합니다.
+     * @param InMaxFrames 0보다 크다면 해당 프레임 수만큼 캡처한 뒤 기본 경로에 자동으로 저장합니다.
+     */
+    void StartCapture(int32 InMaxFrames = 0);
+
+    /**
+     * 캡처를 멈추고 파일로 저장합니다. 현재 프레임의 Event까지 포함되도록 저장은 EndFrame에서 이루어집니다.
+     * @param FilePath 저장할 경로, 비어있다면 Saved/Profiling 아래에 시간 이름으로 저장합니다.
+     */
+    void StopCapture(const FString& FilePath = FString());
+
+    bool IsCapturing() const { return bCapturing; }
+
+    /**
+     * 최근 StatWindowSize 프레임 동안의 통계를 구합니다. Game Thread에서만 호출해야 합니다.
+     * @return 해당 Stat이 한 번도 기록되지 않았다면 false
+     */
+    bool GetStatSummary(const FName& StatName, FCpuStatSummary& OutSummary) const;
+
+private:
+    struct FThreadBuffer
+    {
+        FCpuProfileEvent Events[ThreadBufferCapacity];
+
+        /** Producer(소유 스레드)가 기록한 Event의 누적 수 */
+        std::atomic<uint64> WriteCount = 0;
+
+        /** Consumer(Game Thread)가 읽은 Event의 누적 수 */
+        uint64 ReadCount = 0;
+
+        /** 소유 스레드에서만 접근 */
+        uint32 Depth = 0;
+
+        uint32 ThreadIndex = 0;
+        FString ThreadName;
+    };
+
+    struct FStatHistory
+    {
+        double Samples[StatWindowSize] = {};
+        int32 NumSamples = 0;
+        int32 NextIndex = 0;
+
+        /** 이번 프레임에 누적된 시간 */
+        double FrameMs = 0.0;
+        bool bTouchedThisFrame = false;
+    };
+
+    struct FCapturedEvent
+    {
+        FCpuProfileEvent Event;
+        uint32 ThreadIndex = 0;
+    };
+
+    struct FCapturedFrame
+    {
+        uint64 FrameNumber = 0;
+        uint64 StartCycles = 0;
+    };
+
+    /** 현재 스레드의 버퍼를 반환하며, 처음 호출될 때 생성하여 등록합니다. */
+    static FThreadBuffer& GetThreadBuffer();
+
+    /** Buffer에 쌓인 Event를 모두 읽어 통계와 캡처에 반영합니다. */
+    void DrainBuffer(FThreadBuffer& Buffer);
+
+    void AddFrameSample(const FName& StatName, double TimeMs);
+
+    bool WriteChromeTrace(const FString& FilePath) const;
+
+    static FString MakeDefaultCaptureFilePath();
+
+private:
+    static thread_local FThreadBuffer* CurrentThreadBuffer;
+
+    /** Buffers와 ThreadName 접근을 보호 */
+    mutable std::mutex BuffersMutex;
+    TArray<std::unique_ptr<FThreadBuffer>> Buffers;
+
+    TMap<FName, FStatHistory> StatHistories;
+
+    uint64 FrameNumber = 0;
+    uint64 FrameStartCycles = 0;
+    uint64 NumDroppedEvents = 0;
+
+    bool bCapturing = false;
+    bool bStopCaptureRequested = false;
+    int32 MaxCaptureFrames = 0;
+    uint64 CaptureStartCycles = 0;
+    FString CaptureFilePath;
+    TArray<FCapturedEvent> CapturedEvents;
+    TArray<FCapturedFrame> CapturedFrames;
+};
@@ -8,19 +8,19 @@
 class FProfilerStatsManager
 {
 public:
-    // Call at the beginning of each frame to clear previous results
+    // Called by FCpuProfiler::EndFrame to clear previous results before publishing the finished frame
     static void BeginFrame()
     {
         CPUStatsMS.Empty();
     }
 
-    // Called by FScopeCycleCounter to record CPU time
+    // Called by FCpuProfiler::EndFrame on the game thread with each stat's total for the finished frame
     static void AddCpuStat(const TStatId& StatId, const double TimeMs)
     {
         CPUStatsMS.FindOrAdd(StatId.GetName()) = TimeMs;
     }
 
-    // Retrieve CPU time for a given StatId
+    // Retrieve CPU time for a given StatId, game thread only
     static double GetCpuStatMs(const FName& StatName)
     {
         const double* FoundMs = CPUStatsMS.Find(StatName);
@@ -28,6 +28,6 @@ public:
     }
 
 private:
-    // Map from Stat Name to elapsed time in milliseconds for the current frame
+    // Map from Stat Name to elapsed time in milliseconds for the last finished frame
     static TMap<FName, double> CPUStatsMS;
 };
@@ -1,17 +1,21 @@
 #include "Stats.h"
 #include "WindowsPlatformTime.h"
 #include "GpuTimingManager.h"
-#include "ProfilerStatsManager.h"
+#include "CpuProfiler.h"
 
 FScopeCycleCounter::FScopeCycleCounter(TStatId StatId)
-    : StartCycles(FPlatformTime::Cycles64())
-    , UsedStatId(StatId)
+    : UsedStatId(StatId)
 {
+    FCpuProfiler::BeginScope();
+    StartCycles = FPlatformTime::Cycles64();
 }
 
 FScopeCycleCounter::~FScopeCycleCounter()
 {
-    Finish();
+    if (!bFinished)
+    {
+        Finish();
+    }
 }
 
 uint64 FScopeCycleCounter::Finish()
@@ -19,8 +23,14 @@ uint64 FScopeCycleCounter::Finish()
     const uint64 EndCycles = FPlatformTime::Cycles64();
     const uint64 CycleDiff = EndCycles - StartCycles;
 
+    if (!bFinished)
+    {
+        bFinished = true;
+        FCpuProfiler::EndScope(UsedStatId, StartCycles, EndCycles);
+    }
+
     // FThreadStats::AddMessage(UsedStatId, EStatOperation::Add, CycleDiff);
-    FProfilerStatsManager::AddCpuStat(UsedStatId, FPlatformTime::ToMilliseconds(CycleDiff));
+    // 프레임별 값은 FCpuProfiler::EndFrame이 스레드별 버퍼를 모아 FProfilerStatsManager에 채우므로 여기서는 잠금 없이 기록만 함
 
     return CycleDiff;
 }
@@ -6,6 +6,10 @@
 
 class FGPUTimingManager; // Forward declaration
 
+/**
+ * Scope의 CPU 시간을 측정합니다.
+ * 측정값은 FCpuProfiler의 스레드별 버퍼에 잠금 없이 기록되고, 프레임별 값(FProfilerStatsManager)은 EndFrame에서 채워집니다.
+ */
 class FScopeCycleCounter
 {
 public:
@@ -25,6 +29,9 @@ private:
 
     [[maybe_unused]]
     TStatId UsedStatId;
+
+    /** Finish가 이미 호출되었는지 여부, 소멸자에서 중복으로 기록되지 않도록 함 */
+    bool bFinished = false;
 };
 
 #define QUICK_SCOPE_CYCLE_COUNTER(Stat) \
@@ -1,97 +1,149 @@
 ﻿#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
 #include <utility>
 #include "HAL/PlatformType.h"
 
 class UObject;
 
 
+/** 모든 TFunction이 공유하는 저장소 설정 */
+struct FFunctionStorage
+{
+    /** 이 크기 이하이면서 예외 없이 이동할 수 있는 Callable은 힙 할당 없이 TFunction 안에 저장 */
+    static constexpr size_t InlineSize = 32;
+    static constexpr size_t InlineAlignment = alignof(std::max_align_t);
+
+    /** 인라인 저장소에 들어가지 않아 힙에 할당한 누적 횟수 */
+    static inline std::atomic<uint64> NumHeapAllocations = 0;
+};
+
 template <typename Signature>
 struct TFunction;
 
+/**
+ * 복사 가능한 Callable을 담는 함수 객체
+ *
+ * - FFunctionStorage::InlineSize 이하의 Callable(함수 포인터, 멤버 함수 포인터 + 객체, 작은 람다)은 내부 버퍼에 저장
+ * - 호출은 가상 함수 대신 Callable 타입마다 하나씩 있는 함수 포인터 테이블을 통해 한 번만 간접 호출
+ */
 template <typename ReturnType, typename... ParamsType>
 struct TFunction<ReturnType(ParamsType...)>
 {
 private:
-    // 내부 저장소 및 호출을 위한 인터페이스
-    struct ICallable
+    // Callable 타입별 연산 테이블
+    struct FCallableOps
     {
-        ICallable() = default;
-        virtual ~ICallable() = default;
-
-        ICallable(const ICallable&) = default;
-        ICallable& operator=(const ICallable&) = default;
-        ICallable(ICallable&&) = default;
-        ICallable& operator=(ICallable&&) = default;
-
-        virtual ReturnType Invoke(ParamsType...) = 0;
-        [[nodiscard]] virtual ICallable* Clone() const = 0;
+        ReturnType (*Invoke)(void* Storage, ParamsType... Args);
+        void (*CopyConstruct)(void* Dest, const void* Src);
+        void (*MoveConstruct)(void* Dest, void* Src); // Src는 이동 후 소멸까지 끝냄
+        void (*Destroy)(void* Storage);
     };
 
-    // 함수 포인터를 저장하는 Callable
-    template <typename FuncPtrType>
-    struct TFunctionPtrCallable final : ICallable
-    {
-        FuncPtrType Func;
-        explicit TFunctionPtrCallable(FuncPtrType InFunc) : Func(std::move(InFunc)) {}
+    template <typename FunctorType>
+    static constexpr bool bStoreInline =
+        sizeof(FunctorType) <= FFunctionStorage::InlineSize
+        && alignof(FunctorType) <= FFunctionStorage::InlineAlignment
+        && std::is_nothrow_move_constructible_v<FunctorType>;
 
-        virtual ReturnType Invoke(ParamsType... Args) override
+    template <typename FunctorType>
+    struct TCallableOps
+    {
+        static FunctorType* Get(void* Storage)
         {
-            return Func(std::forward<ParamsType>(Args)...);
+            if constexpr (bStoreInline<FunctorType>)
+            {
+                return std::launder(static_cast<FunctorType*>(Storage));
+            }
+            else
+            {
+                return *static_cast<FunctorType**>(Storage);
+            }
         }
 
-        virtual ICallable* Clone() const override
+        template <typename ArgType>
+        static void Construct(void* Storage, ArgType&& Arg)
         {
-            return new TFunctionPtrCallable(Func);
+            if constexpr (bStoreInline<FunctorType>)
+            {
+                new (Storage) FunctorType(std::forward<ArgType>(Arg));
+            }
+            else
+            {
+                *static_cast<FunctorType**>(Storage) = new FunctorType(std::forward<ArgType>(Arg));
+                FFunctionStorage::NumHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+            }
         }
-    };
 
-    // 멤버 함수 포인터를 저장하는 Callable
-    template <typename ClassType, typename MemberFuncPtrType>
-    struct TMemberFunctionPtrCallable final : ICallable
-    {
-        ClassType* Object;
-        MemberFuncPtrType MemberFunc;
+        static ReturnType Invoke(void* Storage, ParamsType... Args)
+        {
+            return std::invoke(*Get(Storage), std::forward<ParamsType>(Args)...);
+        }
 
-        TMemberFunctionPtrCallable(ClassType* InObject, MemberFuncPtrType InMemberFunc)
-            : Object(InObject), MemberFunc(InMemberFunc) {}
+        static void CopyConstruct(void* Dest, const void* Src)
+        {
+            Construct(Dest, *Get(const_cast<void*>(Src)));
+        }
 
-        virtual ReturnType Invoke(ParamsType... Args) override
+        static void MoveConstruct(void* Dest, void* Src)
         {
-            return (Object->*MemberFunc)(std::forward<ParamsType>(Args)...);
+            if constexpr (bStoreInline<FunctorType>)
+            {
+                FunctorType* SrcFunctor = Get(Src);
+                new (Dest) FunctorType(std::move(*SrcFunctor));
+                SrcFunctor->~FunctorType();
+            }
+            else
+            {
+                *static_cast<FunctorType**>(Dest) = *static_cast<FunctorType**>(Src);
+            }
         }
 
-        virtual ICallable* Clone() const override
+        static void Destroy(void* Storage)
         {
-            return new TMemberFunctionPtrCallable(Object, MemberFunc);
+            if constexpr (bStoreInline<FunctorType>)
+            {
+                Get(Storage)->~FunctorType();
+            }
+            else
+            {
+                delete Get(Storage);
+            }
         }
+
+        static constexpr FCallableOps Ops = { &Invoke, &CopyConstruct, &MoveConstruct, &Destroy };
     };
 
-    // 람다 및 기타 Callable한 객체를 저장하는 Callable
-    template <typename FunctorType>
-    struct TFunctorCallable final : ICallable
+    // 멤버 함수 포인터와 객체 포인터, 람다로 감싸지 않고 그대로 인라인 저장
+    template <typename ClassType, typename MemberFuncPtrType>
+    struct TMemberFunctionCallable
     {
-        FunctorType Functor;
-
-        explicit TFunctorCallable(const FunctorType& InFunctor) : Functor(InFunctor) {}
-        explicit TFunctorCallable(FunctorType&& InFunctor) : Functor(std::move(InFunctor)) {}
-
-        virtual ReturnType Invoke(ParamsType... Args) override
-        {
-            return Functor(std::forward<ParamsType>(Args)...);
-        }
+        ClassType* Object;
+        MemberFuncPtrType MemberFunc;
 
-        virtual ICallable* Clone() const override
+        ReturnType operator()(ParamsType... Args) const
         {
-            return new TFunctorCallable(Functor);
+            return (Object->*MemberFunc)(std::forward<ParamsType>(Args)...);
         }
     };
 
-    // TFunction이 가지고 있는 Callable 객체
-    ICallable* Storage = nullptr;
+    template <typename FunctorType, typename ArgType>
+    void Emplace(ArgType&& Arg)
+    {
+        TCallableOps<FunctorType>::Construct(Storage, std::forward<ArgType>(Arg));
+        Ops = &TCallableOps<FunctorType>::Ops;
+    }
+
+    // TFunction이 가지고 있는 Callable 객체, 인라인 객체 또는 힙 객체의 포인터
+    alignas(FFunctionStorage::InlineAlignment) mutable uint8 Storage[FFunctionStorage::InlineSize];
+    const FCallableOps* Ops = nullptr;
 
 public:
     TFunction() = default;
-    TFunction(nullptr_t) : Storage(nullptr) {}
+    TFunction(nullptr_t) {}
 
     ~TFunction()
     {
@@ -101,9 +153,10 @@ public:
     // 복사 생성자
     TFunction(const TFunction& Other)
     {
-        if (Other.Storage)
+        if (Other.Ops)
         {
-            Storage = Other.Storage->Clone();
+            Other.Ops->CopyConstruct(Storage, Other.Storage);
+            Ops = Other.Ops;
         }
     }
 
@@ -112,14 +165,11 @@ public:
     {
         if (this != &Other)
         {
-            delete Storage;
-            if (Other.Storage)
+            Reset();
+            if (Other.Ops)
             {
-                Storage = Other.Storage->Clone();
-            }
-            else
-            {
-                Storage = nullptr;
+                Other.Ops->CopyConstruct(Storage, Other.Storage);
+                Ops = Other.Ops;
             }
         }
         return *this;
@@ -135,8 +185,12 @@ public:
     // 이동 생성자
     TFunction(TFunction&& Other) noexcept
     {
-        Storage = Other.Storage;
-        Other.Storage = nullptr;
+        if (Other.Ops)
+        {
+            Other.Ops->MoveConstruct(Storage, Other.Storage);
+            Ops = Other.Ops;
+            Other.Ops = nullptr;
+        }
     }
 
     // 이동 대입 연산자
@@ -144,9 +198,13 @@ public:
     {
         if (this != &Other)
         {
-            delete Storage;
-            Storage = Other.Storage;
-            Other.Storage = nullptr;
+            Reset();
+            if (Other.Ops)
+            {
+                Other.Ops->MoveConstruct(Storage, Other.Storage);
+                Ops = Other.Ops;
+                Other.Ops = nullptr;
+            }
         }
         return *this;
     }
@@ -162,7 +220,7 @@ public:
         // nullptr 함수 포인터 검사
         if (InFunc)
         {
-            Storage = new TFunctionPtrCallable<FuncPtrType>(InFunc);
+            Emplace<FuncPtrType>(InFunc);
         }
     }
 
@@ -191,7 +249,8 @@ public:
 
         if (InMemberFunc)
         {
-            Storage = new TMemberFunctionPtrCallable<ClassType, MemberFuncPtrType>(InObject, InMemberFunc);
+            using CallableType = TMemberFunctionCallable<ClassType, MemberFuncPtrType>;
+            Emplace<CallableType>(CallableType{ InObject, InMemberFunc });
         }
     }
 
@@ -199,18 +258,18 @@ public:
     template <typename FunctorType>
     requires
         (!std::same_as<std::decay_t<FunctorType>, TFunction>) // 자기 자신은 제외
-        && !( // 일반 함수 포인터는 위에서 처리
+        && (!( // 일반 함수 포인터는 위에서 처리
             std::is_pointer_v<std::decay_t<FunctorType>>
             && std::is_function_v<std::remove_pointer_t<std::decay_t<FunctorType>>>
-        )
+        ))
         && (!std::is_member_function_pointer_v<std::decay_t<FunctorType>>)              // 멤버 함수 포인터 단독은 무시
         && (!std::is_null_pointer_v<std::decay_t<FunctorType>>)                         // nullptr_t는 별도 생성자에서 처리
         && std::is_invocable_r_v<ReturnType, std::decay_t<FunctorType>&, ParamsType...> // 호출 가능성 검사 (반환 타입 포함)
-        && std::is_copy_constructible_v<std::decay_t<FunctorType>>                      // 복사 생성 가능한지 여부, Clone 때문에
+        && std::is_copy_constructible_v<std::decay_t<FunctorType>>                      // 복사 생성 가능한지 여부, TFunction 복사 때문에
     TFunction(FunctorType&& InFunctor)
     {
         using DecayedFunctorType = std::decay_t<FunctorType>;
-        Storage = new TFunctorCallable<DecayedFunctorType>(std::forward<FunctorType>(InFunctor));
+        Emplace<DecayedFunctorType>(std::forward<FunctorType>(InFunctor));
     }
 
     FORCEINLINE explicit operator bool() const noexcept
@@ -232,7 +291,7 @@ public:
     {
         if (IsBound())
         {
-            return Storage->Invoke(std::forward<ParamsType>(Args)...);
+            return Ops->Invoke(Storage, std::forward<ParamsType>(Args)...);
         }
         return ReturnType{};
     }
@@ -241,13 +300,16 @@ public:
     /** TFunction이 유효한 객체을 가리키고 있는지 확인합니다. */
     [[nodiscard]] bool IsBound() const noexcept
     {
-        return Storage != nullptr;
+        return Ops != nullptr;
     }
 
     /** 저장된 Callable 객체를 초기화합니다. */
     void Reset() noexcept
     {
-        delete Storage;
-        Storage = nullptr;
+        if (Ops)
+        {
+            Ops->Destroy(Storage);
+            Ops = nullptr;
+        }
     }
 };
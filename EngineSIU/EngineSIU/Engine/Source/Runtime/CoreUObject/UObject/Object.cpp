@@ -1,6 +1,8 @@
 #include "Object.h"
 
 #include "ObjectFactory.h"
+#include "ObjectArena.h"
+#include "ObjectSnapshotArchive.h"
 #include "Class.h"
 #include "Engine/Engine.h"
 
@@ -14,7 +16,7 @@ UClass* UObject::StaticClass()
         nullptr,
         []() -> UObject*
         {
-            void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(UObject));
+            void* RawMemory = FObjectArena::AllocateObject(sizeof(UObject), alignof(UObject));
             ::new (RawMemory) UObject;
             return static_cast<UObject*>(RawMemory);
         }
@@ -32,7 +34,17 @@ UObject::UObject()
 
 UObject* UObject::Duplicate(UObject* InOuter)
 {
-    return FObjectFactory::ConstructObject(GetClass(), InOuter);
+    UObject* NewObject = FObjectFactory::ConstructObject(GetClass(), InOuter);
+
+    // 참조는 원본이 가리키던 객체를 그대로 가리킴, 소유 관계는 Duplicate를 override한 쪽에서 다시 연결
+    TArray<uint8> Data;
+    FObjectSnapshotWriter Writer(Data);
+    Serialize(Writer);
+
+    FObjectSnapshotReader Reader(Data);
+    NewObject->Serialize(Reader);
+
+    return NewObject;
 }
 
 void UObject::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
@@ -41,8 +53,6 @@ void UObject::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent
 
 void UObject::Serialize(FArchive& Ar)
 {
-    // TODO: Serialize 구현
-    // GetClass()->SerializeBin(Ar, this);
 }
 
 UWorld* UObject::GetWorld() const
@@ -2,6 +2,7 @@
 #include "EngineLoop.h"
 #include "NameTypes.h"
 #include "Misc/CoreMiscDefines.h"
+#include "Serialization/Archive.h"
 
 struct FPropertyChangedEvent;
 extern FEngineLoop GEngineLoop;
@@ -45,6 +46,10 @@ public:
     UObject();
     virtual ~UObject() = default;
 
+    /**
+     * 같은 Class의 객체를 만들고 Serialize로 프로퍼티를 복사합니다.
+     * 복사할 프로퍼티가 있는 Class는 Duplicate 대신 Serialize를 override 합니다.
+     */
     virtual UObject* Duplicate(UObject* InOuter);
 
     /**
@@ -55,6 +60,8 @@ public:
 
     UObject* GetOuter() const { return OuterPrivate; }
     virtual UWorld* GetWorld() const;
+
+    /** Super::Serialize를 먼저 호출하고, 읽을 때와 쓸 때 같은 순서로 프로퍼티를 직렬화 합니다. */
     virtual void Serialize(FArchive& Ar);
 
     FName GetFName() const { return NamePrivate; }
@@ -100,3 +107,17 @@ public:
 
     virtual void SerializeAsset(FArchive& Ar) {}
 };
+
+/** UObject 파생 Class의 포인터를 UObject*와 같은 방식으로 직렬화 */
+template <typename T>
+    requires (std::derived_from<T, UObject> && !std::same_as<T, UObject>)
+FArchive& operator<<(FArchive& Ar, T*& Value)
+{
+    UObject* Object = Value;
+    Ar << Object;
+    if (Ar.IsLoading())
+    {
+        Value = static_cast<T*>(Object);
+    }
+    return Ar;
+}
@@ -0,0 +1,135 @@
+#include "ObjectArena.h"
+#include <cassert>
+
+#include "HAL/PlatformMemory.h"
+
+namespace
+{
+    thread_local FObjectArena* GCurrentObjectArena = nullptr;
+
+    /** 살아 있는 모든 아레나, 해제할 객체가 어느 아레나에 속하는지 찾을 때 사용 */
+    TArray<FObjectArena*>& GetObjectArenas()
+    {
+        static TArray<FObjectArena*> Arenas;
+        return Arenas;
+    }
+}
+
+FObjectArena::FObjectArena(size_t InitialSize)
+{
+    FBlock Block;
+    Block.Size = InitialSize > MinBlockSize ? InitialSize : MinBlockSize;
+    Block.Data = static_cast<uint8*>(FPlatformMemory::AlignedMalloc<EAT_Object>(Block.Size, BlockAlignment));
+    Blocks.Add(Block);
+
+    GetObjectArenas().Add(this);
+}
+
+FObjectArena::~FObjectArena()
+{
+    assert(NumLiveObjects == 0);
+
+    for (const FBlock& Block : Blocks)
+    {
+        FPlatformMemory::AlignedFree<EAT_Object>(Block.Data, Block.Size);
+    }
+    Blocks.Empty();
+
+    GetObjectArenas().Remove(this);
+}
+
+void FObjectArena::ReleaseWhenEmpty()
+{
+    bReleaseWhenEmpty = true;
+    if (NumLiveObjects == 0)
+    {
+        delete this;
+    }
+}
+
+size_t FObjectArena::GetCapacityBytes() const
+{
+    size_t Capacity = 0;
+    for (const FBlock& Block : Blocks)
+    {
+        Capacity += Block.Size;
+    }
+    return Capacity;
+}
+
+void* FObjectArena::Allocate(size_t Size, size_t Alignment)
+{
+    assert(!bReleaseWhenEmpty);
+
+    // 새 블록은 항상 마지막에 붙으므로 마지막 블록에서만 자름
+    FBlock* Block = &Blocks.Last();
+    size_t AlignedOffset = (Offset + Alignment - 1) & ~(Alignment - 1);
+    if (AlignedOffset + Size > Block->Size)
+    {
+        FBlock NewBlock;
+        NewBlock.Size = Size > MinBlockSize ? Size : MinBlockSize;
+        NewBlock.Data = static_cast<uint8*>(FPlatformMemory::AlignedMalloc<EAT_Object>(NewBlock.Size, BlockAlignment));
+        Blocks.Add(NewBlock);
+        Block = &Blocks.Last();
+        AlignedOffset = 0;
+    }
+
+    Offset = AlignedOffset + Size;
+    ++NumLiveObjects;
+    return Block->Data + AlignedOffset;
+}
+
+bool FObjectArena::Contains(const void* Ptr) const
+{
+    const uint8* BytePtr = static_cast<const uint8*>(Ptr);
+    for (const FBlock& Block : Blocks)
+    {
+        if (BytePtr >= Block.Data && BytePtr < Block.Data + Block.Size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FObjectArena::ReleaseObject()
+{
+    assert(NumLiveObjects > 0);
+    if (--NumLiveObjects == 0 && bReleaseWhenEmpty)
+    {
+        delete this;
+    }
+}
+
+void* FObjectArena::AllocateObject(size_t Size, size_t Alignment)
+{
+    if (GCurrentObjectArena)
+    {
+        return GCurrentObjectArena->Allocate(Size, Alignment);
+    }
+    return FPlatformMemory::AlignedMalloc<EAT_Object>(Size, Alignment);
+}
+
+void FObjectArena::FreeObject(void* Object, size_t Size)
+{
+    for (FObjectArena* Arena : GetObjectArenas())
+    {
+        if (Arena->Contains(Object))
+        {
+            Arena->ReleaseObject();
+            return;
+        }
+    }
+    FPlatformMemory::AlignedFree<EAT_Object>(Object, Size);
+}
+
+FScopedObjectArena::FScopedObjectArena(FObjectArena* InArena)
+    : PreviousArena(GCurrentObjectArena)
+{
+    GCurrentObjectArena = InArena;
+}
+
+FScopedObjectArena::~FScopedObjectArena()
+{
+    GCurrentObjectArena = PreviousArena;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+/**
+ * 여러 UObject의 메모리를 큰 블록에서 한꺼번에 잘라 쓰는 할당자
+ *
+ * - FScopedObjectArena가 살아 있는 동안 생성되는 UObject는 모두 이 아레나에서 할당됨
+ * - 개별 객체를 해제해도 메모리는 돌려주지 않고, ReleaseWhenEmpty 이후 마지막 객체가 해제될 때 블록을 한 번에 해제
+ * - PIE World처럼 함께 생성되고 함께 사라지는 객체 묶음에 사용
+ */
+class FObjectArena
+{
+public:
+    /** @param InitialSize 첫 블록의 크기, 생성할 객체들의 크기 합을 알면 그 값을 넘겨서 블록 하나로 끝내는 것이 좋음 */
+    explicit FObjectArena(size_t InitialSize);
+
+    FObjectArena(const FObjectArena&) = delete;
+    FObjectArena& operator=(const FObjectArena&) = delete;
+
+    /** 더 이상 할당하지 않음, 남은 객체가 없으면 바로, 있으면 마지막 객체가 해제될 때 아레나를 삭제 */
+    void ReleaseWhenEmpty();
+
+    int32 GetNumLiveObjects() const { return NumLiveObjects; }
+
+    /** Ptr이 이 아레나의 블록 안에 있는지 */
+    bool Contains(const void* Ptr) const;
+    int32 GetNumBlocks() const { return Blocks.Num(); }
+    size_t GetCapacityBytes() const;
+
+    /** 현재 스코프의 아레나가 있으면 거기서, 없으면 힙에서 UObject 메모리를 할당 */
+    static void* AllocateObject(size_t Size, size_t Alignment);
+
+    /** AllocateObject로 받은 메모리를 해제, 소멸자는 호출한 쪽에서 먼저 불러야 함 */
+    static void FreeObject(void* Object, size_t Size);
+
+private:
+    ~FObjectArena();
+
+    void* Allocate(size_t Size, size_t Alignment);
+    void ReleaseObject();
+
+    struct FBlock
+    {
+        uint8* Data;
+        size_t Size;
+    };
+
+    static constexpr size_t MinBlockSize = 64 * 1024;
+    static constexpr size_t BlockAlignment = 64;
+
+    TArray<FBlock> Blocks;
+    size_t Offset = 0;
+    int32 NumLiveObjects = 0;
+    bool bReleaseWhenEmpty = false;
+};
+
+/** 이 객체가 살아 있는 동안 이 스레드에서 생성하는 UObject를 Arena에서 할당 */
+struct FScopedObjectArena
+{
+    explicit FScopedObjectArena(FObjectArena* InArena);
+    ~FScopedObjectArena();
+
+    FScopedObjectArena(const FScopedObjectArena&) = delete;
+    FScopedObjectArena& operator=(const FScopedObjectArena&) = delete;
+
+private:
+    FObjectArena* PreviousArena;
+};
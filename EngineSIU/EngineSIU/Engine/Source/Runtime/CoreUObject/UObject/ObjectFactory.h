@@ -26,7 +26,10 @@ public:
 
         GUObjectArray.AddObject(Obj);
 
-        UE_LOGFMT(ELogLevel::Display, "Created Object: {}, Size: {}", Obj->GetName(), InClass->GetStructSize());
+        if (!FScopedObjectLogSuppression::IsSuppressed())
+        {
+            UE_LOGFMT(ELogLevel::Display, "Created Object: {}, Size: {}", Obj->GetName(), InClass->GetStructSize());
+        }
 
         return Obj;
     }
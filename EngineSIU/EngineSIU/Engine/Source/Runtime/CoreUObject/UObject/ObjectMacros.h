@@ -6,6 +6,7 @@
 #include "Class.h"
 #include "ScriptStruct.h"
 #include "UObjectHash.h"
+#include "ObjectArena.h"
 
 // MSVC에서 매크로 확장 문제를 해결하기 위한 매크로
 #define EXPAND_MACRO(x) x
@@ -44,7 +45,7 @@ public: \
             static_cast<uint32>(alignof(TClass)), \
             TSuperClass::StaticClass(), \
             []() -> UObject* { \
-                void* RawMemory = FPlatformMemory::AlignedMalloc<EAT_Object>(sizeof(TClass), alignof(TClass)); \
+                void* RawMemory = FObjectArena::AllocateObject(sizeof(TClass), alignof(TClass)); \
                 ::new (RawMemory) TClass; \
                 return static_cast<UObject*>(RawMemory); \
             } \
@@ -0,0 +1,103 @@
+#pragma once
+#include "Container/Map.h"
+#include "Serialization/MemoryArchive.h"
+
+/**
+ * 같은 프로세스 안에서 UObject를 복제하기 위한 메모리 Archive
+ *
+ * - FName은 문자열로 바꾸지 않고 Index를 그대로 복사
+ * - UObject 참조는 객체 테이블에 있으면 테이블 Index로, 없으면(에셋, 다른 World의 객체 등) 포인터 그대로 기록
+ * - 읽을 때 Index는 새로 만든 객체 테이블에서 찾으므로, 복제된 객체끼리의 참조는 복제본을 가리키게 됨
+ * - 포인터를 그대로 기록하므로 파일로 저장하면 안 됨
+ */
+namespace ObjectSnapshot
+{
+    constexpr int32 NullReference = -1;
+    constexpr int32 ExternalReference = -2;
+}
+
+class FObjectSnapshotWriter : public FMemoryWriter
+{
+public:
+    /** @param InObjectIndices 객체 -> 테이블 Index, nullptr이면 모든 참조를 포인터 그대로 기록 */
+    explicit FObjectSnapshotWriter(TArray<uint8>& InData, const TMap<const UObject*, int32>* InObjectIndices = nullptr)
+        : FMemoryWriter(InData)
+        , ObjectIndices(InObjectIndices)
+    {
+    }
+
+    virtual FArchive& operator<<(FName& Value) override
+    {
+        Serialize(&Value, sizeof(FName));
+        return *this;
+    }
+
+    virtual FArchive& operator<<(UObject*& Value) override
+    {
+        if (!Value)
+        {
+            int32 Tag = ObjectSnapshot::NullReference;
+            Serialize(Tag);
+            return *this;
+        }
+
+        if (ObjectIndices)
+        {
+            if (const int32* Index = ObjectIndices->Find(Value))
+            {
+                int32 TableIndex = *Index;
+                Serialize(TableIndex);
+                return *this;
+            }
+        }
+
+        int32 Tag = ObjectSnapshot::ExternalReference;
+        Serialize(Tag);
+        Serialize(Value);
+        return *this;
+    }
+
+private:
+    const TMap<const UObject*, int32>* ObjectIndices;
+};
+
+class FObjectSnapshotReader : public FMemoryReader
+{
+public:
+    /** @param InObjects FObjectSnapshotWriter에 넘긴 테이블과 같은 순서의 새 객체들 */
+    explicit FObjectSnapshotReader(const TArray<uint8>& InData, const TArray<UObject*>* InObjects = nullptr)
+        : FMemoryReader(InData)
+        , Objects(InObjects)
+    {
+    }
+
+    virtual FArchive& operator<<(FName& Value) override
+    {
+        Serialize(&Value, sizeof(FName));
+        return *this;
+    }
+
+    virtual FArchive& operator<<(UObject*& Value) override
+    {
+        int32 Tag;
+        Serialize(Tag);
+
+        if (Tag == ObjectSnapshot::NullReference)
+        {
+            Value = nullptr;
+        }
+        else if (Tag == ObjectSnapshot::ExternalReference)
+        {
+            Serialize(Value);
+        }
+        else
+        {
+            assert(Objects && Tag < Objects->Num());
+            Value = (*Objects)[Tag];
+        }
+        return *this;
+    }
+
+private:
+    const TArray<UObject*>* Objects;
+};
@@ -2,6 +2,7 @@
 
 #include "Class.h"
 #include "Object.h"
+#include "ObjectArena.h"
 #include "UObjectHash.h"
 
 
@@ -24,16 +25,47 @@ void FUObjectArray::ProcessPendingDestroyObjects()
 {
     for (UObject* Object : PendingDestroyObjects)
     {
-        const UClass* Class = Object->GetClass();
-        std::string ObjectName = Object->GetName().ToAnsiString();
-        const uint32 ObjectSize = Class->GetStructSize();
+        DestroyObject(Object);
+    }
+    PendingDestroyObjects.Empty();
+}
 
-        std::destroy_at(Object);
-        FPlatformMemory::AlignedFree<EAT_Object>(Object, ObjectSize);
+void FUObjectArray::ProcessPendingDestroyObjects(const UWorld* World, const FObjectArena* Arena)
+{
+    // 하나를 해제하면 다른 객체의 Outer를 따라갈 수 없으므로 먼저 모두 나눈 뒤에 해제
+    TArray<UObject*> ObjectsToDestroy;
+    TArray<UObject*> RemainingObjects;
+    for (UObject* Object : PendingDestroyObjects)
+    {
+        const bool bInScope = (Arena && Arena->Contains(Object)) || (World && Object->GetWorld() == World);
+        (bInScope ? ObjectsToDestroy : RemainingObjects).Add(Object);
+    }
+    PendingDestroyObjects = std::move(RemainingObjects);
 
-        UE_LOGFMT(ELogLevel::Display, "Deleted Object: {}, Size: {}", ObjectName, ObjectSize);
+    for (UObject* Object : ObjectsToDestroy)
+    {
+        DestroyObject(Object);
     }
-    PendingDestroyObjects.Empty();
+}
+
+void FUObjectArray::DestroyObject(UObject* Object)
+{
+    const UClass* Class = Object->GetClass();
+    const uint32 ObjectSize = Class->GetStructSize();
+
+    if (FScopedObjectLogSuppression::IsSuppressed())
+    {
+        std::destroy_at(Object);
+        FObjectArena::FreeObject(Object, ObjectSize);
+        return;
+    }
+
+    std::string ObjectName = Object->GetName().ToAnsiString();
+
+    std::destroy_at(Object);
+    FObjectArena::FreeObject(Object, ObjectSize);
+
+    UE_LOGFMT(ELogLevel::Display, "Deleted Object: {}, Size: {}", ObjectName, ObjectSize);
 }
 
 FUObjectArray GUObjectArray;
@@ -2,8 +2,10 @@
 #include "Container/Array.h"
 #include "Container/Set.h"
 
+class FObjectArena;
 class UClass;
 class UObject;
+class UWorld;
 
 
 class FUObjectArray
@@ -14,6 +16,12 @@ public:
 
     void ProcessPendingDestroyObjects();
 
+    /**
+     * World에 속하거나(GetWorld() == World) Arena에서 할당된 객체만 해제, 나머지는 다음 전체 처리까지 남김
+     * PIE World처럼 World 하나를 닫을 때 다른 World가 이번 프레임에 지운 객체까지 같이 해제하지 않도록 사용
+     */
+    void ProcessPendingDestroyObjects(const UWorld* World, const FObjectArena* Arena = nullptr);
+
     TSet<UObject*>& GetObjectItemArrayUnsafe()
     {
         return ObjObjects;
@@ -25,8 +33,25 @@ public:
     }
 
 private:
+    static void DestroyObject(UObject* Object);
+
     TSet<UObject*> ObjObjects;
     TArray<UObject*> PendingDestroyObjects;
 };
 
 extern FUObjectArray GUObjectArray;
+
+/** 이 객체가 살아 있는 동안 이 스레드의 UObject 생성, 삭제 로그를 남기지 않음, 객체를 대량으로 만들거나 지울 때 사용 */
+struct FScopedObjectLogSuppression
+{
+    FScopedObjectLogSuppression() { ++SuppressionCount; }
+    ~FScopedObjectLogSuppression() { --SuppressionCount; }
+
+    FScopedObjectLogSuppression(const FScopedObjectLogSuppression&) = delete;
+    FScopedObjectLogSuppression& operator=(const FScopedObjectLogSuppression&) = delete;
+
+    static bool IsSuppressed() { return SuppressionCount > 0; }
+
+private:
+    static inline thread_local int32 SuppressionCount = 0;
+};
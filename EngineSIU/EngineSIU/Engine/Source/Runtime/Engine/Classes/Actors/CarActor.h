@@ -10,6 +10,4 @@ class ACarActor : public AActor
 
 public:
     ACarActor(); 
-
-    virtual UObject* Duplicate(UObject* InOuter) override;
 };
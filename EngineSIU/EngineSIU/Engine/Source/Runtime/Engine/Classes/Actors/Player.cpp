@@ -617,13 +617,6 @@ FVector AEditorPlayer::ControlBoneScale(FTransform& BoneTransform, UGizmoBaseCom
     return BoneScale;
 }
 
-UObject* APlayer::Duplicate(UObject* InOuter)
-{
-    ThisClass* NewActor = Cast<ThisClass>(Super::Duplicate(InOuter));
-
-    return NewActor;
-}
-
 void APlayer::Tick(float DeltaTime)
 {
     AActor::Tick(DeltaTime);
@@ -655,12 +648,14 @@ void ASequencerPlayer::Tick(float DeltaTime)
     }
 }
 
-UObject* ASequencerPlayer::Duplicate(UObject* InOuter)
+void ASequencerPlayer::Serialize(FArchive& Ar)
 {
-    ThisClass* NewActor = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewActor->Socket = Socket;
-    NewActor->SkeletalMeshComponent = nullptr;
+    Ar << Socket;
 
-    return NewActor;
+    if (Ar.IsLoading())
+    {
+        SkeletalMeshComponent = nullptr;
+    }
 }
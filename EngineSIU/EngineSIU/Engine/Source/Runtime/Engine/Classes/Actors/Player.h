@@ -63,7 +63,6 @@ class APlayer : public AActor
 public:
     APlayer() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
     virtual void Tick(float DeltaTime) override;
 };
 
@@ -78,7 +77,7 @@ public:
 
     virtual void PostSpawnInitialize() override;
     virtual void Tick(float DeltaTime) override;
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     FName Socket = "jx_c_camera";
     USkeletalMeshComponent* SkeletalMeshComponent = nullptr;
@@ -83,6 +83,25 @@ FTransform UAnimDataModel::EvaluateBoneTrackTransform(FName TrackName, const FFr
 {
     const float Alpha = Interpolation == EAnimInterpolationType::Step ? FMath::RoundToFloat(FrameTime.GetSubFrame()) : FrameTime.GetSubFrame();
 
+    // Track이 없으면 압축 여부와 관계없이 항등 Transform, 호출하는 쪽에서 Reference Pose에 곱하므로 Reference Pose가 됨
+    const int32 TrackIndex = GetBoneTrackIndexByName(TrackName);
+    if (TrackIndex == INDEX_NONE)
+    {
+        return FTransform::Identity;
+    }
+
+    // 압축 데이터는 범위 밖의 프레임을 끝 키로 고정하므로, 원본에 키가 없는 프레임은 아래의 원본 경로로 처리
+    const FRawAnimSequenceTrack& RawTrack = BoneAnimationTracks[TrackIndex].InternalTrackData;
+    const auto HasRawKey = [&RawTrack](int32 Frame)
+    {
+        return RawTrack.PosKeys.IsValidIndex(Frame) && RawTrack.RotKeys.IsValidIndex(Frame) && RawTrack.ScaleKeys.IsValidIndex(Frame);
+    };
+
+    if (CompressedData.Tracks.IsValidIndex(TrackIndex) && HasRawKey(FrameTime.FloorToFrame()) && HasRawKey(FrameTime.CeilToFrame()))
+    {
+        return FAnimationCompression::DecompressBoneTransform(CompressedData.Tracks[TrackIndex], FrameTime.FloorToFrame(), Alpha);
+    }
+
     if (FMath::IsNearlyEqual(Alpha, 1.0f))
     {
         return GetBoneTrackTransform(TrackName, FrameTime.CeilToFrame());
@@ -220,6 +239,11 @@ UAnimDataController* UAnimDataModel::GetController()
     return Controller;
 }
 
+bool UAnimDataModel::CompressAnimation(const FAnimCompressionSettings& Settings, FAnimCompressionStats* OutStats)
+{
+    return FAnimationCompression::CompressTracks(BoneAnimationTracks, NumberOfKeys, Settings, CompressedData, OutStats);
+}
+
 USkeleton* UAnimDataModel::GetSkeleton() const
 {
     if (const UAnimationAsset* AnimationAsset = Cast<const UAnimationAsset>(GetOuter()))
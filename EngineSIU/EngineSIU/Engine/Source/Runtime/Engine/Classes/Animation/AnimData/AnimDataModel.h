@@ -2,6 +2,7 @@
 #pragma once
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
+#include "Animation/AnimationCompression.h"
 
 struct FFrameTime;
 enum class EAnimInterpolationType : uint8;
@@ -50,6 +51,15 @@ public:
     
     USkeleton* GetSkeleton() const;
 
+    /**
+     * 원본 Track으로부터 압축 데이터를 만듭니다. 이후 EvaluateBoneTrackTransform은 압축 데이터를 사용합니다.
+     * 원본 Track은 편집을 위해 그대로 유지되며, Track이 수정되면 압축 데이터는 버려집니다.
+     */
+    bool CompressAnimation(const FAnimCompressionSettings& Settings = FAnimCompressionSettings(), FAnimCompressionStats* OutStats = nullptr);
+
+    const FCompressedAnimData& GetCompressedData() const { return CompressedData; }
+    bool HasCompressedData() const { return CompressedData.IsValid(); }
+
 private:
     // All individual bone animation tracks
     TArray<FBoneAnimationTrack> BoneAnimationTracks;
@@ -63,6 +73,9 @@ private:
     // Total number of sampled animated keys
     int32 NumberOfKeys;
 
+    // BoneAnimationTracks와 같은 순서로 압축된 Track
+    FCompressedAnimData CompressedData;
+
     FBoneAnimationTrack* FindMutableBoneTrackByName(FName Name);
     
     friend class UAnimDataController;
@@ -0,0 +1,746 @@
+#include "AnimGraph.h"
+#include <fstream>
+
+#include "AnimationRuntime.h"
+#include "AnimSequence.h"
+#include "AnimationAsset.h"
+#include "Skeleton.h"
+#include "AnimData/AnimDataModel.h"
+#include "Engine/AssetManager.h"
+#include "JSON/json.hpp"
+#include "Math/MathUtility.h"
+#include "UObject/Casts.h"
+#include "UserInterface/Console.h"
+
+using json = nlohmann::json;
+
+namespace
+{
+    /** Bool 값도 허용 */
+    float JsonToFloat(const json& Value)
+    {
+        if (Value.is_boolean())
+        {
+            return Value.get<bool>() ? 1.0f : 0.0f;
+        }
+        return Value.get<float>();
+    }
+
+    bool ParseConditionOp(const std::string& Op, EAnimGraphConditionOp& OutOp)
+    {
+        if (Op == "<")       { OutOp = EAnimGraphConditionOp::Less; }
+        else if (Op == "<=") { OutOp = EAnimGraphConditionOp::LessEqual; }
+        else if (Op == ">")  { OutOp = EAnimGraphConditionOp::Greater; }
+        else if (Op == ">=") { OutOp = EAnimGraphConditionOp::GreaterEqual; }
+        else if (Op == "==") { OutOp = EAnimGraphConditionOp::Equal; }
+        else if (Op == "!=") { OutOp = EAnimGraphConditionOp::NotEqual; }
+        else { return false; }
+        return true;
+    }
+
+    /** UAnimSequence::GetBonePose는 마지막 프레임을 첫 프레임과 같은 것으로 보고 (NumFrames - 1) 주기로 반복함 */
+    float GetSequenceLength(const UAnimSequence* Sequence)
+    {
+        const UAnimDataModel* DataModel = Sequence ? Sequence->GetDataModel() : nullptr;
+        if (!DataModel || DataModel->GetNumberOfFrames() < 2 || DataModel->GetFrameRate() <= 0)
+        {
+            return 0.0f;
+        }
+        return static_cast<float>(DataModel->GetNumberOfFrames() - 1) / static_cast<float>(DataModel->GetFrameRate());
+    }
+
+    void FillWithRefPose(FCompactPose& Pose, const TArray<FTransform>& RefPose)
+    {
+        for (int32 BoneIndex = 0; BoneIndex < Pose.GetNumBones(); ++BoneIndex)
+        {
+            Pose[BoneIndex] = RefPose[BoneIndex];
+        }
+    }
+}
+
+bool FAnimGraphDefinition::LoadFromJson(const FString& JsonString, const FSequenceResolver& Resolver, FString& OutError)
+{
+    FSequenceResolver ResolveSequence = Resolver;
+    if (!ResolveSequence)
+    {
+        ResolveSequence = [](const FString& Path)
+        {
+            return Cast<UAnimSequence>(UAssetManager::Get().GetAnimation(FName(Path)));
+        };
+    }
+
+    FAnimGraphDefinition Loaded;
+
+    auto Fail = [&OutError](const std::string& Message)
+    {
+        OutError = FString(Message);
+        return false;
+    };
+
+    try
+    {
+        const json Json = json::parse(JsonString.ToAnsiString());
+
+        if (Json.contains("Parameters"))
+        {
+            for (const json& ParameterJson : Json.at("Parameters"))
+            {
+                FAnimGraphParameter& Parameter = Loaded.Parameters[Loaded.Parameters.Emplace()];
+                Parameter.Name = FName(ParameterJson.at("Name").get<std::string>().c_str());
+
+                const std::string Type = ParameterJson.value("Type", std::string("Float"));
+                if (Type == "Bool")
+                {
+                    Parameter.Type = EAnimGraphParameterType::Bool;
+                }
+                else if (Type != "Float")
+                {
+                    return Fail("Unknown parameter type: " + Type);
+                }
+
+                if (ParameterJson.contains("Default"))
+                {
+                    Parameter.DefaultValue = JsonToFloat(ParameterJson.at("Default"));
+                }
+            }
+        }
+
+        for (const json& StateJson : Json.at("States"))
+        {
+            FAnimGraphState& State = Loaded.States[Loaded.States.Emplace()];
+            const std::string StateName = StateJson.at("Name").get<std::string>();
+            State.Name = FName(StateName.c_str());
+            State.PlayRate = StateJson.value("PlayRate", 1.0f);
+            State.bLooping = StateJson.value("Loop", true);
+
+            auto ResolveSample = [&](const std::string& Path, FAnimBlendSample& OutSample)
+            {
+                OutSample.Sequence = ResolveSequence(FString(Path));
+                return OutSample.Sequence != nullptr;
+            };
+
+            if (StateJson.contains("Animation"))
+            {
+                const std::string Path = StateJson.at("Animation").get<std::string>();
+                if (!ResolveSample(Path, State.Samples[State.Samples.Emplace()]))
+                {
+                    return Fail("Animation not found: " + Path);
+                }
+                continue;
+            }
+
+            if (StateJson.contains("BlendParameters"))
+            {
+                for (const json& AxisJson : StateJson.at("BlendParameters"))
+                {
+                    if (State.NumBlendAxes >= 2)
+                    {
+                        return Fail("Blend space supports up to 2 axes: " + StateName);
+                    }
+
+                    const std::string AxisName = AxisJson.get<std::string>();
+                    const int32 ParameterIndex = Loaded.FindParameterIndex(FName(AxisName.c_str()));
+                    if (ParameterIndex == INDEX_NONE)
+                    {
+                        return Fail("Unknown blend parameter: " + AxisName);
+                    }
+                    State.BlendParameters[State.NumBlendAxes++] = ParameterIndex;
+                }
+            }
+
+            for (const json& SampleJson : StateJson.at("Samples"))
+            {
+                FAnimBlendSample& Sample = State.Samples[State.Samples.Emplace()];
+                const std::string Path = SampleJson.at("Animation").get<std::string>();
+                if (!ResolveSample(Path, Sample))
+                {
+                    return Fail("Animation not found: " + Path);
+                }
+
+                if (SampleJson.contains("Position"))
+                {
+                    const json& PositionJson = SampleJson.at("Position");
+                    if (PositionJson.is_number())
+                    {
+                        Sample.Position[0] = PositionJson.get<float>();
+                    }
+                    else
+                    {
+                        for (int32 Axis = 0; Axis < FMath::Min(static_cast<int32>(PositionJson.size()), 2); ++Axis)
+                        {
+                            Sample.Position[Axis] = PositionJson.at(Axis).get<float>();
+                        }
+                    }
+                }
+            }
+
+            if (State.Samples.Num() == 0)
+            {
+                return Fail("State has no animation: " + StateName);
+            }
+            if (State.Samples.Num() > 1 && State.NumBlendAxes == 0)
+            {
+                return Fail("Blend space has no blend parameter: " + StateName);
+            }
+
+            // 1D는 이웃한 두 샘플 사이를 보간하므로 위치 순으로 정렬해둠
+            if (State.NumBlendAxes == 1)
+            {
+                State.Samples.Sort([](const FAnimBlendSample& A, const FAnimBlendSample& B)
+                {
+                    return A.Position[0] < B.Position[0];
+                });
+            }
+        }
+
+        if (Loaded.States.Num() == 0)
+        {
+            return Fail("Graph has no state");
+        }
+
+        if (Json.contains("EntryState"))
+        {
+            const std::string EntryName = Json.at("EntryState").get<std::string>();
+            Loaded.EntryState = Loaded.FindStateIndex(FName(EntryName.c_str()));
+            if (Loaded.EntryState == INDEX_NONE)
+            {
+                return Fail("Unknown entry state: " + EntryName);
+            }
+        }
+
+        if (Json.contains("Transitions"))
+        {
+            for (const json& TransitionJson : Json.at("Transitions"))
+            {
+                FAnimGraphTransition& Transition = Loaded.Transitions[Loaded.Transitions.Emplace()];
+
+                const std::string FromName = TransitionJson.value("From", std::string("*"));
+                if (FromName != "*")
+                {
+                    Transition.FromState = Loaded.FindStateIndex(FName(FromName.c_str()));
+                    if (Transition.FromState == INDEX_NONE)
+                    {
+                        return Fail("Unknown transition source: " + FromName);
+                    }
+                }
+
+                const std::string ToName = TransitionJson.at("To").get<std::string>();
+                Transition.ToState = Loaded.FindStateIndex(FName(ToName.c_str()));
+                if (Transition.ToState == INDEX_NONE)
+                {
+                    return Fail("Unknown transition target: " + ToName);
+                }
+
+                Transition.BlendDuration = FMath::Max(TransitionJson.value("Duration", 0.2f), 0.0f);
+
+                if (TransitionJson.contains("Conditions"))
+                {
+                    for (const json& ConditionJson : TransitionJson.at("Conditions"))
+                    {
+                        FAnimGraphCondition& Condition = Transition.Conditions[Transition.Conditions.Emplace()];
+
+                        const std::string ParameterName = ConditionJson.at("Parameter").get<std::string>();
+                        Condition.ParameterIndex = Loaded.FindParameterIndex(FName(ParameterName.c_str()));
+                        if (Condition.ParameterIndex == INDEX_NONE)
+                        {
+                            return Fail("Unknown condition parameter: " + ParameterName);
+                        }
+
+                        const std::string Op = ConditionJson.value("Op", std::string("=="));
+                        if (!ParseConditionOp(Op, Condition.Op))
+                        {
+                            return Fail("Unknown condition operator: " + Op);
+                        }
+
+                        Condition.Value = ConditionJson.contains("Value") ? JsonToFloat(ConditionJson.at("Value")) : 1.0f;
+                    }
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        return Fail(e.what());
+    }
+
+    *this = std::move(Loaded);
+    return true;
+}
+
+bool FAnimGraphDefinition::LoadFromFile(const FString& FilePath, const FSequenceResolver& Resolver)
+{
+    std::ifstream JsonFile(FilePath.ToAnsiString());
+    if (!JsonFile.is_open())
+    {
+        UE_LOG(ELogLevel::Error, "Failed to open anim graph: %s", *FilePath);
+        return false;
+    }
+
+    const std::string Contents((std::istreambuf_iterator<char>(JsonFile)), std::istreambuf_iterator<char>());
+
+    FString Error;
+    if (!LoadFromJson(FString(Contents), Resolver, Error))
+    {
+        UE_LOG(ELogLevel::Error, "Failed to load anim graph %s: %s", *FilePath, *Error);
+        return false;
+    }
+    return true;
+}
+
+int32 FAnimGraphDefinition::FindParameterIndex(const FName& Name) const
+{
+    return Parameters.IndexOfByPredicate([&Name](const FAnimGraphParameter& Parameter) { return Parameter.Name == Name; });
+}
+
+int32 FAnimGraphDefinition::FindStateIndex(const FName& Name) const
+{
+    return States.IndexOfByPredicate([&Name](const FAnimGraphState& State) { return State.Name == Name; });
+}
+
+int32 FAnimGraphDefinition::GetMaxNumSamples() const
+{
+    int32 MaxNumSamples = 0;
+    for (const FAnimGraphState& State : States)
+    {
+        MaxNumSamples = FMath::Max(MaxNumSamples, State.Samples.Num());
+    }
+    return MaxNumSamples;
+}
+
+void FAnimPosePool::Initialize(int32 InNumBones, int32 InitialSize)
+{
+    NumBones = InNumBones;
+    Contexts.Empty();
+    FreeContexts.Empty();
+
+    for (int32 Index = 0; Index < InitialSize; ++Index)
+    {
+        FPoseContext* Context = Contexts[Contexts.Emplace(std::make_unique<FPoseContext>(nullptr))].get();
+        Context->Pose.InitBones(NumBones);
+        FreeContexts.Add(Context);
+    }
+}
+
+FPoseContext* FAnimPosePool::Acquire()
+{
+    if (FreeContexts.Num() == 0)
+    {
+        FPoseContext* Context = Contexts[Contexts.Emplace(std::make_unique<FPoseContext>(nullptr))].get();
+        Context->Pose.InitBones(NumBones);
+        return Context;
+    }
+    return FreeContexts.Pop();
+}
+
+void FAnimPosePool::Release(FPoseContext* Context)
+{
+    Context->RequiredBones = nullptr;
+    FreeContexts.Add(Context);
+}
+
+void FAnimGraphInstance::Initialize(std::shared_ptr<const FAnimGraphDefinition> InDefinition, int32 NumBones)
+{
+    Definition = std::move(InDefinition);
+    ParameterValues.Empty();
+    Current = FStatePlayback();
+    Previous = FStatePlayback();
+    BlendElapsed = 0.0f;
+    BlendDuration = 0.0f;
+    bBlendFromSnapshot = false;
+    bSnapshotPending = false;
+
+    if (!Definition)
+    {
+        return;
+    }
+
+    for (const FAnimGraphParameter& Parameter : Definition->Parameters)
+    {
+        ParameterValues.Add(Parameter.DefaultValue);
+    }
+
+    if (Definition->States.IsValidIndex(Definition->EntryState))
+    {
+        Current.StateIndex = Definition->EntryState;
+    }
+
+    // 평가 중에는 할당하지 않도록 최대 사용량만큼 미리 할당
+    // 전이 중 두 상태 + Blend Space 샘플 하나
+    PosePool.Initialize(NumBones, 3);
+    SnapshotPose.InitBones(NumBones);
+    WeightScratch.SetNum(Definition->GetMaxNumSamples());
+}
+
+void FAnimGraphInstance::SetFloat(int32 ParameterIndex, float Value)
+{
+    if (ParameterValues.IsValidIndex(ParameterIndex))
+    {
+        ParameterValues[ParameterIndex] = Value;
+    }
+}
+
+void FAnimGraphInstance::SetFloat(const FName& Name, float Value)
+{
+    if (Definition)
+    {
+        SetFloat(Definition->FindParameterIndex(Name), Value);
+    }
+}
+
+void FAnimGraphInstance::SetBool(const FName& Name, bool bValue)
+{
+    SetFloat(Name, bValue ? 1.0f : 0.0f);
+}
+
+float FAnimGraphInstance::GetFloat(int32 ParameterIndex) const
+{
+    return ParameterValues.IsValidIndex(ParameterIndex) ? ParameterValues[ParameterIndex] : 0.0f;
+}
+
+float FAnimGraphInstance::GetFloat(const FName& Name) const
+{
+    return Definition ? GetFloat(Definition->FindParameterIndex(Name)) : 0.0f;
+}
+
+bool FAnimGraphInstance::GetBool(const FName& Name) const
+{
+    return GetFloat(Name) != 0.0f;
+}
+
+void FAnimGraphInstance::Update(float DeltaSeconds)
+{
+    if (!IsValid() || Current.StateIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    AdvanceState(Current, DeltaSeconds);
+
+    if (IsBlending())
+    {
+        if (!bBlendFromSnapshot)
+        {
+            AdvanceState(Previous, DeltaSeconds);
+        }
+        BlendElapsed += DeltaSeconds;
+    }
+
+    // 한 번의 Update에서는 하나의 전이만 수행, 먼저 정의된 전이가 우선
+    for (const FAnimGraphTransition& Transition : Definition->Transitions)
+    {
+        if (Transition.ToState == Current.StateIndex)
+        {
+            continue;
+        }
+        if (Transition.FromState != INDEX_NONE && Transition.FromState != Current.StateIndex)
+        {
+            continue;
+        }
+        if (CheckConditions(Transition))
+        {
+            StartTransition(Transition);
+            break;
+        }
+    }
+}
+
+void FAnimGraphInstance::AdvanceState(FStatePlayback& Playback, float DeltaSeconds)
+{
+    const FAnimGraphState& State = Definition->States[Playback.StateIndex];
+
+    ComputeSampleWeights(State, WeightScratch);
+    const float Length = GetStateLength(State, WeightScratch);
+    if (Length <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    Playback.NormalizedTime += DeltaSeconds * State.PlayRate / Length;
+    if (State.bLooping)
+    {
+        Playback.NormalizedTime = FMath::Frac(Playback.NormalizedTime);
+    }
+    else
+    {
+        Playback.NormalizedTime = FMath::Clamp(Playback.NormalizedTime, 0.0f, 1.0f);
+    }
+}
+
+bool FAnimGraphInstance::CheckConditions(const FAnimGraphTransition& Transition) const
+{
+    for (const FAnimGraphCondition& Condition : Transition.Conditions)
+    {
+        const float Value = GetFloat(Condition.ParameterIndex);
+
+        bool bPassed = false;
+        switch (Condition.Op)
+        {
+        case EAnimGraphConditionOp::Less:         bPassed = Value < Condition.Value; break;
+        case EAnimGraphConditionOp::LessEqual:    bPassed = Value <= Condition.Value; break;
+        case EAnimGraphConditionOp::Greater:      bPassed = Value > Condition.Value; break;
+        case EAnimGraphConditionOp::GreaterEqual: bPassed = Value >= Condition.Value; break;
+        case EAnimGraphConditionOp::Equal:        bPassed = Value == Condition.Value; break;
+        case EAnimGraphConditionOp::NotEqual:     bPassed = Value != Condition.Value; break;
+        }
+
+        if (!bPassed)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAnimGraphInstance::StartTransition(const FAnimGraphTransition& Transition)
+{
+    if (IsBlending())
+    {
+        // 진행 중인 블렌딩 결과를 고정하고 거기서부터 블렌딩
+        bBlendFromSnapshot = true;
+        bSnapshotPending = true;
+        Previous = FStatePlayback();
+    }
+    else
+    {
+        bBlendFromSnapshot = false;
+        Previous = Current;
+    }
+
+    Current.StateIndex = Transition.ToState;
+    Current.NormalizedTime = 0.0f;
+    BlendDuration = Transition.BlendDuration;
+    BlendElapsed = 0.0f;
+}
+
+void FAnimGraphInstance::ComputeSampleWeights(const FAnimGraphState& State, TArray<float>& OutWeights) const
+{
+    const int32 NumSamples = State.Samples.Num();
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        OutWeights[Index] = 0.0f;
+    }
+
+    if (NumSamples == 1 || State.NumBlendAxes == 0)
+    {
+        OutWeights[0] = 1.0f;
+        return;
+    }
+
+    if (State.NumBlendAxes == 1)
+    {
+        // 샘플은 위치 순으로 정렬되어 있음
+        const float X = GetFloat(State.BlendParameters[0]);
+        if (X <= State.Samples[0].Position[0])
+        {
+            OutWeights[0] = 1.0f;
+            return;
+        }
+        for (int32 Index = 0; Index < NumSamples - 1; ++Index)
+        {
+            const float Left = State.Samples[Index].Position[0];
+            const float Right = State.Samples[Index + 1].Position[0];
+            if (X <= Right)
+            {
+                const float Alpha = Right - Left > KINDA_SMALL_NUMBER ? (X - Left) / (Right - Left) : 1.0f;
+                OutWeights[Index] = 1.0f - Alpha;
+                OutWeights[Index + 1] = Alpha;
+                return;
+            }
+        }
+        OutWeights[NumSamples - 1] = 1.0f;
+        return;
+    }
+
+    // 2D: 역거리 제곱 가중치
+    const float X = GetFloat(State.BlendParameters[0]);
+    const float Y = GetFloat(State.BlendParameters[1]);
+    float TotalWeight = 0.0f;
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        const float DX = State.Samples[Index].Position[0] - X;
+        const float DY = State.Samples[Index].Position[1] - Y;
+        const float DistanceSquared = DX * DX + DY * DY;
+        if (DistanceSquared <= KINDA_SMALL_NUMBER)
+        {
+            // 샘플 위에 있다면 그 샘플만 사용
+            for (int32 Other = 0; Other < Index; ++Other)
+            {
+                OutWeights[Other] = 0.0f;
+            }
+            OutWeights[Index] = 1.0f;
+            return;
+        }
+        OutWeights[Index] = 1.0f / DistanceSquared;
+        TotalWeight += OutWeights[Index];
+    }
+
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        OutWeights[Index] /= TotalWeight;
+    }
+}
+
+float FAnimGraphInstance::GetStateLength(const FAnimGraphState& State, const TArray<float>& Weights) const
+{
+    // Blend Space는 가중 평균 길이로 재생하여 모든 샘플의 위상을 맞춤
+    float Length = 0.0f;
+    for (int32 Index = 0; Index < State.Samples.Num(); ++Index)
+    {
+        Length += Weights[Index] * GetSequenceLength(State.Samples[Index].Sequence);
+    }
+    return Length;
+}
+
+void FAnimGraphInstance::Evaluate(FPoseContext& OutPose, const TArray<FTransform>& RefPose)
+{
+    if (!IsValid() || Current.StateIndex == INDEX_NONE || RefPose.Num() != PosePool.GetNumBones())
+    {
+        return;
+    }
+
+    if (OutPose.Pose.GetNumBones() != RefPose.Num())
+    {
+        OutPose.Pose.InitBones(RefPose.Num());
+        FillWithRefPose(OutPose.Pose, RefPose);
+    }
+
+    if (bSnapshotPending)
+    {
+        // OutPose에는 아직 중단된 블렌딩의 마지막 결과가 남아있음
+        for (int32 BoneIndex = 0; BoneIndex < RefPose.Num(); ++BoneIndex)
+        {
+            SnapshotPose[BoneIndex] = OutPose.Pose[BoneIndex];
+        }
+        bSnapshotPending = false;
+    }
+
+    if (!IsBlending())
+    {
+        EvaluateState(Current, OutPose, RefPose);
+        return;
+    }
+
+    FPoseContext* TargetPose = PosePool.Acquire();
+    TargetPose->RequiredBones = OutPose.RequiredBones;
+    EvaluateState(Current, *TargetPose, RefPose);
+
+    if (bBlendFromSnapshot)
+    {
+        FAnimationRuntime::BlendTwoPosesTogether(TargetPose->Pose, SnapshotPose, GetBlendAlpha(), OutPose.Pose);
+    }
+    else
+    {
+        FPoseContext* SourcePose = PosePool.Acquire();
+        SourcePose->RequiredBones = OutPose.RequiredBones;
+        EvaluateState(Previous, *SourcePose, RefPose);
+
+        FAnimationRuntime::BlendTwoPosesTogether(TargetPose->Pose, SourcePose->Pose, GetBlendAlpha(), OutPose.Pose);
+        PosePool.Release(SourcePose);
+    }
+
+    PosePool.Release(TargetPose);
+}
+
+void FAnimGraphInstance::EvaluateState(const FStatePlayback& Playback, FPoseContext& OutPose, const TArray<FTransform>& RefPose)
+{
+    const FAnimGraphState& State = Definition->States[Playback.StateIndex];
+    ComputeSampleWeights(State, WeightScratch);
+
+    int32 NumActiveSamples = 0;
+    int32 LastActiveSample = INDEX_NONE;
+    for (int32 Index = 0; Index < State.Samples.Num(); ++Index)
+    {
+        if (WeightScratch[Index] > KINDA_SMALL_NUMBER)
+        {
+            ++NumActiveSamples;
+            LastActiveSample = Index;
+        }
+    }
+
+    // 샘플 하나라면 임시 포즈 없이 바로 평가
+    if (NumActiveSamples == 1)
+    {
+        if (!EvaluateSample(State.Samples[LastActiveSample], Playback.NormalizedTime, State.bLooping, OutPose, RefPose))
+        {
+            FillWithRefPose(OutPose.Pose, RefPose);
+        }
+        return;
+    }
+
+    FPoseContext* SamplePose = PosePool.Acquire();
+    SamplePose->RequiredBones = OutPose.RequiredBones;
+
+    bool bFirstSample = true;
+    for (int32 Index = 0; Index < State.Samples.Num(); ++Index)
+    {
+        const float Weight = WeightScratch[Index];
+        if (Weight <= KINDA_SMALL_NUMBER)
+        {
+            continue;
+        }
+        if (!EvaluateSample(State.Samples[Index], Playback.NormalizedTime, State.bLooping, *SamplePose, RefPose))
+        {
+            continue;
+        }
+
+        FAnimationRuntime::AccumulateWeightedPose(SamplePose->Pose, Weight, bFirstSample, OutPose.Pose);
+        bFirstSample = false;
+    }
+
+    PosePool.Release(SamplePose);
+
+    if (bFirstSample)
+    {
+        FillWithRefPose(OutPose.Pose, RefPose);
+    }
+    else
+    {
+        OutPose.Pose.NormalizeRotations();
+    }
+}
+
+bool FAnimGraphInstance::EvaluateSample(const FAnimBlendSample& Sample, float NormalizedTime, bool bLooping, FPoseContext& OutPose, const TArray<FTransform>& RefPose) const
+{
+    const float Length = GetSequenceLength(Sample.Sequence);
+    if (Length <= 0.0f)
+    {
+        return false;
+    }
+
+    // 다른 스켈레톤의 애니메이션은 Bone Track을 찾을 수 없음
+    if (USkeleton* Skeleton = Sample.Sequence->GetSkeleton())
+    {
+        if (Skeleton->GetReferenceSkeleton().GetRawBoneNum() != OutPose.Pose.GetNumBones())
+        {
+            return false;
+        }
+    }
+
+    // GetBonePose는 Reference Pose에 Track을 곱하므로 먼저 채워둠
+    FillWithRefPose(OutPose.Pose, RefPose);
+
+    float Time = NormalizedTime * Length;
+    if (!bLooping)
+    {
+        // 마지막 프레임에서 첫 프레임으로 돌아가지 않도록
+        Time = FMath::Min(Time, Length - KINDA_SMALL_NUMBER);
+    }
+
+    Sample.Sequence->GetAnimationPose(OutPose, FAnimExtractContext(Time, bLooping));
+    return true;
+}
+
+FName FAnimGraphInstance::GetCurrentStateName() const
+{
+    return IsValid() && Definition->States.IsValidIndex(Current.StateIndex) ? Definition->States[Current.StateIndex].Name : NAME_None;
+}
+
+FName FAnimGraphInstance::GetPreviousStateName() const
+{
+    return IsBlending() && !bBlendFromSnapshot && Definition->States.IsValidIndex(Previous.StateIndex) ? Definition->States[Previous.StateIndex].Name : NAME_None;
+}
+
+float FAnimGraphInstance::GetBlendAlpha() const
+{
+    return BlendDuration > 0.0f ? FMath::Clamp(BlendElapsed / BlendDuration, 0.0f, 1.0f) : 1.0f;
+}
@@ -0,0 +1,212 @@
+#pragma once
+#include <functional>
+#include <memory>
+
+#include "AnimNodeBase.h"
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "UObject/NameTypes.h"
+
+class UAnimSequence;
+
+enum class EAnimGraphParameterType : uint8
+{
+    Float,
+    Bool,
+};
+
+enum class EAnimGraphConditionOp : uint8
+{
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+};
+
+/** 그래프의 입력 값, Bool은 0 또는 1로 저장됩니다. */
+struct FAnimGraphParameter
+{
+    FName Name;
+    EAnimGraphParameterType Type = EAnimGraphParameterType::Float;
+    float DefaultValue = 0.0f;
+};
+
+/** Parameters[ParameterIndex] Op Value */
+struct FAnimGraphCondition
+{
+    int32 ParameterIndex = INDEX_NONE;
+    EAnimGraphConditionOp Op = EAnimGraphConditionOp::Equal;
+    float Value = 0.0f;
+};
+
+/** Blend Space의 한 점에 놓인 애니메이션 */
+struct FAnimBlendSample
+{
+    UAnimSequence* Sequence = nullptr;
+    float Position[2] = { 0.0f, 0.0f };
+};
+
+/**
+ * 그래프의 상태
+ *
+ * 샘플이 하나라면 단일 애니메이션, 여럿이라면 BlendParameters 축 위에 놓인 Blend Space입니다.
+ * Blend Space의 샘플들은 길이가 달라도 같은 정규화 시간으로 재생되어 발 위치가 맞춰집니다.
+ */
+struct FAnimGraphState
+{
+    FName Name;
+    TArray<FAnimBlendSample> Samples;
+
+    /** Blend Space 축으로 사용할 파라미터 */
+    int32 BlendParameters[2] = { INDEX_NONE, INDEX_NONE };
+
+    /** 0: 단일 애니메이션, 1: 1D Blend Space, 2: 2D Blend Space */
+    int32 NumBlendAxes = 0;
+
+    float PlayRate = 1.0f;
+    bool bLooping = true;
+};
+
+/** FromState에서 Conditions를 모두 만족하면 BlendDuration 동안 ToState로 전이합니다. */
+struct FAnimGraphTransition
+{
+    /** INDEX_NONE이라면 ToState가 아닌 모든 상태에서 전이 */
+    int32 FromState = INDEX_NONE;
+    int32 ToState = INDEX_NONE;
+    float BlendDuration = 0.2f;
+    TArray<FAnimGraphCondition> Conditions;
+};
+
+/**
+ * 애니메이션 그래프의 정의, 여러 인스턴스가 공유하며 로드 후에는 수정하지 않습니다.
+ *
+ * JSON 형식:
+ * {
+ *   "Parameters": [ { "Name": "MoveSpeed", "Type": "Float", "Default": 0 }, { "Name": "Dance", "Type": "Bool" } ],
+ *   "EntryState": "Locomotion",
+ *   "States": [
+ *     { "Name": "Locomotion", "BlendParameters": ["MoveSpeed"],
+ *       "Samples": [ { "Animation": "Contents/Asset/Idle", "Position": [0] }, ... ] },
+ *     { "Name": "Dance", "Animation": "Contents/Asset/GangnamStyle", "Loop": true, "PlayRate": 1 }
+ *   ],
+ *   "Transitions": [
+ *     { "From": "Locomotion", "To": "Dance", "Duration": 0.2, "Conditions": [ { "Parameter": "Dance", "Op": "==", "Value": true } ] },
+ *     { "From": "*", ... }
+ *   ]
+ * }
+ */
+struct FAnimGraphDefinition
+{
+    /** 애니메이션 경로를 UAnimSequence로 바꿉니다. 에셋 없이 테스트할 때 직접 만든 시퀀스를 돌려줄 수 있습니다. */
+    using FSequenceResolver = std::function<UAnimSequence*(const FString&)>;
+
+    TArray<FAnimGraphParameter> Parameters;
+    TArray<FAnimGraphState> States;
+    TArray<FAnimGraphTransition> Transitions;
+    int32 EntryState = 0;
+
+    /** Resolver가 비어있다면 UAssetManager에서 애니메이션을 찾습니다. */
+    bool LoadFromJson(const FString& JsonString, const FSequenceResolver& Resolver, FString& OutError);
+    bool LoadFromFile(const FString& FilePath, const FSequenceResolver& Resolver = nullptr);
+
+    int32 FindParameterIndex(const FName& Name) const;
+    int32 FindStateIndex(const FName& Name) const;
+
+    /** 한 상태가 가진 가장 많은 샘플 수 */
+    int32 GetMaxNumSamples() const;
+};
+
+/**
+ * 평가 중에 사용하는 임시 포즈의 풀
+ * 초기화 시 본 수만큼 미리 할당해두므로 매 프레임 포즈를 할당하지 않습니다.
+ */
+class FAnimPosePool
+{
+public:
+    void Initialize(int32 InNumBones, int32 InitialSize);
+
+    /** 풀이 비어있다면 새로 할당합니다. Release로 반드시 반환해야 합니다. */
+    FPoseContext* Acquire();
+    void Release(FPoseContext* Context);
+
+    int32 GetNumBones() const { return NumBones; }
+
+private:
+    TArray<std::unique_ptr<FPoseContext>> Contexts;
+    TArray<FPoseContext*> FreeContexts;
+    int32 NumBones = 0;
+};
+
+/** 그래프 정의를 실행하는 인스턴스별 상태 */
+class FAnimGraphInstance
+{
+public:
+    void Initialize(std::shared_ptr<const FAnimGraphDefinition> InDefinition, int32 NumBones);
+    bool IsValid() const { return Definition != nullptr && Definition->States.Num() > 0; }
+
+    const FAnimGraphDefinition* GetDefinition() const { return Definition.get(); }
+
+    void SetFloat(int32 ParameterIndex, float Value);
+    void SetFloat(const FName& Name, float Value);
+    void SetBool(const FName& Name, bool bValue);
+    float GetFloat(int32 ParameterIndex) const;
+    float GetFloat(const FName& Name) const;
+    bool GetBool(const FName& Name) const;
+
+    /** 재생 시간을 진행하고 전이 조건을 검사합니다. */
+    void Update(float DeltaSeconds);
+
+    /**
+     * 현재 포즈를 OutPose에 씁니다. OutPose.RequiredBones에서 제외된 본은 RefPose를 사용합니다.
+     * 전이 중 다른 전이가 시작되면 OutPose에 남아있던 직전 결과를 스냅샷으로 사용해 블렌딩합니다.
+     */
+    void Evaluate(FPoseContext& OutPose, const TArray<FTransform>& RefPose);
+
+    int32 GetCurrentStateIndex() const { return Current.StateIndex; }
+    FName GetCurrentStateName() const;
+
+    /** 블렌딩 중인 이전 상태, 블렌딩 중이 아니거나 스냅샷에서 블렌딩 중이라면 NAME_None */
+    FName GetPreviousStateName() const;
+
+    bool IsBlending() const { return BlendDuration > 0.0f && BlendElapsed < BlendDuration; }
+    float GetBlendAlpha() const;
+
+private:
+    struct FStatePlayback
+    {
+        int32 StateIndex = INDEX_NONE;
+
+        /** [0, 1] 범위의 재생 위치 */
+        float NormalizedTime = 0.0f;
+    };
+
+    void AdvanceState(FStatePlayback& Playback, float DeltaSeconds);
+    bool CheckConditions(const FAnimGraphTransition& Transition) const;
+    void StartTransition(const FAnimGraphTransition& Transition);
+
+    /** Weights에 샘플별 가중치를 채웁니다. 합은 1입니다. */
+    void ComputeSampleWeights(const FAnimGraphState& State, TArray<float>& OutWeights) const;
+    float GetStateLength(const FAnimGraphState& State, const TArray<float>& Weights) const;
+
+    void EvaluateState(const FStatePlayback& Playback, FPoseContext& OutPose, const TArray<FTransform>& RefPose);
+    bool EvaluateSample(const FAnimBlendSample& Sample, float NormalizedTime, bool bLooping, FPoseContext& OutPose, const TArray<FTransform>& RefPose) const;
+
+    std::shared_ptr<const FAnimGraphDefinition> Definition;
+    TArray<float> ParameterValues;
+
+    FStatePlayback Current;
+    FStatePlayback Previous;
+    float BlendElapsed = 0.0f;
+    float BlendDuration = 0.0f;
+
+    /** 전이 도중 새 전이가 시작되었을 때, 중단된 블렌딩 결과 */
+    FCompactPose SnapshotPose;
+    bool bBlendFromSnapshot = false;
+    bool bSnapshotPending = false;
+
+    FAnimPosePool PosePool;
+    TArray<float> WeightScratch;
+};
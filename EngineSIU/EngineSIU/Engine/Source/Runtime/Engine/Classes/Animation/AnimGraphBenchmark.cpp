@@ -0,0 +1,296 @@
+#include "AnimGraphBenchmark.h"
+
+#include "AnimGraph.h"
+#include "AnimSequence.h"
+#include "AnimTypes.h"
+#include "Skeleton.h"
+#include "AnimData/AnimDataModel.h"
+#include "Developer/AnimDataController/AnimDataController.h"
+#include "Container/Map.h"
+#include "Math/MathUtility.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    constexpr int32 SyntheticNumBones = 64;
+    constexpr int32 SyntheticFrameRate = 30;
+    constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+    /** Bool 파라미터를 켜고 끄는 주기, 짧게 켜지는 인스턴스는 블렌딩(0.2초)이 끝나기 전에 되돌아감 */
+    constexpr int32 TogglePeriodFrames = 120;
+    constexpr int32 LongToggleFrames = 40;
+    constexpr int32 ShortToggleFrames = 6;
+
+    /** 본 0이 루트이고 나머지는 4개의 체인으로 이어진 스켈레톤 */
+    USkeleton* CreateSyntheticSkeleton()
+    {
+        FReferenceSkeleton RefSkeleton;
+        for (int32 BoneIndex = 0; BoneIndex < SyntheticNumBones; ++BoneIndex)
+        {
+            const FName BoneName(FString::Printf(TEXT("SyntheticBone_%d"), BoneIndex));
+            const int32 ParentIndex = BoneIndex == 0 ? INDEX_NONE : FMath::Max(0, BoneIndex - 4);
+
+            RefSkeleton.RawRefBoneInfo.Add(FMeshBoneInfo(BoneName, ParentIndex));
+            RefSkeleton.RawRefBonePose.Add(FTransform(FQuat::Identity, FVector(0.0f, 0.0f, BoneIndex == 0 ? 0.0f : 10.0f), FVector::OneVector));
+            RefSkeleton.RawNameToIndexMap.Add(BoneName, BoneIndex);
+        }
+
+        USkeleton* Skeleton = FObjectFactory::ConstructObject<USkeleton>(nullptr);
+        Skeleton->SetReferenceSkeleton(RefSkeleton);
+        return Skeleton;
+    }
+
+    /** SequenceIndex마다 길이와 진폭이 다르고, 마지막 프레임이 첫 프레임과 같아 끊김 없이 반복되는 시퀀스 */
+    UAnimSequence* CreateSyntheticSequence(USkeleton* Skeleton, int32 SequenceIndex)
+    {
+        UAnimSequence* Sequence = FObjectFactory::ConstructObject<UAnimSequence>(nullptr, FName(FString::Printf(TEXT("SyntheticAnim_%d"), SequenceIndex)));
+        Sequence->SetSkeleton(Skeleton);
+
+        const int32 NumFrames = SyntheticFrameRate + 1 + SequenceIndex * 14;
+        const float Amplitude = 0.3f + 0.1f * static_cast<float>(SequenceIndex % 5);
+
+        UAnimDataController& Controller = Sequence->GetController();
+        Controller.SetFrameRate(SyntheticFrameRate);
+        Controller.SetNumberOfFrames(NumFrames);
+
+        TArray<FVector> Positions;
+        TArray<FQuat> Rotations;
+        TArray<FVector> Scales;
+        Positions.SetNum(NumFrames);
+        Rotations.SetNum(NumFrames);
+        Scales.SetNum(NumFrames);
+
+        const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+        for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetRawBoneNum(); ++BoneIndex)
+        {
+            const FName BoneName = RefSkeleton.GetBoneName(BoneIndex);
+            if (Controller.AddBoneTrack(BoneName) == INDEX_NONE)
+            {
+                continue;
+            }
+
+            const FVector Axis = FVector(FMath::Sin(static_cast<float>(BoneIndex)), 1.0f, 0.5f).GetSafeNormal();
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                const float Phase = TWO_PI * static_cast<float>(Frame) / static_cast<float>(NumFrames - 1) + static_cast<float>(BoneIndex) * 0.3f;
+                Positions[Frame] = BoneIndex == 0 ? FVector(0.0f, 0.0f, FMath::Sin(Phase) * 2.0f) : FVector::ZeroVector;
+                Rotations[Frame] = FQuat(Axis, FMath::Sin(Phase) * Amplitude);
+                Scales[Frame] = FVector::OneVector;
+            }
+            Controller.SetBoneTrackKeys(BoneName, Positions, Rotations, Scales);
+        }
+
+        // FbxLoader와 같이 압축된 데이터로 평가
+        Sequence->GetDataModel()->CompressAnimation();
+        return Sequence;
+    }
+
+    void DestroySyntheticObjects(USkeleton* Skeleton, const TArray<UAnimSequence*>& Sequences)
+    {
+        for (UAnimSequence* Sequence : Sequences)
+        {
+            GUObjectArray.MarkRemoveObject(&Sequence->GetController());
+            GUObjectArray.MarkRemoveObject(Sequence->GetDataModel());
+            GUObjectArray.MarkRemoveObject(Sequence);
+        }
+        GUObjectArray.MarkRemoveObject(Skeleton);
+    }
+
+    /** Blend Space 축으로 쓰이는 Float 파라미터는 샘플이 놓인 범위, 나머지는 [0, 1] */
+    void ComputeParameterRanges(const FAnimGraphDefinition& Definition, TArray<float>& OutMin, TArray<float>& OutMax)
+    {
+        OutMin.SetNum(Definition.Parameters.Num());
+        OutMax.SetNum(Definition.Parameters.Num());
+        TArray<uint8> bFound;
+        bFound.SetNum(Definition.Parameters.Num());
+        for (int32 ParameterIndex = 0; ParameterIndex < Definition.Parameters.Num(); ++ParameterIndex)
+        {
+            OutMin[ParameterIndex] = 0.0f;
+            OutMax[ParameterIndex] = 1.0f;
+            bFound[ParameterIndex] = 0;
+        }
+
+        for (const FAnimGraphState& State : Definition.States)
+        {
+            for (int32 Axis = 0; Axis < State.NumBlendAxes; ++Axis)
+            {
+                const int32 ParameterIndex = State.BlendParameters[Axis];
+                if (!Definition.Parameters.IsValidIndex(ParameterIndex))
+                {
+                    continue;
+                }
+
+                for (const FAnimBlendSample& Sample : State.Samples)
+                {
+                    const float Position = Sample.Position[Axis];
+                    OutMin[ParameterIndex] = bFound[ParameterIndex] ? FMath::Min(OutMin[ParameterIndex], Position) : Position;
+                    OutMax[ParameterIndex] = bFound[ParameterIndex] ? FMath::Max(OutMax[ParameterIndex], Position) : Position;
+                    bFound[ParameterIndex] = 1;
+                }
+            }
+        }
+    }
+
+    /** 인스턴스마다 위상이 다르게 파라미터를 움직임 */
+    void DriveParameters(
+        FAnimGraphInstance& Instance, const FAnimGraphDefinition& Definition,
+        const TArray<float>& RangeMin, const TArray<float>& RangeMax, int32 InstanceIndex, int32 Frame
+    )
+    {
+        const float Time = static_cast<float>(Frame) * BenchmarkDeltaTime;
+        for (int32 ParameterIndex = 0; ParameterIndex < Definition.Parameters.Num(); ++ParameterIndex)
+        {
+            if (Definition.Parameters[ParameterIndex].Type == EAnimGraphParameterType::Float)
+            {
+                const float Alpha = 0.5f + 0.5f * FMath::Sin(Time * 0.7f + static_cast<float>(InstanceIndex + ParameterIndex));
+                Instance.SetFloat(ParameterIndex, FMath::Lerp(RangeMin[ParameterIndex], RangeMax[ParameterIndex], Alpha));
+            }
+            else
+            {
+                const int32 ToggleFrames = InstanceIndex % 4 == 0 ? ShortToggleFrames : LongToggleFrames;
+                const int32 PeriodFrame = (Frame + InstanceIndex * 37 + ParameterIndex * 13) % TogglePeriodFrames;
+                const bool bOn = PeriodFrame >= TogglePeriodFrames / 2 && PeriodFrame < TogglePeriodFrames / 2 + ToggleFrames;
+                Instance.SetFloat(ParameterIndex, bOn ? 1.0f : 0.0f);
+            }
+        }
+    }
+
+    int32 CountInvalidBones(const FCompactPose& Pose)
+    {
+        int32 NumInvalid = 0;
+        for (int32 BoneIndex = 0; BoneIndex < Pose.GetNumBones(); ++BoneIndex)
+        {
+            const FTransform& Transform = Pose[BoneIndex];
+            NumInvalid += Transform.ContainsNaN() || !Transform.GetRotation().IsNormalized() ? 1 : 0;
+        }
+        return NumInvalid;
+    }
+}
+
+void FAnimGraphBenchmark::Run(const FString& GraphPath, int32 NumInstances, int32 NumFrames)
+{
+    if (NumInstances <= 0 || NumFrames <= 0)
+    {
+        return;
+    }
+
+    USkeleton* Skeleton = CreateSyntheticSkeleton();
+    const TArray<FTransform>& RefPose = Skeleton->GetReferenceSkeleton().GetRawRefBonePose();
+
+    // 같은 경로는 같은 시퀀스를 공유
+    TArray<UAnimSequence*> Sequences;
+    TMap<FString, UAnimSequence*> SequencesByPath;
+    const FAnimGraphDefinition::FSequenceResolver Resolver = [Skeleton, &Sequences, &SequencesByPath](const FString& Path) -> UAnimSequence*
+    {
+        if (UAnimSequence** Found = SequencesByPath.Find(Path))
+        {
+            return *Found;
+        }
+
+        UAnimSequence* Sequence = CreateSyntheticSequence(Skeleton, Sequences.Num());
+        Sequences.Add(Sequence);
+        SequencesByPath.Add(Path, Sequence);
+        return Sequence;
+    };
+
+    std::shared_ptr<FAnimGraphDefinition> Definition = std::make_shared<FAnimGraphDefinition>();
+    if (!Definition->LoadFromFile(GraphPath, Resolver))
+    {
+        DestroySyntheticObjects(Skeleton, Sequences);
+        return;
+    }
+
+    TArray<float> RangeMin;
+    TArray<float> RangeMax;
+    ComputeParameterRanges(*Definition, RangeMin, RangeMax);
+
+    // 인스턴스는 풀에 unique_ptr을 가지므로 FAnimPosePool과 같이 포인터로 보관
+    TArray<std::unique_ptr<FAnimGraphInstance>> Instances;
+    TArray<FPoseContext> OutputPoses;
+    Instances.Reserve(NumInstances);
+    OutputPoses.Reserve(NumInstances);
+    for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+    {
+        FAnimGraphInstance* Instance = Instances[Instances.Emplace(std::make_unique<FAnimGraphInstance>())].get();
+        Instance->Initialize(Definition, SyntheticNumBones);
+        OutputPoses.Emplace(nullptr);
+    }
+
+    uint64 UpdateCycles = 0;
+    uint64 EvaluateCycles = 0;
+    int32 NumTransitions = 0;
+    int32 NumInterruptedTransitions = 0;
+    int32 NumInvalidBones = 0;
+
+    // 전이 횟수를 세기 위해 Update 전의 상태를 기록, 시간 측정에서는 제외
+    TArray<int32> PreviousStates;
+    TArray<uint8> bWasBlending;
+    PreviousStates.SetNum(NumInstances);
+    bWasBlending.SetNum(NumInstances);
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+        {
+            DriveParameters(*Instances[InstanceIndex], *Definition, RangeMin, RangeMax, InstanceIndex, Frame);
+        }
+
+        for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+        {
+            PreviousStates[InstanceIndex] = Instances[InstanceIndex]->GetCurrentStateIndex();
+            bWasBlending[InstanceIndex] = Instances[InstanceIndex]->IsBlending() ? 1 : 0;
+        }
+
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        for (const std::unique_ptr<FAnimGraphInstance>& Instance : Instances)
+        {
+            Instance->Update(BenchmarkDeltaTime);
+        }
+        UpdateCycles += FPlatformTime::Cycles64() - StartCycles;
+
+        StartCycles = FPlatformTime::Cycles64();
+        for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+        {
+            Instances[InstanceIndex]->Evaluate(OutputPoses[InstanceIndex], RefPose);
+        }
+        EvaluateCycles += FPlatformTime::Cycles64() - StartCycles;
+
+        for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+        {
+            if (Instances[InstanceIndex]->GetCurrentStateIndex() != PreviousStates[InstanceIndex])
+            {
+                ++NumTransitions;
+                NumInterruptedTransitions += bWasBlending[InstanceIndex];
+            }
+            NumInvalidBones += CountInvalidBones(OutputPoses[InstanceIndex].Pose);
+        }
+    }
+
+    const double UpdateMs = FPlatformTime::ToMilliseconds(UpdateCycles);
+    const double EvaluateMs = FPlatformTime::ToMilliseconds(EvaluateCycles);
+    const double NumUpdates = static_cast<double>(NumInstances) * NumFrames;
+
+    UE_LOG(
+        ELogLevel::Display,
+        TEXT("Anim graph bench %s: %d instances x %d frames, %d bones, %d states, %d synthetic sequences"),
+        *GraphPath, NumInstances, NumFrames, SyntheticNumBones, Definition->States.Num(), Sequences.Num()
+    );
+    UE_LOG(
+        ELogLevel::Display,
+        TEXT("Anim graph bench: update %.3f ms/frame (%.2f us/instance), evaluate %.3f ms/frame (%.2f us/instance), %d transitions (%d interrupted)"),
+        UpdateMs / NumFrames, UpdateMs * 1000.0 / NumUpdates, EvaluateMs / NumFrames, EvaluateMs * 1000.0 / NumUpdates,
+        NumTransitions, NumInterruptedTransitions
+    );
+    if (NumInvalidBones > 0)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Anim graph bench: %d bone transforms were NaN or had unnormalized rotations"), NumInvalidBones);
+    }
+
+    // 인스턴스가 시퀀스를 가리키지 않도록 먼저 해제
+    Instances.Empty();
+    Definition.reset();
+    DestroySyntheticObjects(Skeleton, Sequences);
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 애니메이션 그래프 JSON을 에셋 없이 합성 스켈레톤과 합성 시퀀스로 로드하여 많은 인스턴스를 실행
+ *
+ * - FSequenceResolver로 그래프의 애니메이션 경로마다 길이가 다른 합성 UAnimSequence를 만들어 돌려줌
+ * - Float 파라미터는 Blend Space 샘플 범위 안에서 움직이고, Bool 파라미터는 주기적으로 켜고 끔
+ *   일부 인스턴스는 블렌딩이 끝나기 전에 되돌려 스냅샷 블렌딩도 실행
+ * - Update와 Evaluate 시간을 따로 측정하고, 결과 포즈에 NaN이나 정규화되지 않은 회전이 있는지 검사
+ */
+struct FAnimGraphBenchmark
+{
+    static void Run(const FString& GraphPath, int32 NumInstances, int32 NumFrames);
+};
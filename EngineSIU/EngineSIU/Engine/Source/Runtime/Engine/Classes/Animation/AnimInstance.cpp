@@ -3,6 +3,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/SkeletalMesh.h"
 #include "UObject/Casts.h"
+#include "World/TickTaskManager.h"
 
 void UAnimInstance::InitializeAnimation()
 {
@@ -20,6 +21,12 @@ void UAnimInstance::InitializeAnimation()
 void UAnimInstance::UpdateAnimation(float DeltaSeconds, FPoseContext& OutPose)
 {
     NativeUpdateAnimation(DeltaSeconds, OutPose);
+
+    // Notify는 임의의 게임 로직을 실행할 수 있으므로 병렬 Tick 중이라면 Game Thread에서 실행될 때까지 미룸
+    if (!FTickTaskManager::IsInParallelTick())
+    {
+        TriggerAnimNotifies(DeltaSeconds);
+    }
 }
 
 void UAnimInstance::NativeInitializeAnimation()
@@ -30,34 +37,11 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds, FPoseContext& OutP
 {
 }
 
-void UAnimInstance::SetAnimState(EAnimState InAnimState)
-{
-}
-
 UAnimStateMachine* UAnimInstance::GetStateMachine() const
 {
     return nullptr;
 }
 
-UAnimSequence* UAnimInstance::GetCurrAnim() const
-{
-    return nullptr;
-}
-
-UAnimSequence* UAnimInstance::GetPrevAnim() const
-{
-    return nullptr;
-}
-
-float UAnimInstance::GetBlendDuration() const
-{
-    return 0.f;
-}
-
-void UAnimInstance::SetBlendDuration(float InBlendDuration)
-{
-}
-
 USkeletalMeshComponent* UAnimInstance::GetSkelMeshComponent() const
 {
     return Cast<USkeletalMeshComponent>(GetOuter());
@@ -65,4 +49,8 @@ USkeletalMeshComponent* UAnimInstance::GetSkelMeshComponent() const
 
 void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
 {
+    if (!NotifyQueue.IsEmpty())
+    {
+        NotifyQueue.Dispatch(GetSkelMeshComponent());
+    }
 }
@@ -1,5 +1,5 @@
 ﻿#pragma once
-#include "AnimStateMachine.h"
+#include "AnimNotifyQueue.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
@@ -29,22 +29,18 @@ public:
 
     USkeletalMeshComponent* GetSkelMeshComponent() const;
 
+    /** 평가 중에 쌓인 Notify를 실행합니다. 병렬 Tick 중에 평가했다면 USkeletalMeshComponent::CompleteParallelTick에서 호출됩니다. */
     void TriggerAnimNotifies(float DeltaSeconds);
 
+    FAnimNotifyQueue& GetNotifyQueue() { return NotifyQueue; }
+
     USkeleton* GetCurrentSkeleton() const { return CurrentSkeleton; }
     
-    virtual void SetAnimState(EAnimState InAnimState);
-
     virtual UAnimStateMachine* GetStateMachine() const;
 
-    virtual UAnimSequence* GetCurrAnim() const;
-
-    virtual UAnimSequence* GetPrevAnim() const;
-
-    virtual float GetBlendDuration() const;
-
-    virtual void SetBlendDuration(float InBlendDuration);
 private:
     USkeleton* CurrentSkeleton;
+
+    FAnimNotifyQueue NotifyQueue;
     
 };
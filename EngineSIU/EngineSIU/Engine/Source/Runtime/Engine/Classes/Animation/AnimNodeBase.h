@@ -18,7 +18,18 @@ struct FPoseContext : public FAnimationBaseContext
     FCompactPose Pose;
     // FBlendedCurve Curve;
 
+    /**
+     * Bone LOD에 의해 평가가 필요한 본, nullptr이라면 모든 본을 평가합니다.
+     * 평가하지 않는 본은 Reference Pose를 사용합니다.
+     */
+    const TArray<uint8>* RequiredBones = nullptr;
+
     FPoseContext(UAnimInstance* InAnimInstance)
         : FAnimationBaseContext(InAnimInstance)
     {}
+
+    bool IsBoneRequired(int32 BoneIndex) const
+    {
+        return !RequiredBones || !RequiredBones->IsValidIndex(BoneIndex) || (*RequiredBones)[BoneIndex] != 0;
+    }
 };
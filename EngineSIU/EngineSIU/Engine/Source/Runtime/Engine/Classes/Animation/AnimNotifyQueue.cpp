@@ -0,0 +1,171 @@
+#include "AnimNotifyQueue.h"
+
+#include <algorithm>
+
+#include "AnimNotifyState.h"
+#include "AnimTypes.h"
+
+void FAnimNotifyTimeline::Build(const TArray<FAnimNotifyEvent>& Notifies)
+{
+    ++Version;
+
+    NotifyTimes.Empty();
+    NotifyIndices.Empty();
+    StateBoundaries.Empty();
+    SegmentMasks.Empty();
+    StateNotifyIndices.Empty();
+
+    // 같은 시간의 Notify는 추가된 순서대로 발생
+    TArray<int32> SortedNotifies;
+    for (int32 NotifyIndex = 0; NotifyIndex < Notifies.Num(); ++NotifyIndex)
+    {
+        if (Notifies[NotifyIndex].IsState())
+        {
+            StateNotifyIndices.Add(NotifyIndex);
+            StateBoundaries.Add(Notifies[NotifyIndex].Time);
+            StateBoundaries.Add(Notifies[NotifyIndex].GetEndTime());
+        }
+        else
+        {
+            SortedNotifies.Add(NotifyIndex);
+        }
+    }
+
+    SortedNotifies.Sort([&Notifies](int32 A, int32 B)
+    {
+        return Notifies[A].Time < Notifies[B].Time || (Notifies[A].Time == Notifies[B].Time && A < B);
+    });
+
+    NotifyTimes.Reserve(SortedNotifies.Num());
+    NotifyIndices.Reserve(SortedNotifies.Num());
+    for (const int32 NotifyIndex : SortedNotifies)
+    {
+        NotifyTimes.Add(Notifies[NotifyIndex].Time);
+        NotifyIndices.Add(NotifyIndex);
+    }
+
+    StateBoundaries.Sort();
+    StateBoundaries.GetContainerPrivate().erase(
+        std::unique(StateBoundaries.begin(), StateBoundaries.end()), StateBoundaries.GetContainerPrivate().end()
+    );
+
+    NumStateWords = (StateNotifyIndices.Num() + 63) / 64;
+    const int32 NumSegments = StateBoundaries.Num() + 1;
+    SegmentMasks.Init(0, NumSegments * NumStateWords);
+
+    for (int32 StateBit = 0; StateBit < StateNotifyIndices.Num(); ++StateBit)
+    {
+        const FAnimNotifyEvent& State = Notifies[StateNotifyIndices[StateBit]];
+
+        // 구간 i의 시작 경계는 StateBoundaries[i - 1]
+        const int32 FirstSegment = static_cast<int32>(std::lower_bound(StateBoundaries.begin(), StateBoundaries.end(), State.Time) - StateBoundaries.begin()) + 1;
+        const int32 EndSegment = static_cast<int32>(std::lower_bound(StateBoundaries.begin(), StateBoundaries.end(), State.GetEndTime()) - StateBoundaries.begin()) + 1;
+
+        for (int32 Segment = FirstSegment; Segment < EndSegment; ++Segment)
+        {
+            SegmentMasks[Segment * NumStateWords + StateBit / 64] |= 1ull << (StateBit % 64);
+        }
+    }
+}
+
+void FAnimNotifyTimeline::GatherNotifies(float MinTime, bool bIncludeMin, float MaxTime, bool bIncludeMax, bool bReverse, TArray<int32>& OutNotifyIndices) const
+{
+    const float* TimesBegin = NotifyTimes.GetData();
+    const float* TimesEnd = TimesBegin + NotifyTimes.Num();
+
+    const int32 First = static_cast<int32>((bIncludeMin ? std::lower_bound(TimesBegin, TimesEnd, MinTime) : std::upper_bound(TimesBegin, TimesEnd, MinTime)) - TimesBegin);
+    const int32 Last = static_cast<int32>((bIncludeMax ? std::upper_bound(TimesBegin, TimesEnd, MaxTime) : std::lower_bound(TimesBegin, TimesEnd, MaxTime)) - TimesBegin);
+
+    if (bReverse)
+    {
+        for (int32 Index = Last - 1; Index >= First; --Index)
+        {
+            OutNotifyIndices.Add(NotifyIndices[Index]);
+        }
+    }
+    else
+    {
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            OutNotifyIndices.Add(NotifyIndices[Index]);
+        }
+    }
+}
+
+const uint64* FAnimNotifyTimeline::GetActiveStateMask(float Time) const
+{
+    if (NumStateWords == 0)
+    {
+        return nullptr;
+    }
+
+    // State는 [Time, EndTime) 동안 활성화되므로 경계와 같은 시간은 다음 구간
+    const int32 Segment = static_cast<int32>(std::upper_bound(StateBoundaries.begin(), StateBoundaries.end(), Time) - StateBoundaries.begin());
+    return &SegmentMasks[Segment * NumStateWords];
+}
+
+void FAnimNotifyStateTracker::Reset(UAnimSequenceBase* InAsset, uint32 InTimelineVersion, int32 NumWords)
+{
+    Asset = InAsset;
+    TimelineVersion = InTimelineVersion;
+    ActiveBits.Init(0, NumWords);
+}
+
+void FAnimNotifyQueue::AddNotify(UAnimNotify* Notify, UAnimSequenceBase* Animation)
+{
+    FAnimNotifyQueueEvent& Event = Events[Events.Emplace()];
+    Event.Type = EAnimNotifyEventType::Notify;
+    Event.Notify = Notify;
+    Event.Animation = Animation;
+}
+
+void FAnimNotifyQueue::AddStateBegin(UAnimNotifyState* NotifyState, UAnimSequenceBase* Animation, float TotalDuration)
+{
+    FAnimNotifyQueueEvent& Event = Events[Events.Emplace()];
+    Event.Type = EAnimNotifyEventType::StateBegin;
+    Event.NotifyState = NotifyState;
+    Event.Animation = Animation;
+    Event.Time = TotalDuration;
+}
+
+void FAnimNotifyQueue::AddStateTick(UAnimNotifyState* NotifyState, UAnimSequenceBase* Animation, float DeltaTime)
+{
+    FAnimNotifyQueueEvent& Event = Events[Events.Emplace()];
+    Event.Type = EAnimNotifyEventType::StateTick;
+    Event.NotifyState = NotifyState;
+    Event.Animation = Animation;
+    Event.Time = DeltaTime;
+}
+
+void FAnimNotifyQueue::AddStateEnd(UAnimNotifyState* NotifyState, UAnimSequenceBase* Animation)
+{
+    FAnimNotifyQueueEvent& Event = Events[Events.Emplace()];
+    Event.Type = EAnimNotifyEventType::StateEnd;
+    Event.NotifyState = NotifyState;
+    Event.Animation = Animation;
+}
+
+void FAnimNotifyQueue::Dispatch(USkeletalMeshComponent* MeshComp)
+{
+    // Notify가 다시 Queue에 추가할 수 있으므로 인덱스로 순회하고 복사해서 실행
+    for (int32 Index = 0; Index < Events.Num(); ++Index)
+    {
+        const FAnimNotifyQueueEvent Event = Events[Index];
+        switch (Event.Type)
+        {
+        case EAnimNotifyEventType::Notify:
+            Event.Notify->Notify(MeshComp, Event.Animation);
+            break;
+        case EAnimNotifyEventType::StateBegin:
+            Event.NotifyState->NotifyBegin(MeshComp, Event.Animation, Event.Time);
+            break;
+        case EAnimNotifyEventType::StateTick:
+            Event.NotifyState->NotifyTick(MeshComp, Event.Animation, Event.Time);
+            break;
+        case EAnimNotifyEventType::StateEnd:
+            Event.NotifyState->NotifyEnd(MeshComp, Event.Animation);
+            break;
+        }
+    }
+    Events.Empty();
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+struct FAnimNotifyEvent;
+class UAnimNotify;
+class UAnimNotifyState;
+class UAnimSequenceBase;
+class USkeletalMeshComponent;
+
+/**
+ * 시퀀스의 Notify를 시간 순으로 정렬해둔 타임라인
+ *
+ * 단일 Notify는 시간 순 배열에서 이진 탐색으로 구간을 찾고,
+ * Notify State는 시작/끝 시간으로 나눈 구간마다 활성 State의 비트 마스크를 미리 계산해둡니다.
+ * Notify가 수정될 때 다시 만들며, 평가 중에는 읽기만 하므로 병렬 Tick 중에 접근해도 안전합니다.
+ */
+class FAnimNotifyTimeline
+{
+public:
+    void Build(const TArray<FAnimNotifyEvent>& Notifies);
+
+    /** Build할 때마다 증가, 인스턴스가 가진 State 비트가 현재 타임라인 기준인지 확인하는 데 사용 */
+    uint32 GetVersion() const { return Version; }
+
+    /**
+     * [MinTime, MaxTime] 사이의 단일 Notify 인덱스를 재생 순서대로 OutNotifyIndices에 추가합니다.
+     * bIncludeMin, bIncludeMax로 양 끝의 포함 여부를 정하고, bReverse라면 시간의 역순으로 추가합니다.
+     */
+    void GatherNotifies(float MinTime, bool bIncludeMin, float MaxTime, bool bIncludeMax, bool bReverse, TArray<int32>& OutNotifyIndices) const;
+
+    int32 GetNumStates() const { return StateNotifyIndices.Num(); }
+    int32 GetNumStateWords() const { return NumStateWords; }
+
+    /** State 비트 StateBit에 해당하는 Notify 인덱스 */
+    int32 GetStateNotifyIndex(int32 StateBit) const { return StateNotifyIndices[StateBit]; }
+
+    /** Time에 활성화되어 있는 State의 비트 마스크, GetNumStateWords 길이 */
+    const uint64* GetActiveStateMask(float Time) const;
+
+private:
+    uint32 Version = 0;
+
+    /** 단일 Notify, 시간 순 */
+    TArray<float> NotifyTimes;
+    TArray<int32> NotifyIndices;
+
+    /** Notify State의 시작/끝 시간을 정렬한 경계, 구간 i는 [Boundaries[i - 1], Boundaries[i]) */
+    TArray<float> StateBoundaries;
+
+    /** 구간마다 NumStateWords 개의 마스크, 구간 수는 StateBoundaries.Num() + 1 */
+    TArray<uint64> SegmentMasks;
+
+    TArray<int32> StateNotifyIndices;
+    int32 NumStateWords = 0;
+};
+
+/** 인스턴스별로 진행 중인 Notify State, 에셋에 저장하면 같은 시퀀스를 재생하는 인스턴스끼리 상태가 섞임 */
+struct FAnimNotifyStateTracker
+{
+    UAnimSequenceBase* Asset = nullptr;
+    uint32 TimelineVersion = 0;
+
+    /** 비트 i는 Asset 타임라인의 i번째 State */
+    TArray<uint64> ActiveBits;
+
+    void Reset(UAnimSequenceBase* InAsset, uint32 InTimelineVersion, int32 NumWords);
+};
+
+enum class EAnimNotifyEventType : uint8
+{
+    Notify,
+    StateBegin,
+    StateTick,
+    StateEnd,
+};
+
+struct FAnimNotifyQueueEvent
+{
+    EAnimNotifyEventType Type = EAnimNotifyEventType::Notify;
+    UAnimNotify* Notify = nullptr;
+    UAnimNotifyState* NotifyState = nullptr;
+    UAnimSequenceBase* Animation = nullptr;
+
+    /** StateBegin: State의 길이, StateTick: 이번 프레임의 재생 시간 */
+    float Time = 0.0f;
+};
+
+/**
+ * 한 번의 애니메이션 평가 동안 발생한 Notify를 모아두었다가, 평가가 끝난 뒤 한 번에 실행합니다.
+ * Notify는 임의의 게임 로직을 실행할 수 있으므로 병렬 Tick 중에는 쌓아두기만 하고 Game Thread에서 실행합니다.
+ */
+class FAnimNotifyQueue
+{
+public:
+    void AddNotify(UAnimNotify* Notify, UAnimSequenceBase* Animation);
+    void AddStateBegin(UAnimNotifyState* NotifyState, UAnimSequenceBase* Animation, float TotalDuration);
+    void AddStateTick(UAnimNotifyState* NotifyState, UAnimSequenceBase* Animation, float DeltaTime);
+    void AddStateEnd(UAnimNotifyState* NotifyState, UAnimSequenceBase* Animation);
+
+    bool IsEmpty() const { return Events.IsEmpty(); }
+    int32 Num() const { return Events.Num(); }
+
+    /** 쌓인 Notify를 발생 순서대로 실행하고 비웁니다. 실행 중에 추가된 Notify도 함께 실행됩니다. */
+    void Dispatch(USkeletalMeshComponent* MeshComp);
+
+    void Reset() { Events.Empty(); }
+
+private:
+    TArray<FAnimNotifyQueueEvent> Events;
+};
@@ -0,0 +1,83 @@
+#include "AnimPoseCache.h"
+
+#include "AnimationRuntime.h"
+#include "ReferenceSkeleton.h"
+#include "Math/MathUtility.h"
+
+FAnimPoseCache& FAnimPoseCache::Get()
+{
+    static FAnimPoseCache Instance;
+    return Instance;
+}
+
+void FAnimPoseCache::BeginFrame()
+{
+    std::lock_guard Lock(Mutex);
+
+    int32 NumEvicted = 0;
+    for (auto It = CachedPoses.begin(); It != CachedPoses.end();)
+    {
+        // 방금 끝난 프레임에 사용되지 않은 포즈 제거, 사용 중인 컴포넌트는 shared_ptr로 계속 참조할 수 있음
+        if (It->second.LastUsedFrame < FrameNumber)
+        {
+            It = CachedPoses.erase(It);
+            ++NumEvicted;
+        }
+        else
+        {
+            ++It;
+        }
+    }
+
+    LastFrameStats.NumLookups = NumLookups;
+    LastFrameStats.NumHits = NumHits;
+    LastFrameStats.NumEntries = static_cast<int32>(CachedPoses.size());
+    LastFrameStats.NumEvicted = NumEvicted;
+    NumLookups = 0;
+    NumHits = 0;
+
+    ++FrameNumber;
+}
+
+int32 FAnimPoseCache::QuantizeTime(float Time) const
+{
+    return FMath::RoundToInt(Time / TimeStep);
+}
+
+void FAnimPoseCache::SetTimeStep(float InTimeStep)
+{
+    std::lock_guard Lock(Mutex);
+
+    TimeStep = FMath::Max(InTimeStep, KINDA_SMALL_NUMBER);
+    CachedPoses.clear();
+}
+
+std::shared_ptr<const FAnimPoseCacheEntry> FAnimPoseCache::FindOrEvaluate(const FAnimPoseCacheKey& Key, const FReferenceSkeleton& RefSkeleton, const FEvaluateFunction& Evaluate)
+{
+    {
+        std::lock_guard Lock(Mutex);
+
+        ++NumLookups;
+        if (auto It = CachedPoses.find(Key); It != CachedPoses.end())
+        {
+            ++NumHits;
+            It->second.LastUsedFrame = FrameNumber;
+            return It->second.Entry;
+        }
+    }
+
+    // 평가는 락 밖에서 수행, 다른 스레드가 같은 포즈를 동시에 평가했다면 먼저 등록된 것을 사용
+    std::shared_ptr<FAnimPoseCacheEntry> NewEntry = std::make_shared<FAnimPoseCacheEntry>();
+    Evaluate(static_cast<float>(Key.QuantizedTime) * TimeStep, *NewEntry);
+    FAnimationRuntime::FillComponentSpaceMatrices(RefSkeleton, NewEntry->LocalPose, NewEntry->ComponentSpaceMatrices);
+
+    std::lock_guard Lock(Mutex);
+
+    auto [It, bInserted] = CachedPoses.try_emplace(Key);
+    if (bInserted)
+    {
+        It->second.Entry = std::move(NewEntry);
+    }
+    It->second.LastUsedFrame = FrameNumber;
+    return It->second.Entry;
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Transform.h"
+
+class USkeleton;
+class UAnimSequence;
+struct FReferenceSkeleton;
+
+/** 같은 포즈가 나오는 조건, 시간은 FAnimPoseCache::TimeStep 단위로 양자화됨 */
+struct FAnimPoseCacheKey
+{
+    const USkeleton* Skeleton = nullptr;
+    const UAnimSequence* Sequence = nullptr;
+    int32 QuantizedTime = 0;
+
+    /** Bone LOD마다 평가하는 본이 다르므로 따로 저장 */
+    int32 BoneLOD = 0;
+
+    bool operator==(const FAnimPoseCacheKey& Other) const
+    {
+        return Skeleton == Other.Skeleton && Sequence == Other.Sequence && QuantizedTime == Other.QuantizedTime && BoneLOD == Other.BoneLOD;
+    }
+};
+
+template <>
+struct std::hash<FAnimPoseCacheKey>
+{
+    size_t operator()(const FAnimPoseCacheKey& Key) const noexcept
+    {
+        size_t Hash = std::hash<const void*>()(Key.Skeleton);
+        Hash = Hash * 31 + std::hash<const void*>()(Key.Sequence);
+        Hash = Hash * 31 + std::hash<int32>()(Key.QuantizedTime);
+        Hash = Hash * 31 + std::hash<int32>()(Key.BoneLOD);
+        return Hash;
+    }
+};
+
+/** 공유되는 포즈, 캐시에 등록된 뒤에는 수정하지 않음 */
+struct FAnimPoseCacheEntry
+{
+    /** 부모 기준 본 Transform */
+    TArray<FTransform> LocalPose;
+
+    /** 컴포넌트 공간의 본 행렬, USkeletalMeshComponent::GetCurrentGlobalBoneMatrices와 같음 */
+    TArray<FMatrix> ComponentSpaceMatrices;
+};
+
+struct FAnimPoseCacheStats
+{
+    int32 NumLookups = 0;
+    int32 NumHits = 0;
+    int32 NumEntries = 0;
+    int32 NumEvicted = 0;
+
+    float GetHitRate() const { return NumLookups > 0 ? static_cast<float>(NumHits) / static_cast<float>(NumLookups) : 0.0f; }
+};
+
+/**
+ * 같은 스켈레톤으로 같은 애니메이션을 같은 시간에 재생하는 Skeletal Mesh들이 포즈를 공유하기 위한 캐시
+ *
+ * 포즈는 처음 요청한 컴포넌트가 한 번만 평가하고, 나머지 컴포넌트는 읽기 전용으로 받아 씁니다.
+ * 한 프레임 동안 아무도 사용하지 않은 포즈는 다음 프레임 시작 시 제거합니다.
+ * 병렬 Tick 중에 호출해도 안전합니다.
+ */
+class FAnimPoseCache
+{
+public:
+    using FEvaluateFunction = std::function<void(float /*QuantizedTime*/, FAnimPoseCacheEntry& /*OutEntry*/)>;
+
+    static FAnimPoseCache& Get();
+
+    /** 이전 프레임의 통계를 확정하고, 이전 프레임에 사용되지 않은 포즈를 제거합니다. */
+    void BeginFrame();
+
+    int32 QuantizeTime(float Time) const;
+
+    /**
+     * Key에 해당하는 포즈를 찾고, 없다면 Evaluate로 평가하여 등록합니다.
+     * Evaluate는 양자화된 시간을 받아 LocalPose만 채우면 되며, ComponentSpaceMatrices는 캐시가 계산합니다.
+     */
+    std::shared_ptr<const FAnimPoseCacheEntry> FindOrEvaluate(const FAnimPoseCacheKey& Key, const FReferenceSkeleton& RefSkeleton, const FEvaluateFunction& Evaluate);
+
+    /** 양자화 간격(초), 작을수록 정확하지만 공유되는 포즈가 줄어듦 */
+    float GetTimeStep() const { return TimeStep; }
+    void SetTimeStep(float InTimeStep);
+
+    const FAnimPoseCacheStats& GetLastFrameStats() const { return LastFrameStats; }
+
+private:
+    FAnimPoseCache() = default;
+
+    struct FCachedPose
+    {
+        std::shared_ptr<const FAnimPoseCacheEntry> Entry;
+        uint64 LastUsedFrame = 0;
+    };
+
+    std::mutex Mutex;
+    std::unordered_map<FAnimPoseCacheKey, FCachedPose> CachedPoses;
+    uint64 FrameNumber = 0;
+
+    float TimeStep = 1.0f / 60.0f;
+
+    int32 NumLookups = 0;
+    int32 NumHits = 0;
+    FAnimPoseCacheStats LastFrameStats;
+};
@@ -31,6 +31,12 @@ void UAnimSequence::GetBonePose(FPoseContext& OutPoseContext, const FAnimExtract
 
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
+        // Bone LOD로 제외된 본은 호출자가 채워둔 Reference Pose를 유지
+        if (!OutPoseContext.IsBoneRequired(BoneIndex))
+        {
+            continue;
+        }
+
         FTransform BoneTransform = OutPoseContext.Pose[BoneIndex];
         OutPoseContext.Pose[BoneIndex] = BoneTransform * DataModel->EvaluateBoneTrackTransform(DataModel->FindBoneTrackByIndex(BoneIndex)->Name, FrameTime, EAnimInterpolationType::Linear);
     }
@@ -1,6 +1,8 @@
 
 #include "AnimSequenceBase.h"
 
+#include <bit>
+
 #include "UObject/ObjectFactory.h"
 #include "Animation/AnimData/AnimDataModel.h"
 #include "Developer/AnimDataController/AnimDataController.h"
@@ -84,6 +86,7 @@ bool UAnimSequenceBase::RemoveNotifyTrack(int32 TrackIndexToRemove)
         }
     }
     AnimNotifyTracks.RemoveAt(TrackIndexToRemove);
+    RebuildNotifyTimeline();
     return true;
 }
 
@@ -130,6 +133,7 @@ bool UAnimSequenceBase::AddNotifyEvent(int32 TargetTrackIndex, float Time, float
 
     AnimNotifyTracks[TargetTrackIndex].NotifyIndices.Add(NewIndex);
     OutNewNotifyIndex = NewIndex;
+    RebuildNotifyTimeline();
 
     return true;
 }
@@ -167,6 +171,7 @@ bool UAnimSequenceBase::RemoveNotifyEvent(int32 NotifyIndexToRemove)
             }
         }
     }
+    RebuildNotifyTimeline();
     return true;
 }
 
@@ -201,6 +206,7 @@ bool UAnimSequenceBase::UpdateNotifyEvent(int32 NotifyIndexToUpdate, float NewTi
     {
         EventToUpdate.NotifyName = NewNotifyName;
     }
+    RebuildNotifyTimeline();
     return true;
 }
 
@@ -235,64 +241,124 @@ int32 UAnimSequenceBase::FindNotifyTrackIndex(const FName& TrackName) const
 }
 
 void UAnimSequenceBase::EvaluateAnimNotifies(
-    const TArray<FAnimNotifyEvent>& Notifies, float CurrentTime, float PreviousTime, float DeltaTime, USkeletalMeshComponent* MeshComp,
-    UAnimSequenceBase* AnimAsset, bool bIsLooping
+    float PreviousTime, float CurrentTime, float DeltaTime, bool bWrapped, float LoopStartTime, float LoopEndTime,
+    FAnimNotifyStateTracker& StateTracker, FAnimNotifyQueue& OutQueue
 )
 {
-    for (FAnimNotifyEvent& NotifyEvent : const_cast<TArray<FAnimNotifyEvent>&>(Notifies))
+    if (StateTracker.Asset != this || StateTracker.TimelineVersion != NotifyTimeline.GetVersion())
     {
-        const float StartTime = NotifyEvent.Time;
-        const float EndTime = NotifyEvent.GetEndTime();
-        const bool bReversed = DeltaTime < 0.0f;
+        if (StateTracker.Asset)
+        {
+            StateTracker.Asset->EndNotifyStates(StateTracker, OutQueue);
+        }
+        StateTracker.Reset(this, NotifyTimeline.GetVersion(), NotifyTimeline.GetNumStateWords());
+    }
 
-        const bool bPassed = bReversed
-            ? (PreviousTime >= StartTime && CurrentTime < StartTime)
-            : (PreviousTime <= StartTime && CurrentTime > StartTime);
+    // 여러 인스턴스가 같은 시퀀스를 병렬로 평가하므로 스레드마다 따로 사용
+    thread_local TArray<int32> NotifyIndices;
+    NotifyIndices.Empty();
 
-        const bool bInside = CurrentTime >= StartTime && CurrentTime < EndTime;
+    // 순방향은 [Previous, Current), 역방향은 (Current, Previous] 구간의 Notify가 발생
+    if (DeltaTime > 0.0f)
+    {
+        if (bWrapped)
+        {
+            NotifyTimeline.GatherNotifies(PreviousTime, true, LoopEndTime, true, false, NotifyIndices);
+            NotifyTimeline.GatherNotifies(LoopStartTime, true, CurrentTime, false, false, NotifyIndices);
+        }
+        else
+        {
+            NotifyTimeline.GatherNotifies(PreviousTime, true, CurrentTime, false, false, NotifyIndices);
+        }
+    }
+    else if (DeltaTime < 0.0f)
+    {
+        if (bWrapped)
+        {
+            NotifyTimeline.GatherNotifies(LoopStartTime, true, PreviousTime, true, true, NotifyIndices);
+            NotifyTimeline.GatherNotifies(CurrentTime, false, LoopEndTime, true, true, NotifyIndices);
+        }
+        else
+        {
+            NotifyTimeline.GatherNotifies(CurrentTime, false, PreviousTime, true, true, NotifyIndices);
+        }
+    }
 
-        if (!NotifyEvent.IsState()) 
+    for (const int32 NotifyIndex : NotifyIndices)
+    {
+        if (UAnimNotify* Notify = Notifies[NotifyIndex].Notify)
         {
-            if (bPassed || (bIsLooping && !bReversed && PreviousTime > CurrentTime && StartTime >= 0.f && StartTime < CurrentTime))
-            {
-                if (NotifyEvent.Notify)
-                {
-                    UE_LOG(ELogLevel::Display, TEXT("[Notify] Triggered: %s at Time=%.3f"), *NotifyEvent.NotifyName.ToString(), CurrentTime);
-                    NotifyEvent.Notify->Notify(MeshComp, AnimAsset);
-                }
-                NotifyEvent.bTriggered = true;
-            }
+            OutQueue.AddNotify(Notify, this);
         }
-        else 
+    }
+
+    const uint64* ActiveMask = NotifyTimeline.GetActiveStateMask(CurrentTime);
+    for (int32 Word = 0; Word < NotifyTimeline.GetNumStateWords(); ++Word)
+    {
+        const uint64 WasActive = StateTracker.ActiveBits[Word];
+        const uint64 IsActive = ActiveMask[Word];
+        StateTracker.ActiveBits[Word] = IsActive;
+
+        if ((WasActive | IsActive) == 0)
         {
-            if (bInside && !NotifyEvent.bStateActive)
+            continue;
+        }
+
+        auto ForEachState = [this, Word](uint64 Bits, auto&& Func)
+        {
+            while (Bits != 0)
             {
+                const int32 StateBit = Word * 64 + std::countr_zero(Bits);
+                Bits &= Bits - 1;
+
+                const FAnimNotifyEvent& NotifyEvent = Notifies[NotifyTimeline.GetStateNotifyIndex(StateBit)];
                 if (NotifyEvent.NotifyState)
                 {
-                    UE_LOG(ELogLevel::Display, TEXT("[Notify] Begin: %s at Time=%.3f"), *NotifyEvent.NotifyName.ToString(), CurrentTime);
-                    NotifyEvent.NotifyState->NotifyBegin(MeshComp, AnimAsset, NotifyEvent.Duration);
+                    Func(NotifyEvent);
                 }
-                NotifyEvent.bStateActive = true;
             }
-            else if (bInside && NotifyEvent.bStateActive)
+        };
+
+        ForEachState(WasActive & ~IsActive, [this, &OutQueue](const FAnimNotifyEvent& NotifyEvent)
+        {
+            OutQueue.AddStateEnd(NotifyEvent.NotifyState, this);
+        });
+        ForEachState(IsActive & ~WasActive, [this, &OutQueue](const FAnimNotifyEvent& NotifyEvent)
+        {
+            OutQueue.AddStateBegin(NotifyEvent.NotifyState, this, NotifyEvent.Duration);
+        });
+        ForEachState(IsActive & WasActive, [this, &OutQueue, DeltaTime](const FAnimNotifyEvent& NotifyEvent)
+        {
+            OutQueue.AddStateTick(NotifyEvent.NotifyState, this, DeltaTime);
+        });
+    }
+}
+
+void UAnimSequenceBase::EndNotifyStates(FAnimNotifyStateTracker& StateTracker, FAnimNotifyQueue& OutQueue)
+{
+    // Notify가 수정되어 타임라인이 다시 만들어졌다면 비트가 가리키는 State를 알 수 없으므로 버림
+    if (StateTracker.Asset == this && StateTracker.TimelineVersion == NotifyTimeline.GetVersion())
+    {
+        for (int32 StateBit = 0; StateBit < NotifyTimeline.GetNumStates(); ++StateBit)
+        {
+            if ((StateTracker.ActiveBits[StateBit / 64] & (1ull << (StateBit % 64))) == 0)
             {
-                if (NotifyEvent.NotifyState)
-                {
-                    UE_LOG(ELogLevel::Display, TEXT("[Notify] Tick: %s at Time=%.3f"), *NotifyEvent.NotifyName.ToString(), CurrentTime);
-                    NotifyEvent.NotifyState->NotifyTick(MeshComp, AnimAsset, DeltaTime);
-                }
+                continue;
             }
-            else if (!bInside && NotifyEvent.bStateActive)
+
+            if (UAnimNotifyState* NotifyState = Notifies[NotifyTimeline.GetStateNotifyIndex(StateBit)].NotifyState)
             {
-                if (NotifyEvent.NotifyState)
-                {
-                    UE_LOG(ELogLevel::Display, TEXT("[Notify] End: %s at Time=%.3f"), *NotifyEvent.NotifyName.ToString(), CurrentTime);
-                    NotifyEvent.NotifyState->NotifyEnd(MeshComp, AnimAsset);
-                }
-                NotifyEvent.bStateActive = false;
+                OutQueue.AddStateEnd(NotifyState, this);
             }
         }
     }
+
+    StateTracker.Reset(nullptr, 0, 0);
+}
+
+void UAnimSequenceBase::RebuildNotifyTimeline()
+{
+    NotifyTimeline.Build(Notifies);
 }
 
 void UAnimSequenceBase::SerializeAsset(FArchive& Ar)
@@ -336,6 +402,9 @@ void UAnimSequenceBase::SerializeAsset(FArchive& Ar)
 
             GetController().SetBoneTrackKeys(BoneName, PositionalKeys, RotationalKeys, ScalingKeys);
         }
+
+        // 에셋에는 원본 Track만 저장하고, 런타임 평가용 압축 데이터는 로드할 때 만듦
+        GetDataModel()->CompressAnimation();
     }
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "AnimationAsset.h"
+#include "AnimNotifyQueue.h"
 
 class UAnimDataController;
 class UAnimDataModel;
@@ -50,10 +51,28 @@ public:
     bool UpdateNotifyEvent(int32 NotifyIndexToUpdate, float NewTime, float NewDuration, int32 NewTrackIndex, const FName& NewNotifyName = NAME_None);
     FAnimNotifyEvent* GetNotifyEvent(int32 NotifyIndex);
     const FAnimNotifyEvent* GetNotifyEvent(int32 NotifyIndex) const;
-    void EvaluateAnimNotifies(const TArray<FAnimNotifyEvent>& Notifies, float CurrentTime, float PreviousTime, float DeltaTime, USkeletalMeshComponent* MeshComp, UAnimSequenceBase* AnimAsset, bool bIsLooping);
+
+    /**
+     * PreviousTime에서 CurrentTime까지 재생하는 동안 발생한 Notify를 OutQueue에 추가합니다.
+     * bWrapped라면 루프 구간 [LoopStartTime, LoopEndTime]의 끝을 지나 반대쪽 끝에서 다시 재생한 것입니다.
+     */
+    void EvaluateAnimNotifies(
+        float PreviousTime, float CurrentTime, float DeltaTime, bool bWrapped, float LoopStartTime, float LoopEndTime,
+        FAnimNotifyStateTracker& StateTracker, FAnimNotifyQueue& OutQueue
+    );
+
+    /** StateTracker에서 진행 중인 Notify State를 모두 끝냅니다. */
+    void EndNotifyStates(FAnimNotifyStateTracker& StateTracker, FAnimNotifyQueue& OutQueue);
+
+    const FAnimNotifyTimeline& GetNotifyTimeline() const { return NotifyTimeline; }
+
+    /** Notifies를 직접 수정했다면 호출해야 합니다. Notify 편집 함수들은 자동으로 호출합니다. */
+    void RebuildNotifyTimeline();
     
     virtual void SerializeAsset(FArchive& Ar) override;
 
 private:
     void CreateModel();
+
+    FAnimNotifyTimeline NotifyTimeline;
 };
@@ -6,6 +6,7 @@
 #include "Animation/AnimTypes.h"
 #include "Animation/Skeleton.h"
 #include "Animation/AnimData/AnimDataModel.h"
+#include "Animation/AnimPoseCache.h"
 #include "Animation/AnimSequence.h"
 #include "Engine/SkeletalMesh.h"
 #include "Misc/FrameTime.h"
@@ -30,6 +31,11 @@ void UAnimSingleNodeInstance::SetAnimationAsset(UAnimationAsset* NewAsset, bool
     if (NewAsset != CurrentAsset)
     {
         CurrentAsset = NewAsset;
+
+        if (NotifyStateTracker.Asset)
+        {
+            NotifyStateTracker.Asset->EndNotifyStates(NotifyStateTracker, GetNotifyQueue());
+        }
     }
 
     USkeletalMeshComponent* MeshComponent = GetSkelMeshComponent();
@@ -96,8 +102,10 @@ void UAnimSingleNodeInstance::NativeUpdateAnimation(float DeltaSeconds, FPoseCon
 
         PreviousTime = ElapsedTime;
         ElapsedTime += DeltaPlayTime;
-        
-        AnimSequence->EvaluateAnimNotifies(AnimSequence->Notifies, ElapsedTime, PreviousTime, DeltaPlayTime, SkeletalMeshComp, AnimSequence, bLooping);
+
+        // Notify는 루프 구간 안의 시간으로 평가
+        float NotifyTime = ElapsedTime;
+        bool bWrapped = false;
         
         // 루프 처리
         if (IsLooping())
@@ -105,10 +113,14 @@ void UAnimSingleNodeInstance::NativeUpdateAnimation(float DeltaSeconds, FPoseCon
             if (ElapsedTime > EndTime)
             {
                 ElapsedTime = StartTime + FMath::Fmod(ElapsedTime - StartTime, EndTime - StartTime);
+                NotifyTime = ElapsedTime;
+                bWrapped = DeltaPlayTime > 0.0f;
             }
             else if (ElapsedTime <= StartTime)
             {
                 ElapsedTime = EndTime - FMath::Fmod(EndTime - ElapsedTime, EndTime - StartTime);
+                NotifyTime = ElapsedTime;
+                bWrapped = DeltaPlayTime < 0.0f;
             }
         }
         else
@@ -116,32 +128,71 @@ void UAnimSingleNodeInstance::NativeUpdateAnimation(float DeltaSeconds, FPoseCon
             if (!bReverse && ElapsedTime >= EndTime)
             {
                 ElapsedTime = StartTime;
+                NotifyTime = EndTime;
                 SkeletalMeshComp->SetPlaying(false);
             }
             else if (bReverse && ElapsedTime <= StartTime)
             {
                 ElapsedTime = EndTime;
+                NotifyTime = StartTime;
                 SkeletalMeshComp->SetPlaying(false);
             }
         }
+
+        // 발생한 Notify는 Queue에 쌓아두고 포즈 평가가 끝난 뒤 UAnimInstance::TriggerAnimNotifies에서 실행
+        AnimSequence->EvaluateAnimNotifies(PreviousTime, NotifyTime, DeltaPlayTime, bWrapped, StartTime, EndTime, NotifyStateTracker, GetNotifyQueue());
     }
 
-    // 본 트랜스폼 보간
-    float TargetKeyFrame = ElapsedTime * static_cast<float>(FrameRate);
-    const int32 CurrentFrame = static_cast<int32>(TargetKeyFrame) % (NumberOfFrames - 1);
-    float Alpha = TargetKeyFrame - static_cast<float>(CurrentFrame);
-    FFrameTime FrameTime(CurrentFrame, Alpha);
-    
-    CurrentKey = CurrentFrame;
-    
     const FReferenceSkeleton& RefSkeleton = GetCurrentSkeleton()->GetReferenceSkeleton();
 
-    // TODO: 인덱스 말고 맵을 통해 FName으로 포즈 계산
-    for (int32 BoneIdx = 0; BoneIdx < RefSkeleton.RawRefBoneInfo.Num(); ++BoneIdx)
+    // 본 트랜스폼 보간
+    auto EvaluatePose = [&](float Time, auto& OutBones)
+    {
+        float TargetKeyFrame = Time * static_cast<float>(FrameRate);
+        const int32 CurrentFrame = static_cast<int32>(TargetKeyFrame) % (NumberOfFrames - 1);
+        float Alpha = TargetKeyFrame - static_cast<float>(static_cast<int32>(TargetKeyFrame));
+        FFrameTime FrameTime(CurrentFrame, Alpha);
+
+        // TODO: 인덱스 말고 맵을 통해 FName으로 포즈 계산
+        for (int32 BoneIdx = 0; BoneIdx < RefSkeleton.RawRefBoneInfo.Num(); ++BoneIdx)
+        {
+            FName BoneName = RefSkeleton.RawRefBoneInfo[BoneIdx].Name;
+            FTransform RefBoneTransform = RefSkeleton.RawRefBonePose[BoneIdx];
+            if (!OutPose.IsBoneRequired(BoneIdx))
+            {
+                OutBones[BoneIdx] = RefBoneTransform;
+                continue;
+            }
+            OutBones[BoneIdx] = RefBoneTransform * DataModel->EvaluateBoneTrackTransform(BoneName, FrameTime, EAnimInterpolationType::Linear);
+        }
+    };
+
+    CurrentKey = static_cast<int32>(ElapsedTime * static_cast<float>(FrameRate)) % (NumberOfFrames - 1);
+
+    if (SkeletalMeshComp->bUseSharedPoseCache)
     {
-        FName BoneName = RefSkeleton.RawRefBoneInfo[BoneIdx].Name;
-        FTransform RefBoneTransform = RefSkeleton.RawRefBonePose[BoneIdx];
-        OutPose.Pose[BoneIdx] = RefBoneTransform * DataModel->EvaluateBoneTrackTransform(BoneName, FrameTime, EAnimInterpolationType::Linear);
+        FAnimPoseCache& PoseCache = FAnimPoseCache::Get();
+
+        FAnimPoseCacheKey Key;
+        Key.Skeleton = GetCurrentSkeleton();
+        Key.Sequence = AnimSequence;
+        Key.QuantizedTime = PoseCache.QuantizeTime(ElapsedTime);
+        Key.BoneLOD = OutPose.RequiredBones ? SkeletalMeshComp->GetBoneLOD() : 0;
+
+        std::shared_ptr<const FAnimPoseCacheEntry> SharedPose = PoseCache.FindOrEvaluate(Key, RefSkeleton, [&](float QuantizedTime, FAnimPoseCacheEntry& OutEntry)
+        {
+            OutEntry.LocalPose.SetNum(RefSkeleton.RawRefBoneInfo.Num());
+            EvaluatePose(QuantizedTime, OutEntry.LocalPose);
+        });
+
+        for (int32 BoneIdx = 0; BoneIdx < SharedPose->LocalPose.Num(); ++BoneIdx)
+        {
+            OutPose.Pose[BoneIdx] = SharedPose->LocalPose[BoneIdx];
+        }
+        SkeletalMeshComp->SetSharedPose(std::move(SharedPose));
+        return;
     }
+
+    EvaluatePose(ElapsedTime, OutPose.Pose);
 #pragma endregion
 }
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "AnimInstance.h"
+#include "AnimNotifyQueue.h"
 #include "UObject/ObjectMacros.h"
 
 
@@ -123,4 +124,6 @@ private:
     int32 LoopEndFrame;
 
     int CurrentKey;
+
+    FAnimNotifyStateTracker NotifyStateTracker;
 };
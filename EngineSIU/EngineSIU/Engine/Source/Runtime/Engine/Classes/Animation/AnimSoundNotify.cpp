@@ -1,5 +1,6 @@
 #include "AnimSoundNotify.h"
 #include "SoundManager.h"
+#include "Components/SkeletalMeshComponent.h"
 
 UAnimSoundNotify::UAnimSoundNotify()
 {
@@ -9,6 +10,13 @@ UAnimSoundNotify::UAnimSoundNotify()
 
 void UAnimSoundNotify::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation)
 {
-    FSoundManager::GetInstance().PlaySound(*SoundName.ToString());
+    FSoundPlayParams Params;
+    Params.Category = ESoundCategory::Footstep;
+    if (MeshComp)
+    {
+        Params.bSpatial = true;
+        Params.Location = MeshComp->GetComponentLocation();
+    }
+    FSoundManager::GetInstance().PlaySound(*SoundName.ToString(), Params);
 }
 
@@ -1,118 +1,107 @@
 #include "AnimStateMachine.h"
 
-UAnimStateMachine::UAnimStateMachine()
+#include "Container/Map.h"
+#include "Math/MathUtility.h"
+
+namespace
 {
-    CurrentState = EAnimState::AS_Idle;
-    MoveSpeed = 0;
-    bIsDancing = false;
+    constexpr float MaxMoveSpeed = 3.0f;
+
+    /** 그래프 정의는 불변이므로 경로별로 한 번만 로드하여 공유, 실패한 경로도 기억하여 다시 읽지 않음 */
+    std::shared_ptr<const FAnimGraphDefinition> FindOrLoadDefinition(const FString& FilePath)
+    {
+        static TMap<FString, std::shared_ptr<const FAnimGraphDefinition>> LoadedDefinitions;
+        if (const std::shared_ptr<const FAnimGraphDefinition>* Found = LoadedDefinitions.Find(FilePath))
+        {
+            return *Found;
+        }
+
+        std::shared_ptr<FAnimGraphDefinition> Definition = std::make_shared<FAnimGraphDefinition>();
+        if (!Definition->LoadFromFile(FilePath))
+        {
+            Definition = nullptr;
+        }
+
+        LoadedDefinitions.Add(FilePath, Definition);
+        return Definition;
+    }
 }
 
-EAnimState UAnimStateMachine::GetState() const
+UAnimStateMachine::UAnimStateMachine()
+    : GraphNumBones(0)
+    , MoveSpeedParameter(INDEX_NONE)
+    , DanceParameter(INDEX_NONE)
+    , TargetMoveSpeed(0.f)
+    , MoveSpeedChangeRate(2.f)
 {
-    return CurrentState;
 }
 
-FString UAnimStateMachine::GetStateName(EAnimState State) const
+bool UAnimStateMachine::LoadGraph(const FString& FilePath, int32 NumBones)
 {
-    switch (State)
+    if (GraphInstance.IsValid() && GraphPath == FilePath && GraphNumBones == NumBones)
+    {
+        return true;
+    }
+
+    std::shared_ptr<const FAnimGraphDefinition> Definition = FindOrLoadDefinition(FilePath);
+    if (!Definition)
     {
-    case AS_Idle: return TEXT("Idle");
-    case AS_Dance: return TEXT("Dance");
-    case AS_SlowRun: return TEXT("SlowRun");
-    case AS_NarutoRun: return TEXT("NarutoRun");
-    case AS_FastRun: return TEXT("FastRun");
-    default: return TEXT("Unknown");
+        return false;
     }
+
+    GraphPath = FilePath;
+    InitializeGraph(Definition, NumBones);
+    return true;
+}
+
+void UAnimStateMachine::InitializeGraph(std::shared_ptr<const FAnimGraphDefinition> InDefinition, int32 NumBones)
+{
+    GraphNumBones = NumBones;
+    GraphInstance.Initialize(std::move(InDefinition), NumBones);
+
+    // 버튼으로 조작하는 파라미터, 그래프에 없다면 INDEX_NONE이 되어 무시됨
+    const FAnimGraphDefinition* Definition = GraphInstance.GetDefinition();
+    MoveSpeedParameter = Definition ? Definition->FindParameterIndex(FName(TEXT("MoveSpeed"))) : INDEX_NONE;
+    DanceParameter = Definition ? Definition->FindParameterIndex(FName(TEXT("Dance"))) : INDEX_NONE;
+    TargetMoveSpeed = GraphInstance.GetFloat(MoveSpeedParameter);
 }
 
 void UAnimStateMachine::MoveFast()
 {
-    MoveSpeed++;
-    MoveSpeed = FMath::Clamp(MoveSpeed, 0, 3);
+    TargetMoveSpeed = FMath::Clamp(FMath::RoundToFloat(TargetMoveSpeed) + 1.f, 0.f, MaxMoveSpeed);
 }
 
 void UAnimStateMachine::MoveSlow()
 {
-    MoveSpeed--;
-    MoveSpeed = FMath::Clamp(MoveSpeed, 0, 3);
+    TargetMoveSpeed = FMath::Clamp(FMath::RoundToFloat(TargetMoveSpeed) - 1.f, 0.f, MaxMoveSpeed);
 }
 
 void UAnimStateMachine::Dance()
 {
-    bIsDancing = true;
+    GraphInstance.SetFloat(DanceParameter, 1.f);
 }
 
 void UAnimStateMachine::StopDance()
 {
-    bIsDancing = false;
+    GraphInstance.SetFloat(DanceParameter, 0.f);
 }
 
-void UAnimStateMachine::ProcessState()
+void UAnimStateMachine::ProcessState(float DeltaSeconds)
 {
-    if (CurrentState == EAnimState::AS_Idle)
-    {
-        if (MoveSpeed > 0)
-        {
-            CurrentState = EAnimState::AS_SlowRun;
-        }
-    }
-    else if (CurrentState == EAnimState::AS_SlowRun)
-    {
-        if (MoveSpeed == 0)
-        {
-            CurrentState = EAnimState::AS_Idle;
-        }
-        else if (MoveSpeed == 2)
-        {
-            CurrentState = EAnimState::AS_NarutoRun;
-        }
-    }
-    else if (CurrentState == EAnimState::AS_NarutoRun)
-    {
-        if (MoveSpeed == 1)
-        {
-            CurrentState = EAnimState::AS_SlowRun;
-        }
-        else if (MoveSpeed == 3)
-        {
-            CurrentState = EAnimState::AS_FastRun;
-        }
-    }
-    else if (CurrentState == EAnimState::AS_FastRun)
-    {
-        if (MoveSpeed == 2)
-        {
-            CurrentState = EAnimState::AS_NarutoRun;
-        }
-    }
-    else if (CurrentState == EAnimState::AS_Dance)
-    {
-        if (!bIsDancing)
-        {
-            if (MoveSpeed == 0)
-            {
-                CurrentState = EAnimState::AS_Idle;
-            }
-            if (MoveSpeed == 1)
-            {
-                CurrentState = EAnimState::AS_SlowRun;
-            }
-            if (MoveSpeed == 2)
-            {
-                CurrentState = EAnimState::AS_NarutoRun;
-            }
-            if (MoveSpeed == 3)
-            {
-                CurrentState = EAnimState::AS_FastRun;           
-            }
-        }
-    }
-    if (bIsDancing)
-    {
-        CurrentState = EAnimState::AS_Dance;
-    }
-    UE_LOG(ELogLevel::Display, TEXT("Current State: %s"), *GetStateName(CurrentState));
-}
+    // Blend Space의 가중치가 튀지 않도록 목표 속도를 서서히 따라감
+    const float MoveSpeed = GraphInstance.GetFloat(MoveSpeedParameter);
+    const float MaxStep = MoveSpeedChangeRate * DeltaSeconds;
+    GraphInstance.SetFloat(MoveSpeedParameter, MoveSpeed + FMath::Clamp(TargetMoveSpeed - MoveSpeed, -MaxStep, MaxStep));
 
+    GraphInstance.Update(DeltaSeconds);
+}
 
+void UAnimStateMachine::Evaluate(FPoseContext& OutPose, const TArray<FTransform>& RefPose)
+{
+    GraphInstance.Evaluate(OutPose, RefPose);
+}
 
+FString UAnimStateMachine::GetCurrentStateName() const
+{
+    return GraphInstance.GetCurrentStateName().ToString();
+}
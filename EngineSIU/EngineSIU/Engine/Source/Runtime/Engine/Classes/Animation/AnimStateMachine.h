@@ -1,15 +1,14 @@
 #pragma once
-#include<UObject/Object.h>
+#include <memory>
+
+#include "AnimGraph.h"
+#include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
-enum EAnimState
-{
-    AS_Idle,
-    AS_Dance,
-    AS_SlowRun,
-    AS_NarutoRun,
-    AS_FastRun,
-};
+/**
+ * JSON으로 정의된 애니메이션 그래프를 실행합니다.
+ * 같은 경로의 그래프 정의는 모든 인스턴스가 공유하고, 재생 상태와 파라미터만 인스턴스별로 가집니다.
+ */
 class UAnimStateMachine : public UObject
 {
     DECLARE_CLASS(UAnimStateMachine, UObject)
@@ -17,17 +16,39 @@ class UAnimStateMachine : public UObject
     public:
     UAnimStateMachine();
     virtual ~UAnimStateMachine() override = default;
-    void ProcessState();
+
+    /** FilePath의 그래프를 NumBones개의 본에 대해 초기화합니다. 이미 같은 그래프로 초기화되어 있다면 무시합니다. */
+    bool LoadGraph(const FString& FilePath, int32 NumBones);
+
+    /** 직접 만든 그래프 정의로 초기화합니다. */
+    void InitializeGraph(std::shared_ptr<const FAnimGraphDefinition> InDefinition, int32 NumBones);
+
+    void ProcessState(float DeltaSeconds);
+    void Evaluate(FPoseContext& OutPose, const TArray<FTransform>& RefPose);
+
+    /** MoveSpeed 파라미터의 목표값을 한 단계 올리거나 내립니다. 실제 값은 목표값을 따라 부드럽게 변합니다. */
     void MoveFast();
     void MoveSlow();
+
+    /** Dance 파라미터를 설정합니다. */
     void Dance();
     void StopDance();
-    
-    FString GetStateName(EAnimState State) const;
-    EAnimState GetState() const;
-    
+
+    FAnimGraphInstance& GetGraphInstance() { return GraphInstance; }
+    const FAnimGraphInstance& GetGraphInstance() const { return GraphInstance; }
+
+    FString GetCurrentStateName() const;
+
     private:
-    EAnimState CurrentState;
-    int MoveSpeed;
-    bool bIsDancing;
+    FAnimGraphInstance GraphInstance;
+    FString GraphPath;
+    int32 GraphNumBones;
+
+    int32 MoveSpeedParameter;
+    int32 DanceParameter;
+
+    float TargetMoveSpeed;
+
+    /** 초당 MoveSpeed 변화량 */
+    float MoveSpeedChangeRate;
 };
@@ -19,9 +19,6 @@ struct FAnimNotifyEvent
     class UAnimNotify* Notify = nullptr;             
     class UAnimNotifyState* NotifyState = nullptr;
 
-    bool bTriggered = false; 
-    bool bStateActive = false;
-    
     bool IsState() const { return Duration > 0.f; }
     float GetEndTime() const { return Time + Duration;}
     UAnimNotify* GetNotify() const { return Notify; }
@@ -0,0 +1,95 @@
+#include "AnimUpdateRateManager.h"
+
+#include "Math/MathUtility.h"
+
+FAnimUpdateRateManager& FAnimUpdateRateManager::Get()
+{
+    static FAnimUpdateRateManager Instance;
+    return Instance;
+}
+
+void FAnimUpdateRateManager::BeginFrame(const FVector& InViewLocation, const FMatrix& InView, const FMatrix& InProjection)
+{
+    LastFrameStats.NumComponents = NumComponents.exchange(0);
+    LastFrameStats.NumEvaluated = NumEvaluated.exchange(0);
+    LastFrameStats.NumInterpolated = NumInterpolated.exchange(0);
+    LastFrameStats.NumSkipped = NumSkipped.exchange(0);
+    LastFrameStats.NumSkinningSkipped = NumSkinningSkipped.exchange(0);
+    LastFrameStats.NumBonesSkipped = NumBonesSkipped.exchange(0);
+
+    ViewLocation = InViewLocation;
+    View = InView;
+    Projection = InProjection;
+    bHasView = true;
+}
+
+float FAnimUpdateRateManager::ComputeScreenSize(const FVector& Center, float Radius) const
+{
+    if (!bHasView)
+    {
+        return 1.0f;
+    }
+
+    const float ScreenMultiple = FMath::Max(Projection.M[0][0], Projection.M[1][1]);
+
+    // 원근 투영은 거리에 반비례, 직교 투영은 거리와 무관
+    const bool bPerspective = Projection.M[2][3] != 0.0f;
+    const float Distance = bPerspective ? FMath::Max((Center - ViewLocation).Length(), 1.0f) : 1.0f;
+    return ScreenMultiple * Radius / Distance;
+}
+
+bool FAnimUpdateRateManager::IsSphereInView(const FVector& Center, float Radius) const
+{
+    return !bHasView || IsSphereInView(Center, Radius, View, Projection);
+}
+
+bool FAnimUpdateRateManager::IsSphereInView(const FVector& Center, float Radius, const FMatrix& View, const FMatrix& Projection)
+{
+    const FVector ViewSpaceCenter = View.TransformPosition(Center);
+    const float ScaleX = Projection.M[0][0];
+    const float ScaleY = Projection.M[1][1];
+
+    if (Projection.M[2][3] == 0.0f)
+    {
+        // 직교 투영: 보이는 영역은 [-1/Scale, 1/Scale]
+        return FMath::Abs(ViewSpaceCenter.X) * ScaleX <= 1.0f + Radius * ScaleX
+            && FMath::Abs(ViewSpaceCenter.Y) * ScaleY <= 1.0f + Radius * ScaleY;
+    }
+
+    if (ViewSpaceCenter.Z < -Radius)
+    {
+        return false;
+    }
+
+    // 측면 평면 Scale * |x| = z 까지의 거리가 반지름보다 크면 밖에 있음
+    const float DistanceX = (FMath::Abs(ViewSpaceCenter.X) * ScaleX - ViewSpaceCenter.Z) * FMath::InvSqrt(ScaleX * ScaleX + 1.0f);
+    const float DistanceY = (FMath::Abs(ViewSpaceCenter.Y) * ScaleY - ViewSpaceCenter.Z) * FMath::InvSqrt(ScaleY * ScaleY + 1.0f);
+    return DistanceX <= Radius && DistanceY <= Radius;
+}
+
+void FAnimUpdateRateManager::AddComponentStats(bool bEvaluated, bool bInterpolated, bool bSkinningSkipped, int32 InNumBonesSkipped)
+{
+    NumComponents.fetch_add(1, std::memory_order_relaxed);
+    if (bEvaluated)
+    {
+        NumEvaluated.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (bInterpolated)
+    {
+        NumInterpolated.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        NumSkipped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (bSkinningSkipped)
+    {
+        NumSkinningSkipped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (InNumBonesSkipped > 0)
+    {
+        NumBonesSkipped.fetch_add(InNumBonesSkipped, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+/** 한 프레임 동안 Skeletal Mesh들의 애니메이션 갱신 결과 */
+struct FAnimUpdateRateStats
+{
+    int32 NumComponents = 0;
+
+    /** 포즈를 새로 평가한 컴포넌트 수 */
+    int32 NumEvaluated = 0;
+
+    /** 평가를 건너뛰고 이전 평가 결과 사이를 보간한 컴포넌트 수 */
+    int32 NumInterpolated = 0;
+
+    /** 평가를 건너뛰고 이전 포즈를 그대로 사용한 컴포넌트 수 */
+    int32 NumSkipped = 0;
+
+    /** 화면 밖이라 Skinning을 건너뛴 컴포넌트 수 */
+    int32 NumSkinningSkipped = 0;
+
+    /** Bone LOD 때문에 평가하지 않은 본 수 */
+    int32 NumBonesSkipped = 0;
+
+    int32 GetNumEvaluationsSaved() const { return NumInterpolated + NumSkipped; }
+};
+
+/**
+ * Skeletal Mesh의 애니메이션 Update Rate Optimization에 필요한 시점 정보와 통계를 관리합니다.
+ * 시점 정보는 프레임 시작 시 한 번 설정되고 Tick 동안에는 읽기만 하므로, 병렬 Tick 중에 접근해도 안전합니다.
+ */
+class FAnimUpdateRateManager
+{
+public:
+    static FAnimUpdateRateManager& Get();
+
+    /** 이전 프레임의 통계를 확정하고, 이번 프레임에 사용할 시점을 설정합니다. */
+    void BeginFrame(const FVector& InViewLocation, const FMatrix& InView, const FMatrix& InProjection);
+
+    bool HasView() const { return bHasView; }
+    const FVector& GetViewLocation() const { return ViewLocation; }
+
+    /** 구가 화면 높이에서 차지하는 비율 */
+    float ComputeScreenSize(const FVector& Center, float Radius) const;
+
+    bool IsSphereInView(const FVector& Center, float Radius) const;
+
+    /** 구가 View, Projection으로 정의된 절두체의 측면 안쪽에 있는지 여부, Near/Far 평면은 검사하지 않음 */
+    static bool IsSphereInView(const FVector& Center, float Radius, const FMatrix& View, const FMatrix& Projection);
+
+    void AddComponentStats(bool bEvaluated, bool bInterpolated, bool bSkinningSkipped, int32 NumBonesSkipped);
+
+    /** 마지막으로 완료된 프레임의 통계 */
+    const FAnimUpdateRateStats& GetLastFrameStats() const { return LastFrameStats; }
+
+private:
+    FAnimUpdateRateManager() = default;
+
+    FVector ViewLocation;
+    FMatrix View;
+    FMatrix Projection;
+    bool bHasView = false;
+
+    std::atomic<int32> NumComponents = 0;
+    std::atomic<int32> NumEvaluated = 0;
+    std::atomic<int32> NumInterpolated = 0;
+    std::atomic<int32> NumSkipped = 0;
+    std::atomic<int32> NumSkinningSkipped = 0;
+    std::atomic<int32> NumBonesSkipped = 0;
+
+    FAnimUpdateRateStats LastFrameStats;
+};
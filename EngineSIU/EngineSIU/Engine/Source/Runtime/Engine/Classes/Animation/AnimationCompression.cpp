@@ -0,0 +1,493 @@
+#include "AnimationCompression.h"
+
+#include <algorithm>
+
+#include "AnimTypes.h"
+#include "AnimData/AnimDataModel.h"
+#include "Math/MathUtility.h"
+#include "Math/Transform.h"
+#include "UObject/UObjectIterator.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    /** Smallest-Three 성분의 범위, 가장 큰 성분이 아닌 성분은 1/sqrt(2)를 넘을 수 없음 */
+    constexpr float QuatComponentRange = 0.70710678f;
+    constexpr uint32 QuatComponentBits = 15;
+    constexpr uint32 QuatComponentMax = (1u << QuatComponentBits) - 1;
+
+    uint32 QuantizeQuatComponent(float Value)
+    {
+        const float Normalized = (FMath::Clamp(Value, -QuatComponentRange, QuatComponentRange) + QuatComponentRange) / (2.0f * QuatComponentRange);
+        return static_cast<uint32>(FMath::RoundToInt(Normalized * static_cast<float>(QuatComponentMax)));
+    }
+
+    float DequantizeQuatComponent(uint32 Value)
+    {
+        return static_cast<float>(Value) / static_cast<float>(QuatComponentMax) * (2.0f * QuatComponentRange) - QuatComponentRange;
+    }
+
+    /** 두 회전 사이의 각도, acos를 쓰는 AngularDistance보다 작은 각도에서 정밀함 */
+    float RotationError(const FQuat& A, const FQuat& B)
+    {
+        const float Sign = (A | B) >= 0.0f ? 1.0f : -1.0f;
+        const float DiffX = A.X - Sign * B.X, DiffY = A.Y - Sign * B.Y, DiffZ = A.Z - Sign * B.Z, DiffW = A.W - Sign * B.W;
+        const float SumX = A.X + Sign * B.X, SumY = A.Y + Sign * B.Y, SumZ = A.Z + Sign * B.Z, SumW = A.W + Sign * B.W;
+        const float DiffLength = FMath::Sqrt(DiffX * DiffX + DiffY * DiffY + DiffZ * DiffZ + DiffW * DiffW);
+        const float SumLength = FMath::Sqrt(SumX * SumX + SumY * SumY + SumZ * SumZ + SumW * SumW);
+        return 4.0f * FMath::Atan2(DiffLength, SumLength);
+    }
+
+    float VectorError(const FVector& A, const FVector& B)
+    {
+        return (A - B).Length();
+    }
+
+    FVector InterpolateVector(const FVector& From, const FVector& To, float Alpha)
+    {
+        return FMath::Lerp(From, To, Alpha);
+    }
+
+    FQuat InterpolateQuat(const FQuat& From, const FQuat& To, float Alpha)
+    {
+        return FQuat::Slerp(From, To, Alpha);
+    }
+
+    /** 채널 하나의 키를 줄이는 데 필요한 연산 */
+    template <typename RawType, typename KeyType>
+    struct TChannelCodec
+    {
+        KeyType (*Encode)(const RawType&);
+        RawType (*Decode)(const KeyType&);
+        RawType (*Interpolate)(const RawType&, const RawType&, float);
+        float (*Error)(const RawType&, const RawType&);
+        RawType Identity;
+    };
+
+    FVector EncodeVector(const FVector& Value) { return Value; }
+    FVector DecodeVector(const FVector& Value) { return Value; }
+    FQuantizedQuat48 EncodeQuat(const FQuat& Value) { return FQuantizedQuat48::Encode(Value); }
+    FQuat DecodeQuat(const FQuantizedQuat48& Value) { return Value.Decode(); }
+
+    template <typename RawType, typename KeyType>
+    RawType SampleChannel(const TCompressedAnimChannel<KeyType>& Channel, const TChannelCodec<RawType, KeyType>& Codec, int32 Frame, float Alpha)
+    {
+        int32 FromKey, ToKey;
+        float KeyAlpha;
+        if (!Channel.FindKeys(Frame, Alpha, FromKey, ToKey, KeyAlpha))
+        {
+            return Codec.Identity;
+        }
+
+        const RawType From = Codec.Decode(Channel.Keys[FromKey]);
+        if (FromKey == ToKey || KeyAlpha <= 0.0f)
+        {
+            return From;
+        }
+        return Codec.Interpolate(From, Codec.Decode(Channel.Keys[ToKey]), KeyAlpha);
+    }
+
+    /**
+     * 원본 키를 양자화하고, 보간으로 복원할 수 있는 키를 제거합니다.
+     * @return 원본의 모든 프레임에서 측정한 최대 오차
+     */
+    template <typename RawType, typename KeyType>
+    float CompressChannel(
+        const TArray<RawType>& RawKeys, const TChannelCodec<RawType, KeyType>& Codec, float Tolerance, int32 MaxKeyGap,
+        TCompressedAnimChannel<KeyType>& OutChannel, FAnimCompressionStats& Stats
+    )
+    {
+        OutChannel.Frames.Empty();
+        OutChannel.Keys.Empty();
+
+        const int32 NumKeys = RawKeys.Num();
+        if (NumKeys == 0)
+        {
+            ++Stats.NumIdentityChannels;
+            return 0.0f;
+        }
+
+        bool bIdentity = true;
+        bool bConstant = true;
+        const RawType ConstantValue = Codec.Decode(Codec.Encode(RawKeys[0]));
+        for (const RawType& RawKey : RawKeys)
+        {
+            bIdentity = bIdentity && Codec.Error(RawKey, Codec.Identity) <= Tolerance;
+            bConstant = bConstant && Codec.Error(RawKey, ConstantValue) <= Tolerance;
+        }
+
+        if (bIdentity)
+        {
+            ++Stats.NumIdentityChannels;
+        }
+        else if (bConstant)
+        {
+            ++Stats.NumConstantChannels;
+            OutChannel.Keys.Add(Codec.Encode(RawKeys[0]));
+        }
+        else
+        {
+            TArray<RawType> Decoded;
+            Decoded.Reserve(NumKeys);
+            for (const RawType& RawKey : RawKeys)
+            {
+                Decoded.Add(Codec.Decode(Codec.Encode(RawKey)));
+            }
+
+            // 현재 키에서 시작하는 직선(보간) 구간을 오차 안에서 최대한 늘린 뒤, 그 끝을 다음 키로 남김
+            int32 StartFrame = 0;
+            OutChannel.Frames.Add(0);
+            OutChannel.Keys.Add(Codec.Encode(RawKeys[0]));
+            while (StartFrame < NumKeys - 1)
+            {
+                int32 EndFrame = StartFrame + 1;
+                const int32 LastCandidate = FMath::Min(NumKeys - 1, StartFrame + MaxKeyGap);
+                for (int32 Candidate = EndFrame + 1; Candidate <= LastCandidate; ++Candidate)
+                {
+                    const float InvSpan = 1.0f / static_cast<float>(Candidate - StartFrame);
+                    bool bWithinTolerance = true;
+                    for (int32 Frame = StartFrame + 1; Frame < Candidate && bWithinTolerance; ++Frame)
+                    {
+                        const RawType Interpolated = Codec.Interpolate(Decoded[StartFrame], Decoded[Candidate], static_cast<float>(Frame - StartFrame) * InvSpan);
+                        bWithinTolerance = Codec.Error(Interpolated, RawKeys[Frame]) <= Tolerance;
+                    }
+
+                    if (!bWithinTolerance)
+                    {
+                        break;
+                    }
+                    EndFrame = Candidate;
+                }
+
+                OutChannel.Frames.Add(static_cast<uint16>(EndFrame));
+                OutChannel.Keys.Add(Codec.Encode(RawKeys[EndFrame]));
+                StartFrame = EndFrame;
+            }
+        }
+
+        float MaxError = 0.0f;
+        for (int32 Frame = 0; Frame < NumKeys; ++Frame)
+        {
+            MaxError = FMath::Max(MaxError, Codec.Error(SampleChannel(OutChannel, Codec, Frame, 0.0f), RawKeys[Frame]));
+        }
+        return MaxError;
+    }
+
+    const TChannelCodec<FVector, FVector> PositionCodec{ &EncodeVector, &DecodeVector, &InterpolateVector, &VectorError, FVector(0.0f, 0.0f, 0.0f) };
+    const TChannelCodec<FQuat, FQuantizedQuat48> RotationCodec{ &EncodeQuat, &DecodeQuat, &InterpolateQuat, &RotationError, FQuat(0.0f, 0.0f, 0.0f, 1.0f) };
+    const TChannelCodec<FVector, FVector> ScaleCodec{ &EncodeVector, &DecodeVector, &InterpolateVector, &VectorError, FVector(1.0f, 1.0f, 1.0f) };
+}
+
+FQuantizedQuat48 FQuantizedQuat48::Encode(const FQuat& Quat)
+{
+    const FQuat Normalized = Quat.GetNormalized();
+    const float Components[4] = { Normalized.X, Normalized.Y, Normalized.Z, Normalized.W };
+
+    uint32 LargestIndex = 0;
+    for (uint32 Index = 1; Index < 4; ++Index)
+    {
+        if (FMath::Abs(Components[Index]) > FMath::Abs(Components[LargestIndex]))
+        {
+            LargestIndex = Index;
+        }
+    }
+
+    // q와 -q는 같은 회전이므로 가장 큰 성분이 양수가 되도록 뒤집으면 부호를 저장할 필요가 없음
+    const float Sign = Components[LargestIndex] < 0.0f ? -1.0f : 1.0f;
+
+    uint64 Packed = LargestIndex;
+    for (uint32 Index = 0; Index < 4; ++Index)
+    {
+        if (Index != LargestIndex)
+        {
+            Packed = (Packed << QuatComponentBits) | QuantizeQuatComponent(Components[Index] * Sign);
+        }
+    }
+
+    FQuantizedQuat48 Result;
+    Result.Data[0] = static_cast<uint16>(Packed >> 32);
+    Result.Data[1] = static_cast<uint16>(Packed >> 16);
+    Result.Data[2] = static_cast<uint16>(Packed);
+    return Result;
+}
+
+FQuat FQuantizedQuat48::Decode() const
+{
+    uint64 Packed = (static_cast<uint64>(Data[0]) << 32) | (static_cast<uint64>(Data[1]) << 16) | static_cast<uint64>(Data[2]);
+
+    float Components[4];
+    float SumSquared = 0.0f;
+    const uint32 LargestIndex = static_cast<uint32>(Packed >> (QuatComponentBits * 3)) & 3;
+    for (int32 Index = 3; Index >= 0; --Index)
+    {
+        if (static_cast<uint32>(Index) != LargestIndex)
+        {
+            Components[Index] = DequantizeQuatComponent(static_cast<uint32>(Packed & QuatComponentMax));
+            SumSquared += Components[Index] * Components[Index];
+            Packed >>= QuatComponentBits;
+        }
+    }
+    Components[LargestIndex] = FMath::Sqrt(FMath::Max(0.0f, 1.0f - SumSquared));
+
+    return FQuat(Components[0], Components[1], Components[2], Components[3]);
+}
+
+template <typename KeyType>
+bool TCompressedAnimChannel<KeyType>::FindKeys(int32 Frame, float Alpha, int32& OutFromKey, int32& OutToKey, float& OutKeyAlpha) const
+{
+    const int32 NumKeys = Keys.Num();
+    if (NumKeys == 0)
+    {
+        return false;
+    }
+
+    OutKeyAlpha = 0.0f;
+    if (NumKeys == 1 || Frame < 0)
+    {
+        OutFromKey = OutToKey = 0;
+        return true;
+    }
+
+    // Frame 이하인 마지막 키
+    const uint16* FramesBegin = Frames.GetData();
+    const uint16* FramesEnd = FramesBegin + Frames.Num();
+    const int32 UpperIndex = static_cast<int32>(std::upper_bound(FramesBegin, FramesEnd, static_cast<uint16>(FMath::Min(Frame, 0xFFFF))) - FramesBegin);
+    if (UpperIndex >= NumKeys)
+    {
+        OutFromKey = OutToKey = NumKeys - 1;
+        return true;
+    }
+
+    OutFromKey = UpperIndex - 1;
+    OutToKey = UpperIndex;
+
+    const float FromFrame = static_cast<float>(Frames[OutFromKey]);
+    const float ToFrame = static_cast<float>(Frames[OutToKey]);
+    OutKeyAlpha = (static_cast<float>(Frame) + Alpha - FromFrame) / (ToFrame - FromFrame);
+    return true;
+}
+
+template struct TCompressedAnimChannel<FVector>;
+template struct TCompressedAnimChannel<FQuantizedQuat48>;
+
+bool FAnimationCompression::CompressTracks(
+    const TArray<FBoneAnimationTrack>& RawTracks, int32 NumFrames, const FAnimCompressionSettings& Settings,
+    FCompressedAnimData& OutData, FAnimCompressionStats* OutStats
+)
+{
+    OutData.Reset();
+
+    // 키의 프레임 번호를 uint16으로 저장
+    if (NumFrames <= 0 || NumFrames > 0xFFFF)
+    {
+        return false;
+    }
+
+    FAnimCompressionStats Stats;
+    const int32 MaxKeyGap = FMath::Max(Settings.MaxKeyGap, 1);
+
+    OutData.Tracks.SetNum(RawTracks.Num());
+    for (int32 TrackIndex = 0; TrackIndex < RawTracks.Num(); ++TrackIndex)
+    {
+        const FRawAnimSequenceTrack& RawTrack = RawTracks[TrackIndex].InternalTrackData;
+        FCompressedBoneTrack& CompressedTrack = OutData.Tracks[TrackIndex];
+
+        if (RawTrack.PosKeys.Num() > 0x10000 || RawTrack.RotKeys.Num() > 0x10000 || RawTrack.ScaleKeys.Num() > 0x10000)
+        {
+            OutData.Reset();
+            return false;
+        }
+
+        Stats.RawBytes += static_cast<uint64>(RawTrack.PosKeys.Num()) * sizeof(FVector)
+            + static_cast<uint64>(RawTrack.RotKeys.Num()) * sizeof(FQuat)
+            + static_cast<uint64>(RawTrack.ScaleKeys.Num()) * sizeof(FVector);
+
+        const float PositionError = CompressChannel(RawTrack.PosKeys, PositionCodec, Settings.MaxPositionError, MaxKeyGap, CompressedTrack.Position, Stats);
+        const float RotationError = CompressChannel(RawTrack.RotKeys, RotationCodec, Settings.MaxRotationError, MaxKeyGap, CompressedTrack.Rotation, Stats);
+        const float ScaleError = CompressChannel(RawTrack.ScaleKeys, ScaleCodec, Settings.MaxScaleError, MaxKeyGap, CompressedTrack.Scale, Stats);
+
+        Stats.MaxPositionError = FMath::Max(Stats.MaxPositionError, PositionError);
+        Stats.MaxRotationError = FMath::Max(Stats.MaxRotationError, RotationError);
+        Stats.MaxScaleError = FMath::Max(Stats.MaxScaleError, ScaleError);
+
+        Stats.CompressedBytes += sizeof(FCompressedBoneTrack)
+            + CompressedTrack.Position.GetAllocatedBytes()
+            + CompressedTrack.Rotation.GetAllocatedBytes()
+            + CompressedTrack.Scale.GetAllocatedBytes();
+    }
+
+    if (OutStats)
+    {
+        *OutStats = Stats;
+    }
+    return true;
+}
+
+FTransform FAnimationCompression::DecompressBoneTransform(const FCompressedBoneTrack& Track, int32 Frame, float Alpha)
+{
+    return FTransform(
+        SampleChannel(Track.Rotation, RotationCodec, Frame, Alpha),
+        SampleChannel(Track.Position, PositionCodec, Frame, Alpha),
+        SampleChannel(Track.Scale, ScaleCodec, Frame, Alpha)
+    );
+}
+
+namespace
+{
+    /** UAnimDataModel::EvaluateBoneTrackTransform의 원본 경로와 같은 보간, Track 검색은 제외 */
+    FTransform SampleRawTrack(const FRawAnimSequenceTrack& Track, int32 Frame, float Alpha)
+    {
+        const FTransform From(Track.RotKeys[Frame], Track.PosKeys[Frame], Track.ScaleKeys[Frame]);
+        const FTransform To(Track.RotKeys[Frame + 1], Track.PosKeys[Frame + 1], Track.ScaleKeys[Frame + 1]);
+
+        FTransform Blend;
+        Blend.Blend(From, To, Alpha);
+        return Blend;
+    }
+
+    /** 위치는 움직이거나 상수, 회전은 천천히 돌고, 스케일은 대부분 항등값인 합성 Track */
+    void BuildSyntheticTracks(int32 NumBones, int32 NumFrames, TArray<FBoneAnimationTrack>& OutTracks)
+    {
+        OutTracks.SetNum(NumBones);
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            FBoneAnimationTrack& Track = OutTracks[BoneIndex];
+            Track.BoneTreeIndex = BoneIndex;
+            Track.Name = FName(*FString::Printf(TEXT("SyntheticBone_%d"), BoneIndex));
+
+            const bool bConstantPosition = BoneIndex % 4 != 0;
+            const bool bAnimatedScale = BoneIndex % 8 == 0;
+            const FVector Axis = FVector(FMath::Sin(static_cast<float>(BoneIndex)), 1.0f, 0.5f).GetSafeNormal();
+
+            FRawAnimSequenceTrack& RawTrack = Track.InternalTrackData;
+            RawTrack.PosKeys.SetNum(NumFrames);
+            RawTrack.RotKeys.SetNum(NumFrames);
+            RawTrack.ScaleKeys.SetNum(NumFrames);
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                const float Time = static_cast<float>(Frame) / 30.0f;
+                const float Phase = Time * 2.0f + static_cast<float>(BoneIndex);
+
+                RawTrack.PosKeys[Frame] = bConstantPosition
+                    ? FVector(0.0f, 0.0f, 10.0f)
+                    : FVector(FMath::Sin(Phase) * 5.0f, FMath::Cos(Phase) * 5.0f, 10.0f);
+                RawTrack.RotKeys[Frame] = FQuat(Axis, FMath::Sin(Phase) * 0.8f);
+                RawTrack.ScaleKeys[Frame] = bAnimatedScale
+                    ? FVector(1.0f, 1.0f, 1.0f) * (1.0f + 0.2f * FMath::Sin(Phase))
+                    : FVector(1.0f, 1.0f, 1.0f);
+            }
+        }
+    }
+
+    void RunTrackSamplingBenchmark(const TArray<FBoneAnimationTrack>& RawTracks, int32 NumFrames, int32 NumSamples, const FString& Label)
+    {
+        if (RawTracks.Num() == 0 || NumFrames < 2)
+        {
+            return;
+        }
+
+        FCompressedAnimData CompressedData;
+        FAnimCompressionStats Stats;
+        if (!FAnimationCompression::CompressTracks(RawTracks, NumFrames, FAnimCompressionSettings(), CompressedData, &Stats))
+        {
+            UE_LOG(ELogLevel::Warning, TEXT("Anim sampling bench %s: compression failed"), *Label);
+            return;
+        }
+
+        // 원본 키가 모두 있는 Track만 비교
+        TArray<int32> TrackIndices;
+        for (int32 TrackIndex = 0; TrackIndex < RawTracks.Num(); ++TrackIndex)
+        {
+            const FRawAnimSequenceTrack& Track = RawTracks[TrackIndex].InternalTrackData;
+            if (Track.PosKeys.Num() >= NumFrames && Track.RotKeys.Num() >= NumFrames && Track.ScaleKeys.Num() >= NumFrames)
+            {
+                TrackIndices.Add(TrackIndex);
+            }
+        }
+
+        // 모든 Track이 같은 시점을 샘플링, 실제 포즈 평가와 같은 순서
+        TArray<int32> SampleFrames;
+        TArray<float> SampleAlphas;
+        SampleFrames.SetNum(NumSamples);
+        SampleAlphas.SetNum(NumSamples);
+        uint32 Seed = 12345;
+        for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+            SampleFrames[SampleIndex] = static_cast<int32>(Seed % static_cast<uint32>(NumFrames - 1));
+            SampleAlphas[SampleIndex] = static_cast<float>((Seed >> 8) & 0xFFFF) / 65536.0f;
+        }
+
+        // 최적화로 샘플링이 사라지지 않도록 결과를 누적
+        float RawChecksum = 0.0f;
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+        {
+            for (const int32 TrackIndex : TrackIndices)
+            {
+                RawChecksum += SampleRawTrack(RawTracks[TrackIndex].InternalTrackData, SampleFrames[SampleIndex], SampleAlphas[SampleIndex]).GetTranslation().X;
+            }
+        }
+        const double RawMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        float CompressedChecksum = 0.0f;
+        StartCycles = FPlatformTime::Cycles64();
+        for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+        {
+            for (const int32 TrackIndex : TrackIndices)
+            {
+                CompressedChecksum += FAnimationCompression::DecompressBoneTransform(
+                    CompressedData.Tracks[TrackIndex], SampleFrames[SampleIndex], SampleAlphas[SampleIndex]
+                ).GetTranslation().X;
+            }
+        }
+        const double CompressedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        // 키 사이의 시점까지 포함한 실제 오차
+        float MaxPositionError = 0.0f;
+        float MaxRotationError = 0.0f;
+        for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+        {
+            for (const int32 TrackIndex : TrackIndices)
+            {
+                const FTransform Raw = SampleRawTrack(RawTracks[TrackIndex].InternalTrackData, SampleFrames[SampleIndex], SampleAlphas[SampleIndex]);
+                const FTransform Compressed = FAnimationCompression::DecompressBoneTransform(
+                    CompressedData.Tracks[TrackIndex], SampleFrames[SampleIndex], SampleAlphas[SampleIndex]
+                );
+                MaxPositionError = FMath::Max(MaxPositionError, VectorError(Raw.GetTranslation(), Compressed.GetTranslation()));
+                MaxRotationError = FMath::Max(MaxRotationError, RotationError(Raw.GetRotation(), Compressed.GetRotation()));
+            }
+        }
+
+        const double NumEvaluated = static_cast<double>(NumSamples) * FMath::Max(TrackIndices.Num(), 1);
+        UE_LOG(
+            ELogLevel::Display,
+            TEXT("Anim sampling bench %s (%d tracks, %d frames): %llu -> %llu bytes (x%.2f), raw %.1f ns/sample, compressed %.1f ns/sample (x%.2f), max error pos %.5f rot %.5f, checksum %.1f / %.1f"),
+            *Label, RawTracks.Num(), NumFrames,
+            static_cast<unsigned long long>(Stats.RawBytes), static_cast<unsigned long long>(Stats.CompressedBytes), Stats.GetCompressionRatio(),
+            RawMs * 1.0e6 / NumEvaluated, CompressedMs * 1.0e6 / NumEvaluated, CompressedMs > 0.0 ? RawMs / CompressedMs : 0.0,
+            MaxPositionError, MaxRotationError, RawChecksum, CompressedChecksum
+        );
+    }
+}
+
+void FAnimationCompression::RunSamplingBenchmark(int32 NumSamples)
+{
+    if (NumSamples <= 0)
+    {
+        return;
+    }
+
+    TArray<FBoneAnimationTrack> SyntheticTracks;
+    constexpr int32 SyntheticNumBones = 64;
+    constexpr int32 SyntheticNumFrames = 600;
+    BuildSyntheticTracks(SyntheticNumBones, SyntheticNumFrames, SyntheticTracks);
+    RunTrackSamplingBenchmark(SyntheticTracks, SyntheticNumFrames, NumSamples, TEXT("Synthetic"));
+
+    for (const UAnimDataModel* DataModel : TObjectRange<UAnimDataModel>())
+    {
+        const UObject* Owner = DataModel->GetOuter() ? DataModel->GetOuter() : DataModel;
+        RunTrackSamplingBenchmark(DataModel->GetBoneAnimationTracks(), DataModel->GetNumberOfKeys(), NumSamples, Owner->GetName());
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Quat.h"
+#include "Math/Vector.h"
+
+struct FBoneAnimationTrack;
+struct FTransform;
+
+/** 키 제거 시 허용하는 최대 오차 */
+struct FAnimCompressionSettings
+{
+    /** 위치 오차 (월드 단위) */
+    float MaxPositionError = 0.01f;
+
+    /** 회전 오차 (라디안) */
+    float MaxRotationError = 0.001f;
+
+    /** 스케일 오차 */
+    float MaxScaleError = 0.001f;
+
+    /** 남겨둔 두 키 사이의 최대 프레임 간격, 압축 시간을 제한하기 위해 사용 */
+    int32 MaxKeyGap = 128;
+};
+
+/** 압축 결과 보고 */
+struct FAnimCompressionStats
+{
+    uint64 RawBytes = 0;
+    uint64 CompressedBytes = 0;
+
+    /** 키가 하나도 남지 않은 (항등값인) 채널 수 */
+    int32 NumIdentityChannels = 0;
+
+    /** 키가 하나만 남은 (상수인) 채널 수 */
+    int32 NumConstantChannels = 0;
+
+    /** 원본의 모든 프레임에서 측정한 최대 오차 */
+    float MaxPositionError = 0.0f;
+    float MaxRotationError = 0.0f;
+    float MaxScaleError = 0.0f;
+
+    double GetCompressionRatio() const
+    {
+        return CompressedBytes > 0 ? static_cast<double>(RawBytes) / static_cast<double>(CompressedBytes) : 0.0;
+    }
+};
+
+/**
+ * 48비트 Smallest-Three 양자화 쿼터니언
+ *
+ * 절댓값이 가장 큰 성분은 나머지 세 성분으로 복원할 수 있으므로 Index(2비트)만 저장하고,
+ * 나머지 세 성분은 [-1/sqrt(2), 1/sqrt(2)] 범위를 15비트씩 양자화합니다.
+ */
+struct FQuantizedQuat48
+{
+    uint16 Data[3] = { 0, 0, 0 };
+
+    static FQuantizedQuat48 Encode(const FQuat& Quat);
+    FQuat Decode() const;
+};
+
+/**
+ * 하나의 채널(위치, 회전, 스케일)의 압축된 키
+ *
+ * Keys가 비어있다면 항등값, 하나라면 상수이며, 그 외에는 Frames[i] 프레임의 값이 Keys[i]입니다.
+ * 키 사이의 값은 보간하여 구합니다.
+ */
+template <typename KeyType>
+struct TCompressedAnimChannel
+{
+    TArray<uint16> Frames;
+    TArray<KeyType> Keys;
+
+    /**
+     * Frame + Alpha 시점을 감싸는 두 키를 찾습니다.
+     * @return Keys가 비어있다면 false
+     */
+    bool FindKeys(int32 Frame, float Alpha, int32& OutFromKey, int32& OutToKey, float& OutKeyAlpha) const;
+
+    uint64 GetAllocatedBytes() const
+    {
+        return static_cast<uint64>(Frames.Num()) * sizeof(uint16) + static_cast<uint64>(Keys.Num()) * sizeof(KeyType);
+    }
+};
+
+struct FCompressedBoneTrack
+{
+    TCompressedAnimChannel<FVector> Position;
+    TCompressedAnimChannel<FQuantizedQuat48> Rotation;
+    TCompressedAnimChannel<FVector> Scale;
+};
+
+/** UAnimDataModel의 모든 Bone Track을 압축한 데이터, Track의 순서는 원본과 같음 */
+struct FCompressedAnimData
+{
+    TArray<FCompressedBoneTrack> Tracks;
+
+    bool IsValid() const { return Tracks.Num() > 0; }
+    void Reset() { Tracks.Empty(); }
+};
+
+/**
+ * 애니메이션 키프레임 압축기
+ *
+ * 1. 모든 프레임이 같은 채널은 키 하나(상수)로, 그 값이 항등값이라면 키 없이 저장합니다.
+ * 2. 회전은 FQuantizedQuat48로 양자화합니다.
+ * 3. 남겨둔 키 사이를 보간한 값이 원본과 허용 오차 이내라면 중간 키를 제거합니다.
+ *    오차는 양자화된 값으로 측정하므로 양자화 오차까지 포함됩니다.
+ */
+class FAnimationCompression
+{
+public:
+    /**
+     * Track들을 압축합니다.
+     * @param NumFrames Track 하나가 가지는 키의 수
+     * @return 프레임 수가 uint16 범위를 넘는 등 압축할 수 없다면 false
+     */
+    static bool CompressTracks(
+        const TArray<FBoneAnimationTrack>& RawTracks, int32 NumFrames, const FAnimCompressionSettings& Settings,
+        FCompressedAnimData& OutData, FAnimCompressionStats* OutStats = nullptr
+    );
+
+    /** Frame + Alpha 시점의 Transform을 복원합니다. 원본의 EvaluateBoneTrackTransform과 같은 보간을 사용합니다. */
+    static FTransform DecompressBoneTransform(const FCompressedBoneTrack& Track, int32 Frame, float Alpha);
+
+    /**
+     * 합성 애니메이션과 로드된 모든 UAnimDataModel을 압축하고, 같은 시점들을 원본 키 보간과 압축 데이터 복원으로 샘플링하여
+     * 압축률, 샘플 하나당 시간, 두 결과의 최대 차이를 로그로 출력합니다.
+     * @param NumSamples Track마다 샘플링할 시점의 수
+     */
+    static void RunSamplingBenchmark(int32 NumSamples);
+};
@@ -1,5 +1,6 @@
 ﻿#include "AnimationRuntime.h"
 #include "Animation/AnimationPoseData.h"
+#include "ReferenceSkeleton.h"
 
 template<int32>
 void BlendTransform(const FTransform& Source, FTransform& Dest, const float BlendWeight);
@@ -75,3 +76,34 @@ void FAnimationRuntime::BlendTwoPosesTogether(const FAnimationPoseData& SourcePo
     // Ensure that all of the resulting rotations are normalized
     OutPose.NormalizeRotations();
 }
+
+void FAnimationRuntime::AccumulateWeightedPose(const FCompactPose& SourcePose, const float Weight, const bool bOverwrite, /*out*/ FCompactPose& ResultPose)
+{
+    if (bOverwrite)
+    {
+        BlendPose<ETransformBlendMode::Overwrite>(SourcePose, ResultPose, Weight);
+    }
+    else
+    {
+        BlendPose<ETransformBlendMode::Accumulate>(SourcePose, ResultPose, Weight);
+    }
+}
+
+void FAnimationRuntime::FillComponentSpaceMatrices(const FReferenceSkeleton& RefSkeleton, const TArray<FTransform>& LocalPose, /*out*/ TArray<FMatrix>& OutMatrices)
+{
+    const int32 BoneNum = LocalPose.Num();
+    OutMatrices.SetNum(BoneNum);
+
+    // 부모 본은 항상 자식보다 앞에 있음
+    for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+    {
+        FMatrix BoneMatrix = LocalPose[BoneIndex].ToMatrixWithScale();
+
+        const int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
+        if (ParentIndex != INDEX_NONE)
+        {
+            BoneMatrix = BoneMatrix * OutMatrices[ParentIndex];
+        }
+        OutMatrices[BoneIndex] = BoneMatrix;
+    }
+}
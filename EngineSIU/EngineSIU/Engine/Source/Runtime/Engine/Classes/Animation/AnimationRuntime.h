@@ -1,8 +1,10 @@
 ﻿#pragma once
 
 #include "BonePose.h"
+#include "Math/Matrix.h"
 
 struct FAnimationPoseData;
+struct FReferenceSkeleton;
 
 namespace ETransformBlendMode
 {
@@ -27,4 +29,20 @@ public:
     const FAnimationPoseData& SourcePoseTwoData,
     const float WeightOfPoseOne,
     /*out*/ FAnimationPoseData& OutAnimationPoseData);
+
+    /**
+     * SourcePose에 Weight를 곱해 ResultPose에 더합니다. bOverwrite라면 더하지 않고 덮어씁니다.
+     * N개의 포즈를 하나씩 섞을 때 사용하며, 모두 섞은 뒤 ResultPose.NormalizeRotations()를 호출해야 합니다.
+     */
+    static void AccumulateWeightedPose(
+        const FCompactPose& SourcePose,
+        const float Weight,
+        const bool bOverwrite,
+        /*out*/ FCompactPose& ResultPose);
+
+    /** 부모 기준 본 Transform을 부모 본들을 차례로 곱한 컴포넌트 공간 행렬로 바꿉니다. */
+    static void FillComponentSpaceMatrices(
+        const FReferenceSkeleton& RefSkeleton,
+        const TArray<FTransform>& LocalPose,
+        /*out*/ TArray<FMatrix>& OutMatrices);
 };
@@ -4,15 +4,11 @@
 #include "UObject/Casts.h"
 #include "World/World.h"
 
-UObject* UCameraComponent::Duplicate(UObject* InOuter)
+void UCameraComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->ViewFOV = ViewFOV;
-    NewComponent->NearClip = NearClip;
-    NewComponent->FarClip = FarClip;
-    
-    return NewComponent;
+    Ar << ViewFOV << NearClip << FarClip;
 }
 
 void UCameraComponent::InitializeComponent()
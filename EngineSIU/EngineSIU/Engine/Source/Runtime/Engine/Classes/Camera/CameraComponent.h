@@ -9,7 +9,7 @@ public:
 
     UCameraComponent() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
     void FollowMainPlayer();
@@ -1,17 +1,27 @@
 #include "ActorComponent.h"
 
 #include "GameFramework/Actor.h"
+#include "World/TickTaskManager.h"
+#include "World/World.h"
 
 
-UObject* UActorComponent::Duplicate(UObject* InOuter)
+void UActorComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->OwnerPrivate = OwnerPrivate;
-    NewComponent->bIsActive = bIsActive;
-    NewComponent->bAutoActive = bAutoActive;
+    Ar << OwnerPrivate;
 
-    return NewComponent;
+    uint8 Flags = static_cast<uint8>(bIsActive << 0 | bAutoActive << 1 | bCanEverTick << 2 | bRunTickOnAnyThread << 3);
+    Ar << Flags;
+    Ar.Serialize(TickGroup);
+
+    if (Ar.IsLoading())
+    {
+        bIsActive = (Flags >> 0) & 1;
+        bAutoActive = (Flags >> 1) & 1;
+        bCanEverTick = (Flags >> 2) & 1;
+        bRunTickOnAnyThread = (Flags >> 3) & 1;
+    }
 }
 
 void UActorComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -90,6 +100,10 @@ void UActorComponent::TickComponent(float DeltaTime)
 {
 }
 
+void UActorComponent::CompleteParallelTick(float DeltaTime)
+{
+}
+
 void UActorComponent::OnComponentDestroyed()
 {
 }
@@ -147,3 +161,39 @@ void UActorComponent::Deactivate()
     // TODO: Tick 멈추기
     bIsActive = false;
 }
+
+void UActorComponent::SetTickGroup(ETickingGroup InTickGroup)
+{
+    if (TickGroup == InTickGroup)
+    {
+        return;
+    }
+
+    RefreshTickRegistration([this, InTickGroup]() { TickGroup = InTickGroup; });
+}
+
+void UActorComponent::SetRunTickOnAnyThread(bool bInRunTickOnAnyThread)
+{
+    if (bRunTickOnAnyThread == bInRunTickOnAnyThread)
+    {
+        return;
+    }
+
+    RefreshTickRegistration([this, bInRunTickOnAnyThread]() { bRunTickOnAnyThread = bInRunTickOnAnyThread; });
+}
+
+void UActorComponent::RefreshTickRegistration(const TFunction<void()>& ApplyChange)
+{
+    UWorld* World = bRegisteredForTick ? GetWorld() : nullptr;
+    if (!World)
+    {
+        ApplyChange();
+        return;
+    }
+
+    // 이전 설정 기준으로 등록 해제한 뒤, 바뀐 설정으로 다시 등록
+    FTickTaskManager& TickTaskManager = World->GetTickTaskManager();
+    TickTaskManager.UnregisterComponent(this);
+    ApplyChange();
+    TickTaskManager.RegisterComponent(this);
+}
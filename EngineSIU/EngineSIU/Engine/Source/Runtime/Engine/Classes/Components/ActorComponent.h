@@ -1,5 +1,6 @@
 #pragma once
 #include "Engine/EngineTypes.h"
+#include "Templates/Function.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
@@ -15,7 +16,7 @@ private:
 public:
     UActorComponent() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     /**
 * 이 컴포넌트의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
@@ -36,9 +37,15 @@ public:
     /** 모든 초기화가 끝나고, 준비가 되었을 때 호출됩니다. */
     virtual void BeginPlay();
 
-    /** 매 틱마다 호출됩니다. */
+    /** 매 틱마다 호출됩니다. bRunTickOnAnyThread라면 Worker Thread에서 호출될 수 있습니다. */
     virtual void TickComponent(float DeltaTime);
 
+    /**
+     * bRunTickOnAnyThread인 컴포넌트의 TickComponent가 끝난 뒤, 같은 TickGroup 안에서 Game Thread로 호출됩니다.
+     * Physics 동기화처럼 Game Thread에서만 안전한 후처리를 이곳에서 수행합니다.
+     */
+    virtual void CompleteParallelTick(float DeltaTime);
+
     /** Component가 제거되었을 때 호출됩니다. */
     virtual void OnComponentDestroyed();
 
@@ -67,7 +74,38 @@ public:
     void Activate();
     void Deactivate();
 
+    /** Tick을 받을 수 있는 컴포넌트인지 여부를 반환합니다. */
+    bool CanEverTick() const { return bCanEverTick; }
+
+    /** 이 컴포넌트가 어떤 TickGroup에서 Tick되는지 반환합니다. */
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+    void SetTickGroup(ETickingGroup InTickGroup);
+
+    /** Worker Thread에서 병렬로 Tick될 수 있는지 여부를 반환합니다. */
+    bool CanRunTickOnAnyThread() const { return bRunTickOnAnyThread; }
+    void SetRunTickOnAnyThread(bool bInRunTickOnAnyThread);
+
+    /** World의 TickTaskManager에 등록되어 있는지 여부를 반환합니다. */
+    bool IsRegisteredForTick() const { return bRegisteredForTick; }
+
+protected:
+    /** false라면 TickTaskManager에 등록되지 않습니다. 생성자에서 설정해야 합니다. */
+    uint8 bCanEverTick : 1 = true;
+
+    /**
+     * true라면 Worker Thread에서 다른 컴포넌트와 병렬로 Tick됩니다.
+     * 자기 자신(과 Owner의 Transform) 외의 상태를 건드리지 않는 컴포넌트만 설정해야 합니다.
+     */
+    uint8 bRunTickOnAnyThread : 1 = false;
+
+    ETickingGroup TickGroup = TG_PrePhysics;
+
 private:
+    /** 등록된 상태라면 TickTaskManager에서 해제한 뒤 ApplyChange로 Tick 설정을 바꾸고 다시 등록합니다. */
+    void RefreshTickRegistration(const TFunction<void()>& ApplyChange);
+
+    friend class FTickTaskManager;
+
     AActor* OwnerPrivate;
 
     /** InitializeComponent가 호출 되었는지 여부 */
@@ -82,6 +120,9 @@ private:
     /** Component가 현재 활성화 중인지 여부 */
     uint8 bIsActive : 1 = true;
 
+    /** TickTaskManager에 등록되어 있는지 여부 */
+    uint8 bRegisteredForTick : 1 = false;
+
 public:
     /** Component가 초기화 되었을 때, 자동으로 활성화할지 여부 */
     uint8 bAutoActive : 1 = true;
@@ -15,20 +15,17 @@ UBillboardComponent::UBillboardComponent()
     SetTexture(L"Assets/Editor/Icon/S_Actor.PNG");
 }
 
-UObject* UBillboardComponent::Duplicate(UObject* InOuter)
+void UBillboardComponent::Serialize(FArchive& Ar)
 {
+    Super::Serialize(Ar);
+
     // GPU 버퍼는 공유하지 않고, 상태 값만 복사하여 새로 초기화하도록 함
-    UBillboardComponent* NewComponent = Cast<UBillboardComponent>(Super::Duplicate(InOuter));
-    if (NewComponent)
+    Ar << FinalIndexU << FinalIndexV << TexturePath << UUIDParent << bIsEditorBillboard;
+
+    if (Ar.IsLoading())
     {
-        NewComponent->FinalIndexU = FinalIndexU;
-        NewComponent->FinalIndexV = FinalIndexV;
-        NewComponent->Texture = FEngineLoop::ResourceManager.GetTexture(TexturePath.ToWideString());
-        NewComponent->TexturePath = TexturePath;
-        NewComponent->UUIDParent = UUIDParent;
-        NewComponent->bIsEditorBillboard = bIsEditorBillboard;
+        Texture = FEngineLoop::ResourceManager.GetTexture(TexturePath.ToWideString());
     }
-    return NewComponent;
 }
 
 void UBillboardComponent::GetProperties(TMap<FString, FString>& OutProperties) const
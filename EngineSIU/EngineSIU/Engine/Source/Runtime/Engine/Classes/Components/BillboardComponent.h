@@ -12,7 +12,7 @@ class UBillboardComponent : public UPrimitiveComponent
 public:
     UBillboardComponent();
     virtual ~UBillboardComponent() override = default;
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
     virtual void InitializeComponent() override;
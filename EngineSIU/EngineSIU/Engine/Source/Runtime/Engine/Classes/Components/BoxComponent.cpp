@@ -7,13 +7,11 @@ UBoxComponent::UBoxComponent()
     ShapeType = EShapeType::Box;
 }
 
-UObject* UBoxComponent::Duplicate(UObject* InOuter)
+void UBoxComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-    
-    NewComponent->BoxExtent = BoxExtent;
-    
-    return NewComponent;
+    Super::Serialize(Ar);
+
+    Ar << BoxExtent;
 }
 
 void UBoxComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -8,7 +8,7 @@ class UBoxComponent : public UShapeComponent
 public:
     UBoxComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
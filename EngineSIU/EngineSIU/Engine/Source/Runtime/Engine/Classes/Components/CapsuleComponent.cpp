@@ -7,14 +7,11 @@ UCapsuleComponent::UCapsuleComponent()
     ShapeType = EShapeType::Capsule;
 }
 
-UObject* UCapsuleComponent::Duplicate(UObject* InOuter)
+void UCapsuleComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->CapsuleHalfHeight = CapsuleHalfHeight;
-    NewComponent->CapsuleRadius = CapsuleRadius;
-    
-    return NewComponent;
+    Ar << CapsuleHalfHeight << CapsuleRadius;
 }
 
 void UCapsuleComponent::SetProperties(const TMap<FString, FString>& InProperties)
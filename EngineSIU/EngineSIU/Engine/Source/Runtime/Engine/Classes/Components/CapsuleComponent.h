@@ -9,7 +9,7 @@ class UCapsuleComponent : public UShapeComponent
 public:
     UCapsuleComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
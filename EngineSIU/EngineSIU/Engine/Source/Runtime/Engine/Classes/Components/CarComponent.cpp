@@ -14,58 +14,47 @@ UCarComponent::~UCarComponent()
     if (bHasBody)
     {
         RemovePhysBody();
-        UPhysicsManager::Get().Car = nullptr;
+        if (UPhysicsManager::Get().Car == this)
+        {
+            UPhysicsManager::Get().Car = nullptr;
+        }
     }
 }
 
-UObject* UCarComponent::Duplicate(UObject* InOuter)
+namespace
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-    
-    return NewComponent;
+    void SetWorldTransformFromPhysics(USceneComponent* Component, const PxTransform& Transform)
+    {
+        PxMat44 mat(Transform);
+        XMMATRIX worldMatrix = XMLoadFloat4x4(reinterpret_cast<const XMFLOAT4X4*>(&mat));
+
+        XMFLOAT4X4 temp;
+        XMStoreFloat4x4(&temp, worldMatrix); // XMMATRIX → XMFLOAT4X4로 복사
+
+        FMatrix WorldMatrix;
+        memcpy(&WorldMatrix, &temp, sizeof(FMatrix)); // 안전하게 float[4][4] 복사
+
+        Component->SetWorldLocation(WorldMatrix.GetTranslationVector());
+        Component->SetWorldRotation(FRotator(WorldMatrix.GetMatrixWithoutScale().ToQuat()));
+    }
 }
 
 void UCarComponent::UpdatePhysics()
 {
     if (!bHasBody)
         return;
-    SCOPED_READ_LOCK(*UPhysicsManager::Get().GetScene());
 
-    PxTransform BodyT = CarBody->getGlobalPose();
-    PxMat44 mat(BodyT);
-    XMMATRIX worldMatrix = XMLoadFloat4x4(reinterpret_cast<const XMFLOAT4X4*>(&mat));
-
-    XMFLOAT4X4 temp;
-    XMStoreFloat4x4(&temp, worldMatrix); // XMMATRIX → XMFLOAT4X4로 복사
-
-    FMatrix WorldMatrix;
-    memcpy(&WorldMatrix, &temp, sizeof(FMatrix)); // 안전하게 float[4][4] 복사
-
-    FVector Location = WorldMatrix.GetTranslationVector();
-    FQuat Quat = WorldMatrix.GetMatrixWithoutScale().ToQuat();
-    FVector Scale = WorldMatrix.GetScaleVector();
-
-    SetWorldLocation(Location);
-    SetWorldRotation(FRotator(Quat));
+    PxTransform BodyT;
+    {
+        SCOPED_READ_LOCK(*UPhysicsManager::Get().GetScene());
+        BodyT = CarBody->getGlobalPose();
+    }
+    SetWorldTransformFromPhysics(this, BodyT);
 
+    // 바퀴는 강체가 없으므로 차량 시뮬레이션의 서스펜션 길이와 조향, 회전을 차체 Pose에 붙임
     for (int i = 0; i < 4; ++i)
     {
-        PxTransform WheelT = Wheels[i]->getGlobalPose();
-        PxMat44 WheelMat(WheelT);
-        worldMatrix = XMLoadFloat4x4(reinterpret_cast<const XMFLOAT4X4*>(&WheelMat));
-
-        XMFLOAT4X4 tempWheel;
-        XMStoreFloat4x4(&tempWheel, worldMatrix); // XMMATRIX → XMFLOAT4X4로 복사
-
-        WorldMatrix;
-        memcpy(&WorldMatrix, &tempWheel, sizeof(FMatrix)); // 안전하게 float[4][4] 복사
-
-        Location = WorldMatrix.GetTranslationVector();
-        Quat = WorldMatrix.GetMatrixWithoutScale().ToQuat();
-        Scale = WorldMatrix.GetScaleVector();
-
-        WheelComp[i]->SetWorldLocation(Location);
-        WheelComp[i]->SetWorldRotation(FRotator(Quat));
+        SetWorldTransformFromPhysics(WheelComp[i], BodyT * Vehicle->GetWheelLocalTransform(i));
     }
 }
 
@@ -109,59 +98,68 @@ void UCarComponent::SpawnComponents()
     }
 }
 
-void UCarComponent::MoveCar()
+void UCarComponent::PreVehicleSimulate()
 {
-    if (GetKeyState(VK_RBUTTON) & 0x8000 || !bHasBody)
-    {
-        for (int i = 0; i < 2; ++i)
-        {
-            RJoints[i]->setDriveVelocity(0.f);
-            FJoints[i]->setDriveVelocity(PxVec3(0.f), PxVec3(0.f));
-        }
-        SteeringJoint->setDriveVelocity(0);
+    if (!bHasBody)
         return;
-    }
 
-    if (PressedKeys.Contains(EKeys::A))
-    {
-        SteeringJoint->setDriveVelocity(DeltaSteerAngle);
-        UE_LOG(ELogLevel::Display, "A Pressed!");
-    }
-    if (PressedKeys.Contains(EKeys::D))
-    {
-        SteeringJoint->setDriveVelocity(-DeltaSteerAngle);
-        UE_LOG(ELogLevel::Display, "D Pressed!");
-    }
+    FVehicleInput Input;
+    Input.bReverse = Vehicle->GetCurrentGear() < 0;
 
-    if (PressedKeys.Contains(EKeys::W))
+    if (!(GetKeyState(VK_RBUTTON) & 0x8000))
     {
-        for (int i = 0; i < 2; ++i)
+        if (PressedKeys.Contains(EKeys::A))
         {
-            RJoints[i]->setDriveVelocity(15.f);
-            FJoints[i]->setDriveVelocity(PxVec3(0.f), PxVec3(0, 30.f, 0));
+            Input.Steer -= 1.f;
         }
-        UE_LOG(ELogLevel::Display, "W Pressed!");
-    }
-
-    if (PressedKeys.Contains(EKeys::S))
-    {
-        for (int i = 0; i < 2; ++i)
+        if (PressedKeys.Contains(EKeys::D))
         {
-            RJoints[i]->setDriveVelocity(-15.f);
-            FJoints[i]->setDriveVelocity(PxVec3(0.f), PxVec3(0, -30.f, 0));
+            Input.Steer += 1.f;
         }
-        UE_LOG(ELogLevel::Display, "S Pressed!");
-    }
 
-    if (PressedKeys.IsEmpty())
-    {
-        for (int i = 0; i < 2; ++i)
+        // 진행 방향과 반대 키는 먼저 브레이크로 쓰고, 거의 멈춘 뒤에 기어를 바꿔 가속
+        const float ForwardSpeed = Vehicle->GetForwardSpeed();
+        if (PressedKeys.Contains(EKeys::W))
+        {
+            if (Input.bReverse && ForwardSpeed < -1.f)
+            {
+                Input.Brake = 1.f;
+            }
+            else
+            {
+                Input.bReverse = false;
+                Input.Throttle = 1.f;
+            }
+        }
+        else if (PressedKeys.Contains(EKeys::S))
         {
-            RJoints[i]->setDriveVelocity(0.f);
-            FJoints[i]->setDriveVelocity(PxVec3(0.f), PxVec3(0.f));
+            if (!Input.bReverse && ForwardSpeed > 1.f)
+            {
+                Input.Brake = 1.f;
+            }
+            else
+            {
+                Input.bReverse = true;
+                Input.Throttle = 1.f;
+            }
         }
-        SteeringJoint->setDriveVelocity(0);
+
+        Input.bHandbrake = PressedKeys.Contains(EKeys::SpaceBar);
     }
+    Vehicle->SetInput(Input);
+
+    SCOPED_READ_LOCK(*UPhysicsManager::Get().GetScene());
+    Vehicle->SetBodyState(CarBody->getGlobalPose(), CarBody->getLinearVelocity(), CarBody->getAngularVelocity());
+}
+
+void UCarComponent::PostVehicleSimulate()
+{
+    if (!bHasBody)
+        return;
+
+    SCOPED_WRITE_LOCK(*UPhysicsManager::Get().GetScene());
+    CarBody->setLinearVelocity(Vehicle->GetLinearVelocity());
+    CarBody->setAngularVelocity(Vehicle->GetAngularVelocity());
 }
 
 void UCarComponent::AddPhysBody()
@@ -174,151 +172,73 @@ void UCarComponent::AddPhysBody()
     //몸통
     BodyExtent = (AABB.MaxLocation - AABB.MinLocation) * 0.5f;
     BodyExtent.Z *= 0.4f;
-    PxBoxGeometry CarBodyGeom(BodyExtent.ToPxVec3());
-    CarBody = Physics->createRigidDynamic(PxTransform(CarBodyPos.ToPxVec3()));
-    {
-        PxShape* BodyShape = Physics->createShape(CarBodyGeom, *DefaultMaterial);
-        BodyShape->setSimulationFilterData(PxFilterData(ECollisionChannel::ECC_CarBody, 0xFFFF, 0, 0));
-        CarBody->attachShape(*BodyShape);
-        BodyShape->release();
-        PxReal volume = 8 * BodyExtent.X * BodyExtent.Y * BodyExtent.Z;
-        PxReal density = 1200.0f / volume;
-        PxRigidBodyExt::updateMassAndInertia(*CarBody, density);
-        Scene->addActor(*CarBody);
-    }
 
-    //바퀴
-    float WheelRadius = 1.2f;
-    PxSphereGeometry WheelGeom(WheelRadius);
+    //차량 설정, 바퀴 위치와 크기는 메시에 맞추고 서스펜션은 정지 상태에서 바퀴가 WheelPos에 오도록 맞춤
+    FVehicleSetup Setup;
+    Setup.ChassisHalfExtent = BodyExtent.ToPxVec3();
+
+    const float WheelHeight = (WheelComp[0]->AABB.MaxLocation.Z - WheelComp[0]->AABB.MinLocation.Z) * WheelSize.Z;
+    Setup.WheelRadius = WheelHeight > KINDA_SMALL_NUMBER ? WheelHeight * 0.5f : 0.5f;
+    Setup.SuspensionMaxLength = Setup.WheelRadius * 0.8f;
 
+    // 한 바퀴에 실린 무게로 최대 길이의 40%만큼 눌리는 스프링, 감쇠비 0.5
+    const float SprungMass = Setup.Mass / 4.f;
+    const float RestCompression = Setup.SuspensionMaxLength * 0.4f;
+    Setup.SuspensionStiffness = SprungMass * -Setup.Gravity.z / RestCompression;
+    Setup.SuspensionDamping = 2.f * 0.5f * sqrtf(Setup.SuspensionStiffness * SprungMass);
+
+    // 기본값은 반지름 0.35 기준, 바퀴가 커져도 같은 속력과 감속도가 나오도록 맞춤
+    const float WheelScale = Setup.WheelRadius / 0.35f;
+    Setup.FinalDriveRatio *= WheelScale;
+    Setup.BrakeTorque *= WheelScale;
+    Setup.HandbrakeTorque *= WheelScale;
+
+    Setup.Wheels.Empty();
     for (int i = 0; i < 4; ++i)
     {
-        Wheels[i] = Physics->createRigidDynamic(PxTransform(WheelPos[i]));
-        PxShape* WheelShape = Physics->createShape(WheelGeom, *DefaultMaterial);
-        WheelShape->setFlag(PxShapeFlag::eSIMULATION_SHAPE, true);
-        WheelShape->setSimulationFilterData(PxFilterData(ECollisionChannel::ECC_Wheel, 0xFFFF, 0, 0));
-        Wheels[i]->attachShape(*WheelShape);
-        WheelShape->release();
-        PxRigidBodyExt::updateMassAndInertia(*Wheels[i], 0.1f);
-        Scene->addActor(*Wheels[i]);
+        FVehicleWheelSetup WheelSetup;
+        WheelSetup.AttachmentPosition = WheelPos[i] - CarBodyPos.ToPxVec3() + PxVec3(0.f, 0.f, Setup.SuspensionMaxLength - RestCompression);
+        WheelSetup.bSteered = i < 2;
+        WheelSetup.bDriven = i >= 2;
+        WheelSetup.bHandbrake = i >= 2;
+        Setup.Wheels.Add(WheelSetup);
     }
 
-    PxTransform bodyPose = CarBody->getGlobalPose();   // e.g. (0,0,1), q=I
-    //뒷바퀴 몸체 연결
-    for (int i = 0; i < 2; ++i)
-    {
-        // 1) wheelPose 읽어오기
-        PxTransform wheelPose = Wheels[i+2]->getGlobalPose(); // e.g. (1,0.9,0.7), q=I
-
-        // 2) 월드에서의 joint 위치/회전 정의
-        PxQuat hingeRotYtoX(PxHalfPi, PxVec3(0, 0, 1));       // Z축 +90° → X_local → Y_world
-        PxTransform jointGlobalPose(
-            wheelPose.p,                                   // 앵커 위치 = 휠 위치
-            hingeRotYtoX                                   // 앵커 회전 = 휠 회전에 Z90° 추가
-        );
-
-        // 3) 로컬 프레임 계산
-        PxTransform localFrameChassis = bodyPose.getInverse() * jointGlobalPose;
-        PxTransform localFrameWheel = wheelPose.getInverse() * jointGlobalPose;
-
-        // 4) joint 생성
-        RJoints[i] = PxRevoluteJointCreate(
-            *Physics,
-            CarBody, localFrameChassis,
-            Wheels[i+2], localFrameWheel);
-
-        //Joints[i]->setDriveVelocity(10.0f);
-
-        // 힌지 축 고정(회전자유), 다른 축은 잠금
-        RJoints[i]->setRevoluteJointFlag(PxRevoluteJointFlag::eDRIVE_ENABLED, true);
-        RJoints[i]->setRevoluteJointFlag(PxRevoluteJointFlag::eLIMIT_ENABLED, false);
-        RJoints[i]->setConstraintFlag(PxConstraintFlag::eCOLLISION_ENABLED, false);
-        RJoints[i]->setConstraintFlag(physx::PxConstraintFlag::eVISUALIZATION, true);
-    }
+    const PxTransform BodyPose(CarBodyPos.ToPxVec3());
+    Vehicle = new FVehicleSimulation(Setup, BodyPose);
 
-    //차 회전 관련 조인트 세팅
-    PxTransform FRWheelT = Wheels[0]->getGlobalPose();
-    PxTransform FLWheelT = Wheels[1]->getGlobalPose();
-    PxQuat JointOrientation(PxHalfPi, PxVec3(0, 1, 0));
-    PxVec3 JointPos = (FRWheelT.p + FLWheelT.p) * 0.5f + PxVec3(0,0,0.4f);
-    PxTransform JointT(JointPos, JointOrientation);
-
-    PxTransform HubT(JointPos);
-    Hub = Physics->createRigidDynamic(HubT);
-    PxVec3 HubSize = PxVec3(0.2f, (FRWheelT.p.y - FLWheelT.p.y) * 0.5f, 0.2f);
-    PxShape* HubShape = Physics->createShape(PxBoxGeometry(HubSize), *DefaultMaterial);
-    HubShape->setSimulationFilterData(PxFilterData(ECollisionChannel::ECC_CarBody, 0xFFFF, 0, 0));
-    Hub->attachShape(*HubShape);
-
-    Scene->addActor(*Hub);
-
-    PxTransform BodyLocal = bodyPose.getInverse() * JointT;
-    PxTransform HubLocal = HubT.getInverse() * JointT;
-
-    SteeringJoint = PxRevoluteJointCreate(
-        *Physics,
-        CarBody, BodyLocal,
-        Hub, HubLocal
-    );
-    SteeringJoint->setRevoluteJointFlag(PxRevoluteJointFlag::eDRIVE_ENABLED, true);
-    SteeringJoint->setConstraintFlag(PxConstraintFlag::eCOLLISION_ENABLED, false);
-    SteeringJoint->setLimit(PxJointAngularLimitPair(-MaxSteerAngle, +MaxSteerAngle));
-    SteeringJoint->setRevoluteJointFlag(PxRevoluteJointFlag::eLIMIT_ENABLED, true);
-    SteeringJoint->setConstraintFlag(physx::PxConstraintFlag::eVISUALIZATION, true);
-
-    //허브 앞바퀴 연결
-    for (int i = 0; i < 2; ++i)
+    // 중력과 바퀴 힘은 차량 시뮬레이션이 처리하고, PhysX는 차체 충돌과 위치 적분만 맡음
+    PxBoxGeometry CarBodyGeom(BodyExtent.ToPxVec3());
+    CarBody = Physics->createRigidDynamic(BodyPose);
     {
-        PxTransform WheelJointT(Wheels[i]->getGlobalPose().p);
-        PxTransform LocalWheel = Wheels[i]->getGlobalPose().getInverse() * WheelJointT;
-        PxTransform LocalHub = HubT.getInverse() * WheelJointT;
-
-        FJoints[i] = PxD6JointCreate(
-            *Physics,
-            Hub, LocalHub,
-            Wheels[i], LocalWheel
-        );
-        FJoints[i]->setMotion(PxD6Axis::eX, PxD6Motion::eLOCKED);
-        FJoints[i]->setMotion(PxD6Axis::eY, PxD6Motion::eLOCKED);
-        FJoints[i]->setMotion(PxD6Axis::eZ, PxD6Motion::eLOCKED);
-        FJoints[i]->setMotion(PxD6Axis::eTWIST, PxD6Motion::eLOCKED);
-        FJoints[i]->setMotion(PxD6Axis::eSWING2, PxD6Motion::eLOCKED);
-        FJoints[i]->setConstraintFlag(physx::PxConstraintFlag::eVISUALIZATION, true);
-
-        FJoints[i]->setMotion(PxD6Axis::eSWING1, PxD6Motion::eFREE);
-        PxD6JointDrive driveConfig(
-            /*stiffness=*/ 5000.0f,
-            /*damping=*/   200.0f,
-            /*maxForce=*/  PX_MAX_F32,
-            /*isAcceleration=*/ true
-        );
-        FJoints[i]->setDrive(PxD6Drive::eTWIST, driveConfig);
-
-        // 6) 초기 목표 위치(0회전)로 세팅
-        FJoints[i]->setDrivePosition(PxTransform(PxQuat(0, PxVec3(0, 1, 0))));
-        FJoints[i]->setConstraintFlag(PxConstraintFlag::eCOLLISION_ENABLED, false);
+        PxShape* BodyShape = Physics->createShape(CarBodyGeom, *DefaultMaterial);
+        BodyShape->setSimulationFilterData(PxFilterData(ECollisionChannel::ECC_CarBody, 0xFFFF, 0, 0));
+        CarBody->attachShape(*BodyShape);
+        BodyShape->release();
+        CarBody->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, true);
+        CarBody->setMass(Setup.Mass);
+        CarBody->setMassSpaceInertiaTensor(Vehicle->GetInertiaTensor());
+        SCOPED_WRITE_LOCK(*Scene);
+        Scene->addActor(*CarBody);
     }
+
+    UPhysicsManager::Get().RegisterCar(this);
     bHasBody = true;
 }
 
 void UCarComponent::RemovePhysBody()
 {
-    PxScene* Scene = UPhysicsManager::Get().GetScene();
-    SteeringJoint->release();
-    SteeringJoint = nullptr;
+    UPhysicsManager::Get().UnregisterCar(this);
 
-    Scene->removeActor(*CarBody);
-    Scene->removeActor(*Hub);
-    for (int i = 0; i < 4; ++i)
+    PxScene* Scene = UPhysicsManager::Get().GetScene();
     {
-        if (i < 2)
-        {
-            RJoints[i]->release();
-            FJoints[i]->release();
-            RJoints[i] = nullptr;
-            FJoints[i] = nullptr;
-        }
-        Scene->removeActor(*Wheels[i]);
+        SCOPED_WRITE_LOCK(*Scene);
+        Scene->removeActor(*CarBody);
     }
+    CarBody->release();
+    CarBody = nullptr;
+
+    delete Vehicle;
+    Vehicle = nullptr;
     bHasBody = false;
 }
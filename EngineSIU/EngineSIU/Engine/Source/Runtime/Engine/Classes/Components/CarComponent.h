@@ -5,6 +5,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Engine/FObjLoader.h"
 #include "Delegates/Delegate.h"
+#include "Physics/VehicleSimulation.h"
 
 class UCarComponent : public UStaticMeshComponent
 {
@@ -14,15 +15,20 @@ public:
     UCarComponent();
     virtual ~UCarComponent() override;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
-
+    /** 차체 강체의 Pose를 Component와 바퀴 Component에 반영 */
     void UpdatePhysics();
 
     virtual void BeginPlay() override;
 
     void SpawnComponents();
 
-    void MoveCar();
+    /** 눌린 키를 차량 입력으로 바꾸고 PhysX 강체의 상태를 차량 시뮬레이션에 맞춤 */
+    void PreVehicleSimulate();
+
+    /** 서브스텝이 끝난 차량 시뮬레이션의 속도를 PhysX 강체에 반영, 위치는 PhysX가 적분하면서 차체 충돌도 처리 */
+    void PostVehicleSimulate();
+
+    FVehicleSimulation* GetVehicle() const { return Vehicle; }
 
     void AddPhysBody();
 
@@ -31,13 +37,9 @@ public:
 private:
     PxMaterial* DefaultMaterial = nullptr;
     PxRigidDynamic* CarBody = nullptr;
-    PxRigidDynamic* Hub = nullptr;
-    PxRigidDynamic* Wheels[4] = { nullptr }; //FR, FL, RR, RL
-    PxRevoluteJoint* RJoints[2] = { nullptr }; //RR, RL
-    PxD6Joint* FJoints[2] = { nullptr }; //FR, FL
-    PxRevoluteJoint* SteeringJoint = nullptr;
-    float MaxSteerAngle = PxPi / 9.f;
-    float DeltaSteerAngle = PxPi / 18.f;
+
+    /** 바퀴 순서는 WheelPos와 같음 */
+    FVehicleSimulation* Vehicle = nullptr;
 
     //UStaticMeshComponent* BodyComp = nullptr; 바디는 나
     UStaticMeshComponent* WheelComp[4] = { nullptr };
@@ -37,18 +37,12 @@ void UHeightFogComponent::SetFogColor(FLinearColor Color)
     FogInscatteringColor = Color;
 }
 
-UObject* UHeightFogComponent::Duplicate(UObject* InOuter)
+void UHeightFogComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->FogDensity = FogDensity;
-    NewComponent->FogHeightFalloff = FogHeightFalloff;
-    NewComponent->StartDistance = StartDistance;
-    NewComponent->FogDistanceWeight = FogDistanceWeight;
-    NewComponent->EndDistance = EndDistance;
-    NewComponent->FogInscatteringColor = FogInscatteringColor;
-
-    return NewComponent;
+    Ar << FogDensity << FogHeightFalloff << StartDistance << FogDistanceWeight << EndDistance;
+    Ar << FogInscatteringColor;
 }
 
 void UHeightFogComponent::GetProperties(TMap<FString, FString>& OutProperties) const
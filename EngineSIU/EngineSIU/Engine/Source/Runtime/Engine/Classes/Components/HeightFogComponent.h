@@ -30,7 +30,7 @@ public:
     void SetEndDistance(float Value);
     void SetFogColor(FLinearColor Color);
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
     
@@ -7,12 +7,11 @@ UAmbientLightComponent::UAmbientLightComponent()
     AmbientLightInfo.AmbientColor = FLinearColor(0.1f, 0.1f, 0.1f, 1.0f);
 }
 
-UObject* UAmbientLightComponent::Duplicate(UObject* InOuter)
+void UAmbientLightComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->AmbientLightInfo = AmbientLightInfo;
-    return NewComponent;
+    Ar.Serialize(AmbientLightInfo);
 }
 
 void UAmbientLightComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -14,15 +14,11 @@ UDirectionalLightComponent::UDirectionalLightComponent()
     DirectionalLightInfo.LightColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
 }
 
-UObject* UDirectionalLightComponent::Duplicate(UObject* InOuter)
+void UDirectionalLightComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-    if (NewComponent)
-    {
-        NewComponent->DirectionalLightInfo = DirectionalLightInfo;
-    }
-    
-    return NewComponent;
+    Super::Serialize(Ar);
+
+    Ar.Serialize(DirectionalLightInfo);
 }
 
 void UDirectionalLightComponent::GetProperties(TMap<FString, FString>& OutProperties) const
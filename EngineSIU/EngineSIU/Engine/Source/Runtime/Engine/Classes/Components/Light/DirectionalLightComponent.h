@@ -10,7 +10,7 @@ public:
     UDirectionalLightComponent();
     virtual ~UDirectionalLightComponent() override = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
@@ -13,13 +13,11 @@ void ULightComponentBase::Initialize()
 {
 }
 
-UObject* ULightComponentBase::Duplicate(UObject* InOuter)
+void ULightComponentBase::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->AABB = AABB;
-
-    return NewComponent;
+    Ar.Serialize(AABB);
 }
 
 void ULightComponentBase::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -13,7 +13,7 @@ public:
     virtual ~ULightComponentBase() override = default;
     
     virtual void Initialize();
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
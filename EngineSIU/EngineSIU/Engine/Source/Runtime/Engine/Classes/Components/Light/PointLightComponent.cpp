@@ -220,15 +220,11 @@ void UPointLightComponent::InitShadowDebugView()
     }
 }
 
-UObject* UPointLightComponent::Duplicate(UObject* InOuter)
+void UPointLightComponent::Serialize(FArchive& Ar)
 {
+    Super::Serialize(Ar);
 
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-    if (NewComponent)
-    {
-        NewComponent->PointLightInfo = PointLightInfo;
-    }
-    return NewComponent;
+    Ar.Serialize(PointLightInfo);
 }
 
 void UPointLightComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -20,15 +20,11 @@ USpotLightComponent::USpotLightComponent()
     SpotLightInfo.Attenuation = 20.0f;
 }
 
-UObject* USpotLightComponent::Duplicate(UObject* InOuter)
+void USpotLightComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-    if (NewComponent)
-    {
-        NewComponent->SpotLightInfo = SpotLightInfo;
-    }
-    
-    return NewComponent;
+    Super::Serialize(Ar);
+
+    Ar.Serialize(SpotLightInfo);
 }
 
 void USpotLightComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -9,7 +9,7 @@ public:
     USpotLightComponent();
     virtual ~USpotLightComponent() override = default;
     
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
@@ -4,13 +4,11 @@
 #include "UObject/Casts.h"
 
 
-UObject* UMeshComponent::Duplicate(UObject* InOuter)
+void UMeshComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->OverrideMaterials = OverrideMaterials;
-
-    return NewComponent;
+    Ar << OverrideMaterials;
 }
 
 void UMeshComponent::GetProperties(TMap<FString, FString>& OutProperties) const
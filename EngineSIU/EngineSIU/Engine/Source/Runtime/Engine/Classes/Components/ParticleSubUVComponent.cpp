@@ -11,22 +11,12 @@ UParticleSubUVComponent::UParticleSubUVComponent()
 }
 
 // Duplicate: 버퍼 포인터는 복사하지 않고 애니메이션 상태만 복제
-UObject* UParticleSubUVComponent::Duplicate(UObject* InOuter)
+void UParticleSubUVComponent::Serialize(FArchive& Ar)
 {
-    UParticleSubUVComponent* NewComponent = Cast<UParticleSubUVComponent>(Super::Duplicate(InOuter));
-    if (NewComponent)
-    {
-        NewComponent->bIsLoop = bIsLoop;
-        NewComponent->CellsPerRow = CellsPerRow;
-        NewComponent->CellsPerColumn = CellsPerColumn;
-        NewComponent->IndexU = IndexU;
-        NewComponent->IndexV = IndexV;
-        NewComponent->ElapsedTime = ElapsedTime;
-        NewComponent->FrameDuration = FrameDuration;
-        NewComponent->UVScale = UVScale;
-        NewComponent->UVOffset = UVOffset;
-    }
-    return NewComponent;
+    Super::Serialize(Ar);
+
+    Ar << bIsLoop << CellsPerRow << CellsPerColumn << IndexU << IndexV << ElapsedTime << FrameDuration;
+    Ar << UVScale << UVOffset;
 }
 
 void UParticleSubUVComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -11,7 +11,7 @@ class UParticleSubUVComponent : public UBillboardComponent
 public:
     UParticleSubUVComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     void SetProperties(const TMap<FString, FString>& InProperties) override;
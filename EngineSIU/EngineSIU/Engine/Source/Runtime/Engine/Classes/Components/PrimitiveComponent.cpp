@@ -152,13 +152,11 @@ static bool ShouldIgnoreOverlapResult(const UWorld* World, const AActor* ThisAct
     return false;
 }
 
-UObject* UPrimitiveComponent::Duplicate(UObject* InOuter)
+void UPrimitiveComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->AABB = AABB;
-
-    return NewComponent;
+    Ar.Serialize(AABB);
 }
 
 void UPrimitiveComponent::InitializeComponent()
@@ -16,7 +16,7 @@ class UPrimitiveComponent : public USceneComponent
 public:
     UPrimitiveComponent() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
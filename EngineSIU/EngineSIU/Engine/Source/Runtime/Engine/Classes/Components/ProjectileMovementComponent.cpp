@@ -9,22 +9,17 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     Velocity = FVector(0.f, 0.f, 0.f);
     ProjectileLifetime = 10.0f; // 기본 생명주기 설정
     AccumulatedTime = 0;
+
+    // Owner의 Transform만 갱신하므로 병렬로 Tick, Actor 제거는 CompleteParallelTick에서 처리
+    bRunTickOnAnyThread = true;
 }
 
-UObject* UProjectileMovementComponent::Duplicate(UObject* InOuter)
+void UProjectileMovementComponent::Serialize(FArchive& Ar)
 {
+    Super::Serialize(Ar);
 
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-
-    NewComponent->ProjectileLifetime = ProjectileLifetime;
-    NewComponent->AccumulatedTime = AccumulatedTime;
-    NewComponent->InitialSpeed = InitialSpeed;
-    NewComponent->MaxSpeed = MaxSpeed;
-    NewComponent->Gravity = Gravity;
-    NewComponent->Velocity = Velocity;
-
-    return NewComponent;
-    
+    Ar << ProjectileLifetime << AccumulatedTime << InitialSpeed << MaxSpeed << Gravity;
+    Ar << Velocity;
 }
 
 void UProjectileMovementComponent::BeginPlay()
@@ -51,6 +46,20 @@ void UProjectileMovementComponent::TickComponent(float DeltaTime)
 
     //ToDo : PIE모드 진입 후에도 PickedActor를 유지했을 때 예외발생할 수 있음.
     AccumulatedTime += DeltaTime;
+    if (AccumulatedTime >= ProjectileLifetime && !(CanRunTickOnAnyThread() && IsRegisteredForTick()))
+    {
+        if (GetOwner())
+        {
+            GetOwner()->Destroy();
+        }
+    }
+}
+
+void UProjectileMovementComponent::CompleteParallelTick(float DeltaTime)
+{
+    Super::CompleteParallelTick(DeltaTime);
+
+    // World에서 Actor를 제거하는 일은 Game Thread에서만 가능
     if (AccumulatedTime >= ProjectileLifetime)
     {
         if (GetOwner())
@@ -8,7 +8,7 @@ public:
     UProjectileMovementComponent();
     virtual ~UProjectileMovementComponent() override = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     void SetVelocity(FVector NewVelocity) { Velocity = NewVelocity; }
 
@@ -33,6 +33,7 @@ public:
     virtual void BeginPlay() override;
     
     virtual void TickComponent(float DeltaTime) override;
+    virtual void CompleteParallelTick(float DeltaTime) override;
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
@@ -15,15 +15,11 @@ USceneComponent::USceneComponent()
 {
 }
 
-UObject* USceneComponent::Duplicate(UObject* InOuter)
+void USceneComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->RelativeLocation = RelativeLocation;
-    NewComponent->RelativeRotation = RelativeRotation;
-    NewComponent->RelativeScale3D = RelativeScale3D;
-
-    return NewComponent;
+    Ar << RelativeLocation << RelativeRotation << RelativeScale3D;
 }
 
 void USceneComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -17,8 +17,12 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "Physics/BodyInstance.h"
 #include "Physics/ConstraintInstance.h"
+#include "Animation/AnimUpdateRateManager.h"
+#include "Animation/AnimationRuntime.h"
+#include "World/World.h"
 
 bool USkeletalMeshComponent::bIsCPUSkinning = false;
+bool USkeletalMeshComponent::bUsePackedVertices = true;
 
 USkeletalMeshComponent::USkeletalMeshComponent()
     : AnimationMode(EAnimationMode::AnimationSingleNode)
@@ -29,6 +33,9 @@ USkeletalMeshComponent::USkeletalMeshComponent()
     ,BonePoseContext(nullptr)
 {
     CPURenderData = std::make_unique<FSkeletalMeshRenderData>();
+
+    // Pose 계산과 CPU Skinning은 컴포넌트 자신의 데이터만 사용하므로 병렬로 Tick
+    bRunTickOnAnyThread = true;
 }
 
 USkeletalMeshComponent::~USkeletalMeshComponent()
@@ -52,31 +59,60 @@ void USkeletalMeshComponent::BeginPlay()
     }
 }
 
-UObject* USkeletalMeshComponent::Duplicate(UObject* InOuter)
+void USkeletalMeshComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
+
+    USkeletalMesh* MeshAsset = SkeletalMeshAsset;
+    EAnimationMode Mode = AnimationMode;
+    Ar << MeshAsset;
+    Ar.Serialize(Mode);
+    if (Ar.IsLoading())
+    {
+        SetSkeletalMeshAsset(MeshAsset);
+        SetAnimationMode(Mode);
+    }
 
-    NewComponent->SetSkeletalMeshAsset(SkeletalMeshAsset);
-    NewComponent->SetAnimationMode(AnimationMode);
     if (AnimationMode == EAnimationMode::AnimationBlueprint)
     {
-        NewComponent->SetAnimClass(AnimClass);
-        UMyAnimInstance* AnimInstance = Cast<UMyAnimInstance>(NewComponent->GetAnimInstance());
-        AnimInstance->SetPlaying(Cast<UMyAnimInstance>(AnimScriptInstance)->IsPlaying());
-        // TODO: 애님 인스턴스 세팅하기
+        UClass* Class = GetAnimClass();
+        bool bInstancePlaying = Ar.IsSaving() && Cast<UMyAnimInstance>(AnimScriptInstance)->IsPlaying();
+        Ar << Class << bInstancePlaying;
+        if (Ar.IsLoading())
+        {
+            SetAnimClass(Class);
+            UMyAnimInstance* AnimInstance = Cast<UMyAnimInstance>(GetAnimInstance());
+            AnimInstance->SetPlaying(bInstancePlaying);
+            // TODO: 애님 인스턴스 세팅하기
+        }
     }
     else
     {
-        NewComponent->SetAnimation(GetAnimation());
+        UAnimationAsset* Animation = GetAnimation();
+        Ar << Animation;
+        if (Ar.IsLoading())
+        {
+            SetAnimation(Animation);
+        }
     }
-    NewComponent->SetLooping(this->IsLooping());
-    NewComponent->SetPlaying(this->IsPlaying());
 
-    NewComponent->SetSimulateSkel(bIsSimulateSkel);
-    NewComponent->SetUseGravitySkel(bUseGravitySkel);
-    NewComponent->SetKinematicSkel(bIsKinematicSkel);
+    bool bLooping = IsLooping();
+    bool bPlaying = IsPlaying();
+    bool bSimulate = bIsSimulateSkel;
+    bool bGravity = bUseGravitySkel;
+    bool bKinematic = bIsKinematicSkel;
+    Ar << bLooping << bPlaying << bSimulate << bGravity << bKinematic;
+    if (Ar.IsLoading())
+    {
+        SetLooping(bLooping);
+        SetPlaying(bPlaying);
+        SetSimulateSkel(bSimulate);
+        SetUseGravitySkel(bGravity);
+        SetKinematicSkel(bKinematic);
+    }
 
-    return NewComponent;
+    Ar << bEnableUpdateRateOptimizations << FullRateScreenSize << MaxFullRateDistance << MaxEvaluationInterval;
+    Ar << bInterpolateSkippedFrames << bSkipSkinningWhenOffscreen << BoneLODScreenSize << MaxBoneLOD << bUseSharedPoseCache;
 }
 
 void USkeletalMeshComponent::TickComponent(float DeltaTime)
@@ -85,6 +121,23 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
 
     TickPose(DeltaTime);
 
+    // 병렬 Tick 중에는 PhysX Scene에 접근하지 않고, CompleteParallelTick에서 동기화
+    if (!(CanRunTickOnAnyThread() && IsRegisteredForTick()))
+    {
+        SyncComponentToBody();
+    }
+}
+
+void USkeletalMeshComponent::CompleteParallelTick(float DeltaTime)
+{
+    Super::CompleteParallelTick(DeltaTime);
+
+    // 병렬 Tick 중에 평가된 Notify
+    if (AnimScriptInstance)
+    {
+        AnimScriptInstance->TriggerAnimNotifies(DeltaTime);
+    }
+
     SyncComponentToBody();
 }
 
@@ -107,12 +160,204 @@ void USkeletalMeshComponent::DestroyComponent(bool bPromoteChildren)
 
 void USkeletalMeshComponent::TickAnimation(float DeltaTime)
 {
-    if (GetSkeletalMeshAsset())
+    UpdateAnimationRate();
+
+    AccumulatedDeltaTime += DeltaTime;
+    ++FramesSinceEvaluation;
+
+    bool bEvaluated = false;
+    bool bInterpolated = false;
+
+    if (bForceEvaluation || FramesSinceEvaluation >= EvaluationInterval)
     {
-        TickAnimInstances(DeltaTime);
+        const bool bInterpolate = bInterpolateSkippedFrames && EvaluationInterval > 1 && !bOffscreen && !bForceEvaluation;
+        if (bInterpolate)
+        {
+            InterpolationFromPose = BonePoseContext.Pose.GetBones();
+        }
+
+        if (GetSkeletalMeshAsset())
+        {
+            UpdateRequiredBones();
+            BonePoseContext.RequiredBones = BoneLOD > 0 ? &RequiredBones : nullptr;
+
+            // 공유 포즈를 사용하는 Anim Instance라면 평가 중에 다시 설정함
+            SharedPose.reset();
+            // 건너뛴 프레임의 시간을 한 번에 진행하므로 Notify도 빠짐없이 발생함
+            TickAnimInstances(AccumulatedDeltaTime);
+            bEvaluated = true;
+        }
+
+        AccumulatedDeltaTime = 0.0f;
+        FramesSinceEvaluation = 0;
+        bForceEvaluation = false;
+
+        if (bInterpolate)
+        {
+            // 다음 평가 직전 프레임에 새 포즈에 도달하도록 보간
+            InterpolationToPose = BonePoseContext.Pose.GetBones();
+            InterpolationFrames = EvaluationInterval;
+            InterpolateSkippedFramePose();
+        }
+        else
+        {
+            InterpolationFromPose.Empty();
+            InterpolationToPose.Empty();
+        }
     }
+    else if (InterpolationToPose.Num() > 0 && !bOffscreen)
+    {
+        InterpolateSkippedFramePose();
+        bInterpolated = true;
+    }
+
+    // 물리 동기화로 포즈가 바뀌었을 수 있으므로 평가 여부와 관계없이 Skinning
+    const bool bSkipSkinning = bOffscreen && bSkipSkinningWhenOffscreen;
+    if (!bSkipSkinning)
+    {
+        CPUSkinning();
+    }
+
+    if (bEnableUpdateRateOptimizations)
+    {
+        FAnimUpdateRateManager::Get().AddComponentStats(bEvaluated, bInterpolated, bSkipSkinning, BoneLOD > 0 ? NumSkippedBones : 0);
+    }
+}
+
+void USkeletalMeshComponent::UpdateAnimationRate()
+{
+    EvaluationInterval = 1;
+    BoneLOD = 0;
+    bOffscreen = false;
+
+    // 에디터와 뷰어에서는 항상 매 프레임 정확한 포즈를 보여줌
+    const UWorld* World = GetWorld();
+    if (!bEnableUpdateRateOptimizations || !World || World->WorldType != EWorldType::PIE)
+    {
+        return;
+    }
+
+    const FAnimUpdateRateManager& Manager = FAnimUpdateRateManager::Get();
+    if (!Manager.HasView())
+    {
+        return;
+    }
+
+    FVector Center;
+    float Radius;
+    GetBoundingSphere(Center, Radius);
 
-    CPUSkinning();
+    const int32 MaxInterval = FMath::Max(MaxEvaluationInterval, 1);
+    const int32 MaxLOD = FMath::Max(MaxBoneLOD, 0);
+
+    if (!Manager.IsSphereInView(Center, Radius))
+    {
+        bOffscreen = true;
+        EvaluationInterval = MaxInterval;
+        BoneLOD = MaxLOD;
+        return;
+    }
+
+    const float ScreenSize = Manager.ComputeScreenSize(Center, Radius);
+    if (ScreenSize < FullRateScreenSize)
+    {
+        EvaluationInterval = FMath::Clamp(FMath::CeilToInt(FullRateScreenSize / FMath::Max(ScreenSize, KINDA_SMALL_NUMBER)), 1, MaxInterval);
+    }
+
+    if (MaxFullRateDistance > 0.0f && (Center - Manager.GetViewLocation()).Length() > MaxFullRateDistance)
+    {
+        EvaluationInterval = MaxInterval;
+    }
+
+    float LODScreenSize = BoneLODScreenSize;
+    while (BoneLOD < MaxLOD && ScreenSize < LODScreenSize)
+    {
+        ++BoneLOD;
+        LODScreenSize *= 0.5f;
+    }
+}
+
+void USkeletalMeshComponent::BuildBoneLODHeights()
+{
+    BoneLODHeights.Empty();
+    RequiredBones.Empty();
+    RequiredBonesLOD = 0;
+    NumSkippedBones = 0;
+
+    if (!SkeletalMeshAsset || !SkeletalMeshAsset->GetSkeleton())
+    {
+        return;
+    }
+
+    const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
+    const int32 BoneNum = RefSkeleton.RawRefBoneInfo.Num();
+    BoneLODHeights.SetNum(BoneNum);
+    for (uint8& Height : BoneLODHeights)
+    {
+        Height = 0;
+    }
+
+    // 부모 본은 항상 자식 본보다 앞에 있으므로, 뒤에서부터 자식의 깊이를 부모로 전파
+    for (int32 BoneIndex = BoneNum - 1; BoneIndex >= 0; --BoneIndex)
+    {
+        const int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
+        if (ParentIndex != INDEX_NONE)
+        {
+            const uint8 Height = static_cast<uint8>(FMath::Min(BoneLODHeights[BoneIndex] + 1, 255));
+            BoneLODHeights[ParentIndex] = FMath::Max(BoneLODHeights[ParentIndex], Height);
+        }
+    }
+
+    RequiredBones.SetNum(BoneNum);
+    for (uint8& bRequired : RequiredBones)
+    {
+        bRequired = 1;
+    }
+}
+
+void USkeletalMeshComponent::UpdateRequiredBones()
+{
+    if (BoneLOD == RequiredBonesLOD || !SkeletalMeshAsset || !SkeletalMeshAsset->GetSkeleton())
+    {
+        return;
+    }
+
+    const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
+    NumSkippedBones = 0;
+    for (int32 BoneIndex = 0; BoneIndex < RequiredBones.Num(); ++BoneIndex)
+    {
+        const bool bIsRoot = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex == INDEX_NONE;
+        RequiredBones[BoneIndex] = (bIsRoot || BoneLODHeights[BoneIndex] >= BoneLOD) ? 1 : 0;
+        NumSkippedBones += RequiredBones[BoneIndex] ? 0 : 1;
+    }
+    RequiredBonesLOD = BoneLOD;
+}
+
+void USkeletalMeshComponent::InterpolateSkippedFramePose()
+{
+    const int32 BoneNum = BonePoseContext.Pose.GetNumBones();
+    if (InterpolationFromPose.Num() != BoneNum || InterpolationToPose.Num() != BoneNum)
+    {
+        return;
+    }
+
+    SharedPose.reset();
+
+    const float Alpha = FMath::Min(static_cast<float>(FramesSinceEvaluation + 1) / static_cast<float>(InterpolationFrames), 1.0f);
+    for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+    {
+        BonePoseContext.Pose[BoneIndex].Blend(InterpolationFromPose[BoneIndex], InterpolationToPose[BoneIndex], Alpha);
+    }
+}
+
+void USkeletalMeshComponent::GetBoundingSphere(FVector& OutCenter, float& OutRadius) const
+{
+    const FVector LocalCenter = (AABB.MinLocation + AABB.MaxLocation) * 0.5f;
+    const FVector LocalExtent = (AABB.MaxLocation - AABB.MinLocation) * 0.5f;
+
+    const FTransform ComponentTransform = GetComponentTransform();
+    OutCenter = ComponentTransform.TransformPosition(LocalCenter);
+    OutRadius = LocalExtent.Length() * ComponentTransform.GetMaximumAxisScale();
 }
 
 void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
@@ -184,6 +429,7 @@ void USkeletalMeshComponent::SetSkeletalMeshAsset(USkeletalMesh* InSkeletalMeshA
 
     BonePoseContext.Pose.Empty();
     RefBonePoseTransforms.Empty();
+    SharedPose.reset();
     AABB = FBoundingBox(InSkeletalMeshAsset->GetRenderData()->BoundingBoxMin, SkeletalMeshAsset->GetRenderData()->BoundingBoxMax);
     
     const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
@@ -198,6 +444,11 @@ void USkeletalMeshComponent::SetSkeletalMeshAsset(USkeletalMesh* InSkeletalMeshA
     CPURenderData->Indices = InSkeletalMeshAsset->GetRenderData()->Indices;
     CPURenderData->ObjectName = InSkeletalMeshAsset->GetRenderData()->ObjectName;
     CPURenderData->MaterialSubsets = InSkeletalMeshAsset->GetRenderData()->MaterialSubsets;
+
+    BuildBoneLODHeights();
+    InterpolationFromPose.Empty();
+    InterpolationToPose.Empty();
+    bForceEvaluation = true;
 }
 
 FTransform USkeletalMeshComponent::GetSocketTransform(FName SocketName) const
@@ -217,29 +468,15 @@ FTransform USkeletalMeshComponent::GetSocketTransform(FName SocketName) const
 
 void USkeletalMeshComponent::GetCurrentGlobalBoneMatrices(TArray<FMatrix>& OutBoneMatrices) const
 {
-    const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
-    const int32 BoneNum = RefSkeleton.RawRefBoneInfo.Num();
-
-    OutBoneMatrices.Empty();
-    OutBoneMatrices.SetNum(BoneNum);
-
-    for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+    // 공유 포즈는 컴포넌트 공간 행렬까지 계산되어 있음
+    if (SharedPose && SharedPose->ComponentSpaceMatrices.Num() == BonePoseContext.Pose.GetNumBones())
     {
-        // 현재 본의 로컬 변환
-        FTransform CurrentLocalTransform = BonePoseContext.Pose[BoneIndex];
-        FMatrix LocalMatrix = CurrentLocalTransform.ToMatrixWithScale(); // FTransform -> FMatrix
-        
-        // 부모 본의 영향을 적용하여 월드 변환 구성
-        int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
-        if (ParentIndex != INDEX_NONE)
-        {
-            // 로컬 변환에 부모 월드 변환 적용
-            LocalMatrix = LocalMatrix * OutBoneMatrices[ParentIndex];
-        }
-        
-        // 결과 행렬 저장
-        OutBoneMatrices[BoneIndex] = LocalMatrix;
+        OutBoneMatrices = SharedPose->ComponentSpaceMatrices;
+        return;
     }
+
+    const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
+    FAnimationRuntime::FillComponentSpaceMatrices(RefSkeleton, BonePoseContext.Pose.GetBones(), OutBoneMatrices);
 }
 
 void USkeletalMeshComponent::DEBUG_SetAnimationEnabled(bool bEnable)
@@ -251,6 +488,7 @@ void USkeletalMeshComponent::DEBUG_SetAnimationEnabled(bool bEnable)
         if (SkeletalMeshAsset && SkeletalMeshAsset->GetSkeleton())
         {
             const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
+            SharedPose.reset();
             BonePoseContext.Pose.InitBones(RefSkeleton.RawRefBonePose.Num());
             for (int32 i = 0; i < RefSkeleton.RawRefBoneInfo.Num(); ++i)
             {
@@ -344,6 +582,16 @@ bool USkeletalMeshComponent::GetCPUSkinning()
     return bIsCPUSkinning;
 }
 
+void USkeletalMeshComponent::SetPackedVertices(bool Flag)
+{
+    bUsePackedVertices = Flag;
+}
+
+bool USkeletalMeshComponent::GetPackedVertices()
+{
+    return bUsePackedVertices;
+}
+
 void USkeletalMeshComponent::SetAnimationMode(EAnimationMode InAnimationMode)
 {
     const bool bNeedsChange = AnimationMode != InAnimationMode;
@@ -644,6 +892,9 @@ void USkeletalMeshComponent::SyncBodyToComponent()
     const FReferenceSkeleton& RefSkeleton = GetSkeletalMeshAsset()->GetSkeleton()->GetReferenceSkeleton();
     FTransform WorldTransform = GetWorldTransform();
 
+    // 물리 결과로 포즈를 덮어쓰므로 공유 포즈와 달라짐
+    SharedPose.reset();
+
     for (int32 i = 0; i < Bodies.Num(); i++)
     {
         //FBodyInstance* BodyInstance = Bodies[i];
@@ -706,6 +957,8 @@ void USkeletalMeshComponent::SyncBodyToComponent(FName InBoneName, FTransform In
         return; // 본이 없으면 다음으로 넘어갑니다.
     }
 
+    SharedPose.reset();
+
     int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
 
     FBodyInstance* ParentBody = Bodies[ParentIndex];
@@ -8,6 +8,7 @@
 #include "Engine/Asset/SkeletalMeshAsset.h"
 #include "Template/SubclassOf.h"
 #include "Animation/AnimNodeBase.h"
+#include "Animation/AnimPoseCache.h"
 //#include "Engine\Asset\PhysicsAsset.h"
 
 class UAnimSequence;
@@ -36,9 +37,10 @@ public:
     virtual ~USkeletalMeshComponent() override;
 
     virtual void InitializeComponent() override;
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime) override;
+    virtual void CompleteParallelTick(float DeltaTime) override;
     virtual void TickPose(float DeltaTime) override;
     virtual void DestroyComponent(bool bPromoteChildren = false) override;
 
@@ -116,6 +118,11 @@ public:
 
     static bool GetCPUSkinning();
 
+    /** GPU 스키닝에서 압축 버텍스(FPackedSkeletalMeshVertex) 사용 여부 */
+    static void SetPackedVertices(bool Flag);
+
+    static bool GetPackedVertices();
+
     UAnimInstance* GetAnimInstance() const { return AnimScriptInstance; }
 
     void SetAnimationMode(EAnimationMode InAnimationMode);
@@ -123,6 +130,50 @@ public:
     EAnimationMode GetAnimationMode() const { return AnimationMode; }
 
     virtual void InitAnim();
+
+    /** 애니메이션 평가 사이의 프레임 수, 1이면 매 프레임 평가 */
+    int32 GetEvaluationInterval() const { return EvaluationInterval; }
+
+    int32 GetBoneLOD() const { return BoneLOD; }
+
+    /** 마지막 Tick에서 화면 밖이라 판단되어 Skinning을 건너뛰었는지 여부 */
+    bool IsOffscreen() const { return bOffscreen; }
+
+    /** Bounds를 감싸는 World 공간의 구 */
+    void GetBoundingSphere(FVector& OutCenter, float& OutRadius) const;
+
+    /** 화면에서 차지하는 크기와 거리에 따라 애니메이션 평가를 건너뜀, PIE World에서만 적용 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, bool, bEnableUpdateRateOptimizations, = true)
+
+    /** 화면 크기(화면 높이 대비 비율)가 이 값 이상이면 매 프레임 평가, 작아질수록 평가 간격이 늘어남 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, float, FullRateScreenSize, = 0.3f)
+
+    /** 이 거리보다 멀면 화면 크기와 상관없이 MaxEvaluationInterval 간격으로 평가, 0이면 거리는 고려하지 않음 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, float, MaxFullRateDistance, = 0.0f)
+
+    /** 평가 사이의 최대 프레임 수, 화면 밖일 때도 이 간격으로 평가 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, int32, MaxEvaluationInterval, = 4)
+
+    /** 평가하지 않는 프레임에는 마지막 두 평가 결과 사이를 보간 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, bool, bInterpolateSkippedFrames, = true)
+
+    /** 화면 밖이라면 Skinning과 그리기를 생략 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, bool, bSkipSkinningWhenOffscreen, = true)
+
+    /** 화면 크기가 이 값보다 작으면 Bone LOD 1, 그 절반보다 작으면 Bone LOD 2, ... */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, float, BoneLODScreenSize, = 0.1f)
+
+    /** Bone LOD N은 말단에서 N단계 이내의 본을 평가하지 않고 Reference Pose를 사용 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, int32, MaxBoneLOD, = 2)
+
+    /**
+     * 같은 애니메이션을 같은 시간에 재생하는 다른 컴포넌트와 FAnimPoseCache로 포즈를 공유
+     * 재생 시간이 FAnimPoseCache의 TimeStep 단위로 양자화됨
+     */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, bool, bUseSharedPoseCache, = false)
+
+    /** 현재 포즈가 FAnimPoseCache에서 받아온 포즈라면 설정, 포즈가 바뀌면 해제 */
+    void SetSharedPose(std::shared_ptr<const FAnimPoseCacheEntry> InSharedPose) { SharedPose = std::move(InSharedPose); }
     
 protected:
     bool NeedToSpawnAnimScriptInstance() const;
@@ -140,8 +191,47 @@ private:
 
     static bool bIsCPUSkinning;
 
+    static bool bUsePackedVertices;
+
     void CPUSkinning(bool bForceUpdate = false);
 
+    /** 이번 프레임의 평가 간격, Bone LOD, 화면 밖 여부를 정함 */
+    void UpdateAnimationRate();
+
+    /** 각 본의 말단까지의 깊이를 계산, Bone LOD의 기준 */
+    void BuildBoneLODHeights();
+
+    /** BoneLOD에 맞게 RequiredBones를 갱신 */
+    void UpdateRequiredBones();
+
+    /** 평가하지 않은 프레임의 포즈를 InterpolationFromPose와 InterpolationToPose 사이에서 보간 */
+    void InterpolateSkippedFramePose();
+
+    int32 EvaluationInterval = 1;
+    int32 BoneLOD = 0;
+    bool bOffscreen = false;
+
+    /** 마지막 평가 이후 지난 프레임 수, 평가를 건너뛴 동안의 시간은 AccumulatedDeltaTime에 모아 다음 평가에 사용 */
+    int32 FramesSinceEvaluation = 0;
+    float AccumulatedDeltaTime = 0.0f;
+    bool bForceEvaluation = true;
+
+    /** 보간 중인 두 포즈와 보간에 걸리는 프레임 수, 보간하지 않는다면 비어있음 */
+    TArray<FTransform> InterpolationFromPose;
+    TArray<FTransform> InterpolationToPose;
+    int32 InterpolationFrames = 1;
+
+    /** 본마다 가장 먼 말단 본까지의 단계 수, 말단 본은 0 */
+    TArray<uint8> BoneLODHeights;
+
+    /** 현재 Bone LOD에서 평가해야 하는 본 */
+    TArray<uint8> RequiredBones;
+    int32 RequiredBonesLOD = 0;
+    int32 NumSkippedBones = 0;
+
+    /** BonePoseContext.Pose와 같은 공유 포즈, 컴포넌트 공간 행렬을 다시 계산하지 않기 위해 사용 */
+    std::shared_ptr<const FAnimPoseCacheEntry> SharedPose;
+
 public:
     TSubclassOf<UAnimInstance> AnimClass;
     
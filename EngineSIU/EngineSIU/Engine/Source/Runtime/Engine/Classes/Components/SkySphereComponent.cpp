@@ -7,14 +7,11 @@ USkySphereComponent::USkySphereComponent()
     SetType(StaticClass()->GetName());
 }
 
-UObject* USkySphereComponent::Duplicate(UObject* InOuter)
+void USkySphereComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->UOffset = UOffset;
-    NewComponent->VOffset = VOffset;
-
-    return NewComponent;
+    Ar << UOffset << VOffset;
 }
 
 void USkySphereComponent::TickComponent(float DeltaTime)
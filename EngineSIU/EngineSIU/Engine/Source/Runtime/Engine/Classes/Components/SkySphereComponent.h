@@ -9,7 +9,7 @@ class USkySphereComponent : public UStaticMeshComponent
 public:
     USkySphereComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     virtual void TickComponent(float DeltaTime) override;
     float UOffset = 0;
@@ -7,13 +7,11 @@ USphereComponent::USphereComponent()
     ShapeType = EShapeType::Sphere;
 }
 
-UObject* USphereComponent::Duplicate(UObject* InOuter)
+void USphereComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->SphereRadius = SphereRadius;
-
-    return NewComponent;
+    Ar << SphereRadius;
 }
 
 void USphereComponent::SetProperties(const TMap<FString, FString>& InProperties)
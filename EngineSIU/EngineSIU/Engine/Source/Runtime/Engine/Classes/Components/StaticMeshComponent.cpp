@@ -36,18 +36,32 @@ void UStaticMeshComponent::BeginPlay()
     }
 }
 
-UObject* UStaticMeshComponent::Duplicate(UObject* InOuter)
+void UStaticMeshComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->bSimulatePhysics = bSimulatePhysics;
-    NewComponent->bIsStatic = bIsStatic;
-    NewComponent->bSimulateGravity = bSimulateGravity;
-    NewComponent->SetStaticMesh(StaticMesh);
-    NewComponent->SelectedSubMeshIndex = SelectedSubMeshIndex;
-    NewComponent->SetBodySetupGeom(bIsBox, bIsSphere, bIsCapsule, bIsConvex);
+    Ar << bSimulatePhysics << bIsStatic << bSimulateGravity;
 
-    return NewComponent;
+    UStaticMesh* Mesh = StaticMesh;
+    Ar << Mesh;
+    if (Ar.IsLoading())
+    {
+        SetStaticMesh(Mesh);
+    }
+
+    Ar << SelectedSubMeshIndex;
+
+    bool bBox = bIsBox;
+    bool bSphere = bIsSphere;
+    bool bCapsule = bIsCapsule;
+    bool bConvex = bIsConvex;
+    Ar << bBox << bSphere << bCapsule << bConvex;
+    if (Ar.IsLoading())
+    {
+        SetBodySetupGeom(bBox, bSphere, bCapsule, bConvex);
+    }
+
+    Ar << ForcedLODModel << ShadowLODBias;
 }
 
 void UStaticMeshComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -264,6 +278,7 @@ int UStaticMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, const
 void UStaticMeshComponent::SetStaticMesh(UStaticMesh* Value)
 {
     StaticMesh = Value;
+    CurrentLOD = 0;
     if (Body)
     {
         Body->TermBody();
@@ -282,6 +297,61 @@ void UStaticMeshComponent::SetStaticMesh(UStaticMesh* Value)
     }
 }
 
+void UStaticMeshComponent::UpdateLOD(const FVector& ViewLocation, const FMatrix& Projection)
+{
+    const FStaticMeshRenderData* RenderData = StaticMesh ? StaticMesh->GetRenderData() : nullptr;
+    if (!RenderData || RenderData->GetNumLODs() == 1)
+    {
+        CurrentLOD = 0;
+        return;
+    }
+
+    const int32 MaxLOD = RenderData->GetNumLODs() - 1;
+    if (ForcedLODModel > 0)
+    {
+        CurrentLOD = FMath::Min(ForcedLODModel - 1, MaxLOD);
+        return;
+    }
+
+    const FVector LocalCenter = (AABB.MinLocation + AABB.MaxLocation) * 0.5f;
+    const FVector LocalExtent = (AABB.MaxLocation - AABB.MinLocation) * 0.5f;
+    const FTransform ComponentTransform = GetComponentTransform();
+    const FVector Center = ComponentTransform.TransformPosition(LocalCenter);
+    const float Radius = LocalExtent.Length() * ComponentTransform.GetMaximumAxisScale();
+
+    // 원근 투영은 거리에 반비례, 직교 투영은 거리와 무관
+    const float ScreenMultiple = FMath::Max(Projection.M[0][0], Projection.M[1][1]);
+    const bool bPerspective = Projection.M[2][3] != 0.0f;
+    const float Distance = bPerspective ? FMath::Max((Center - ViewLocation).Length(), 1.0f) : 1.0f;
+    const float ScreenSize = ScreenMultiple * Radius / Distance;
+
+    auto SelectLOD = [RenderData, MaxLOD](float InScreenSize)
+    {
+        int32 LOD = 0;
+        while (LOD < MaxLOD && InScreenSize < RenderData->LODs[LOD]->ScreenSize)
+        {
+            ++LOD;
+        }
+        return LOD;
+    };
+
+    // 화면 크기가 LOD 경계의 ±LODHysteresis 범위 안이라면 현재 LOD를 유지
+    constexpr float LODHysteresis = 0.1f;
+    const int32 FinestLOD = SelectLOD(ScreenSize * (1.0f + LODHysteresis));
+    const int32 CoarsestLOD = SelectLOD(ScreenSize * (1.0f - LODHysteresis));
+    CurrentLOD = FMath::Clamp(CurrentLOD, FinestLOD, CoarsestLOD);
+}
+
+int32 UStaticMeshComponent::GetShadowLOD() const
+{
+    const FStaticMeshRenderData* RenderData = StaticMesh ? StaticMesh->GetRenderData() : nullptr;
+    if (!RenderData)
+    {
+        return 0;
+    }
+    return FMath::Min(CurrentLOD + FMath::Max(ShadowLODBias, 0), RenderData->GetNumLODs() - 1);
+}
+
 void UStaticMeshComponent::SimulatePhysics(bool Value)
 {
     bSimulatePhysics = Value;
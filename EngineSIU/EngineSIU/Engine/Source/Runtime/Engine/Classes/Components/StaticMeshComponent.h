@@ -26,7 +26,7 @@ public:
 
     virtual void BeginPlay() override;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
 
@@ -61,6 +61,24 @@ public:
 
     void GetBodySetupGeom(bool& OutBox, bool& OutSphere, bool& OutCapsule, bool& OutConvex);
 
+    /**
+     * 시점에서 본 화면 크기(경계 구의 지름이 화면 높이에서 차지하는 비율)로 사용할 LOD를 고릅니다.
+     * LOD 경계 근처에서 LOD가 매 프레임 바뀌지 않도록, 화면 크기가 경계를 일정 비율 이상 넘어설 때만 바꿉니다.
+     */
+    void UpdateLOD(const FVector& ViewLocation, const FMatrix& Projection);
+
+    /** 현재 그리는 LOD */
+    int32 GetLOD() const { return CurrentLOD; }
+
+    /** 그림자를 그릴 때 사용할 LOD */
+    int32 GetShadowLOD() const;
+
+    /** 0이면 화면 크기에 따라 선택, N > 0이면 항상 LOD N - 1을 사용 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, int32, ForcedLODModel, = 0)
+
+    /** 그림자는 화면에 그리는 LOD보다 이만큼 거친 LOD를 사용 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, int32, ShadowLODBias, = 1)
+
 protected:
     UStaticMesh* StaticMesh = nullptr;
     int SelectedSubMeshIndex = -1;
@@ -69,4 +87,7 @@ protected:
     bool bIsCapsule = false;
     bool bIsConvex = false;
     EShape CurShape = EShape::EBox;
+
+private:
+    int32 CurrentLOD = 0;
 };
@@ -11,18 +11,19 @@ UTextComponent::UTextComponent()
     SetType(StaticClass()->GetName());
 }
 
-UObject* UTextComponent::Duplicate(UObject* InOuter)
+void UTextComponent::Serialize(FArchive& Ar)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewComponent->Text = Text;
-    NewComponent->QuadSize = QuadSize;
-    NewComponent->RowCount = RowCount;
-    NewComponent->ColumnCount = ColumnCount;
-    NewComponent->QuadWidth = QuadWidth;
-    NewComponent->QuadHeight = QuadHeight;
+    int32 TextLength = static_cast<int32>(Text.size());
+    Ar << TextLength;
+    if (Ar.IsLoading())
+    {
+        Text.resize(TextLength);
+    }
+    Ar.Serialize(Text.data(), TextLength * sizeof(wchar_t));
 
-    return NewComponent;
+    Ar << QuadSize << RowCount << ColumnCount << QuadWidth << QuadHeight;
 }
 
 void UTextComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -12,7 +12,7 @@ class UTextComponent : public UBillboardComponent
 public:
     UTextComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     
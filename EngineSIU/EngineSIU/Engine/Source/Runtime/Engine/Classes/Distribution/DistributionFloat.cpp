@@ -1,15 +1,31 @@
 #include "DistributionFloat.h"
 
-void FDistributionFloat::GetOutRange(float& MinOut, float& MaxOut)
+namespace
 {
-    if (MinValue > MaxValue)
+    /** 파티클 컴포넌트가 병렬로 Tick되므로 스레드마다 별도의 난수 생성기를 사용 */
+    std::mt19937& GetThreadRandomGenerator()
     {
-        MaxValue = MinValue;
+        thread_local std::mt19937 gen(std::random_device{}());
+        return gen;
     }
+}
 
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> dis(MinValue, MaxValue);
+void FDistributionFloat::GetOutRange(float& MinOut, float& MaxOut)
+{
+    GetOutRange(MinOut, MaxOut, GetThreadRandomGenerator());
+}
+
+float FDistributionFloat::GetValue()
+{
+    return GetValue(GetThreadRandomGenerator());
+}
+
+void FDistributionFloat::GetOutRange(float& MinOut, float& MaxOut, std::mt19937& gen) const
+{
+    // 여러 컴포넌트가 같은 Template을 공유하므로 멤버를 수정하지 않음
+    const float ClampedMaxValue = MinValue > MaxValue ? MinValue : MaxValue;
+
+    std::uniform_real_distribution<float> dis(MinValue, ClampedMaxValue);
     
     float RandValue1 = dis(gen);
     float RandValue2 = dis(gen);
@@ -18,12 +34,10 @@ void FDistributionFloat::GetOutRange(float& MinOut, float& MaxOut)
     MaxOut = std::max(RandValue1, RandValue2);
 }
 
-float FDistributionFloat::GetValue()
+float FDistributionFloat::GetValue(std::mt19937& gen) const
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
     float TempMin, TempMax;
-    GetOutRange(TempMin, TempMax);
+    GetOutRange(TempMin, TempMax, gen);
     std::uniform_real_distribution<float> dis(TempMin, TempMax);
     
     return dis(gen);
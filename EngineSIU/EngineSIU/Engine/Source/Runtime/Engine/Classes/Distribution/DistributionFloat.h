@@ -1,4 +1,6 @@
 #pragma once
+#include <random>
+
 #include "UObject/ObjectMacros.h"
 
 struct FDistributionFloat
@@ -16,4 +18,8 @@ struct FDistributionFloat
 
     void GetOutRange(float& MinOut, float& MaxOut);
     float GetValue();
+
+    /** 주어진 난수 생성기를 사용하므로, Emitter Instance의 생성기를 넘기면 결과가 스레드와 무관하게 결정됩니다. */
+    void GetOutRange(float& MinOut, float& MaxOut, std::mt19937& RandomStream) const;
+    float GetValue(std::mt19937& RandomStream) const;
 };
@@ -1,10 +1,19 @@
 ﻿#include "DistributionVector.h"
 
+std::mt19937& FDistributionVector::GetThreadRandomGenerator()
+{
+    // 파티클 컴포넌트가 병렬로 Tick되므로 스레드마다 별도의 난수 생성기를 사용
+    thread_local std::mt19937 gen(std::random_device{}());
+    return gen;
+}
+
 void FDistributionVector::GetOutRange(FVector& MinOut, FVector& MaxOut)
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    
+    GetOutRange(MinOut, MaxOut, GetThreadRandomGenerator());
+}
+
+void FDistributionVector::GetOutRange(FVector& MinOut, FVector& MaxOut, std::mt19937& gen) const
+{
     // X, Y, Z 각 컴포넌트별로 랜덤 값 생성
     std::uniform_real_distribution<float> disX(MinValue.X, MaxValue.X);
     std::uniform_real_distribution<float> disY(MinValue.Y, MaxValue.Y);
@@ -1,4 +1,7 @@
 #pragma once
+#include <random>
+
+#include "Math/MathUtility.h"
 #include "Math/Vector.h"
 #include "UObject/ObjectMacros.h"
 
@@ -12,42 +15,26 @@ struct FDistributionVector
     //FVector MinValue;
     //FVector MaxValue;
 
-    std::mt19937 Gen;
-    std::uniform_real_distribution<float> DistX;
-    std::uniform_real_distribution<float> DistY;
-    std::uniform_real_distribution<float> DistZ;
-
 public:
     FDistributionVector()
         : MinValue(FVector::ZeroVector)
         , MaxValue(FVector::ZeroVector)
-        , Gen(std::random_device{}())
-        , DistX(MinValue.X, MaxValue.X)
-        , DistY(MinValue.Y, MaxValue.Y)
-        , DistZ(MinValue.Z, MaxValue.Z)
     {}
 
     // 범위를 지정하는 생성자
     FDistributionVector(const FVector& InMin, const FVector& InMax)
         : MinValue(InMin)
         , MaxValue(InMax)
-        , Gen(std::random_device{}())
-        , DistX(MinValue.X, MaxValue.X)
-        , DistY(MinValue.Y, MaxValue.Y)
-        , DistZ(MinValue.Z, MaxValue.Z)
     {   }
 
     void GetOutRange(FVector& MinOut, FVector& MaxOut);
+    void GetOutRange(FVector& MinOut, FVector& MaxOut, std::mt19937& RandomStream) const;
 
     void UpdateDistributionParam()
     {
         if (MinValue.X > MaxValue.X) MaxValue.X = MinValue.X;
         if (MinValue.Y > MaxValue.Y) MaxValue.Y = MinValue.Y;
         if (MinValue.Z > MaxValue.Z) MaxValue.Z = MinValue.Z;
-
-        DistX = std::uniform_real_distribution<float>(MinValue.X, MaxValue.X);
-        DistY = std::uniform_real_distribution<float>(MinValue.Y, MaxValue.Y);
-        DistZ = std::uniform_real_distribution<float>(MinValue.Z, MaxValue.Z);
     }
 
     void UpdateRange(const FVector& InMin, const FVector& InMax)
@@ -58,14 +45,29 @@ public:
         UpdateDistributionParam();
     }
 
-    FVector GetValue()
+    FVector GetValue() const
     {
-        UpdateDistributionParam();
+        return GetValue(GetThreadRandomGenerator());
+    }
+
+    /**
+     * 주어진 난수 생성기로 값을 뽑습니다.
+     * Emitter Instance마다 고유한 Seed의 생성기를 넘기면 Tick이 어느 스레드에서 실행되더라도 같은 결과가 나옵니다.
+     */
+    FVector GetValue(std::mt19937& RandomStream) const
+    {
+        // 여러 컴포넌트가 같은 Template을 공유하므로 멤버를 수정하지 않고 지역 분포를 사용
+        std::uniform_real_distribution<float> LocalDistX(MinValue.X, FMath::Max(MinValue.X, MaxValue.X));
+        std::uniform_real_distribution<float> LocalDistY(MinValue.Y, FMath::Max(MinValue.Y, MaxValue.Y));
+        std::uniform_real_distribution<float> LocalDistZ(MinValue.Z, FMath::Max(MinValue.Z, MaxValue.Z));
 
-        return FVector(
-            DistX(Gen),
-            DistY(Gen),
-            DistZ(Gen)
-        );
+        // 함수 인자의 평가 순서는 정해져 있지 않으므로 순서대로 뽑음
+        const float X = LocalDistX(RandomStream);
+        const float Y = LocalDistY(RandomStream);
+        const float Z = LocalDistZ(RandomStream);
+        return FVector(X, Y, Z);
     }
+
+private:
+    static std::mt19937& GetThreadRandomGenerator();
 };
@@ -0,0 +1,711 @@
+#include "PackedMeshVertex.h"
+
+#include <cstring>
+#include <random>
+
+#include "SkeletalMeshAsset.h"
+#include "StaticMeshAsset.h"
+#include "Math/MathUtility.h"
+#include "Math/Quat.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    float SignNotZero(float Value)
+    {
+        return Value >= 0.0f ? 1.0f : -1.0f;
+    }
+
+    /** 단위 벡터 → [-1, 1]^2 */
+    void OctahedronEncode(const FVector& Vector, float& OutX, float& OutY)
+    {
+        const float L1Norm = FMath::Abs(Vector.X) + FMath::Abs(Vector.Y) + FMath::Abs(Vector.Z);
+        if (L1Norm <= SMALL_NUMBER)
+        {
+            OutX = 0.0f;
+            OutY = 0.0f;
+            return;
+        }
+
+        const float X = Vector.X / L1Norm;
+        const float Y = Vector.Y / L1Norm;
+        if (Vector.Z >= 0.0f)
+        {
+            OutX = X;
+            OutY = Y;
+        }
+        else
+        {
+            // 아래쪽 반구는 대각선을 기준으로 접어서 바깥쪽 삼각형에 놓음
+            OutX = (1.0f - FMath::Abs(Y)) * SignNotZero(X);
+            OutY = (1.0f - FMath::Abs(X)) * SignNotZero(Y);
+        }
+    }
+
+    FVector OctahedronDecode(float X, float Y)
+    {
+        FVector Vector(X, Y, 1.0f - FMath::Abs(X) - FMath::Abs(Y));
+        const float Fold = FMath::Max(-Vector.Z, 0.0f);
+        Vector.X += Vector.X >= 0.0f ? -Fold : Fold;
+        Vector.Y += Vector.Y >= 0.0f ? -Fold : Fold;
+        return Vector.GetSafeNormal();
+    }
+
+    uint16 FloatToSNorm16(float Value)
+    {
+        const float Clamped = FMath::Clamp(Value, -1.0f, 1.0f);
+        return static_cast<uint16>(static_cast<int16>(std::lround(Clamped * 32767.0f)));
+    }
+
+    float SNorm16ToFloat(uint16 Value)
+    {
+        // D3D와 같이 -32768은 -1로 취급
+        return FMath::Max(static_cast<float>(static_cast<int16>(Value)) / 32767.0f, -1.0f);
+    }
+
+    constexpr uint32 TangentComponentMax = (1u << 15) - 1;
+    constexpr uint32 TangentSignBit = 1u << 30;
+
+    uint32 FloatToUNorm15(float Value)
+    {
+        const float Normalized = FMath::Clamp(Value * 0.5f + 0.5f, 0.0f, 1.0f);
+        return static_cast<uint32>(std::lround(Normalized * static_cast<float>(TangentComponentMax)));
+    }
+
+    float UNorm15ToFloat(uint32 Value)
+    {
+        return static_cast<float>(Value) / static_cast<float>(TangentComponentMax) * 2.0f - 1.0f;
+    }
+}
+
+uint32 FVertexQuantization::EncodeOctahedron(const FVector& Normal)
+{
+    float X, Y;
+    OctahedronEncode(Normal, X, Y);
+    return static_cast<uint32>(FloatToSNorm16(X)) | (static_cast<uint32>(FloatToSNorm16(Y)) << 16);
+}
+
+FVector FVertexQuantization::DecodeOctahedron(uint32 Packed)
+{
+    return OctahedronDecode(SNorm16ToFloat(static_cast<uint16>(Packed & 0xFFFF)), SNorm16ToFloat(static_cast<uint16>(Packed >> 16)));
+}
+
+uint32 FVertexQuantization::EncodeTangent(const FVector& Tangent, float Sign)
+{
+    float X, Y;
+    OctahedronEncode(Tangent, X, Y);
+
+    uint32 Packed = FloatToUNorm15(X) | (FloatToUNorm15(Y) << 15);
+    if (Sign < 0.0f)
+    {
+        Packed |= TangentSignBit;
+    }
+    return Packed;
+}
+
+FVector FVertexQuantization::DecodeTangent(uint32 Packed, float& OutSign)
+{
+    OutSign = (Packed & TangentSignBit) ? -1.0f : 1.0f;
+    return OctahedronDecode(UNorm15ToFloat(Packed & TangentComponentMax), UNorm15ToFloat((Packed >> 15) & TangentComponentMax));
+}
+
+uint16 FVertexQuantization::FloatToHalf(float Value)
+{
+    uint32 Bits;
+    std::memcpy(&Bits, &Value, sizeof(Bits));
+
+    const uint32 Sign = (Bits >> 16) & 0x8000;
+    const uint32 FloatExponent = (Bits >> 23) & 0xFF;
+    uint32 Mantissa = Bits & 0x7FFFFF;
+
+    // Inf, NaN
+    if (FloatExponent == 0xFF)
+    {
+        return static_cast<uint16>(Sign | 0x7C00 | (Mantissa ? 0x200 : 0));
+    }
+
+    const int32 Exponent = static_cast<int32>(FloatExponent) - 127 + 15;
+    if (Exponent >= 31)
+    {
+        return static_cast<uint16>(Sign | 0x7C00);
+    }
+
+    if (Exponent <= 0)
+    {
+        // half의 비정규 수로도 표현할 수 없을 만큼 작으면 0
+        if (Exponent < -10)
+        {
+            return static_cast<uint16>(Sign);
+        }
+
+        Mantissa |= 0x800000;
+        const uint32 Shift = static_cast<uint32>(14 - Exponent);
+        uint32 Half = Mantissa >> Shift;
+        const uint32 Remainder = Mantissa & ((1u << Shift) - 1);
+        const uint32 Halfway = 1u << (Shift - 1);
+        if (Remainder > Halfway || (Remainder == Halfway && (Half & 1)))
+        {
+            ++Half;
+        }
+        return static_cast<uint16>(Sign | Half);
+    }
+
+    uint32 Half = (static_cast<uint32>(Exponent) << 10) | (Mantissa >> 13);
+    const uint32 Remainder = Mantissa & 0x1FFF;
+
+    // 올림이 지수로 넘어가도 올바른 값(최대값에서는 Inf)이 됨
+    if (Remainder > 0x1000 || (Remainder == 0x1000 && (Half & 1)))
+    {
+        ++Half;
+    }
+    return static_cast<uint16>(Sign | Half);
+}
+
+float FVertexQuantization::HalfToFloat(uint16 Value)
+{
+    const uint32 Sign = static_cast<uint32>(Value & 0x8000) << 16;
+    int32 Exponent = (Value >> 10) & 0x1F;
+    uint32 Mantissa = Value & 0x3FF;
+
+    uint32 Bits;
+    if (Exponent == 0)
+    {
+        if (Mantissa == 0)
+        {
+            Bits = Sign;
+        }
+        else
+        {
+            // 비정규 수를 정규화
+            Exponent = 1;
+            while (!(Mantissa & 0x400))
+            {
+                Mantissa <<= 1;
+                --Exponent;
+            }
+            Mantissa &= 0x3FF;
+            Bits = Sign | (static_cast<uint32>(Exponent + 112) << 23) | (Mantissa << 13);
+        }
+    }
+    else if (Exponent == 31)
+    {
+        Bits = Sign | 0x7F800000 | (Mantissa << 13);
+    }
+    else
+    {
+        Bits = Sign | (static_cast<uint32>(Exponent + 112) << 23) | (Mantissa << 13);
+    }
+
+    float Result;
+    std::memcpy(&Result, &Bits, sizeof(Result));
+    return Result;
+}
+
+uint8 FVertexQuantization::FloatToUNorm8(float Value)
+{
+    return static_cast<uint8>(std::lround(FMath::Clamp(Value, 0.0f, 1.0f) * 255.0f));
+}
+
+void FVertexQuantization::QuantizeBoneWeights(const float InWeights[4], uint8 OutWeights[4])
+{
+    float TotalWeight = 0.0f;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        TotalWeight += FMath::Max(InWeights[Index], 0.0f);
+    }
+
+    if (TotalWeight <= SMALL_NUMBER)
+    {
+        OutWeights[0] = OutWeights[1] = OutWeights[2] = OutWeights[3] = 0;
+        return;
+    }
+
+    float Remainders[4];
+    int32 QuantizedSum = 0;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        const float Scaled = FMath::Max(InWeights[Index], 0.0f) / TotalWeight * 255.0f;
+        const float Floored = FMath::Min(std::floor(Scaled), 255.0f);
+        OutWeights[Index] = static_cast<uint8>(Floored);
+        Remainders[Index] = Scaled - Floored;
+        QuantizedSum += OutWeights[Index];
+    }
+
+    for (int32 Missing = 255 - QuantizedSum; Missing > 0; --Missing)
+    {
+        int32 Largest = 0;
+        for (int32 Index = 1; Index < 4; ++Index)
+        {
+            if (Remainders[Index] > Remainders[Largest])
+            {
+                Largest = Index;
+            }
+        }
+        ++OutWeights[Largest];
+        Remainders[Largest] = -1.0f;
+    }
+}
+
+FPackedStaticMeshVertex FVertexQuantization::Pack(const FStaticMeshVertex& Vertex)
+{
+    FPackedStaticMeshVertex Packed;
+    Packed.X = Vertex.X;
+    Packed.Y = Vertex.Y;
+    Packed.Z = Vertex.Z;
+    Packed.Normal = EncodeOctahedron(FVector(Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ));
+    Packed.Tangent = EncodeTangent(FVector(Vertex.TangentX, Vertex.TangentY, Vertex.TangentZ), Vertex.TangentW);
+    Packed.U = FloatToHalf(Vertex.U);
+    Packed.V = FloatToHalf(Vertex.V);
+    Packed.Color[0] = FloatToUNorm8(Vertex.R);
+    Packed.Color[1] = FloatToUNorm8(Vertex.G);
+    Packed.Color[2] = FloatToUNorm8(Vertex.B);
+    Packed.Color[3] = FloatToUNorm8(Vertex.A);
+    return Packed;
+}
+
+FStaticMeshVertex FVertexQuantization::Unpack(const FPackedStaticMeshVertex& Packed)
+{
+    FStaticMeshVertex Vertex = {};
+    Vertex.X = Packed.X;
+    Vertex.Y = Packed.Y;
+    Vertex.Z = Packed.Z;
+    Vertex.R = UNorm8ToFloat(Packed.Color[0]);
+    Vertex.G = UNorm8ToFloat(Packed.Color[1]);
+    Vertex.B = UNorm8ToFloat(Packed.Color[2]);
+    Vertex.A = UNorm8ToFloat(Packed.Color[3]);
+
+    const FVector Normal = DecodeOctahedron(Packed.Normal);
+    Vertex.NormalX = Normal.X;
+    Vertex.NormalY = Normal.Y;
+    Vertex.NormalZ = Normal.Z;
+
+    const FVector Tangent = DecodeTangent(Packed.Tangent, Vertex.TangentW);
+    Vertex.TangentX = Tangent.X;
+    Vertex.TangentY = Tangent.Y;
+    Vertex.TangentZ = Tangent.Z;
+
+    Vertex.U = HalfToFloat(Packed.U);
+    Vertex.V = HalfToFloat(Packed.V);
+    return Vertex;
+}
+
+bool FVertexQuantization::Pack(const FSkeletalMeshVertex& Vertex, FPackedSkeletalMeshVertex& OutPacked)
+{
+    OutPacked.X = Vertex.X;
+    OutPacked.Y = Vertex.Y;
+    OutPacked.Z = Vertex.Z;
+    OutPacked.Normal = EncodeOctahedron(FVector(Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ));
+    OutPacked.Tangent = EncodeTangent(FVector(Vertex.TangentX, Vertex.TangentY, Vertex.TangentZ), Vertex.TangentW);
+    OutPacked.U = FloatToHalf(Vertex.U);
+    OutPacked.V = FloatToHalf(Vertex.V);
+    OutPacked.Color[0] = FloatToUNorm8(Vertex.R);
+    OutPacked.Color[1] = FloatToUNorm8(Vertex.G);
+    OutPacked.Color[2] = FloatToUNorm8(Vertex.B);
+    OutPacked.Color[3] = FloatToUNorm8(Vertex.A);
+
+    QuantizeBoneWeights(Vertex.BoneWeights, OutPacked.BoneWeights);
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        // 가중치가 0이 된 본은 셰이더에서 읽지 않음
+        if (OutPacked.BoneWeights[Index] == 0)
+        {
+            OutPacked.BoneIndices[Index] = 0;
+            continue;
+        }
+
+        if (Vertex.BoneIndices[Index] > 255)
+        {
+            return false;
+        }
+        OutPacked.BoneIndices[Index] = static_cast<uint8>(Vertex.BoneIndices[Index]);
+    }
+    return true;
+}
+
+FSkeletalMeshVertex FVertexQuantization::Unpack(const FPackedSkeletalMeshVertex& Packed)
+{
+    FSkeletalMeshVertex Vertex;
+    Vertex.X = Packed.X;
+    Vertex.Y = Packed.Y;
+    Vertex.Z = Packed.Z;
+    Vertex.R = UNorm8ToFloat(Packed.Color[0]);
+    Vertex.G = UNorm8ToFloat(Packed.Color[1]);
+    Vertex.B = UNorm8ToFloat(Packed.Color[2]);
+    Vertex.A = UNorm8ToFloat(Packed.Color[3]);
+
+    const FVector Normal = DecodeOctahedron(Packed.Normal);
+    Vertex.NormalX = Normal.X;
+    Vertex.NormalY = Normal.Y;
+    Vertex.NormalZ = Normal.Z;
+
+    const FVector Tangent = DecodeTangent(Packed.Tangent, Vertex.TangentW);
+    Vertex.TangentX = Tangent.X;
+    Vertex.TangentY = Tangent.Y;
+    Vertex.TangentZ = Tangent.Z;
+
+    Vertex.U = HalfToFloat(Packed.U);
+    Vertex.V = HalfToFloat(Packed.V);
+
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Vertex.BoneIndices[Index] = Packed.BoneIndices[Index];
+        Vertex.BoneWeights[Index] = UNorm8ToFloat(Packed.BoneWeights[Index]);
+    }
+    return Vertex;
+}
+
+void FVertexQuantization::PackVertices(const TArray<FStaticMeshVertex>& Vertices, TArray<FPackedStaticMeshVertex>& OutPacked)
+{
+    OutPacked.SetNum(Vertices.Num());
+    for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+    {
+        OutPacked[Index] = Pack(Vertices[Index]);
+    }
+}
+
+bool FVertexQuantization::PackVertices(const TArray<FSkeletalMeshVertex>& Vertices, TArray<FPackedSkeletalMeshVertex>& OutPacked)
+{
+    OutPacked.SetNum(Vertices.Num());
+    for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+    {
+        if (!Pack(Vertices[Index], OutPacked[Index]))
+        {
+            OutPacked.Empty();
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace
+{
+    /** 허용 오차, 노멀은 SNORM16 팔면체 매핑, 탄젠트는 UNORM15 팔면체 매핑의 양자화 간격에 여유를 둔 값 */
+    constexpr float MaxNormalErrorDegrees = 0.1f;
+    constexpr float MaxTangentErrorDegrees = 0.1f;
+    constexpr float MaxColorError = 0.5f / 255.0f + 1.0e-6f;
+    constexpr float MaxWeightError = 1.0f / 255.0f + 1.0e-6f;
+
+    constexpr int32 SkinningNumBones = 64;
+    constexpr int32 SkinningNumRepeats = 10;
+
+    /** 회전과 이동만 있는 본 행렬, 행마다 (회전 3열, 이동 1열) */
+    struct FSkinningBone
+    {
+        float M[3][4];
+    };
+
+    float AngleBetweenDegrees(const FVector& A, const FVector& B)
+    {
+        const float Dot = FMath::Clamp(A.GetSafeNormal().Dot(B.GetSafeNormal()), -1.0f, 1.0f);
+        return FMath::RadiansToDegrees(FMath::Acos(Dot));
+    }
+
+    FVector RandomUnitVector(std::mt19937& Random)
+    {
+        std::uniform_real_distribution<float> Component(-1.0f, 1.0f);
+        while (true)
+        {
+            const FVector Candidate(Component(Random), Component(Random), Component(Random));
+            const float SizeSquared = Candidate.SizeSquared();
+            if (SizeSquared > 1.0e-4f && SizeSquared <= 1.0f)
+            {
+                return Candidate / FMath::Sqrt(SizeSquared);
+            }
+        }
+    }
+
+    /** 1~4개의 본에 가중치가 있고 UV는 타일링을 포함한 범위의 버텍스 */
+    FSkeletalMeshVertex MakeRandomVertex(std::mt19937& Random)
+    {
+        std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+        std::uniform_real_distribution<float> Position(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> TexCoord(-4.0f, 4.0f);
+        std::uniform_int_distribution<int32> Bone(0, SkinningNumBones - 1);
+        std::uniform_int_distribution<int32> NumInfluences(1, 4);
+
+        FSkeletalMeshVertex Vertex;
+        Vertex.X = Position(Random);
+        Vertex.Y = Position(Random);
+        Vertex.Z = Position(Random);
+        Vertex.R = Unit(Random);
+        Vertex.G = Unit(Random);
+        Vertex.B = Unit(Random);
+        Vertex.A = Unit(Random);
+
+        const FVector Normal = RandomUnitVector(Random);
+        Vertex.NormalX = Normal.X;
+        Vertex.NormalY = Normal.Y;
+        Vertex.NormalZ = Normal.Z;
+
+        const FVector Tangent = RandomUnitVector(Random);
+        Vertex.TangentX = Tangent.X;
+        Vertex.TangentY = Tangent.Y;
+        Vertex.TangentZ = Tangent.Z;
+        Vertex.TangentW = Unit(Random) < 0.5f ? -1.0f : 1.0f;
+
+        Vertex.U = TexCoord(Random);
+        Vertex.V = TexCoord(Random);
+
+        const int32 Influences = NumInfluences(Random);
+        float TotalWeight = 0.0f;
+        for (int32 Index = 0; Index < Influences; ++Index)
+        {
+            Vertex.BoneIndices[Index] = static_cast<uint32>(Bone(Random));
+            Vertex.BoneWeights[Index] = Unit(Random) + 0.01f;
+            TotalWeight += Vertex.BoneWeights[Index];
+        }
+        for (int32 Index = 0; Index < Influences; ++Index)
+        {
+            Vertex.BoneWeights[Index] /= TotalWeight;
+        }
+        return Vertex;
+    }
+
+    /** 한 버텍스에 영향을 주는 본들은 실제 스켈레톤처럼 서로 크게 다르지 않도록 ±0.5 라디안 안에서 회전 */
+    FSkinningBone MakeRandomBone(std::mt19937& Random)
+    {
+        std::uniform_real_distribution<float> Angle(-0.5f, 0.5f);
+        std::uniform_real_distribution<float> Offset(-10.0f, 10.0f);
+
+        const FQuat Rotation(RandomUnitVector(Random), Angle(Random));
+        const FVector Axes[3] = {
+            Rotation.RotateVector(FVector(1.0f, 0.0f, 0.0f)),
+            Rotation.RotateVector(FVector(0.0f, 1.0f, 0.0f)),
+            Rotation.RotateVector(FVector(0.0f, 0.0f, 1.0f)),
+        };
+        const float Translation[3] = { Offset(Random), Offset(Random), Offset(Random) };
+
+        FSkinningBone Bone;
+        for (int32 Row = 0; Row < 3; ++Row)
+        {
+            Bone.M[Row][0] = Axes[0][Row];
+            Bone.M[Row][1] = Axes[1][Row];
+            Bone.M[Row][2] = Axes[2][Row];
+            Bone.M[Row][3] = Translation[Row];
+        }
+        return Bone;
+    }
+
+    /** 셰이더의 스키닝과 같이 가중치로 행렬을 섞은 뒤 위치와 노멀을 변환 */
+    void SkinVertex(
+        const FSkinningBone* Bones, const uint32 BoneIndices[4], const float BoneWeights[4],
+        const FVector& Position, const FVector& Normal, FVector& OutPosition, FVector& OutNormal
+    )
+    {
+        float Blend[3][4] = {};
+        for (int32 Influence = 0; Influence < 4; ++Influence)
+        {
+            const float Weight = BoneWeights[Influence];
+            if (Weight <= 0.0f)
+            {
+                continue;
+            }
+
+            const FSkinningBone& Bone = Bones[BoneIndices[Influence]];
+            for (int32 Row = 0; Row < 3; ++Row)
+            {
+                for (int32 Column = 0; Column < 4; ++Column)
+                {
+                    Blend[Row][Column] += Bone.M[Row][Column] * Weight;
+                }
+            }
+        }
+
+        OutPosition = FVector(
+            Blend[0][0] * Position.X + Blend[0][1] * Position.Y + Blend[0][2] * Position.Z + Blend[0][3],
+            Blend[1][0] * Position.X + Blend[1][1] * Position.Y + Blend[1][2] * Position.Z + Blend[1][3],
+            Blend[2][0] * Position.X + Blend[2][1] * Position.Y + Blend[2][2] * Position.Z + Blend[2][3]
+        );
+        OutNormal = FVector(
+            Blend[0][0] * Normal.X + Blend[0][1] * Normal.Y + Blend[0][2] * Normal.Z,
+            Blend[1][0] * Normal.X + Blend[1][1] * Normal.Y + Blend[1][2] * Normal.Z,
+            Blend[2][0] * Normal.X + Blend[2][1] * Normal.Y + Blend[2][2] * Normal.Z
+        );
+    }
+
+    void SkinFullVertices(const TArray<FSkeletalMeshVertex>& Vertices, const FSkinningBone* Bones, TArray<FVector>& OutPositions, TArray<FVector>& OutNormals)
+    {
+        for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+        {
+            const FSkeletalMeshVertex& Vertex = Vertices[Index];
+            SkinVertex(
+                Bones, Vertex.BoneIndices, Vertex.BoneWeights,
+                FVector(Vertex.X, Vertex.Y, Vertex.Z), FVector(Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ),
+                OutPositions[Index], OutNormals[Index]
+            );
+        }
+    }
+
+    /** 셰이더의 PACKED_VERTEX 경로와 같이 읽을 때 복원 */
+    void SkinPackedVertices(const TArray<FPackedSkeletalMeshVertex>& Vertices, const FSkinningBone* Bones, TArray<FVector>& OutPositions, TArray<FVector>& OutNormals)
+    {
+        for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+        {
+            const FPackedSkeletalMeshVertex& Vertex = Vertices[Index];
+
+            uint32 BoneIndices[4];
+            float BoneWeights[4];
+            for (int32 Influence = 0; Influence < 4; ++Influence)
+            {
+                BoneIndices[Influence] = Vertex.BoneIndices[Influence];
+                BoneWeights[Influence] = FVertexQuantization::UNorm8ToFloat(Vertex.BoneWeights[Influence]);
+            }
+
+            SkinVertex(
+                Bones, BoneIndices, BoneWeights,
+                FVector(Vertex.X, Vertex.Y, Vertex.Z), FVertexQuantization::DecodeOctahedron(Vertex.Normal),
+                OutPositions[Index], OutNormals[Index]
+            );
+        }
+    }
+}
+
+bool FVertexQuantization::RunSelfTest(int32 NumVertices)
+{
+    if (NumVertices <= 0)
+    {
+        return false;
+    }
+
+    std::mt19937 Random(1234);
+
+    TArray<FSkeletalMeshVertex> Vertices;
+    Vertices.SetNum(NumVertices);
+    for (FSkeletalMeshVertex& Vertex : Vertices)
+    {
+        Vertex = MakeRandomVertex(Random);
+    }
+
+    TArray<FPackedSkeletalMeshVertex> PackedVertices;
+    if (!PackVertices(Vertices, PackedVertices))
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Vertex quantization test: failed to pack vertices"));
+        return false;
+    }
+
+    // 왕복 오차
+    float MaxNormalError = 0.0f;
+    float MaxTangentError = 0.0f;
+    float MaxUVRelativeError = 0.0f;
+    float MaxColorErrorFound = 0.0f;
+    float MaxWeightErrorFound = 0.0f;
+    int32 NumTangentSignFlips = 0;
+    int32 NumBadUVs = 0;
+    int32 NumBadWeights = 0;
+
+    for (int32 Index = 0; Index < NumVertices; ++Index)
+    {
+        const FSkeletalMeshVertex& Original = Vertices[Index];
+        const FSkeletalMeshVertex Decoded = Unpack(PackedVertices[Index]);
+
+        MaxNormalError = FMath::Max(MaxNormalError, AngleBetweenDegrees(
+            FVector(Original.NormalX, Original.NormalY, Original.NormalZ), FVector(Decoded.NormalX, Decoded.NormalY, Decoded.NormalZ)
+        ));
+        MaxTangentError = FMath::Max(MaxTangentError, AngleBetweenDegrees(
+            FVector(Original.TangentX, Original.TangentY, Original.TangentZ), FVector(Decoded.TangentX, Decoded.TangentY, Decoded.TangentZ)
+        ));
+        NumTangentSignFlips += (Original.TangentW < 0.0f) != (Decoded.TangentW < 0.0f) ? 1 : 0;
+
+        // half는 가수 10비트이므로 반올림 오차는 값의 2^-11 이하
+        const float UVs[2][2] = { { Original.U, Decoded.U }, { Original.V, Decoded.V } };
+        for (const auto& UV : UVs)
+        {
+            const float Error = FMath::Abs(UV[0] - UV[1]);
+            const float Allowed = FMath::Max(FMath::Abs(UV[0]) / 2048.0f, 1.0f / 16777216.0f);
+            MaxUVRelativeError = FMath::Max(MaxUVRelativeError, Error / FMath::Max(FMath::Abs(UV[0]), 1.0f / 16384.0f));
+            NumBadUVs += Error <= Allowed ? 0 : 1;
+        }
+
+        const float Colors[4][2] = { { Original.R, Decoded.R }, { Original.G, Decoded.G }, { Original.B, Decoded.B }, { Original.A, Decoded.A } };
+        for (const auto& Color : Colors)
+        {
+            MaxColorErrorFound = FMath::Max(MaxColorErrorFound, FMath::Abs(Color[0] - Color[1]));
+        }
+
+        int32 WeightSum = 0;
+        bool bWeightsValid = true;
+        for (int32 Influence = 0; Influence < 4; ++Influence)
+        {
+            const uint8 PackedWeight = PackedVertices[Index].BoneWeights[Influence];
+            WeightSum += PackedWeight;
+            MaxWeightErrorFound = FMath::Max(MaxWeightErrorFound, FMath::Abs(Original.BoneWeights[Influence] - Decoded.BoneWeights[Influence]));
+            bWeightsValid &= PackedWeight == 0 || Decoded.BoneIndices[Influence] == Original.BoneIndices[Influence];
+        }
+        NumBadWeights += bWeightsValid && WeightSum == 255 ? 0 : 1;
+    }
+
+    const bool bPassed = MaxNormalError <= MaxNormalErrorDegrees
+        && MaxTangentError <= MaxTangentErrorDegrees
+        && NumTangentSignFlips == 0
+        && NumBadUVs == 0
+        && MaxColorErrorFound <= MaxColorError
+        && MaxWeightErrorFound <= MaxWeightError
+        && NumBadWeights == 0;
+
+    UE_LOG(
+        bPassed ? ELogLevel::Display : ELogLevel::Error,
+        TEXT("Vertex quantization test %s: %d vertices, normal %.4f deg, tangent %.4f deg (%d sign flips), UV %.2e relative (%d out of range), color %.5f, weight %.5f (%d bad weight sets)"),
+        bPassed ? TEXT("PASS") : TEXT("FAIL"), NumVertices,
+        MaxNormalError, MaxTangentError, NumTangentSignFlips, MaxUVRelativeError, NumBadUVs, MaxColorErrorFound, MaxWeightErrorFound, NumBadWeights
+    );
+
+    // 메모리
+    const uint64 FullBytes = static_cast<uint64>(NumVertices) * sizeof(FSkeletalMeshVertex);
+    const uint64 PackedBytes = static_cast<uint64>(NumVertices) * sizeof(FPackedSkeletalMeshVertex);
+    UE_LOG(
+        ELogLevel::Display, TEXT("Vertex quantization memory: full %d bytes/vertex (%.2f MB), packed %d bytes/vertex (%.2f MB), x%.2f"),
+        static_cast<int32>(sizeof(FSkeletalMeshVertex)), static_cast<double>(FullBytes) / (1024.0 * 1024.0),
+        static_cast<int32>(sizeof(FPackedSkeletalMeshVertex)), static_cast<double>(PackedBytes) / (1024.0 * 1024.0),
+        static_cast<double>(FullBytes) / static_cast<double>(PackedBytes)
+    );
+
+    // 스키닝 처리량
+    FSkinningBone Bones[SkinningNumBones];
+    for (FSkinningBone& Bone : Bones)
+    {
+        Bone = MakeRandomBone(Random);
+    }
+
+    TArray<FVector> FullPositions;
+    TArray<FVector> FullNormals;
+    TArray<FVector> PackedPositions;
+    TArray<FVector> PackedNormals;
+    FullPositions.SetNum(NumVertices);
+    FullNormals.SetNum(NumVertices);
+    PackedPositions.SetNum(NumVertices);
+    PackedNormals.SetNum(NumVertices);
+
+    double FullMs = 0.0;
+    double PackedMs = 0.0;
+    for (int32 Repeat = 0; Repeat < SkinningNumRepeats; ++Repeat)
+    {
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        SkinFullVertices(Vertices, Bones, FullPositions, FullNormals);
+        const double RepeatFullMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        StartCycles = FPlatformTime::Cycles64();
+        SkinPackedVertices(PackedVertices, Bones, PackedPositions, PackedNormals);
+        const double RepeatPackedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        FullMs = Repeat == 0 ? RepeatFullMs : FMath::Min(FullMs, RepeatFullMs);
+        PackedMs = Repeat == 0 ? RepeatPackedMs : FMath::Min(PackedMs, RepeatPackedMs);
+    }
+
+    float MaxPositionDifference = 0.0f;
+    float MaxNormalDifference = 0.0f;
+    for (int32 Index = 0; Index < NumVertices; ++Index)
+    {
+        MaxPositionDifference = FMath::Max(MaxPositionDifference, (FullPositions[Index] - PackedPositions[Index]).Length());
+        MaxNormalDifference = FMath::Max(MaxNormalDifference, AngleBetweenDegrees(FullNormals[Index], PackedNormals[Index]));
+    }
+
+    UE_LOG(
+        ELogLevel::Display,
+        TEXT("Vertex quantization skinning (%d bones): full %.3f ms (%.2f ns/vertex), packed %.3f ms (%.2f ns/vertex), x%.2f, max difference position %.4f normal %.3f deg"),
+        SkinningNumBones, FullMs, FullMs * 1.0e6 / NumVertices, PackedMs, PackedMs * 1.0e6 / NumVertices, PackedMs > 0.0 ? FullMs / PackedMs : 0.0,
+        MaxPositionDifference, MaxNormalDifference
+    );
+
+    return bPassed;
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Vector.h"
+#include "Serialization/Archive.h"
+
+struct FStaticMeshVertex;
+struct FSkeletalMeshVertex;
+
+/**
+ * FStaticMeshVertex의 압축 형식, 68바이트 → 28바이트
+ * 노멀과 탄젠트는 팔면체 매핑, UV는 half, 색상은 UNORM8로 저장하며 셰이더에서 복원합니다.
+ */
+struct FPackedStaticMeshVertex
+{
+    float X = 0.f, Y = 0.f, Z = 0.f;
+
+    /** R16G16_SNORM, 팔면체 매핑한 노멀 */
+    uint32 Normal = 0;
+
+    /** R32_UINT, FVertexQuantization::EncodeTangent 참고 */
+    uint32 Tangent = 0;
+
+    /** R16G16_FLOAT */
+    uint16 U = 0, V = 0;
+
+    /** R8G8B8A8_UNORM */
+    uint8 Color[4] = { 0, 0, 0, 0 };
+
+    friend FArchive& operator<<(FArchive& Ar, FPackedStaticMeshVertex& Data)
+    {
+        return Ar << Data.X << Data.Y << Data.Z
+                  << Data.Normal << Data.Tangent
+                  << Data.U << Data.V
+                  << Data.Color[0] << Data.Color[1] << Data.Color[2] << Data.Color[3];
+    }
+};
+
+/** FSkeletalMeshVertex의 압축 형식, 96바이트 → 36바이트, 본은 255개까지 */
+struct FPackedSkeletalMeshVertex
+{
+    float X = 0.f, Y = 0.f, Z = 0.f;
+    uint32 Normal = 0;
+    uint32 Tangent = 0;
+    uint16 U = 0, V = 0;
+    uint8 Color[4] = { 0, 0, 0, 0 };
+
+    /** R8G8B8A8_UINT */
+    uint8 BoneIndices[4] = { 0, 0, 0, 0 };
+
+    /** R8G8B8A8_UNORM, 합이 0이 아니라면 항상 255 */
+    uint8 BoneWeights[4] = { 0, 0, 0, 0 };
+
+    friend FArchive& operator<<(FArchive& Ar, FPackedSkeletalMeshVertex& Data)
+    {
+        return Ar << Data.X << Data.Y << Data.Z
+                  << Data.Normal << Data.Tangent
+                  << Data.U << Data.V
+                  << Data.Color[0] << Data.Color[1] << Data.Color[2] << Data.Color[3]
+                  << Data.BoneIndices[0] << Data.BoneIndices[1] << Data.BoneIndices[2] << Data.BoneIndices[3]
+                  << Data.BoneWeights[0] << Data.BoneWeights[1] << Data.BoneWeights[2] << Data.BoneWeights[3];
+    }
+};
+
+static_assert(sizeof(FPackedStaticMeshVertex) == 28);
+static_assert(sizeof(FPackedSkeletalMeshVertex) == 36);
+
+/** 버텍스 속성의 양자화와 복원, 셰이더의 복원 코드는 ShaderRegisters.hlsl */
+struct FVertexQuantization
+{
+    /** 단위 벡터를 팔면체 매핑한 SNORM16 두 개, 하위 16비트가 X */
+    static uint32 EncodeOctahedron(const FVector& Normal);
+    static FVector DecodeOctahedron(uint32 Packed);
+
+    /** 팔면체 매핑한 탄젠트를 UNORM15 두 개로 0~29번 비트에 저장하고, 30번 비트는 Bitangent 부호(Sign < 0) */
+    static uint32 EncodeTangent(const FVector& Tangent, float Sign);
+    static FVector DecodeTangent(uint32 Packed, float& OutSign);
+
+    /** IEEE 754 binary16, 가장 가까운 짝수로 반올림 */
+    static uint16 FloatToHalf(float Value);
+    static float HalfToFloat(uint16 Value);
+
+    static uint8 FloatToUNorm8(float Value);
+    static float UNorm8ToFloat(uint8 Value) { return static_cast<float>(Value) / 255.0f; }
+
+    /** 합이 정확히 255가 되도록 정규화해서 양자화, 버림으로 모자란 만큼은 버린 값이 큰 가중치부터 1씩 더함 */
+    static void QuantizeBoneWeights(const float InWeights[4], uint8 OutWeights[4]);
+
+    static FPackedStaticMeshVertex Pack(const FStaticMeshVertex& Vertex);
+    static FStaticMeshVertex Unpack(const FPackedStaticMeshVertex& Packed);
+
+    /** 가중치가 있는 본 인덱스가 255를 넘으면 false */
+    static bool Pack(const FSkeletalMeshVertex& Vertex, FPackedSkeletalMeshVertex& OutPacked);
+    static FSkeletalMeshVertex Unpack(const FPackedSkeletalMeshVertex& Packed);
+
+    static void PackVertices(const TArray<FStaticMeshVertex>& Vertices, TArray<FPackedStaticMeshVertex>& OutPacked);
+
+    /** 하나라도 압축할 수 없는 버텍스가 있으면 OutPacked를 비우고 false */
+    static bool PackVertices(const TArray<FSkeletalMeshVertex>& Vertices, TArray<FPackedSkeletalMeshVertex>& OutPacked);
+
+    /**
+     * 무작위 스켈레탈 버텍스 NumVertices개로 압축 형식을 검사하고 로그로 출력합니다.
+     * - 노멀, 탄젠트, UV, 색상, 본 가중치의 왕복 오차를 허용 범위와 비교
+     * - 두 형식의 버텍스 메모리
+     * - 같은 버텍스를 두 형식에서 CPU로 Linear Blend Skinning하는 시간과 결과 차이
+     * @return 왕복 오차가 모두 허용 범위 안이면 true
+     */
+    static bool RunSelfTest(int32 NumVertices);
+};
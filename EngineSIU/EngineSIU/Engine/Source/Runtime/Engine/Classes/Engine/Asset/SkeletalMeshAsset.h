@@ -3,6 +3,7 @@
 #include "Define.h"
 #include "Hal/PlatformType.h"
 #include "Container/Array.h"
+#include "PackedMeshVertex.h"
 
 struct FSkeletalMeshVertex
 {
@@ -40,6 +41,9 @@ struct FSkeletalMeshRenderData
     FVector BoundingBoxMin;
     FVector BoundingBoxMax;
 
+    /** GPU 스키닝용 압축 버텍스, 본이 255개를 넘는 메시는 비어있음 */
+    TArray<FPackedSkeletalMeshVertex> PackedVertices;
+
     void Serialize(FArchive& Ar)
     {
         FString ObjectNameStr;
@@ -55,7 +59,8 @@ struct FSkeletalMeshRenderData
            << Materials
            << MaterialSubsets
            << BoundingBoxMin
-           << BoundingBoxMax;
+           << BoundingBoxMax
+           << PackedVertices;
 
         ObjectName = ObjectNameStr.ToWideString();
     }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "Define.h"
 #include "Hal/PlatformType.h"
 #include "Container/Array.h"
@@ -38,6 +40,23 @@ struct FStaticMeshRenderData
     FVector BoundingBoxMin;
     FVector BoundingBoxMax;
 
+    /** 이 LOD가 사용되기 시작하는 화면 크기, 경계 구의 지름이 화면 높이에서 차지하는 비율 */
+    float ScreenSize = 1.0f;
+
+    /** LOD1부터, LOD0은 자기 자신 */
+    TArray<std::shared_ptr<FStaticMeshRenderData>> LODs;
+
+    int32 GetNumLODs() const { return LODs.Num() + 1; }
+
+    const FStaticMeshRenderData* GetLOD(int32 LODIndex) const
+    {
+        if (LODIndex <= 0 || LODs.IsEmpty())
+        {
+            return this;
+        }
+        return LODs[FMath::Min(LODIndex, LODs.Num()) - 1].get();
+    }
+
     void Serialize(FArchive& Ar)
     {
         FString ObjectNameStr = ObjectName;
@@ -49,8 +68,26 @@ struct FStaticMeshRenderData
            << Materials
            << MaterialSubsets
            << BoundingBoxMin
-           << BoundingBoxMax;
+           << BoundingBoxMax
+           << ScreenSize;
 
         ObjectName = ObjectNameStr.ToWideString();
+
+        int32 NumLODs = LODs.Num();
+        Ar << NumLODs;
+
+        if (Ar.IsLoading())
+        {
+            LODs.SetNum(NumLODs);
+        }
+
+        for (std::shared_ptr<FStaticMeshRenderData>& LOD : LODs)
+        {
+            if (!LOD)
+            {
+                LOD = std::make_shared<FStaticMeshRenderData>();
+            }
+            LOD->Serialize(Ar);
+        }
     }
 };
@@ -392,7 +392,11 @@ bool UAssetManager::LoadFbxBinary(const FString& FilePath, FAssetLoadResult& Res
 
     FMemoryReader Reader(LoadData);
 
-    SerializeVersion(Reader);
+    // 버전이 다르면 FBX에서 다시 읽어 새 형식으로 저장
+    if (!SerializeVersion(Reader))
+    {
+        return false;
+    }
     SerializeAssetLoadResult(Reader, Result, BaseName, FolderPath);
 
     return true;
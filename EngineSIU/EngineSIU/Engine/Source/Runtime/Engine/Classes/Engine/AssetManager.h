@@ -116,7 +116,7 @@ private:
 
     bool SaveFbxBinary(const FString& FilePath, FAssetLoadResult& Result, const FString& BaseName, const FString& FolderPath);
 
-    static constexpr uint32 Version = 1;
+    static constexpr uint32 Version = 4;
 
     bool SerializeVersion(FArchive& Ar);
 
@@ -19,6 +19,8 @@
 #include "UnrealEd/UnrealEd.h"
 #include "World/ParticleViewerWorld.h"
 #include "Engine/PhysicsManager.h"
+#include "UObject/ObjectArena.h"
+#include "World/WorldSnapshot.h"
 
 extern FEngineLoop GEngineLoop;
 
@@ -79,18 +81,7 @@ void UEditorEngine::Tick(float DeltaTime)
                 // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
                 World->Tick(DeltaTime);
                 EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+                World->RunTickGroups(DeltaTime, true, false);
                 //if (DeltaTime > 0.f)
                 //    UPhysicsManager::Get().Simulate(DeltaTime);
             }
@@ -100,20 +91,7 @@ void UEditorEngine::Tick(float DeltaTime)
             if (UWorld* World = WorldContext->World())
             {
                 World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor)
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
-                if (DeltaTime > 0.f)
-                    UPhysicsManager::Get().Simulate(DeltaTime);
+                World->RunTickGroups(DeltaTime, false, DeltaTime > 0.f);
             }
         }
         else if (WorldContext->WorldType == EWorldType::SkeletalViewer)
@@ -122,18 +100,7 @@ void UEditorEngine::Tick(float DeltaTime)
             {
                 World->Tick(DeltaTime);
                 EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+                World->RunTickGroups(DeltaTime, true, false);
             }
         }
         else if (WorldContext->WorldType == EWorldType::ParticleViewer)
@@ -142,18 +109,7 @@ void UEditorEngine::Tick(float DeltaTime)
             {
                 World->Tick(DeltaTime);
                 EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+                World->RunTickGroups(DeltaTime, true, false);
             }
         }
     }
@@ -175,7 +131,11 @@ void UEditorEngine::StartPIE()
 
     FWorldContext& PIEWorldContext = CreateNewWorldContext(EWorldType::PIE);
 
-    PIEWorld = Cast<UWorld>(EditorWorld->Duplicate(this));
+    // EditorWorld를 한 번에 Serialize하고, 그 크기에 맞춘 Arena에서 PIE 객체를 모두 할당
+    FWorldSnapshot Snapshot;
+    Snapshot.Capture(EditorWorld);
+    PIEObjectArena = new FObjectArena(Snapshot.GetObjectMemorySize());
+    PIEWorld = Snapshot.Instantiate(this, PIEObjectArena);
     PIEWorld->WorldType = EWorldType::PIE;
 
     PIEWorldContext.SetCurrentWorld(PIEWorld);
@@ -435,9 +395,17 @@ void UEditorEngine::EndPIE()
     {
         this->ClearActorSelection(); // PIE World 기준 Select Actor 해제 
         WorldList.Remove(GetWorldContextFromWorld(PIEWorld));
-        PIEWorld->Release();
-        GUObjectArray.MarkRemoveObject(PIEWorld);
-        PIEWorld = nullptr;
+        {
+            // World 객체까지 바로 해제해서 아레나가 비워질 때까지의 삭제 로그를 모두 생략
+            FScopedObjectLogSuppression LogSuppression;
+            PIEWorld->Release();
+            GUObjectArray.MarkRemoveObject(PIEWorld);
+            GUObjectArray.ProcessPendingDestroyObjects(PIEWorld, PIEObjectArena);
+            PIEWorld = nullptr;
+
+            PIEObjectArena->ReleaseWhenEmpty();
+            PIEObjectArena = nullptr;
+        }
 
         // TODO: PIE에서 EditorWorld로 돌아올 때, 기존 선택된 Picking이 유지되어야 함. 현재는 에러를 막기위해 임시조치.
         ClearActorSelection();
@@ -12,6 +12,7 @@
 
 class UParticleViewerWorld;
 class UParticleSystem;
+class FObjectArena;
 class AActor;
 class USceneComponent;
 
@@ -79,6 +80,10 @@ public:
     
 private:
     AEditorPlayer* EditorPlayer = nullptr;
+
+    /** PIE를 시작할 때 복제한 객체들의 메모리, PIEWorld의 객체가 모두 해제되면 함께 해제됨 */
+    FObjectArena* PIEObjectArena = nullptr;
+
     FVector CameraLocation;
     FVector CameraRotation;
 };
@@ -36,3 +36,18 @@ namespace ECollisionEnabled
         QueryAndProbe
     };
 }
+
+/** Tick이 실행되는 단계. 값이 작은 그룹부터 순서대로 실행됩니다. */
+enum ETickingGroup : uint8
+{
+    /** Physics 시뮬레이션이 시작되기 전에 실행됩니다. */
+    TG_PrePhysics,
+    /** Physics 시뮬레이션과 동시에 실행됩니다. 이 그룹에서는 Physics Body를 변경하면 안 됩니다. */
+    TG_DuringPhysics,
+    /** Physics 시뮬레이션 결과가 반영된 이후에 실행됩니다. */
+    TG_PostPhysics,
+    /** 모든 업데이트가 끝난 뒤, 렌더링 직전에 실행됩니다. */
+    TG_PostUpdateWork,
+
+    TG_MAX,
+};
@@ -0,0 +1,372 @@
+#include "EventManager.h"
+#include <atomic>
+#include <functional>
+
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformMemory.h"
+#include "WindowsPlatformTime.h"
+
+uint32 FEventTypeRegistry::AllocateId()
+{
+    static std::atomic<uint32> NextId = 0;
+    return NextId.fetch_add(1, std::memory_order_relaxed);
+}
+
+FEventArena::FEventArena(size_t InBlockSize)
+    : BlockSize(InBlockSize)
+{
+}
+
+FEventArena::~FEventArena()
+{
+    Release();
+}
+
+void* FEventArena::Allocate(size_t Size, size_t Alignment)
+{
+    while (CurrentBlock < Blocks.Num())
+    {
+        const FBlock& Block = Blocks[CurrentBlock];
+        const size_t AlignedOffset = (Offset + Alignment - 1) & ~(Alignment - 1);
+        if (AlignedOffset + Size <= Block.Size)
+        {
+            Offset = AlignedOffset + Size;
+            return Block.Data + AlignedOffset;
+        }
+        ++CurrentBlock;
+        Offset = 0;
+    }
+
+    // 남은 블록이 없을 때만 새로 할당, BlockSize보다 큰 이벤트는 그 크기만큼의 블록을 만듦
+    FBlock NewBlock;
+    NewBlock.Size = Size > BlockSize ? Size : BlockSize;
+    NewBlock.Data = static_cast<uint8*>(FPlatformMemory::AlignedMalloc<EAT_Container>(NewBlock.Size, MaxAlignment));
+    CurrentBlock = Blocks.Add(NewBlock);
+    Offset = Size;
+    return NewBlock.Data;
+}
+
+void FEventArena::Reset()
+{
+    CurrentBlock = 0;
+    Offset = 0;
+}
+
+void FEventArena::Release()
+{
+    for (const FBlock& Block : Blocks)
+    {
+        FPlatformMemory::AlignedFree<EAT_Container>(Block.Data, Block.Size);
+    }
+    Blocks.Empty();
+    Reset();
+}
+
+size_t FEventArena::GetCapacityBytes() const
+{
+    size_t Capacity = 0;
+    for (const FBlock& Block : Blocks)
+    {
+        Capacity += Block.Size;
+    }
+    return Capacity;
+}
+
+uint32 FEventChannelBase::AllocateSlot()
+{
+    uint32 Slot;
+    if (DispatchDepth == 0 && FreeSlots.Num() > 0)
+    {
+        Slot = FreeSlots.Pop();
+    }
+    else
+    {
+        Slot = static_cast<uint32>(SlotStates.Add(FSlotState()));
+    }
+    SlotStates[Slot].bActive = true;
+    ++NumSubscribers;
+    return Slot;
+}
+
+bool FEventChannelBase::Unsubscribe(uint32 Slot, uint32 Generation)
+{
+    if (std::cmp_greater_equal(Slot, SlotStates.Num()))
+    {
+        return false;
+    }
+    const FSlotState& State = SlotStates[Slot];
+    if (!State.bActive || State.Generation != Generation)
+    {
+        return false;
+    }
+    DeactivateSlot(Slot);
+    return true;
+}
+
+void FEventChannelBase::UnsubscribeAll()
+{
+    for (int32 Slot = 0; Slot < SlotStates.Num(); ++Slot)
+    {
+        if (SlotStates[Slot].bActive)
+        {
+            DeactivateSlot(Slot);
+        }
+    }
+}
+
+void FEventChannelBase::DeactivateSlot(uint32 Slot)
+{
+    FSlotState& State = SlotStates[Slot];
+    State.bActive = false;
+    ++State.Generation;
+    if (State.Generation == 0)
+    {
+        State.Generation = 1;
+    }
+    --NumSubscribers;
+
+    // 실행 중인 핸들러가 자기 자신을 해제할 수 있으므로 디스패치가 끝날 때까지 핸들러를 남겨둠
+    if (DispatchDepth > 0)
+    {
+        PendingReleaseSlots.Add(Slot);
+    }
+    else
+    {
+        ReleaseSlot(Slot);
+        FreeSlots.Add(Slot);
+    }
+}
+
+void FEventChannelBase::EndDispatch()
+{
+    if (--DispatchDepth > 0)
+    {
+        return;
+    }
+
+    for (uint32 Slot : PendingReleaseSlots)
+    {
+        ReleaseSlot(Slot);
+        FreeSlots.Add(Slot);
+    }
+    PendingReleaseSlots.Empty();
+}
+
+FEventManager::~FEventManager()
+{
+    ResetQueue(Queues[0]);
+    ResetQueue(Queues[1]);
+    for (FEventChannelBase* Channel : Channels)
+    {
+        delete Channel;
+    }
+    Channels.Empty();
+}
+
+bool FEventManager::Unsubscribe(FEventHandle& Handle)
+{
+    if (!Handle.IsValid())
+    {
+        return false;
+    }
+
+    bool bRemoved = false;
+    if (std::cmp_less(Handle.TypeId, Channels.Num()) && Channels[Handle.TypeId])
+    {
+        bRemoved = Channels[Handle.TypeId]->Unsubscribe(Handle.Slot, Handle.Generation);
+    }
+    Handle.Invalidate();
+    return bRemoved;
+}
+
+void FEventManager::FlushQueuedEvents()
+{
+    // 핸들러 안에서 다시 Flush를 부르면 무시, 그 사이에 넣은 이벤트는 다음 Flush에서 처리됨
+    if (bFlushing)
+    {
+        return;
+    }
+    bFlushing = true;
+
+    // 워커가 넣는 이벤트는 바꾼 뒤의 쓰기 큐로 가므로 읽기 큐는 잠그지 않고 전달
+    FEventQueue* QueuePtr = nullptr;
+    {
+        std::lock_guard Lock(QueueMutex);
+        QueuePtr = &Queues[WriteQueueIndex];
+        WriteQueueIndex ^= 1;
+    }
+    FEventQueue& Queue = *QueuePtr;
+
+    for (FQueuedEvent* Record = Queue.Head; Record; Record = Record->Next)
+    {
+        Record->Dispatch(*this, Record->Payload);
+    }
+    NumFlushedEvents = Queue.NumEvents;
+    ResetQueue(Queue);
+
+    bFlushing = false;
+}
+
+void FEventManager::ResetQueue(FEventQueue& Queue)
+{
+    for (FQueuedEvent* Record = Queue.Head; Record; Record = Record->Next)
+    {
+        if (Record->Destroy)
+        {
+            Record->Destroy(Record->Payload);
+        }
+    }
+    Queue.Head = nullptr;
+    Queue.Tail = nullptr;
+    Queue.NumEvents = 0;
+    Queue.Arena.Reset();
+}
+
+void FEventManager::Clear()
+{
+    {
+        std::lock_guard Lock(QueueMutex);
+        ResetQueue(Queues[0]);
+        ResetQueue(Queues[1]);
+    }
+    for (FEventChannelBase* Channel : Channels)
+    {
+        if (Channel)
+        {
+            Channel->UnsubscribeAll();
+        }
+    }
+}
+
+FEventManagerStats FEventManager::GetStats() const
+{
+    FEventManagerStats Stats;
+    for (const FEventChannelBase* Channel : Channels)
+    {
+        if (Channel)
+        {
+            ++Stats.NumChannels;
+            Stats.NumSubscribers += Channel->GetNumSubscribers();
+        }
+    }
+    Stats.NumQueuedEvents = NumFlushedEvents;
+
+    std::lock_guard Lock(QueueMutex);
+    for (const FEventQueue& Queue : Queues)
+    {
+        Stats.NumArenaBlocks += Queue.Arena.GetNumBlocks();
+        Stats.ArenaCapacityBytes += Queue.Arena.GetCapacityBytes();
+    }
+    return Stats;
+}
+
+namespace
+{
+    struct FBenchmarkDamageEvent { float Value; };
+    struct FBenchmarkHealEvent { float Value; };
+    struct FBenchmarkScoreEvent { float Value; };
+    struct FBenchmarkTimeEvent { float Value; };
+}
+
+void FEventManager::RunBenchmark(int32 NumEvents, int32 NumFrames)
+{
+    if (NumEvents <= 0 || NumFrames <= 0)
+    {
+        return;
+    }
+
+    // 구독자 누적값, 최적화로 호출이 사라지지 않도록 마지막에 출력
+    float Sum = 0.f;
+    auto Accumulate = [&Sum](float Value) { Sum += Value; };
+
+    // 이전 방식: 이름을 FString으로 만들어 TMap에서 찾고, Broadcast마다 std::function 핸들 맵을 복사
+    double StringMapMs = 0.0;
+    {
+        using FLegacyDelegateMap = TMap<FDelegateHandle, std::function<void(const float&)>>;
+        TMap<FString, FLegacyDelegateMap> OneFloatDelegates;
+        const TCHAR* EventNames[] = { TEXT("OnDamage"), TEXT("OnHeal"), TEXT("OnScore"), TEXT("OnTime") };
+        for (const TCHAR* Name : EventNames)
+        {
+            OneFloatDelegates.Add(FString(Name), FLegacyDelegateMap());
+            OneFloatDelegates.Find(FString(Name))->Add(FDelegateHandle::CreateHandle(), [&Accumulate](const float& Value) { Accumulate(Value); });
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Index = 0; Index < NumEvents; ++Index)
+            {
+                if (const FLegacyDelegateMap* DelegateHandles = OneFloatDelegates.Find(FString(EventNames[Index & 3])))
+                {
+                    auto CopyDelegates = *DelegateHandles;
+                    for (const auto& [Handle, Delegate] : CopyDelegates)
+                    {
+                        Delegate(1.f);
+                    }
+                }
+            }
+        }
+        StringMapMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    FEventManager Manager;
+    Manager.Subscribe<FBenchmarkDamageEvent>([&Accumulate](const FBenchmarkDamageEvent& Event) { Accumulate(Event.Value); });
+    Manager.Subscribe<FBenchmarkHealEvent>([&Accumulate](const FBenchmarkHealEvent& Event) { Accumulate(Event.Value); });
+    Manager.Subscribe<FBenchmarkScoreEvent>([&Accumulate](const FBenchmarkScoreEvent& Event) { Accumulate(Event.Value); });
+    Manager.Subscribe<FBenchmarkTimeEvent>([&Accumulate](const FBenchmarkTimeEvent& Event) { Accumulate(Event.Value); });
+
+    double BroadcastMs = 0.0;
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Index = 0; Index < NumEvents; Index += 4)
+            {
+                Manager.Broadcast(FBenchmarkDamageEvent{ 1.f });
+                Manager.Broadcast(FBenchmarkHealEvent{ 1.f });
+                Manager.Broadcast(FBenchmarkScoreEvent{ 1.f });
+                Manager.Broadcast(FBenchmarkTimeEvent{ 1.f });
+            }
+        }
+        BroadcastMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    auto EnqueueFrame = [&Manager, NumEvents]()
+    {
+        for (int32 Index = 0; Index < NumEvents; Index += 4)
+        {
+            Manager.Enqueue<FBenchmarkDamageEvent>(1.f);
+            Manager.Enqueue<FBenchmarkHealEvent>(1.f);
+            Manager.Enqueue<FBenchmarkScoreEvent>(1.f);
+            Manager.Enqueue<FBenchmarkTimeEvent>(1.f);
+        }
+        Manager.FlushQueuedEvents();
+    };
+
+    // 아레나가 커지는 첫 두 프레임은 측정에서 빼고, 측정 중에 블록이 늘지 않았는지 확인
+    EnqueueFrame();
+    EnqueueFrame();
+    const int32 WarmArenaBlocks = Manager.GetStats().NumArenaBlocks;
+
+    double QueuedMs = 0.0;
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            EnqueueFrame();
+        }
+        QueuedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+    const FEventManagerStats Stats = Manager.GetStats();
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("Event bus x%d, %d frames: string map %.3f ms/frame / Broadcast %.3f ms/frame / Enqueue+Flush %.3f ms/frame"),
+        NumEvents, NumFrames,
+        StringMapMs / NumFrames, BroadcastMs / NumFrames, QueuedMs / NumFrames
+    );
+    UE_LOG(
+        ELogLevel::Display, TEXT("Event arena: %d blocks (%d after warm-up), %llu KB, checksum %.0f"),
+        Stats.NumArenaBlocks, WarmArenaBlocks, static_cast<unsigned long long>(Stats.ArenaCapacityBytes / 1024), Sum
+    );
+}
@@ -1,22 +1,341 @@
 ﻿#pragma once
-#include "Container/Map.h"
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Container/Array.h"
 #include "Delegates/Delegate.h"
-#include "Delegates/DelegateCombination.h"
-#include "Math/Vector.h"
+#include "HAL/PlatformType.h"
+
+/**
+ * 이벤트 타입마다 처음 쓰일 때 0부터 차례로 받는 번호
+ * 채널 배열의 인덱스로 바로 쓰므로 문자열 해시나 맵 탐색이 없음
+ */
+struct FEventTypeRegistry
+{
+    static uint32 AllocateId();
+};
+
+template <typename TEvent>
+struct TEventTypeId
+{
+    static uint32 Get()
+    {
+        static const uint32 Id = FEventTypeRegistry::AllocateId();
+        return Id;
+    }
+};
+
+/** Subscribe가 돌려주는 구독 핸들, 슬롯을 해제할 때마다 세대가 올라가므로 이미 해제한 핸들로는 다른 구독을 지우지 않음 */
+struct FEventHandle
+{
+    uint32 TypeId = 0;
+    uint32 Slot = 0;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return Generation != 0; }
+    void Invalidate() { Generation = 0; }
+};
+
+/**
+ * 큐에 넣은 이벤트를 담는 선형 할당기
+ * Reset은 블록을 해제하지 않고 처음부터 다시 쓰므로, 한 번 커진 뒤로는 힙 할당이 없음
+ */
+class FEventArena
+{
+public:
+    static constexpr size_t MaxAlignment = 16;
+
+    explicit FEventArena(size_t InBlockSize = 64 * 1024);
+    ~FEventArena();
+
+    FEventArena(const FEventArena&) = delete;
+    FEventArena& operator=(const FEventArena&) = delete;
 
-DECLARE_MULTICAST_DELEGATE(FVoidDelegate)
-DECLARE_MULTICAST_DELEGATE_OneParam(FOneFloatDelegate, const float&)
-DECLARE_MULTICAST_DELEGATE_OneParam(FOneVectorDelegate, const FVector&)
+    void* Allocate(size_t Size, size_t Alignment);
+    void Reset();
+    void Release();
 
+    int32 GetNumBlocks() const { return Blocks.Num(); }
+    size_t GetCapacityBytes() const;
+
+private:
+    struct FBlock
+    {
+        uint8* Data = nullptr;
+        size_t Size = 0;
+    };
+
+    TArray<FBlock> Blocks;
+    int32 CurrentBlock = 0;
+    size_t Offset = 0;
+    size_t BlockSize;
+};
+
+/** 이벤트 타입 하나의 구독 슬롯 관리, 디스패치 중에 해제한 슬롯은 디스패치가 끝난 뒤에 비움 */
+class FEventChannelBase
+{
+public:
+    virtual ~FEventChannelBase() = default;
+
+    bool Unsubscribe(uint32 Slot, uint32 Generation);
+    void UnsubscribeAll();
+
+    int32 GetNumSubscribers() const { return NumSubscribers; }
+
+protected:
+    /** 디스패치 중에는 빈 슬롯을 재사용하지 않고 끝에 추가해서 진행 중인 이벤트를 받지 않게 함 */
+    uint32 AllocateSlot();
+    uint32 GetSlotGeneration(uint32 Slot) const { return SlotStates[Slot].Generation; }
+    bool IsSlotActive(uint32 Slot) const { return SlotStates[Slot].bActive; }
+
+    void BeginDispatch() { ++DispatchDepth; }
+    void EndDispatch();
+
+    /** 핸들러를 실제로 해제, 디스패치 중이 아닐 때만 호출됨 */
+    virtual void ReleaseSlot(uint32 Slot) = 0;
+
+private:
+    void DeactivateSlot(uint32 Slot);
+
+    struct FSlotState
+    {
+        uint32 Generation = 1;
+        bool bActive = false;
+    };
+
+    TArray<FSlotState> SlotStates;
+    TArray<uint32> FreeSlots;
+    TArray<uint32> PendingReleaseSlots;
+    int32 DispatchDepth = 0;
+    int32 NumSubscribers = 0;
+};
+
+template <typename TEvent>
+class TEventChannel final : public FEventChannelBase
+{
+public:
+    using FHandler = TDelegate<void(const TEvent&)>;
+
+    virtual ~TEventChannel() override
+    {
+        for (FHandler* Handler : Handlers)
+        {
+            delete Handler;
+        }
+    }
+
+    FEventHandle Add(FHandler&& Handler)
+    {
+        const uint32 Slot = AllocateSlot();
+        if (std::cmp_equal(Slot, Handlers.Num()))
+        {
+            // 핸들러는 슬롯마다 따로 할당해서 배열이 커져도 실행 중인 핸들러가 움직이지 않게 함
+            Handlers.Add(new FHandler(std::move(Handler)));
+        }
+        else
+        {
+            *Handlers[Slot] = std::move(Handler);
+        }
+        return FEventHandle{ TEventTypeId<TEvent>::Get(), Slot, GetSlotGeneration(Slot) };
+    }
+
+    void Dispatch(const TEvent& Event)
+    {
+        BeginDispatch();
+        const int32 NumSlots = Handlers.Num();
+        for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+        {
+            if (IsSlotActive(Slot))
+            {
+                Handlers[Slot]->ExecuteIfBound(Event);
+            }
+        }
+        EndDispatch();
+    }
+
+protected:
+    virtual void ReleaseSlot(uint32 Slot) override
+    {
+        Handlers[Slot]->UnBind();
+    }
+
+private:
+    TArray<FHandler*> Handlers;
+};
+
+struct FEventManagerStats
+{
+    int32 NumChannels = 0;
+    int32 NumSubscribers = 0;
+    int32 NumQueuedEvents = 0;          // 마지막 FlushQueuedEvents에서 처리한 수
+    int32 NumArenaBlocks = 0;
+    uint64 ArenaCapacityBytes = 0;
+};
+
+/**
+ * 이벤트 타입으로 구분하는 이벤트 버스, World마다 하나
+ *
+ * - 이벤트는 아무 구조체나 쓸 수 있고 타입마다 채널이 하나씩 생김
+ * - Broadcast는 바로 디스패치, Enqueue는 프레임 끝의 FlushQueuedEvents에서 디스패치
+ * - 큐에 넣은 이벤트는 프레임마다 번갈아 쓰는 두 아레나에 만들어지므로 힙 할당이 없음
+ * - 구독은 핸들로 해제하고, 디스패치 중에 해제해도 안전함
+ * - Enqueue는 병렬 컴포넌트 Tick처럼 워커 스레드에서 불러도 되고, 큐는 QueueMutex로 보호함
+ *   Subscribe, Unsubscribe, Broadcast, FlushQueuedEvents, Clear는 채널을 잠그지 않으므로 게임 스레드에서만 호출
+ *
+ * @code
+ * struct FPlayerDiedEvent { APlayer* Player; };
+ * FEventHandle Handle = World->EventManager.Subscribe<FPlayerDiedEvent>([](const FPlayerDiedEvent& Event) { ... });
+ * World->EventManager.Enqueue<FPlayerDiedEvent>(Player);
+ * World->EventManager.Unsubscribe(Handle);
+ * @endcode
+ */
 class FEventManager
 {
 public:
     FEventManager() = default;
-    ~FEventManager() = default;
+    ~FEventManager();
 
     FEventManager(const FEventManager&) = delete;
+    FEventManager& operator=(const FEventManager&) = delete;
+
+    template <typename TEvent, typename FunctorType>
+    FEventHandle Subscribe(FunctorType&& InFunctor)
+    {
+        typename TEventChannel<TEvent>::FHandler Handler;
+        Handler.BindLambda(std::forward<FunctorType>(InFunctor));
+        return GetChannel<TEvent>().Add(std::move(Handler));
+    }
+
+    /** InUserObject가 사라지면 호출되지 않음 */
+    template <typename TEvent, typename UserClass, typename FunctorType>
+        requires std::derived_from<UserClass, UObject>
+    FEventHandle SubscribeWeakLambda(UserClass* InUserObject, FunctorType&& InFunctor)
+    {
+        typename TEventChannel<TEvent>::FHandler Handler;
+        Handler.BindWeakLambda(InUserObject, std::forward<FunctorType>(InFunctor));
+        return GetChannel<TEvent>().Add(std::move(Handler));
+    }
+
+    template <typename TEvent, typename UserClass, typename MethodType>
+        requires std::derived_from<UserClass, UObject> && std::is_member_function_pointer_v<MethodType>
+    FEventHandle SubscribeUObject(UserClass* InUserObject, MethodType InMethod)
+    {
+        typename TEventChannel<TEvent>::FHandler Handler;
+        Handler.BindUObject(InUserObject, InMethod);
+        return GetChannel<TEvent>().Add(std::move(Handler));
+    }
+
+    /** Handle을 해제하고 무효화, 이미 해제한 핸들이면 false */
+    bool Unsubscribe(FEventHandle& Handle);
+
+    /** 구독자에게 바로 전달, 핸들러가 호출한 스레드에서 실행되므로 게임 스레드에서만 호출 */
+    template <typename TEvent>
+    void Broadcast(const TEvent& Event)
+    {
+        const uint32 TypeId = TEventTypeId<TEvent>::Get();
+        if (std::cmp_less(TypeId, Channels.Num()) && Channels[TypeId])
+        {
+            static_cast<TEventChannel<TEvent>*>(Channels[TypeId])->Dispatch(Event);
+        }
+    }
+
+    /**
+     * 이벤트를 아레나에 만들어 두고 FlushQueuedEvents에서 넣은 순서대로 게임 스레드에서 전달
+     * 아무 스레드에서나 호출할 수 있음, 여러 스레드에서 넣은 이벤트의 순서는 잠금을 얻은 순서
+     */
+    template <typename TEvent, typename... ArgTypes>
+    void Enqueue(ArgTypes&&... Args)
+    {
+        static_assert(alignof(TEvent) <= FEventArena::MaxAlignment, "Queued event alignment is too large");
+
+        std::lock_guard Lock(QueueMutex);
+        FEventQueue& Queue = Queues[WriteQueueIndex];
+        FQueuedEvent* Record = new (Queue.Arena.Allocate(sizeof(FQueuedEvent), alignof(FQueuedEvent))) FQueuedEvent();
+        Record->Payload = new (Queue.Arena.Allocate(sizeof(TEvent), alignof(TEvent))) TEvent{ std::forward<ArgTypes>(Args)... };
+        Record->Dispatch = [](FEventManager& Manager, void* Payload)
+        {
+            Manager.Broadcast<TEvent>(*static_cast<const TEvent*>(Payload));
+        };
+        if constexpr (!std::is_trivially_destructible_v<TEvent>)
+        {
+            Record->Destroy = [](void* Payload)
+            {
+                static_cast<TEvent*>(Payload)->~TEvent();
+            };
+        }
+
+        if (Queue.Tail)
+        {
+            Queue.Tail->Next = Record;
+        }
+        else
+        {
+            Queue.Head = Record;
+        }
+        Queue.Tail = Record;
+        ++Queue.NumEvents;
+    }
+
+    /** 프레임 끝에 호출, 전달 중에 Enqueue한 이벤트는 다음 Flush에서 전달 */
+    void FlushQueuedEvents();
+
+    /** 큐의 이벤트를 전달하지 않고 버리고 모든 구독을 해제 */
+    void Clear();
+
+    FEventManagerStats GetStats() const;
+
+    /** 문자열 키 TMap 방식과 Broadcast, Enqueue를 프레임당 NumEvents개로 비교해서 로그로 출력 */
+    static void RunBenchmark(int32 NumEvents, int32 NumFrames);
+
+private:
+    struct FQueuedEvent
+    {
+        FQueuedEvent* Next = nullptr;
+        void* Payload = nullptr;
+        void (*Dispatch)(FEventManager& Manager, void* Payload) = nullptr;
+        void (*Destroy)(void* Payload) = nullptr;
+    };
+
+    struct FEventQueue
+    {
+        FEventArena Arena;
+        FQueuedEvent* Head = nullptr;
+        FQueuedEvent* Tail = nullptr;
+        int32 NumEvents = 0;
+    };
+
+    template <typename TEvent>
+    TEventChannel<TEvent>& GetChannel()
+    {
+        const uint32 TypeId = TEventTypeId<TEvent>::Get();
+        if (std::cmp_greater_equal(TypeId, Channels.Num()))
+        {
+            const int32 OldNum = Channels.Num();
+            Channels.SetNum(static_cast<int32>(TypeId) + 1);
+            for (int32 Index = OldNum; Index < Channels.Num(); ++Index)
+            {
+                Channels[Index] = nullptr;
+            }
+        }
+        if (!Channels[TypeId])
+        {
+            Channels[TypeId] = new TEventChannel<TEvent>();
+        }
+        return *static_cast<TEventChannel<TEvent>*>(Channels[TypeId]);
+    }
+
+    /** Queue의 이벤트를 소멸시키고 아레나를 처음으로 되돌림 */
+    static void ResetQueue(FEventQueue& Queue);
+
+    /** TEventTypeId 순서, 구독하지 않은 타입은 nullptr, 게임 스레드에서만 고침 */
+    TArray<FEventChannelBase*> Channels;
 
-    TMap<FString, FVoidDelegate> Delegates;
-    TMap<FString, FOneFloatDelegate> OneFloatDelegates;
-    TMap<FString, FOneVectorDelegate> OneVectorDelegates;
+    /** Queues와 WriteQueueIndex를 보호, 전달하는 동안에는 잡지 않으므로 핸들러에서 다시 Enqueue해도 됨 */
+    mutable std::mutex QueueMutex;
+    FEventQueue Queues[2];
+    int32 WriteQueueIndex = 0;
+    bool bFlushing = false;
+    int32 NumFlushedEvents = 0;
 };
@@ -5,14 +5,145 @@
 #include "Engine/StaticMesh.h"
 
 #include "Asset/StaticMeshAsset.h"
+#include "Engine/MeshOptimizer.h"
+#include "Engine/MeshSimplifier.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
 
+#include <charconv>
+#include <filesystem>
 #include <fstream>
-#include <sstream>
+#include <string_view>
+
+namespace
+{
+    /** 파일 전체를 한 번에 읽음, 줄 단위 스트림 읽기보다 훨씬 빠름 */
+    bool ReadFileToString(const FWString& FilePath, std::string& OutContents)
+    {
+        std::ifstream File(std::filesystem::path(FilePath), std::ios::binary | std::ios::ate);
+        if (!File)
+        {
+            return false;
+        }
+
+        const std::streamsize Size = File.tellg();
+        if (Size < 0)
+        {
+            return false;
+        }
+
+        OutContents.resize(static_cast<size_t>(Size));
+        File.seekg(0, std::ios::beg);
+        return static_cast<bool>(File.read(OutContents.data(), Size));
+    }
+
+    /** Remaining에서 한 줄을 떼어냄, 줄바꿈 문자는 포함하지 않음 */
+    bool NextLine(std::string_view& Remaining, std::string_view& OutLine)
+    {
+        if (Remaining.empty())
+        {
+            return false;
+        }
+
+        const size_t LineEnd = Remaining.find('\n');
+        if (LineEnd == std::string_view::npos)
+        {
+            OutLine = Remaining;
+            Remaining = {};
+        }
+        else
+        {
+            OutLine = Remaining.substr(0, LineEnd);
+            Remaining.remove_prefix(LineEnd + 1);
+        }
+        return true;
+    }
+
+    constexpr bool IsSpace(char C)
+    {
+        return C == ' ' || C == '\t' || C == '\r' || C == '\v' || C == '\f';
+    }
+
+    /** Line에서 공백으로 구분된 다음 토큰을 떼어냄, 없으면 빈 문자열 */
+    std::string_view NextToken(std::string_view& Line)
+    {
+        size_t Begin = 0;
+        while (Begin < Line.size() && IsSpace(Line[Begin]))
+        {
+            ++Begin;
+        }
+
+        size_t End = Begin;
+        while (End < Line.size() && !IsSpace(Line[End]))
+        {
+            ++End;
+        }
+
+        const std::string_view Token = Line.substr(Begin, End - Begin);
+        Line.remove_prefix(End);
+        return Token;
+    }
+
+    /** 실패하면 OutValue는 바뀌지 않음 */
+    template <typename T>
+    bool ParseNumber(std::string_view Token, T& OutValue)
+    {
+        // from_chars는 '+' 부호를 받지 않음
+        if (!Token.empty() && Token[0] == '+')
+        {
+            Token.remove_prefix(1);
+        }
+        return std::from_chars(Token.data(), Token.data() + Token.size(), OutValue).ec == std::errc();
+    }
+
+    template <typename T>
+    bool ParseNextNumber(std::string_view& Line, T& OutValue)
+    {
+        return ParseNumber(NextToken(Line), OutValue);
+    }
+
+    /**
+     * OBJ 인덱스는 1부터 시작하고, 음수는 지금까지 나온 요소 기준 상대 인덱스
+     * 비어있거나 잘못된 값이면 Default
+     */
+    uint32 ParseObjIndex(std::string_view Part, int32 NumElements, uint32 Default)
+    {
+        int32 Value = 0;
+        if (Part.empty() || !ParseNumber(Part, Value))
+        {
+            return Default;
+        }
+        return Value < 0 ? static_cast<uint32>(NumElements + Value) : static_cast<uint32>(Value - 1);
+    }
+
+    /** v/vt/vn 인덱스 조합, 중복 버텍스 판별용 */
+    struct FObjVertexKey
+    {
+        uint32 VertexIndex;
+        uint32 UVIndex;
+        uint32 NormalIndex;
+
+        bool operator==(const FObjVertexKey& Other) const
+        {
+            return VertexIndex == Other.VertexIndex && UVIndex == Other.UVIndex && NormalIndex == Other.NormalIndex;
+        }
+    };
+}
+
+template <>
+struct std::hash<FObjVertexKey>
+{
+    size_t operator()(const FObjVertexKey& Key) const noexcept
+    {
+        const uint64 Packed = (static_cast<uint64>(Key.VertexIndex) << 32 | Key.UVIndex) ^ (static_cast<uint64>(Key.NormalIndex) * 0x9E3779B97F4A7C15ull);
+        return std::hash<uint64>()(Packed);
+    }
+};
 
 bool FObjLoader::ParseObj(const FString& ObjFilePath, FObjInfo& OutObjInfo)
 {
-    std::ifstream Obj(ObjFilePath.ToWideString());
-    if (!Obj)
+    std::string Contents;
+    if (!ReadFileToString(ObjFilePath.ToWideString(), Contents))
     {
         return false;
     }
@@ -46,166 +177,114 @@ bool FObjLoader::ParseObj(const FString& ObjFilePath, FObjInfo& OutObjInfo)
      *       Path Mode:     Strip
      */
 
-    std::string Line;
+    // 이번 페이스의 정점, 텍스처, 법선 인덱스, 페이스마다 할당하지 않도록 재사용
+    TArray<uint32> FaceVertexIndices;
+    TArray<uint32> FaceUVIndices;
+    TArray<uint32> FaceNormalIndices;
 
-    while (std::getline(Obj, Line))
-    {
-        if (Line.empty() || Line[0] == '#')
-        {
-            continue;
-        }
+    std::string_view Remaining(Contents);
+    std::string_view Line;
 
-        std::istringstream LineStream(Line);
-        std::string Token;
-        LineStream >> Token;
-
-        if (Token == "mtllib")
+    while (NextLine(Remaining, Line))
+    {
+        const std::string_view Token = NextToken(Line);
+        if (Token.empty() || Token[0] == '#')
         {
-            LineStream >> Line;
-            OutObjInfo.MatName = Line;
             continue;
         }
 
-        if (Token == "usemtl")
-        {
-            LineStream >> Line;
-            FString MatName(Line);
-
-            if (!OutObjInfo.MaterialSubsets.IsEmpty())
-            {
-                FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
-                LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
-            }
-
-            FMaterialSubset MaterialSubset;
-            MaterialSubset.MaterialName = MatName;
-            MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
-            MaterialSubset.IndexCount = 0;
-            OutObjInfo.MaterialSubsets.Add(MaterialSubset);
-        }
-
-        if (Token == "g" || Token == "o")
-        {
-            LineStream >> Line;
-            OutObjInfo.GroupName.Add(Line);
-            OutObjInfo.NumOfGroup++;
-        }
-
         if (Token == "v") // Vertex
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
+            float X = 0.f, Y = 0.f, Z = 0.f;
+            ParseNextNumber(Line, X);
+            ParseNextNumber(Line, Y);
+            ParseNextNumber(Line, Z);
             OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
-            continue;
         }
-
-        if (Token == "vn") // Normal
+        else if (Token == "vn") // Normal
         {
-            float NormalX, NormalY, NormalZ;
-            LineStream >> NormalX >> NormalY >> NormalZ;
+            float NormalX = 0.f, NormalY = 0.f, NormalZ = 0.f;
+            ParseNextNumber(Line, NormalX);
+            ParseNextNumber(Line, NormalY);
+            ParseNextNumber(Line, NormalZ);
             OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1.f, NormalZ));
-            continue;
         }
-
-        if (Token == "vt") // Texture
+        else if (Token == "vt") // Texture
         {
-            float U, V;
-            LineStream >> U >> V;
+            float U = 0.f, V = 0.f;
+            ParseNextNumber(Line, U);
+            ParseNextNumber(Line, V);
             OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
-            continue;
         }
-
-        if (Token == "f")
+        else if (Token == "f")
         {
-            TArray<uint32> FaceVertexIndices;  // 이번 페이스의 정점 인덱스
-            TArray<uint32> FaceNormalIndices;  // 이번 페이스의 법선 인덱스
-            TArray<uint32> FaceUVIndices; // 이번 페이스의 텍스처 인덱스
+            FaceVertexIndices.Empty();
+            FaceUVIndices.Empty();
+            FaceNormalIndices.Empty();
 
-            while (LineStream >> Token)
+            for (std::string_view Corner = NextToken(Line); !Corner.empty(); Corner = NextToken(Line))
             {
-                std::istringstream TokenStream(Token);
-                std::string Part;
-                TArray<std::string> FacePieces;
-
-                uint32 VertexIndex = 0;
-                uint32 TextureIndex = UINT32_MAX;
-                uint32 NormalIndex = UINT32_MAX;
-
-                // v
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        VertexIndex = std::stoi(Part) - 1;
-                    }
-                }
-
-                // vt
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        TextureIndex = std::stoi(Part) - 1;
-                    }
-                }
-
-                // vn
-                if (std::getline(TokenStream, Part, '/'))
+                // v, v/vt, v//vn, v/vt/vn
+                const size_t FirstSlash = Corner.find('/');
+                const std::string_view VertexPart = Corner.substr(0, FirstSlash);
+                std::string_view UVPart;
+                std::string_view NormalPart;
+                if (FirstSlash != std::string_view::npos)
                 {
-                    if (!Part.empty())
+                    const std::string_view Rest = Corner.substr(FirstSlash + 1);
+                    const size_t SecondSlash = Rest.find('/');
+                    UVPart = Rest.substr(0, SecondSlash);
+                    if (SecondSlash != std::string_view::npos)
                     {
-                        NormalIndex = std::stoi(Part) - 1;
+                        NormalPart = Rest.substr(SecondSlash + 1);
                     }
                 }
 
-                FaceVertexIndices.Add(VertexIndex);
-                FaceUVIndices.Add(TextureIndex);
-                FaceNormalIndices.Add(NormalIndex);
+                FaceVertexIndices.Add(ParseObjIndex(VertexPart, OutObjInfo.Vertices.Num(), 0));
+                FaceUVIndices.Add(ParseObjIndex(UVPart, OutObjInfo.UVs.Num(), UINT32_MAX));
+                FaceNormalIndices.Add(ParseObjIndex(NormalPart, OutObjInfo.Normals.Num(), UINT32_MAX));
             }
 
-            if (FaceVertexIndices.Num() == 3) // 삼각형
+            // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환하며 부채꼴로 분할: 0-2-1, 0-3-2, ...
+            for (int32 Corner = 1; Corner + 1 < FaceVertexIndices.Num(); ++Corner)
             {
-                // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
                 OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
+                OutObjInfo.VertexIndices.Add(FaceVertexIndices[Corner + 1]);
+                OutObjInfo.VertexIndices.Add(FaceVertexIndices[Corner]);
 
                 OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
+                OutObjInfo.UVIndices.Add(FaceUVIndices[Corner + 1]);
+                OutObjInfo.UVIndices.Add(FaceUVIndices[Corner]);
 
                 OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[Corner + 1]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[Corner]);
             }
-            else if (FaceVertexIndices.Num() == 4) // 쿼드
-            {
-                // 첫 번째 삼각형: 0-2-1
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
-
-                // 두 번째 삼각형: 0-3-2
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+        }
+        else if (Token == "mtllib")
+        {
+            OutObjInfo.MatName = std::string(NextToken(Line));
+        }
+        else if (Token == "usemtl")
+        {
+            FString MatName(std::string(NextToken(Line)));
 
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+            if (!OutObjInfo.MaterialSubsets.IsEmpty())
+            {
+                FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+                LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
             }
+
+            FMaterialSubset MaterialSubset;
+            MaterialSubset.MaterialName = MatName;
+            MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
+            MaterialSubset.IndexCount = 0;
+            OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+        }
+        else if (Token == "g" || Token == "o")
+        {
+            OutObjInfo.GroupName.Add(std::string(NextToken(Line)));
+            OutObjInfo.NumOfGroup++;
         }
     }
 
@@ -223,34 +302,31 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
     // Subset
     OutStaticMeshRenderData.MaterialSubsets = OutObjInfo.MaterialSubsets;
 
-    std::ifstream MtlFile(OutObjInfo.FilePath + OutObjInfo.MatName.ToWideString());
-    if (!MtlFile.is_open())
+    std::string Contents;
+    if (!ReadFileToString(OutObjInfo.FilePath + OutObjInfo.MatName.ToWideString(), Contents))
     {
         return false;
     }
 
-    std::string Line;
+    std::string_view Remaining(Contents);
+    std::string_view Line;
     int32 MaterialIndex = -1;
 
-    while (std::getline(MtlFile, Line))
+    while (NextLine(Remaining, Line))
     {
-        if (Line.empty() || Line[0] == '#')
+        const std::string_view Token = NextToken(Line);
+        if (Token.empty() || Token[0] == '#')
         {
             continue;
         }
 
-        std::istringstream LineStream(Line);
-        std::string Token;
-        LineStream >> Token;
-
         // Create new material if token is 'newmtl'
         if (Token == "newmtl")
         {
-            LineStream >> Line;
             MaterialIndex++;
 
             FMaterialInfo Material;
-            Material.MaterialName = Line;
+            Material.MaterialName = std::string(NextToken(Line));
             
             constexpr uint32 TexturesNum = static_cast<uint32>(EMaterialTextureSlots::MTS_MAX);
             Material.TextureInfos.SetNum(TexturesNum);
@@ -260,63 +336,71 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
 
         if (Token == "Kd")
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
+            float X = 0.f, Y = 0.f, Z = 0.f;
+            ParseNextNumber(Line, X);
+            ParseNextNumber(Line, Y);
+            ParseNextNumber(Line, Z);
             OutStaticMeshRenderData.Materials[MaterialIndex].DiffuseColor = FVector(X, Y, Z);
         }
         if (Token == "Ks")
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
+            float X = 0.f, Y = 0.f, Z = 0.f;
+            ParseNextNumber(Line, X);
+            ParseNextNumber(Line, Y);
+            ParseNextNumber(Line, Z);
             OutStaticMeshRenderData.Materials[MaterialIndex].SpecularColor = FVector(X, Y, Z);
         }
         if (Token == "Ka")
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
+            float X = 0.f, Y = 0.f, Z = 0.f;
+            ParseNextNumber(Line, X);
+            ParseNextNumber(Line, Y);
+            ParseNextNumber(Line, Z);
             OutStaticMeshRenderData.Materials[MaterialIndex].AmbientColor = FVector(X, Y, Z);
         }
         if (Token == "Ke")
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
+            float X = 0.f, Y = 0.f, Z = 0.f;
+            ParseNextNumber(Line, X);
+            ParseNextNumber(Line, Y);
+            ParseNextNumber(Line, Z);
             OutStaticMeshRenderData.Materials[MaterialIndex].EmissiveColor = FVector(X, Y, Z);
         }
         if (Token == "Ns")
         {
-            float X;
-            LineStream >> X;
+            float X = 0.f;
+            ParseNextNumber(Line, X);
             OutStaticMeshRenderData.Materials[MaterialIndex].Shininess = X;
         }
         if (Token == "Ni")
         {
-            float X;
-            LineStream >> X;
+            float X = 0.f;
+            ParseNextNumber(Line, X);
             OutStaticMeshRenderData.Materials[MaterialIndex].IOR = X;
         }
         if (Token == "d" || Token == "Tr")
         {
-            float X;
-            LineStream >> X;
+            float X = 0.f;
+            ParseNextNumber(Line, X);
             OutStaticMeshRenderData.Materials[MaterialIndex].Transparency = (Token == "Tr") ? X : 1.f - X;
             OutStaticMeshRenderData.Materials[MaterialIndex].bTransparent = true;
         }
         if (Token == "illum")
         {
-            uint32 X;
-            LineStream >> X;
+            uint32 X = 0;
+            ParseNextNumber(Line, X);
             OutStaticMeshRenderData.Materials[MaterialIndex].IlluminanceModel = X;
         }
         if (Token == "Pm")
         {
-            float X;
-            LineStream >> X;
+            float X = 0.f;
+            ParseNextNumber(Line, X);
             OutStaticMeshRenderData.Materials[MaterialIndex].Metallic = X;
         }
         if (Token == "Pr")
         {
-            float X;
-            LineStream >> X;
+            float X = 0.f;
+            ParseNextNumber(Line, X);
             OutStaticMeshRenderData.Materials[MaterialIndex].Roughness = X;
         }
 
@@ -324,8 +408,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Diffuse);
             
-            LineStream >> Line;
-            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
+            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(NextToken(Line));
 
             FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
             if (CreateTextureFromFile(TexturePath))
@@ -339,18 +422,17 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Normal);
             
-            std::string Option;
-            while (LineStream >> Option)
+            for (std::string_view Option = NextToken(Line); !Option.empty(); Option = NextToken(Line))
             {
                 if (Option == "-bm")
                 {
-                    float BumpMultiplier;
-                    LineStream >> BumpMultiplier;
+                    float BumpMultiplier = 1.f;
+                    ParseNextNumber(Line, BumpMultiplier);
                     OutStaticMeshRenderData.Materials[MaterialIndex].BumpMultiplier = BumpMultiplier;
                 }
                 else
                 {
-                    OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Option;
+                    OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(Option);
 
                     FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
                     if (CreateTextureFromFile(TexturePath, false))
@@ -366,8 +448,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Specular);
             
-            LineStream >> Line;
-            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
+            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(NextToken(Line));
 
             FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
             if (CreateTextureFromFile(TexturePath))
@@ -381,8 +462,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Shininess);
             
-            LineStream >> Line;
-            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
+            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(NextToken(Line));
 
             FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
             if (CreateTextureFromFile(TexturePath, false))
@@ -396,8 +476,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Ambient);
             
-            LineStream >> Line;
-            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
+            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(NextToken(Line));
 
             FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
             if (CreateTextureFromFile(TexturePath))
@@ -411,8 +490,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Emissive);
             
-            LineStream >> Line;
-            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
+            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(NextToken(Line));
 
             FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
             if (CreateTextureFromFile(TexturePath))
@@ -426,8 +504,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Metallic);
             
-            LineStream >> Line;
-            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
+            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(NextToken(Line));
 
             FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
             if (CreateTextureFromFile(TexturePath, false))
@@ -441,8 +518,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutS
         {
             constexpr uint32 SlotIdx = static_cast<uint32>(EMaterialTextureSlots::MTS_Roughness);
             
-            LineStream >> Line;
-            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
+            OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = std::string(NextToken(Line));
 
             FWString TexturePath = OutObjInfo.FilePath + OutStaticMeshRenderData.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
             if (CreateTextureFromFile(TexturePath, false))
@@ -464,7 +540,15 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
     OutStaticMesh.DisplayName = RawData.DisplayName;
 
     // 고유 정점을 기반으로 FVertexSimple 배열 생성
-    TMap<std::string, uint32> IndexMap; // 중복 체크용
+    TMap<FObjVertexKey, uint32> IndexMap; // 중복 체크용
+    IndexMap.Reserve(RawData.Vertices.Num());
+
+    OutStaticMesh.Vertices.Reserve(RawData.Vertices.Num());
+    OutStaticMesh.Indices.Reserve(RawData.VertexIndices.Num());
+
+    // 서브셋은 ParseObj에서 인덱스 순서대로 겹치지 않게 만들어지므로 앞에서부터 한 번만 훑음
+    const TArray<FMaterialSubset>& Subsets = OutStaticMesh.MaterialSubsets;
+    int32 SubsetCursor = 0;
 
     for (int32 Idx = 0; Idx < RawData.VertexIndices.Num(); Idx++)
     {
@@ -472,24 +556,23 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
         const uint32 UVIndex = RawData.UVIndices[Idx];
         const uint32 NormalIndex = RawData.NormalIndices[Idx];
 
+        while (SubsetCursor < Subsets.Num() && static_cast<uint32>(Idx) >= Subsets[SubsetCursor].IndexStart + Subsets[SubsetCursor].IndexCount)
+        {
+            ++SubsetCursor;
+        }
+
         uint32 MaterialIndex = 0;
-        for (int32 SubsetIdx = 0; SubsetIdx < OutStaticMesh.MaterialSubsets.Num(); SubsetIdx++)
+        if (SubsetCursor < Subsets.Num() && Subsets[SubsetCursor].IndexStart <= static_cast<uint32>(Idx))
         {
-            const FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[SubsetIdx];
-            if (Subset.IndexStart <= Idx && Idx < Subset.IndexStart + Subset.IndexCount)
-            {
-                MaterialIndex = Subset.MaterialIndex;
-                break;
-            }
+            MaterialIndex = Subsets[SubsetCursor].MaterialIndex;
         }
 
-        // 키 생성 (v/vt/vn 조합)
-        std::string Key = std::to_string(VertexIndex) + "/" + std::to_string(UVIndex) + "/" + std::to_string(NormalIndex);
+        const FObjVertexKey Key = { VertexIndex, UVIndex, NormalIndex };
 
         uint32 FinalIndex;
-        if (IndexMap.Contains(Key))
+        if (const uint32* Found = IndexMap.Find(Key))
         {
-            FinalIndex = IndexMap[Key];
+            FinalIndex = *Found;
         }
         else
         {
@@ -515,7 +598,7 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
             }
 
             FinalIndex = OutStaticMesh.Vertices.Num();
-            IndexMap[Key] = FinalIndex;
+            IndexMap.Add(Key, FinalIndex);
             OutStaticMesh.Vertices.Add(StaticMeshVertex);
         }
 
@@ -540,6 +623,90 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
     return true;
 }
 
+void FObjLoader::RunParseBenchmark(const TArray<FString>& ObjFilePaths, int32 NumRepeats)
+{
+    if (NumRepeats <= 0)
+    {
+        return;
+    }
+
+    double TotalMegabytes = 0.0;
+    double TotalParseMilliseconds = 0.0;
+    double TotalConvertMilliseconds = 0.0;
+
+    for (const FString& Path : ObjFilePaths)
+    {
+        std::error_code ErrorCode;
+        const double FileMegabytes = static_cast<double>(std::filesystem::file_size(Path.ToWideString(), ErrorCode)) / (1024.0 * 1024.0);
+        if (ErrorCode)
+        {
+            UE_LOG(ELogLevel::Error, TEXT("[OBJ Bench] Cannot open %s"), *Path);
+            continue;
+        }
+
+        double ParseMilliseconds = 0.0;
+        double ConvertMilliseconds = 0.0;
+        double BestMilliseconds = 0.0;
+        int32 NumVertices = -1;
+        bool bConsistent = true;
+
+        for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            const uint64 ParseStartCycles = FPlatformTime::Cycles64();
+            FObjInfo ObjInfo;
+            if (!ParseObj(Path, ObjInfo))
+            {
+                bConsistent = false;
+                break;
+            }
+            const double ParseMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ParseStartCycles);
+
+            const uint64 ConvertStartCycles = FPlatformTime::Cycles64();
+            FStaticMeshRenderData RenderData;
+            if (!ConvertToStaticMesh(ObjInfo, RenderData))
+            {
+                bConsistent = false;
+                break;
+            }
+            const double ConvertMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ConvertStartCycles);
+
+            ParseMilliseconds += ParseMs;
+            ConvertMilliseconds += ConvertMs;
+            BestMilliseconds = Repeat == 0 ? ParseMs + ConvertMs : FMath::Min(BestMilliseconds, ParseMs + ConvertMs);
+
+            // 같은 파일은 매번 같은 결과가 나와야 함
+            if (NumVertices >= 0 && NumVertices != RenderData.Vertices.Num())
+            {
+                bConsistent = false;
+            }
+            NumVertices = RenderData.Vertices.Num();
+        }
+
+        if (!bConsistent)
+        {
+            UE_LOG(ELogLevel::Error, TEXT("[OBJ Bench] %s: parse failed or results differ between runs"), *Path);
+            continue;
+        }
+
+        const double AverageMilliseconds = (ParseMilliseconds + ConvertMilliseconds) / NumRepeats;
+        UE_LOG(ELogLevel::Display, TEXT("[OBJ Bench] %s: %.2f MB, %d vertices, Parse %.2f ms, Convert %.2f ms avg, %.1f MB/s avg, %.1f MB/s best"),
+            *Path, FileMegabytes, NumVertices, ParseMilliseconds / NumRepeats, ConvertMilliseconds / NumRepeats,
+            AverageMilliseconds > 0.0 ? FileMegabytes * 1000.0 / AverageMilliseconds : 0.0,
+            BestMilliseconds > 0.0 ? FileMegabytes * 1000.0 / BestMilliseconds : 0.0);
+
+        TotalMegabytes += FileMegabytes * NumRepeats;
+        TotalParseMilliseconds += ParseMilliseconds;
+        TotalConvertMilliseconds += ConvertMilliseconds;
+    }
+
+    const double TotalMilliseconds = TotalParseMilliseconds + TotalConvertMilliseconds;
+    UE_LOG(ELogLevel::Display, TEXT("[OBJ Bench] Total %.2f MB x%d: Parse %.1f MB/s, Convert %.1f MB/s, Parse + Convert %.1f MB/s"),
+        NumRepeats > 0 ? TotalMegabytes / NumRepeats : 0.0, NumRepeats,
+        TotalParseMilliseconds > 0.0 ? TotalMegabytes * 1000.0 / TotalParseMilliseconds : 0.0,
+        TotalConvertMilliseconds > 0.0 ? TotalMegabytes * 1000.0 / TotalConvertMilliseconds : 0.0,
+        TotalMilliseconds > 0.0 ? TotalMegabytes * 1000.0 / TotalMilliseconds : 0.0);
+}
+
 bool FObjLoader::CreateTextureFromFile(const FWString& Filename, bool bIsSRGB)
 {
     if (FEngineLoop::ResourceManager.GetTexture(Filename))
@@ -655,12 +822,19 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
             ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
             return NewStaticMesh;
         }
+
+        // LOD가 없는 이전 형식의 바이너리는 OBJ에서 다시 만듦
+        *NewStaticMesh = FStaticMeshRenderData();
     }
 
+    const uint64 ParseStartCycles = FPlatformTime::Cycles64();
+
     // Parse OBJ
     FObjInfo NewObjInfo;
     bool Result = FObjLoader::ParseObj(PathFileName, NewObjInfo);
 
+    const double ParseMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ParseStartCycles);
+
     if (!Result)
     {
         delete NewStaticMesh;
@@ -686,6 +860,7 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
     }
 
     // Convert FStaticMeshRenderData
+    const uint64 ConvertStartCycles = FPlatformTime::Cycles64();
     Result = FObjLoader::ConvertToStaticMesh(NewObjInfo, *NewStaticMesh);
     if (!Result)
     {
@@ -693,6 +868,21 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
         return nullptr;
     }
 
+    // 머티리얼 파싱은 텍스처 로딩이 대부분이므로 처리량에서 제외
+    const double ConvertMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ConvertStartCycles);
+    std::error_code ErrorCode;
+    const double FileMegabytes = static_cast<double>(std::filesystem::file_size(PathFileName.ToWideString(), ErrorCode)) / (1024.0 * 1024.0);
+    if (!ErrorCode)
+    {
+        const double TotalMilliseconds = ParseMilliseconds + ConvertMilliseconds;
+        UE_LOG(ELogLevel::Display, "[OBJ Import] %s: %.2f MB, Parse %.2f ms, Convert %.2f ms (%.1f MB/s)",
+            *NewStaticMesh->DisplayName, FileMegabytes, ParseMilliseconds, ConvertMilliseconds,
+            TotalMilliseconds > 0.0 ? FileMegabytes * 1000.0 / TotalMilliseconds : 0.0);
+    }
+
+    FMeshSimplifier::BuildStaticMeshLODs(*NewStaticMesh);
+    FMeshOptimizer::OptimizeStaticMesh(*NewStaticMesh);
+
     SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); 
     ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
     return NewStaticMesh;
@@ -792,6 +982,34 @@ bool FObjManager::SaveStaticMeshToBinary(const FWString& FilePath, const FStatic
     File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
     File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
 
+    // LODs, 머티리얼과 바운딩 박스는 LOD0과 같음
+    File.write(reinterpret_cast<const char*>(&StaticMeshLODTag), sizeof(StaticMeshLODTag));
+    File.write(reinterpret_cast<const char*>(&StaticMeshCookVersion), sizeof(StaticMeshCookVersion));
+    uint32 LODCount = StaticMesh.LODs.Num();
+    File.write(reinterpret_cast<const char*>(&LODCount), sizeof(LODCount));
+    for (const std::shared_ptr<FStaticMeshRenderData>& LOD : StaticMesh.LODs)
+    {
+        uint32 LODVertexCount = LOD->Vertices.Num();
+        File.write(reinterpret_cast<const char*>(&LODVertexCount), sizeof(LODVertexCount));
+        File.write(reinterpret_cast<const char*>(LOD->Vertices.GetData()), LODVertexCount * sizeof(FStaticMeshVertex));
+
+        uint32 LODIndexCount = LOD->Indices.Num();
+        File.write(reinterpret_cast<const char*>(&LODIndexCount), sizeof(LODIndexCount));
+        File.write(reinterpret_cast<const char*>(LOD->Indices.GetData()), LODIndexCount * sizeof(UINT));
+
+        uint32 LODSubsetCount = LOD->MaterialSubsets.Num();
+        File.write(reinterpret_cast<const char*>(&LODSubsetCount), sizeof(LODSubsetCount));
+        for (const FMaterialSubset& Subset : LOD->MaterialSubsets)
+        {
+            Serializer::WriteFString(File, Subset.MaterialName);
+            File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
+            File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
+            File.write(reinterpret_cast<const char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        }
+
+        File.write(reinterpret_cast<const char*>(&LOD->ScreenSize), sizeof(LOD->ScreenSize));
+    }
+
     File.close();
     return true;
 }
@@ -880,6 +1098,52 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
     File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
     File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
 
+    // LODs
+    uint32 LODTag = 0;
+    uint32 CookVersion = 0;
+    File.read(reinterpret_cast<char*>(&LODTag), sizeof(LODTag));
+    File.read(reinterpret_cast<char*>(&CookVersion), sizeof(CookVersion));
+    if (!File || LODTag != StaticMeshLODTag || CookVersion != StaticMeshCookVersion)
+    {
+        return false;
+    }
+
+    uint32 LODCount = 0;
+    File.read(reinterpret_cast<char*>(&LODCount), sizeof(LODCount));
+    OutStaticMesh.LODs.SetNum(LODCount);
+    for (uint32 LODIndex = 0; LODIndex < LODCount; ++LODIndex)
+    {
+        std::shared_ptr<FStaticMeshRenderData> LOD = std::make_shared<FStaticMeshRenderData>();
+        LOD->ObjectName = OutStaticMesh.ObjectName + L"_LOD" + std::to_wstring(LODIndex + 1);
+        LOD->DisplayName = OutStaticMesh.DisplayName + "_LOD" + FString::FromInt(LODIndex + 1);
+        LOD->BoundingBoxMin = OutStaticMesh.BoundingBoxMin;
+        LOD->BoundingBoxMax = OutStaticMesh.BoundingBoxMax;
+
+        uint32 LODVertexCount = 0;
+        File.read(reinterpret_cast<char*>(&LODVertexCount), sizeof(LODVertexCount));
+        LOD->Vertices.SetNum(LODVertexCount);
+        File.read(reinterpret_cast<char*>(LOD->Vertices.GetData()), LODVertexCount * sizeof(FStaticMeshVertex));
+
+        uint32 LODIndexCount = 0;
+        File.read(reinterpret_cast<char*>(&LODIndexCount), sizeof(LODIndexCount));
+        LOD->Indices.SetNum(LODIndexCount);
+        File.read(reinterpret_cast<char*>(LOD->Indices.GetData()), LODIndexCount * sizeof(UINT));
+
+        uint32 LODSubsetCount = 0;
+        File.read(reinterpret_cast<char*>(&LODSubsetCount), sizeof(LODSubsetCount));
+        LOD->MaterialSubsets.SetNum(LODSubsetCount);
+        for (FMaterialSubset& Subset : LOD->MaterialSubsets)
+        {
+            Serializer::ReadFString(File, Subset.MaterialName);
+            File.read(reinterpret_cast<char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
+            File.read(reinterpret_cast<char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
+            File.read(reinterpret_cast<char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        }
+
+        File.read(reinterpret_cast<char*>(&LOD->ScreenSize), sizeof(LOD->ScreenSize));
+        OutStaticMesh.LODs[LODIndex] = LOD;
+    }
+
     File.close();
 
     // Texture Load
@@ -26,6 +26,12 @@ struct FObjLoader
 
     static void ComputeBoundingBox(const TArray<FStaticMeshVertex>& InVertices, FVector& OutMinVector, FVector& OutMaxVector);
 
+    /**
+     * OBJ 파일들을 NumRepeats번씩 파싱하고 변환하여 파일별, 전체 처리량(MB/s)을 로그로 출력
+     * 머티리얼과 텍스처 로딩은 제외하며, 반복마다 결과 정점 수가 같은지도 확인
+     */
+    static void RunParseBenchmark(const TArray<FString>& ObjFilePaths, int32 NumRepeats);
+
 private:
     static void CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticMeshVertex& Vertex1, const FStaticMeshVertex& Vertex2);
 };
@@ -58,6 +64,12 @@ public:
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 
 private:
+    /** 바이너리의 바운딩 박스 뒤에 오는 LOD 구역의 시작 표시 ("LODS"), 없으면 이전 형식 */
+    static constexpr uint32 StaticMeshLODTag = 0x53444F4C;
+
+    /** LOD 표시 뒤에 기록, 인덱스 재정렬 같은 쿡 단계가 바뀌면 올려서 이전 바이너리를 다시 만들도록 함 */
+    static constexpr uint32 StaticMeshCookVersion = 1;
+
     inline static TMap<FString, FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
     inline static TMap<FString, UMaterial*> MaterialMap;
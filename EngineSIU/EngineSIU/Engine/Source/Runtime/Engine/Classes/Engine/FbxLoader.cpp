@@ -10,10 +10,15 @@
 #include "Animation/Skeleton.h"
 #include "SkeletalMesh.h"
 #include "Animation/AnimSequence.h"
+#include "Animation/AnimData/AnimDataModel.h"
 #include "Asset/StaticMeshAsset.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "FObjLoader.h"
 #include "Container/String.h"
 #include "Container/Set.h"
 #include "Developer/AnimDataController/AnimDataController.h"
+#include "UserInterface/Console.h"
 
 struct FVertexKey
 {
@@ -1051,8 +1056,17 @@ USkeletalMesh* FFbxLoader::CreateSkeletalMeshFromNodes(const TArray<FbxNode*>& M
     }
 
     CalculateTangents(RenderData->Vertices, RenderData->Indices);
+
+    const FMeshOptimizeStats OptimizeStats = FMeshOptimizer::OptimizeMesh(RenderData->Vertices, RenderData->Indices, RenderData->MaterialSubsets);
+    UE_LOG(ELogLevel::Display, "[Mesh Optimize] %s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+        *RenderData->DisplayName, OptimizeStats.Before.ACMR, OptimizeStats.After.ACMR, OptimizeStats.Before.ATVR, OptimizeStats.After.ATVR);
     
     ComputeBoundingBox(RenderData->Vertices, RenderData->BoundingBoxMin, RenderData->BoundingBoxMax);
+
+    if (!FVertexQuantization::PackVertices(RenderData->Vertices, RenderData->PackedVertices))
+    {
+        UE_LOG(ELogLevel::Warning, "%s: Bone index exceeds 255, packed vertices are disabled", *RenderData->DisplayName);
+    }
     
     USkeletalMesh* SkeletalMesh = FObjectFactory::ConstructObject<USkeletalMesh>(nullptr);
     SkeletalMesh->SetRenderData(std::move(RenderData));
@@ -1234,6 +1248,10 @@ UStaticMesh* FFbxLoader::CreateStaticMesh(FbxNode* MeshNode, int32 GlobalMeshIdx
     }
 
     CalculateTangents(RenderData->Vertices, RenderData->Indices);
+
+    FObjLoader::ComputeBoundingBox(RenderData->Vertices, RenderData->BoundingBoxMin, RenderData->BoundingBoxMax);
+    FMeshSimplifier::BuildStaticMeshLODs(*RenderData);
+    FMeshOptimizer::OptimizeStaticMesh(*RenderData);
     
     UStaticMesh* StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr);
     StaticMesh->SetData(RenderData);
@@ -1429,6 +1447,16 @@ void FFbxLoader::ProcessAnimations(TArray<UAnimationAsset*>& OutAnimations, cons
                 Controller.SetBoneTrackKeys(BoneName, Positions, Rotations, Scales);
             }
         }
+
+        FAnimCompressionStats CompressionStats;
+        if (AnimSequence->GetDataModel()->CompressAnimation(FAnimCompressionSettings(), &CompressionStats))
+        {
+            UE_LOG(ELogLevel::Display, "[Anim Compression] %s: %llu -> %llu bytes (x%.2f), Identity %d, Constant %d, Max Error Pos %.5f Rot %.5f Scale %.5f",
+                *AnimSequence->GetName(), CompressionStats.RawBytes, CompressionStats.CompressedBytes, CompressionStats.GetCompressionRatio(),
+                CompressionStats.NumIdentityChannels, CompressionStats.NumConstantChannels,
+                CompressionStats.MaxPositionError, CompressionStats.MaxRotationError, CompressionStats.MaxScaleError
+            );
+        }
         
         OutAnimations.Add(AnimSequence);
     }
@@ -0,0 +1,624 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+#include "Engine/Asset/StaticMeshAsset.h"
+#include "Math/MathUtility.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /** Forsyth 알고리즘에서 점수를 매길 때 가정하는 LRU 캐시 크기 */
+    constexpr int32 ForsythCacheSize = 32;
+    constexpr float CacheDecayPower = 1.5f;
+    constexpr float LastTriangleScore = 0.75f;
+    constexpr float ValenceBoostScale = 2.0f;
+    constexpr float ValenceBoostPower = 0.5f;
+
+    float ComputeVertexScore(int32 CachePosition, int32 NumRemainingTriangles)
+    {
+        if (NumRemainingTriangles == 0)
+        {
+            return -1.0f;
+        }
+
+        float Score = 0.0f;
+        if (CachePosition >= 0)
+        {
+            // 방금 그린 삼각형의 버텍스는 다음 삼각형이 바로 이어 쓰기보다 조금 뒤에 쓰는 편이 낫도록 고정 점수
+            if (CachePosition < 3)
+            {
+                Score = LastTriangleScore;
+            }
+            else
+            {
+                const float Scaler = 1.0f / static_cast<float>(ForsythCacheSize - 3);
+                Score = std::pow(1.0f - static_cast<float>(CachePosition - 3) * Scaler, CacheDecayPower);
+            }
+        }
+
+        // 남은 삼각형이 적은 버텍스를 먼저 끝내서 나중에 혼자 남지 않도록 함
+        Score += ValenceBoostScale * std::pow(static_cast<float>(NumRemainingTriangles), -ValenceBoostPower);
+        return Score;
+    }
+
+    /** Timestamp 방식의 FIFO 캐시, Time을 CacheSize보다 크게 건너뛰면 비워짐 */
+    struct FFifoCache
+    {
+        TArray<uint32> Timestamps;
+        uint32 Time = 0;
+        int32 CacheSize = 0;
+
+        FFifoCache(int32 NumVertices, int32 InCacheSize)
+            : Time(static_cast<uint32>(InCacheSize) + 1)
+            , CacheSize(InCacheSize)
+        {
+            Timestamps.Init(0, NumVertices);
+        }
+
+        /** 캐시 미스면 true */
+        bool Access(UINT Vertex)
+        {
+            uint32& Timestamp = Timestamps[static_cast<int32>(Vertex)];
+            if (Time - Timestamp > static_cast<uint32>(CacheSize))
+            {
+                Timestamp = Time++;
+                return true;
+            }
+            return false;
+        }
+
+        int32 AccessTriangle(const UINT* Triangle)
+        {
+            return static_cast<int32>(Access(Triangle[0])) + static_cast<int32>(Access(Triangle[1])) + static_cast<int32>(Access(Triangle[2]));
+        }
+
+        void Flush()
+        {
+            Time += static_cast<uint32>(CacheSize) + 1;
+        }
+    };
+}
+
+FVertexCacheStats FMeshOptimizer::ComputeVertexCacheStats(const UINT* Indices, int32 NumIndices, int32 NumVertices, int32 CacheSize)
+{
+    FVertexCacheStats Stats;
+
+    const int32 NumTriangles = NumIndices / 3;
+    if (NumTriangles == 0)
+    {
+        return Stats;
+    }
+
+    FFifoCache Cache(NumVertices, CacheSize);
+    TArray<uint8> Used;
+    Used.Init(0, NumVertices);
+
+    int32 NumMisses = 0;
+    int32 NumUsedVertices = 0;
+    for (int32 Index = 0; Index < NumTriangles * 3; ++Index)
+    {
+        const UINT Vertex = Indices[Index];
+        if (Cache.Access(Vertex))
+        {
+            ++NumMisses;
+        }
+        if (!Used[static_cast<int32>(Vertex)])
+        {
+            Used[static_cast<int32>(Vertex)] = 1;
+            ++NumUsedVertices;
+        }
+    }
+
+    Stats.ACMR = static_cast<float>(NumMisses) / static_cast<float>(NumTriangles);
+    Stats.ATVR = static_cast<float>(NumMisses) / static_cast<float>(NumUsedVertices);
+    return Stats;
+}
+
+void FMeshOptimizer::OptimizeVertexCache(UINT* Indices, int32 NumIndices, int32 NumVertices)
+{
+    const int32 NumTriangles = NumIndices / 3;
+    if (NumTriangles <= 1)
+    {
+        return;
+    }
+
+    // 버텍스별 인접 삼각형, [Offsets[V], Offsets[V] + NumRemaining[V]) 구간이 아직 그리지 않은 삼각형
+    TArray<int32> NumRemaining;
+    NumRemaining.Init(0, NumVertices);
+    for (int32 Index = 0; Index < NumTriangles * 3; ++Index)
+    {
+        ++NumRemaining[static_cast<int32>(Indices[Index])];
+    }
+
+    TArray<int32> Offsets;
+    Offsets.SetNum(NumVertices);
+    int32 Offset = 0;
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        Offsets[Vertex] = Offset;
+        Offset += NumRemaining[Vertex];
+    }
+
+    TArray<int32> Adjacency;
+    Adjacency.SetNum(NumTriangles * 3);
+    {
+        TArray<int32> Cursors = Offsets;
+        for (int32 Index = 0; Index < NumTriangles * 3; ++Index)
+        {
+            Adjacency[Cursors[static_cast<int32>(Indices[Index])]++] = Index / 3;
+        }
+    }
+
+    TArray<int32> CachePositions;
+    CachePositions.Init(INDEX_NONE, NumVertices);
+
+    TArray<float> VertexScores;
+    VertexScores.SetNum(NumVertices);
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        VertexScores[Vertex] = ComputeVertexScore(INDEX_NONE, NumRemaining[Vertex]);
+    }
+
+    TArray<float> TriangleScores;
+    TriangleScores.SetNum(NumTriangles);
+    int32 BestTriangle = INDEX_NONE;
+    float BestScore = -1.0f;
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        const UINT* Tri = Indices + Triangle * 3;
+        TriangleScores[Triangle] = VertexScores[static_cast<int32>(Tri[0])] + VertexScores[static_cast<int32>(Tri[1])] + VertexScores[static_cast<int32>(Tri[2])];
+        if (TriangleScores[Triangle] > BestScore)
+        {
+            BestScore = TriangleScores[Triangle];
+            BestTriangle = Triangle;
+        }
+    }
+
+    TArray<uint8> Emitted;
+    Emitted.Init(0, NumTriangles);
+
+    TArray<UINT> Output;
+    Output.Reserve(NumTriangles * 3);
+
+    int32 Cache[ForsythCacheSize + 3];
+    int32 CacheCount = 0;
+    int32 NewCache[ForsythCacheSize + 3];
+
+    int32 ScanCursor = 0;
+
+    while (Output.Num() < NumTriangles * 3)
+    {
+        // 캐시 안의 버텍스에 붙은 삼각형이 모두 그려졌다면 아직 그리지 않은 다음 삼각형부터 다시 시작
+        if (BestTriangle == INDEX_NONE)
+        {
+            while (ScanCursor < NumTriangles && Emitted[ScanCursor])
+            {
+                ++ScanCursor;
+            }
+            if (ScanCursor == NumTriangles)
+            {
+                break;
+            }
+            BestTriangle = ScanCursor;
+        }
+
+        const UINT* Tri = Indices + BestTriangle * 3;
+        Emitted[BestTriangle] = 1;
+
+        int32 NewCacheCount = 0;
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 Vertex = static_cast<int32>(Tri[Corner]);
+            Output.Add(Tri[Corner]);
+
+            // 인접 목록에서 이 삼각형을 빼고 남은 수를 줄임
+            const int32 Begin = Offsets[Vertex];
+            const int32 Last = Begin + NumRemaining[Vertex] - 1;
+            for (int32 Slot = Begin; Slot <= Last; ++Slot)
+            {
+                if (Adjacency[Slot] == BestTriangle)
+                {
+                    Adjacency[Slot] = Adjacency[Last];
+                    Adjacency[Last] = BestTriangle;
+                    --NumRemaining[Vertex];
+                    break;
+                }
+            }
+
+            bool bAlreadyAdded = false;
+            for (int32 CacheIndex = 0; CacheIndex < NewCacheCount; ++CacheIndex)
+            {
+                bAlreadyAdded |= NewCache[CacheIndex] == Vertex;
+            }
+            if (!bAlreadyAdded)
+            {
+                NewCache[NewCacheCount++] = Vertex;
+            }
+        }
+
+        const int32 NumTriangleVertices = NewCacheCount;
+        for (int32 CacheIndex = 0; CacheIndex < CacheCount; ++CacheIndex)
+        {
+            const int32 Vertex = Cache[CacheIndex];
+            bool bInTriangle = false;
+            for (int32 Corner = 0; Corner < NumTriangleVertices; ++Corner)
+            {
+                bInTriangle |= NewCache[Corner] == Vertex;
+            }
+            if (!bInTriangle)
+            {
+                NewCache[NewCacheCount++] = Vertex;
+            }
+        }
+
+        // 캐시 밖으로 밀려난 버텍스를 포함해 점수 갱신
+        for (int32 CacheIndex = 0; CacheIndex < NewCacheCount; ++CacheIndex)
+        {
+            const int32 Vertex = NewCache[CacheIndex];
+            CachePositions[Vertex] = CacheIndex < ForsythCacheSize ? CacheIndex : INDEX_NONE;
+            VertexScores[Vertex] = ComputeVertexScore(CachePositions[Vertex], NumRemaining[Vertex]);
+        }
+
+        BestTriangle = INDEX_NONE;
+        BestScore = -1.0f;
+        for (int32 CacheIndex = 0; CacheIndex < NewCacheCount; ++CacheIndex)
+        {
+            const int32 Vertex = NewCache[CacheIndex];
+            const int32 Begin = Offsets[Vertex];
+            const int32 End = Begin + NumRemaining[Vertex];
+            for (int32 Slot = Begin; Slot < End; ++Slot)
+            {
+                const int32 Triangle = Adjacency[Slot];
+                const UINT* AdjacentTri = Indices + Triangle * 3;
+                TriangleScores[Triangle] = VertexScores[static_cast<int32>(AdjacentTri[0])] + VertexScores[static_cast<int32>(AdjacentTri[1])] + VertexScores[static_cast<int32>(AdjacentTri[2])];
+                if (TriangleScores[Triangle] > BestScore)
+                {
+                    BestScore = TriangleScores[Triangle];
+                    BestTriangle = Triangle;
+                }
+            }
+        }
+
+        CacheCount = FMath::Min(NewCacheCount, ForsythCacheSize);
+        for (int32 CacheIndex = 0; CacheIndex < CacheCount; ++CacheIndex)
+        {
+            Cache[CacheIndex] = NewCache[CacheIndex];
+        }
+    }
+
+    std::copy(Output.begin(), Output.end(), Indices);
+}
+
+void FMeshOptimizer::OptimizeOverdraw(UINT* Indices, int32 NumIndices, const TArray<FVector>& Positions, const TArray<FVector>& Normals, float Threshold)
+{
+    const int32 NumTriangles = NumIndices / 3;
+    if (NumTriangles <= 1)
+    {
+        return;
+    }
+
+    FFifoCache Cache(Positions.Num(), StatsCacheSize);
+
+    // 캐시가 완전히 비워지는 지점(세 버텍스 모두 미스)은 순서를 바꿔도 캐시 효율에 영향이 없음
+    TArray<int32> HardBoundaries;
+    HardBoundaries.Add(0);
+    Cache.AccessTriangle(Indices);
+    for (int32 Triangle = 1; Triangle < NumTriangles; ++Triangle)
+    {
+        if (Cache.AccessTriangle(Indices + Triangle * 3) == 3)
+        {
+            HardBoundaries.Add(Triangle);
+        }
+    }
+    HardBoundaries.Add(NumTriangles);
+
+    // 각 묶음 안에서도 누적 ACMR이 묶음 전체 ACMR * Threshold 이하로 내려가면 끊어서 정렬 단위를 늘림
+    TArray<int32> ClusterStarts;
+    for (int32 HardIndex = 0; HardIndex + 1 < HardBoundaries.Num(); ++HardIndex)
+    {
+        const int32 Start = HardBoundaries[HardIndex];
+        const int32 End = HardBoundaries[HardIndex + 1];
+
+        Cache.Flush();
+        int32 ClusterMisses = 0;
+        for (int32 Triangle = Start; Triangle < End; ++Triangle)
+        {
+            ClusterMisses += Cache.AccessTriangle(Indices + Triangle * 3);
+        }
+        const float ClusterThreshold = Threshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Start);
+
+        ClusterStarts.Add(Start);
+
+        Cache.Flush();
+        int32 RunningMisses = 0;
+        int32 RunningTriangles = 0;
+        for (int32 Triangle = Start; Triangle < End; ++Triangle)
+        {
+            RunningMisses += Cache.AccessTriangle(Indices + Triangle * 3);
+            ++RunningTriangles;
+
+            if (Triangle + 1 < End && static_cast<float>(RunningMisses) <= ClusterThreshold * static_cast<float>(RunningTriangles))
+            {
+                ClusterStarts.Add(Triangle + 1);
+                Cache.Flush();
+                RunningMisses = 0;
+                RunningTriangles = 0;
+            }
+        }
+    }
+
+    const int32 NumClusters = ClusterStarts.Num();
+    if (NumClusters <= 1)
+    {
+        return;
+    }
+    ClusterStarts.Add(NumTriangles);
+
+    // 면적 가중 중심과 노멀
+    FVector MeshCentroid = FVector::ZeroVector;
+    float MeshArea = 0.0f;
+    TArray<FVector> ClusterCentroids;
+    TArray<FVector> ClusterNormals;
+    ClusterCentroids.Init(FVector::ZeroVector, NumClusters);
+    ClusterNormals.Init(FVector::ZeroVector, NumClusters);
+
+    for (int32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+    {
+        float ClusterArea = 0.0f;
+        for (int32 Triangle = ClusterStarts[Cluster]; Triangle < ClusterStarts[Cluster + 1]; ++Triangle)
+        {
+            const UINT* Tri = Indices + Triangle * 3;
+            const FVector& P0 = Positions[static_cast<int32>(Tri[0])];
+            const FVector& P1 = Positions[static_cast<int32>(Tri[1])];
+            const FVector& P2 = Positions[static_cast<int32>(Tri[2])];
+
+            const float Area = (P1 - P0).Cross(P2 - P0).Length() * 0.5f;
+            const FVector Center = (P0 + P1 + P2) / 3.0f;
+
+            ClusterCentroids[Cluster] += Center * Area;
+            ClusterArea += Area;
+
+            // 와인딩 방향과 무관하도록 버텍스 노멀로 면의 방향을 정함
+            ClusterNormals[Cluster] += (Normals[static_cast<int32>(Tri[0])] + Normals[static_cast<int32>(Tri[1])] + Normals[static_cast<int32>(Tri[2])]) * Area;
+        }
+
+        MeshCentroid += ClusterCentroids[Cluster];
+        MeshArea += ClusterArea;
+
+        if (ClusterArea > SMALL_NUMBER)
+        {
+            ClusterCentroids[Cluster] = ClusterCentroids[Cluster] / ClusterArea;
+        }
+    }
+
+    if (MeshArea > SMALL_NUMBER)
+    {
+        MeshCentroid = MeshCentroid / MeshArea;
+    }
+
+    // 중심에서 바깥을 향하는 묶음일수록 다른 면을 가릴 가능성이 높으므로 먼저 그림
+    TArray<float> SortKeys;
+    TArray<int32> ClusterOrder;
+    SortKeys.SetNum(NumClusters);
+    ClusterOrder.SetNum(NumClusters);
+    for (int32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+    {
+        SortKeys[Cluster] = (ClusterCentroids[Cluster] - MeshCentroid).Dot(ClusterNormals[Cluster].GetSafeNormal());
+        ClusterOrder[Cluster] = Cluster;
+    }
+
+    std::stable_sort(ClusterOrder.begin(), ClusterOrder.end(), [&SortKeys](int32 A, int32 B)
+    {
+        return SortKeys[A] > SortKeys[B];
+    });
+
+    TArray<UINT> Output;
+    Output.Reserve(NumTriangles * 3);
+    for (const int32 Cluster : ClusterOrder)
+    {
+        for (int32 Index = ClusterStarts[Cluster] * 3; Index < ClusterStarts[Cluster + 1] * 3; ++Index)
+        {
+            Output.Add(Indices[Index]);
+        }
+    }
+
+    std::copy(Output.begin(), Output.end(), Indices);
+}
+
+void FMeshOptimizer::BuildVertexFetchRemap(const TArray<UINT>& Indices, int32 NumVertices, TArray<UINT>& OutRemap)
+{
+    constexpr UINT Unused = ~0u;
+    OutRemap.Init(Unused, NumVertices);
+
+    UINT NextVertex = 0;
+    for (const UINT Index : Indices)
+    {
+        if (OutRemap[static_cast<int32>(Index)] == Unused)
+        {
+            OutRemap[static_cast<int32>(Index)] = NextVertex++;
+        }
+    }
+
+    for (UINT& Remap : OutRemap)
+    {
+        if (Remap == Unused)
+        {
+            Remap = NextVertex++;
+        }
+    }
+}
+
+void FMeshOptimizer::OptimizeStaticMesh(FStaticMeshRenderData& RenderData, const FMeshOptimizeSettings& Settings)
+{
+    const FMeshOptimizeStats Stats = OptimizeMesh(RenderData.Vertices, RenderData.Indices, RenderData.MaterialSubsets, Settings);
+
+    for (const std::shared_ptr<FStaticMeshRenderData>& LOD : RenderData.LODs)
+    {
+        OptimizeMesh(LOD->Vertices, LOD->Indices, LOD->MaterialSubsets, Settings);
+    }
+
+    UE_LOG(ELogLevel::Display, "[Mesh Optimize] %s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+        *RenderData.DisplayName, Stats.Before.ACMR, Stats.After.ACMR, Stats.Before.ATVR, Stats.After.ATVR);
+}
+
+bool FMeshOptimizer::RunSelfTest(int32 GridSize)
+{
+    if (GridSize <= 0)
+    {
+        return false;
+    }
+
+    // MaterialIndex에 원래 버텍스 번호를 넣어 두고 재배치 후 삼각형을 원래 번호로 되돌려 비교
+    const int32 NumColumns = GridSize + 1;
+    TArray<FStaticMeshVertex> SourceVertices;
+    SourceVertices.SetNum(NumColumns * NumColumns);
+    for (int32 Y = 0; Y < NumColumns; ++Y)
+    {
+        for (int32 X = 0; X < NumColumns; ++X)
+        {
+            FStaticMeshVertex& Vertex = SourceVertices[Y * NumColumns + X];
+            Vertex = {};
+            Vertex.X = static_cast<float>(X);
+            Vertex.Y = static_cast<float>(Y);
+            // 볼록한 언덕 모양이라 Overdraw 정렬이 묶음마다 다른 방향을 보게 됨
+            Vertex.Z = std::sin(static_cast<float>(X) * 0.3f) * std::cos(static_cast<float>(Y) * 0.3f);
+            Vertex.NormalZ = 1.0f;
+            Vertex.MaterialIndex = static_cast<uint32>(Y * NumColumns + X);
+        }
+    }
+
+    using FTriangle = std::array<uint32, 3>;
+    TArray<FTriangle> RowMajorTriangles;
+    RowMajorTriangles.Reserve(GridSize * GridSize * 2);
+    for (int32 Y = 0; Y < GridSize; ++Y)
+    {
+        for (int32 X = 0; X < GridSize; ++X)
+        {
+            const uint32 V00 = static_cast<uint32>(Y * NumColumns + X);
+            const uint32 V10 = V00 + 1;
+            const uint32 V01 = V00 + static_cast<uint32>(NumColumns);
+            const uint32 V11 = V01 + 1;
+            RowMajorTriangles.Add({ V00, V01, V10 });
+            RowMajorTriangles.Add({ V10, V01, V11 });
+        }
+    }
+
+    TArray<FTriangle> ShuffledTriangles = RowMajorTriangles;
+    std::mt19937 Random(1234);
+    std::shuffle(ShuffledTriangles.begin(), ShuffledTriangles.end(), Random);
+
+    // 와인딩을 유지한 채 가장 작은 번호가 앞에 오도록 회전
+    auto CanonicalizeTriangle = [](FTriangle Triangle)
+    {
+        const int32 MinCorner = static_cast<int32>(std::min_element(Triangle.begin(), Triangle.end()) - Triangle.begin());
+        std::rotate(Triangle.begin(), Triangle.begin() + MinCorner, Triangle.end());
+        return Triangle;
+    };
+
+    auto CollectTriangles = [&](const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices, uint32 IndexStart, uint32 IndexCount)
+    {
+        TArray<FTriangle> Triangles;
+        Triangles.Reserve(static_cast<int32>(IndexCount / 3));
+        for (uint32 Index = IndexStart; Index + 2 < IndexStart + IndexCount; Index += 3)
+        {
+            Triangles.Add(CanonicalizeTriangle({
+                Vertices[static_cast<int32>(Indices[Index])].MaterialIndex,
+                Vertices[static_cast<int32>(Indices[Index + 1])].MaterialIndex,
+                Vertices[static_cast<int32>(Indices[Index + 2])].MaterialIndex,
+            }));
+        }
+        std::sort(Triangles.begin(), Triangles.end());
+        return Triangles;
+    };
+
+    struct FTestCase
+    {
+        const TCHAR* Name;
+        const TArray<FTriangle>* Triangles;
+        bool bOptimizeOverdraw;
+        int32 NumSubsets;
+    };
+    const FTestCase TestCases[] = {
+        { TEXT("row major"), &RowMajorTriangles, false, 1 },
+        { TEXT("row major + overdraw"), &RowMajorTriangles, true, 1 },
+        { TEXT("shuffled"), &ShuffledTriangles, false, 1 },
+        { TEXT("shuffled + overdraw, 2 subsets"), &ShuffledTriangles, true, 2 },
+    };
+
+    bool bAllPassed = true;
+    for (const FTestCase& TestCase : TestCases)
+    {
+        TArray<FStaticMeshVertex> Vertices = SourceVertices;
+        TArray<UINT> Indices;
+        Indices.Reserve(TestCase.Triangles->Num() * 3);
+        for (const FTriangle& Triangle : *TestCase.Triangles)
+        {
+            Indices.Add(Triangle[0]);
+            Indices.Add(Triangle[1]);
+            Indices.Add(Triangle[2]);
+        }
+
+        // 서브셋 경계는 삼각형 단위로 나눔
+        TArray<FMaterialSubset> Subsets;
+        const uint32 NumTriangles = static_cast<uint32>(TestCase.Triangles->Num());
+        for (int32 SubsetIndex = 0; SubsetIndex < TestCase.NumSubsets; ++SubsetIndex)
+        {
+            const uint32 FirstTriangle = NumTriangles * SubsetIndex / TestCase.NumSubsets;
+            const uint32 LastTriangle = NumTriangles * (SubsetIndex + 1) / TestCase.NumSubsets;
+            FMaterialSubset Subset;
+            Subset.IndexStart = FirstTriangle * 3;
+            Subset.IndexCount = (LastTriangle - FirstTriangle) * 3;
+            Subset.MaterialIndex = static_cast<uint32>(SubsetIndex);
+            Subsets.Add(Subset);
+        }
+
+        TArray<TArray<FTriangle>> ExpectedTriangles;
+        for (const FMaterialSubset& Subset : Subsets)
+        {
+            ExpectedTriangles.Add(CollectTriangles(Vertices, Indices, Subset.IndexStart, Subset.IndexCount));
+        }
+
+        FMeshOptimizeSettings Settings;
+        Settings.bOptimizeOverdraw = TestCase.bOptimizeOverdraw;
+        const FMeshOptimizeStats Stats = OptimizeMesh(Vertices, Indices, Subsets, Settings);
+
+        // 버텍스는 순서만 바뀌고 모두 한 번씩 남아 있어야 함
+        bool bVerticesPreserved = Vertices.Num() == SourceVertices.Num();
+        if (bVerticesPreserved)
+        {
+            TArray<uint8> Seen;
+            Seen.Init(0, Vertices.Num());
+            for (const FStaticMeshVertex& Vertex : Vertices)
+            {
+                const FStaticMeshVertex& Source = SourceVertices[static_cast<int32>(Vertex.MaterialIndex)];
+                bVerticesPreserved &= !Seen[static_cast<int32>(Vertex.MaterialIndex)] && Vertex.X == Source.X && Vertex.Y == Source.Y && Vertex.Z == Source.Z;
+                Seen[static_cast<int32>(Vertex.MaterialIndex)] = 1;
+            }
+        }
+
+        bool bTrianglesPreserved = bVerticesPreserved && Indices.Num() == TestCase.Triangles->Num() * 3;
+        for (int32 SubsetIndex = 0; bTrianglesPreserved && SubsetIndex < Subsets.Num(); ++SubsetIndex)
+        {
+            const FMaterialSubset& Subset = Subsets[SubsetIndex];
+            const TArray<FTriangle> Triangles = CollectTriangles(Vertices, Indices, Subset.IndexStart, Subset.IndexCount);
+            bTrianglesPreserved = std::equal(Triangles.begin(), Triangles.end(), ExpectedTriangles[SubsetIndex].begin(), ExpectedTriangles[SubsetIndex].end());
+        }
+
+        const bool bPassed = Stats.After.ACMR <= Stats.Before.ACMR && bVerticesPreserved && bTrianglesPreserved;
+        bAllPassed &= bPassed;
+
+        UE_LOG(
+            bPassed ? ELogLevel::Display : ELogLevel::Error,
+            TEXT("Mesh optimizer test %s: %s %dx%d, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, vertices %s, triangles %s"),
+            bPassed ? TEXT("PASS") : TEXT("FAIL"), TestCase.Name, GridSize, GridSize,
+            Stats.Before.ACMR, Stats.After.ACMR, Stats.Before.ATVR, Stats.After.ATVR,
+            bVerticesPreserved ? TEXT("kept") : TEXT("changed"), bTrianglesPreserved ? TEXT("kept") : TEXT("changed")
+        );
+    }
+
+    return bAllPassed;
+}
@@ -0,0 +1,154 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Vector.h"
+
+struct FStaticMeshRenderData;
+
+/**
+ * 버텍스 캐시 효율
+ * ACMR: 삼각형당 캐시 미스 수, 0.5에 가까울수록 좋고 최악은 3
+ * ATVR: 사용된 버텍스당 캐시 미스 수, 1이 최적
+ */
+struct FVertexCacheStats
+{
+    float ACMR = 0.f;
+    float ATVR = 0.f;
+};
+
+struct FMeshOptimizeStats
+{
+    FVertexCacheStats Before;
+    FVertexCacheStats After;
+};
+
+struct FMeshOptimizeSettings
+{
+    /** 캐시 순서를 크게 해치지 않는 선에서 바깥을 향한 삼각형 묶음을 먼저 그리도록 재정렬 */
+    bool bOptimizeOverdraw = true;
+
+    /** 묶음을 나눌 때 허용하는 ACMR 증가 비율 */
+    float OverdrawThreshold = 1.05f;
+};
+
+/**
+ * 쿡 단계의 인덱스/버텍스 재정렬
+ *
+ * 1. 서브셋마다 Forsyth 알고리즘으로 삼각형 순서를 정해 Post-Transform 캐시 적중률을 높임
+ * 2. (선택) 캐시 순서를 크게 바꾸지 않는 묶음 단위로 나누어 바깥을 향한 묶음부터 그리도록 정렬해 Overdraw를 줄임
+ * 3. 인덱스에 처음 등장하는 순서로 버텍스를 재배치해 Vertex Fetch 지역성을 높임
+ */
+struct FMeshOptimizer
+{
+    /** 통계는 GPU와 무관하게 비교할 수 있도록 고정 크기 FIFO 캐시로 계산 */
+    static constexpr int32 StatsCacheSize = 16;
+
+    static FVertexCacheStats ComputeVertexCacheStats(const UINT* Indices, int32 NumIndices, int32 NumVertices, int32 CacheSize = StatsCacheSize);
+
+    static void OptimizeVertexCache(UINT* Indices, int32 NumIndices, int32 NumVertices);
+
+    /** 삼각형 순서가 이미 캐시 최적화되어 있다고 가정, Normals는 버텍스 노멀 */
+    static void OptimizeOverdraw(UINT* Indices, int32 NumIndices, const TArray<FVector>& Positions, const TArray<FVector>& Normals, float Threshold);
+
+    /** OutRemap[기존 인덱스] = 새 인덱스, 사용되지 않는 버텍스는 원래 순서대로 뒤에 둠 */
+    static void BuildVertexFetchRemap(const TArray<UINT>& Indices, int32 NumVertices, TArray<UINT>& OutRemap);
+
+    template <typename VertexType>
+    static void OptimizeVertexFetch(TArray<VertexType>& Vertices, TArray<UINT>& Indices);
+
+    /** Subsets가 비어있으면 전체를 하나의 서브셋으로 취급, 서브셋의 범위는 바뀌지 않음 */
+    template <typename VertexType>
+    static FMeshOptimizeStats OptimizeMesh(
+        TArray<VertexType>& Vertices, TArray<UINT>& Indices, const TArray<FMaterialSubset>& Subsets,
+        const FMeshOptimizeSettings& Settings = FMeshOptimizeSettings()
+    );
+
+    /** LOD0과 모든 LOD를 최적화하고 LOD0의 전후 통계를 로그로 남김 */
+    static void OptimizeStaticMesh(FStaticMeshRenderData& RenderData, const FMeshOptimizeSettings& Settings = FMeshOptimizeSettings());
+
+    /**
+     * GridSize x GridSize 격자를 행 순서와 고정 시드로 섞은 순서로 만들어 Overdraw 정렬 유무별로 최적화하고
+     * ACMR이 나빠지지 않는지, 서브셋마다 삼각형 집합(와인딩 포함)과 버텍스 집합이 그대로인지 확인
+     */
+    static bool RunSelfTest(int32 GridSize);
+};
+
+template <typename VertexType>
+void FMeshOptimizer::OptimizeVertexFetch(TArray<VertexType>& Vertices, TArray<UINT>& Indices)
+{
+    TArray<UINT> Remap;
+    BuildVertexFetchRemap(Indices, Vertices.Num(), Remap);
+
+    TArray<VertexType> NewVertices;
+    NewVertices.SetNum(Vertices.Num());
+    for (int32 VertexIndex = 0; VertexIndex < Vertices.Num(); ++VertexIndex)
+    {
+        NewVertices[static_cast<int32>(Remap[VertexIndex])] = Vertices[VertexIndex];
+    }
+
+    for (UINT& Index : Indices)
+    {
+        Index = Remap[static_cast<int32>(Index)];
+    }
+
+    Vertices = std::move(NewVertices);
+}
+
+template <typename VertexType>
+FMeshOptimizeStats FMeshOptimizer::OptimizeMesh(
+    TArray<VertexType>& Vertices, TArray<UINT>& Indices, const TArray<FMaterialSubset>& Subsets,
+    const FMeshOptimizeSettings& Settings
+)
+{
+    FMeshOptimizeStats Stats;
+    Stats.Before = ComputeVertexCacheStats(Indices.GetData(), Indices.Num(), Vertices.Num());
+
+    TArray<FVector> Positions;
+    TArray<FVector> Normals;
+    if (Settings.bOptimizeOverdraw)
+    {
+        Positions.Reserve(Vertices.Num());
+        Normals.Reserve(Vertices.Num());
+        for (const VertexType& Vertex : Vertices)
+        {
+            Positions.Add(FVector(Vertex.X, Vertex.Y, Vertex.Z));
+            Normals.Add(FVector(Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ));
+        }
+    }
+
+    auto OptimizeRange = [&](uint32 IndexStart, uint32 IndexCount)
+    {
+        if (IndexStart + IndexCount > static_cast<uint32>(Indices.Num()))
+        {
+            return;
+        }
+
+        // 삼각형 단위가 아닌 나머지는 건드리지 않음
+        const int32 NumIndices = static_cast<int32>(IndexCount - IndexCount % 3);
+        UINT* RangeIndices = Indices.GetData() + IndexStart;
+
+        OptimizeVertexCache(RangeIndices, NumIndices, Vertices.Num());
+        if (Settings.bOptimizeOverdraw)
+        {
+            OptimizeOverdraw(RangeIndices, NumIndices, Positions, Normals, Settings.OverdrawThreshold);
+        }
+    };
+
+    if (Subsets.IsEmpty())
+    {
+        OptimizeRange(0, Indices.Num());
+    }
+    else
+    {
+        for (const FMaterialSubset& Subset : Subsets)
+        {
+            OptimizeRange(Subset.IndexStart, Subset.IndexCount);
+        }
+    }
+
+    OptimizeVertexFetch(Vertices, Indices);
+
+    Stats.After = ComputeVertexCacheStats(Indices.GetData(), Indices.Num(), Vertices.Num());
+    return Stats;
+}
@@ -0,0 +1,1001 @@
+#include "MeshSimplifier.h"
+
+#include <queue>
+
+#include "Define.h"
+#include "Container/Map.h"
+#include "Engine/Asset/StaticMeshAsset.h"
+#include "Math/MathUtility.h"
+
+namespace
+{
+    /** 평면들까지의 거리 제곱 합을 나타내는 대칭 4x4 행렬, 가중치로 나누어 평균 거리 제곱을 구함 */
+    struct FQuadric
+    {
+        double A00 = 0.0, A01 = 0.0, A02 = 0.0, A11 = 0.0, A12 = 0.0, A22 = 0.0;
+        double B0 = 0.0, B1 = 0.0, B2 = 0.0;
+        double C = 0.0;
+        double Weight = 0.0;
+
+        /** Normal · P + Distance = 0 */
+        void AddPlane(const FVector& Normal, float Distance, double PlaneWeight)
+        {
+            const double X = Normal.X;
+            const double Y = Normal.Y;
+            const double Z = Normal.Z;
+            const double D = Distance;
+
+            A00 += PlaneWeight * X * X;
+            A01 += PlaneWeight * X * Y;
+            A02 += PlaneWeight * X * Z;
+            A11 += PlaneWeight * Y * Y;
+            A12 += PlaneWeight * Y * Z;
+            A22 += PlaneWeight * Z * Z;
+            B0 += PlaneWeight * X * D;
+            B1 += PlaneWeight * Y * D;
+            B2 += PlaneWeight * Z * D;
+            C += PlaneWeight * D * D;
+            Weight += PlaneWeight;
+        }
+
+        FQuadric& operator+=(const FQuadric& Other)
+        {
+            A00 += Other.A00;
+            A01 += Other.A01;
+            A02 += Other.A02;
+            A11 += Other.A11;
+            A12 += Other.A12;
+            A22 += Other.A22;
+            B0 += Other.B0;
+            B1 += Other.B1;
+            B2 += Other.B2;
+            C += Other.C;
+            Weight += Other.Weight;
+            return *this;
+        }
+
+        double Evaluate(const FVector& P) const
+        {
+            if (Weight <= 0.0)
+            {
+                return 0.0;
+            }
+
+            const double X = P.X;
+            const double Y = P.Y;
+            const double Z = P.Z;
+            const double Value = A00 * X * X + A11 * Y * Y + A22 * Z * Z
+                + 2.0 * (A01 * X * Y + A02 * X * Z + A12 * Y * Z)
+                + 2.0 * (B0 * X + B1 * Y + B2 * Z)
+                + C;
+
+            // 부동소수점 오차로 음수가 나올 수 있음
+            return (Value > 0.0 ? Value : 0.0) / Weight;
+        }
+    };
+
+    enum class EVertexKind : uint8
+    {
+        /** 어느 이웃으로든 Collapse 가능 */
+        Free,
+
+        /** 경계선 위의 점, 경계선을 따라서만 Collapse 가능 */
+        Feature,
+
+        /** 경계의 꺾이는 점이나 Non-Manifold, 움직이지 않음 */
+        Locked,
+    };
+
+    struct FEdgeInfo
+    {
+        int32 NumTriangles = 0;
+        int32 Triangle = INDEX_NONE;
+
+        /** 처음 발견한 삼각형에서 번호가 작은 위치, 큰 위치의 버텍스 */
+        uint32 WedgeA = 0;
+        uint32 WedgeB = 0;
+        int32 Subset = 0;
+
+        /** 메시 경계, UV/노멀 Seam, 머티리얼 경계 */
+        bool bFeature = false;
+    };
+
+    struct FCollapse
+    {
+        double Cost;
+        int32 From;
+        int32 To;
+        uint32 FromVersion;
+        uint32 ToVersion;
+
+        bool operator>(const FCollapse& Other) const { return Cost > Other.Cost; }
+    };
+
+    uint64 MakeEdgeKey(int32 A, int32 B)
+    {
+        if (A > B)
+        {
+            std::swap(A, B);
+        }
+        return (static_cast<uint64>(A) << 32) | static_cast<uint32>(B);
+    }
+
+    FVector GetVertexPosition(const FStaticMeshVertex& Vertex)
+    {
+        return FVector(Vertex.X, Vertex.Y, Vertex.Z);
+    }
+
+    /** 경계 평면의 가중치, 경계가 안쪽 면보다 먼저 무너지지 않도록 크게 둠 */
+    constexpr double FeaturePlaneWeight = 4.0;
+
+    /** Collapse 후 삼각형 노멀이 이 값보다 많이 돌아가면 뒤집힌 것으로 보고 Collapse하지 않음 */
+    constexpr float MinNormalDot = 0.2f;
+
+    class FQuadricSimplifier
+    {
+    public:
+        FQuadricSimplifier(const TArray<FStaticMeshVertex>& InVertices, const TArray<UINT>& InIndices, const TArray<FMaterialSubset>& InSubsets)
+            : Vertices(InVertices)
+            , Subsets(InSubsets)
+        {
+            WeldPositions();
+            BuildTriangles(InIndices);
+            ComputeQuadrics();
+            ClassifyEdges();
+        }
+
+        int32 GetNumLiveTriangles() const { return NumLiveTriangles; }
+
+        void Run(int32 TargetTriangleCount, double MaxCost)
+        {
+            for (int32 Position = 0; Position < Positions.Num(); ++Position)
+            {
+                PushCollapses(Position);
+            }
+
+            while (NumLiveTriangles > TargetTriangleCount && !Heap.empty())
+            {
+                const FCollapse Collapse = Heap.top();
+                Heap.pop();
+
+                if (Collapse.Cost > MaxCost)
+                {
+                    break;
+                }
+
+                if (bPositionRemoved[Collapse.From] || bPositionRemoved[Collapse.To]
+                    || Versions[Collapse.From] != Collapse.FromVersion || Versions[Collapse.To] != Collapse.ToVersion)
+                {
+                    continue;
+                }
+
+                if (TryCollapse(Collapse.From, Collapse.To))
+                {
+                    MaxAppliedCost = FMath::Max(MaxAppliedCost, Collapse.Cost);
+                }
+            }
+        }
+
+        void GetResult(TArray<UINT>& OutIndices, TArray<FMaterialSubset>& OutSubsets) const
+        {
+            OutIndices.Empty();
+            OutIndices.Reserve(NumLiveTriangles * 3);
+
+            auto EmitTriangles = [this, &OutIndices](int32 FirstTriangle, int32 EndTriangle)
+            {
+                for (int32 Triangle = FirstTriangle; Triangle < EndTriangle; ++Triangle)
+                {
+                    if (!bTriangleRemoved[Triangle])
+                    {
+                        OutIndices.Add(TriangleWedges[Triangle * 3 + 0]);
+                        OutIndices.Add(TriangleWedges[Triangle * 3 + 1]);
+                        OutIndices.Add(TriangleWedges[Triangle * 3 + 2]);
+                    }
+                }
+            };
+
+            OutSubsets = Subsets;
+            if (Subsets.IsEmpty())
+            {
+                EmitTriangles(0, bTriangleRemoved.Num());
+                return;
+            }
+
+            for (FMaterialSubset& Subset : OutSubsets)
+            {
+                const uint32 IndexStart = OutIndices.Num();
+                EmitTriangles(static_cast<int32>(Subset.IndexStart / 3), static_cast<int32>((Subset.IndexStart + Subset.IndexCount) / 3));
+                Subset.IndexStart = IndexStart;
+                Subset.IndexCount = OutIndices.Num() - IndexStart;
+            }
+        }
+
+        float GetMaxError() const { return static_cast<float>(FMath::Sqrt(MaxAppliedCost)); }
+
+    private:
+        void WeldPositions()
+        {
+            // 위치가 정확히 같은 버텍스는 UV나 노멀이 달라도 같은 위치로 묶음
+            TArray<int32> SortedVertices;
+            SortedVertices.SetNum(Vertices.Num());
+            for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+            {
+                SortedVertices[Index] = Index;
+            }
+
+            SortedVertices.Sort([this](int32 A, int32 B)
+            {
+                const FStaticMeshVertex& VA = Vertices[A];
+                const FStaticMeshVertex& VB = Vertices[B];
+                if (VA.X != VB.X)
+                {
+                    return VA.X < VB.X;
+                }
+                if (VA.Y != VB.Y)
+                {
+                    return VA.Y < VB.Y;
+                }
+                return VA.Z < VB.Z;
+            });
+
+            WedgePositions.SetNum(Vertices.Num());
+            for (int32 SortedIndex = 0; SortedIndex < SortedVertices.Num(); ++SortedIndex)
+            {
+                const FStaticMeshVertex& Vertex = Vertices[SortedVertices[SortedIndex]];
+                const bool bNewPosition = SortedIndex == 0 || [&]
+                {
+                    const FStaticMeshVertex& Previous = Vertices[SortedVertices[SortedIndex - 1]];
+                    return Previous.X != Vertex.X || Previous.Y != Vertex.Y || Previous.Z != Vertex.Z;
+                }();
+
+                if (bNewPosition)
+                {
+                    Positions.Add(GetVertexPosition(Vertex));
+                }
+                WedgePositions[SortedVertices[SortedIndex]] = Positions.Num() - 1;
+            }
+
+            PositionTriangles.SetNum(Positions.Num());
+            Quadrics.SetNum(Positions.Num());
+            Kinds.Init(EVertexKind::Free, Positions.Num());
+            Versions.Init(0, Positions.Num());
+            bPositionRemoved.Init(0, Positions.Num());
+        }
+
+        void BuildTriangles(const TArray<UINT>& Indices)
+        {
+            const int32 NumTriangles = Indices.Num() / 3;
+            TriangleWedges.SetNum(NumTriangles * 3);
+            TriangleSubsets.Init(0, NumTriangles);
+            bTriangleRemoved.Init(0, NumTriangles);
+
+            for (int32 SubsetIndex = 0; SubsetIndex < Subsets.Num(); ++SubsetIndex)
+            {
+                const int32 FirstTriangle = static_cast<int32>(Subsets[SubsetIndex].IndexStart / 3);
+                const int32 EndTriangle = FMath::Min(static_cast<int32>((Subsets[SubsetIndex].IndexStart + Subsets[SubsetIndex].IndexCount) / 3), NumTriangles);
+                for (int32 Triangle = FirstTriangle; Triangle < EndTriangle; ++Triangle)
+                {
+                    TriangleSubsets[Triangle] = SubsetIndex;
+                }
+            }
+
+            for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+            {
+                bool bValid = true;
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    TriangleWedges[Triangle * 3 + Corner] = Indices[Triangle * 3 + Corner];
+                    bValid &= Indices[Triangle * 3 + Corner] < static_cast<UINT>(Vertices.Num());
+                }
+
+                if (bValid)
+                {
+                    const int32 P0 = GetCornerPosition(Triangle, 0);
+                    const int32 P1 = GetCornerPosition(Triangle, 1);
+                    const int32 P2 = GetCornerPosition(Triangle, 2);
+                    bValid = P0 != P1 && P1 != P2 && P2 != P0;
+                }
+
+                if (!bValid)
+                {
+                    bTriangleRemoved[Triangle] = 1;
+                    continue;
+                }
+
+                ++NumLiveTriangles;
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    PositionTriangles[GetCornerPosition(Triangle, Corner)].Add(Triangle);
+                }
+            }
+        }
+
+        void ComputeQuadrics()
+        {
+            for (int32 Triangle = 0; Triangle < bTriangleRemoved.Num(); ++Triangle)
+            {
+                if (bTriangleRemoved[Triangle])
+                {
+                    continue;
+                }
+
+                FVector Normal;
+                float DoubleArea;
+                if (!GetTriangleNormal(Triangle, Normal, DoubleArea))
+                {
+                    continue;
+                }
+
+                const FVector& P0 = Positions[GetCornerPosition(Triangle, 0)];
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    Quadrics[GetCornerPosition(Triangle, Corner)].AddPlane(Normal, -Normal.Dot(P0), DoubleArea * 0.5);
+                }
+            }
+        }
+
+        void ClassifyEdges()
+        {
+            for (int32 Triangle = 0; Triangle < bTriangleRemoved.Num(); ++Triangle)
+            {
+                if (bTriangleRemoved[Triangle])
+                {
+                    continue;
+                }
+
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    uint32 WedgeA = TriangleWedges[Triangle * 3 + Corner];
+                    uint32 WedgeB = TriangleWedges[Triangle * 3 + (Corner + 1) % 3];
+                    if (WedgePositions[WedgeA] > WedgePositions[WedgeB])
+                    {
+                        std::swap(WedgeA, WedgeB);
+                    }
+
+                    const uint64 Key = MakeEdgeKey(WedgePositions[WedgeA], WedgePositions[WedgeB]);
+                    if (FEdgeInfo* Edge = Edges.Find(Key))
+                    {
+                        ++Edge->NumTriangles;
+
+                        // 양쪽 삼각형이 다른 버텍스(UV, 노멀)나 다른 머티리얼을 사용하면 경계
+                        if (Edge->WedgeA != WedgeA || Edge->WedgeB != WedgeB || Edge->Subset != TriangleSubsets[Triangle])
+                        {
+                            Edge->bFeature = true;
+                        }
+                    }
+                    else
+                    {
+                        FEdgeInfo NewEdge;
+                        NewEdge.NumTriangles = 1;
+                        NewEdge.Triangle = Triangle;
+                        NewEdge.WedgeA = WedgeA;
+                        NewEdge.WedgeB = WedgeB;
+                        NewEdge.Subset = TriangleSubsets[Triangle];
+                        Edges.Add(Key, NewEdge);
+                    }
+                }
+            }
+
+            TArray<int32> NumFeatureEdges;
+            NumFeatureEdges.Init(0, Positions.Num());
+
+            for (auto& [Key, Edge] : Edges)
+            {
+                const int32 PositionA = static_cast<int32>(Key >> 32);
+                const int32 PositionB = static_cast<int32>(Key & 0xFFFFFFFF);
+
+                if (Edge.NumTriangles > 2)
+                {
+                    Kinds[PositionA] = EVertexKind::Locked;
+                    Kinds[PositionB] = EVertexKind::Locked;
+                    Edge.bFeature = true;
+                }
+                else if (Edge.NumTriangles == 1)
+                {
+                    Edge.bFeature = true;
+                }
+
+                if (!Edge.bFeature)
+                {
+                    continue;
+                }
+
+                ++NumFeatureEdges[PositionA];
+                ++NumFeatureEdges[PositionB];
+
+                // 경계선을 지나고 삼각형에 수직인 평면으로 경계가 안쪽으로 움직이지 않도록 함
+                FVector TriangleNormal;
+                float DoubleArea;
+                if (GetTriangleNormal(Edge.Triangle, TriangleNormal, DoubleArea))
+                {
+                    const FVector EdgeVector = Positions[PositionB] - Positions[PositionA];
+                    const FVector PlaneNormal = EdgeVector.Cross(TriangleNormal).GetSafeNormal();
+                    const double PlaneWeight = EdgeVector.SquaredLength() * FeaturePlaneWeight;
+                    Quadrics[PositionA].AddPlane(PlaneNormal, -PlaneNormal.Dot(Positions[PositionA]), PlaneWeight);
+                    Quadrics[PositionB].AddPlane(PlaneNormal, -PlaneNormal.Dot(Positions[PositionA]), PlaneWeight);
+                }
+            }
+
+            for (int32 Position = 0; Position < Positions.Num(); ++Position)
+            {
+                if (Kinds[Position] == EVertexKind::Locked || NumFeatureEdges[Position] == 0)
+                {
+                    continue;
+                }
+
+                // 경계선이 이어지는 점만 경계를 따라 움직일 수 있음
+                Kinds[Position] = NumFeatureEdges[Position] == 2 ? EVertexKind::Feature : EVertexKind::Locked;
+            }
+        }
+
+        int32 GetCornerPosition(int32 Triangle, int32 Corner) const
+        {
+            return WedgePositions[TriangleWedges[Triangle * 3 + Corner]];
+        }
+
+        int32 FindCorner(int32 Triangle, int32 Position) const
+        {
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                if (GetCornerPosition(Triangle, Corner) == Position)
+                {
+                    return Corner;
+                }
+            }
+            return INDEX_NONE;
+        }
+
+        bool GetTriangleNormal(int32 Triangle, FVector& OutNormal, float& OutDoubleArea) const
+        {
+            const FVector& P0 = Positions[GetCornerPosition(Triangle, 0)];
+            const FVector& P1 = Positions[GetCornerPosition(Triangle, 1)];
+            const FVector& P2 = Positions[GetCornerPosition(Triangle, 2)];
+
+            const FVector Normal = (P1 - P0).Cross(P2 - P0);
+            OutDoubleArea = Normal.Length();
+            if (OutDoubleArea <= SMALL_NUMBER)
+            {
+                return false;
+            }
+
+            OutNormal = Normal / OutDoubleArea;
+            return true;
+        }
+
+        bool IsFeatureEdge(int32 PositionA, int32 PositionB) const
+        {
+            const FEdgeInfo* Edge = Edges.Find(MakeEdgeKey(PositionA, PositionB));
+            return Edge && Edge->bFeature;
+        }
+
+        void PushCollapse(int32 From, int32 To)
+        {
+            if (Kinds[From] == EVertexKind::Locked)
+            {
+                return;
+            }
+            if (Kinds[From] == EVertexKind::Feature && !IsFeatureEdge(From, To))
+            {
+                return;
+            }
+
+            FQuadric Quadric = Quadrics[From];
+            Quadric += Quadrics[To];
+            Heap.push({ Quadric.Evaluate(Positions[To]), From, To, Versions[From], Versions[To] });
+        }
+
+        void PushCollapses(int32 Position)
+        {
+            for (const int32 Triangle : PositionTriangles[Position])
+            {
+                if (bTriangleRemoved[Triangle])
+                {
+                    continue;
+                }
+
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const int32 Neighbor = GetCornerPosition(Triangle, Corner);
+                    if (Neighbor != Position)
+                    {
+                        PushCollapse(Position, Neighbor);
+                        PushCollapse(Neighbor, Position);
+                    }
+                }
+            }
+        }
+
+        void GatherNeighbors(int32 Position, int32 Excluded, TArray<int32>& OutNeighbors) const
+        {
+            OutNeighbors.Empty();
+            for (const int32 Triangle : PositionTriangles[Position])
+            {
+                if (bTriangleRemoved[Triangle])
+                {
+                    continue;
+                }
+
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const int32 Neighbor = GetCornerPosition(Triangle, Corner);
+                    if (Neighbor != Position && Neighbor != Excluded)
+                    {
+                        OutNeighbors.AddUnique(Neighbor);
+                    }
+                }
+            }
+        }
+
+        bool TryCollapse(int32 From, int32 To)
+        {
+            // From의 버텍스마다 From-To 모서리를 공유하는 삼각형에서 To 쪽의 버텍스를 찾아 대응시킴
+            // Seam 양쪽의 버텍스는 각자 자기 쪽의 버텍스로 합쳐짐
+            WedgeMap.Empty();
+            int32 NumSharedTriangles = 0;
+            for (const int32 Triangle : PositionTriangles[From])
+            {
+                if (bTriangleRemoved[Triangle])
+                {
+                    continue;
+                }
+
+                const int32 ToCorner = FindCorner(Triangle, To);
+                if (ToCorner == INDEX_NONE)
+                {
+                    continue;
+                }
+
+                ++NumSharedTriangles;
+                const uint32 FromWedge = TriangleWedges[Triangle * 3 + FindCorner(Triangle, From)];
+                const uint32 ToWedge = TriangleWedges[Triangle * 3 + ToCorner];
+
+                const int32 MapIndex = WedgeMap.IndexOfByPredicate([FromWedge](const TPair<uint32, uint32>& Pair) { return Pair.Key == FromWedge; });
+                if (MapIndex == INDEX_NONE)
+                {
+                    WedgeMap.Add({ FromWedge, ToWedge });
+                }
+                else if (WedgeMap[MapIndex].Value != ToWedge)
+                {
+                    return false;
+                }
+            }
+
+            if (NumSharedTriangles == 0)
+            {
+                return false;
+            }
+
+            // 양쪽 이웃이 공유하는 삼각형보다 많이 겹치면 Collapse 후 메시가 한 점에서 접힘
+            GatherNeighbors(From, To, FromNeighbors);
+            GatherNeighbors(To, From, ToNeighbors);
+            int32 NumCommonNeighbors = 0;
+            for (const int32 Neighbor : FromNeighbors)
+            {
+                if (ToNeighbors.Contains(Neighbor))
+                {
+                    ++NumCommonNeighbors;
+                }
+            }
+            if (NumCommonNeighbors > NumSharedTriangles)
+            {
+                return false;
+            }
+
+            const FVector& NewPosition = Positions[To];
+            for (const int32 Triangle : PositionTriangles[From])
+            {
+                if (bTriangleRemoved[Triangle] || FindCorner(Triangle, To) != INDEX_NONE)
+                {
+                    continue;
+                }
+
+                const int32 FromCorner = FindCorner(Triangle, From);
+                const uint32 FromWedge = TriangleWedges[Triangle * 3 + FromCorner];
+                if (WedgeMap.IndexOfByPredicate([FromWedge](const TPair<uint32, uint32>& Pair) { return Pair.Key == FromWedge; }) == INDEX_NONE)
+                {
+                    return false;
+                }
+
+                FVector OldNormal;
+                float OldDoubleArea;
+                if (!GetTriangleNormal(Triangle, OldNormal, OldDoubleArea))
+                {
+                    continue;
+                }
+
+                const FVector& P1 = Positions[GetCornerPosition(Triangle, (FromCorner + 1) % 3)];
+                const FVector& P2 = Positions[GetCornerPosition(Triangle, (FromCorner + 2) % 3)];
+                const FVector NewNormal = (P1 - NewPosition).Cross(P2 - NewPosition);
+                const float NewDoubleArea = NewNormal.Length();
+                if (NewDoubleArea <= SMALL_NUMBER || OldNormal.Dot(NewNormal) < MinNormalDot * NewDoubleArea)
+                {
+                    return false;
+                }
+            }
+
+            // 경계선 위의 점이라면 다른 쪽 경계선을 To로 이어줌
+            if (Kinds[From] == EVertexKind::Feature)
+            {
+                for (const int32 Neighbor : FromNeighbors)
+                {
+                    if (IsFeatureEdge(From, Neighbor))
+                    {
+                        FEdgeInfo& Edge = Edges[MakeEdgeKey(To, Neighbor)];
+                        Edge.bFeature = true;
+                    }
+                }
+            }
+
+            for (const int32 Triangle : PositionTriangles[From])
+            {
+                if (bTriangleRemoved[Triangle])
+                {
+                    continue;
+                }
+
+                if (FindCorner(Triangle, To) != INDEX_NONE)
+                {
+                    bTriangleRemoved[Triangle] = 1;
+                    --NumLiveTriangles;
+                    continue;
+                }
+
+                uint32& Wedge = TriangleWedges[Triangle * 3 + FindCorner(Triangle, From)];
+                const int32 MapIndex = WedgeMap.IndexOfByPredicate([Wedge](const TPair<uint32, uint32>& Pair) { return Pair.Key == Wedge; });
+                Wedge = WedgeMap[MapIndex].Value;
+                PositionTriangles[To].Add(Triangle);
+            }
+
+            PositionTriangles[From].Empty();
+            bPositionRemoved[From] = 1;
+            Quadrics[To] += Quadrics[From];
+            ++Versions[To];
+
+            TArray<int32>& ToTriangles = PositionTriangles[To];
+            for (int32 Index = ToTriangles.Num() - 1; Index >= 0; --Index)
+            {
+                if (bTriangleRemoved[ToTriangles[Index]])
+                {
+                    ToTriangles.RemoveAt(Index);
+                }
+            }
+
+            PushCollapses(To);
+            return true;
+        }
+
+        const TArray<FStaticMeshVertex>& Vertices;
+        const TArray<FMaterialSubset>& Subsets;
+
+        /** 버텍스 → 위치 */
+        TArray<int32> WedgePositions;
+
+        TArray<FVector> Positions;
+        TArray<TArray<int32>> PositionTriangles;
+        TArray<FQuadric> Quadrics;
+        TArray<EVertexKind> Kinds;
+        TArray<uint32> Versions;
+        TArray<uint8> bPositionRemoved;
+
+        TArray<uint32> TriangleWedges;
+        TArray<int32> TriangleSubsets;
+        TArray<uint8> bTriangleRemoved;
+        int32 NumLiveTriangles = 0;
+
+        TMap<uint64, FEdgeInfo> Edges;
+
+        std::priority_queue<FCollapse, std::vector<FCollapse>, std::greater<FCollapse>> Heap;
+        double MaxAppliedCost = 0.0;
+
+        TArray<TPair<uint32, uint32>> WedgeMap;
+        TArray<int32> FromNeighbors;
+        TArray<int32> ToNeighbors;
+    };
+}
+
+bool FMeshSimplifier::Simplify(
+    const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices, const TArray<FMaterialSubset>& Subsets,
+    int32 TargetTriangleCount, float MaxError,
+    TArray<UINT>& OutIndices, TArray<FMaterialSubset>& OutSubsets, float* OutError
+)
+{
+    FQuadricSimplifier Simplifier(Vertices, Indices, Subsets);
+    const int32 NumTriangles = Simplifier.GetNumLiveTriangles();
+
+    Simplifier.Run(TargetTriangleCount, static_cast<double>(MaxError) * MaxError);
+    Simplifier.GetResult(OutIndices, OutSubsets);
+
+    if (OutError)
+    {
+        *OutError = Simplifier.GetMaxError();
+    }
+    return Simplifier.GetNumLiveTriangles() < NumTriangles;
+}
+
+void FMeshSimplifier::BuildStaticMeshLODs(FStaticMeshRenderData& RenderData, const FStaticMeshLODSettings& Settings)
+{
+    RenderData.LODs.Empty();
+
+    const int32 NumTriangles = RenderData.Indices.Num() / 3;
+    if (NumTriangles < Settings.MinTriangles)
+    {
+        return;
+    }
+
+    const float BoundsRadius = ((RenderData.BoundingBoxMax - RenderData.BoundingBoxMin) * 0.5f).Length();
+    const float MaxError = BoundsRadius * Settings.MaxRelativeError;
+
+    int32 PreviousNumTriangles = NumTriangles;
+    float ScreenSize = Settings.LOD1ScreenSize;
+
+    TArray<UINT> LODIndices;
+    TArray<FMaterialSubset> LODSubsets;
+    TArray<int32> VertexRemap;
+
+    // 오차가 누적되지 않도록 모든 LOD를 LOD0에서 단순화
+    for (int32 LODIndex = 1; LODIndex <= Settings.NumLODs; ++LODIndex)
+    {
+        const int32 TargetTriangleCount = static_cast<int32>(static_cast<float>(PreviousNumTriangles) * Settings.TrianglePercentPerLOD);
+        if (!Simplify(RenderData.Vertices, RenderData.Indices, RenderData.MaterialSubsets, TargetTriangleCount, MaxError, LODIndices, LODSubsets))
+        {
+            break;
+        }
+
+        // 오차 한도 때문에 거의 줄지 않았다면 더 낮은 LOD도 마찬가지
+        const int32 LODNumTriangles = LODIndices.Num() / 3;
+        if (LODNumTriangles > PreviousNumTriangles * 9 / 10)
+        {
+            break;
+        }
+
+        std::shared_ptr<FStaticMeshRenderData> LOD = std::make_shared<FStaticMeshRenderData>();
+        LOD->ObjectName = RenderData.ObjectName + L"_LOD" + std::to_wstring(LODIndex);
+        LOD->DisplayName = RenderData.DisplayName + "_LOD" + FString::FromInt(LODIndex);
+        LOD->BoundingBoxMin = RenderData.BoundingBoxMin;
+        LOD->BoundingBoxMax = RenderData.BoundingBoxMax;
+        LOD->MaterialSubsets = LODSubsets;
+        LOD->ScreenSize = ScreenSize;
+
+        // 사용하는 버텍스만 남김
+        VertexRemap.Init(INDEX_NONE, RenderData.Vertices.Num());
+        LOD->Indices.Reserve(LODIndices.Num());
+        for (const UINT Index : LODIndices)
+        {
+            if (VertexRemap[Index] == INDEX_NONE)
+            {
+                VertexRemap[Index] = LOD->Vertices.Add(RenderData.Vertices[Index]);
+            }
+            LOD->Indices.Add(static_cast<UINT>(VertexRemap[Index]));
+        }
+
+        RenderData.LODs.Add(LOD);
+
+        PreviousNumTriangles = LODNumTriangles;
+        ScreenSize *= 0.5f;
+    }
+}
+
+namespace
+{
+    /** 표면 거리를 잴 원본 버텍스의 최대 수 */
+    constexpr int32 MaxDistanceSamples = 512;
+
+    /** P에서 삼각형 ABC 위의 가장 가까운 점까지의 거리 제곱 */
+    float PointTriangleDistanceSquared(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+    {
+        const FVector AB = B - A;
+        const FVector AC = C - A;
+        const FVector AP = P - A;
+
+        const float D1 = AB.Dot(AP);
+        const float D2 = AC.Dot(AP);
+        if (D1 <= 0.0f && D2 <= 0.0f)
+        {
+            return (P - A).SizeSquared();
+        }
+
+        const FVector BP = P - B;
+        const float D3 = AB.Dot(BP);
+        const float D4 = AC.Dot(BP);
+        if (D3 >= 0.0f && D4 <= D3)
+        {
+            return (P - B).SizeSquared();
+        }
+
+        const float VC = D1 * D4 - D3 * D2;
+        if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+        {
+            const float V = D1 / (D1 - D3);
+            return (P - (A + AB * V)).SizeSquared();
+        }
+
+        const FVector CP = P - C;
+        const float D5 = AB.Dot(CP);
+        const float D6 = AC.Dot(CP);
+        if (D6 >= 0.0f && D5 <= D6)
+        {
+            return (P - C).SizeSquared();
+        }
+
+        const float VB = D5 * D2 - D1 * D6;
+        if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+        {
+            const float W = D2 / (D2 - D6);
+            return (P - (A + AC * W)).SizeSquared();
+        }
+
+        const float VA = D3 * D6 - D5 * D4;
+        if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+        {
+            const float W = (D4 - D3) / ((D4 - D3) + (D5 - D6));
+            return (P - (B + (C - B) * W)).SizeSquared();
+        }
+
+        const float Denominator = 1.0f / (VA + VB + VC);
+        const float V = VB * Denominator;
+        const float W = VC * Denominator;
+        return (P - (A + AB * V + AC * W)).SizeSquared();
+    }
+
+    /** 원본 버텍스 일부에서 단순화된 삼각형들까지의 최대 거리 */
+    float MeasureSurfaceDistance(const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& SimplifiedIndices)
+    {
+        if (SimplifiedIndices.IsEmpty())
+        {
+            return 0.0f;
+        }
+
+        const int32 Stride = FMath::Max(1, Vertices.Num() / MaxDistanceSamples);
+        float MaxDistanceSquared = 0.0f;
+        for (int32 VertexIndex = 0; VertexIndex < Vertices.Num(); VertexIndex += Stride)
+        {
+            const FVector P = GetVertexPosition(Vertices[VertexIndex]);
+            float ClosestSquared = FLT_MAX;
+            for (int32 Index = 0; Index + 2 < SimplifiedIndices.Num(); Index += 3)
+            {
+                ClosestSquared = FMath::Min(ClosestSquared, PointTriangleDistanceSquared(
+                    P,
+                    GetVertexPosition(Vertices[SimplifiedIndices[Index + 0]]),
+                    GetVertexPosition(Vertices[SimplifiedIndices[Index + 1]]),
+                    GetVertexPosition(Vertices[SimplifiedIndices[Index + 2]])
+                ));
+            }
+            MaxDistanceSquared = FMath::Max(MaxDistanceSquared, ClosestSquared);
+        }
+        return FMath::Sqrt(MaxDistanceSquared);
+    }
+
+    /** 인덱스 범위, 인덱스가 겹치는 삼각형, 서브셋이 순서대로 빈틈없이 이어지는지 검사하고 문제의 수를 반환 */
+    int32 ValidateSimplifiedMesh(
+        int32 NumVertices, const TArray<FMaterialSubset>& Subsets,
+        const TArray<UINT>& OutIndices, const TArray<FMaterialSubset>& OutSubsets
+    )
+    {
+        int32 NumProblems = OutIndices.Num() % 3 == 0 ? 0 : 1;
+        for (int32 Index = 0; Index + 2 < OutIndices.Num(); Index += 3)
+        {
+            const UINT I0 = OutIndices[Index + 0];
+            const UINT I1 = OutIndices[Index + 1];
+            const UINT I2 = OutIndices[Index + 2];
+            const bool bInRange = I0 < static_cast<UINT>(NumVertices) && I1 < static_cast<UINT>(NumVertices) && I2 < static_cast<UINT>(NumVertices);
+            NumProblems += bInRange && I0 != I1 && I1 != I2 && I0 != I2 ? 0 : 1;
+        }
+
+        if (!Subsets.IsEmpty())
+        {
+            NumProblems += OutSubsets.Num() == Subsets.Num() ? 0 : 1;
+
+            uint32 ExpectedStart = 0;
+            for (int32 SubsetIndex = 0; SubsetIndex < FMath::Min(Subsets.Num(), OutSubsets.Num()); ++SubsetIndex)
+            {
+                const FMaterialSubset& Subset = OutSubsets[SubsetIndex];
+                NumProblems += Subset.IndexStart == ExpectedStart && Subset.IndexCount % 3 == 0 ? 0 : 1;
+                NumProblems += Subset.MaterialIndex == Subsets[SubsetIndex].MaterialIndex ? 0 : 1;
+                NumProblems += Subset.IndexCount <= Subsets[SubsetIndex].IndexCount ? 0 : 1;
+                ExpectedStart = Subset.IndexStart + Subset.IndexCount;
+            }
+            NumProblems += ExpectedStart == static_cast<uint32>(OutIndices.Num()) ? 0 : 1;
+        }
+
+        return NumProblems;
+    }
+}
+
+bool FMeshSimplifier::RunSelfTest(const FStaticMeshRenderData& RenderData)
+{
+    const int32 NumTriangles = RenderData.Indices.Num() / 3;
+    if (NumTriangles == 0)
+    {
+        UE_LOG(ELogLevel::Warning, TEXT("Mesh simplifier test %s: no triangles"), *RenderData.DisplayName);
+        return false;
+    }
+
+    const FStaticMeshLODSettings Settings;
+    const float BoundsRadius = ((RenderData.BoundingBoxMax - RenderData.BoundingBoxMin) * 0.5f).Length();
+    const float ErrorBounds[] = { BoundsRadius * Settings.MaxRelativeError, FLT_MAX };
+    constexpr int32 NumTargets = 3;
+    const float TargetPercents[NumTargets] = { 0.5f, 0.25f, 0.1f };
+
+    int32 NumFailures = 0;
+    auto Check = [&NumFailures, &RenderData](bool bCondition, const TCHAR* What, float TargetPercent)
+    {
+        if (!bCondition)
+        {
+            UE_LOG(ELogLevel::Error, TEXT("Mesh simplifier test %s: %s (target %.0f%%)"), *RenderData.DisplayName, What, TargetPercent * 100.0f);
+            ++NumFailures;
+        }
+    };
+
+    TArray<UINT> OutIndices;
+    TArray<FMaterialSubset> OutSubsets;
+
+    // 오차 한도마다, 목표를 줄일수록 삼각형이 줄거나 같아야 함
+    int32 BoundedTriangles[NumTargets] = {};
+    for (const float MaxError : ErrorBounds)
+    {
+        const bool bUnbounded = MaxError == FLT_MAX;
+        int32 PreviousTriangles = NumTriangles;
+
+        for (int32 TargetIndex = 0; TargetIndex < NumTargets; ++TargetIndex)
+        {
+            const float TargetPercent = TargetPercents[TargetIndex];
+            const int32 TargetTriangleCount = static_cast<int32>(static_cast<float>(NumTriangles) * TargetPercent);
+
+            float ReportedError = 0.0f;
+            Simplify(RenderData.Vertices, RenderData.Indices, RenderData.MaterialSubsets, TargetTriangleCount, MaxError, OutIndices, OutSubsets, &ReportedError);
+            const int32 OutTriangles = OutIndices.Num() / 3;
+
+            Check(ValidateSimplifiedMesh(RenderData.Vertices.Num(), RenderData.MaterialSubsets, OutIndices, OutSubsets) == 0, TEXT("invalid indices or subsets"), TargetPercent);
+            Check(OutTriangles <= PreviousTriangles, TEXT("a lower target left more triangles"), TargetPercent);
+            Check(ReportedError <= MaxError * 1.0001f, TEXT("reported error exceeds the bound"), TargetPercent);
+
+            // 오차 한도가 있는 실행은 한도가 없는 실행의 앞부분과 같은 Collapse를 수행
+            if (bUnbounded)
+            {
+                Check(OutTriangles <= BoundedTriangles[TargetIndex], TEXT("removing the error bound left more triangles"), TargetPercent);
+            }
+            else
+            {
+                BoundedTriangles[TargetIndex] = OutTriangles;
+            }
+
+            const float SurfaceDistance = MeasureSurfaceDistance(RenderData.Vertices, OutIndices);
+            UE_LOG(
+                ELogLevel::Display,
+                TEXT("Mesh simplifier test %s: target %.0f%% %s, %d -> %d triangles (target %s), reported error %.4f, sampled surface distance %.4f (bounds radius %.3f)"),
+                *RenderData.DisplayName, TargetPercent * 100.0f, bUnbounded ? TEXT("unbounded") : TEXT("bounded"),
+                NumTriangles, OutTriangles, OutTriangles <= TargetTriangleCount ? TEXT("reached") : TEXT("stopped early"),
+                ReportedError, SurfaceDistance, BoundsRadius
+            );
+
+            PreviousTriangles = OutTriangles;
+        }
+    }
+
+    // 임포트 때와 같은 설정으로 LOD 생성
+    FStaticMeshRenderData LODData = RenderData;
+    BuildStaticMeshLODs(LODData, Settings);
+
+    Check(LODData.LODs.Num() <= Settings.NumLODs, TEXT("too many LODs"), 0.0f);
+    Check(NumTriangles >= Settings.MinTriangles || LODData.LODs.IsEmpty(), TEXT("LODs built for a mesh under the minimum triangle count"), 0.0f);
+
+    int32 PreviousTriangles = NumTriangles;
+    float ExpectedScreenSize = Settings.LOD1ScreenSize;
+    for (const std::shared_ptr<FStaticMeshRenderData>& LOD : LODData.LODs)
+    {
+        const int32 LODTriangles = LOD->Indices.Num() / 3;
+        Check(LODTriangles <= PreviousTriangles * 9 / 10, TEXT("a LOD removed less than 10% of the triangles"), 0.0f);
+        Check(FMath::IsNearlyEqual(LOD->ScreenSize, ExpectedScreenSize), TEXT("unexpected LOD screen size"), 0.0f);
+        Check(ValidateSimplifiedMesh(LOD->Vertices.Num(), RenderData.MaterialSubsets, LOD->Indices, LOD->MaterialSubsets) == 0, TEXT("invalid LOD indices or subsets"), 0.0f);
+
+        PreviousTriangles = LODTriangles;
+        ExpectedScreenSize *= 0.5f;
+    }
+
+    UE_LOG(
+        NumFailures == 0 ? ELogLevel::Display : ELogLevel::Error,
+        TEXT("Mesh simplifier test %s %s: %d triangles, %d LODs, %d failures"),
+        *RenderData.DisplayName, NumFailures == 0 ? TEXT("PASS") : TEXT("FAIL"), NumTriangles, LODData.LODs.Num(), NumFailures
+    );
+    return NumFailures == 0;
+}
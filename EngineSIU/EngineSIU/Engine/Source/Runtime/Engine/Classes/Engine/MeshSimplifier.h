@@ -0,0 +1,64 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+struct FStaticMeshVertex;
+struct FMaterialSubset;
+struct FStaticMeshRenderData;
+
+/** Static Mesh LOD 생성 설정 */
+struct FStaticMeshLODSettings
+{
+    /** LOD0을 제외하고 만들 LOD 수 */
+    int32 NumLODs = 3;
+
+    /** 각 LOD는 이전 LOD의 이 비율만큼의 삼각형을 목표로 함 */
+    float TrianglePercentPerLOD = 0.5f;
+
+    /** LOD1이 사용되기 시작하는 화면 크기, 이후 LOD마다 절반 */
+    float LOD1ScreenSize = 0.5f;
+
+    /** 삼각형이 이보다 적은 메시는 LOD를 만들지 않음 */
+    int32 MinTriangles = 256;
+
+    /** 단순화로 생기는 최대 오차, 메시 경계 구의 반지름 대비 비율 */
+    float MaxRelativeError = 0.05f;
+};
+
+/**
+ * Quadric Error Metric을 이용한 Edge Collapse 메시 단순화
+ *
+ * 버텍스를 위치가 같은 것끼리 묶어 Edge Collapse를 수행하고, Collapse되는 버텍스는 이웃 버텍스로 합쳐지므로
+ * 남은 버텍스의 UV, 노멀은 원본 값을 그대로 사용합니다.
+ * 메시 경계, UV/노멀 Seam, 머티리얼 경계에 놓인 버텍스는 그 경계를 따라서만 이동하고, 경계의 꺾이는 점은 움직이지 않습니다.
+ */
+struct FMeshSimplifier
+{
+    /**
+     * Indices가 가리키는 삼각형을 TargetTriangleCount개 이하로 줄입니다.
+     * MaxError보다 큰 오차를 만드는 Collapse는 하지 않으므로 목표보다 삼각형이 많이 남을 수 있습니다.
+     *
+     * @param Subsets 비어있지 않다면 삼각형은 서브셋 순서로 정렬되어 있어야 하며, OutSubsets에 같은 순서로 갱신된 범위를 씁니다.
+     * @param OutIndices 원본 Vertices를 가리키는 인덱스
+     * @param OutError 수행한 Collapse 중 가장 큰 오차, 원본 표면과의 거리 단위
+     * @return 삼각형이 하나라도 줄었다면 true
+     */
+    static bool Simplify(
+        const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices, const TArray<FMaterialSubset>& Subsets,
+        int32 TargetTriangleCount, float MaxError,
+        TArray<UINT>& OutIndices, TArray<FMaterialSubset>& OutSubsets, float* OutError = nullptr
+    );
+
+    /** RenderData의 LOD0으로부터 LOD들을 만들어 RenderData.LODs를 채웁니다. */
+    static void BuildStaticMeshLODs(FStaticMeshRenderData& RenderData, const FStaticMeshLODSettings& Settings = FStaticMeshLODSettings());
+
+    /**
+     * RenderData의 LOD0을 여러 목표 삼각형 수와 오차 한도로 단순화하고 결과를 검사하여 로그로 출력합니다.
+     * - 삼각형 수가 원본 이하이고, 목표나 오차 한도를 늘리면 줄어들거나 같은지, 보고된 오차가 한도 이하인지
+     * - 인덱스 범위, 인덱스가 겹치는 삼각형, 서브셋 범위
+     * - 원본 버텍스에서 단순화된 표면까지의 거리 (일부 버텍스만 샘플링)
+     * - BuildStaticMeshLODs가 만든 LOD의 수, 삼각형 감소, ScreenSize
+     * @return 모든 검사를 통과하면 true
+     */
+    static bool RunSelfTest(const FStaticMeshRenderData& RenderData);
+};
@@ -7,12 +7,17 @@
 #include "World/World.h"
 #include "Components/CarComponent.h"
 #include "BodyInstance.h"
+#include "PhysXJobDispatcher.h"
+#include "Physics/PhysicsSceneQuery.h"
 
 UPhysicsManager::UPhysicsManager()
 {
     TolerancesScale = new PxTolerancesScale();
 }
 
+// VehicleRaycastRequests의 요소 타입은 헤더에서 전방 선언만 하므로 소멸자는 여기서 정의
+UPhysicsManager::~UPhysicsManager() = default;
+
 void UPhysicsManager::Initialize()
 {
     // Foundation Initialize
@@ -36,7 +41,16 @@ void UPhysicsManager::Initialize()
     // Scene Configuration
     PxSceneDesc SceneDesc(Physics->getTolerancesScale());
     SceneDesc.gravity = PxVec3(0.0f, 0.0f, -9.81f);
-    Dispatcher = PxDefaultCpuDispatcherCreate(4);
+    if (bUseEngineJobSystem)
+    {
+        // Game Thread와 Tick Worker가 쓰는 코어를 PhysX가 따로 점유하지 않도록 같은 Worker를 공유
+        JobDispatcher = new FPhysXJobDispatcher();
+        Dispatcher = JobDispatcher;
+    }
+    else
+    {
+        Dispatcher = PxDefaultCpuDispatcherCreate(4);
+    }
 
     SceneDesc.cpuDispatcher = Dispatcher;
 
@@ -67,6 +81,76 @@ void UPhysicsManager::Initialize()
     Cooking = PxCreateCooking(PX_PHYSICS_VERSION, *Foundation, PxCookingParams(Physics->getTolerancesScale()));
 }
 
+void UPhysicsManager::Shutdown()
+{
+    if (!Physics)
+    {
+        return;
+    }
+
+    // 아직 Scene에 추가되지 않은 객체도 있으므로 removeActor 없이 해제, Scene에 있던 Actor는 release가 Scene에서 제거함
+    TArray<GameObject*> AllGameObjects = GameObjects;
+    for (GameObject* Object : PendingSpawnGameObjects)
+    {
+        AllGameObjects.AddUnique(Object);
+    }
+    for (GameObject* Object : PendingRemoveGameObjects)
+    {
+        AllGameObjects.AddUnique(Object);
+    }
+    for (GameObject* Object : AllGameObjects)
+    {
+        Object->Release();
+        delete Object;
+    }
+    GameObjects.Empty();
+    PendingSpawnGameObjects.Empty();
+    PendingRemoveGameObjects.Empty();
+
+    // Scene이 Dispatcher와 Callback을 참조하므로 Scene을 먼저 해제
+    Scene->release();
+    Scene = nullptr;
+
+    delete SimCallback;
+    SimCallback = nullptr;
+
+    if (JobDispatcher)
+    {
+        delete JobDispatcher;
+        JobDispatcher = nullptr;
+    }
+    else
+    {
+        static_cast<PxDefaultCpuDispatcher*>(Dispatcher)->release();
+    }
+    Dispatcher = nullptr;
+
+    Cooking->release();
+    Cooking = nullptr;
+
+#ifdef _DEBUG
+    PxCloseExtensions();
+    PxPvd* Pvd = Physics->getPvd();
+#endif
+    Physics->release();
+    Physics = nullptr;
+
+#ifdef _DEBUG
+    if (Pvd)
+    {
+        PxPvdTransport* Transport = Pvd->getTransport();
+        Pvd->release();
+        if (Transport)
+        {
+            Transport->release();
+        }
+    }
+#endif
+
+    Foundation->release();
+    Foundation = nullptr;
+}
+
 GameObject* UPhysicsManager::SpawnGameObject(
     FBodyInstance* InBodyInstance,
     const PxVec3& Position,
@@ -120,6 +204,12 @@ GameObject* UPhysicsManager::SpawnGameObject(
 }
 
 void UPhysicsManager::Simulate(float DeltaTime)
+{
+    StartSimulation(DeltaTime);
+    FinishSimulation();
+}
+
+void UPhysicsManager::StartSimulation(float DeltaTime)
 {
     for (GameObject* Object : GameObjects)
     {
@@ -140,10 +230,61 @@ void UPhysicsManager::Simulate(float DeltaTime)
         //}
     }
 
-    if (Car)
-        Car->MoveCar();
+    SimulateVehicles(DeltaTime);
 
     Scene->simulate(DeltaTime);
+}
+
+void UPhysicsManager::SimulateVehicles(float DeltaTime)
+{
+    if (CarComponents.IsEmpty())
+    {
+        return;
+    }
+
+    for (UCarComponent* CarComponent : CarComponents)
+    {
+        CarComponent->PreVehicleSimulate();
+    }
+
+    // 차체와 바퀴 채널은 제외해서 Ray가 자기 차체에 맞지 않게 함
+    const FPhysicsSceneQuery SceneQuery(Scene);
+    FCollisionQueryParams QueryParams;
+    QueryParams.ChannelMask = static_cast<uint32>(ECC_AllChannels) & ~static_cast<uint32>(ECC_CarBody | ECC_Wheel);
+
+    VehicleManager.Simulate(
+        DeltaTime,
+        [this, &SceneQuery, &QueryParams](const TArray<FVehicleWheelRay>& Rays, TArray<FVehicleWheelHit>& OutHits)
+        {
+            VehicleRaycastRequests.SetNum(Rays.Num());
+            for (int32 RayIndex = 0; RayIndex < Rays.Num(); ++RayIndex)
+            {
+                const FVehicleWheelRay& Ray = Rays[RayIndex];
+                const PxVec3 End = Ray.Start + Ray.Direction * Ray.Length;
+                VehicleRaycastRequests[RayIndex].Start = FVector(Ray.Start.x, Ray.Start.y, Ray.Start.z);
+                VehicleRaycastRequests[RayIndex].End = FVector(End.x, End.y, End.z);
+            }
+
+            SceneQuery.RaycastBatch(VehicleRaycastRequests, VehicleRaycastHits, QueryParams);
+
+            for (int32 RayIndex = 0; RayIndex < Rays.Num(); ++RayIndex)
+            {
+                const FHitResult& Hit = VehicleRaycastHits[RayIndex];
+                OutHits[RayIndex].bHit = Hit.bBlockingHit;
+                OutHits[RayIndex].Distance = Hit.Distance;
+                OutHits[RayIndex].Normal = Hit.ImpactNormal.ToPxVec3();
+            }
+        }
+    );
+
+    for (UCarComponent* CarComponent : CarComponents)
+    {
+        CarComponent->PostVehicleSimulate();
+    }
+}
+
+void UPhysicsManager::FinishSimulation()
+{
     Scene->fetchResults(true);
 
     if (PendingSpawnGameObjects.Num() > 0)
@@ -179,8 +320,10 @@ void UPhysicsManager::Simulate(float DeltaTime)
         }
     }
 
-    if (Car)
-        Car->UpdatePhysics();
+    for (UCarComponent* CarComponent : CarComponents)
+    {
+        CarComponent->UpdatePhysics();
+    }
 }
 
 void UPhysicsManager::RemoveGameObjects()
@@ -203,6 +346,26 @@ void UPhysicsManager::RemoveGameObject(GameObject* InGameObject)
 }
 
 
+void UPhysicsManager::RegisterCar(UCarComponent* InCar)
+{
+    if (CarComponents.Contains(InCar))
+    {
+        return;
+    }
+    CarComponents.Add(InCar);
+    VehicleManager.AddVehicle(InCar->GetVehicle());
+}
+
+void UPhysicsManager::UnregisterCar(UCarComponent* InCar)
+{
+    if (!CarComponents.Contains(InCar))
+    {
+        return;
+    }
+    CarComponents.Remove(InCar);
+    VehicleManager.RemoveVehicle(InCar->GetVehicle());
+}
+
 void UPhysicsManager::InputKey(const FKeyEvent& InKeyEvent)
 {
     if (!Car)
@@ -259,6 +422,18 @@ void UPhysicsManager::InputKey(const FKeyEvent& InKeyEvent)
         }
         break;
     }
+    case ' ':
+    {
+        if (InKeyEvent.GetInputEvent() == IE_Pressed)
+        {
+            Car->PressedKeys.Add(EKeys::SpaceBar);
+        }
+        else if (InKeyEvent.GetInputEvent() == IE_Released)
+        {
+            Car->PressedKeys.Remove(EKeys::SpaceBar);
+        }
+        break;
+    }
     }
 }
 
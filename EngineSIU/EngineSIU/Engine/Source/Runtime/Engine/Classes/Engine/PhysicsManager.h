@@ -7,6 +7,8 @@
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 #include "Core/Container/Array.h"
+#include "Engine/HitResult.h"
+#include "Physics/VehicleSimulation.h"
 
 
 using namespace physx;
@@ -15,6 +17,8 @@ using namespace DirectX;
 class USceneComponent;
 class UCarComponent;
 class FBodyInstance;
+class FPhysXJobDispatcher;
+struct FRaycastRequest;
 
 #define SCOPED_READ_LOCK(scene) PxSceneReadLock scopedReadLock(scene);
 #define SCOPED_WRITE_LOCK(scene) PxSceneWriteLock scopedWriteLock(scene);
@@ -44,7 +48,7 @@ class UPhysicsManager : public UObject
     DECLARE_CLASS(UPhysicsManager, UObject)
 public:
     UPhysicsManager();
-    ~UPhysicsManager() = default;
+    ~UPhysicsManager();
 
     static UPhysicsManager& Get()
     {
@@ -54,7 +58,9 @@ public:
 
     // Physics lifecycle
     void Initialize();
-    //void Shutdown();
+
+    /** 남은 GameObject와 Scene, Dispatcher, PhysX 객체를 모두 해제합니다. FJobSystem보다 먼저 호출해야 합니다. */
+    void Shutdown();
 
     // Spawn Physics scne game object
     class GameObject* SpawnGameObject(
@@ -68,6 +74,12 @@ public:
 
     void Simulate(float DeltaTime);
 
+    /** Component의 Transform을 Physics Body에 반영하고 시뮬레이션을 시작합니다. 결과를 기다리지 않습니다. */
+    void StartSimulation(float DeltaTime);
+
+    /** 시뮬레이션이 끝나기를 기다린 뒤, 결과를 Component에 반영합니다. */
+    void FinishSimulation();
+
     void RemoveGameObjects();
 
     int GetRemoveGameObjectNum() { return PendingRemoveGameObjects.Num(); }
@@ -81,6 +93,11 @@ public:
 
     void InputKey(const FKeyEvent& InKeyEvent);
 
+    void RegisterCar(UCarComponent* InCar);
+    void UnregisterCar(UCarComponent* InCar);
+
+    FVehicleManager& GetVehicleManager() { return VehicleManager; }
+
 private:
     PxDefaultAllocator Allocator;
     PhysXErrorCallback ErrorCallback;
@@ -89,7 +106,10 @@ private:
     PxScene* Scene = nullptr;
     PxCooking* Cooking = nullptr;
     PxTolerancesScale* TolerancesScale = nullptr;
-    PxDefaultCpuDispatcher* Dispatcher = nullptr;
+    PxCpuDispatcher* Dispatcher = nullptr;
+
+    /** bUseEngineJobSystem일 때 사용하는 Dispatcher, Dispatcher와 같은 객체를 가리킴 */
+    FPhysXJobDispatcher* JobDispatcher = nullptr;
 
     TArray<GameObject*> GameObjects;
     TArray<GameObject*> PendingRemoveGameObjects;
@@ -97,18 +117,39 @@ private:
 
     // 콜백 시스템
     FPhysicsSimulationEventCallback* SimCallback = nullptr;
+
+    /** 등록된 모든 차를 서브스텝으로 진행하고, 바퀴 Raycast는 서브스텝마다 한 번의 RaycastBatch로 처리 */
+    void SimulateVehicles(float DeltaTime);
+
+    TArray<UCarComponent*> CarComponents;
+    FVehicleManager VehicleManager;
+
+    /** SimulateVehicles에서 서브스텝마다 재사용, 물리 씬마다 따로 둠 */
+    TArray<FRaycastRequest> VehicleRaycastRequests;
+    TArray<FHitResult> VehicleRaycastHits;
     
 
 public:
     FOnPhysicsContact OnPhysicsContact;
+    /** 키 입력을 받는 차 */
     UCarComponent* Car = nullptr;
+
+    /**
+     * true라면 PhysX Task를 엔진의 FJobSystem Worker에서 실행하고, false라면 PhysX 전용 스레드를 생성합니다.
+     * Initialize 전에 설정해야 합니다.
+     */
+    bool bUseEngineJobSystem = true;
 };
 
 enum ECollisionChannel
 {
     ECC_CarBody = (1 << 0),
     ECC_Wheel = (1 << 1),
+    /** 채널을 지정하지 않은 Shape(Simulation Filter Data의 word0가 0)는 씬 쿼리에서 이 채널로 취급 */
+    ECC_WorldDefault = (1 << 2),
     // 필요 시 다른 채널…
+
+    ECC_AllChannels = 0xFFFFFFFF,
 };
 
 PxFilterFlags MySimulationFilterShader(
@@ -8,33 +8,42 @@
 #include "D3D11RHI/GraphicDevice.h"
 #include "DirectXTK/DDSTextureLoader.h"
 #include "Engine/FObjLoader.h"
+#include "Engine/TextureCooker.h"
+#include "Engine/TextureStreamer.h"
+#include "UserInterface/Console.h"
 
 
 void FResourceManager::Initialize(FRenderer* Renderer, FGraphicsDevice* Device)
 {
+    FTextureStreamer::Get().Initialize(Device->Device, Device->DeviceContext);
+
     LoadTextureFromDDS(Device->Device, Device->DeviceContext, L"Assets/Texture/font.dds");
     LoadTextureFromDDS(Device->Device, Device->DeviceContext, L"Assets/Texture/UUID_Font.dds");
 
     LoadTextureFromFile(Device->Device, L"Assets/Texture/ocean_sky.jpg");
-    LoadTextureFromFile(Device->Device, L"Assets/Texture/font.png");
-    LoadTextureFromFile(Device->Device, L"Assets/Texture/T_Explosion_SubUV.png");
-    LoadTextureFromFile(Device->Device, L"Assets/Texture/UUID_Font.png");
-    LoadTextureFromFile(Device->Device, L"Assets/Texture/spotLight.png");
-
-    LoadTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_Actor.PNG");
-    LoadTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_LightSpot.PNG");
-    LoadTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_LightPoint.PNG");
-    LoadTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_LightDirectional.PNG");
-    LoadTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_ExpoHeightFog.PNG");
-    LoadTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_AtmosphericHeightFog.PNG");
-    LoadTextureFromFile(Device->Device, L"Assets/Editor/Icon/AmbientLight_64x.png");
+
+    // 폰트, SubUV 아틀라스, 아이콘은 밉이 섞이거나 압축으로 뭉개지지 않도록 원본 그대로 사용
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Texture/font.png");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Texture/T_Explosion_SubUV.png");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Texture/UUID_Font.png");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Texture/spotLight.png");
+
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_Actor.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_LightSpot.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_LightPoint.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_LightDirectional.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_ExpoHeightFog.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Editor/Icon/S_AtmosphericHeightFog.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Editor/Icon/AmbientLight_64x.png");
     
-    LoadTextureFromFile(Device->Device, L"Assets/Viewer/Bone_16x.PNG");
-    LoadTextureFromFile(Device->Device, L"Assets/Viewer/BoneNonWeighted_16x.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Viewer/Bone_16x.PNG");
+    LoadUncookedTextureFromFile(Device->Device, L"Assets/Viewer/BoneNonWeighted_16x.PNG");
 }
 
 void FResourceManager::Release(FRenderer* Renderer)
 {
+    FTextureStreamer::Get().Release();
+
     for (const auto& Pair : TextureMap)
     {
         FTexture* Texture = Pair.Value.get();
@@ -72,6 +81,35 @@ std::shared_ptr<FTexture> FResourceManager::GetTexture(const FWString& Name) con
 }
 
 HRESULT FResourceManager::LoadTextureFromFile(ID3D11Device* Device, const wchar_t* Filename, bool bIsSRGB)
+{
+    const FWString Name = FWString(Filename);
+
+    // 스트리밍 중인 텍스처는 SRV가 계속 교체되므로 같은 파일은 한 번만 등록
+    if (TextureMap.Contains(Name))
+    {
+        return S_OK;
+    }
+
+    FTextureCookSettings Settings;
+    Settings.bSRGB = bIsSRGB;
+
+    FWString CookedPath;
+    FCookedTextureHeader Header;
+    if (FTextureCooker::CookTexture(Name, Settings, CookedPath, Header))
+    {
+        std::shared_ptr<FTexture> Texture = std::make_shared<FTexture>(nullptr, nullptr, ESamplerType::Linear, Name, Header.Width, Header.Height);
+        if (FTextureStreamer::Get().RegisterTexture(Texture, CookedPath, Header))
+        {
+            TextureMap[Name] = Texture;
+            return S_OK;
+        }
+    }
+
+    UE_LOG(ELogLevel::Warning, "[Texture Cook] Failed to cook %s, loading the source without mips", *FString(Name));
+    return LoadUncookedTextureFromFile(Device, Filename, bIsSRGB);
+}
+
+HRESULT FResourceManager::LoadUncookedTextureFromFile(ID3D11Device* Device, const wchar_t* Filename, bool bIsSRGB)
 {
     IWICImagingFactory* WicFactory = nullptr;
     IWICBitmapDecoder* Decoder = nullptr;
@@ -12,7 +12,11 @@ public:
     void Initialize(FRenderer* Renderer, FGraphicsDevice* Device);
     void Release(FRenderer* Renderer);
     
+    /** 밉 체인과 BC 압축으로 쿡한 뒤(캐시가 있으면 재사용) 스트리밍으로 올림, 실패하면 원본을 그대로 올림 */
     HRESULT LoadTextureFromFile(ID3D11Device* Device, const wchar_t* Filename, bool bIsSRGB = true);
+
+    /** 원본 그대로 밉 없이 올림, 폰트나 아이콘처럼 압축이나 밉이 필요 없는 텍스처용 */
+    HRESULT LoadUncookedTextureFromFile(ID3D11Device* Device, const wchar_t* Filename, bool bIsSRGB = true);
     HRESULT LoadTextureFromDDS(ID3D11Device* Device, ID3D11DeviceContext* Context, const wchar_t* Filename);
 
     std::shared_ptr<FTexture> GetTexture(const FWString& Name) const;
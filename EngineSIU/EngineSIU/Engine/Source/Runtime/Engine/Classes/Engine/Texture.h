@@ -32,4 +32,7 @@ struct FTexture
     
     uint32 Width;
     uint32 Height;
+
+    /** 스트리밍 우선순위 계산용, FTextureStreamer::GetFrameNumber 기준 */
+    uint64 LastRenderedFrame = 0;
 };
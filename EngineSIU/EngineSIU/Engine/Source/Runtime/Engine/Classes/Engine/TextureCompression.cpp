@@ -0,0 +1,696 @@
+#include "TextureCompression.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    /**
+     * 점들의 평균과 주축(공분산 행렬의 최대 고유벡터)을 구함
+     * 모든 점이 같다면 OutAxis는 0
+     */
+    template <int32 N>
+    void ComputePrincipalAxis(const float (&Points)[16][N], float (&OutMean)[N], float (&OutAxis)[N])
+    {
+        for (int32 Channel = 0; Channel < N; ++Channel)
+        {
+            float Sum = 0.f;
+            for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+            {
+                Sum += Points[PixelIndex][Channel];
+            }
+            OutMean[Channel] = Sum / 16.f;
+        }
+
+        float Covariance[N][N] = {};
+        for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+        {
+            float Delta[N];
+            for (int32 Channel = 0; Channel < N; ++Channel)
+            {
+                Delta[Channel] = Points[PixelIndex][Channel] - OutMean[Channel];
+            }
+            for (int32 Row = 0; Row < N; ++Row)
+            {
+                for (int32 Column = 0; Column < N; ++Column)
+                {
+                    Covariance[Row][Column] += Delta[Row] * Delta[Column];
+                }
+            }
+        }
+
+        // 분산이 가장 큰 채널의 행에서 시작해 Power Iteration
+        int32 MaxChannel = 0;
+        for (int32 Channel = 1; Channel < N; ++Channel)
+        {
+            if (Covariance[Channel][Channel] > Covariance[MaxChannel][MaxChannel])
+            {
+                MaxChannel = Channel;
+            }
+        }
+
+        for (int32 Channel = 0; Channel < N; ++Channel)
+        {
+            OutAxis[Channel] = Covariance[MaxChannel][Channel];
+        }
+
+        for (int32 Iteration = 0; Iteration < 8; ++Iteration)
+        {
+            float LengthSquared = 0.f;
+            for (int32 Channel = 0; Channel < N; ++Channel)
+            {
+                LengthSquared += OutAxis[Channel] * OutAxis[Channel];
+            }
+            if (LengthSquared < 1e-8f)
+            {
+                for (int32 Channel = 0; Channel < N; ++Channel)
+                {
+                    OutAxis[Channel] = 0.f;
+                }
+                return;
+            }
+
+            const float InvLength = 1.f / std::sqrt(LengthSquared);
+            float Normalized[N];
+            for (int32 Channel = 0; Channel < N; ++Channel)
+            {
+                Normalized[Channel] = OutAxis[Channel] * InvLength;
+            }
+
+            for (int32 Row = 0; Row < N; ++Row)
+            {
+                float Sum = 0.f;
+                for (int32 Column = 0; Column < N; ++Column)
+                {
+                    Sum += Covariance[Row][Column] * Normalized[Column];
+                }
+                OutAxis[Row] = Sum;
+            }
+
+            if (Iteration == 7)
+            {
+                for (int32 Channel = 0; Channel < N; ++Channel)
+                {
+                    OutAxis[Channel] = Normalized[Channel];
+                }
+            }
+        }
+    }
+
+    /** 주축 위로 투영했을 때 양 끝점 */
+    template <int32 N>
+    void ComputeAxisEndpoints(const float (&Points)[16][N], float (&OutLow)[N], float (&OutHigh)[N], float InsetRatio)
+    {
+        float Mean[N];
+        float Axis[N];
+        ComputePrincipalAxis(Points, Mean, Axis);
+
+        float MinT = FLT_MAX;
+        float MaxT = -FLT_MAX;
+        for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+        {
+            float T = 0.f;
+            for (int32 Channel = 0; Channel < N; ++Channel)
+            {
+                T += (Points[PixelIndex][Channel] - Mean[Channel]) * Axis[Channel];
+            }
+            MinT = std::min(MinT, T);
+            MaxT = std::max(MaxT, T);
+        }
+
+        // 양 끝을 조금 안쪽으로 당기면 양자화 후 평균 오차가 줄어듦
+        const float Inset = (MaxT - MinT) * InsetRatio;
+        MinT += Inset;
+        MaxT -= Inset;
+
+        for (int32 Channel = 0; Channel < N; ++Channel)
+        {
+            OutLow[Channel] = std::clamp(Mean[Channel] + Axis[Channel] * MinT, 0.f, 255.f);
+            OutHigh[Channel] = std::clamp(Mean[Channel] + Axis[Channel] * MaxT, 0.f, 255.f);
+        }
+    }
+
+    /**
+     * 각 픽셀의 인덱스를 고정했을 때 오차를 최소화하는 두 끝점을 최소제곱으로 구함
+     * Weights[i]는 픽셀 i에서 끝점 0의 가중치, 모든 가중치가 같으면 false
+     */
+    template <int32 N>
+    bool SolveLeastSquaresEndpoints(const float (&Points)[16][N], const float Weights[16], float (&OutEndpoint0)[N], float (&OutEndpoint1)[N])
+    {
+        float AlphaAlpha = 0.f;
+        float AlphaBeta = 0.f;
+        float BetaBeta = 0.f;
+        float AlphaX[N] = {};
+        float BetaX[N] = {};
+
+        for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+        {
+            const float Alpha = Weights[PixelIndex];
+            const float Beta = 1.f - Alpha;
+            AlphaAlpha += Alpha * Alpha;
+            AlphaBeta += Alpha * Beta;
+            BetaBeta += Beta * Beta;
+            for (int32 Channel = 0; Channel < N; ++Channel)
+            {
+                AlphaX[Channel] += Alpha * Points[PixelIndex][Channel];
+                BetaX[Channel] += Beta * Points[PixelIndex][Channel];
+            }
+        }
+
+        const float Determinant = AlphaAlpha * BetaBeta - AlphaBeta * AlphaBeta;
+        if (std::abs(Determinant) < 1e-6f)
+        {
+            return false;
+        }
+
+        const float InvDeterminant = 1.f / Determinant;
+        for (int32 Channel = 0; Channel < N; ++Channel)
+        {
+            OutEndpoint0[Channel] = std::clamp((AlphaX[Channel] * BetaBeta - BetaX[Channel] * AlphaBeta) * InvDeterminant, 0.f, 255.f);
+            OutEndpoint1[Channel] = std::clamp((BetaX[Channel] * AlphaAlpha - AlphaX[Channel] * AlphaBeta) * InvDeterminant, 0.f, 255.f);
+        }
+        return true;
+    }
+
+    /** 128비트 블록에 하위 비트부터 채움 */
+    struct FBlockBitWriter
+    {
+        uint8* Block;
+        uint32 Position = 0;
+
+        void Write(uint32 Value, uint32 NumBits)
+        {
+            for (uint32 Bit = 0; Bit < NumBits; ++Bit, ++Position)
+            {
+                if ((Value >> Bit) & 1u)
+                {
+                    Block[Position >> 3] |= static_cast<uint8>(1u << (Position & 7));
+                }
+            }
+        }
+    };
+
+    struct FBlockBitReader
+    {
+        const uint8* Block;
+        uint32 Position = 0;
+
+        uint32 Read(uint32 NumBits)
+        {
+            uint32 Value = 0;
+            for (uint32 Bit = 0; Bit < NumBits; ++Bit, ++Position)
+            {
+                Value |= static_cast<uint32>((Block[Position >> 3] >> (Position & 7)) & 1u) << Bit;
+            }
+            return Value;
+        }
+    };
+
+    //~ BC1
+
+    uint16 PackRGB565(const float Color[3])
+    {
+        const uint32 R = static_cast<uint32>(std::clamp(static_cast<int32>(Color[0] * (31.f / 255.f) + 0.5f), 0, 31));
+        const uint32 G = static_cast<uint32>(std::clamp(static_cast<int32>(Color[1] * (63.f / 255.f) + 0.5f), 0, 63));
+        const uint32 B = static_cast<uint32>(std::clamp(static_cast<int32>(Color[2] * (31.f / 255.f) + 0.5f), 0, 31));
+        return static_cast<uint16>((R << 11) | (G << 5) | B);
+    }
+
+    void UnpackRGB565(uint16 Packed, int32 OutColor[3])
+    {
+        const int32 R = (Packed >> 11) & 31;
+        const int32 G = (Packed >> 5) & 63;
+        const int32 B = Packed & 31;
+        OutColor[0] = (R << 3) | (R >> 2);
+        OutColor[1] = (G << 2) | (G >> 4);
+        OutColor[2] = (B << 3) | (B >> 2);
+    }
+
+    /** Color0 > Color1이면 4색 모드, 아니면 3색 + 투명 모드 */
+    void BuildBC1Palette(uint16 Color0, uint16 Color1, int32 OutPalette[4][4])
+    {
+        UnpackRGB565(Color0, OutPalette[0]);
+        UnpackRGB565(Color1, OutPalette[1]);
+        OutPalette[0][3] = 255;
+        OutPalette[1][3] = 255;
+
+        for (int32 Channel = 0; Channel < 3; ++Channel)
+        {
+            const int32 C0 = OutPalette[0][Channel];
+            const int32 C1 = OutPalette[1][Channel];
+            if (Color0 > Color1)
+            {
+                OutPalette[2][Channel] = (2 * C0 + C1) / 3;
+                OutPalette[3][Channel] = (C0 + 2 * C1) / 3;
+            }
+            else
+            {
+                OutPalette[2][Channel] = (C0 + C1) / 2;
+                OutPalette[3][Channel] = 0;
+            }
+        }
+        OutPalette[2][3] = 255;
+        OutPalette[3][3] = Color0 > Color1 ? 255 : 0;
+    }
+
+    /** 4색 모드가 되도록 끝점 순서를 정하고 각 픽셀에 가장 가까운 색을 고름 */
+    float FitBC1(const float Colors[16][3], uint16& InOutColor0, uint16& InOutColor1, uint8 OutIndices[16])
+    {
+        if (InOutColor0 < InOutColor1)
+        {
+            std::swap(InOutColor0, InOutColor1);
+        }
+
+        int32 Palette[4][4];
+        BuildBC1Palette(InOutColor0, InOutColor1, Palette);
+
+        // 두 끝점이 같으면 3색 모드가 되므로 0번만 사용
+        const int32 NumColors = InOutColor0 == InOutColor1 ? 1 : 4;
+
+        float TotalError = 0.f;
+        for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+        {
+            float BestError = FLT_MAX;
+            for (int32 PaletteIndex = 0; PaletteIndex < NumColors; ++PaletteIndex)
+            {
+                float Error = 0.f;
+                for (int32 Channel = 0; Channel < 3; ++Channel)
+                {
+                    const float Delta = Colors[PixelIndex][Channel] - static_cast<float>(Palette[PaletteIndex][Channel]);
+                    Error += Delta * Delta;
+                }
+                if (Error < BestError)
+                {
+                    BestError = Error;
+                    OutIndices[PixelIndex] = static_cast<uint8>(PaletteIndex);
+                }
+            }
+            TotalError += BestError;
+        }
+        return TotalError;
+    }
+
+    void EncodeBC1Color(const uint8 Pixels[64], uint8 OutBlock[8])
+    {
+        float Colors[16][3];
+        for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+        {
+            for (int32 Channel = 0; Channel < 3; ++Channel)
+            {
+                Colors[PixelIndex][Channel] = static_cast<float>(Pixels[PixelIndex * 4 + Channel]);
+            }
+        }
+
+        float Low[3];
+        float High[3];
+        ComputeAxisEndpoints(Colors, Low, High, 1.f / 16.f);
+
+        uint16 Color0 = PackRGB565(High);
+        uint16 Color1 = PackRGB565(Low);
+        uint8 Indices[16];
+        float BestError = FitBC1(Colors, Color0, Color1, Indices);
+
+        // 정해진 인덱스로 끝점을 다시 맞춰 보고 더 나을 때만 사용
+        if (Color0 != Color1)
+        {
+            constexpr float Color0Weights[4] = { 1.f, 0.f, 2.f / 3.f, 1.f / 3.f };
+            float Weights[16];
+            for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+            {
+                Weights[PixelIndex] = Color0Weights[Indices[PixelIndex]];
+            }
+
+            float Endpoint0[3];
+            float Endpoint1[3];
+            if (SolveLeastSquaresEndpoints(Colors, Weights, Endpoint0, Endpoint1))
+            {
+                uint16 RefinedColor0 = PackRGB565(Endpoint0);
+                uint16 RefinedColor1 = PackRGB565(Endpoint1);
+                uint8 RefinedIndices[16];
+                const float RefinedError = FitBC1(Colors, RefinedColor0, RefinedColor1, RefinedIndices);
+                if (RefinedError < BestError)
+                {
+                    BestError = RefinedError;
+                    Color0 = RefinedColor0;
+                    Color1 = RefinedColor1;
+                    std::memcpy(Indices, RefinedIndices, sizeof(Indices));
+                }
+            }
+        }
+
+        uint32 PackedIndices = 0;
+        for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+        {
+            PackedIndices |= static_cast<uint32>(Indices[PixelIndex]) << (PixelIndex * 2);
+        }
+
+        OutBlock[0] = static_cast<uint8>(Color0 & 0xFF);
+        OutBlock[1] = static_cast<uint8>(Color0 >> 8);
+        OutBlock[2] = static_cast<uint8>(Color1 & 0xFF);
+        OutBlock[3] = static_cast<uint8>(Color1 >> 8);
+        std::memcpy(OutBlock + 4, &PackedIndices, sizeof(PackedIndices));
+    }
+
+    //~ BC4
+
+    void BuildBC4Palette(uint8 Value0, uint8 Value1, int32 OutPalette[8])
+    {
+        OutPalette[0] = Value0;
+        OutPalette[1] = Value1;
+        if (Value0 > Value1)
+        {
+            for (int32 Index = 2; Index < 8; ++Index)
+            {
+                OutPalette[Index] = ((8 - Index) * Value0 + (Index - 1) * Value1 + 3) / 7;
+            }
+        }
+        else
+        {
+            for (int32 Index = 2; Index < 6; ++Index)
+            {
+                OutPalette[Index] = ((6 - Index) * Value0 + (Index - 1) * Value1 + 2) / 5;
+            }
+            OutPalette[6] = 0;
+            OutPalette[7] = 255;
+        }
+    }
+
+    //~ BC7
+
+    constexpr int32 BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    int32 InterpolateBC7(int32 Endpoint0, int32 Endpoint1, int32 Weight)
+    {
+        return ((64 - Weight) * Endpoint0 + Weight * Endpoint1 + 32) >> 6;
+    }
+
+    /** 7비트 값과 P비트로 표현할 수 있는 가장 가까운 8비트 값 */
+    int32 QuantizeBC7Endpoint(float Value, int32 PBit)
+    {
+        const int32 Quantized = std::clamp(static_cast<int32>(std::floor((Value - static_cast<float>(PBit)) * 0.5f + 0.5f)), 0, 127);
+        return (Quantized << 1) | PBit;
+    }
+
+    float FitBC7Mode6(const float Pixels[16][4], const int32 Endpoint0[4], const int32 Endpoint1[4], uint8 OutIndices[16])
+    {
+        int32 Palette[16][4];
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            for (int32 Channel = 0; Channel < 4; ++Channel)
+            {
+                Palette[Index][Channel] = InterpolateBC7(Endpoint0[Channel], Endpoint1[Channel], BC7Weights4[Index]);
+            }
+        }
+
+        float TotalError = 0.f;
+        for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+        {
+            float BestError = FLT_MAX;
+            for (int32 Index = 0; Index < 16; ++Index)
+            {
+                float Error = 0.f;
+                for (int32 Channel = 0; Channel < 4; ++Channel)
+                {
+                    const float Delta = Pixels[PixelIndex][Channel] - static_cast<float>(Palette[Index][Channel]);
+                    Error += Delta * Delta;
+                }
+                if (Error < BestError)
+                {
+                    BestError = Error;
+                    OutIndices[PixelIndex] = static_cast<uint8>(Index);
+                }
+            }
+            TotalError += BestError;
+        }
+        return TotalError;
+    }
+
+    struct FBC7Mode6Candidate
+    {
+        int32 Endpoint0[4];
+        int32 Endpoint1[4];
+        uint8 Indices[16];
+        float Error = FLT_MAX;
+    };
+
+    /**
+     * P비트 조합을 시도해 Best보다 나으면 갱신
+     * 불투명한 블록은 알파가 정확히 255가 되도록 두 P비트를 모두 1로 고정
+     */
+    void TryBC7Mode6Endpoints(const float Pixels[16][4], const float Endpoint0[4], const float Endpoint1[4], bool bOpaque, FBC7Mode6Candidate& Best)
+    {
+        for (int32 PBits = bOpaque ? 3 : 0; PBits < 4; ++PBits)
+        {
+            FBC7Mode6Candidate Candidate;
+            for (int32 Channel = 0; Channel < 4; ++Channel)
+            {
+                Candidate.Endpoint0[Channel] = QuantizeBC7Endpoint(Endpoint0[Channel], PBits & 1);
+                Candidate.Endpoint1[Channel] = QuantizeBC7Endpoint(Endpoint1[Channel], PBits >> 1);
+            }
+
+            Candidate.Error = FitBC7Mode6(Pixels, Candidate.Endpoint0, Candidate.Endpoint1, Candidate.Indices);
+            if (Candidate.Error < Best.Error)
+            {
+                Best = Candidate;
+            }
+        }
+    }
+}
+
+void FTextureBlockCodec::EncodeBC1(const uint8 Pixels[64], uint8 OutBlock[8])
+{
+    EncodeBC1Color(Pixels, OutBlock);
+}
+
+void FTextureBlockCodec::DecodeBC1(const uint8 Block[8], uint8 OutPixels[64])
+{
+    const uint16 Color0 = static_cast<uint16>(Block[0] | (Block[1] << 8));
+    const uint16 Color1 = static_cast<uint16>(Block[2] | (Block[3] << 8));
+
+    int32 Palette[4][4];
+    BuildBC1Palette(Color0, Color1, Palette);
+
+    uint32 PackedIndices;
+    std::memcpy(&PackedIndices, Block + 4, sizeof(PackedIndices));
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        const uint32 Index = (PackedIndices >> (PixelIndex * 2)) & 3u;
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            OutPixels[PixelIndex * 4 + Channel] = static_cast<uint8>(Palette[Index][Channel]);
+        }
+    }
+}
+
+void FTextureBlockCodec::EncodeBC4(const uint8 Values[16], uint8 OutBlock[8])
+{
+    uint8 MinValue = 255;
+    uint8 MaxValue = 0;
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        MinValue = std::min(MinValue, Values[PixelIndex]);
+        MaxValue = std::max(MaxValue, Values[PixelIndex]);
+    }
+
+    // 최댓값을 앞에 두어 항상 8단계 모드 사용, 두 값이 같으면 모든 인덱스가 0
+    int32 Palette[8];
+    BuildBC4Palette(MaxValue, MinValue, Palette);
+    const int32 NumValues = MaxValue == MinValue ? 1 : 8;
+
+    uint64 PackedIndices = 0;
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        int32 BestIndex = 0;
+        int32 BestError = INT32_MAX;
+        for (int32 Index = 0; Index < NumValues; ++Index)
+        {
+            const int32 Error = std::abs(static_cast<int32>(Values[PixelIndex]) - Palette[Index]);
+            if (Error < BestError)
+            {
+                BestError = Error;
+                BestIndex = Index;
+            }
+        }
+        PackedIndices |= static_cast<uint64>(BestIndex) << (PixelIndex * 3);
+    }
+
+    OutBlock[0] = MaxValue;
+    OutBlock[1] = MinValue;
+    for (int32 ByteIndex = 0; ByteIndex < 6; ++ByteIndex)
+    {
+        OutBlock[2 + ByteIndex] = static_cast<uint8>((PackedIndices >> (ByteIndex * 8)) & 0xFF);
+    }
+}
+
+void FTextureBlockCodec::DecodeBC4(const uint8 Block[8], uint8 OutValues[16])
+{
+    int32 Palette[8];
+    BuildBC4Palette(Block[0], Block[1], Palette);
+
+    uint64 PackedIndices = 0;
+    for (int32 ByteIndex = 0; ByteIndex < 6; ++ByteIndex)
+    {
+        PackedIndices |= static_cast<uint64>(Block[2 + ByteIndex]) << (ByteIndex * 8);
+    }
+
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        OutValues[PixelIndex] = static_cast<uint8>(Palette[(PackedIndices >> (PixelIndex * 3)) & 7u]);
+    }
+}
+
+void FTextureBlockCodec::EncodeBC3(const uint8 Pixels[64], uint8 OutBlock[16])
+{
+    uint8 Alpha[16];
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        Alpha[PixelIndex] = Pixels[PixelIndex * 4 + 3];
+    }
+
+    EncodeBC4(Alpha, OutBlock);
+    EncodeBC1Color(Pixels, OutBlock + 8);
+}
+
+void FTextureBlockCodec::DecodeBC3(const uint8 Block[16], uint8 OutPixels[64])
+{
+    DecodeBC1(Block + 8, OutPixels);
+
+    uint8 Alpha[16];
+    DecodeBC4(Block, Alpha);
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        OutPixels[PixelIndex * 4 + 3] = Alpha[PixelIndex];
+    }
+}
+
+void FTextureBlockCodec::EncodeBC5(const uint8 Pixels[64], uint8 OutBlock[16])
+{
+    uint8 Red[16];
+    uint8 Green[16];
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        Red[PixelIndex] = Pixels[PixelIndex * 4 + 0];
+        Green[PixelIndex] = Pixels[PixelIndex * 4 + 1];
+    }
+
+    EncodeBC4(Red, OutBlock);
+    EncodeBC4(Green, OutBlock + 8);
+}
+
+void FTextureBlockCodec::DecodeBC5(const uint8 Block[16], uint8 OutPixels[64])
+{
+    uint8 Red[16];
+    uint8 Green[16];
+    DecodeBC4(Block, Red);
+    DecodeBC4(Block + 8, Green);
+
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        OutPixels[PixelIndex * 4 + 0] = Red[PixelIndex];
+        OutPixels[PixelIndex * 4 + 1] = Green[PixelIndex];
+        OutPixels[PixelIndex * 4 + 2] = 0;
+        OutPixels[PixelIndex * 4 + 3] = 255;
+    }
+}
+
+void FTextureBlockCodec::EncodeBC7(const uint8 Pixels[64], uint8 OutBlock[16])
+{
+    float Points[16][4];
+    bool bOpaque = true;
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            Points[PixelIndex][Channel] = static_cast<float>(Pixels[PixelIndex * 4 + Channel]);
+        }
+        bOpaque &= Pixels[PixelIndex * 4 + 3] == 255;
+    }
+
+    float Low[4];
+    float High[4];
+    ComputeAxisEndpoints(Points, Low, High, 0.f);
+
+    FBC7Mode6Candidate Best;
+    TryBC7Mode6Endpoints(Points, Low, High, bOpaque, Best);
+
+    float Weights[16];
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        Weights[PixelIndex] = static_cast<float>(64 - BC7Weights4[Best.Indices[PixelIndex]]) / 64.f;
+    }
+
+    float Endpoint0[4];
+    float Endpoint1[4];
+    if (SolveLeastSquaresEndpoints(Points, Weights, Endpoint0, Endpoint1))
+    {
+        TryBC7Mode6Endpoints(Points, Endpoint0, Endpoint1, bOpaque, Best);
+    }
+
+    // 0번 픽셀의 인덱스는 최상위 비트가 0이어야 하므로 필요하면 끝점을 뒤집음
+    if (Best.Indices[0] >= 8)
+    {
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            std::swap(Best.Endpoint0[Channel], Best.Endpoint1[Channel]);
+        }
+        for (uint8& Index : Best.Indices)
+        {
+            Index = static_cast<uint8>(15 - Index);
+        }
+    }
+
+    std::memset(OutBlock, 0, 16);
+    FBlockBitWriter Writer{ OutBlock };
+    Writer.Write(1u << 6, 7);
+    for (int32 Channel = 0; Channel < 4; ++Channel)
+    {
+        Writer.Write(static_cast<uint32>(Best.Endpoint0[Channel] >> 1), 7);
+        Writer.Write(static_cast<uint32>(Best.Endpoint1[Channel] >> 1), 7);
+    }
+    // 모든 채널이 같은 P비트를 공유함
+    Writer.Write(static_cast<uint32>(Best.Endpoint0[0] & 1), 1);
+    Writer.Write(static_cast<uint32>(Best.Endpoint1[0] & 1), 1);
+
+    Writer.Write(Best.Indices[0], 3);
+    for (int32 PixelIndex = 1; PixelIndex < 16; ++PixelIndex)
+    {
+        Writer.Write(Best.Indices[PixelIndex], 4);
+    }
+}
+
+void FTextureBlockCodec::DecodeBC7(const uint8 Block[16], uint8 OutPixels[64])
+{
+    if ((Block[0] & 0x7F) != 0x40)
+    {
+        std::memset(OutPixels, 0, 64);
+        return;
+    }
+
+    FBlockBitReader Reader{ Block, 7 };
+
+    int32 Endpoint0[4];
+    int32 Endpoint1[4];
+    for (int32 Channel = 0; Channel < 4; ++Channel)
+    {
+        Endpoint0[Channel] = static_cast<int32>(Reader.Read(7)) << 1;
+        Endpoint1[Channel] = static_cast<int32>(Reader.Read(7)) << 1;
+    }
+
+    const int32 PBit0 = static_cast<int32>(Reader.Read(1));
+    const int32 PBit1 = static_cast<int32>(Reader.Read(1));
+    for (int32 Channel = 0; Channel < 4; ++Channel)
+    {
+        Endpoint0[Channel] |= PBit0;
+        Endpoint1[Channel] |= PBit1;
+    }
+
+    for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+    {
+        const uint32 Index = Reader.Read(PixelIndex == 0 ? 3 : 4);
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            OutPixels[PixelIndex * 4 + Channel] = static_cast<uint8>(InterpolateBC7(Endpoint0[Channel], Endpoint1[Channel], BC7Weights4[Index]));
+        }
+    }
+}
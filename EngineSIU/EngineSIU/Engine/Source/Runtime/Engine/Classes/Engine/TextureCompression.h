@@ -0,0 +1,35 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+/**
+ * BC 블록 압축 CPU 인코더/디코더
+ *
+ * 모든 함수는 4x4 블록 하나를 처리합니다.
+ * 픽셀은 행 우선 RGBA8 16개(64바이트), 단일 채널 값은 16개(16바이트)입니다.
+ * 디코더는 쿡 결과의 품질 측정(PSNR)과 검증용입니다.
+ */
+struct FTextureBlockCodec
+{
+    /** 불투명 전용 4색 모드만 사용, 8바이트 */
+    static void EncodeBC1(const uint8 Pixels[64], uint8 OutBlock[8]);
+    static void DecodeBC1(const uint8 Block[8], uint8 OutPixels[64]);
+
+    /** 단일 채널 8단계 보간, 8바이트 */
+    static void EncodeBC4(const uint8 Values[16], uint8 OutBlock[8]);
+    static void DecodeBC4(const uint8 Block[8], uint8 OutValues[16]);
+
+    /** 알파는 BC4, 색상은 BC1, 16바이트 */
+    static void EncodeBC3(const uint8 Pixels[64], uint8 OutBlock[16]);
+    static void DecodeBC3(const uint8 Block[16], uint8 OutPixels[64]);
+
+    /** R, G를 각각 BC4로 저장, 16바이트. 디코딩 결과의 B는 0, A는 255 */
+    static void EncodeBC5(const uint8 Pixels[64], uint8 OutBlock[16]);
+    static void DecodeBC5(const uint8 Block[16], uint8 OutPixels[64]);
+
+    /**
+     * 모드 6(단일 서브셋, RGBA 7.7.7.7 + 끝점별 P비트, 4비트 인덱스)만 사용, 16바이트
+     * 디코더도 모드 6만 해석하며 다른 모드는 검은색으로 채움
+     */
+    static void EncodeBC7(const uint8 Pixels[64], uint8 OutBlock[16]);
+    static void DecodeBC7(const uint8 Block[16], uint8 OutPixels[64]);
+};
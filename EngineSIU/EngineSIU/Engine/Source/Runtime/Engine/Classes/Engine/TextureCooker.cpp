@@ -0,0 +1,935 @@
+#include "TextureCooker.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <wincodec.h>
+#include <wrl/client.h>
+
+#include "TextureCompression.h"
+#include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
+#include "Serialization/MemoryArchive.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /** 이 블록 수보다 작은 밉은 Job으로 나누지 않음 */
+    constexpr int32 MinBlocksForParallelCompress = 256;
+
+    const std::array<float, 256>& GetSRGBToLinearTable()
+    {
+        static const std::array<float, 256> Table = []
+        {
+            std::array<float, 256> Result;
+            for (int32 Value = 0; Value < 256; ++Value)
+            {
+                const float Normalized = static_cast<float>(Value) / 255.f;
+                Result[Value] = Normalized <= 0.04045f ? Normalized / 12.92f : std::pow((Normalized + 0.055f) / 1.055f, 2.4f);
+            }
+            return Result;
+        }();
+        return Table;
+    }
+
+    uint8 LinearToSRGB8(float Linear)
+    {
+        Linear = std::clamp(Linear, 0.f, 1.f);
+        const float Encoded = Linear <= 0.0031308f ? Linear * 12.92f : 1.055f * std::pow(Linear, 1.f / 2.4f) - 0.055f;
+        return static_cast<uint8>(Encoded * 255.f + 0.5f);
+    }
+
+    /** 가장자리 블록은 경계 픽셀을 반복해서 채움 */
+    void GatherBlock(const FTextureImage& Image, uint32 BlockX, uint32 BlockY, uint8 OutPixels[64])
+    {
+        for (uint32 Y = 0; Y < 4; ++Y)
+        {
+            const uint32 SourceY = std::min(BlockY * 4 + Y, Image.Height - 1);
+            for (uint32 X = 0; X < 4; ++X)
+            {
+                const uint32 SourceX = std::min(BlockX * 4 + X, Image.Width - 1);
+                const uint8* Source = Image.Pixels.GetData() + (static_cast<size_t>(SourceY) * Image.Width + SourceX) * 4;
+                std::memcpy(OutPixels + (Y * 4 + X) * 4, Source, 4);
+            }
+        }
+    }
+
+    void EncodeBlock(ETextureCompression Compression, const uint8 Pixels[64], uint8* OutBlock)
+    {
+        switch (Compression)
+        {
+        case ETextureCompression::BC1:
+            FTextureBlockCodec::EncodeBC1(Pixels, OutBlock);
+            break;
+        case ETextureCompression::BC3:
+            FTextureBlockCodec::EncodeBC3(Pixels, OutBlock);
+            break;
+        case ETextureCompression::BC4:
+        {
+            uint8 Red[16];
+            for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+            {
+                Red[PixelIndex] = Pixels[PixelIndex * 4];
+            }
+            FTextureBlockCodec::EncodeBC4(Red, OutBlock);
+            break;
+        }
+        case ETextureCompression::BC5:
+            FTextureBlockCodec::EncodeBC5(Pixels, OutBlock);
+            break;
+        case ETextureCompression::BC7:
+            FTextureBlockCodec::EncodeBC7(Pixels, OutBlock);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void DecodeBlock(ETextureCompression Compression, const uint8* Block, uint8 OutPixels[64])
+    {
+        switch (Compression)
+        {
+        case ETextureCompression::BC1:
+            FTextureBlockCodec::DecodeBC1(Block, OutPixels);
+            break;
+        case ETextureCompression::BC3:
+            FTextureBlockCodec::DecodeBC3(Block, OutPixels);
+            break;
+        case ETextureCompression::BC4:
+        {
+            uint8 Red[16];
+            FTextureBlockCodec::DecodeBC4(Block, Red);
+            for (int32 PixelIndex = 0; PixelIndex < 16; ++PixelIndex)
+            {
+                OutPixels[PixelIndex * 4 + 0] = Red[PixelIndex];
+                OutPixels[PixelIndex * 4 + 1] = 0;
+                OutPixels[PixelIndex * 4 + 2] = 0;
+                OutPixels[PixelIndex * 4 + 3] = 255;
+            }
+            break;
+        }
+        case ETextureCompression::BC5:
+            FTextureBlockCodec::DecodeBC5(Block, OutPixels);
+            break;
+        case ETextureCompression::BC7:
+            FTextureBlockCodec::DecodeBC7(Block, OutPixels);
+            break;
+        default:
+            break;
+        }
+    }
+
+    const char* GetCompressionName(ETextureCompression Compression)
+    {
+        switch (Compression)
+        {
+        case ETextureCompression::BC1: return "BC1";
+        case ETextureCompression::BC3: return "BC3";
+        case ETextureCompression::BC4: return "BC4";
+        case ETextureCompression::BC5: return "BC5";
+        case ETextureCompression::BC7: return "BC7";
+        default: return "RGBA8";
+        }
+    }
+
+    bool ReadFileBytes(const FWString& Path, TArray<uint8>& OutBytes)
+    {
+        std::ifstream File(std::filesystem::path(Path), std::ios::binary | std::ios::ate);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        const std::streamsize Size = File.tellg();
+        File.seekg(0, std::ios::beg);
+
+        OutBytes.SetNum(static_cast<int32>(Size));
+        return Size == 0 || File.read(reinterpret_cast<char*>(OutBytes.GetData()), Size).good();
+    }
+}
+
+uint64 FCookedTextureHeader::GetMipChainBytes(int32 FirstMip) const
+{
+    uint64 Bytes = 0;
+    for (int32 MipIndex = std::max(FirstMip, 0); MipIndex < Mips.Num(); ++MipIndex)
+    {
+        Bytes += Mips[MipIndex].Size;
+    }
+    return Bytes;
+}
+
+uint64 FTextureCooker::HashBytes(const void* Data, uint64 Size, uint64 Seed)
+{
+    const uint8* Bytes = static_cast<const uint8*>(Data);
+    uint64 Hash = Seed;
+    for (uint64 Index = 0; Index < Size; ++Index)
+    {
+        Hash ^= Bytes[Index];
+        Hash *= 0x100000001B3ull;
+    }
+    return Hash;
+}
+
+uint64 FTextureCooker::ComputeCookKey(const TArray<uint8>& SourceBytes, const FTextureCookSettings& Settings)
+{
+    uint64 Key = HashBytes(SourceBytes.GetData(), SourceBytes.Num());
+
+    const uint8 SettingsBytes[] = {
+        static_cast<uint8>(CookVersion),
+        static_cast<uint8>(Settings.bSRGB),
+        static_cast<uint8>(Settings.bAutoCompression),
+        static_cast<uint8>(Settings.Compression),
+        static_cast<uint8>(Settings.bGenerateMips),
+    };
+    return HashBytes(SettingsBytes, sizeof(SettingsBytes), Key);
+}
+
+FWString FTextureCooker::GetCookedPath(uint64 CookKey)
+{
+    wchar_t FileName[32];
+    swprintf_s(FileName, L"%016llX.ctex", CookKey);
+    return FWString(L"Saved/TextureCache/") + FileName;
+}
+
+void FTextureCooker::BuildMipChain(const FTextureImage& Source, bool bSRGB, bool bGenerateMips, TArray<FTextureImage>& OutMips)
+{
+    OutMips.Empty();
+    OutMips.Add(Source);
+    if (!bGenerateMips)
+    {
+        return;
+    }
+
+    const std::array<float, 256>& ToLinear = GetSRGBToLinearTable();
+
+    while (OutMips[OutMips.Num() - 1].Width > 1 || OutMips[OutMips.Num() - 1].Height > 1)
+    {
+        const FTextureImage& Previous = OutMips[OutMips.Num() - 1];
+
+        FTextureImage Next;
+        Next.Width = std::max(Previous.Width / 2, 1u);
+        Next.Height = std::max(Previous.Height / 2, 1u);
+        Next.Pixels.SetNum(static_cast<int32>(Next.Width * Next.Height * 4));
+
+        for (uint32 Y = 0; Y < Next.Height; ++Y)
+        {
+            const uint32 Y0 = std::min(Y * 2, Previous.Height - 1);
+            const uint32 Y1 = std::min(Y * 2 + 1, Previous.Height - 1);
+            for (uint32 X = 0; X < Next.Width; ++X)
+            {
+                const uint32 X0 = std::min(X * 2, Previous.Width - 1);
+                const uint32 X1 = std::min(X * 2 + 1, Previous.Width - 1);
+
+                const uint8* Samples[4] = {
+                    Previous.Pixels.GetData() + (static_cast<size_t>(Y0) * Previous.Width + X0) * 4,
+                    Previous.Pixels.GetData() + (static_cast<size_t>(Y0) * Previous.Width + X1) * 4,
+                    Previous.Pixels.GetData() + (static_cast<size_t>(Y1) * Previous.Width + X0) * 4,
+                    Previous.Pixels.GetData() + (static_cast<size_t>(Y1) * Previous.Width + X1) * 4,
+                };
+
+                uint8* Destination = Next.Pixels.GetData() + (static_cast<size_t>(Y) * Next.Width + X) * 4;
+                for (int32 Channel = 0; Channel < 4; ++Channel)
+                {
+                    // 알파는 항상 선형
+                    if (bSRGB && Channel < 3)
+                    {
+                        float Sum = 0.f;
+                        for (const uint8* Sample : Samples)
+                        {
+                            Sum += ToLinear[Sample[Channel]];
+                        }
+                        Destination[Channel] = LinearToSRGB8(Sum * 0.25f);
+                    }
+                    else
+                    {
+                        uint32 Sum = 0;
+                        for (const uint8* Sample : Samples)
+                        {
+                            Sum += Sample[Channel];
+                        }
+                        Destination[Channel] = static_cast<uint8>((Sum + 2) / 4);
+                    }
+                }
+            }
+        }
+
+        OutMips.Add(std::move(Next));
+    }
+}
+
+bool FTextureCooker::IsNormalMap(const FTextureImage& Image)
+{
+    const int32 NumPixels = static_cast<int32>(Image.Width * Image.Height);
+    if (NumPixels == 0)
+    {
+        return false;
+    }
+
+    int32 NumUnitVectors = 0;
+    for (int32 PixelIndex = 0; PixelIndex < NumPixels; ++PixelIndex)
+    {
+        const uint8* Pixel = Image.Pixels.GetData() + PixelIndex * 4;
+        if (Pixel[3] != 255)
+        {
+            return false;
+        }
+
+        const float X = static_cast<float>(Pixel[0]) / 127.5f - 1.f;
+        const float Y = static_cast<float>(Pixel[1]) / 127.5f - 1.f;
+        const float Z = static_cast<float>(Pixel[2]) / 127.5f - 1.f;
+        const float LengthSquared = X * X + Y * Y + Z * Z;
+        if (Z > 0.f && LengthSquared > 0.81f && LengthSquared < 1.21f)
+        {
+            ++NumUnitVectors;
+        }
+    }
+
+    return NumUnitVectors >= NumPixels - NumPixels / 20;
+}
+
+ETextureCompression FTextureCooker::ChooseCompression(const FTextureImage& Image, const FTextureCookSettings& Settings)
+{
+    // D3D11은 BC 텍스처의 최상위 밉 크기가 4의 배수여야 함
+    if (Image.Width % 4 != 0 || Image.Height % 4 != 0)
+    {
+        return ETextureCompression::Uncompressed;
+    }
+
+    if (!Settings.bAutoCompression)
+    {
+        return Settings.Compression;
+    }
+
+    if (Settings.bSRGB)
+    {
+        for (int32 Index = 3; Index < Image.Pixels.Num(); Index += 4)
+        {
+            if (Image.Pixels[Index] != 255)
+            {
+                return ETextureCompression::BC3;
+            }
+        }
+        return ETextureCompression::BC1;
+    }
+
+    return IsNormalMap(Image) ? ETextureCompression::BC5 : ETextureCompression::BC7;
+}
+
+uint32 FTextureCooker::GetBlockBytes(ETextureCompression Compression)
+{
+    switch (Compression)
+    {
+    case ETextureCompression::BC1:
+    case ETextureCompression::BC4:
+        return 8;
+    case ETextureCompression::BC3:
+    case ETextureCompression::BC5:
+    case ETextureCompression::BC7:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+void FTextureCooker::CompressImage(const FTextureImage& Image, ETextureCompression Compression, TArray<uint8>& OutData, uint32& OutRowPitch)
+{
+    const uint32 BlockBytes = GetBlockBytes(Compression);
+    if (BlockBytes == 0)
+    {
+        OutData = Image.Pixels;
+        OutRowPitch = Image.Width * 4;
+        return;
+    }
+
+    const uint32 BlocksX = (Image.Width + 3) / 4;
+    const uint32 BlocksY = (Image.Height + 3) / 4;
+    OutRowPitch = BlocksX * BlockBytes;
+    OutData.SetNum(static_cast<int32>(OutRowPitch * BlocksY));
+
+    auto CompressRows = [&](int32 BeginRow, int32 EndRow)
+    {
+        uint8 Pixels[64];
+        for (int32 BlockY = BeginRow; BlockY < EndRow; ++BlockY)
+        {
+            uint8* RowData = OutData.GetData() + static_cast<size_t>(BlockY) * OutRowPitch;
+            for (uint32 BlockX = 0; BlockX < BlocksX; ++BlockX)
+            {
+                GatherBlock(Image, BlockX, static_cast<uint32>(BlockY), Pixels);
+                EncodeBlock(Compression, Pixels, RowData + BlockX * BlockBytes);
+            }
+        }
+    };
+
+    if (BlocksX * BlocksY >= MinBlocksForParallelCompress)
+    {
+        FJobSystem::Get().ParallelForRange(static_cast<int32>(BlocksY), CompressRows);
+    }
+    else
+    {
+        CompressRows(0, static_cast<int32>(BlocksY));
+    }
+}
+
+void FTextureCooker::DecompressImage(const TArray<uint8>& Data, uint32 Width, uint32 Height, ETextureCompression Compression, FTextureImage& OutImage)
+{
+    OutImage.Width = Width;
+    OutImage.Height = Height;
+
+    const uint32 BlockBytes = GetBlockBytes(Compression);
+    if (BlockBytes == 0)
+    {
+        OutImage.Pixels = Data;
+        return;
+    }
+
+    OutImage.Pixels.SetNum(static_cast<int32>(Width * Height * 4));
+
+    const uint32 BlocksX = (Width + 3) / 4;
+    const uint32 BlocksY = (Height + 3) / 4;
+    uint8 Pixels[64];
+    for (uint32 BlockY = 0; BlockY < BlocksY; ++BlockY)
+    {
+        for (uint32 BlockX = 0; BlockX < BlocksX; ++BlockX)
+        {
+            DecodeBlock(Compression, Data.GetData() + (static_cast<size_t>(BlockY) * BlocksX + BlockX) * BlockBytes, Pixels);
+
+            for (uint32 Y = 0; Y < 4 && BlockY * 4 + Y < Height; ++Y)
+            {
+                for (uint32 X = 0; X < 4 && BlockX * 4 + X < Width; ++X)
+                {
+                    uint8* Destination = OutImage.Pixels.GetData() + (static_cast<size_t>(BlockY * 4 + Y) * Width + BlockX * 4 + X) * 4;
+                    std::memcpy(Destination, Pixels + (Y * 4 + X) * 4, 4);
+                }
+            }
+        }
+    }
+}
+
+double FTextureCooker::ComputePSNR(const FTextureImage& Reference, const FTextureImage& Image, ETextureCompression Compression)
+{
+    int32 NumChannels = 4;
+    if (Compression == ETextureCompression::BC4)
+    {
+        NumChannels = 1;
+    }
+    else if (Compression == ETextureCompression::BC5)
+    {
+        NumChannels = 2;
+    }
+
+    const int32 NumPixels = std::min(Reference.Pixels.Num(), Image.Pixels.Num()) / 4;
+    if (NumPixels == 0)
+    {
+        return 0.0;
+    }
+
+    double SquaredError = 0.0;
+    for (int32 PixelIndex = 0; PixelIndex < NumPixels; ++PixelIndex)
+    {
+        for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+        {
+            const double Delta = static_cast<double>(Reference.Pixels[PixelIndex * 4 + Channel]) - static_cast<double>(Image.Pixels[PixelIndex * 4 + Channel]);
+            SquaredError += Delta * Delta;
+        }
+    }
+
+    const double MeanSquaredError = SquaredError / (static_cast<double>(NumPixels) * NumChannels);
+    if (MeanSquaredError <= 0.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    return 10.0 * std::log10(255.0 * 255.0 / MeanSquaredError);
+}
+
+void FTextureCooker::CookImage(const FTextureImage& Source, const FTextureCookSettings& Settings, uint64 CookKey, FCookedTexture& OutCooked)
+{
+    TArray<FTextureImage> Mips;
+    BuildMipChain(Source, Settings.bSRGB, Settings.bGenerateMips, Mips);
+
+    FCookedTextureHeader& Header = OutCooked.Header;
+    Header.CookKey = CookKey;
+    Header.Compression = ChooseCompression(Source, Settings);
+    Header.bSRGB = Settings.bSRGB;
+    Header.Width = Source.Width;
+    Header.Height = Source.Height;
+    Header.Mips.SetNum(Mips.Num());
+
+    OutCooked.MipData.SetNum(Mips.Num());
+    for (int32 MipIndex = 0; MipIndex < Mips.Num(); ++MipIndex)
+    {
+        FCookedTextureMip& Mip = Header.Mips[MipIndex];
+        Mip.Width = Mips[MipIndex].Width;
+        Mip.Height = Mips[MipIndex].Height;
+
+        CompressImage(Mips[MipIndex], Header.Compression, OutCooked.MipData[MipIndex], Mip.RowPitch);
+        Mip.Size = static_cast<uint32>(OutCooked.MipData[MipIndex].Num());
+    }
+}
+
+bool FTextureCooker::SaveCookedTexture(const FWString& Path, FCookedTexture& Cooked)
+{
+    // 헤더 크기는 밉 수로만 정해지므로 한 번 직렬화해서 크기를 구한 뒤 오프셋을 채움
+    TArray<uint8> HeaderData;
+    {
+        FMemoryWriter Writer(HeaderData);
+        Writer << Cooked.Header;
+    }
+
+    uint64 Offset = sizeof(uint32) * 3 + HeaderData.Num();
+    for (FCookedTextureMip& Mip : Cooked.Header.Mips)
+    {
+        Mip.Offset = Offset;
+        Offset += Mip.Size;
+    }
+
+    HeaderData.Empty();
+    {
+        FMemoryWriter Writer(HeaderData);
+        Writer << Cooked.Header;
+    }
+
+    const std::filesystem::path FilePath(Path);
+    std::error_code ErrorCode;
+    std::filesystem::create_directories(FilePath.parent_path(), ErrorCode);
+
+    // 쓰는 도중에 종료되어도 깨진 캐시가 남지 않도록 임시 파일에 쓴 뒤 이름을 바꿈
+    std::filesystem::path TempPath = FilePath;
+    TempPath += L".tmp";
+    {
+        std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        const uint32 Preamble[3] = { FileMagic, CookVersion, static_cast<uint32>(HeaderData.Num()) };
+        File.write(reinterpret_cast<const char*>(Preamble), sizeof(Preamble));
+        File.write(reinterpret_cast<const char*>(HeaderData.GetData()), HeaderData.Num());
+        for (const TArray<uint8>& MipData : Cooked.MipData)
+        {
+            File.write(reinterpret_cast<const char*>(MipData.GetData()), MipData.Num());
+        }
+
+        if (File.fail())
+        {
+            return false;
+        }
+    }
+
+    std::filesystem::rename(TempPath, FilePath, ErrorCode);
+    return !ErrorCode;
+}
+
+bool FTextureCooker::LoadCookedHeader(const FWString& Path, FCookedTextureHeader& OutHeader)
+{
+    std::ifstream File(std::filesystem::path(Path), std::ios::binary);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    uint32 Preamble[3] = {};
+    if (!File.read(reinterpret_cast<char*>(Preamble), sizeof(Preamble)) || Preamble[0] != FileMagic || Preamble[1] != CookVersion)
+    {
+        return false;
+    }
+
+    TArray<uint8> HeaderData;
+    HeaderData.SetNum(static_cast<int32>(Preamble[2]));
+    if (!File.read(reinterpret_cast<char*>(HeaderData.GetData()), HeaderData.Num()))
+    {
+        return false;
+    }
+
+    try
+    {
+        FMemoryReader Reader(HeaderData);
+        Reader << OutHeader;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return !OutHeader.Mips.IsEmpty() && OutHeader.Width > 0 && OutHeader.Height > 0;
+}
+
+bool FTextureCooker::LoadCookedMip(const FWString& Path, const FCookedTextureMip& Mip, TArray<uint8>& OutData)
+{
+    std::ifstream File(std::filesystem::path(Path), std::ios::binary);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    OutData.SetNum(static_cast<int32>(Mip.Size));
+    File.seekg(static_cast<std::streamoff>(Mip.Offset), std::ios::beg);
+    return File.read(reinterpret_cast<char*>(OutData.GetData()), Mip.Size).good();
+}
+
+bool FTextureCooker::DecodeSourceImage(const TArray<uint8>& SourceBytes, FTextureImage& OutImage)
+{
+    using Microsoft::WRL::ComPtr;
+
+    // 이미 다른 모드로 초기화된 스레드라도 WIC는 사용할 수 있음
+    const HRESULT InitResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+    if (FAILED(InitResult) && InitResult != RPC_E_CHANGED_MODE)
+    {
+        return false;
+    }
+
+    ComPtr<IWICImagingFactory> WicFactory;
+    ComPtr<IWICStream> Stream;
+    ComPtr<IWICBitmapDecoder> Decoder;
+    ComPtr<IWICBitmapFrameDecode> Frame;
+    ComPtr<IWICFormatConverter> Converter;
+
+    HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&WicFactory));
+    if (SUCCEEDED(hr))
+    {
+        hr = WicFactory->CreateStream(&Stream);
+    }
+    if (SUCCEEDED(hr))
+    {
+        hr = Stream->InitializeFromMemory(const_cast<BYTE*>(SourceBytes.GetData()), static_cast<DWORD>(SourceBytes.Num()));
+    }
+    if (SUCCEEDED(hr))
+    {
+        hr = WicFactory->CreateDecoderFromStream(Stream.Get(), nullptr, WICDecodeMetadataCacheOnLoad, &Decoder);
+    }
+    if (SUCCEEDED(hr))
+    {
+        hr = Decoder->GetFrame(0, &Frame);
+    }
+    if (SUCCEEDED(hr))
+    {
+        hr = WicFactory->CreateFormatConverter(&Converter);
+    }
+    if (SUCCEEDED(hr))
+    {
+        hr = Converter->Initialize(Frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
+    }
+
+    UINT Width = 0;
+    UINT Height = 0;
+    if (SUCCEEDED(hr))
+    {
+        hr = Frame->GetSize(&Width, &Height);
+    }
+    if (FAILED(hr) || Width == 0 || Height == 0)
+    {
+        return false;
+    }
+
+    OutImage.Width = Width;
+    OutImage.Height = Height;
+    OutImage.Pixels.SetNum(static_cast<int32>(Width * Height * 4));
+    hr = Converter->CopyPixels(nullptr, Width * 4, Width * Height * 4, OutImage.Pixels.GetData());
+    return SUCCEEDED(hr);
+}
+
+bool FTextureCooker::CookTexture(const FWString& SourcePath, const FTextureCookSettings& Settings, FWString& OutCookedPath, FCookedTextureHeader& OutHeader)
+{
+    TArray<uint8> SourceBytes;
+    if (!ReadFileBytes(SourcePath, SourceBytes) || SourceBytes.IsEmpty())
+    {
+        return false;
+    }
+
+    const uint64 CookKey = ComputeCookKey(SourceBytes, Settings);
+    OutCookedPath = GetCookedPath(CookKey);
+    if (LoadCookedHeader(OutCookedPath, OutHeader) && OutHeader.CookKey == CookKey)
+    {
+        return true;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    FTextureImage Source;
+    if (!DecodeSourceImage(SourceBytes, Source))
+    {
+        return false;
+    }
+
+    FCookedTexture Cooked;
+    CookImage(Source, Settings, CookKey, Cooked);
+
+    const double CookMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    FTextureImage Decoded;
+    DecompressImage(Cooked.MipData[0], Source.Width, Source.Height, Cooked.Header.Compression, Decoded);
+    const double PSNR = ComputePSNR(Source, Decoded, Cooked.Header.Compression);
+
+    if (!SaveCookedTexture(OutCookedPath, Cooked))
+    {
+        UE_LOG(ELogLevel::Error, "[Texture Cook] Failed to write %s", *FString(OutCookedPath));
+        return false;
+    }
+
+    UE_LOG(ELogLevel::Display, "[Texture Cook] %s: %ux%u %s, %d mips, %.2f MB -> %.2f MB, PSNR %.1f dB, %.2f ms",
+        *FString(SourcePath), Source.Width, Source.Height, GetCompressionName(Cooked.Header.Compression),
+        Cooked.Header.Mips.Num(), static_cast<double>(Source.Pixels.Num()) / (1024.0 * 1024.0),
+        static_cast<double>(Cooked.Header.GetMipChainBytes(0)) / (1024.0 * 1024.0), PSNR, CookMs
+    );
+
+    OutHeader = Cooked.Header;
+    return true;
+}
+
+namespace
+{
+    /** 부드러운 그라디언트에 노이즈를 더한 사진 같은 이미지, bAlpha면 알파가 가로로 변함 */
+    FTextureImage MakeTestPhoto(uint32 Width, uint32 Height, bool bAlpha, uint32 Seed)
+    {
+        std::mt19937 Random(Seed);
+        std::normal_distribution<float> Noise(0.f, 6.f);
+
+        FTextureImage Image;
+        Image.Width = Width;
+        Image.Height = Height;
+        Image.Pixels.SetNum(static_cast<int32>(Width * Height * 4));
+        for (uint32 Y = 0; Y < Height; ++Y)
+        {
+            for (uint32 X = 0; X < Width; ++X)
+            {
+                const float U = static_cast<float>(X) / static_cast<float>(Width);
+                const float V = static_cast<float>(Y) / static_cast<float>(Height);
+                uint8* Pixel = &Image.Pixels[static_cast<int32>((Y * Width + X) * 4)];
+                Pixel[0] = static_cast<uint8>(std::clamp(128.f + 100.f * std::sin(U * 9.f + V * 3.f) + Noise(Random), 0.f, 255.f));
+                Pixel[1] = static_cast<uint8>(std::clamp(128.f + 90.f * std::cos(V * 7.f - U * 2.f) + Noise(Random), 0.f, 255.f));
+                Pixel[2] = static_cast<uint8>(std::clamp(128.f + 80.f * std::sin((U + V) * 5.f) + Noise(Random), 0.f, 255.f));
+                Pixel[3] = bAlpha ? static_cast<uint8>(std::clamp(255.f * U + Noise(Random), 0.f, 255.f)) : 255;
+            }
+        }
+        return Image;
+    }
+
+    /** 물결 모양 높이 필드의 탄젠트 공간 노멀 맵 */
+    FTextureImage MakeTestNormalMap(uint32 Width, uint32 Height)
+    {
+        FTextureImage Image;
+        Image.Width = Width;
+        Image.Height = Height;
+        Image.Pixels.SetNum(static_cast<int32>(Width * Height * 4));
+        for (uint32 Y = 0; Y < Height; ++Y)
+        {
+            for (uint32 X = 0; X < Width; ++X)
+            {
+                const float DX = 0.5f * std::cos(static_cast<float>(X) * 0.2f);
+                const float DY = 0.5f * std::sin(static_cast<float>(Y) * 0.15f);
+                const float InvLength = 1.f / std::sqrt(DX * DX + DY * DY + 1.f);
+                uint8* Pixel = &Image.Pixels[static_cast<int32>((Y * Width + X) * 4)];
+                Pixel[0] = static_cast<uint8>((DX * InvLength * 0.5f + 0.5f) * 255.f + 0.5f);
+                Pixel[1] = static_cast<uint8>((DY * InvLength * 0.5f + 0.5f) * 255.f + 0.5f);
+                Pixel[2] = static_cast<uint8>((InvLength * 0.5f + 0.5f) * 255.f + 0.5f);
+                Pixel[3] = 255;
+            }
+        }
+        return Image;
+    }
+
+    /** 압축 크기와 디코딩 결과의 PSNR 확인 */
+    bool CheckCodec(const char* Label, const FTextureImage& Image, ETextureCompression Compression, double MinPSNR)
+    {
+        TArray<uint8> Data;
+        uint32 RowPitch = 0;
+        FTextureCooker::CompressImage(Image, Compression, Data, RowPitch);
+
+        FTextureImage Decoded;
+        FTextureCooker::DecompressImage(Data, Image.Width, Image.Height, Compression, Decoded);
+        const double PSNR = FTextureCooker::ComputePSNR(Image, Decoded, Compression);
+
+        const uint32 BlockBytes = FTextureCooker::GetBlockBytes(Compression);
+        const uint32 ExpectedPitch = (Image.Width + 3) / 4 * BlockBytes;
+        const bool bSizeMatches = RowPitch == ExpectedPitch && static_cast<uint32>(Data.Num()) == ExpectedPitch * ((Image.Height + 3) / 4);
+        const bool bPassed = bSizeMatches && PSNR >= MinPSNR;
+
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error, "[Texture Test] %s %s %ux%u: %d bytes, PSNR %.2f dB (min %.1f)%s",
+            Label, GetCompressionName(Compression), Image.Width, Image.Height, Data.Num(), PSNR, MinPSNR, bSizeMatches ? "" : ", wrong size");
+        return bPassed;
+    }
+}
+
+bool FTextureCooker::RunSelfTest(const FWString& SourcePath)
+{
+    int32 NumFailures = 0;
+
+    // 단색 블록은 끝점 양자화 오차 안에서 그대로 나와야 함
+    {
+        uint8 Pixels[64];
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            Pixels[Index * 4 + 0] = 200;
+            Pixels[Index * 4 + 1] = 10;
+            Pixels[Index * 4 + 2] = 50;
+            Pixels[Index * 4 + 3] = 255;
+        }
+
+        uint8 Block[16];
+        uint8 Decoded[64];
+        int32 MaxError = 0;
+        FTextureBlockCodec::EncodeBC1(Pixels, Block);
+        FTextureBlockCodec::DecodeBC1(Block, Decoded);
+        for (int32 Channel = 0; Channel < 3; ++Channel)
+        {
+            MaxError = std::max(MaxError, std::abs(Pixels[Channel] - Decoded[Channel]));
+        }
+        FTextureBlockCodec::EncodeBC7(Pixels, Block);
+        FTextureBlockCodec::DecodeBC7(Block, Decoded);
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            MaxError = std::max(MaxError, std::abs(Pixels[Channel] - Decoded[Channel]));
+        }
+
+        // 0~255 램프는 8단계 보간으로 표현하므로 단계 간격의 절반 정도 오차
+        uint8 Values[16];
+        uint8 DecodedValues[16];
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            Values[Index] = static_cast<uint8>(Index * 17);
+        }
+        FTextureBlockCodec::EncodeBC4(Values, Block);
+        FTextureBlockCodec::DecodeBC4(Block, DecodedValues);
+        int32 RampError = 0;
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            RampError = std::max(RampError, std::abs(Values[Index] - DecodedValues[Index]));
+        }
+
+        // 무작위 블록에서도 BC7 모드 6 비트가 맞고 앵커 인덱스의 최상위 비트가 0이어야 함
+        std::mt19937 Random(3);
+        int32 NumBadBC7Blocks = 0;
+        for (int32 Trial = 0; Trial < 10000; ++Trial)
+        {
+            for (uint8& Value : Pixels)
+            {
+                Value = static_cast<uint8>(Random() & 0xFF);
+            }
+            FTextureBlockCodec::EncodeBC7(Pixels, Block);
+            NumBadBC7Blocks += (Block[0] & 0x7F) == 0x40 ? 0 : 1;
+        }
+
+        const bool bPassed = MaxError <= 4 && RampError <= 20 && NumBadBC7Blocks == 0;
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error, "[Texture Test] Fixed blocks: solid error %d, BC4 ramp error %d, bad BC7 blocks %d",
+            MaxError, RampError, NumBadBC7Blocks);
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    const FTextureImage Photo = MakeTestPhoto(256, 256, false, 1);
+    const FTextureImage AlphaPhoto = MakeTestPhoto(256, 128, true, 2);
+    const FTextureImage NormalMap = MakeTestNormalMap(128, 128);
+    const FTextureImage OddPhoto = MakeTestPhoto(100, 75, false, 4);
+
+    NumFailures += CheckCodec("photo", Photo, ETextureCompression::BC1, 33.0) ? 0 : 1;
+    NumFailures += CheckCodec("photo", Photo, ETextureCompression::BC3, 33.0) ? 0 : 1;
+    NumFailures += CheckCodec("photo", Photo, ETextureCompression::BC7, 34.0) ? 0 : 1;
+    NumFailures += CheckCodec("alpha", AlphaPhoto, ETextureCompression::BC3, 32.0) ? 0 : 1;
+    NumFailures += CheckCodec("alpha", AlphaPhoto, ETextureCompression::BC7, 32.0) ? 0 : 1;
+    NumFailures += CheckCodec("normal", NormalMap, ETextureCompression::BC5, 45.0) ? 0 : 1;
+    NumFailures += CheckCodec("normal", NormalMap, ETextureCompression::BC7, 36.0) ? 0 : 1;
+    NumFailures += CheckCodec("photo", Photo, ETextureCompression::BC4, 45.0) ? 0 : 1;
+
+    // 형식 자동 선택
+    {
+        FTextureCookSettings SRGBSettings;
+        FTextureCookSettings LinearSettings;
+        LinearSettings.bSRGB = false;
+
+        const bool bPassed = ChooseCompression(Photo, SRGBSettings) == ETextureCompression::BC1
+            && ChooseCompression(AlphaPhoto, SRGBSettings) == ETextureCompression::BC3
+            && ChooseCompression(NormalMap, LinearSettings) == ETextureCompression::BC5
+            && ChooseCompression(Photo, LinearSettings) == ETextureCompression::BC7
+            && ChooseCompression(OddPhoto, SRGBSettings) == ETextureCompression::Uncompressed;
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error, "[Texture Test] Compression choice: photo %s, alpha %s, normal %s, linear photo %s, 100x75 %s",
+            GetCompressionName(ChooseCompression(Photo, SRGBSettings)), GetCompressionName(ChooseCompression(AlphaPhoto, SRGBSettings)),
+            GetCompressionName(ChooseCompression(NormalMap, LinearSettings)), GetCompressionName(ChooseCompression(Photo, LinearSettings)),
+            GetCompressionName(ChooseCompression(OddPhoto, SRGBSettings)));
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    // 밉 체인은 한 변이 1이 될 때까지 절반씩 줄어야 함
+    {
+        TArray<FTextureImage> Mips;
+        BuildMipChain(AlphaPhoto, true, true, Mips);
+
+        bool bPassed = !Mips.IsEmpty() && Mips[0].Width == AlphaPhoto.Width && Mips[0].Height == AlphaPhoto.Height;
+        for (int32 MipIndex = 1; MipIndex < Mips.Num(); ++MipIndex)
+        {
+            bPassed &= Mips[MipIndex].Width == std::max(1u, Mips[MipIndex - 1].Width / 2);
+            bPassed &= Mips[MipIndex].Height == std::max(1u, Mips[MipIndex - 1].Height / 2);
+            bPassed &= static_cast<uint32>(Mips[MipIndex].Pixels.Num()) == Mips[MipIndex].Width * Mips[MipIndex].Height * 4;
+        }
+        bPassed &= !Mips.IsEmpty() && Mips[Mips.Num() - 1].Width == 1 && Mips[Mips.Num() - 1].Height == 1;
+
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error, "[Texture Test] Mip chain of %ux%u: %d mips",
+            AlphaPhoto.Width, AlphaPhoto.Height, Mips.Num());
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    // 쿡 파일 왕복: 헤더와 모든 밉이 쓴 그대로 읽혀야 함
+    {
+        FTextureCookSettings Settings;
+        TArray<uint8> KeyBytes;
+        KeyBytes.SetNum(8);
+        std::memcpy(KeyBytes.GetData(), "SELFTEST", 8);
+        const uint64 CookKey = ComputeCookKey(KeyBytes, Settings);
+        FTextureCookSettings LinearSettings;
+        LinearSettings.bSRGB = false;
+        const bool bKeyDependsOnSettings = CookKey != ComputeCookKey(KeyBytes, LinearSettings);
+
+        FCookedTexture Cooked;
+        CookImage(Photo, Settings, CookKey, Cooked);
+        const FWString CookedPath = GetCookedPath(CookKey);
+        bool bPassed = bKeyDependsOnSettings && SaveCookedTexture(CookedPath, Cooked);
+
+        FCookedTextureHeader Header;
+        bPassed = bPassed && LoadCookedHeader(CookedPath, Header);
+        bPassed = bPassed && Header.CookKey == CookKey && Header.Compression == Cooked.Header.Compression
+            && Header.Width == Photo.Width && Header.Height == Photo.Height && Header.Mips.Num() == Cooked.Header.Mips.Num();
+        for (int32 MipIndex = 0; bPassed && MipIndex < Header.Mips.Num(); ++MipIndex)
+        {
+            TArray<uint8> MipData;
+            bPassed = LoadCookedMip(CookedPath, Header.Mips[MipIndex], MipData)
+                && MipData.Num() == Cooked.MipData[MipIndex].Num()
+                && std::memcmp(MipData.GetData(), Cooked.MipData[MipIndex].GetData(), MipData.Num()) == 0;
+        }
+
+        std::error_code ErrorCode;
+        const uint64 FileSize = std::filesystem::file_size(CookedPath, ErrorCode);
+        const FCookedTextureMip& LastMip = Cooked.Header.Mips[Cooked.Header.Mips.Num() - 1];
+        bPassed = bPassed && !ErrorCode && FileSize == LastMip.Offset + LastMip.Size;
+        std::filesystem::remove(CookedPath, ErrorCode);
+
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error, "[Texture Test] Cooked file round trip: %d mips, %llu bytes",
+            Header.Mips.Num(), static_cast<unsigned long long>(FileSize));
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    // 실제 원본은 두 번째 쿡부터 캐시에서 같은 파일을 읽어야 함
+    if (!SourcePath.empty())
+    {
+        FTextureCookSettings Settings;
+        FWString FirstPath;
+        FWString SecondPath;
+        FCookedTextureHeader FirstHeader;
+        FCookedTextureHeader SecondHeader;
+        const bool bFirst = CookTexture(SourcePath, Settings, FirstPath, FirstHeader);
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const bool bSecond = CookTexture(SourcePath, Settings, SecondPath, SecondHeader);
+        const double CachedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        const bool bPassed = bFirst && bSecond && FirstPath == SecondPath && FirstHeader.CookKey == SecondHeader.CookKey
+            && FirstHeader.Mips.Num() == SecondHeader.Mips.Num();
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error, "[Texture Test] %s: cache hit %s, %d mips, %.2f ms",
+            *FString(SourcePath), bPassed ? "yes" : "no", SecondHeader.Mips.Num(), CachedMs);
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    return NumFailures == 0;
+}
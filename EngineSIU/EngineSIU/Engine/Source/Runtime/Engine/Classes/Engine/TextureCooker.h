@@ -0,0 +1,141 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Serialization/Archive.h"
+
+enum class ETextureCompression : uint8
+{
+    Uncompressed,   // R8G8B8A8
+    BC1,
+    BC3,
+    BC4,
+    BC5,
+    BC7,
+};
+
+struct FTextureCookSettings
+{
+    bool bSRGB = true;
+
+    /** 원본을 보고 형식을 고름, false면 Compression을 그대로 사용 */
+    bool bAutoCompression = true;
+    ETextureCompression Compression = ETextureCompression::BC7;
+
+    bool bGenerateMips = true;
+};
+
+/** RGBA8 이미지 */
+struct FTextureImage
+{
+    uint32 Width = 0;
+    uint32 Height = 0;
+    TArray<uint8> Pixels;
+};
+
+struct FCookedTextureMip
+{
+    uint32 Width = 0;
+    uint32 Height = 0;
+    uint32 RowPitch = 0;
+
+    /** 쿡 파일 안에서의 위치 */
+    uint64 Offset = 0;
+    uint32 Size = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FCookedTextureMip& Mip)
+    {
+        return Ar << Mip.Width << Mip.Height << Mip.RowPitch << Mip.Offset << Mip.Size;
+    }
+};
+
+/** 쿡 파일의 앞부분, 밉 데이터 없이 이것만 읽어서 스트리밍을 시작할 수 있음 */
+struct FCookedTextureHeader
+{
+    uint64 CookKey = 0;
+    ETextureCompression Compression = ETextureCompression::Uncompressed;
+    bool bSRGB = true;
+    uint32 Width = 0;
+    uint32 Height = 0;
+
+    /** 0번이 가장 큰 밉 */
+    TArray<FCookedTextureMip> Mips;
+
+    /** FirstMip부터 가장 작은 밉까지의 크기 합 */
+    uint64 GetMipChainBytes(int32 FirstMip) const;
+
+    friend FArchive& operator<<(FArchive& Ar, FCookedTextureHeader& Header)
+    {
+        uint8 Compression = static_cast<uint8>(Header.Compression);
+        Ar << Header.CookKey << Compression << Header.bSRGB << Header.Width << Header.Height << Header.Mips;
+        Header.Compression = static_cast<ETextureCompression>(Compression);
+        return Ar;
+    }
+};
+
+struct FCookedTexture
+{
+    FCookedTextureHeader Header;
+
+    /** Header.Mips와 같은 순서 */
+    TArray<TArray<uint8>> MipData;
+};
+
+/**
+ * 원본 이미지를 밉 체인이 있는 BC 압축 텍스처로 쿡하고 Saved/TextureCache에 캐시
+ *
+ * 캐시 파일 이름은 원본 파일 내용과 쿡 설정의 해시라서 원본이 바뀌면 자동으로 다시 쿡합니다.
+ * 파일 형식: Magic, Version, 헤더 크기, FCookedTextureHeader, 밉 데이터
+ * 원본 디코딩(WIC)을 제외하면 D3D 없이 동작합니다.
+ */
+struct FTextureCooker
+{
+    static constexpr uint32 FileMagic = 0x58455443; // "CTEX"
+    static constexpr uint32 CookVersion = 1;
+
+    /** FNV-1a 64비트 */
+    static uint64 HashBytes(const void* Data, uint64 Size, uint64 Seed = 0xCBF29CE484222325ull);
+    static uint64 ComputeCookKey(const TArray<uint8>& SourceBytes, const FTextureCookSettings& Settings);
+
+    static FWString GetCookedPath(uint64 CookKey);
+
+    /** 2x2 박스 필터, bSRGB면 선형 공간에서 평균. OutMips[0]은 원본 */
+    static void BuildMipChain(const FTextureImage& Source, bool bSRGB, bool bGenerateMips, TArray<FTextureImage>& OutMips);
+
+    /** 대부분의 픽셀이 Z가 양수인 단위 벡터로 해석되면 노멀 맵으로 판단 */
+    static bool IsNormalMap(const FTextureImage& Image);
+
+    /**
+     * 자동 선택 규칙
+     * - 크기가 4의 배수가 아니면 비압축
+     * - sRGB: 불투명이면 BC1, 알파가 있으면 BC3
+     * - 선형: 노멀 맵이면 BC5(셰이더에서 Z 복원), 나머지는 BC7
+     */
+    static ETextureCompression ChooseCompression(const FTextureImage& Image, const FTextureCookSettings& Settings);
+
+    /** 블록 하나의 바이트 수, 비압축이면 0 */
+    static uint32 GetBlockBytes(ETextureCompression Compression);
+
+    static void CompressImage(const FTextureImage& Image, ETextureCompression Compression, TArray<uint8>& OutData, uint32& OutRowPitch);
+    static void DecompressImage(const TArray<uint8>& Data, uint32 Width, uint32 Height, ETextureCompression Compression, FTextureImage& OutImage);
+
+    /** 두 RGBA8 이미지의 PSNR(dB), BC5는 R, G만 비교 */
+    static double ComputePSNR(const FTextureImage& Reference, const FTextureImage& Image, ETextureCompression Compression);
+
+    static void CookImage(const FTextureImage& Source, const FTextureCookSettings& Settings, uint64 CookKey, FCookedTexture& OutCooked);
+
+    static bool SaveCookedTexture(const FWString& Path, FCookedTexture& Cooked);
+    static bool LoadCookedHeader(const FWString& Path, FCookedTextureHeader& OutHeader);
+    static bool LoadCookedMip(const FWString& Path, const FCookedTextureMip& Mip, TArray<uint8>& OutData);
+
+    /** WIC로 원본을 RGBA8로 디코딩 */
+    static bool DecodeSourceImage(const TArray<uint8>& SourceBytes, FTextureImage& OutImage);
+
+    /** 캐시가 있으면 헤더만 읽고, 없으면 쿡해서 저장 */
+    static bool CookTexture(const FWString& SourcePath, const FTextureCookSettings& Settings, FWString& OutCookedPath, FCookedTextureHeader& OutHeader);
+
+    /**
+     * 합성 이미지로 코덱 PSNR, 형식 선택, 밉 체인, 쿡 파일 왕복을 검사하고 결과를 로그로 출력
+     * SourcePath가 있으면 그 파일을 두 번 쿡해서 두 번째가 캐시에서 읽히는지도 확인
+     */
+    static bool RunSelfTest(const FWString& SourcePath);
+};
@@ -0,0 +1,326 @@
+#include "TextureStreamer.h"
+#include <algorithm>
+#include <cmath>
+
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /** [FirstMip, 마지막 밉]을 담는 텍스처와 SRV를 만듦, InitData가 없으면 내용은 비어 있음 */
+    bool CreateStreamingTexture(
+        ID3D11Device* Device, const FCookedTextureHeader& Header, int32 FirstMip, const D3D11_SUBRESOURCE_DATA* InitData,
+        ID3D11Texture2D*& OutTexture, ID3D11ShaderResourceView*& OutSRV
+    )
+    {
+        const FCookedTextureMip& TopMip = Header.Mips[FirstMip];
+
+        D3D11_TEXTURE2D_DESC TextureDesc = {};
+        TextureDesc.Width = TopMip.Width;
+        TextureDesc.Height = TopMip.Height;
+        TextureDesc.MipLevels = static_cast<UINT>(Header.Mips.Num() - FirstMip);
+        TextureDesc.ArraySize = 1;
+        TextureDesc.Format = FTextureStreamer::GetTextureFormat(Header.Compression, Header.bSRGB);
+        TextureDesc.SampleDesc.Count = 1;
+        // 밉을 올리고 내릴 때 복사 대상이 되므로 IMMUTABLE을 쓸 수 없음
+        TextureDesc.Usage = D3D11_USAGE_DEFAULT;
+        TextureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+        OutTexture = nullptr;
+        OutSRV = nullptr;
+
+        HRESULT hr = Device->CreateTexture2D(&TextureDesc, InitData, &OutTexture);
+        if (FAILED(hr))
+        {
+            return false;
+        }
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC SrvDesc = {};
+        SrvDesc.Format = TextureDesc.Format;
+        SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+        SrvDesc.Texture2D.MostDetailedMip = 0;
+        SrvDesc.Texture2D.MipLevels = TextureDesc.MipLevels;
+
+        hr = Device->CreateShaderResourceView(OutTexture, &SrvDesc, &OutSRV);
+        if (FAILED(hr))
+        {
+            OutTexture->Release();
+            OutTexture = nullptr;
+            return false;
+        }
+
+        return true;
+    }
+}
+
+FTextureStreamer& FTextureStreamer::Get()
+{
+    static FTextureStreamer Instance;
+    return Instance;
+}
+
+void FTextureStreamer::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext)
+{
+    Device = InDevice;
+    DeviceContext = InDeviceContext;
+}
+
+void FTextureStreamer::Release()
+{
+    FJobSystem::Get().Wait(PendingReads);
+
+    std::lock_guard Lock(Mutex);
+    {
+        std::lock_guard CompletedLock(CompletedMutex);
+        CompletedLoads.Empty();
+    }
+
+    const FTextureStreamingSettings Settings = Scheduler.GetSettings();
+    Scheduler = FTextureStreamingScheduler();
+    Scheduler.SetSettings(Settings);
+    StreamingTextures.Empty();
+
+    Device = nullptr;
+    DeviceContext = nullptr;
+}
+
+bool FTextureStreamer::RegisterTexture(const std::shared_ptr<FTexture>& Texture, const FWString& CookedPath, const FCookedTextureHeader& Header)
+{
+    if (!Device || !Texture || Header.Mips.IsEmpty())
+    {
+        return false;
+    }
+
+    const int32 NumMips = Header.Mips.Num();
+    int32 TailMip = NumMips - 1;
+    while (TailMip > 0 && std::max(Header.Mips[TailMip - 1].Width, Header.Mips[TailMip - 1].Height) <= ResidentTailSize)
+    {
+        --TailMip;
+    }
+
+    TArray<TArray<uint8>> TailData;
+    TArray<D3D11_SUBRESOURCE_DATA> InitData;
+    TailData.SetNum(NumMips - TailMip);
+    InitData.SetNum(NumMips - TailMip);
+    for (int32 MipIndex = TailMip; MipIndex < NumMips; ++MipIndex)
+    {
+        const int32 Level = MipIndex - TailMip;
+        if (!FTextureCooker::LoadCookedMip(CookedPath, Header.Mips[MipIndex], TailData[Level]))
+        {
+            return false;
+        }
+
+        InitData[Level] = {};
+        InitData[Level].pSysMem = TailData[Level].GetData();
+        InitData[Level].SysMemPitch = Header.Mips[MipIndex].RowPitch;
+    }
+
+    ID3D11Texture2D* Texture2D = nullptr;
+    ID3D11ShaderResourceView* TextureSRV = nullptr;
+    if (!CreateStreamingTexture(Device, Header, TailMip, InitData.GetData(), Texture2D, TextureSRV))
+    {
+        return false;
+    }
+
+    Texture->Release();
+    Texture->Texture = Texture2D;
+    Texture->TextureSRV = TextureSRV;
+
+    TArray<uint64> MipBytes;
+    MipBytes.Reserve(NumMips);
+    for (const FCookedTextureMip& Mip : Header.Mips)
+    {
+        MipBytes.Add(Mip.Size);
+    }
+
+    std::lock_guard Lock(Mutex);
+    const int32 TextureId = Scheduler.AddTexture(MipBytes, TailMip);
+    FStreamingTexture& Streaming = StreamingTextures[TextureId];
+    Streaming.Texture = Texture;
+    Streaming.CookedPath = CookedPath;
+    Streaming.Header = Header;
+    Streaming.ResidentMip = TailMip;
+
+    return true;
+}
+
+void FTextureStreamer::Tick()
+{
+    ++FrameNumber;
+
+    TArray<FCompletedMipLoad> Completed;
+    {
+        std::lock_guard CompletedLock(CompletedMutex);
+        Completed = std::move(CompletedLoads);
+        CompletedLoads.Empty();
+    }
+
+    std::lock_guard Lock(Mutex);
+    if (!Device)
+    {
+        return;
+    }
+
+    for (FCompletedMipLoad& Load : Completed)
+    {
+        bool bApplied = false;
+        if (FStreamingTexture* Streaming = StreamingTextures.Find(Load.TextureId))
+        {
+            bApplied = Load.bSuccess && ApplyResidentMip(*Streaming, Load.MipIndex, &Load.Data);
+            if (!bApplied)
+            {
+                UE_LOG(ELogLevel::Warning, "[Texture Streaming] Failed to stream mip %d of %s", Load.MipIndex, *FString(Streaming->Texture->Name));
+            }
+        }
+        Scheduler.CompleteLoad(Load.TextureId, Load.MipIndex, bApplied);
+    }
+
+    // 한 번도 그려지지 않은 텍스처는 예산이 남을 때만 올림
+    for (const auto& Pair : StreamingTextures)
+    {
+        const uint64 LastRenderedFrame = Pair.Value.Texture->LastRenderedFrame;
+        float Priority = 0.f;
+        if (LastRenderedFrame > 0)
+        {
+            const float FramesSinceRendered = static_cast<float>(FrameNumber - std::min(LastRenderedFrame, FrameNumber));
+            Priority = std::exp2(-FramesSinceRendered / PriorityHalfLifeFrames);
+        }
+        Scheduler.SetPriority(Pair.Key, Priority);
+    }
+
+    TArray<FTextureStreamingLoad> Loads;
+    TArray<FTextureStreamingEviction> Evictions;
+    Scheduler.Update(Loads, Evictions);
+
+    for (const FTextureStreamingEviction& Eviction : Evictions)
+    {
+        if (FStreamingTexture* Streaming = StreamingTextures.Find(Eviction.TextureId))
+        {
+            ApplyResidentMip(*Streaming, Eviction.NewResidentMip, nullptr);
+        }
+    }
+
+    for (const FTextureStreamingLoad& Load : Loads)
+    {
+        const FStreamingTexture* Streaming = StreamingTextures.Find(Load.TextureId);
+        if (!Streaming)
+        {
+            Scheduler.CompleteLoad(Load.TextureId, Load.MipIndex, false);
+            continue;
+        }
+
+        FJobSystem::Get().Dispatch(
+            [this, TextureId = Load.TextureId, MipIndex = Load.MipIndex, CookedPath = Streaming->CookedPath, Mip = Streaming->Header.Mips[Load.MipIndex]]()
+            {
+                FCompletedMipLoad Result{ TextureId, MipIndex, {}, false };
+                Result.bSuccess = FTextureCooker::LoadCookedMip(CookedPath, Mip, Result.Data);
+
+                std::lock_guard CompletedLock(CompletedMutex);
+                CompletedLoads.Add(std::move(Result));
+            },
+            &PendingReads
+        );
+    }
+}
+
+void FTextureStreamer::SetBudgetBytes(uint64 BudgetBytes)
+{
+    std::lock_guard Lock(Mutex);
+    FTextureStreamingSettings Settings = Scheduler.GetSettings();
+    Settings.BudgetBytes = BudgetBytes;
+    Scheduler.SetSettings(Settings);
+}
+
+uint64 FTextureStreamer::GetBudgetBytes() const
+{
+    std::lock_guard Lock(Mutex);
+    return Scheduler.GetSettings().BudgetBytes;
+}
+
+uint64 FTextureStreamer::GetResidentBytes() const
+{
+    std::lock_guard Lock(Mutex);
+    return Scheduler.GetResidentBytes();
+}
+
+uint64 FTextureStreamer::GetRequiredBytes() const
+{
+    std::lock_guard Lock(Mutex);
+    return Scheduler.GetRequiredBytes();
+}
+
+int32 FTextureStreamer::GetNumTextures() const
+{
+    std::lock_guard Lock(Mutex);
+    return Scheduler.GetNumTextures();
+}
+
+int32 FTextureStreamer::GetNumLoadsInFlight() const
+{
+    std::lock_guard Lock(Mutex);
+    return Scheduler.GetNumLoadsInFlight();
+}
+
+DXGI_FORMAT FTextureStreamer::GetTextureFormat(ETextureCompression Compression, bool bSRGB)
+{
+    switch (Compression)
+    {
+    case ETextureCompression::BC1:
+        return bSRGB ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+    case ETextureCompression::BC3:
+        return bSRGB ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+    case ETextureCompression::BC4:
+        return DXGI_FORMAT_BC4_UNORM;
+    case ETextureCompression::BC5:
+        return DXGI_FORMAT_BC5_UNORM;
+    case ETextureCompression::BC7:
+        return bSRGB ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+    default:
+        return bSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+    }
+}
+
+bool FTextureStreamer::ApplyResidentMip(FStreamingTexture& Streaming, int32 NewResidentMip, const TArray<uint8>* NewMipData)
+{
+    const FCookedTextureHeader& Header = Streaming.Header;
+    const int32 OldResidentMip = Streaming.ResidentMip;
+    if (NewResidentMip < 0 || NewResidentMip >= Header.Mips.Num() || NewResidentMip == OldResidentMip)
+    {
+        return false;
+    }
+
+    // 올릴 때는 바로 위 밉 하나씩만
+    if (NewResidentMip < OldResidentMip
+        && (NewResidentMip != OldResidentMip - 1 || !NewMipData || NewMipData->Num() != static_cast<int32>(Header.Mips[NewResidentMip].Size)))
+    {
+        return false;
+    }
+
+    FTexture* Texture = Streaming.Texture.get();
+    ID3D11Texture2D* NewTexture = nullptr;
+    ID3D11ShaderResourceView* NewSRV = nullptr;
+    if (!Texture->Texture || !CreateStreamingTexture(Device, Header, NewResidentMip, nullptr, NewTexture, NewSRV))
+    {
+        return false;
+    }
+
+    const int32 NumLevels = Header.Mips.Num() - NewResidentMip;
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        const int32 MipIndex = NewResidentMip + Level;
+        if (MipIndex >= OldResidentMip)
+        {
+            DeviceContext->CopySubresourceRegion(NewTexture, Level, 0, 0, 0, Texture->Texture, MipIndex - OldResidentMip, nullptr);
+        }
+        else
+        {
+            DeviceContext->UpdateSubresource(NewTexture, Level, nullptr, NewMipData->GetData(), Header.Mips[MipIndex].RowPitch, 0);
+        }
+    }
+
+    Texture->Release();
+    Texture->Texture = NewTexture;
+    Texture->TextureSRV = NewSRV;
+    Streaming.ResidentMip = NewResidentMip;
+
+    return true;
+}
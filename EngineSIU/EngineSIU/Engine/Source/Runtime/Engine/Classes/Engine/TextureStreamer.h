@@ -0,0 +1,87 @@
+#pragma once
+#include <memory>
+#include <mutex>
+
+#include "Texture.h"
+#include "TextureCooker.h"
+#include "TextureStreamingScheduler.h"
+#include "Async/JobSystem.h"
+#include "Container/Map.h"
+
+/**
+ * 쿡된 텍스처의 밉을 백그라운드에서 읽어 GPU에 올리는 스트리머
+ *
+ * 등록할 때 작은 밉(ResidentTailSize 이하)만 동기로 올리고, 큰 밉은 FJobSystem에서 읽은 뒤
+ * Tick에서 텍스처를 다시 만들어 기존 밉을 복사하고 새 밉을 올립니다.
+ * FTexture의 SRV를 교체하므로 GetTexture로 텍스처를 찾는 쪽은 바뀌는 것이 없습니다.
+ * 우선순위는 FTexture::LastRenderedFrame이 최근일수록 높습니다.
+ */
+class FTextureStreamer
+{
+public:
+    static FTextureStreamer& Get();
+
+    /** 이 크기 이하의 밉은 등록할 때 바로 올리고 내리지 않음 */
+    static constexpr uint32 ResidentTailSize = 64;
+
+    /** 이 프레임 수 동안 그려지지 않으면 우선순위가 절반이 됨 */
+    static constexpr float PriorityHalfLifeFrames = 120.f;
+
+    void Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext);
+
+    /** 진행 중인 읽기를 기다린 뒤 등록을 모두 해제, 텍스처 자체는 FResourceManager가 해제 */
+    void Release();
+
+    /** 작은 밉을 올려서 Texture의 SRV를 채우고 스트리밍 대상으로 등록 */
+    bool RegisterTexture(const std::shared_ptr<FTexture>& Texture, const FWString& CookedPath, const FCookedTextureHeader& Header);
+
+    /** 완료된 읽기를 GPU에 반영하고 다음 요청을 보냄, 렌더링 스레드에서 매 프레임 호출 */
+    void Tick();
+
+    uint64 GetFrameNumber() const { return FrameNumber; }
+
+    void SetBudgetBytes(uint64 BudgetBytes);
+
+    uint64 GetBudgetBytes() const;
+    uint64 GetResidentBytes() const;
+    uint64 GetRequiredBytes() const;
+    int32 GetNumTextures() const;
+    int32 GetNumLoadsInFlight() const;
+
+    static DXGI_FORMAT GetTextureFormat(ETextureCompression Compression, bool bSRGB);
+
+private:
+    struct FStreamingTexture
+    {
+        std::shared_ptr<FTexture> Texture;
+        FWString CookedPath;
+        FCookedTextureHeader Header;
+        int32 ResidentMip = 0;
+    };
+
+    struct FCompletedMipLoad
+    {
+        int32 TextureId;
+        int32 MipIndex;
+        TArray<uint8> Data;
+        bool bSuccess;
+    };
+
+    /** [NewResidentMip, 마지막 밉]이 올라간 텍스처로 교체, NewMipData는 새로 올라가는 밉 하나 */
+    bool ApplyResidentMip(FStreamingTexture& Streaming, int32 NewResidentMip, const TArray<uint8>* NewMipData);
+
+    ID3D11Device* Device = nullptr;
+    ID3D11DeviceContext* DeviceContext = nullptr;
+
+    uint64 FrameNumber = 0;
+
+    /** 등록은 로딩 중인 다른 스레드에서도 일어날 수 있음 */
+    mutable std::mutex Mutex;
+    FTextureStreamingScheduler Scheduler;
+    TMap<int32, FStreamingTexture> StreamingTextures;
+
+    std::mutex CompletedMutex;
+    TArray<FCompletedMipLoad> CompletedLoads;
+
+    FJobCounter PendingReads;
+};
@@ -0,0 +1,439 @@
+#include "TextureStreamingScheduler.h"
+#include <algorithm>
+#include <cfloat>
+
+#include "UserInterface/Console.h"
+
+int32 FTextureStreamingScheduler::AddTexture(const TArray<uint64>& MipBytes, int32 TailMip)
+{
+    int32 TextureId;
+    if (FreeIds.IsEmpty())
+    {
+        TextureId = Entries.Emplace();
+    }
+    else
+    {
+        TextureId = FreeIds.Pop();
+    }
+
+    FEntry& Entry = Entries[TextureId];
+    Entry = FEntry();
+    Entry.MipBytes = MipBytes;
+    Entry.TailMip = MipBytes.IsEmpty() ? 0 : std::clamp(TailMip, 0, MipBytes.Num() - 1);
+    Entry.ResidentMip = Entry.TailMip;
+    Entry.bValid = true;
+
+    for (int32 MipIndex = Entry.ResidentMip; MipIndex < Entry.MipBytes.Num(); ++MipIndex)
+    {
+        ResidentBytes += Entry.MipBytes[MipIndex];
+    }
+
+    return TextureId;
+}
+
+void FTextureStreamingScheduler::RemoveTexture(int32 TextureId)
+{
+    if (!IsValidTexture(TextureId))
+    {
+        return;
+    }
+
+    FEntry& Entry = Entries[TextureId];
+    for (int32 MipIndex = Entry.ResidentMip; MipIndex < Entry.MipBytes.Num(); ++MipIndex)
+    {
+        ResidentBytes -= Entry.MipBytes[MipIndex];
+    }
+    Entry.ResidentMip = Entry.MipBytes.Num();
+
+    if (Entry.PendingMip != INDEX_NONE)
+    {
+        Entry.bRemovePending = true;
+        return;
+    }
+
+    Entry = FEntry();
+    FreeIds.Add(TextureId);
+}
+
+void FTextureStreamingScheduler::SetPriority(int32 TextureId, float Priority)
+{
+    if (IsValidTexture(TextureId))
+    {
+        Entries[TextureId].Priority = std::max(Priority, 0.f);
+    }
+}
+
+void FTextureStreamingScheduler::Update(TArray<FTextureStreamingLoad>& OutLoads, TArray<FTextureStreamingEviction>& OutEvictions)
+{
+    OutLoads.Empty();
+    OutEvictions.Empty();
+
+    // 예산이 줄어든 경우 우선순위가 낮은 텍스처부터 내림
+    while (ResidentBytes + PendingBytes > Settings.BudgetBytes)
+    {
+        const int32 Victim = FindEvictionVictim(FLT_MAX, INDEX_NONE);
+        if (Victim == INDEX_NONE)
+        {
+            break;
+        }
+        EvictTopMip(Victim, OutEvictions);
+    }
+
+    struct FCandidate
+    {
+        int32 TextureId;
+        float Score;
+    };
+
+    TArray<FCandidate> Candidates;
+    for (int32 TextureId = 0; TextureId < Entries.Num(); ++TextureId)
+    {
+        const FEntry& Entry = Entries[TextureId];
+        if (!IsValidTexture(TextureId) || Entry.PendingMip != INDEX_NONE || Entry.ResidentMip <= Entry.MinMip)
+        {
+            continue;
+        }
+
+        // 같은 우선순위라면 다음 밉이 작은(해상도가 낮은) 텍스처가 먼저
+        const uint64 NextMipBytes = std::max<uint64>(Entry.MipBytes[Entry.ResidentMip - 1], 1);
+        Candidates.Add({ TextureId, (Entry.Priority + 1e-3f) / static_cast<float>(NextMipBytes) });
+    }
+
+    Candidates.Sort([](const FCandidate& A, const FCandidate& B)
+    {
+        return A.Score != B.Score ? A.Score > B.Score : A.TextureId < B.TextureId;
+    });
+
+    for (const FCandidate& Candidate : Candidates)
+    {
+        if (NumLoadsInFlight >= Settings.MaxLoadsInFlight)
+        {
+            break;
+        }
+
+        FEntry& Entry = Entries[Candidate.TextureId];
+        const int32 NextMip = Entry.ResidentMip - 1;
+        const uint64 Cost = Entry.MipBytes[NextMip];
+
+        if (ResidentBytes + PendingBytes + Cost > Settings.BudgetBytes)
+        {
+            // 필요한 만큼 확보할 수 있을 때만 내려서 다른 텍스처를 헛되이 내리지 않음
+            uint64 ReclaimableBytes = 0;
+            for (int32 TextureId = 0; TextureId < Entries.Num(); ++TextureId)
+            {
+                const FEntry& Other = Entries[TextureId];
+                if (TextureId != Candidate.TextureId && CanEvict(Other) && Other.Priority < Entry.Priority)
+                {
+                    for (int32 MipIndex = Other.ResidentMip; MipIndex < Other.TailMip; ++MipIndex)
+                    {
+                        ReclaimableBytes += Other.MipBytes[MipIndex];
+                    }
+                }
+            }
+
+            if (ResidentBytes + PendingBytes + Cost > Settings.BudgetBytes + ReclaimableBytes)
+            {
+                continue;
+            }
+
+            while (ResidentBytes + PendingBytes + Cost > Settings.BudgetBytes)
+            {
+                const int32 Victim = FindEvictionVictim(Entry.Priority, Candidate.TextureId);
+                if (Victim == INDEX_NONE)
+                {
+                    break;
+                }
+                EvictTopMip(Victim, OutEvictions);
+            }
+        }
+
+        Entry.PendingMip = NextMip;
+        PendingBytes += Cost;
+        ++NumLoadsInFlight;
+        OutLoads.Add({ Candidate.TextureId, NextMip });
+    }
+}
+
+void FTextureStreamingScheduler::CompleteLoad(int32 TextureId, int32 MipIndex, bool bSuccess)
+{
+    if (!Entries.IsValidIndex(TextureId))
+    {
+        return;
+    }
+
+    FEntry& Entry = Entries[TextureId];
+    if (Entry.PendingMip != MipIndex || MipIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    PendingBytes -= Entry.MipBytes[MipIndex];
+    --NumLoadsInFlight;
+    Entry.PendingMip = INDEX_NONE;
+
+    if (Entry.bRemovePending)
+    {
+        Entry = FEntry();
+        FreeIds.Add(TextureId);
+        return;
+    }
+
+    if (bSuccess && MipIndex == Entry.ResidentMip - 1)
+    {
+        Entry.ResidentMip = MipIndex;
+        ResidentBytes += Entry.MipBytes[MipIndex];
+    }
+    else
+    {
+        Entry.MinMip = MipIndex + 1;
+    }
+}
+
+bool FTextureStreamingScheduler::IsValidTexture(int32 TextureId) const
+{
+    return Entries.IsValidIndex(TextureId) && Entries[TextureId].bValid && !Entries[TextureId].bRemovePending;
+}
+
+int32 FTextureStreamingScheduler::GetResidentMip(int32 TextureId) const
+{
+    return IsValidTexture(TextureId) ? Entries[TextureId].ResidentMip : INDEX_NONE;
+}
+
+uint64 FTextureStreamingScheduler::GetRequiredBytes() const
+{
+    uint64 Bytes = 0;
+    for (int32 TextureId = 0; TextureId < Entries.Num(); ++TextureId)
+    {
+        if (IsValidTexture(TextureId))
+        {
+            for (const uint64 MipBytes : Entries[TextureId].MipBytes)
+            {
+                Bytes += MipBytes;
+            }
+        }
+    }
+    return Bytes;
+}
+
+bool FTextureStreamingScheduler::CanEvict(const FEntry& Entry) const
+{
+    return Entry.bValid && !Entry.bRemovePending && Entry.PendingMip == INDEX_NONE && Entry.ResidentMip < Entry.TailMip;
+}
+
+int32 FTextureStreamingScheduler::FindEvictionVictim(float MaxPriority, int32 ExcludeId) const
+{
+    int32 Victim = INDEX_NONE;
+    for (int32 TextureId = 0; TextureId < Entries.Num(); ++TextureId)
+    {
+        const FEntry& Entry = Entries[TextureId];
+        if (TextureId == ExcludeId || !CanEvict(Entry) || Entry.Priority >= MaxPriority)
+        {
+            continue;
+        }
+
+        if (Victim == INDEX_NONE)
+        {
+            Victim = TextureId;
+            continue;
+        }
+
+        // 우선순위가 같다면 더 많이 확보되는 쪽
+        const FEntry& Best = Entries[Victim];
+        if (Entry.Priority < Best.Priority
+            || (Entry.Priority == Best.Priority && Entry.MipBytes[Entry.ResidentMip] > Best.MipBytes[Best.ResidentMip]))
+        {
+            Victim = TextureId;
+        }
+    }
+    return Victim;
+}
+
+void FTextureStreamingScheduler::EvictTopMip(int32 TextureId, TArray<FTextureStreamingEviction>& OutEvictions)
+{
+    FEntry& Entry = Entries[TextureId];
+    ResidentBytes -= Entry.MipBytes[Entry.ResidentMip];
+    ++Entry.ResidentMip;
+
+    for (FTextureStreamingEviction& Eviction : OutEvictions)
+    {
+        if (Eviction.TextureId == TextureId)
+        {
+            Eviction.NewResidentMip = Entry.ResidentMip;
+            return;
+        }
+    }
+    OutEvictions.Add({ TextureId, Entry.ResidentMip });
+}
+
+bool FTextureStreamingScheduler::RunSelfTest()
+{
+    constexpr int32 NumTextures = 8;
+    constexpr int32 TailMip = 4; // 64x64
+
+    // 1024x1024 BC1 텍스처 8개, 예산은 약 3개 분량
+    TArray<uint64> MipBytes;
+    for (uint32 Size = 1024; ; Size /= 2)
+    {
+        const uint64 NumBlocks = std::max(1u, (Size + 3) / 4);
+        MipBytes.Add(NumBlocks * NumBlocks * 8);
+        if (Size == 1)
+        {
+            break;
+        }
+    }
+
+    FTextureStreamingScheduler Scheduler;
+    FTextureStreamingSettings Settings;
+    Settings.BudgetBytes = 3ull * 700 * 1024;
+    Settings.MaxLoadsInFlight = 3;
+    Scheduler.SetSettings(Settings);
+
+    int32 TextureIds[NumTextures];
+    float Priorities[NumTextures];
+    for (int32 Index = 0; Index < NumTextures; ++Index)
+    {
+        TextureIds[Index] = Scheduler.AddTexture(MipBytes, TailMip);
+        Priorities[Index] = Index < 3 ? 1.f : 0.1f;
+        Scheduler.SetPriority(TextureIds[Index], Priorities[Index]);
+    }
+
+    int32 NumFailures = 0;
+    auto Check = [&NumFailures](bool bCondition, const char* Description)
+    {
+        if (!bCondition)
+        {
+            UE_LOG(ELogLevel::Error, "[Streaming Test] %s", Description);
+            ++NumFailures;
+        }
+    };
+
+    TArray<FTextureStreamingLoad> Loads;
+    TArray<FTextureStreamingEviction> Evictions;
+    int32 NumOverBudgetFrames = 0;
+    int32 NumBadLoads = 0;
+    int32 NumBadEvictions = 0;
+
+    // 한 프레임 Update 후 예산, 동시 읽기 수, 밉 순서, 내린 텍스처의 우선순위를 확인하고 모든 읽기를 완료
+    auto StepFrame = [&](float LoadPriority)
+    {
+        TArray<int32> MipsBeforeUpdate;
+        for (const int32 TextureId : TextureIds)
+        {
+            MipsBeforeUpdate.Add(Scheduler.GetResidentMip(TextureId));
+        }
+
+        Scheduler.Update(Loads, Evictions);
+
+        NumOverBudgetFrames += Scheduler.GetResidentBytes() + Scheduler.GetPendingBytes() > Settings.BudgetBytes ? 1 : 0;
+        NumBadLoads += Loads.Num() > Settings.MaxLoadsInFlight || Scheduler.GetNumLoadsInFlight() > Settings.MaxLoadsInFlight ? 1 : 0;
+        for (const FTextureStreamingLoad& Load : Loads)
+        {
+            NumBadLoads += Load.MipIndex == Scheduler.GetResidentMip(Load.TextureId) - 1 ? 0 : 1;
+        }
+        for (const FTextureStreamingEviction& Eviction : Evictions)
+        {
+            // 더 높은 우선순위의 텍스처를 위해서만 내려야 하고, 상주 꼬리 밉은 건드리지 않아야 함
+            NumBadEvictions += Priorities[Eviction.TextureId] < LoadPriority && Eviction.NewResidentMip <= TailMip
+                && Eviction.NewResidentMip > MipsBeforeUpdate[Eviction.TextureId] ? 0 : 1;
+        }
+
+        for (const FTextureStreamingLoad& Load : Loads)
+        {
+            Scheduler.CompleteLoad(Load.TextureId, Load.MipIndex, true);
+        }
+    };
+
+    for (int32 Frame = 0; Frame < 20; ++Frame)
+    {
+        StepFrame(1.f);
+    }
+    Check(Scheduler.GetResidentMip(TextureIds[0]) == 0 && Scheduler.GetResidentMip(TextureIds[1]) == 0 && Scheduler.GetResidentMip(TextureIds[2]) == 0,
+        "High priority textures did not reach mip 0");
+    const uint64 ResidentBeforeSwitch = Scheduler.GetResidentBytes();
+
+    // 우선순위를 뒤집으면 새로 중요해진 텍스처가 올라가고 이전 텍스처가 내려가야 함
+    for (int32 Index = 0; Index < NumTextures; ++Index)
+    {
+        Priorities[Index] = Index >= 5 ? 1.f : 0.05f;
+        Scheduler.SetPriority(TextureIds[Index], Priorities[Index]);
+    }
+    for (int32 Frame = 0; Frame < 20; ++Frame)
+    {
+        StepFrame(1.f);
+    }
+    Check(Scheduler.GetResidentMip(TextureIds[5]) == 0 && Scheduler.GetResidentMip(TextureIds[6]) == 0 && Scheduler.GetResidentMip(TextureIds[7]) == 0,
+        "Textures raised after the priority change did not reach mip 0");
+    Check(Scheduler.GetResidentMip(TextureIds[0]) > 0 && Scheduler.GetResidentMip(TextureIds[1]) > 0 && Scheduler.GetResidentMip(TextureIds[2]) > 0,
+        "Textures lowered after the priority change were not evicted");
+
+    UE_LOG(ELogLevel::Display, "[Streaming Test] %d textures, budget %.2f MB: resident %.2f MB before and %.2f MB after the priority change",
+        NumTextures, static_cast<double>(Settings.BudgetBytes) / (1024.0 * 1024.0),
+        static_cast<double>(ResidentBeforeSwitch) / (1024.0 * 1024.0), static_cast<double>(Scheduler.GetResidentBytes()) / (1024.0 * 1024.0));
+
+    // 예산을 줄이면 즉시 예산 안으로 내려가되, 높은 우선순위 텍스처가 더 높은 해상도를 유지해야 함
+    Settings.BudgetBytes = 600ull * 1024;
+    Scheduler.SetSettings(Settings);
+    StepFrame(FLT_MAX);
+    int32 HighestLowPriorityMip = INT32_MAX;
+    int32 LowestHighPriorityMip = 0;
+    for (int32 Index = 0; Index < NumTextures; ++Index)
+    {
+        const int32 ResidentMip = Scheduler.GetResidentMip(TextureIds[Index]);
+        if (Priorities[Index] >= 1.f)
+        {
+            LowestHighPriorityMip = std::max(LowestHighPriorityMip, ResidentMip);
+        }
+        else
+        {
+            HighestLowPriorityMip = std::min(HighestLowPriorityMip, ResidentMip);
+        }
+    }
+    Check(Scheduler.GetResidentBytes() + Scheduler.GetPendingBytes() <= Settings.BudgetBytes, "Shrinking the budget left too much resident");
+    Check(LowestHighPriorityMip <= HighestLowPriorityMip, "Shrinking the budget evicted high priority textures first");
+
+    // 실패한 밉은 다시 요청하지 않고, 읽는 중에 제거한 텍스처는 완료 시점에 정리되어야 함
+    Settings.BudgetBytes = 3ull * 700 * 1024;
+    Scheduler.SetSettings(Settings);
+    Scheduler.Update(Loads, Evictions);
+    Check(Loads.Num() >= 2, "No loads after raising the budget");
+
+    int32 RemovedId = INDEX_NONE;
+    TArray<FTextureStreamingLoad> FailedLoads;
+    if (!Loads.IsEmpty())
+    {
+        RemovedId = Loads[0].TextureId;
+        Scheduler.RemoveTexture(RemovedId);
+        Check(!Scheduler.IsValidTexture(RemovedId), "Removed texture is still valid");
+        Scheduler.CompleteLoad(Loads[0].TextureId, Loads[0].MipIndex, true);
+        Check(Scheduler.GetNumTextures() == NumTextures - 1, "Removed texture was not freed when its load completed");
+    }
+    for (int32 Index = 1; Index < Loads.Num(); ++Index)
+    {
+        FailedLoads.Add(Loads[Index]);
+        Scheduler.CompleteLoad(Loads[Index].TextureId, Loads[Index].MipIndex, false);
+    }
+    Check(Scheduler.GetNumLoadsInFlight() == 0 && Scheduler.GetPendingBytes() == 0, "Completed loads are still counted as pending");
+
+    for (int32 Frame = 0; Frame < 10; ++Frame)
+    {
+        Scheduler.Update(Loads, Evictions);
+        for (const FTextureStreamingLoad& Load : Loads)
+        {
+            bool bRequestsFailedMip = Load.TextureId == RemovedId;
+            for (const FTextureStreamingLoad& Failed : FailedLoads)
+            {
+                bRequestsFailedMip |= Load.TextureId == Failed.TextureId && Load.MipIndex <= Failed.MipIndex;
+            }
+            Check(!bRequestsFailedMip, "A failed mip or a removed texture was requested again");
+            Scheduler.CompleteLoad(Load.TextureId, Load.MipIndex, true);
+        }
+    }
+
+    Check(NumOverBudgetFrames == 0, "Resident and pending bytes exceeded the budget");
+    Check(NumBadLoads == 0, "Loads skipped a mip or exceeded the in-flight limit");
+    Check(NumBadEvictions == 0, "Evicted a texture that was not lower priority, or below its tail mip");
+
+    UE_LOG(NumFailures == 0 ? ELogLevel::Display : ELogLevel::Error, "[Streaming Test] %s, %d failed checks",
+        NumFailures == 0 ? "Passed" : "Failed", NumFailures);
+    return NumFailures == 0;
+}
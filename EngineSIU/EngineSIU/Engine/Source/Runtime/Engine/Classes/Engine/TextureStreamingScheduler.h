@@ -0,0 +1,108 @@
+#pragma once
+#include "CoreMiscDefines.h"
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+struct FTextureStreamingSettings
+{
+    /** 상주 밉과 읽는 중인 밉을 합한 최대 크기 */
+    uint64 BudgetBytes = 256ull * 1024 * 1024;
+
+    /** 동시에 읽을 수 있는 밉 수 */
+    int32 MaxLoadsInFlight = 4;
+};
+
+struct FTextureStreamingLoad
+{
+    int32 TextureId;
+    int32 MipIndex;
+};
+
+/** NewResidentMip보다 큰 밉을 GPU에서 내려야 함 */
+struct FTextureStreamingEviction
+{
+    int32 TextureId;
+    int32 NewResidentMip;
+};
+
+/**
+ * 텍스처 밉 스트리밍의 순서와 예산만 결정하는 스케줄러, 실제 읽기와 GPU 반영은 FTextureStreamer가 담당
+ *
+ * - 텍스처마다 작은 밉부터 한 단계씩 올리며, 우선순위 / 다음 밉 크기가 큰 요청부터 처리해 해상도가 고르게 올라감
+ * - 예산이 모자라면 우선순위가 더 낮은 텍스처의 가장 큰 밉부터 내림
+ * - TailMip 이후의 작은 밉은 항상 상주
+ */
+class FTextureStreamingScheduler
+{
+public:
+    void SetSettings(const FTextureStreamingSettings& InSettings) { Settings = InSettings; }
+    const FTextureStreamingSettings& GetSettings() const { return Settings; }
+
+    /**
+     * @param MipBytes 0번이 가장 큰 밉
+     * @param TailMip 등록 시점에 이미 올라가 있고 내리지 않는 첫 밉
+     * @return 텍스처 Id
+     */
+    int32 AddTexture(const TArray<uint64>& MipBytes, int32 TailMip);
+
+    /** 읽는 중인 밉이 있다면 CompleteLoad가 호출될 때 정리됨 */
+    void RemoveTexture(int32 TextureId);
+
+    /** 0 이상, 클수록 먼저 올리고 나중에 내림 */
+    void SetPriority(int32 TextureId, float Priority);
+
+    /** 예산에 맞게 내릴 밉과 새로 읽을 밉을 결정, 결정한 내용은 즉시 상주 크기에 반영됨 */
+    void Update(TArray<FTextureStreamingLoad>& OutLoads, TArray<FTextureStreamingEviction>& OutEvictions);
+
+    /** 실패한 밉은 다시 요청하지 않음 */
+    void CompleteLoad(int32 TextureId, int32 MipIndex, bool bSuccess);
+
+    bool IsValidTexture(int32 TextureId) const;
+    int32 GetResidentMip(int32 TextureId) const;
+
+    int32 GetNumTextures() const { return Entries.Num() - FreeIds.Num(); }
+    int32 GetNumLoadsInFlight() const { return NumLoadsInFlight; }
+    uint64 GetResidentBytes() const { return ResidentBytes; }
+    uint64 GetPendingBytes() const { return PendingBytes; }
+
+    /** 모든 텍스처를 최고 해상도로 올렸을 때의 크기 */
+    uint64 GetRequiredBytes() const;
+
+    /**
+     * 1024 BC1 텍스처 8개를 작은 예산으로 스트리밍하며 예산, 동시 읽기 수, 우선순위 교체,
+     * 예산 축소, 읽기 실패와 읽는 중 제거를 검사하고 결과를 로그로 출력
+     */
+    static bool RunSelfTest();
+
+private:
+    struct FEntry
+    {
+        TArray<uint64> MipBytes;
+        int32 TailMip = 0;
+        int32 ResidentMip = 0;
+        int32 PendingMip = INDEX_NONE;
+
+        /** 읽기에 실패하면 그 밉보다 큰 밉은 요청하지 않음 */
+        int32 MinMip = 0;
+
+        float Priority = 0.f;
+        bool bValid = false;
+        bool bRemovePending = false;
+    };
+
+    bool CanEvict(const FEntry& Entry) const;
+
+    /** ExcludeId를 제외하고 MaxPriority보다 낮은 텍스처 중 가장 낮은 것, 없으면 INDEX_NONE */
+    int32 FindEvictionVictim(float MaxPriority, int32 ExcludeId) const;
+
+    void EvictTopMip(int32 TextureId, TArray<FTextureStreamingEviction>& OutEvictions);
+
+    FTextureStreamingSettings Settings;
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeIds;
+
+    uint64 ResidentBytes = 0;
+    uint64 PendingBytes = 0;
+    int32 NumLoadsInFlight = 0;
+};
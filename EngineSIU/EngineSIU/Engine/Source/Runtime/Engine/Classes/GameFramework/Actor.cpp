@@ -1,6 +1,7 @@
 #include "Actor.h"
 
 #include "Components/PrimitiveComponent.h"
+#include "World/TickTaskManager.h"
 #include "World/World.h"
 
 AActor::AActor()
@@ -11,89 +12,12 @@ void AActor::PostSpawnInitialize()
 {
 }
 
-UObject* AActor::Duplicate(UObject* InOuter)
+void AActor::Serialize(FArchive& Ar)
 {
-    ThisClass* NewActor = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    NewActor->Owner = Owner;
-    NewActor->bTickInEditor = bTickInEditor;
-    // 기본적으로 있던 컴포넌트 제거
-    TSet CopiedComponents = NewActor->OwnedComponents;
-
-    //임시용 디폴트 컴포넌트 이름 저장
-    //TODO: 디퐅트 컴포넌트를 삭제하지 않고 그 컴포넌트에 프로퍼티를 복사하는 방법으로 변경 필요
-    TArray<FName> DefaultCopiedComponentNames;
-    for (UActorComponent* Components : CopiedComponents)
-    {
-        if (Components)
-        {
-            DefaultCopiedComponentNames.Add(Components->GetFName());
-            Components->DestroyComponent(true);
-        }
-    }
-    NewActor->OwnedComponents.Empty();
-
-
-    // 부모-자식 관계 저장용 맵
-    TMap<USceneComponent*, USceneComponent*> ParentChildMap;
-
-    // 컴포넌트 복제 및 부모-자식 관계 추적
-    TMap<USceneComponent*, USceneComponent*> OriginalToDuplicateMap; // 원본 -> 복제된 컴포넌트 매핑
-
-    for (UActorComponent* Component : OwnedComponents)
-    {
-
-        UActorComponent* NewComponent = Cast<UActorComponent>(Component->Duplicate(NewActor));
-        NewComponent->OwnerPrivate = NewActor;
-        NewActor->OwnedComponents.Add(NewComponent);
-
-        //디폴트 컴포넌트 이름 동일하게 
-        for (const auto DefaultCopiedName : DefaultCopiedComponentNames)
-        {
-            if (DefaultCopiedName == Component->GetFName())
-            {
-                NewComponent->SetFName(DefaultCopiedName);
-            }
-        }
-  
-        // RootComponent 설정
-        if (RootComponent == Component)
-        {
-            NewActor->RootComponent = static_cast<USceneComponent*>(NewComponent);
-        }
-
-        // 부모-자식 관계 저장 (USceneComponent만 해당)
-        if (USceneComponent* SceneComp = Cast<USceneComponent>(Component))
-        {
-            OriginalToDuplicateMap.Add(SceneComp, static_cast<USceneComponent*>(NewComponent));
-            if (USceneComponent* ParentComp = SceneComp->GetAttachParent())
-            {
-                ParentChildMap.Add(static_cast<USceneComponent*>(NewComponent), ParentComp);
-            }
-        }
-
-        // 컴포넌트 초기화
-        /* ActorComponent가 Actor와 World에 등록이 되었다는 전제하에 호출됩니다 */
-        if (!NewComponent->HasBeenInitialized())
-        {
-            // TODO: RegisterComponent() 생기면 제거
-            NewComponent->InitializeComponent();
-        }
-    }
-
-    // 부모-자식 관계 복원
-    for (const auto& [ChildComp, OriginalParentComp] : ParentChildMap)
-    {
-        // 복제된 부모를 찾아 설정
-        if (USceneComponent** NewParentComp = OriginalToDuplicateMap.Find(OriginalParentComp))
-        {
-            ChildComp->AttachToComponent(*NewParentComp);
-        }
-    }
-
-    
-
-    return NewActor;
+    Ar << Owner << bTickInEditor;
+    Ar.Serialize(TickGroup);
 }
 
 void AActor::BeginPlay()
@@ -108,8 +32,13 @@ void AActor::BeginPlay()
 
 void AActor::Tick(float DeltaTime)
 {
-    // TODO: 임시로 Actor에서 Tick 돌리기
-    // TODO: 나중에 삭제를 Pending으로 하던가 해서 복사비용 줄이기
+    // World에 등록된 Actor의 Component는 TickTaskManager가 TickGroup별로 Tick함
+    if (bRegisteredForTick)
+    {
+        return;
+    }
+
+    // Level에 속하지 않은 Actor(Gizmo, EditorPlayer 등)는 직접 Component를 Tick
     const auto CopyComponents = OwnedComponents;
 
     for (UActorComponent* Comp : CopyComponents)
@@ -222,6 +151,14 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
             Component->InitializeComponent();
         }
 
+        if (bRegisteredForTick)
+        {
+            if (UWorld* World = GetWorld())
+            {
+                World->GetTickTaskManager().RegisterComponent(Component);
+            }
+        }
+
         return Component;
     }
     
@@ -231,6 +168,14 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
 
 void AActor::RemoveOwnedComponent(UActorComponent* Component)
 {
+    if (Component->IsRegisteredForTick())
+    {
+        if (UWorld* World = GetWorld())
+        {
+            World->GetTickTaskManager().UnregisterComponent(Component);
+        }
+    }
+
     OwnedComponents.Remove(Component);
 }
 
@@ -371,3 +316,23 @@ void AActor::SetActorTickInEditor(bool InbInTickInEditor)
 {
     bTickInEditor = InbInTickInEditor;
 }
+
+void AActor::SetActorTickGroup(ETickingGroup InTickGroup)
+{
+    if (TickGroup == InTickGroup)
+    {
+        return;
+    }
+
+    UWorld* World = bRegisteredForTick ? GetWorld() : nullptr;
+    if (!World)
+    {
+        TickGroup = InTickGroup;
+        return;
+    }
+
+    FTickTaskManager& TickTaskManager = World->GetTickTaskManager();
+    TickTaskManager.UnregisterActor(this);
+    TickGroup = InTickGroup;
+    TickTaskManager.RegisterActor(this);
+}
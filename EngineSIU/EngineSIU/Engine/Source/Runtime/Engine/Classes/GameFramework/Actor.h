@@ -22,12 +22,16 @@ public:
 
     virtual void PostSpawnInitialize();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    /** Component는 담지 않음, Component까지 복제하려면 FWorldSnapshot::DuplicateActor를 사용 */
+    virtual void Serialize(FArchive& Ar) override;
 
     /** Actor가 게임에 배치되거나 스폰될 때 호출됩니다. */
     virtual void BeginPlay();
 
-    /** 매 Tick마다 호출됩니다. */
+    /**
+     * 매 Tick마다 호출됩니다.
+     * World의 TickTaskManager에 등록된 Actor라면 Component는 각자의 TickGroup에서 따로 Tick됩니다.
+     */
     virtual void Tick(float DeltaTime);
 
     /** Actor가 제거될 때 호출됩니다. */
@@ -142,9 +146,23 @@ public:
     bool IsHidden() const { return bHidden; }
     void SetHidden(bool InbHidden) { bHidden = InbHidden; }
 
+    /** Actor의 Tick이 실행되는 TickGroup을 반환합니다. */
+    ETickingGroup GetActorTickGroup() const { return TickGroup; }
+    void SetActorTickGroup(ETickingGroup InTickGroup);
+
+    /** World의 TickTaskManager에 등록되어 있는지 여부를 반환합니다. */
+    bool IsRegisteredForTick() const { return bRegisteredForTick; }
+
 private:
+    friend class FTickTaskManager;
+    friend class FWorldSnapshot;
+
     bool bTickInEditor = false;     // Editor Tick을 수행 여부
 
+    bool bRegisteredForTick = false;    // TickTaskManager에 등록 여부
+
+    ETickingGroup TickGroup = TG_PrePhysics;
+
     bool bHidden = false;
     
 public:
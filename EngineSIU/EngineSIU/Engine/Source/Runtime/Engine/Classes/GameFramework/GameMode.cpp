@@ -58,17 +58,12 @@ void AGameMode::InitializeComponent()
     //RootComponent = this->AddComponent<USceneComponent>("USceneComponent_0");
 }
 
-UObject* AGameMode::Duplicate(UObject* InOuter)
+void AGameMode::Serialize(FArchive& Ar)
 {
-    AGameMode* NewActor = Cast<AGameMode>(Super::Duplicate(InOuter));
+    Super::Serialize(Ar);
 
-    if (NewActor)
-    {
-        NewActor->bGameRunning = bGameRunning;
-        NewActor->bGameEnded = bGameEnded;
-        NewActor->GameInfo = GameInfo;
-    }
-    return NewActor;
+    Ar << bGameRunning << bGameEnded;
+    Ar.Serialize(GameInfo);
 }
 
 
@@ -97,7 +92,10 @@ void AGameMode::StartMatch()
     // GEngine->ActiveWorld->GetMainPlayer()->SetActorLocation(FVector(0, 0, 10));
     GEngine->ActiveWorld->GetPlayerController()->Possess(GEngine->ActiveWorld->GetMainPlayer());
     
-    FSoundManager::GetInstance().PlaySound("fishdream");
+    FSoundPlayParams Params;
+    Params.Category = ESoundCategory::Music;
+    Params.Priority = 10;
+    FSoundManager::GetInstance().PlaySound("fishdream", Params);
     OnGameStart.Broadcast();
 }
 
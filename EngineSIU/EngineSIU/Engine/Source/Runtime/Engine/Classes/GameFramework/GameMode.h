@@ -22,7 +22,7 @@ public:
     AGameMode();
     virtual ~AGameMode() override;
     void InitializeComponent();
-    UObject* Duplicate(UObject* InOuter) override;
+    void Serialize(FArchive& Ar) override;
 
     //virtual void BeginPlay() override;
     //virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
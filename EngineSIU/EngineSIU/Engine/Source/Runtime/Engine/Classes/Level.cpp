@@ -1,6 +1,8 @@
 #include "Level.h"
 #include "GameFramework/Actor.h"
 #include "UObject/Casts.h"
+#include "World/World.h"
+#include "World/WorldSnapshot.h"
 
 
 void ULevel::InitLevel(UWorld* InOwningWorld)
@@ -28,12 +30,17 @@ UObject* ULevel::Duplicate(UObject* InOuter)
 {
     ThisClass* NewLevel = Cast<ThisClass>(Super::Duplicate(InOuter));
 
-    NewLevel->OwningWorld = OwningWorld;
-
     for (AActor* Actor : Actors)
     {
-        NewLevel->Actors.Emplace(static_cast<AActor*>(Actor->Duplicate(InOuter)));
+        NewLevel->Actors.Emplace(FWorldSnapshot::DuplicateActor(Actor, InOuter));
     }
 
     return NewLevel;
 }
+
+void ULevel::Serialize(FArchive& Ar)
+{
+    Super::Serialize(Ar);
+
+    Ar << OwningWorld;
+}
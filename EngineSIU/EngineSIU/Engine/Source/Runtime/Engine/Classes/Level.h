@@ -17,6 +17,7 @@ public:
     void Release();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     TArray<AActor*> Actors;
     UWorld* OwningWorld;
@@ -1,6 +1,7 @@
 #include "ParticleModuleAcceleration.h"
 #include "Engine/ParticleHelper.h"
 #include "Engine/ParticleEmitterInstance.h"
+#include "Engine/ParticleSoAData.h"
 #include "Particles/ParticleSystemComponent.h"
 
 UParticleModuleAcceleration::UParticleModuleAcceleration()
@@ -31,3 +32,8 @@ void UParticleModuleAcceleration::FinalUpdate(FParticleEmitterInstance* Owner, i
 
     END_UPDATE_LOOP
 }
+
+void UParticleModuleAcceleration::FinalUpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& Data, float DeltaTime)
+{
+    ParticleSoAKernels::AddBaseVelocity(Data, Acceleration * DeltaTime);
+}
@@ -11,6 +11,9 @@ public:
 
     virtual void FinalUpdate(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
 
+    virtual bool SupportsSoAUpdate() const override { return true; }
+    virtual void FinalUpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& Data, float DeltaTime) override;
+
     UPROPERTY_WITH_FLAGS(EditAnywhere, FVector, Acceleration)
 };
 
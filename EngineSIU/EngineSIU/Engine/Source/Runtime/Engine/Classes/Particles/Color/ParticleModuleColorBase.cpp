@@ -17,7 +17,10 @@ UParticleModuleColorBase::UParticleModuleColorBase()
 
 void UParticleModuleColorBase::Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase)
 {
-    ParticleBase->Color = FLinearColor(StartColor.GetValue(), StartAlpha.GetValue());
+    // 인자 평가 순서에 따라 결과가 달라지지 않도록 순서대로 뽑음
+    const FVector Color = StartColor.GetValue(Owner->RandomStream);
+    const float Alpha = StartAlpha.GetValue(Owner->RandomStream);
+    ParticleBase->Color = FLinearColor(Color, Alpha);
 }
 
 void UParticleModuleColorBase::DisplayProperty()
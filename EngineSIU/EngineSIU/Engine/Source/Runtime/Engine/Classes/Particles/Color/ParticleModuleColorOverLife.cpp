@@ -2,6 +2,7 @@
 
 #include "ParticleEmitterInstance.h"
 #include "ParticleHelper.h"
+#include "ParticleSoAData.h"
 
 UParticleModuleColorOverLife::UParticleModuleColorOverLife()
 {
@@ -46,6 +47,11 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
     
 }
 
+void UParticleModuleColorOverLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& Data, float DeltaTime)
+{
+    ParticleSoAKernels::LerpColorOverLife(Data, FLinearColor(ColorOverLife.MaxValue, AlphaOverLife.MaxValue));
+}
+
 void UParticleModuleColorOverLife::DisplayProperty()
 {
     Super::DisplayProperty();
@@ -31,8 +31,8 @@ void UParticleModuleLocation::DisplayProperty()
 
 void UParticleModuleLocation::Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase)
 {
-    FVector Location = StartLocation.GetValue();
-    FVector OffsetLocation = LocationOffset.GetValue();
+    FVector Location = StartLocation.GetValue(Owner->RandomStream);
+    FVector OffsetLocation = LocationOffset.GetValue(Owner->RandomStream);
 
     Location += OffsetLocation;
 
@@ -1,6 +1,7 @@
 #include "ParticleModuleLifeTime.h"
 
 #include "ParticleHelper.h"
+#include "ParticleEmitterInstance.h"
 
 UParticleModuleLifeTime::UParticleModuleLifeTime()
 {
@@ -15,7 +16,7 @@ UParticleModuleLifeTime::UParticleModuleLifeTime()
 
 void UParticleModuleLifeTime::Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase)
 {
-    float Lifetime = FMath::Max(0.0f, LifeSpan.GetValue());
+    float Lifetime = FMath::Max(0.0f, LifeSpan.GetValue(Owner->RandomStream));
 
     if (Lifetime > KINDA_SMALL_NUMBER)
     {
@@ -41,6 +41,9 @@ public:
 
 public:
     UPROPERTY_WITH_FLAGS(EditAnywhere, FName, EmitterName, = "Default")
+
+    /** 모든 Update 모듈이 지원한다면 파티클을 SoA 레이아웃으로 저장하고 SIMD Kernel로 갱신 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, bool, bUseSoALayout, = false)
     int32 PeakActiveParticles = 0;
 
     // Below is information udpated by calling CacheEmitterModuleInfo
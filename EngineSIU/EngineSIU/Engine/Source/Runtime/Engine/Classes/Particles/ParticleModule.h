@@ -4,6 +4,7 @@
 
 struct FBaseParticle;
 struct FParticleEmitterInstance;
+class FParticleSoAData;
 
 enum class EModuleType : uint8
 {
@@ -73,6 +74,22 @@ public:
      *	@param	DeltaTime	The time since the last update.
      */
     virtual void FinalUpdate(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime);
+
+    /**
+     *	SoA 레이아웃을 사용하는 Emitter에서 Update/FinalUpdate 대신 UpdateSoA/FinalUpdateSoA를 호출할 수 있는지 여부
+     *	Update가 필요 없는 모듈은 항상 true이고, Update가 있는 모듈은 SoA 버전을 구현했을 때 true를 반환해야 합니다.
+     */
+    virtual bool SupportsSoAUpdate() const { return !bUpdateModule && !bFinalUpdateModule; }
+
+    /**
+     *	SoA 레이아웃의 Stream 전체를 한 번에 갱신합니다.
+     *	
+     *	@param	Owner		The FParticleEmitterInstance that 'owns' the particle.
+     *	@param	Data		The particle streams of the owner.
+     *	@param	DeltaTime	The time since the last update.
+     */
+    virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& Data, float DeltaTime) {}
+    virtual void FinalUpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& Data, float DeltaTime) {}
     
     virtual EModuleType	GetModuleType() const { return EModuleType::EPMT_General; }
 
@@ -74,13 +74,18 @@ FParticleRequiredModule* UParticleModuleRequired::CreateRendererResource()
 {
     FParticleRequiredModule* FReqMod = new FParticleRequiredModule();
 
-    GenerateSubUVFrameData(FReqMod);
+    UpdateRendererResource(FReqMod);
 
-    SetupCutoutGeometryData(FReqMod);
+    return FReqMod;
+}
 
-    SetupMotionBlurFlag(FReqMod);
+void UParticleModuleRequired::UpdateRendererResource(FParticleRequiredModule* OutData) const
+{
+    GenerateSubUVFrameData(OutData);
 
-    return FReqMod;
+    SetupCutoutGeometryData(OutData);
+
+    SetupMotionBlurFlag(OutData);
 }
 
 void UParticleModuleRequired::GenerateSubUVFrameData(FParticleRequiredModule* OutData) const
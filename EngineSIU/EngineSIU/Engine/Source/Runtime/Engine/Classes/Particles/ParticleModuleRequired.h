@@ -38,6 +38,9 @@ public:
 public:
     FParticleRequiredModule* CreateRendererResource();
 
+    /** 이미 만들어진 렌더러 리소스를 현재 설정으로 다시 채웁니다. 매 프레임 새로 할당하지 않기 위해 사용합니다. */
+    void UpdateRendererResource(FParticleRequiredModule* OutData) const;
+
     void GenerateSubUVFrameData(FParticleRequiredModule* OutData) const;
     void SetupCutoutGeometryData(FParticleRequiredModule* OutData) const;
     void SetupMotionBlurFlag(FParticleRequiredModule* OutData) const;
@@ -4,16 +4,28 @@
 #include "Particles/ParticleSystem.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "ParticleEmitter.h"
+#include "Async/JobSystem.h"
+#include "Stats/Stats.h"
 
 UParticleSystemComponent::UParticleSystemComponent()
     : AccumTickTime(0.f)
     , Template(nullptr)
 {
+    // Emitter 시뮬레이션은 컴포넌트가 소유한 Instance만 갱신하므로 병렬로 Tick
+    bRunTickOnAnyThread = true;
 }
 
-UObject* UParticleSystemComponent::Duplicate(UObject* InOuter)
+void UParticleSystemComponent::Serialize(FArchive& Ar)
 {
-    return nullptr;
+    Super::Serialize(Ar);
+
+    // Template은 공유 에셋이라 포인터만 가져가고, Emitter 인스턴스는 복제본의 InitializeComponent에서 새로 만듦
+    UParticleSystem* System = Template;
+    Ar << System << RandomSeed;
+    if (Ar.IsLoading())
+    {
+        Template = System;
+    }
 }
 
 void UParticleSystemComponent::InitializeComponent()
@@ -39,15 +51,24 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
     {
         EmitterInstances.Empty();
         InitializeSystem();
+
+        // EmitterIndex가 바뀌었으므로 재사용하던 데이터도 버림
+        ParticleDynamicData = nullptr;
+        for (FParticleDynamicData& Buffer : DynamicDataBuffers)
+        {
+            Buffer.ReleaseEmitterDataPool();
+        }
     }
 
-    for (auto* Instance : EmitterInstances)
+    // Emitter는 각자의 파티클 데이터와 난수 생성기만 사용하므로 병렬로 Tick
+    FJobSystem::Get().ParallelFor(EmitterInstances.Num(), [this, DeltaTime](int32 Index)
     {
-        if (Instance)
+        QUICK_SCOPE_CYCLE_COUNTER(ParticleEmitterTick)
+        if (FParticleEmitterInstance* Instance = EmitterInstances[Index])
         {
             Instance->Tick(DeltaTime);
         }
-    }
+    }, 1);
 
     UpdateDynamicData();
 }
@@ -84,6 +105,7 @@ void UParticleSystemComponent::CreateAndAddSpriteEmitterInstance(UParticleEmitte
         FParticleSpriteEmitterInstance* Instance = new FParticleSpriteEmitterInstance();
         Instance->SpriteTemplate = EmitterTemplate;
         Instance->Component = this;
+        Instance->EmitterIndex = EmitterInstances.Num();
         Instance->CurrentLODLevelIndex = 0;
 
         Instance->Initialize();
@@ -99,6 +121,7 @@ void UParticleSystemComponent::CreateAndAddMeshEmitterInstance(UParticleEmitter*
         FParticleMeshEmitterInstance* Instance = new FParticleMeshEmitterInstance();
         Instance->SpriteTemplate = EmitterTemplate;
         Instance->Component = this;
+        Instance->EmitterIndex = EmitterInstances.Num();
         Instance->CurrentLODLevelIndex = 0;
 
         Instance->Initialize();
@@ -110,11 +133,22 @@ void UParticleSystemComponent::CreateAndAddMeshEmitterInstance(UParticleEmitter*
 void UParticleSystemComponent::UpdateDynamicData()
 {
     // Create the dynamic data for rendering this particle system
-    ParticleDynamicData = CreateDynamicData();
+    FParticleDynamicData& WriteBuffer = DynamicDataBuffers[DynamicDataWriteIndex];
+    if (FillDynamicData(WriteBuffer))
+    {
+        ParticleDynamicData = &WriteBuffer;
+        DynamicDataWriteIndex = 1 - DynamicDataWriteIndex;
+    }
+    else
+    {
+        ParticleDynamicData = nullptr;
+    }
 }
 
-FParticleDynamicData* UParticleSystemComponent::CreateDynamicData()
+bool UParticleSystemComponent::FillDynamicData(FParticleDynamicData& OutData)
 {
+    OutData.ClearEmitterDataArray();
+
     if (EmitterInstances.Num() > 0)
     {
         int32 LiveCount = 0;
@@ -132,20 +166,17 @@ FParticleDynamicData* UParticleSystemComponent::CreateDynamicData()
 
         if (LiveCount == 0)
         {
-            return nullptr;
+            return false;
         }
     }
 
-    FParticleDynamicData* ParticleDynamicData = new FParticleDynamicData();
-
     if (Template)
     {
-        ParticleDynamicData->SystemPositionForMacroUVs = GetComponentTransform().TransformPosition(Template->GetMacroUVPosition());
-        ParticleDynamicData->SystemRadiusForMacroUVs = Template->GetMacroUVRadius();
+        OutData.SystemPositionForMacroUVs = GetComponentTransform().TransformPosition(Template->GetMacroUVPosition());
+        OutData.SystemRadiusForMacroUVs = Template->GetMacroUVRadius();
     }
 
-    ParticleDynamicData->DynamicEmitterDataArray.Empty();
-    ParticleDynamicData->DynamicEmitterDataArray.Reserve(EmitterInstances.Num());
+    OutData.DynamicEmitterDataArray.Reserve(EmitterInstances.Num());
 
     for (int32 EmitterIndex = 0; EmitterIndex < EmitterInstances.Num(); EmitterIndex++)
     {
@@ -154,17 +185,20 @@ FParticleDynamicData* UParticleSystemComponent::CreateDynamicData()
 
         if (EmitterInst)
         {
-            NewDynamicEmitterData = EmitterInst->GetDynamicData(true);
+            FDynamicEmitterDataBase* PooledData = OutData.GetPooledEmitterData(EmitterIndex);
+            NewDynamicEmitterData = EmitterInst->GetDynamicData(true, PooledData);
 
             if (NewDynamicEmitterData != nullptr)
             {
-                ParticleDynamicData->DynamicEmitterDataArray.Add(NewDynamicEmitterData);
+                // 타입이 달라 새로 할당되었다면 Pool의 이전 데이터는 해제됨
+                OutData.SetPooledEmitterData(EmitterIndex, NewDynamicEmitterData);
+                OutData.DynamicEmitterDataArray.Add(NewDynamicEmitterData);
                 NewDynamicEmitterData->EmitterIndex = EmitterIndex;
             }
         }
     }
 
-    return ParticleDynamicData;
+    return true;
 }
 
 void UParticleSystemComponent::ReBuildInstancesMemoryLayout()
@@ -1,9 +1,9 @@
 #pragma once
+#include "ParticleHelper.h"
 #include "Components/PrimitiveComponent.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
-class FParticleDynamicData;
 class UParticleSystem;
 class UParticleEmitter;
 struct FParticleEmitterInstance;
@@ -26,7 +26,7 @@ public:
     UParticleSystemComponent();
     virtual ~UParticleSystemComponent() override = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
 
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
@@ -40,7 +40,12 @@ public:
     void CreateAndAddMeshEmitterInstance(UParticleEmitter* EmitterTemplate);
 
     void UpdateDynamicData();
-    FParticleDynamicData* CreateDynamicData();
+
+    /**
+     * 현재 Emitter들의 상태로 OutData를 채웁니다. OutData가 이전에 가지고 있던 Emitter 데이터는 재사용됩니다.
+     * @return 렌더링할 파티클이 하나도 없다면 false
+     */
+    bool FillDynamicData(FParticleDynamicData& OutData);
 
     UParticleSystem* GetParticleSystem() const { return Template; }
     void SetParticleSystem(UParticleSystem* InParticleSystem) { Template = InParticleSystem; }
@@ -50,13 +55,22 @@ public:
     void ReBuildInstancesMemoryLayout();
 public:
     float AccumTickTime;
+
+    /** Emitter별 난수 생성기의 Seed, 같은 값이면 같은 입력에 대해 같은 시뮬레이션 결과가 나옴 */
+    UPROPERTY_WITH_FLAGS(EditAnywhere, int32, RandomSeed, = 0)
     
 private:
     TArray<FParticleEmitterInstance*> EmitterInstances;
 
     UPROPERTY_WITH_FLAGS(EditAnywhere,UParticleSystem*, Template)
 
-    TArray<FDynamicEmitterDataBase*> EmitterRenderData;
+    /**
+     * 렌더링 데이터는 두 버퍼를 번갈아 채웁니다.
+     * 렌더러가 읽는 버퍼를 덮어쓰지 않으면서도, 각 버퍼는 이전에 할당한 Emitter 데이터를 계속 재사용합니다.
+     */
+    FParticleDynamicData DynamicDataBuffers[2];
+    int32 DynamicDataWriteIndex = 0;
 
+    /** 마지막으로 채워진 버퍼, 렌더링할 것이 없다면 nullptr */
     FParticleDynamicData* ParticleDynamicData = nullptr;
 };
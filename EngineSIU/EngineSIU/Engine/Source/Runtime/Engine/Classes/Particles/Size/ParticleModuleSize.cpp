@@ -43,12 +43,12 @@ void UParticleModuleSize::Spawn(FParticleEmitterInstance* Owner, int32 Offset, f
         StartSize.MaxValue = FVector(MaxValue, MaxValue, MaxValue);
         /////////////////////////////////////////////
 
-        InitialSize = StartSize.GetValue();
+        InitialSize = StartSize.GetValue(Owner->RandomStream);
         InitialSize = FVector(InitialSize.X, InitialSize.X, InitialSize.X);
     }
     else
     {
-        InitialSize = StartSize.GetValue();
+        InitialSize = StartSize.GetValue(Owner->RandomStream);
     }
 
     ParticleBase->BaseSize = InitialSize;
@@ -101,7 +101,7 @@ int UParticleModuleSubUV::DetermineImageIndex(
     {
         if (bRandomMode)
         {
-            ImageIndex = static_cast<int>(SubImageIndex.GetValue());
+            ImageIndex = static_cast<int>(SubImageIndex.GetValue(Owner->RandomStream));
         }
         else
         {
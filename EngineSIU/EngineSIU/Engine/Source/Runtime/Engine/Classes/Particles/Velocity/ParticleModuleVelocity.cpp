@@ -28,8 +28,8 @@ void UParticleModuleVelocity::DisplayProperty()
 
 void UParticleModuleVelocity::Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase)
 {
-    FVector Velocity = StartVelocity.GetValue();
-    float RadialStrength = StartVelocityRadial.GetValue();
+    FVector Velocity = StartVelocity.GetValue(Owner->RandomStream);
+    float RadialStrength = StartVelocityRadial.GetValue(Owner->RandomStream);
 
     if (!FMath::IsNearlyZero(RadialStrength))
     {
@@ -1,6 +1,7 @@
 #include "ParticleModuleVelocityOverLife.h"
 #include "Engine/ParticleHelper.h"
 #include "Engine/ParticleEmitterInstance.h"
+#include "Engine/ParticleSoAData.h"
 #include "Particles/ParticleSystemComponent.h"
 
 UParticleModuleVelocityOverLife::UParticleModuleVelocityOverLife()
@@ -95,3 +96,24 @@ void UParticleModuleVelocityOverLife::Update(FParticleEmitterInstance* Owner, in
             
     END_UPDATE_LOOP
 }
+
+void UParticleModuleVelocityOverLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& Data, float DeltaTime)
+{
+    if (!Owner || !Owner->Component)
+    {
+        return;
+    }
+
+    const FTransform ComponentToWorld = Owner->Component->GetComponentToWorld();
+    const FTransform* Transform = bInWorldSpace ? &ComponentToWorld : nullptr;
+    FVector Scale = bApplyOwnerScale ? ComponentToWorld.GetScale3D() : FVector::OneVector;
+
+    // 두 옵션이 모두 꺼져 있으면 AoS 경로와 같이 속도가 0이 됨
+    if (!bUseConstantChange && !bUseVelocityCurve)
+    {
+        Scale = FVector::ZeroVector;
+    }
+
+    const float CurveExponent = bUseConstantChange ? 0.0f : CurveScale;
+    ParticleSoAKernels::LerpVelocityOverLife(Data, EndVelocity, CurveExponent, Transform, Scale);
+}
@@ -19,6 +19,10 @@ public:
 
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
 
+    /** SoA 레이아웃에서는 Payload 대신 Spawn 시점의 속도 Stream을 초기 속도로 사용 */
+    virtual bool SupportsSoAUpdate() const override { return true; }
+    virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& Data, float DeltaTime) override;
+
     UPROPERTY_WITH_FLAGS(EditAnywhere, bool, bUseConstantChange)
     UPROPERTY_WITH_FLAGS(EditAnywhere, bool, bUseVelocityCurve)
 
@@ -8,6 +8,7 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Particles/Spawn/ParticleModuleSpawn.h"
 #include "UObject/Casts.h"
+#include "Async/JobSystem.h"
 
 #include "Engine/FObjLoader.h"
 //#include "Particles/ParticleModuleRequired.h"
@@ -38,11 +39,23 @@ void FParticleEmitterInstance::Initialize()
     AccumulatedTime = 0.0f;
     SpawnFraction = 0.0f;
 
+    const uint32 ComponentSeed = Component ? static_cast<uint32>(Component->RandomSeed) : 0;
+    std::seed_seq Seed{ ComponentSeed, static_cast<uint32>(EmitterIndex) };
+    RandomStream.seed(Seed);
+
     bEnabled = true;
 }
 
 void FParticleEmitterInstance::Tick(float DeltaTime)
 {
+    // 에디터에서 레이아웃 옵션이 바뀌었다면 다시 구성
+    const bool bWantSoALayout = SpriteTemplate->bUseSoALayout && CanUseSoALayout();
+    if (bWantSoALayout != bUseSoALayout)
+    {
+        AllKillParticles();
+        SetSoALayoutEnabled(bWantSoALayout);
+    }
+
     AccumulatedTime += DeltaTime;
     CurrentTimeForBurst += DeltaTime;
 
@@ -89,6 +102,13 @@ void FParticleEmitterInstance::SpawnParticles(
 
         float Interp = (Count > 1) ? (float)i / (float)(Count - 1) : 0.f;
         PostSpawn(Particle, Interp, SpawnTime);
+
+        if (bUseSoALayout)
+        {
+            // ParticleData의 슬롯은 Spawn 작업 공간으로만 쓰고 실제 파티클은 Stream에 저장
+            SoAData.AddParticle(*Particle);
+            ActiveParticles = SoAData.Num();
+        }
     }
 }
 
@@ -99,6 +119,13 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
         return;
     }
 
+    if (bUseSoALayout)
+    {
+        SoAData.KillParticle(Index);
+        ActiveParticles = SoAData.Num();
+        return;
+    }
+
     int32 LastIndex = ActiveParticles - 1;
     if (Index != LastIndex)
     {
@@ -140,8 +167,8 @@ int32 FParticleEmitterInstance::CalculateSpawnCount(float DeltaTime)
     }
     else
     {
-        float Rate = CurrentLODLevel->SpawnModule->Rate.GetValue();
-        float RateScale = CurrentLODLevel->SpawnModule->RateScale.GetValue();
+        float Rate = CurrentLODLevel->SpawnModule->Rate.GetValue(RandomStream);
+        float RateScale = CurrentLODLevel->SpawnModule->RateScale.GetValue(RandomStream);
 
         Rate *= RateScale;
 
@@ -194,6 +221,19 @@ void FParticleEmitterInstance::UpdateModules(float DeltaTime)
             continue;
         }
 
+        if (bUseSoALayout)
+        {
+            if (Module->bUpdateModule)
+            {
+                Module->UpdateSoA(this, SoAData, DeltaTime);
+            }
+            if (Module->bFinalUpdateModule)
+            {
+                Module->FinalUpdateSoA(this, SoAData, DeltaTime);
+            }
+            continue;
+        }
+
         if (Module->bUpdateModule)
         {
             int32 Offset = Module->GetInstancePayloadSize();
@@ -210,6 +250,13 @@ void FParticleEmitterInstance::UpdateModules(float DeltaTime)
 
 void FParticleEmitterInstance::AllKillParticles()
 {
+    if (bUseSoALayout)
+    {
+        SoAData.KillAllParticles();
+        ActiveParticles = 0;
+        return;
+    }
+
     for (int32 i = ActiveParticles - 1; i >= 0; i--)
     {
         KillParticle(i);
@@ -237,6 +284,33 @@ void FParticleEmitterInstance::BuildMemoryLayout()
     }
 
     ParticleStride = ParticleSize;
+
+    SetSoALayoutEnabled(SpriteTemplate->bUseSoALayout && CanUseSoALayout());
+}
+
+void FParticleEmitterInstance::SetSoALayoutEnabled(bool bEnable)
+{
+    bUseSoALayout = bEnable;
+    if (bUseSoALayout)
+    {
+        SoAData.Allocate(MaxActiveParticles, ParticleStride - static_cast<int32>(sizeof(FBaseParticle)));
+    }
+    else
+    {
+        SoAData.Free();
+    }
+}
+
+bool FParticleEmitterInstance::CanUseSoALayout() const
+{
+    for (const UParticleModule* Module : CurrentLODLevel->GetModules())
+    {
+        if (Module->bEnabled && !Module->SupportsSoAUpdate())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool FParticleEmitterInstance::IsDynamicDataRequired()
@@ -261,18 +335,47 @@ bool FParticleEmitterInstance::IsDynamicDataRequired()
 
 void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 {
-    for (int32 i = 0; i < ActiveParticles; i++)
+    if (bUseSoALayout)
+    {
+        // ParticleUpdateGrainSize가 4의 배수이므로 각 구간의 시작도 SIMD 단위에 맞춰짐
+        FJobSystem::Get().ParallelForRange(SoAData.GetNumSimd(), [this, DeltaTime](int32 StartIndex, int32 EndIndex)
+        {
+            ParticleSoAKernels::UpdateParticles(SoAData, DeltaTime, StartIndex, EndIndex);
+        }, ParticleUpdateGrainSize);
+        ParticleSoAKernels::KillExpiredParticles(SoAData);
+        ActiveParticles = SoAData.Num();
+        return;
+    }
+
+    // 파티클이 많다면 구간을 나누어 병렬로 갱신하고, 수명이 끝난 파티클은 끝난 뒤 한 번에 제거
+    FJobSystem::Get().ParallelForRange(ActiveParticles, [this, DeltaTime](int32 StartIndex, int32 EndIndex)
+    {
+        UpdateParticleRange(StartIndex, EndIndex, DeltaTime);
+    }, ParticleUpdateGrainSize);
+
+    // 뒤에서부터 제거하면 당겨오는 마지막 파티클은 이미 살아있음이 확인된 파티클
+    for (int32 i = ActiveParticles - 1; i >= 0; i--)
+    {
+        DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * i)
+        if (Particle->RelativeTime >= 1.0f)
+        {
+            KillParticle(i);
+        }
+    }
+}
+
+void FParticleEmitterInstance::UpdateParticleRange(int32 StartIndex, int32 EndIndex, float DeltaTime)
+{
+    for (int32 i = StartIndex; i < EndIndex; i++)
     {
         DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * i)
 
         // 상대 시간 업데이트
         Particle->RelativeTime += DeltaTime * Particle->OneOverMaxLifetime;
 
-        // 수명 종료 판단
+        // 수명이 끝난 파티클은 UpdateParticles에서 제거
         if (Particle->RelativeTime >= 1.0f)
         {
-            KillParticle(i);
-            i--; // 마지막 인덱스를 앞으로 복사했으므로 인덱스 유지
             continue;
         }
 
@@ -322,6 +425,12 @@ bool FParticleEmitterInstance::FillReplayData(FDynamicEmitterReplayDataBase& Out
         OutData.Scale = FVector(Component->GetComponentTransform().GetScale3D());
     }
 
+    if (bUseSoALayout)
+    {
+        // 렌더링은 FBaseParticle 레이아웃을 사용하므로 Stream을 모아서 넘김
+        SoAData.CopyToParticleData(ParticleData, ParticleStride);
+    }
+
     int32 ParticleMemSize = MaxActiveParticles * ParticleStride;
     OutData.DataContainer.Alloc(ParticleMemSize, MaxActiveParticles);
 
@@ -352,7 +461,7 @@ uint32 FParticleEmitterInstance::GetModuleDataOffset(UParticleModule* Module)
 
 
 //////////////////////// SpriteEmitter
-FDynamicEmitterDataBase* FParticleSpriteEmitterInstance::GetDynamicData(bool bSelected)
+FDynamicEmitterDataBase* FParticleSpriteEmitterInstance::GetDynamicData(bool bSelected, FDynamicEmitterDataBase* ExistingData)
 {
     // It is valid for the LOD level to be NULL here!
     if (IsDynamicDataRequired() == false || !bEnabled)
@@ -360,13 +469,21 @@ FDynamicEmitterDataBase* FParticleSpriteEmitterInstance::GetDynamicData(bool bSe
         return nullptr;
     }
 
-    // Allocate the dynamic data
-    FDynamicSpriteEmitterData* NewEmitterData = new FDynamicSpriteEmitterData(CurrentLODLevel->RequiredModule);
+    // 이전 프레임의 데이터가 있다면 재사용하고, 없을 때만 할당
+    FDynamicSpriteEmitterData* NewEmitterData = dynamic_cast<FDynamicSpriteEmitterData*>(ExistingData);
+    const bool bAllocated = NewEmitterData == nullptr;
+    if (bAllocated)
+    {
+        NewEmitterData = new FDynamicSpriteEmitterData(CurrentLODLevel->RequiredModule);
+    }
 
     // Now fill in the source data
     if(!FillReplayData( NewEmitterData->Source ) )
     {
-        delete NewEmitterData;
+        if (bAllocated)
+        {
+            delete NewEmitterData;
+        }
         return nullptr;
     }
 
@@ -395,8 +512,14 @@ bool FParticleSpriteEmitterInstance::FillReplayData(FDynamicEmitterReplayDataBas
     FDynamicSpriteEmitterReplayDataBase* NewReplayData = dynamic_cast< FDynamicSpriteEmitterReplayDataBase* >( &OutData );
 
     NewReplayData->MaterialInterface = CurrentLODLevel->RequiredModule->MaterialInterface;
-    NewReplayData->RequiredModule = CurrentLODLevel->RequiredModule->CreateRendererResource();
-    NewReplayData->MaterialInterface = CurrentLODLevel->RequiredModule->MaterialInterface;
+    if (NewReplayData->RequiredModule)
+    {
+        CurrentLODLevel->RequiredModule->UpdateRendererResource(NewReplayData->RequiredModule);
+    }
+    else
+    {
+        NewReplayData->RequiredModule = CurrentLODLevel->RequiredModule->CreateRendererResource();
+    }
     
     // NewReplayData->InvDeltaSeconds = (LastDeltaTime > KINDA_SMALL_NUMBER) ? (1.0f / LastDeltaTime) : 0.0f;
     // NewReplayData->LWCTile = ((Component == nullptr) || CurrentLODLevel->RequiredModule->bUseLocalSpace) ? FVector::Zero() : Component->GetLWCTile();
@@ -453,7 +576,7 @@ bool FParticleSpriteEmitterInstance::FillReplayData(FDynamicEmitterReplayDataBas
     return true;
 }
 
-FDynamicEmitterDataBase* FParticleMeshEmitterInstance::GetDynamicData(bool bSelected)
+FDynamicEmitterDataBase* FParticleMeshEmitterInstance::GetDynamicData(bool bSelected, FDynamicEmitterDataBase* ExistingData)
 {
     // It is valid for the LOD level to be NULL here!
     if (IsDynamicDataRequired() == false || !bEnabled)
@@ -461,18 +584,29 @@ FDynamicEmitterDataBase* FParticleMeshEmitterInstance::GetDynamicData(bool bSele
         return nullptr;
     }
 
-    // Allocate the dynamic data
-    FDynamicMeshEmitterData* NewEmitterData = new FDynamicMeshEmitterData(CurrentLODLevel->RequiredModule);
+    // 이전 프레임의 데이터가 있다면 재사용하고, 없을 때만 할당
+    FDynamicMeshEmitterData* NewEmitterData = dynamic_cast<FDynamicMeshEmitterData*>(ExistingData);
+    const bool bAllocated = NewEmitterData == nullptr;
+    if (bAllocated)
+    {
+        NewEmitterData = new FDynamicMeshEmitterData(CurrentLODLevel->RequiredModule);
+    }
 
     // Now fill in the source data
     if (!FillReplayData(NewEmitterData->Source))
     {
-        delete NewEmitterData;
+        if (bAllocated)
+        {
+            delete NewEmitterData;
+        }
         return nullptr;
     }
 
     // Setup dynamic render data.  Only call this AFTER filling in source data for the emitter.
-    NewEmitterData->StaticMesh = FObjManager::CreateStaticMesh("Contents/Cube/cube-tex.obj");
+    if (NewEmitterData->StaticMesh == nullptr)
+    {
+        NewEmitterData->StaticMesh = FObjManager::CreateStaticMesh("Contents/Cube/cube-tex.obj");
+    }
 
     return NewEmitterData;
 }
@@ -496,8 +630,14 @@ bool FParticleMeshEmitterInstance::FillReplayData(FDynamicEmitterReplayDataBase&
     FDynamicMeshEmitterReplayData* NewReplayData = dynamic_cast<FDynamicMeshEmitterReplayData*>(&OutData);
 
     NewReplayData->MaterialInterface = CurrentLODLevel->RequiredModule->MaterialInterface;
-    NewReplayData->RequiredModule = CurrentLODLevel->RequiredModule->CreateRendererResource();
-    NewReplayData->MaterialInterface = CurrentLODLevel->RequiredModule->MaterialInterface;
+    if (NewReplayData->RequiredModule)
+    {
+        CurrentLODLevel->RequiredModule->UpdateRendererResource(NewReplayData->RequiredModule);
+    }
+    else
+    {
+        NewReplayData->RequiredModule = CurrentLODLevel->RequiredModule->CreateRendererResource();
+    }
 
     // NewReplayData->InvDeltaSeconds = (LastDeltaTime > KINDA_SMALL_NUMBER) ? (1.0f / LastDeltaTime) : 0.0f;
     // NewReplayData->LWCTile = ((Component == nullptr) || CurrentLODLevel->RequiredModule->bUseLocalSpace) ? FVector::Zero() : Component->GetLWCTile();
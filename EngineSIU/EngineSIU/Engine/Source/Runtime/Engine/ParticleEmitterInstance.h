@@ -1,6 +1,9 @@
 #pragma once
+#include <random>
+
 #include "HAL/PlatformType.h"
 #include "ParticleHelper.h"
+#include "ParticleSoAData.h"
 #include "Particles/ParticleModule.h"
 
 class UParticleLODLevel;
@@ -11,10 +14,16 @@ struct DistributionFloat;
 struct FParticleEmitterInstance
 {
 public:
+    /** 기본 갱신을 여러 Job으로 나눌 때 Job 하나가 처리할 파티클 수, SoA Kernel을 위해 4의 배수여야 함 */
+    static constexpr int32 ParticleUpdateGrainSize = 2048;
+
     UParticleEmitter* SpriteTemplate;
 
     UParticleSystemComponent* Component;
 
+    /** Component의 EmitterInstances 안에서의 Index */
+    int32 EmitterIndex = 0;
+
     int32 CurrentLODLevelIndex;
     UParticleLODLevel* CurrentLODLevel;
 
@@ -50,6 +59,19 @@ public:
     DistributionFloat* SpawnRateDistribution;
     float SpawnFraction = 0;
 
+    /**
+     * true라면 파티클은 SoAData에 저장되고, ParticleData는 Spawn 작업 공간과 렌더링용 복사본으로만 사용됩니다.
+     * UParticleEmitter::bUseSoALayout이 켜져 있고 모든 Update 모듈이 SoA를 지원할 때만 사용합니다.
+     */
+    bool bUseSoALayout = false;
+    FParticleSoAData SoAData;
+
+    /**
+     * 이 Emitter의 모듈들이 사용하는 난수 생성기입니다.
+     * Component의 RandomSeed와 EmitterIndex로 Seed를 정하므로, Emitter들이 어느 스레드에서 Tick되더라도 결과가 같습니다.
+     */
+    std::mt19937 RandomStream;
+
 public:
     void Initialize();
 
@@ -63,13 +85,28 @@ public:
     void PreSpawn(FBaseParticle* Particle, const FVector& InitialLocation, const FVector& InitialVelocity);
     void PostSpawn(FBaseParticle* Particle, float Interp, float SpawnTime);
     void UpdateParticles(float DeltaTime);
+
+    /** [StartIndex, EndIndex) 파티클의 기본 갱신, 파티클을 제거하지 않으므로 여러 스레드에서 다른 구간을 동시에 처리할 수 있음 */
+    void UpdateParticleRange(int32 StartIndex, int32 EndIndex, float DeltaTime);
     void UpdateModules(float DeltaTime);
 
     void AllKillParticles();
     void BuildMemoryLayout();
 
+    /** 현재 LOD의 모듈 구성으로 SoA 레이아웃을 사용할 수 있는지 여부 */
+    bool CanUseSoALayout() const;
+
+    /** SoA 레이아웃을 켜거나 끄고 SoAData를 다시 할당합니다. 파티클이 없는 상태에서 호출해야 합니다. */
+    void SetSoALayoutEnabled(bool bEnable);
+
     virtual bool IsDynamicDataRequired();
-    virtual FDynamicEmitterDataBase* GetDynamicData(bool bSelected) { return nullptr; }
+
+    /**
+     * 렌더링에 사용할 Dynamic Data를 채웁니다.
+     * @param ExistingData 이전에 이 Emitter가 반환했던 데이터, 타입이 맞다면 새로 할당하지 않고 다시 채웁니다.
+     * @return 채워진 데이터, ExistingData를 재사용했다면 같은 포인터를 반환합니다. 렌더링할 것이 없다면 nullptr
+     */
+    virtual FDynamicEmitterDataBase* GetDynamicData(bool bSelected, FDynamicEmitterDataBase* ExistingData = nullptr) { return nullptr; }
 
     virtual bool FillReplayData(FDynamicEmitterReplayDataBase& OutData );
     uint32 GetModuleDataOffset(UParticleModule* Module); // TODO: 구현하기
@@ -77,12 +114,12 @@ public:
 
 struct FParticleSpriteEmitterInstance : public FParticleEmitterInstance
 {
-    virtual FDynamicEmitterDataBase* GetDynamicData(bool bSelected) override;
+    virtual FDynamicEmitterDataBase* GetDynamicData(bool bSelected, FDynamicEmitterDataBase* ExistingData = nullptr) override;
     virtual bool FillReplayData(FDynamicEmitterReplayDataBase& OutData ) override;
 };
 
 struct FParticleMeshEmitterInstance : public FParticleEmitterInstance
 {
-    virtual FDynamicEmitterDataBase* GetDynamicData(bool bSelected) override;
+    virtual FDynamicEmitterDataBase* GetDynamicData(bool bSelected, FDynamicEmitterDataBase* ExistingData = nullptr) override;
     virtual bool FillReplayData(FDynamicEmitterReplayDataBase& OutData) override;
 };
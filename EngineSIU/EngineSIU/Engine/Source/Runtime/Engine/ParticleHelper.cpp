@@ -9,7 +9,13 @@ void FParticleDataContainer::Alloc(int32 InParticleDataNumBytes, int32 InParticl
 
     if (MemBlockSize > 0)
     {
-        ParticleData = new uint8[MemBlockSize];
+        // Replay Data는 매 프레임 다시 채워지므로, 기존 블록이 충분히 크다면 그대로 사용
+        if (MemBlockSize > MemBlockCapacity)
+        {
+            delete[] ParticleData;
+            ParticleData = new uint8[MemBlockSize];
+            MemBlockCapacity = MemBlockSize;
+        }
 
         if (ParticleIndicesNumShorts > 0)
         {
@@ -22,7 +28,6 @@ void FParticleDataContainer::Alloc(int32 InParticleDataNumBytes, int32 InParticl
     }
     else
     {
-        ParticleData = nullptr;
         ParticleIndices = nullptr;
     }
 }
@@ -31,12 +36,13 @@ void FParticleDataContainer::Free()
 {
     if (ParticleData)
     {
-        free(ParticleData);
+        delete[] ParticleData;
         ParticleData = nullptr;
         ParticleIndices = nullptr;
     }
     
     MemBlockSize = 0;
+    MemBlockCapacity = 0;
     ParticleDataNumBytes = 0;
     ParticleIndicesNumShorts = 0;
 }
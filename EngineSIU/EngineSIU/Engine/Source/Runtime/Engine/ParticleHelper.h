@@ -198,6 +198,8 @@ enum class EDynamicEmitterType : uint8
 struct FParticleDataContainer
 {
     int32 MemBlockSize;
+    /** 실제로 할당된 블록의 크기, 다음 Alloc이 이 크기 이하라면 블록을 재사용 */
+    int32 MemBlockCapacity;
     int32 ParticleDataNumBytes;
     int32 ParticleIndicesNumShorts;
     uint8* ParticleData; // this is also the memory block we allocated
@@ -205,6 +207,7 @@ struct FParticleDataContainer
 
     FParticleDataContainer()
         : MemBlockSize(0)
+        , MemBlockCapacity(0)
         , ParticleDataNumBytes(0)
         , ParticleIndicesNumShorts(0)
         , ParticleData(nullptr)
@@ -512,6 +515,9 @@ struct FDynamicMeshEmitterData : public FDynamicSpriteEmitterDataBase
 
 /**
  * 각 Emitter Instance의 렌더링 데이터 컨테이너
+ *
+ * Emitter별 데이터는 EmitterDataPool이 소유하며 프레임마다 다시 채워 재사용합니다.
+ * DynamicEmitterDataArray는 이번 프레임에 렌더링할 데이터만 가리킵니다.
  */
 class FParticleDynamicData
 {
@@ -522,24 +528,57 @@ public:
     {
     }
 
-    ~FParticleDynamicData() { ClearEmitterDataArray(); }
+    ~FParticleDynamicData() { ReleaseEmitterDataPool(); }
 
+    FParticleDynamicData(const FParticleDynamicData&) = delete;
+    FParticleDynamicData& operator=(const FParticleDynamicData&) = delete;
+
+    /** 렌더링 목록만 비우며, Pool의 데이터는 다음 프레임에 재사용됩니다. */
     void ClearEmitterDataArray()
     {
-       for (int32 Index = 0; Index < DynamicEmitterDataArray.Num(); Index++)
-       {
-           FDynamicEmitterDataBase* Data = DynamicEmitterDataArray[Index];
-           delete Data;
-       }
         DynamicEmitterDataArray.Empty();
     }
 
+    /** InEmitterIndex의 Emitter가 이전에 사용한 데이터, 없다면 nullptr */
+    FDynamicEmitterDataBase* GetPooledEmitterData(int32 InEmitterIndex) const
+    {
+        return EmitterDataPool.IsValidIndex(InEmitterIndex) ? EmitterDataPool[InEmitterIndex] : nullptr;
+    }
+
+    /** InEmitterIndex 슬롯의 데이터를 교체하고, 이전 데이터가 다르다면 해제합니다. */
+    void SetPooledEmitterData(int32 InEmitterIndex, FDynamicEmitterDataBase* Data)
+    {
+        while (EmitterDataPool.Num() <= InEmitterIndex)
+        {
+            EmitterDataPool.Add(nullptr);
+        }
+
+        if (EmitterDataPool[InEmitterIndex] != Data)
+        {
+            delete EmitterDataPool[InEmitterIndex];
+            EmitterDataPool[InEmitterIndex] = Data;
+        }
+    }
+
+    void ReleaseEmitterDataPool()
+    {
+        DynamicEmitterDataArray.Empty();
+        for (FDynamicEmitterDataBase* Data : EmitterDataPool)
+        {
+            delete Data;
+        }
+        EmitterDataPool.Empty();
+    }
+
     /** The Current Emitter we are rendering */
     uint32 EmitterIndex;
 
     /** Variables */
     TArray<FDynamicEmitterDataBase*> DynamicEmitterDataArray;
 
+    /** EmitterIndex별로 재사용되는 데이터, DynamicEmitterDataArray의 항목은 모두 여기에 속함 */
+    TArray<FDynamicEmitterDataBase*> EmitterDataPool;
+
     /** World space position that UVs generated with the ParticleMacroUV material node will be centered on. */
     FVector SystemPositionForMacroUVs;
 
@@ -0,0 +1,181 @@
+#include "ParticleLayoutBenchmark.h"
+
+#include <cstring>
+
+#include "ParticleHelper.h"
+#include "ParticleSoAData.h"
+#include "Container/Array.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+    /** VelocityOverLife가 첫 프레임의 속도를 저장하는 Payload, 에디터의 파티클과 같은 크기 */
+    constexpr int32 PayloadSize = 16;
+    constexpr int32 ParticleStride = static_cast<int32>(sizeof(FBaseParticle)) + PayloadSize;
+
+    const FVector EndVelocity(0.0f, 0.0f, 50.0f);
+    const FVector Acceleration(0.0f, 0.0f, -9.8f);
+    const FLinearColor TargetColor(1.0f, 0.2f, 0.0f, 0.0f);
+
+    /** Index로 정해지는 파티클, 벤치마크 동안 죽지 않도록 수명을 길게 줌 */
+    void InitParticle(FBaseParticle& Particle, int32 Index)
+    {
+        std::memset(&Particle, 0, ParticleStride);
+
+        const float Offset = static_cast<float>(Index % 1000);
+        Particle.Location = FVector(Offset, Offset * 0.5f, 0.0f);
+        Particle.OldLocation = Particle.Location;
+        Particle.BaseVelocity = FVector(1.0f, 0.0f, 10.0f + Offset * 0.01f);
+        Particle.Velocity = Particle.BaseVelocity;
+        Particle.BaseSize = FVector(1.0f, 1.0f, 1.0f);
+        Particle.Size = Particle.BaseSize;
+        Particle.BaseRotationRate = 0.5f;
+        Particle.BaseColor = FLinearColor(0.0f, 0.5f, 1.0f, 1.0f);
+        Particle.Color = Particle.BaseColor;
+        Particle.RelativeTime = static_cast<float>(Index % 100) * 0.001f;
+        Particle.OneOverMaxLifetime = 1.0f / 1000.0f;
+
+        *reinterpret_cast<FVector*>(reinterpret_cast<uint8*>(&Particle) + sizeof(FBaseParticle)) = Particle.BaseVelocity;
+    }
+
+    /** FParticleEmitterInstance의 AoS 경로와 같은 순서와 계산 */
+    void TickAoS(uint8* ParticleData, int32& ActiveParticles, float DeltaTime)
+    {
+        // UParticleModuleVelocityOverLife::Update (bUseConstantChange)
+        for (int32 i = 0; i < ActiveParticles; ++i)
+        {
+            DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * i)
+            const FVector& InitialVelocity = *reinterpret_cast<const FVector*>(reinterpret_cast<uint8*>(Particle) + sizeof(FBaseParticle));
+            Particle->BaseVelocity = FMath::Lerp(InitialVelocity, EndVelocity, FMath::Clamp(Particle->RelativeTime, 0.0f, 1.0f));
+        }
+
+        // UParticleModuleAcceleration::FinalUpdate
+        const FVector AccelerationDelta = Acceleration * DeltaTime;
+        for (int32 i = 0; i < ActiveParticles; ++i)
+        {
+            DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * i)
+            Particle->BaseVelocity += AccelerationDelta;
+        }
+
+        // UParticleModuleColorOverLife::Update
+        for (int32 i = 0; i < ActiveParticles; ++i)
+        {
+            DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * i)
+            Particle->Color.Lerp(Particle->BaseColor, TargetColor, Particle->RelativeTime);
+        }
+
+        // FParticleEmitterInstance::UpdateParticleRange
+        for (int32 i = 0; i < ActiveParticles; ++i)
+        {
+            DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * i)
+            Particle->RelativeTime += DeltaTime * Particle->OneOverMaxLifetime;
+            if (Particle->RelativeTime >= 1.0f)
+            {
+                continue;
+            }
+
+            Particle->OldLocation = Particle->Location;
+            Particle->Velocity = Particle->BaseVelocity;
+            Particle->Location += Particle->Velocity * DeltaTime;
+            Particle->RotationRate = Particle->BaseRotationRate;
+            Particle->Rotation += Particle->RotationRate * DeltaTime;
+            Particle->Size = Particle->BaseSize;
+        }
+
+        // 수명이 끝난 파티클 제거
+        for (int32 i = ActiveParticles - 1; i >= 0; --i)
+        {
+            DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * i)
+            if (Particle->RelativeTime >= 1.0f)
+            {
+                std::memcpy(Particle, ParticleData + ParticleStride * (ActiveParticles - 1), ParticleStride);
+                --ActiveParticles;
+            }
+        }
+    }
+
+    /** FParticleEmitterInstance의 SoA 경로와 같은 순서와 계산 */
+    void TickSoA(FParticleSoAData& Data, float DeltaTime)
+    {
+        ParticleSoAKernels::LerpVelocityOverLife(Data, EndVelocity, 0.0f, nullptr, FVector(1.0f, 1.0f, 1.0f));
+        ParticleSoAKernels::AddBaseVelocity(Data, Acceleration * DeltaTime);
+        ParticleSoAKernels::LerpColorOverLife(Data, TargetColor);
+        ParticleSoAKernels::UpdateParticles(Data, DeltaTime);
+        ParticleSoAKernels::KillExpiredParticles(Data);
+    }
+
+    bool IsNearlyEqual(const FVector& A, const FVector& B)
+    {
+        // SoA Kernel은 곱셈과 덧셈의 순서가 달라 오차가 누적될 수 있음
+        return (A - B).Length() <= 1.0e-3f * FMath::Max(1.0f, A.Length());
+    }
+}
+
+void FParticleLayoutBenchmark::Run(int32 NumParticles, int32 NumFrames)
+{
+    if (NumParticles <= 0 || NumFrames <= 0)
+    {
+        return;
+    }
+
+    TArray<uint8> AoSData;
+    AoSData.SetNum(NumParticles * ParticleStride);
+    FParticleSoAData SoAData;
+    SoAData.Allocate(NumParticles, PayloadSize);
+
+    for (int32 Index = 0; Index < NumParticles; ++Index)
+    {
+        DECLARE_PARTICLE_PTR(Particle, AoSData.GetData() + ParticleStride * Index)
+        InitParticle(*Particle, Index);
+        SoAData.AddParticle(*Particle);
+    }
+
+    int32 AoSActiveParticles = NumParticles;
+    uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        TickAoS(AoSData.GetData(), AoSActiveParticles, BenchmarkDeltaTime);
+    }
+    const double AoSMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    StartCycles = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        TickSoA(SoAData, BenchmarkDeltaTime);
+    }
+    const double SoAMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    // SoA 결과를 AoS 레이아웃으로 꺼내 비교
+    TArray<uint8> SoAResult;
+    SoAResult.SetNum(SoAData.Num() * ParticleStride);
+    SoAData.CopyToParticleData(SoAResult.GetData(), ParticleStride);
+
+    int32 NumMismatches = SoAData.Num() == AoSActiveParticles ? 0 : 1;
+    for (int32 Index = 0; Index < FMath::Min(SoAData.Num(), AoSActiveParticles); ++Index)
+    {
+        DECLARE_PARTICLE_PTR(Expected, AoSData.GetData() + ParticleStride * Index)
+        DECLARE_PARTICLE_PTR(Actual, SoAResult.GetData() + ParticleStride * Index)
+        const bool bMatches = IsNearlyEqual(Expected->Location, Actual->Location)
+            && IsNearlyEqual(Expected->Velocity, Actual->Velocity)
+            && IsNearlyEqual(FVector(Expected->Color.R, Expected->Color.G, Expected->Color.B), FVector(Actual->Color.R, Actual->Color.G, Actual->Color.B))
+            && FMath::Abs(Expected->RelativeTime - Actual->RelativeTime) <= 1.0e-4f;
+        NumMismatches += bMatches ? 0 : 1;
+    }
+
+    const double NumUpdates = static_cast<double>(NumParticles) * NumFrames;
+    UE_LOG(
+        ELogLevel::Display, TEXT("Particle layout %d particles x %d frames: AoS %.2f ms (%.2f ns/particle), SoA %.2f ms (%.2f ns/particle), x%.2f"),
+        NumParticles, NumFrames, AoSMs, AoSMs * 1.0e6 / NumUpdates, SoAMs, SoAMs * 1.0e6 / NumUpdates, SoAMs > 0.0 ? AoSMs / SoAMs : 0.0
+    );
+    UE_LOG(
+        ELogLevel::Display, TEXT("Particle layout memory: AoS %d bytes/particle, SoA %d bytes/particle"),
+        ParticleStride, static_cast<int32>(sizeof(float) * PS_MAX + sizeof(int32)) + PayloadSize
+    );
+    if (NumMismatches > 0)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Particle layout results differ for %d particles"), NumMismatches);
+    }
+}
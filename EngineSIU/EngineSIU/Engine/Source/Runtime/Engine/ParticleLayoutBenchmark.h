@@ -0,0 +1,15 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 같은 파티클 갱신을 기존 AoS 레이아웃(FBaseParticle + Payload)과 FParticleSoAData에서 실행하여 시간을 비교
+ *
+ * - 한 프레임은 VelocityOverLife, Acceleration, ColorOverLife 모듈과 기본 갱신, 수명 검사
+ * - 레이아웃의 차이만 보도록 두 경로 모두 한 스레드에서 실행
+ * - 마지막에 두 레이아웃의 결과가 같은지 확인
+ */
+struct FParticleLayoutBenchmark
+{
+    static void Run(int32 NumParticles, int32 NumFrames);
+};
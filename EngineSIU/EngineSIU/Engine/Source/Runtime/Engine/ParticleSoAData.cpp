@@ -0,0 +1,385 @@
+#include "ParticleSoAData.h"
+
+#include <cstring>
+#include <new>
+
+#include "ParticleHelper.h"
+#include "Math/MathSSE.h"
+#include "Math/Transform.h"
+
+namespace
+{
+    constexpr std::align_val_t StreamAlignment{ 16 };
+
+    void* AllocateAligned(size_t Size)
+    {
+        return ::operator new(Size, StreamAlignment);
+    }
+
+    void FreeAligned(void* Ptr)
+    {
+        if (Ptr)
+        {
+            ::operator delete(Ptr, StreamAlignment);
+        }
+    }
+}
+
+FParticleSoAData::~FParticleSoAData()
+{
+    Free();
+}
+
+void FParticleSoAData::Allocate(int32 InMaxParticles, int32 InPayloadSize)
+{
+    Free();
+
+    MaxParticles = FMath::Max(InMaxParticles, 0);
+    Capacity = (MaxParticles + 3) & ~3;
+    PayloadSize = FMath::Max(InPayloadSize, 0);
+    NumParticles = 0;
+
+    if (Capacity == 0)
+    {
+        return;
+    }
+
+    // 4의 배수 뒤쪽 칸도 Kernel이 읽으므로 0으로 초기화하여 NaN 연산을 피함
+    const size_t StreamBytes = sizeof(float) * PS_MAX * Capacity;
+    Streams = static_cast<float*>(AllocateAligned(StreamBytes));
+    std::memset(Streams, 0, StreamBytes);
+
+    Flags = static_cast<int32*>(AllocateAligned(sizeof(int32) * Capacity));
+    std::memset(Flags, 0, sizeof(int32) * Capacity);
+
+    if (PayloadSize > 0)
+    {
+        Payloads = static_cast<uint8*>(AllocateAligned(static_cast<size_t>(PayloadSize) * Capacity));
+    }
+}
+
+void FParticleSoAData::Free()
+{
+    FreeAligned(Streams);
+    FreeAligned(Flags);
+    FreeAligned(Payloads);
+
+    Streams = nullptr;
+    Flags = nullptr;
+    Payloads = nullptr;
+
+    Capacity = 0;
+    MaxParticles = 0;
+    NumParticles = 0;
+}
+
+int32 FParticleSoAData::AddParticle(const FBaseParticle& Particle)
+{
+    if (NumParticles >= MaxParticles)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Index = NumParticles++;
+    const auto Set = [this, Index](EParticleStream Stream, float Value)
+    {
+        GetStream(Stream)[Index] = Value;
+    };
+
+    Set(PS_LocationX, Particle.Location.X);
+    Set(PS_LocationY, Particle.Location.Y);
+    Set(PS_LocationZ, Particle.Location.Z);
+    Set(PS_OldLocationX, Particle.OldLocation.X);
+    Set(PS_OldLocationY, Particle.OldLocation.Y);
+    Set(PS_OldLocationZ, Particle.OldLocation.Z);
+    Set(PS_BaseVelocityX, Particle.BaseVelocity.X);
+    Set(PS_BaseVelocityY, Particle.BaseVelocity.Y);
+    Set(PS_BaseVelocityZ, Particle.BaseVelocity.Z);
+    Set(PS_VelocityX, Particle.Velocity.X);
+    Set(PS_VelocityY, Particle.Velocity.Y);
+    Set(PS_VelocityZ, Particle.Velocity.Z);
+    Set(PS_SpawnVelocityX, Particle.BaseVelocity.X);
+    Set(PS_SpawnVelocityY, Particle.BaseVelocity.Y);
+    Set(PS_SpawnVelocityZ, Particle.BaseVelocity.Z);
+    Set(PS_BaseSizeX, Particle.BaseSize.X);
+    Set(PS_BaseSizeY, Particle.BaseSize.Y);
+    Set(PS_BaseSizeZ, Particle.BaseSize.Z);
+    Set(PS_SizeX, Particle.Size.X);
+    Set(PS_SizeY, Particle.Size.Y);
+    Set(PS_SizeZ, Particle.Size.Z);
+    Set(PS_Rotation, Particle.Rotation);
+    Set(PS_RotationRate, Particle.RotationRate);
+    Set(PS_BaseRotationRate, Particle.BaseRotationRate);
+    Set(PS_ColorR, Particle.Color.R);
+    Set(PS_ColorG, Particle.Color.G);
+    Set(PS_ColorB, Particle.Color.B);
+    Set(PS_ColorA, Particle.Color.A);
+    Set(PS_BaseColorR, Particle.BaseColor.R);
+    Set(PS_BaseColorG, Particle.BaseColor.G);
+    Set(PS_BaseColorB, Particle.BaseColor.B);
+    Set(PS_BaseColorA, Particle.BaseColor.A);
+    Set(PS_RelativeTime, Particle.RelativeTime);
+    Set(PS_OneOverMaxLifetime, Particle.OneOverMaxLifetime);
+
+    Flags[Index] = Particle.Flags;
+
+    if (PayloadSize > 0)
+    {
+        const uint8* Payload = reinterpret_cast<const uint8*>(&Particle) + sizeof(FBaseParticle);
+        std::memcpy(GetPayload(Index), Payload, PayloadSize);
+    }
+
+    return Index;
+}
+
+void FParticleSoAData::KillParticle(int32 Index)
+{
+    if (Index < 0 || Index >= NumParticles)
+    {
+        return;
+    }
+
+    const int32 LastIndex = NumParticles - 1;
+    if (Index != LastIndex)
+    {
+        for (int32 Stream = 0; Stream < PS_MAX; ++Stream)
+        {
+            float* Data = GetStream(static_cast<EParticleStream>(Stream));
+            Data[Index] = Data[LastIndex];
+        }
+
+        Flags[Index] = Flags[LastIndex];
+
+        if (PayloadSize > 0)
+        {
+            std::memcpy(GetPayload(Index), GetPayload(LastIndex), PayloadSize);
+        }
+    }
+
+    --NumParticles;
+}
+
+void FParticleSoAData::CopyToParticleData(uint8* OutParticleData, int32 ParticleStride) const
+{
+    const auto Get = [this](EParticleStream Stream, int32 Index)
+    {
+        return GetStream(Stream)[Index];
+    };
+
+    for (int32 Index = 0; Index < NumParticles; ++Index)
+    {
+        DECLARE_PARTICLE(Particle, OutParticleData + static_cast<size_t>(ParticleStride) * Index)
+
+        Particle.Location = FVector(Get(PS_LocationX, Index), Get(PS_LocationY, Index), Get(PS_LocationZ, Index));
+        Particle.OldLocation = FVector(Get(PS_OldLocationX, Index), Get(PS_OldLocationY, Index), Get(PS_OldLocationZ, Index));
+        Particle.BaseVelocity = FVector(Get(PS_BaseVelocityX, Index), Get(PS_BaseVelocityY, Index), Get(PS_BaseVelocityZ, Index));
+        Particle.Velocity = FVector(Get(PS_VelocityX, Index), Get(PS_VelocityY, Index), Get(PS_VelocityZ, Index));
+        Particle.BaseSize = FVector(Get(PS_BaseSizeX, Index), Get(PS_BaseSizeY, Index), Get(PS_BaseSizeZ, Index));
+        Particle.Size = FVector(Get(PS_SizeX, Index), Get(PS_SizeY, Index), Get(PS_SizeZ, Index));
+        Particle.Rotation = Get(PS_Rotation, Index);
+        Particle.RotationRate = Get(PS_RotationRate, Index);
+        Particle.BaseRotationRate = Get(PS_BaseRotationRate, Index);
+        Particle.Color = FLinearColor(Get(PS_ColorR, Index), Get(PS_ColorG, Index), Get(PS_ColorB, Index), Get(PS_ColorA, Index));
+        Particle.BaseColor = FLinearColor(Get(PS_BaseColorR, Index), Get(PS_BaseColorG, Index), Get(PS_BaseColorB, Index), Get(PS_BaseColorA, Index));
+        Particle.RelativeTime = Get(PS_RelativeTime, Index);
+        Particle.OneOverMaxLifetime = Get(PS_OneOverMaxLifetime, Index);
+        Particle.Flags = Flags[Index];
+        Particle.Placeholder0 = 0.f;
+        Particle.Placeholder1 = 0.f;
+
+        if (PayloadSize > 0)
+        {
+            std::memcpy(
+                reinterpret_cast<uint8*>(&Particle) + sizeof(FBaseParticle),
+                Payloads + static_cast<size_t>(Index) * PayloadSize,
+                PayloadSize
+            );
+        }
+    }
+}
+
+namespace ParticleSoAKernels
+{
+    using namespace SSE;
+
+    void UpdateParticles(FParticleSoAData& Data, float DeltaTime)
+    {
+        UpdateParticles(Data, DeltaTime, 0, Data.GetNumSimd());
+    }
+
+    void UpdateParticles(FParticleSoAData& Data, float DeltaTime, int32 StartIndex, int32 EndIndex)
+    {
+        const VectorRegister4Float DeltaTimeVec = _mm_set1_ps(DeltaTime);
+
+        float* RelativeTime = Data.GetStream(PS_RelativeTime);
+        const float* OneOverMaxLifetime = Data.GetStream(PS_OneOverMaxLifetime);
+        for (int32 Index = StartIndex; Index < EndIndex; Index += 4)
+        {
+            const VectorRegister4Float Rate = _mm_load_ps(OneOverMaxLifetime + Index);
+            _mm_store_ps(RelativeTime + Index, VectorMultiplyAdd(Rate, DeltaTimeVec, _mm_load_ps(RelativeTime + Index)));
+        }
+
+        // OldLocation = Location, Velocity = BaseVelocity, Location += Velocity * DeltaTime
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float* Location = Data.GetStream(static_cast<EParticleStream>(PS_LocationX + Axis));
+            float* OldLocation = Data.GetStream(static_cast<EParticleStream>(PS_OldLocationX + Axis));
+            float* Velocity = Data.GetStream(static_cast<EParticleStream>(PS_VelocityX + Axis));
+            const float* BaseVelocity = Data.GetStream(static_cast<EParticleStream>(PS_BaseVelocityX + Axis));
+            float* Size = Data.GetStream(static_cast<EParticleStream>(PS_SizeX + Axis));
+            const float* BaseSize = Data.GetStream(static_cast<EParticleStream>(PS_BaseSizeX + Axis));
+
+            for (int32 Index = StartIndex; Index < EndIndex; Index += 4)
+            {
+                const VectorRegister4Float CurrentLocation = _mm_load_ps(Location + Index);
+                const VectorRegister4Float NewVelocity = _mm_load_ps(BaseVelocity + Index);
+
+                _mm_store_ps(OldLocation + Index, CurrentLocation);
+                _mm_store_ps(Velocity + Index, NewVelocity);
+                _mm_store_ps(Location + Index, VectorMultiplyAdd(NewVelocity, DeltaTimeVec, CurrentLocation));
+                _mm_store_ps(Size + Index, _mm_load_ps(BaseSize + Index));
+            }
+        }
+
+        // RotationRate = BaseRotationRate, Rotation += RotationRate * DeltaTime
+        float* Rotation = Data.GetStream(PS_Rotation);
+        float* RotationRate = Data.GetStream(PS_RotationRate);
+        const float* BaseRotationRate = Data.GetStream(PS_BaseRotationRate);
+        for (int32 Index = StartIndex; Index < EndIndex; Index += 4)
+        {
+            const VectorRegister4Float NewRate = _mm_load_ps(BaseRotationRate + Index);
+            _mm_store_ps(RotationRate + Index, NewRate);
+            _mm_store_ps(Rotation + Index, VectorMultiplyAdd(NewRate, DeltaTimeVec, _mm_load_ps(Rotation + Index)));
+        }
+    }
+
+    void KillExpiredParticles(FParticleSoAData& Data)
+    {
+        const float* RelativeTime = Data.GetStream(PS_RelativeTime);
+        const VectorRegister4Float One = _mm_set1_ps(1.0f);
+
+        // 4개 묶음 중 죽은 파티클이 하나라도 있을 때만 개별 검사
+        for (int32 Base = 0; Base < Data.Num(); Base += 4)
+        {
+            if (_mm_movemask_ps(_mm_cmpge_ps(_mm_load_ps(RelativeTime + Base), One)) == 0)
+            {
+                continue;
+            }
+
+            // KillParticle은 마지막 파티클을 당겨오므로, 당겨온 파티클도 다시 검사
+            for (int32 Index = Base; Index < FMath::Min(Base + 4, Data.Num()); )
+            {
+                if (RelativeTime[Index] >= 1.0f)
+                {
+                    Data.KillParticle(Index);
+                }
+                else
+                {
+                    ++Index;
+                }
+            }
+        }
+    }
+
+    void LerpColorOverLife(FParticleSoAData& Data, const FLinearColor& TargetColor)
+    {
+        const int32 NumSimd = Data.GetNumSimd();
+        const float* RelativeTime = Data.GetStream(PS_RelativeTime);
+        const float Target[4] = { TargetColor.R, TargetColor.G, TargetColor.B, TargetColor.A };
+
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            float* Color = Data.GetStream(static_cast<EParticleStream>(PS_ColorR + Channel));
+            const float* BaseColor = Data.GetStream(static_cast<EParticleStream>(PS_BaseColorR + Channel));
+            const VectorRegister4Float TargetVec = _mm_set1_ps(Target[Channel]);
+
+            for (int32 Index = 0; Index < NumSimd; Index += 4)
+            {
+                // Base + (Target - Base) * Alpha
+                const VectorRegister4Float Start = _mm_load_ps(BaseColor + Index);
+                const VectorRegister4Float Alpha = _mm_load_ps(RelativeTime + Index);
+                _mm_store_ps(Color + Index, VectorMultiplyAdd(_mm_sub_ps(TargetVec, Start), Alpha, Start));
+            }
+        }
+    }
+
+    void AddBaseVelocity(FParticleSoAData& Data, const FVector& Delta)
+    {
+        const int32 NumSimd = Data.GetNumSimd();
+        const float DeltaAxis[3] = { Delta.X, Delta.Y, Delta.Z };
+
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float* BaseVelocity = Data.GetStream(static_cast<EParticleStream>(PS_BaseVelocityX + Axis));
+            const VectorRegister4Float DeltaVec = _mm_set1_ps(DeltaAxis[Axis]);
+
+            for (int32 Index = 0; Index < NumSimd; Index += 4)
+            {
+                _mm_store_ps(BaseVelocity + Index, VectorAdd(_mm_load_ps(BaseVelocity + Index), DeltaVec));
+            }
+        }
+    }
+
+    void LerpVelocityOverLife(
+        FParticleSoAData& Data, const FVector& EndVelocity, float CurveExponent, const FTransform* Transform, const FVector& Scale
+    )
+    {
+        const int32 NumSimd = Data.GetNumSimd();
+        const float* RelativeTime = Data.GetStream(PS_RelativeTime);
+
+        // TransformVector는 선형이므로 기저 벡터를 변환한 3x3 행렬로 적용할 수 있음
+        FVector BasisX(1.f, 0.f, 0.f);
+        FVector BasisY(0.f, 1.f, 0.f);
+        FVector BasisZ(0.f, 0.f, 1.f);
+        if (Transform)
+        {
+            BasisX = Transform->TransformVector(BasisX);
+            BasisY = Transform->TransformVector(BasisY);
+            BasisZ = Transform->TransformVector(BasisZ);
+        }
+        BasisX *= Scale;
+        BasisY *= Scale;
+        BasisZ *= Scale;
+
+        const float* SpawnX = Data.GetStream(PS_SpawnVelocityX);
+        const float* SpawnY = Data.GetStream(PS_SpawnVelocityY);
+        const float* SpawnZ = Data.GetStream(PS_SpawnVelocityZ);
+        float* OutX = Data.GetStream(PS_BaseVelocityX);
+        float* OutY = Data.GetStream(PS_BaseVelocityY);
+        float* OutZ = Data.GetStream(PS_BaseVelocityZ);
+
+        const VectorRegister4Float Zero = _mm_setzero_ps();
+        const VectorRegister4Float One = _mm_set1_ps(1.0f);
+        const VectorRegister4Float EndX = _mm_set1_ps(EndVelocity.X);
+        const VectorRegister4Float EndY = _mm_set1_ps(EndVelocity.Y);
+        const VectorRegister4Float EndZ = _mm_set1_ps(EndVelocity.Z);
+
+        alignas(16) float CurveAlpha[4];
+        for (int32 Index = 0; Index < NumSimd; Index += 4)
+        {
+            VectorRegister4Float Alpha = _mm_min_ps(_mm_max_ps(_mm_load_ps(RelativeTime + Index), Zero), One);
+            if (CurveExponent > 0.0f)
+            {
+                // 거듭제곱은 SSE 명령이 없으므로 Alpha만 스칼라로 계산
+                _mm_store_ps(CurveAlpha, Alpha);
+                for (float& Value : CurveAlpha)
+                {
+                    Value = 1.0f - FMath::Pow(1.0f - Value, CurveExponent);
+                }
+                Alpha = _mm_load_ps(CurveAlpha);
+            }
+
+            const VectorRegister4Float StartX = _mm_load_ps(SpawnX + Index);
+            const VectorRegister4Float StartY = _mm_load_ps(SpawnY + Index);
+            const VectorRegister4Float StartZ = _mm_load_ps(SpawnZ + Index);
+            const VectorRegister4Float VelX = VectorMultiplyAdd(_mm_sub_ps(EndX, StartX), Alpha, StartX);
+            const VectorRegister4Float VelY = VectorMultiplyAdd(_mm_sub_ps(EndY, StartY), Alpha, StartY);
+            const VectorRegister4Float VelZ = VectorMultiplyAdd(_mm_sub_ps(EndZ, StartZ), Alpha, StartZ);
+
+            // Out = VelX * BasisX + VelY * BasisY + VelZ * BasisZ
+            _mm_store_ps(OutX + Index, VectorMultiplyAdd(VelZ, _mm_set1_ps(BasisZ.X), VectorMultiplyAdd(VelY, _mm_set1_ps(BasisY.X), VectorMultiply(VelX, _mm_set1_ps(BasisX.X)))));
+            _mm_store_ps(OutY + Index, VectorMultiplyAdd(VelZ, _mm_set1_ps(BasisZ.Y), VectorMultiplyAdd(VelY, _mm_set1_ps(BasisY.Y), VectorMultiply(VelX, _mm_set1_ps(BasisX.Y)))));
+            _mm_store_ps(OutZ + Index, VectorMultiplyAdd(VelZ, _mm_set1_ps(BasisZ.Z), VectorMultiplyAdd(VelY, _mm_set1_ps(BasisY.Z), VectorMultiply(VelX, _mm_set1_ps(BasisX.Z)))));
+        }
+    }
+}
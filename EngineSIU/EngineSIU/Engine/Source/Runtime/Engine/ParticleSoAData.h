@@ -0,0 +1,155 @@
+#pragma once
+#include "HAL/PlatformType.h"
+#include "Math/Color.h"
+#include "Math/Vector.h"
+
+struct FBaseParticle;
+struct FTransform;
+
+
+/** FParticleSoAData가 가지는 float Stream의 종류 */
+enum EParticleStream : uint8
+{
+    PS_LocationX,
+    PS_LocationY,
+    PS_LocationZ,
+    PS_OldLocationX,
+    PS_OldLocationY,
+    PS_OldLocationZ,
+    PS_BaseVelocityX,
+    PS_BaseVelocityY,
+    PS_BaseVelocityZ,
+    PS_VelocityX,
+    PS_VelocityY,
+    PS_VelocityZ,
+    /** Spawn 모듈들이 끝난 직후의 BaseVelocity, VelocityOverLife가 사용 */
+    PS_SpawnVelocityX,
+    PS_SpawnVelocityY,
+    PS_SpawnVelocityZ,
+    PS_BaseSizeX,
+    PS_BaseSizeY,
+    PS_BaseSizeZ,
+    PS_SizeX,
+    PS_SizeY,
+    PS_SizeZ,
+    PS_Rotation,
+    PS_RotationRate,
+    PS_BaseRotationRate,
+    PS_ColorR,
+    PS_ColorG,
+    PS_ColorB,
+    PS_ColorA,
+    PS_BaseColorR,
+    PS_BaseColorG,
+    PS_BaseColorB,
+    PS_BaseColorA,
+    PS_RelativeTime,
+    PS_OneOverMaxLifetime,
+    PS_MAX,
+};
+
+/**
+ * 파티클을 속성별 Stream으로 나누어 저장하는 Structure of Arrays 레이아웃입니다.
+ *
+ * FBaseParticle을 ParticleStride 간격으로 저장하는 기존 레이아웃은 필드 하나를 바꾸려 해도 파티클 전체를 캐시에 올려야 하지만,
+ * 이 레이아웃은 필요한 Stream만 연속으로 읽으므로 모듈의 Update를 SIMD로 4개씩 처리할 수 있습니다.
+ * 각 Stream은 16바이트 정렬되어 있고, 용량은 4의 배수이므로 Kernel은 마지막 묶음을 따로 처리하지 않아도 됩니다.
+ *
+ * 렌더링과 Replay Data는 여전히 FBaseParticle 레이아웃을 사용하므로, CopyToParticleData로 변환하여 넘깁니다.
+ */
+class FParticleSoAData
+{
+public:
+    FParticleSoAData() = default;
+    ~FParticleSoAData();
+
+    FParticleSoAData(const FParticleSoAData&) = delete;
+    FParticleSoAData& operator=(const FParticleSoAData&) = delete;
+    FParticleSoAData(FParticleSoAData&&) = delete;
+    FParticleSoAData& operator=(FParticleSoAData&&) = delete;
+
+    /**
+     * Stream들을 할당합니다. 기존 파티클은 모두 사라집니다.
+     * @param InMaxParticles 저장할 수 있는 최대 파티클 수
+     * @param InPayloadSize 모듈 Payload의 크기 (ParticleStride - sizeof(FBaseParticle))
+     */
+    void Allocate(int32 InMaxParticles, int32 InPayloadSize);
+    void Free();
+
+    int32 Num() const { return NumParticles; }
+    int32 GetMaxParticles() const { return MaxParticles; }
+
+    /** SIMD Kernel이 처리해야 할 파티클 수, Num()을 4의 배수로 올림 */
+    int32 GetNumSimd() const { return (NumParticles + 3) & ~3; }
+
+    float* GetStream(EParticleStream Stream) { return Streams + static_cast<size_t>(Stream) * Capacity; }
+    const float* GetStream(EParticleStream Stream) const { return Streams + static_cast<size_t>(Stream) * Capacity; }
+
+    int32* GetFlags() { return Flags; }
+    uint8* GetPayload(int32 Index) { return Payloads + static_cast<size_t>(Index) * PayloadSize; }
+
+    /**
+     * FBaseParticle 레이아웃으로 Spawn된 파티클을 마지막에 추가합니다.
+     * @param Particle Spawn 모듈이 채운 파티클, 바로 뒤에 Payload가 이어져 있어야 합니다.
+     * @return 추가된 Index, 가득 찼다면 INDEX_NONE
+     */
+    int32 AddParticle(const FBaseParticle& Particle);
+
+    /** Index의 파티클을 마지막 파티클로 덮어쓰고 수를 줄입니다. */
+    void KillParticle(int32 Index);
+
+    void KillAllParticles() { NumParticles = 0; }
+
+    /** 모든 파티클을 FBaseParticle + Payload 레이아웃으로 복사합니다. */
+    void CopyToParticleData(uint8* OutParticleData, int32 ParticleStride) const;
+
+private:
+    /** Stream 하나의 길이, MaxParticles를 4의 배수로 올린 값 */
+    int32 Capacity = 0;
+    int32 MaxParticles = 0;
+    int32 NumParticles = 0;
+    int32 PayloadSize = 0;
+
+    /** PS_MAX개의 Stream이 Capacity 간격으로 이어진 하나의 정렬된 블록 */
+    float* Streams = nullptr;
+    int32* Flags = nullptr;
+    uint8* Payloads = nullptr;
+};
+
+/**
+ * FParticleSoAData의 Stream을 SSE로 4개씩 갱신하는 Kernel들입니다.
+ * 모든 Kernel은 [0, GetNumSimd()) 범위를 처리하며, Num() 이후의 값은 쓰레기 값이어도 상관없습니다.
+ */
+namespace ParticleSoAKernels
+{
+    /**
+     * FParticleEmitterInstance::UpdateParticles와 같은 기본 갱신입니다.
+     * RelativeTime을 증가시키고, Velocity/RotationRate/Size를 Base 값으로 되돌린 뒤 위치와 회전을 적분합니다.
+     */
+    void UpdateParticles(FParticleSoAData& Data, float DeltaTime);
+
+    /**
+     * [StartIndex, EndIndex) 구간만 갱신합니다. 구간이 겹치지 않는다면 여러 스레드에서 동시에 호출할 수 있습니다.
+     * StartIndex는 4의 배수여야 하고, EndIndex는 4의 배수이거나 GetNumSimd()여야 합니다.
+     */
+    void UpdateParticles(FParticleSoAData& Data, float DeltaTime, int32 StartIndex, int32 EndIndex);
+
+    /** RelativeTime이 1 이상인 파티클을 제거합니다. */
+    void KillExpiredParticles(FParticleSoAData& Data);
+
+    /** Color = Lerp(BaseColor, TargetColor, RelativeTime) */
+    void LerpColorOverLife(FParticleSoAData& Data, const FLinearColor& TargetColor);
+
+    /** BaseVelocity += Delta */
+    void AddBaseVelocity(FParticleSoAData& Data, const FVector& Delta);
+
+    /**
+     * BaseVelocity = Lerp(SpawnVelocity, EndVelocity, Alpha)
+     * @param CurveExponent 0보다 크다면 Alpha = 1 - (1 - RelativeTime)^CurveExponent, 아니라면 Alpha = RelativeTime
+     * @param Transform nullptr이 아니라면 결과 속도를 변환합니다.
+     * @param Scale 결과 속도에 곱할 값
+     */
+    void LerpVelocityOverLife(
+        FParticleSoAData& Data, const FVector& EndVelocity, float CurveExponent, const FTransform* Transform, const FVector& Scale
+    );
+}
@@ -1,15 +1,43 @@
 #include "Console.h"
 #include <cstdarg>
+#include <cstdlib>
 #include <cstdio>
 
 #include "Actors/PointLightActor.h"
 #include "Actors/SpotLightActor.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/Asset/PackedMeshVertex.h"
+#include "Engine/Asset/SkeletalMeshAsset.h"
+#include "Engine/TextureStreamer.h"
+#include "Engine/PhysicsManager.h"
+#include "Engine/EventManager.h"
+#include "Engine/FObjLoader.h"
+#include "Engine/MeshSimplifier.h"
+#include "Engine/MeshOptimizer.h"
+#include "Delegates/DelegateBenchmark.h"
+#include "Async/JobSystemTest.h"
+#include "Physics/PhysicsSceneQuery.h"
+#include "ParticleLayoutBenchmark.h"
+#include "Physics/VehicleSimulation.h"
+#include "World/WorldSnapshot.h"
+#include "LuaScripts/LuaScriptManager.h"
+#include "SoundManager.h"
 #include "Components/Light/LightComponent.h"
 #include "Engine/Engine.h"
 #include "Renderer/UpdateLightBufferPass.h"
+#include "Renderer/LightClusterBuilder.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/ShadowAtlas.h"
+#include "Renderer/ShadowManager.h"
+#include "Renderer/ShadowRenderPass.h"
+#include "Stats/CpuProfiler.h"
 #include "Stats/GPUTimingManager.h"
 #include "Stats/ProfilerStatsManager.h"
+#include "Animation/AnimationCompression.h"
+#include "Animation/AnimGraphBenchmark.h"
+#include "Animation/AnimPoseCache.h"
+#include "Animation/AnimUpdateRateManager.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/UObjectIterator.h"
 
@@ -31,6 +59,11 @@ void FStatOverlay::ToggleStat(const std::string& Command)
         bShowLight = true;
         bShowRender = true;
     }
+    else if (Command == "stat anim")
+    {
+        bShowAnim = true;
+        bShowRender = true;
+    }
     else if (Command == "stat all")
     {
         StatFlags = 0xFF;
@@ -83,6 +116,28 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Allocated Object Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Object>());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Container>());
+
+        uint64 SkeletalVertexBytes = 0;
+        uint64 PackedSkeletalVertexBytes = 0;
+        for (const USkeletalMesh* SkeletalMesh : TObjectRange<USkeletalMesh>())
+        {
+            if (const FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetRenderData())
+            {
+                SkeletalVertexBytes += static_cast<uint64>(RenderData->Vertices.Num()) * sizeof(FSkeletalMeshVertex);
+                PackedSkeletalVertexBytes += static_cast<uint64>(RenderData->PackedVertices.Num()) * sizeof(FPackedSkeletalMeshVertex);
+            }
+        }
+        ImGui::Text("Skeletal Vertex Memory: %llu Byte (Packed %llu Byte)", SkeletalVertexBytes, PackedSkeletalVertexBytes);
+
+        const FTextureStreamer& TextureStreamer = FTextureStreamer::Get();
+        constexpr double BytesToMB = 1.0 / (1024.0 * 1024.0);
+        ImGui::Text("Texture Streaming: %d Textures, %.1f / %.1f MB (Budget %.1f MB), %d Loads In Flight",
+            TextureStreamer.GetNumTextures(),
+            static_cast<double>(TextureStreamer.GetResidentBytes()) * BytesToMB,
+            static_cast<double>(TextureStreamer.GetRequiredBytes()) * BytesToMB,
+            static_cast<double>(TextureStreamer.GetBudgetBytes()) * BytesToMB,
+            TextureStreamer.GetNumLoadsInFlight()
+        );
     }
 
     if (bShowLight)
@@ -92,6 +147,26 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Spot Light: %d", GetNumOfObjectsByClass(ASpotLight::StaticClass()));
     }
 
+    if (bShowAnim)
+    {
+        const FAnimUpdateRateStats& AnimStats = FAnimUpdateRateManager::Get().GetLastFrameStats();
+        ImGui::SeparatorText("[ Animation Update Rate ]\n");
+        ImGui::Text("Skeletal Meshes: %d", AnimStats.NumComponents);
+        ImGui::Text("Evaluated: %d", AnimStats.NumEvaluated);
+        ImGui::Text("Interpolated: %d", AnimStats.NumInterpolated);
+        ImGui::Text("Skipped: %d", AnimStats.NumSkipped);
+        ImGui::Text("Evaluations Saved: %d", AnimStats.GetNumEvaluationsSaved());
+        ImGui::Text("Skinning Skipped (Offscreen): %d", AnimStats.NumSkinningSkipped);
+        ImGui::Text("Bones Skipped (Bone LOD): %d", AnimStats.NumBonesSkipped);
+
+        const FAnimPoseCacheStats& PoseCacheStats = FAnimPoseCache::Get().GetLastFrameStats();
+        ImGui::SeparatorText("[ Shared Pose Cache ]\n");
+        ImGui::Text("Lookups: %d", PoseCacheStats.NumLookups);
+        ImGui::Text("Hits: %d (%.1f%%)", PoseCacheStats.NumHits, PoseCacheStats.GetHitRate() * 100.0f);
+        ImGui::Text("Cached Poses: %d", PoseCacheStats.NumEntries);
+        ImGui::Text("Evicted: %d", PoseCacheStats.NumEvicted);
+    }
+
     ImGui::PopStyleColor();
     ImGui::PopStyleColor();
     ImGui::End();
@@ -108,7 +183,7 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
 
     // Example positioning: Top-left corner
     ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
-    ImGui::SetNextWindowSize(ImVec2(350, 400), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(430, 400), ImGuiCond_FirstUseEver);
 
     if (!ImGui::Begin("Engine Profiler", &bShowWindow))
     {
@@ -116,10 +191,24 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
         return;
     }
 
-    if (ImGui::BeginTable("ProfilerTable", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    FCpuProfiler& CpuProfiler = FCpuProfiler::Get();
+    if (CpuProfiler.IsCapturing())
+    {
+        if (ImGui::Button("Stop CPU Capture"))
+        {
+            CpuProfiler.StopCapture();
+        }
+    }
+    else if (ImGui::Button("Start CPU Capture"))
+    {
+        CpuProfiler.StartCapture();
+    }
+
+    if (ImGui::BeginTable("ProfilerTable", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
     {
         ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
         ImGui::TableSetupColumn("CPU (ms)", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+        ImGui::TableSetupColumn("CPU P95", ImGuiTableColumnFlags_WidthFixed, 80.0f);
         ImGui::TableSetupColumn("GPU (ms)", ImGuiTableColumnFlags_WidthFixed, 80.0f);
         ImGui::TableHeadersRow();
 
@@ -129,6 +218,10 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
             double GPUTimeMs = GPUTimingManager->GetElapsedTimeMs(TStatId(GPUStatName));
 
             FString CPUText = (CPUTimeMs >= 0.0) ? FString::Printf(TEXT("%.3f"), CPUTimeMs) : TEXT("---");
+
+            FCpuStatSummary CPUSummary;
+            const bool bHasCPUSummary = CpuProfiler.GetStatSummary(CPUStatName, CPUSummary);
+            FString CPUP95Text = bHasCPUSummary ? FString::Printf(TEXT("%.3f"), CPUSummary.P95Ms) : TEXT("---");
             FString GPUText;
 
             if (GPUTimeMs == -1.0) GPUText = TEXT("Disjoint");
@@ -141,6 +234,14 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
             // Scope 열
             ImGui::TableSetColumnIndex(0);
             ImGui::Text("%s", *DisplayName);
+            if (bHasCPUSummary && ImGui::IsItemHovered())
+            {
+                ImGui::SetTooltip(
+                    "Last %d frames (ms)\nMin %.3f / Avg %.3f / Max %.3f\nP50 %.3f / P95 %.3f / P99 %.3f",
+                    CPUSummary.NumSamples, CPUSummary.MinMs, CPUSummary.AvgMs, CPUSummary.MaxMs,
+                    CPUSummary.P50Ms, CPUSummary.P95Ms, CPUSummary.P99Ms
+                );
+            }
 
             // CPU (ms) 열 - 우측 정렬
             ImGui::TableSetColumnIndex(1);
@@ -148,8 +249,14 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
             ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetContentRegionAvail().x - CPUTextWidth);
             ImGui::TextUnformatted(*CPUText);
 
-            // GPU (ms) 열 - 우측 정렬
+            // CPU P95 열 - 최근 프레임들의 95 백분위, 우측 정렬
             ImGui::TableSetColumnIndex(2);
+            float CPUP95TextWidth = ImGui::CalcTextSize(*CPUP95Text).x;
+            ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetContentRegionAvail().x - CPUP95TextWidth);
+            ImGui::TextUnformatted(*CPUP95Text);
+
+            // GPU (ms) 열 - 우측 정렬
+            ImGui::TableSetColumnIndex(3);
             float GPUTextWidth = ImGui::CalcTextSize(*GPUText).x;
             ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetContentRegionAvail().x - GPUTextWidth);
             ImGui::TextUnformatted(*GPUText);
@@ -176,6 +283,7 @@ FConsole& FConsole::GetInstance() {
 
 // 로그 초기화
 void FConsole::Clear() {
+    std::lock_guard Lock(ItemsMutex);
     Items.Empty();
 }
 
@@ -189,9 +297,11 @@ void FConsole::AddLog(ELogLevel Level, const ANSICHAR* Fmt, ...)
     char Buf[1024];
     vsnprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
 
-    Items.Emplace(Level, std::string(Buf));
     va_end(Args);
 
+    std::lock_guard Lock(ItemsMutex);
+    Items.Emplace(Level, std::string(Buf));
+
     ScrollToBottom = true;
 }
 
@@ -204,14 +314,17 @@ void FConsole::AddLog(ELogLevel Level, const WIDECHAR* Fmt, ...)
     wchar_t Buf[1024];
     _vsnwprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
 
-    Items.Emplace(Level, FString(Buf).ToAnsiString());
     va_end(Args);
 
+    std::lock_guard Lock(ItemsMutex);
+    Items.Emplace(Level, FString(Buf).ToAnsiString());
+
     ScrollToBottom = true;
 }
 
 void FConsole::AddLog(ELogLevel Level, const FString& Message)
 {
+    std::lock_guard Lock(ItemsMutex);
     Items.Emplace(Level, Message);
     ScrollToBottom = true;
 }
@@ -279,6 +392,7 @@ void FConsole::Draw() {
 
     // 로그 출력 (필터 적용)
     ImGui::BeginChild("ScrollingRegion", ImVec2(0, -ImGui::GetTextLineHeightWithSpacing()), false, ImGuiWindowFlags_HorizontalScrollbar);
+    std::unique_lock ItemsLock(ItemsMutex); // Worker Thread의 AddLog가 순회 중에 Items를 재할당하지 않도록 그리는 동안 잠금
     for (const auto& [Level, Message] : Items)
     {
         if (!Filter.PassFilter(*Message))
@@ -311,6 +425,7 @@ void FConsole::Draw() {
 
         ImGui::TextColored(Color, "%s", *Message);
     }
+    ItemsLock.unlock();
 
     if (ScrollToBottom)
     {
@@ -362,7 +477,51 @@ void FConsole::ExecuteCommand(const std::string& Command)
         AddLog(ELogLevel::Display, " - help: Shows available commands");
         AddLog(ELogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(ELogLevel::Display, " - stat memory: Toggle Memory display");
+        AddLog(ELogLevel::Display, " - stat anim: Toggle animation update rate display");
         AddLog(ELogLevel::Display, " - stat none: Hide all stat overlays");
+        AddLog(ELogLevel::Display, " - Toggle Skinning: Toggle CPU/GPU skinning");
+        AddLog(ELogLevel::Display, " - Toggle PackedVertices: Toggle packed vertices for GPU skinning");
+        AddLog(ELogLevel::Display, " - texture budget <MB>: Set the texture streaming memory budget");
+        AddLog(ELogLevel::Display, " - texture test: Check the BC codecs, texture cook cache and streaming scheduler budget and priorities");
+        AddLog(ELogLevel::Display, " - jobs test [iterations]: Stress test ParallelFor, nested dispatch, DispatchAfter chains and external thread dispatch");
+        AddLog(ELogLevel::Display, " - jobs bench [items] [threads]: Time the same ParallelFor workload on 1 to [threads] threads");
+        AddLog(ELogLevel::Display, " - particle bench [particles] [frames]: Compare AoS and SoA particle updates, 100k and 1M particles if no count is given");
+        AddLog(ELogLevel::Display, " - anim compression bench [samples]: Compare compressed and raw bone track sampling on a synthetic clip and the loaded clips");
+        AddLog(ELogLevel::Display, " - anim graph bench [instances] [frames]: Run MyAnimGraph.json with synthetic sequences on [instances] instances and time update and evaluate");
+        AddLog(ELogLevel::Display, " - mesh simplify test: Simplify the sample OBJ meshes and check triangle counts, error bounds and LODs");
+        AddLog(ELogLevel::Display, " - mesh optimize test [grid size]: Optimize a fixed grid mesh and check that ACMR does not get worse and the triangles are kept");
+        AddLog(ELogLevel::Display, " - vertex quantization test [vertices]: Check packed vertex round-trip error, memory and CPU skinning time on random skeletal vertices");
+        AddLog(ELogLevel::Display, " - obj bench [repeats]: Parse and convert the sample OBJ files [repeats] times and report MB/s");
+        AddLog(ELogLevel::Display, " - light cluster test [points] [spots]: Compare Build with BuildReference on random lights and cameras and report mismatched clusters");
+        AddLog(ELogLevel::Display, " - physics querybench [rays]: Compare serial and batched raycasts against a generated scene");
+        AddLog(ELogLevel::Display, " - sound stats: Show real, virtual and loading voice counts");
+        AddLog(ELogLevel::Display, " - sound test: Run voice stealing, real voice budget and virtualization checks on the null sound backend");
+        AddLog(ELogLevel::Display, " - event bench [count] [frames]: Compare string-keyed delegate maps with the typed event bus for [count] events per frame");
+        AddLog(ELogLevel::Display, " - delegate bench [listeners] [broadcasts]: Count delegate bind allocations and compare multicast broadcast with the std::function map");
+        AddLog(ELogLevel::Display, " - vehicle test: Check stopping distance and stability of the vehicle simulation on a flat plane at several frame rates");
+        AddLog(ELogLevel::Display, " - vehicle bench [count] [frames]: Time [count] vehicles driving on a flat plane");
+        AddLog(ELogLevel::Display, " - pie snapshot test [actors]: Duplicate a generated level of [actors] actors per object and through a world snapshot, and compare the copy with the source objects");
+        AddLog(ELogLevel::Display, " - shadow stats: Show shadow atlas usage and how many local light shadow faces were redrawn");
+        AddLog(ELogLevel::Display, " - shadow test: Check shadow atlas packing and eviction, and which shadow faces are invalidated when casters move");
+        AddLog(ELogLevel::Display, " - lua stats: Show shared Lua VM memory and script cache usage");
+        AddLog(ELogLevel::Display, " - lua startupbench [count]: Compare per-component Lua VMs with the shared VM for [count] scripts");
+        AddLog(ELogLevel::Display, " - lua tickbench [count] [frames]: Compare Tick lookup by name, cached handles and TickBatch for [count] scripts");
+        AddLog(ELogLevel::Display, " - profile start [frames]: Start CPU profiler capture, stops automatically after [frames] if given");
+        AddLog(ELogLevel::Display, " - profile stop [path]: Stop CPU profiler capture and save it as Chrome trace JSON");
+    }
+    else if (Command == "profile start" || Command.starts_with("profile start "))
+    {
+        int32 MaxFrames = 0;
+        if (Command.size() > 14)
+        {
+            MaxFrames = std::atoi(Command.c_str() + 14);
+        }
+        FCpuProfiler::Get().StartCapture(MaxFrames);
+    }
+    else if (Command == "profile stop" || Command.starts_with("profile stop "))
+    {
+        const std::string FilePath = Command.size() > 13 ? Command.substr(13) : std::string();
+        FCpuProfiler::Get().StopCapture(FString(FilePath));
     }
     else if (Command.starts_with("stat "))
     {
@@ -372,6 +531,301 @@ void FConsole::ExecuteCommand(const std::string& Command)
     {
         USkeletalMeshComponent::SetCPUSkinning(!(USkeletalMeshComponent::GetCPUSkinning()));
     }
+    else if (Command == "Toggle PackedVertices")
+    {
+        USkeletalMeshComponent::SetPackedVertices(!(USkeletalMeshComponent::GetPackedVertices()));
+    }
+    else if (Command.starts_with("texture budget "))
+    {
+        const int32 BudgetMB = std::atoi(Command.c_str() + 15);
+        if (BudgetMB > 0)
+        {
+            FTextureStreamer::Get().SetBudgetBytes(static_cast<uint64>(BudgetMB) * 1024 * 1024);
+            AddLog(ELogLevel::Display, "Texture streaming budget: %d MB", BudgetMB);
+        }
+        else
+        {
+            AddLog(ELogLevel::Error, "Usage: texture budget <MB>");
+        }
+    }
+    else if (Command == "texture test")
+    {
+        const bool bCookerPassed = FTextureCooker::RunSelfTest(L"Contents/Cube/texture.png");
+        const bool bSchedulerPassed = FTextureStreamingScheduler::RunSelfTest();
+        AddLog(bCookerPassed && bSchedulerPassed ? ELogLevel::Display : ELogLevel::Error, "Texture test: cooker %s, streaming scheduler %s",
+            bCookerPassed ? "passed" : "failed", bSchedulerPassed ? "passed" : "failed");
+    }
+    else if (Command == "jobs test" || Command.starts_with("jobs test "))
+    {
+        int32 NumIterations = 100;
+        if (Command.size() > 10)
+        {
+            NumIterations = std::atoi(Command.c_str() + 10);
+        }
+        FJobSystemTest::RunStressTest(NumIterations);
+    }
+    else if (Command == "jobs bench" || Command.starts_with("jobs bench "))
+    {
+        int32 NumItems = 1 << 20;
+        int32 MaxThreads = 0;
+        if (Command.size() > 11)
+        {
+            char* Next = nullptr;
+            NumItems = static_cast<int32>(std::strtol(Command.c_str() + 11, &Next, 10));
+            if (Next && *Next != '\0')
+            {
+                MaxThreads = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+        }
+        FJobSystemTest::RunScalingBenchmark(NumItems, 5, MaxThreads);
+    }
+    else if (Command == "particle bench" || Command.starts_with("particle bench "))
+    {
+        if (Command.size() > 15)
+        {
+            char* Next = nullptr;
+            const int32 NumParticles = static_cast<int32>(std::strtol(Command.c_str() + 15, &Next, 10));
+            int32 NumFrames = 60;
+            if (Next && *Next != '\0')
+            {
+                NumFrames = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+            FParticleLayoutBenchmark::Run(NumParticles, NumFrames);
+        }
+        else
+        {
+            FParticleLayoutBenchmark::Run(100000, 100);
+            FParticleLayoutBenchmark::Run(1000000, 20);
+        }
+    }
+    else if (Command == "anim compression bench" || Command.starts_with("anim compression bench "))
+    {
+        int32 NumSamples = 100000;
+        if (Command.size() > 23)
+        {
+            NumSamples = std::atoi(Command.c_str() + 23);
+        }
+        FAnimationCompression::RunSamplingBenchmark(NumSamples);
+    }
+    else if (Command == "anim graph bench" || Command.starts_with("anim graph bench "))
+    {
+        int32 NumInstances = 1000;
+        int32 NumFrames = 300;
+        if (Command.size() > 17)
+        {
+            char* Next = nullptr;
+            NumInstances = static_cast<int32>(std::strtol(Command.c_str() + 17, &Next, 10));
+            if (Next && *Next != '\0')
+            {
+                NumFrames = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+        }
+        FAnimGraphBenchmark::Run(TEXT("Contents/AnimGraph/MyAnimGraph.json"), NumInstances, NumFrames);
+    }
+    else if (Command == "mesh simplify test")
+    {
+        const TArray<FString> SamplePaths = {
+            TEXT("Contents/Primitives/CubePrimitive.obj"),
+            TEXT("Contents/Primitives/SpherePrimitive.obj"),
+            TEXT("Contents/Dodge/Car.obj"),
+            TEXT("Contents/Dodge/Car_RemoveWheel.obj"),
+        };
+
+        int32 NumPassed = 0;
+        for (const FString& Path : SamplePaths)
+        {
+            const FStaticMeshRenderData* RenderData = FObjManager::LoadObjStaticMeshAsset(Path);
+            if (!RenderData)
+            {
+                AddLog(ELogLevel::Error, "Failed to load %s", *Path);
+                continue;
+            }
+            NumPassed += FMeshSimplifier::RunSelfTest(*RenderData) ? 1 : 0;
+        }
+        AddLog(NumPassed == SamplePaths.Num() ? ELogLevel::Display : ELogLevel::Error, "Mesh simplifier test: %d / %d meshes passed", NumPassed, SamplePaths.Num());
+    }
+    else if (Command == "mesh optimize test" || Command.starts_with("mesh optimize test "))
+    {
+        int32 GridSize = 64;
+        if (Command.size() > 19)
+        {
+            GridSize = std::atoi(Command.c_str() + 19);
+        }
+        FMeshOptimizer::RunSelfTest(GridSize);
+    }
+    else if (Command == "vertex quantization test" || Command.starts_with("vertex quantization test "))
+    {
+        int32 NumVertices = 1000000;
+        if (Command.size() > 25)
+        {
+            NumVertices = std::atoi(Command.c_str() + 25);
+        }
+        FVertexQuantization::RunSelfTest(NumVertices);
+    }
+    else if (Command == "obj bench" || Command.starts_with("obj bench "))
+    {
+        int32 NumRepeats = 10;
+        if (Command.size() > 10)
+        {
+            NumRepeats = std::atoi(Command.c_str() + 10);
+        }
+        const TArray<FString> SamplePaths = {
+            TEXT("Contents/Cube/cube-tex.obj"),
+            TEXT("Contents/Primitives/CubePrimitive.obj"),
+            TEXT("Contents/Primitives/SpherePrimitive.obj"),
+            TEXT("Contents/Dodge/Car.obj"),
+            TEXT("Contents/Dodge/Car_RemoveWheel.obj"),
+        };
+        FObjLoader::RunParseBenchmark(SamplePaths, NumRepeats);
+    }
+    else if (Command == "light cluster test" || Command.starts_with("light cluster test "))
+    {
+        int32 NumPointLights = 300;
+        int32 NumSpotLights = 200;
+        if (Command.size() > 19)
+        {
+            char* Next = nullptr;
+            NumPointLights = static_cast<int32>(std::strtol(Command.c_str() + 19, &Next, 10));
+            if (Next && *Next != '\0')
+            {
+                NumSpotLights = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+        }
+        const bool bPassed = FLightClusterBuilder::RunSelfTest(FMath::Max(NumPointLights, 0), FMath::Max(NumSpotLights, 0), 8);
+        AddLog(bPassed ? ELogLevel::Display : ELogLevel::Error, "Light cluster test %s", bPassed ? "passed" : "failed");
+    }
+    else if (Command == "physics querybench" || Command.starts_with("physics querybench "))
+    {
+        int32 NumRays = 100000;
+        if (Command.size() > 19)
+        {
+            NumRays = std::atoi(Command.c_str() + 19);
+        }
+        FPhysicsSceneQuery::RunRaycastBenchmark(UPhysicsManager::Get().GetPhysics(), NumRays);
+    }
+    else if (Command == "sound stats")
+    {
+        const FSoundVoiceStats& Stats = FSoundManager::GetInstance().GetStats();
+        AddLog(
+            ELogLevel::Display, "Sound voices: %d real / %d virtual, %d sounds loading, %u stolen, %u rejected",
+            Stats.NumRealVoices, Stats.NumVirtualVoices, Stats.NumLoadingSounds, Stats.NumStolenVoices, Stats.NumRejectedPlays
+        );
+    }
+    else if (Command == "sound test")
+    {
+        const bool bPassed = FSoundManager::RunSelfTest("Contents/Sounds/footprint.mp3");
+        AddLog(bPassed ? ELogLevel::Display : ELogLevel::Error, "Sound voice test %s", bPassed ? "passed" : "failed");
+    }
+    else if (Command == "event bench" || Command.starts_with("event bench "))
+    {
+        int32 NumEvents = 100000;
+        int32 NumFrames = 10;
+        if (Command.size() > 12)
+        {
+            char* Next = nullptr;
+            NumEvents = static_cast<int32>(std::strtol(Command.c_str() + 12, &Next, 10));
+            if (Next && *Next != '\0')
+            {
+                NumFrames = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+        }
+        FEventManager::RunBenchmark(NumEvents, NumFrames);
+    }
+    else if (Command == "delegate bench" || Command.starts_with("delegate bench "))
+    {
+        int32 NumListeners = 64;
+        int32 NumBroadcasts = 10000;
+        if (Command.size() > 15)
+        {
+            char* Next = nullptr;
+            NumListeners = static_cast<int32>(std::strtol(Command.c_str() + 15, &Next, 10));
+            if (Next && *Next != '\0')
+            {
+                NumBroadcasts = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+        }
+        FDelegateBenchmark::Run(NumListeners, NumBroadcasts);
+    }
+    else if (Command == "vehicle test")
+    {
+        FVehicleManager::RunSelfTest();
+    }
+    else if (Command == "vehicle bench" || Command.starts_with("vehicle bench "))
+    {
+        int32 NumVehicles = 256;
+        int32 NumFrames = 300;
+        if (Command.size() > 14)
+        {
+            char* Next = nullptr;
+            NumVehicles = static_cast<int32>(std::strtol(Command.c_str() + 14, &Next, 10));
+            if (Next && *Next != '\0')
+            {
+                NumFrames = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+        }
+        FVehicleManager::RunBenchmark(NumVehicles, NumFrames);
+    }
+    else if (Command == "pie snapshot test" || Command.starts_with("pie snapshot test "))
+    {
+        int32 NumActors = 10000;
+        if (Command.size() > 18)
+        {
+            NumActors = static_cast<int32>(std::strtol(Command.c_str() + 18, nullptr, 10));
+        }
+        FWorldSnapshot::RunSelfTest(NumActors);
+    }
+    else if (Command == "shadow stats")
+    {
+        const FShadowAtlasStats& AtlasStats = FEngineLoop::Renderer.ShadowManager->GetShadowAtlasStats();
+        const uint32 AtlasSize = FEngineLoop::Renderer.ShadowManager->GetLocalLightShadowAtlasSize();
+        AddLog(
+            ELogLevel::Display, "Shadow atlas: %d / %d faces allocated, %d changed, %.1f%% of %ux%u used",
+            AtlasStats.NumAllocated, AtlasStats.NumRequests, AtlasStats.NumChangedRegions,
+            100.0 * static_cast<double>(AtlasStats.UsedTexels) / (static_cast<double>(AtlasSize) * AtlasSize), AtlasSize, AtlasSize
+        );
+
+        const FShadowCasterCacheStats& CacheStats = FEngineLoop::Renderer.ShadowRenderPass->GetCasterCacheStats();
+        AddLog(
+            ELogLevel::Display, "Shadow casters: %d casters (%d dirty), %d faces, %d lists rebuilt / %d reused, %d faces redrawn",
+            CacheStats.NumCasters, CacheStats.NumDirtyCasters, CacheStats.NumFaces, CacheStats.NumRebuiltFaces, CacheStats.NumReusedFaces,
+            FEngineLoop::Renderer.ShadowRenderPass->GetNumRedrawnLocalShadowFaces()
+        );
+    }
+    else if (Command == "shadow test")
+    {
+        const bool bAtlasPassed = FShadowAtlasAllocator::RunSelfTest();
+        const bool bCasterCachePassed = FShadowCasterCache::RunSelfTest();
+        AddLog(bAtlasPassed && bCasterCachePassed ? ELogLevel::Display : ELogLevel::Error, "Shadow test: atlas %s, caster cache %s",
+            bAtlasPassed ? "passed" : "failed", bCasterCachePassed ? "passed" : "failed");
+    }
+    else if (Command == "lua stats")
+    {
+        FLuaScriptManager::Get().LogStats();
+    }
+    else if (Command == "lua startupbench" || Command.starts_with("lua startupbench "))
+    {
+        int32 NumInstances = 1000;
+        if (Command.size() > 17)
+        {
+            NumInstances = std::atoi(Command.c_str() + 17);
+        }
+        FLuaScriptManager::Get().RunStartupBenchmark(NumInstances, FString(TEXT("LuaScripts/template.lua")));
+    }
+    else if (Command == "lua tickbench" || Command.starts_with("lua tickbench "))
+    {
+        int32 NumInstances = 1000;
+        int32 NumFrames = 100;
+        if (Command.size() > 14)
+        {
+            char* Next = nullptr;
+            NumInstances = static_cast<int32>(std::strtol(Command.c_str() + 14, &Next, 10));
+            if (Next && *Next != '\0')
+            {
+                NumFrames = static_cast<int32>(std::strtol(Next, nullptr, 10));
+            }
+        }
+        FLuaScriptManager::Get().RunTickBenchmark(NumInstances, NumFrames);
+    }
     else
     {
         AddLog(ELogLevel::Error, "Unknown command: %s", Command.c_str());
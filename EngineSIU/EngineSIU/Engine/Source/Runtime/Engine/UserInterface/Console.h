@@ -1,5 +1,6 @@
 #pragma once
 #include <format>
+#include <mutex>
 #include "Container/Array.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "HAL/PlatformType.h"
@@ -44,6 +45,7 @@ public:
             uint8 bShowMemory : 1;
             uint8 bShowLight : 1;
             uint8 bShowRender : 1;
+            uint8 bShowAnim : 1;
         };
         uint8 StatFlags = 0; // 기본적으로 다 끄기
     };
@@ -170,6 +172,10 @@ public:
     };
 
     TArray<LogEntry> Items;
+
+    /** Worker Thread에서 Tick되는 컴포넌트도 로그를 남길 수 있도록 Items의 추가, 삭제, Draw의 순회를 보호 */
+    std::mutex ItemsMutex;
+
     TArray<FString> History;
     int32 HistoryPos = -1;
     char InputBuf[256] = "";
@@ -0,0 +1,314 @@
+#include "TickTaskManager.h"
+
+#include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Stats/CpuProfiler.h"
+#include "Stats/Stats.h"
+
+std::mutex FTickTaskManager::GameThreadTaskMutex;
+TArray<TFunction<void()>> FTickTaskManager::PendingGameThreadTasks;
+
+namespace
+{
+    thread_local bool GIsInParallelTick = false;
+}
+
+void FTickTaskManager::RegisterActor(AActor* Actor)
+{
+    if (!Actor || Actor->bRegisteredForTick)
+    {
+        return;
+    }
+
+    Groups[Actor->GetActorTickGroup()].Actors.Add(Actor);
+    Actor->bRegisteredForTick = true;
+
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        RegisterComponent(Component);
+    }
+}
+
+void FTickTaskManager::UnregisterActor(AActor* Actor)
+{
+    if (!Actor || !Actor->bRegisteredForTick)
+    {
+        return;
+    }
+
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        UnregisterComponent(Component);
+    }
+
+    TArray<AActor*>& Actors = Groups[Actor->GetActorTickGroup()].Actors;
+    if (bInFrame)
+    {
+        // Tick 도중에는 배열을 건드리지 않고, EndFrame에서 정리
+        if (const int32 Index = Actors.Find(Actor); Index != INDEX_NONE)
+        {
+            Actors[Index] = nullptr;
+            bNeedsCompaction = true;
+        }
+    }
+    else
+    {
+        Actors.Remove(Actor);
+    }
+
+    Actor->bRegisteredForTick = false;
+}
+
+void FTickTaskManager::RegisterComponent(UActorComponent* Component)
+{
+    if (!Component || Component->bRegisteredForTick || !Component->CanEverTick())
+    {
+        return;
+    }
+
+    FTickGroupList& List = Groups[Component->GetTickGroup()];
+    if (Component->CanRunTickOnAnyThread())
+    {
+        List.ParallelComponents.Add(Component);
+    }
+    else
+    {
+        List.Components.Add(Component);
+    }
+    Component->bRegisteredForTick = true;
+}
+
+void FTickTaskManager::UnregisterComponent(UActorComponent* Component)
+{
+    if (!Component || !Component->bRegisteredForTick)
+    {
+        return;
+    }
+
+    FTickGroupList& List = Groups[Component->GetTickGroup()];
+    TArray<UActorComponent*>& Components = Component->CanRunTickOnAnyThread() ? List.ParallelComponents : List.Components;
+    if (bInFrame)
+    {
+        if (const int32 Index = Components.Find(Component); Index != INDEX_NONE)
+        {
+            Components[Index] = nullptr;
+            bNeedsCompaction = true;
+        }
+    }
+    else
+    {
+        Components.Remove(Component);
+    }
+
+    Component->bRegisteredForTick = false;
+}
+
+void FTickTaskManager::Clear()
+{
+    for (FTickGroupList& List : Groups)
+    {
+        for (AActor* Actor : List.Actors)
+        {
+            if (Actor)
+            {
+                Actor->bRegisteredForTick = false;
+            }
+        }
+        for (UActorComponent* Component : List.Components)
+        {
+            if (Component)
+            {
+                Component->bRegisteredForTick = false;
+            }
+        }
+        for (UActorComponent* Component : List.ParallelComponents)
+        {
+            if (Component)
+            {
+                Component->bRegisteredForTick = false;
+            }
+        }
+
+        List.Actors.Empty();
+        List.Components.Empty();
+        List.ParallelComponents.Empty();
+    }
+
+    ParallelTickScratch.Empty();
+    bNeedsCompaction = false;
+}
+
+void FTickTaskManager::StartFrame(float DeltaTime, bool bInTickInEditorOnly)
+{
+    assert(!bInFrame);
+
+    FrameDeltaTime = DeltaTime;
+    bTickInEditorOnly = bInTickInEditorOnly;
+    bInFrame = true;
+
+    for (FTickGroupStats& Stats : GroupStats)
+    {
+        Stats = FTickGroupStats();
+    }
+}
+
+void FTickTaskManager::RunTickGroup(ETickingGroup Group)
+{
+    assert(bInFrame);
+
+    FCpuProfiler::BeginScope();
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    FTickGroupList& List = Groups[Group];
+    FTickGroupStats& Stats = GroupStats[Group];
+
+    // Tick 도중 새로 등록된 Actor와 Component도 이번 프레임에 Tick되도록 매번 Num()을 다시 확인
+    for (int32 Index = 0; Index < List.Actors.Num(); ++Index)
+    {
+        AActor* Actor = List.Actors[Index];
+        if (Actor && ShouldTickActor(Actor))
+        {
+            Actor->Tick(FrameDeltaTime);
+            ++Stats.NumActorTicks;
+        }
+    }
+
+    for (int32 Index = 0; Index < List.Components.Num(); ++Index)
+    {
+        UActorComponent* Component = List.Components[Index];
+        if (Component && ShouldTickComponent(Component))
+        {
+            Component->TickComponent(FrameDeltaTime);
+            ++Stats.NumComponentTicks;
+        }
+    }
+
+    ParallelTickScratch.Empty();
+    for (UActorComponent* Component : List.ParallelComponents)
+    {
+        if (Component && ShouldTickComponent(Component))
+        {
+            ParallelTickScratch.Add(Component);
+        }
+    }
+
+    if (ParallelTickScratch.Num() > 0)
+    {
+        const uint64 ParallelStartCycles = FPlatformTime::Cycles64();
+
+        const float DeltaTime = FrameDeltaTime;
+        FJobSystem::Get().ParallelFor(ParallelTickScratch.Num(), [this, DeltaTime](int32 Index)
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(ParallelComponentTick)
+            GIsInParallelTick = true;
+            ParallelTickScratch[Index]->TickComponent(DeltaTime);
+            GIsInParallelTick = false;
+        });
+
+        Stats.ParallelElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ParallelStartCycles);
+        Stats.NumParallelComponentTicks = ParallelTickScratch.Num();
+
+        FlushGameThreadTasks();
+
+        for (UActorComponent* Component : ParallelTickScratch)
+        {
+            // 앞선 CompleteParallelTick에서 제거된 컴포넌트는 건너뜀
+            if (Component->IsRegisteredForTick())
+            {
+                Component->CompleteParallelTick(DeltaTime);
+            }
+        }
+    }
+
+    FlushGameThreadTasks();
+
+    // 여러 World가 같은 Stat 이름을 쓰므로 FProfilerStatsManager에는 UWorld가 따로 기록하고, 여기서는 계층 기록만 남김
+    const uint64 EndCycles = FPlatformTime::Cycles64();
+    FCpuProfiler::EndScope(GetGroupStatId(Group), StartCycles, EndCycles);
+
+    Stats.ElapsedMs = FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+}
+
+void FTickTaskManager::EndFrame()
+{
+    assert(bInFrame);
+
+    FlushGameThreadTasks();
+
+    bInFrame = false;
+    if (bNeedsCompaction)
+    {
+        CompactLists();
+        bNeedsCompaction = false;
+    }
+}
+
+TStatId FTickTaskManager::GetGroupStatId(ETickingGroup Group)
+{
+    static const TStatId StatIds[TG_MAX] =
+    {
+        FName(TEXT("TickGroup_PrePhysics")),
+        FName(TEXT("TickGroup_DuringPhysics")),
+        FName(TEXT("TickGroup_PostPhysics")),
+        FName(TEXT("TickGroup_PostUpdateWork")),
+    };
+    return StatIds[Group];
+}
+
+void FTickTaskManager::EnqueueGameThreadTask(TFunction<void()> Task)
+{
+    std::lock_guard Lock(GameThreadTaskMutex);
+    PendingGameThreadTasks.Add(std::move(Task));
+}
+
+bool FTickTaskManager::IsInParallelTick()
+{
+    return GIsInParallelTick;
+}
+
+bool FTickTaskManager::ShouldTickActor(const AActor* Actor) const
+{
+    return !bTickInEditorOnly || Actor->IsActorTickInEditor();
+}
+
+bool FTickTaskManager::ShouldTickComponent(const UActorComponent* Component) const
+{
+    if (!bTickInEditorOnly)
+    {
+        return true;
+    }
+
+    const AActor* Owner = Component->GetOwner();
+    return Owner && Owner->IsActorTickInEditor();
+}
+
+void FTickTaskManager::CompactLists()
+{
+    for (FTickGroupList& List : Groups)
+    {
+        List.Actors.RemoveAll([](const AActor* Actor) { return Actor == nullptr; });
+        List.Components.RemoveAll([](const UActorComponent* Component) { return Component == nullptr; });
+        List.ParallelComponents.RemoveAll([](const UActorComponent* Component) { return Component == nullptr; });
+    }
+}
+
+void FTickTaskManager::FlushGameThreadTasks()
+{
+    TArray<TFunction<void()>> Tasks;
+    {
+        std::lock_guard Lock(GameThreadTaskMutex);
+        if (PendingGameThreadTasks.IsEmpty())
+        {
+            return;
+        }
+        Tasks = std::move(PendingGameThreadTasks);
+        PendingGameThreadTasks.Empty();
+    }
+
+    for (TFunction<void()>& Task : Tasks)
+    {
+        Task();
+    }
+}
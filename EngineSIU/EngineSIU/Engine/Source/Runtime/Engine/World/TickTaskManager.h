@@ -0,0 +1,111 @@
+#pragma once
+#include <mutex>
+
+#include "Container/Array.h"
+#include "Engine/EngineTypes.h"
+#include "HAL/PlatformType.h"
+#include "Stats/StatDefine.h"
+#include "Templates/Function.h"
+
+class AActor;
+class UActorComponent;
+
+
+/** 한 TickGroup의 마지막 프레임 실행 결과 */
+struct FTickGroupStats
+{
+    /** TickGroup 전체(Actor, Game Thread 컴포넌트, 병렬 컴포넌트, 후처리)에 걸린 시간 */
+    double ElapsedMs = 0.0;
+
+    /** 병렬 구간(Worker Thread에서 TickComponent가 실행된 구간)에 걸린 시간 */
+    double ParallelElapsedMs = 0.0;
+
+    int32 NumActorTicks = 0;
+    int32 NumComponentTicks = 0;
+    int32 NumParallelComponentTicks = 0;
+};
+
+/**
+ * World에 등록된 Actor와 Component의 Tick을 TickGroup 단위로 실행합니다.
+ *
+ * Actor와 Component는 Spawn/AddComponent 시점에 한 번 등록되고, 제거될 때 등록 해제됩니다.
+ * 각 TickGroup은 Actor Tick → Game Thread 컴포넌트 Tick → 병렬 컴포넌트 Tick → CompleteParallelTick 순서로 실행됩니다.
+ * bRunTickOnAnyThread인 컴포넌트는 FJobSystem의 Worker Thread에서 동시에 Tick됩니다.
+ */
+class FTickTaskManager
+{
+public:
+    FTickTaskManager() = default;
+    ~FTickTaskManager() = default;
+
+    FTickTaskManager(const FTickTaskManager&) = delete;
+    FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+    FTickTaskManager(FTickTaskManager&&) = delete;
+    FTickTaskManager& operator=(FTickTaskManager&&) = delete;
+
+    /** Actor와 Actor가 소유한 모든 Component를 등록합니다. */
+    void RegisterActor(AActor* Actor);
+
+    /** Actor와 Actor가 소유한 모든 Component의 등록을 해제합니다. */
+    void UnregisterActor(AActor* Actor);
+
+    void RegisterComponent(UActorComponent* Component);
+    void UnregisterComponent(UActorComponent* Component);
+
+    /** 등록된 모든 Actor와 Component를 제거합니다. */
+    void Clear();
+
+    /**
+     * 프레임을 시작합니다. 이후 RunTickGroup을 TickGroup 순서대로 호출하고, 마지막에 EndFrame을 호출해야 합니다.
+     * @param DeltaTime 이번 프레임의 DeltaTime
+     * @param bInTickInEditorOnly true라면 IsActorTickInEditor()인 Actor와 그 Component만 Tick합니다.
+     */
+    void StartFrame(float DeltaTime, bool bInTickInEditorOnly);
+    void RunTickGroup(ETickingGroup Group);
+    void EndFrame();
+
+    const FTickGroupStats& GetGroupStats(ETickingGroup Group) const { return GroupStats[Group]; }
+
+    /** Profiler에 표시될 TickGroup의 Stat 이름을 반환합니다. */
+    static TStatId GetGroupStatId(ETickingGroup Group);
+
+    /**
+     * Game Thread에서 실행되어야 하는 작업을 예약합니다. 어느 스레드에서든 호출할 수 있습니다.
+     * 예약된 작업은 현재 TickGroup의 병렬 구간이 끝난 직후 Game Thread에서 실행됩니다.
+     */
+    static void EnqueueGameThreadTask(TFunction<void()> Task);
+
+    /** 현재 스레드가 병렬 구간에서 컴포넌트를 Tick하는 중인지 여부를 반환합니다. Game Thread도 병렬 구간의 일부를 처리합니다. */
+    static bool IsInParallelTick();
+
+private:
+    struct FTickGroupList
+    {
+        TArray<AActor*> Actors;
+        TArray<UActorComponent*> Components;
+        TArray<UActorComponent*> ParallelComponents;
+    };
+
+    bool ShouldTickActor(const AActor* Actor) const;
+    bool ShouldTickComponent(const UActorComponent* Component) const;
+
+    /** 프레임 도중 등록 해제되어 nullptr로 남아있는 항목들을 제거합니다. */
+    void CompactLists();
+
+    static void FlushGameThreadTasks();
+
+private:
+    FTickGroupList Groups[TG_MAX];
+    FTickGroupStats GroupStats[TG_MAX];
+
+    /** 병렬 구간에서 Tick할 컴포넌트들, 매 프레임 재사용 */
+    TArray<UActorComponent*> ParallelTickScratch;
+
+    float FrameDeltaTime = 0.0f;
+    bool bTickInEditorOnly = false;
+    bool bInFrame = false;
+    bool bNeedsCompaction = false;
+
+    static std::mutex GameThreadTaskMutex;
+    static TArray<TFunction<void()>> PendingGameThreadTasks;
+};
@@ -16,6 +16,9 @@
 #include "GameFramework/GameMode.h"
 #include "Classes/Components/TextComponent.h"
 #include "Contents/Actors/Fish.h"
+#include "Engine/PhysicsManager.h"
+#include "Stats/ProfilerStatsManager.h"
+#include "WorldSnapshot.h"
 
 class UEditorEngine;
 
@@ -101,14 +104,9 @@ void UWorld::InitializeLightScene()
 
 UObject* UWorld::Duplicate(UObject* InOuter)
 {
-    // TODO: UWorld의 Duplicate는 역할 분리후 만드는것이 좋을듯
-    UWorld* NewWorld = Cast<UWorld>(Super::Duplicate(InOuter));
-    NewWorld->ActiveLevel = Cast<ULevel>(ActiveLevel->Duplicate(NewWorld));
-    NewWorld->ActiveLevel->InitLevel(NewWorld);
-    
-    NewWorld->CollisionManager = new FCollisionManager();
-    
-    return NewWorld;
+    FWorldSnapshot Snapshot;
+    Snapshot.Capture(this);
+    return Snapshot.Instantiate(InOuter);
 }
 
 void UWorld::Tick(float DeltaTime)
@@ -126,6 +124,44 @@ void UWorld::Tick(float DeltaTime)
     }
 }
 
+void UWorld::RunTickGroups(float DeltaTime, bool bTickInEditorOnly, bool bSimulatePhysics)
+{
+    TickTaskManager.StartFrame(DeltaTime, bTickInEditorOnly);
+
+    TickTaskManager.RunTickGroup(TG_PrePhysics);
+
+    // Physics 시뮬레이션이 진행되는 동안 Physics와 무관한 TickGroup을 실행
+    if (bSimulatePhysics)
+    {
+        UPhysicsManager::Get().StartSimulation(DeltaTime);
+    }
+
+    TickTaskManager.RunTickGroup(TG_DuringPhysics);
+
+    if (bSimulatePhysics)
+    {
+        UPhysicsManager::Get().FinishSimulation();
+    }
+
+    TickTaskManager.RunTickGroup(TG_PostPhysics);
+    TickTaskManager.RunTickGroup(TG_PostUpdateWork);
+
+    TickTaskManager.EndFrame();
+
+    // 이번 프레임에 Enqueue한 이벤트는 모든 Tick이 끝난 뒤에 전달
+    EventManager.FlushQueuedEvents();
+
+    // Profiler는 Stat 이름 하나당 값 하나만 가지므로, 현재 보고 있는 World의 값만 기록
+    if (GEngine && GEngine->ActiveWorld == this)
+    {
+        for (int32 Group = 0; Group < TG_MAX; ++Group)
+        {
+            const ETickingGroup TickGroup = static_cast<ETickingGroup>(Group);
+            FProfilerStatsManager::AddCpuStat(FTickTaskManager::GetGroupStatId(TickGroup), TickTaskManager.GetGroupStats(TickGroup).ElapsedMs);
+        }
+    }
+}
+
 void UWorld::BeginPlay()
 {
     if (!GameMode && this->WorldType == EWorldType::PIE)
@@ -201,6 +237,9 @@ void UWorld::BeginPlay()
 
 void UWorld::Release()
 {
+    TickTaskManager.Clear();
+    EventManager.Clear();
+
     if (ActiveLevel)
     {
         ActiveLevel->Release();
@@ -214,7 +253,8 @@ void UWorld::Release()
         CollisionManager = nullptr;
     }
     
-    GUObjectArray.ProcessPendingDestroyObjects();
+    // 이 World의 객체만 해제, 다른 World가 이번 프레임에 지운 객체는 EngineLoop의 전체 처리에서 해제
+    GUObjectArray.ProcessPendingDestroyObjects(this);
 }
 
 AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
@@ -244,6 +284,8 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
         {
             NewActor->SetRootComponent(NewActor->AddComponent<USceneComponent>());
         }
+
+        TickTaskManager.RegisterActor(NewActor);
         
         return NewActor;
     }
@@ -268,6 +310,8 @@ bool UWorld::DestroyActor(AActor* ThisActor)
     //
     // Engine->DeselectActor(ThisActor);
 
+    TickTaskManager.UnregisterActor(ThisActor);
+
     // 액터의 Destroyed 호출
     ThisActor->Destroyed();
 
@@ -5,6 +5,8 @@
 #include "UObject/ObjectMacros.h"
 #include "WorldType.h"
 #include "Level.h"
+#include "TickTaskManager.h"
+#include "WorldSnapshot.h"
 #include "Actors/Player.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/CameraComponent.h"
@@ -27,6 +29,7 @@ class UTextComponent;
 class UWorld : public UObject
 {
     DECLARE_CLASS(UWorld, UObject)
+    friend class FWorldSnapshot;
 
 public:
     UWorld() = default;
@@ -40,6 +43,16 @@ public:
     virtual void Tick(float DeltaTime);
     void BeginPlay();
 
+    /**
+     * 등록된 Actor와 Component를 TickGroup 순서대로 Tick합니다.
+     * @param DeltaTime 이번 프레임의 DeltaTime
+     * @param bTickInEditorOnly true라면 IsActorTickInEditor()인 Actor만 Tick합니다.
+     * @param bSimulatePhysics true라면 TG_DuringPhysics 동안 Physics 시뮬레이션을 진행합니다.
+     */
+    void RunTickGroups(float DeltaTime, bool bTickInEditorOnly, bool bSimulatePhysics);
+
+    FTickTaskManager& GetTickTaskManager() { return TickTaskManager; }
+
     void Release();
 
     /**
@@ -98,6 +111,9 @@ private:
     /** Actor가 Spawn되었고, 아직 BeginPlay가 호출되지 않은 Actor들 */
     TArray<AActor*> PendingBeginPlayActors;
 
+    /** 이 World에 등록된 Actor와 Component의 Tick을 TickGroup별로 관리 */
+    FTickTaskManager TickTaskManager;
+
     // TODO: 싱글 플레이어면 상관 없지만, 로컬 멀티 플레이어인 경우를 위해 배열로 관리하는 방법을 고려하기.
     APlayerController* PlayerController = nullptr;
 
@@ -122,9 +138,10 @@ T* UWorld::DuplicateActor(T* InActor)
 {
     if (ULevel* ActiveLevel = GetActiveLevel())
     {
-        T* NewActor = static_cast<T*>(InActor->Duplicate(this));
+        T* NewActor = static_cast<T*>(FWorldSnapshot::DuplicateActor(InActor, this));
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+        TickTaskManager.RegisterActor(NewActor);
         return NewActor;
     }
     return nullptr;
@@ -0,0 +1,650 @@
+#include "WorldSnapshot.h"
+
+#include <cstring>
+
+#include "CollisionManager.h"
+#include "World.h"
+#include "WindowsPlatformTime.h"
+#include "Actors/AmbientLightActor.h"
+#include "Actors/CapsuleActor.h"
+#include "Actors/Cube.h"
+#include "Actors/DirectionalLightActor.h"
+#include "Actors/HeightFogActor.h"
+#include "Actors/PointLightActor.h"
+#include "Actors/SphereActor.h"
+#include "Actors/SpotLightActor.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/HeightFogComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/Light/AmbientLightComponent.h"
+#include "Components/Light/DirectionalLightComponent.h"
+#include "Components/Light/PointLightComponent.h"
+#include "Components/Light/SpotLightComponent.h"
+#include "GameFramework/Actor.h"
+#include "LuaScripts/LuaScriptComponent.h"
+#include "UObject/Casts.h"
+#include "UObject/ObjectArena.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectSnapshotArchive.h"
+#include "UserInterface/Console.h"
+
+void FWorldSnapshot::Capture(UWorld* World)
+{
+    ULevel* Level = World->GetActiveLevel();
+    CaptureObjects({ World, Level }, Level->Actors);
+}
+
+void FWorldSnapshot::CaptureActor(AActor* Actor)
+{
+    CaptureObjects({}, { Actor });
+}
+
+void FWorldSnapshot::CaptureObjects(const TArray<UObject*>& RootObjects, const TArray<AActor*>& Actors)
+{
+    Objects.Empty();
+    Data.Empty();
+    ObjectMemorySize = 0;
+    NumRootObjects = RootObjects.Num();
+
+    int32 NumObjects = NumRootObjects;
+    for (const AActor* Actor : Actors)
+    {
+        NumObjects += 1 + Actor->GetComponents().Num();
+    }
+
+    TArray<UObject*> Sources;
+    TMap<const UObject*, int32> ObjectIndices;
+    Sources.Reserve(NumObjects);
+    ObjectIndices.Reserve(NumObjects);
+    Objects.Reserve(NumObjects);
+
+    auto AddObject = [&](UObject* Object)
+    {
+        ObjectIndices.Add(Object, Sources.Num());
+        Sources.Add(Object);
+
+        FWorldSnapshotObject& Record = Objects[Objects.AddDefaulted()];
+        Record.Class = Object->GetClass();
+        Record.Name = Object->GetFName();
+
+        const size_t Alignment = Record.Class->GetMinAlignment();
+        ObjectMemorySize = ((ObjectMemorySize + Alignment - 1) & ~(Alignment - 1)) + Record.Class->GetStructSize();
+    };
+
+    // 1. 객체 테이블, 참조를 Index로 바꾸려면 Serialize 전에 모든 객체가 테이블에 있어야 함
+    for (UObject* Object : RootObjects)
+    {
+        AddObject(Object);
+    }
+
+    TArray<UActorComponent*> Components;
+    for (AActor* Actor : Actors)
+    {
+        const int32 ActorIndex = Objects.Num();
+        AddObject(Actor);
+
+        // TSet의 순회 순서는 포인터 값에 따라 달라지므로, 같은 World는 항상 같은 Snapshot이 되도록 이름 순으로 정렬
+        Components.Empty();
+        for (UActorComponent* Component : Actor->GetComponents())
+        {
+            Components.Add(Component);
+        }
+        Components.Sort([](const UActorComponent* A, const UActorComponent* B)
+        {
+            const FName NameA = A->GetFName();
+            const FName NameB = B->GetFName();
+            if (NameA.GetComparisonIndex() != NameB.GetComparisonIndex())
+            {
+                return NameA.GetComparisonIndex() < NameB.GetComparisonIndex();
+            }
+            return NameA.GetDisplayIndex() < NameB.GetDisplayIndex();
+        });
+
+        for (UActorComponent* Component : Components)
+        {
+            AddObject(Component);
+        }
+        Objects[ActorIndex].NumComponents = Components.Num();
+    }
+
+    // 2. 테이블 안의 소유, 부착 관계
+    auto FindIndex = [&ObjectIndices](const UObject* Object)
+    {
+        const int32* Index = ObjectIndices.Find(Object);
+        return Index ? *Index : INDEX_NONE;
+    };
+
+    for (int32 Index = 0; Index < Sources.Num(); ++Index)
+    {
+        FWorldSnapshotObject& Record = Objects[Index];
+        Record.OuterIndex = FindIndex(Sources[Index]->GetOuter());
+
+        if (Record.NumComponents > 0)
+        {
+            Record.RootComponentIndex = FindIndex(static_cast<AActor*>(Sources[Index])->GetRootComponent());
+        }
+        else if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Sources[Index]))
+        {
+            Record.AttachParentIndex = FindIndex(SceneComponent->GetAttachParent());
+        }
+    }
+
+    // 3. 프로퍼티
+    FObjectSnapshotWriter Writer(Data, &ObjectIndices);
+    for (int32 Index = 0; Index < Sources.Num(); ++Index)
+    {
+        FWorldSnapshotObject& Record = Objects[Index];
+        Record.DataOffset = Data.Num();
+        Sources[Index]->Serialize(Writer);
+        Record.DataSize = Data.Num() - Record.DataOffset;
+    }
+}
+
+UWorld* FWorldSnapshot::Instantiate(UObject* InOuter, FObjectArena* Arena) const
+{
+    if (NumRootObjects != 2)
+    {
+        return nullptr;
+    }
+
+    FScopedObjectArena ArenaScope(Arena);
+    FScopedObjectLogSuppression LogSuppression;
+
+    TArray<UObject*> NewObjects;
+    InstantiateObjects(InOuter, false, NewObjects);
+
+    UWorld* NewWorld = static_cast<UWorld*>(NewObjects[0]);
+    ULevel* NewLevel = static_cast<ULevel*>(NewObjects[1]);
+    NewWorld->ActiveLevel = NewLevel;
+    NewLevel->InitLevel(NewWorld);
+
+    for (AActor* Actor : NewLevel->Actors)
+    {
+        NewWorld->TickTaskManager.RegisterActor(Actor);
+    }
+
+    NewWorld->CollisionManager = new FCollisionManager();
+
+    return NewWorld;
+}
+
+AActor* FWorldSnapshot::InstantiateActor(UObject* InOuter) const
+{
+    if (NumRootObjects != 0 || Objects.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    TArray<UObject*> NewObjects;
+    InstantiateObjects(InOuter, true, NewObjects);
+    return static_cast<AActor*>(NewObjects[0]);
+}
+
+AActor* FWorldSnapshot::DuplicateActor(AActor* Actor, UObject* InOuter)
+{
+    FWorldSnapshot Snapshot;
+    Snapshot.CaptureActor(Actor);
+    return Snapshot.InstantiateActor(InOuter);
+}
+
+void FWorldSnapshot::InstantiateObjects(UObject* InOuter, bool bRenameActors, TArray<UObject*>& NewObjects) const
+{
+    NewObjects.SetNum(Objects.Num());
+
+    auto GetOuter = [&](int32 OuterIndex)
+    {
+        return OuterIndex == INDEX_NONE ? InOuter : NewObjects[OuterIndex];
+    };
+
+    // 1. 객체 생성, World와 Level을 만든 뒤 Actor와 Component를 만듦
+    for (int32 Index = 0; Index < NumRootObjects; ++Index)
+    {
+        const FWorldSnapshotObject& Record = Objects[Index];
+        NewObjects[Index] = FObjectFactory::ConstructObject(Record.Class, GetOuter(Record.OuterIndex), Record.Name);
+    }
+
+    TArray<UActorComponent*> DefaultComponents;
+    TArray<UActorComponent*> UnusedDefaultComponents;
+    for (int32 ActorIndex = NumRootObjects; ActorIndex < Objects.Num(); ActorIndex += 1 + Objects[ActorIndex].NumComponents)
+    {
+        const FWorldSnapshotObject& ActorRecord = Objects[ActorIndex];
+        // 같은 World 안에 복제할 때는 Actor 이름이 겹치지 않도록 새 이름을 받음, Component 이름은 Actor 안에서만 구분되므로 그대로 둠
+        AActor* NewActor = static_cast<AActor*>(
+            FObjectFactory::ConstructObject(ActorRecord.Class, GetOuter(ActorRecord.OuterIndex), bRenameActors ? NAME_None : ActorRecord.Name)
+        );
+        NewObjects[ActorIndex] = NewActor;
+
+        // 생성자가 만든 기본 Component는 이름과 Class가 같으면 그대로 사용
+        DefaultComponents.Empty();
+        for (UActorComponent* Component : NewActor->OwnedComponents)
+        {
+            DefaultComponents.Add(Component);
+        }
+
+        for (int32 Index = ActorIndex + 1; Index <= ActorIndex + ActorRecord.NumComponents; ++Index)
+        {
+            const FWorldSnapshotObject& Record = Objects[Index];
+
+            UActorComponent* NewComponent = nullptr;
+            for (int32 DefaultIndex = 0; DefaultIndex < DefaultComponents.Num(); ++DefaultIndex)
+            {
+                UActorComponent* DefaultComponent = DefaultComponents[DefaultIndex];
+                if (DefaultComponent->GetFName() == Record.Name && DefaultComponent->GetClass() == Record.Class)
+                {
+                    NewComponent = DefaultComponent;
+                    DefaultComponents.RemoveAt(DefaultIndex);
+                    break;
+                }
+            }
+
+            if (!NewComponent)
+            {
+                NewComponent = static_cast<UActorComponent*>(
+                    FObjectFactory::ConstructObject(Record.Class, GetOuter(Record.OuterIndex), Record.Name)
+                );
+                NewActor->OwnedComponents.Add(NewComponent);
+            }
+            NewObjects[Index] = NewComponent;
+        }
+
+        UnusedDefaultComponents.Append(DefaultComponents);
+    }
+
+    // 2. 프로퍼티, 참조는 NewObjects의 객체로 바뀜
+    FObjectSnapshotReader Reader(Data, &NewObjects);
+    for (int32 Index = 0; Index < Objects.Num(); ++Index)
+    {
+        Reader.Seek(Objects[Index].DataOffset);
+        NewObjects[Index]->Serialize(Reader);
+    }
+
+    // 3. Root, 부착 관계, World를 담았다면 Level에 Actor 추가
+    ULevel* NewLevel = NumRootObjects == 2 ? static_cast<ULevel*>(NewObjects[1]) : nullptr;
+
+    for (int32 ActorIndex = NumRootObjects; ActorIndex < Objects.Num(); ActorIndex += 1 + Objects[ActorIndex].NumComponents)
+    {
+        const FWorldSnapshotObject& ActorRecord = Objects[ActorIndex];
+        AActor* NewActor = static_cast<AActor*>(NewObjects[ActorIndex]);
+
+        NewActor->RootComponent = ActorRecord.RootComponentIndex != INDEX_NONE
+            ? static_cast<USceneComponent*>(NewObjects[ActorRecord.RootComponentIndex])
+            : nullptr;
+
+        for (int32 Index = ActorIndex + 1; Index <= ActorIndex + ActorRecord.NumComponents; ++Index)
+        {
+            if (USceneComponent* SceneComponent = Cast<USceneComponent>(NewObjects[Index]))
+            {
+                const int32 ParentIndex = Objects[Index].AttachParentIndex;
+                USceneComponent* Parent = ParentIndex != INDEX_NONE ? static_cast<USceneComponent*>(NewObjects[ParentIndex]) : nullptr;
+                if (SceneComponent->GetAttachParent() != Parent)
+                {
+                    SceneComponent->AttachToComponent(Parent);
+                }
+            }
+        }
+
+        if (NewLevel)
+        {
+            NewLevel->Actors.Add(NewActor);
+        }
+    }
+
+    // 다른 Component가 모두 제자리에 붙은 뒤에 지워야 자식으로 붙어 있던 Component가 함께 지워지지 않음
+    for (UActorComponent* Component : UnusedDefaultComponents)
+    {
+        Component->DestroyComponent(true);
+    }
+
+    for (int32 ActorIndex = NumRootObjects; ActorIndex < Objects.Num(); ActorIndex += 1 + Objects[ActorIndex].NumComponents)
+    {
+        for (int32 Index = ActorIndex + 1; Index <= ActorIndex + Objects[ActorIndex].NumComponents; ++Index)
+        {
+            UActorComponent* Component = static_cast<UActorComponent*>(NewObjects[Index]);
+            /* ActorComponent가 Actor와 World에 등록이 되었다는 전제하에 호출됩니다 */
+            if (!Component->HasBeenInitialized())
+            {
+                // TODO: RegisterComponent() 생기면 제거
+                Component->InitializeComponent();
+            }
+        }
+    }
+}
+
+bool FWorldSnapshot::Matches(const FWorldSnapshot& Other) const
+{
+    if (Objects.Num() != Other.Objects.Num())
+    {
+        UE_LOG(ELogLevel::Error, TEXT("World snapshot mismatch: %d objects, expected %d"), Other.Objects.Num(), Objects.Num());
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Objects.Num(); ++Index)
+    {
+        const FWorldSnapshotObject& Record = Objects[Index];
+        const FWorldSnapshotObject& OtherRecord = Other.Objects[Index];
+
+        const bool bSameLayout = Record.Class == OtherRecord.Class
+            && Record.Name == OtherRecord.Name
+            && Record.OuterIndex == OtherRecord.OuterIndex
+            && Record.NumComponents == OtherRecord.NumComponents
+            && Record.RootComponentIndex == OtherRecord.RootComponentIndex
+            && Record.AttachParentIndex == OtherRecord.AttachParentIndex;
+
+        const bool bSameData = Record.DataSize == OtherRecord.DataSize
+            && (Record.DataSize == 0
+                || std::memcmp(Data.GetData() + Record.DataOffset, Other.Data.GetData() + OtherRecord.DataOffset, Record.DataSize) == 0);
+
+        if (!bSameLayout || !bSameData)
+        {
+            UE_LOG(
+                ELogLevel::Error, TEXT("World snapshot mismatch at object %d (%s): %s differ"),
+                Index, *Record.Name.ToString(), bSameLayout ? TEXT("properties") : TEXT("owner or attachment")
+            );
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace
+{
+    /** 원본의 조립 상태를 복제본과 비교하기 위한 값 설정, 기본값 그대로면 복사되지 않아도 같아 보이므로 모두 바꿔 둠 */
+    void CustomizeSnapshotTestActor(AActor* Actor, int32 Index)
+    {
+        const float Value = static_cast<float>(Index % 17);
+
+        if (UPointLightComponent* PointLight = Actor->GetComponentByClass<UPointLightComponent>())
+        {
+            PointLight->SetRadius(10.f + Value);
+            PointLight->SetIntensity(100.f + Value);
+            PointLight->SetLightColor(FLinearColor(Value / 17.f, 0.5f, 0.25f, 1.f));
+        }
+        if (USpotLightComponent* SpotLight = Actor->GetComponentByClass<USpotLightComponent>())
+        {
+            SpotLight->SetRadius(20.f + Value);
+            SpotLight->SetInnerDegree(10.f + Value);
+            SpotLight->SetOuterDegree(30.f + Value);
+        }
+        if (UDirectionalLightComponent* DirectionalLight = Actor->GetComponentByClass<UDirectionalLightComponent>())
+        {
+            DirectionalLight->SetIntensity(2.f + Value);
+        }
+        if (UAmbientLightComponent* AmbientLight = Actor->GetComponentByClass<UAmbientLightComponent>())
+        {
+            AmbientLight->SetLightColor(FLinearColor(0.1f, Value / 17.f, 0.3f, 1.f));
+        }
+        if (UHeightFogComponent* HeightFog = Actor->GetComponentByClass<UHeightFogComponent>())
+        {
+            HeightFog->SetFogDensity(0.01f * (1.f + Value));
+            HeightFog->SetFogColor(FLinearColor(0.2f, 0.3f, Value / 17.f, 1.f));
+        }
+        if (USphereComponent* Sphere = Actor->GetComponentByClass<USphereComponent>())
+        {
+            Sphere->SetRadius(1.f + Value);
+        }
+        if (UCapsuleComponent* Capsule = Actor->GetComponentByClass<UCapsuleComponent>())
+        {
+            Capsule->SetHalfHeight(2.f + Value);
+        }
+
+        // InitializeComponent가 만드는 템플릿 경로와 다른 경로를 줘서 복제본이 원본의 경로를 가져오는지 확인
+        if (Index % 4 == 0)
+        {
+            ULuaScriptComponent* LuaScript = Actor->AddComponent<ULuaScriptComponent>(FName("LuaScriptComponent_0"));
+            LuaScript->SetScriptPath(FString::Printf(TEXT("LuaScripts/SnapshotTest_%d.lua"), Index));
+            LuaScript->SetDisplayName(FString::Printf(TEXT("SnapshotTest_%d.lua"), Index));
+        }
+    }
+}
+
+bool FWorldSnapshot::RunSelfTest(int32 NumActors)
+{
+    if (NumActors <= 0)
+    {
+        return false;
+    }
+
+    FScopedObjectLogSuppression LogSuppression;
+
+    UWorld* SourceWorld = UWorld::CreateWorld(nullptr, EWorldType::Editor, TEXT("SnapshotTestWorld"));
+    AActor* FirstActor = nullptr;
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        AActor* Actor = nullptr;
+        switch (Index % 8)
+        {
+        case 0: Actor = SourceWorld->SpawnActor<ACube>(); break;
+        case 1: Actor = SourceWorld->SpawnActor<APointLight>(); break;
+        case 2: Actor = SourceWorld->SpawnActor<ASpotLight>(); break;
+        case 3: Actor = SourceWorld->SpawnActor<ADirectionalLight>(); break;
+        case 4: Actor = SourceWorld->SpawnActor<AAmbientLight>(); break;
+        case 5: Actor = SourceWorld->SpawnActor<AHeightFogActor>(); break;
+        case 6: Actor = SourceWorld->SpawnActor<ASphereActor>(); break;
+        default: Actor = SourceWorld->SpawnActor<ACapsuleActor>(); break;
+        }
+        Actor->SetActorLocation(FVector(static_cast<float>(Index % 100) * 2.f, static_cast<float>(Index / 100) * 2.f, static_cast<float>(Index % 7)));
+        Actor->SetActorRotation(FRotator(0.f, static_cast<float>(Index % 360), 0.f));
+        Actor->SetActorScale(FVector(1.f + static_cast<float>(Index % 4) * 0.25f));
+        CustomizeSnapshotTestActor(Actor, Index);
+
+        // Level 안의 다른 Actor를 가리키는 참조
+        if (!FirstActor)
+        {
+            FirstActor = Actor;
+        }
+        else if (Index % 5 == 0)
+        {
+            Actor->SetOwner(FirstActor);
+        }
+    }
+
+    // Actor마다 따로 Snapshot을 만들어 복제하는 ULevel::Duplicate
+    const uint64 DuplicateStartCycles = FPlatformTime::Cycles64();
+    ULevel* DuplicatedLevel = Cast<ULevel>(SourceWorld->GetActiveLevel()->Duplicate(SourceWorld));
+    const double DuplicateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DuplicateStartCycles);
+
+    // Snapshot
+    const uint64 CaptureStartCycles = FPlatformTime::Cycles64();
+    FWorldSnapshot Snapshot;
+    Snapshot.Capture(SourceWorld);
+    const uint64 InstantiateStartCycles = FPlatformTime::Cycles64();
+    FObjectArena* Arena = new FObjectArena(Snapshot.GetObjectMemorySize());
+    UWorld* CopiedWorld = Snapshot.Instantiate(nullptr, Arena);
+    const uint64 InstantiateEndCycles = FPlatformTime::Cycles64();
+
+    const double CaptureMs = FPlatformTime::ToMilliseconds(InstantiateStartCycles - CaptureStartCycles);
+    const double InstantiateMs = FPlatformTime::ToMilliseconds(InstantiateEndCycles - InstantiateStartCycles);
+
+    // 복제본을 Snapshot이 아니라 원본 객체와 직접 비교, 처음 몇 개의 실패만 로그로 출력
+    int32 NumFailed = 0;
+    auto Check = [&NumFailed](bool bCondition, const UObject* Object, const TCHAR* Description)
+    {
+        if (!bCondition && NumFailed++ < 10)
+        {
+            UE_LOG(ELogLevel::Error, TEXT("[World Snapshot Test] FAILED: %s (%s)"), Description, *Object->GetName());
+        }
+    };
+
+    ULevel* SourceLevel = SourceWorld->GetActiveLevel();
+    ULevel* CopiedLevel = CopiedWorld->GetActiveLevel();
+
+    // 원본 -> 복제본, 복제된 객체를 가리키던 참조는 복제본을, 나머지는 원본이 가리키던 객체를 그대로 가리켜야 함
+    TMap<const UObject*, UObject*> SourceToCopy;
+    SourceToCopy.Add(SourceWorld, CopiedWorld);
+    SourceToCopy.Add(SourceLevel, CopiedLevel);
+
+    const bool bSameActorCount = CopiedLevel->Actors.Num() == SourceLevel->Actors.Num();
+    Check(bSameActorCount, CopiedLevel, TEXT("actor count"));
+    if (bSameActorCount)
+    {
+        for (int32 Index = 0; Index < SourceLevel->Actors.Num(); ++Index)
+        {
+            const AActor* SourceActor = SourceLevel->Actors[Index];
+            AActor* CopiedActor = CopiedLevel->Actors[Index];
+            SourceToCopy.Add(SourceActor, CopiedActor);
+
+            for (const UActorComponent* SourceComponent : SourceActor->GetComponents())
+            {
+                for (UActorComponent* CopiedComponent : CopiedActor->GetComponents())
+                {
+                    if (CopiedComponent->GetFName() == SourceComponent->GetFName())
+                    {
+                        SourceToCopy.Add(SourceComponent, CopiedComponent);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    auto MapReference = [&SourceToCopy](const UObject* SourceReference) -> const UObject*
+    {
+        if (UObject* const* Copy = SourceToCopy.Find(SourceReference))
+        {
+            return *Copy;
+        }
+        return SourceReference;
+    };
+
+    auto CheckObject = [&](const UObject* Source, const UObject* Copy)
+    {
+        Check(Copy != Source, Source, TEXT("copy is a separate object"));
+        Check(Copy->GetClass() == Source->GetClass(), Source, TEXT("class"));
+        Check(Copy->GetFName() == Source->GetFName(), Source, TEXT("name"));
+        Check(Copy->GetOuter() == MapReference(Source->GetOuter()), Source, TEXT("outer"));
+    };
+
+    auto CheckProperties = [&](const UActorComponent* Source, const UActorComponent* Copy)
+    {
+        // 에디터 저장에 쓰는 GetProperties는 Serialize와 별개로 구현되어 있으므로 복제 결과를 독립적으로 확인할 수 있음
+        TMap<FString, FString> SourceProperties;
+        TMap<FString, FString> CopiedProperties;
+        Source->GetProperties(SourceProperties);
+        Copy->GetProperties(CopiedProperties);
+
+        bool bSameProperties = SourceProperties.Num() == CopiedProperties.Num();
+        for (const auto& [Key, Value] : SourceProperties)
+        {
+            const FString* CopiedValue = CopiedProperties.Find(Key);
+            bSameProperties = bSameProperties && CopiedValue && *CopiedValue == Value;
+        }
+        Check(bSameProperties, Source, TEXT("component properties"));
+    };
+
+    CheckObject(SourceWorld, CopiedWorld);
+    CheckObject(SourceLevel, CopiedLevel);
+    Check(CopiedLevel->OwningWorld == CopiedWorld, CopiedLevel, TEXT("level owning world"));
+
+    for (int32 Index = 0; bSameActorCount && Index < SourceLevel->Actors.Num(); ++Index)
+    {
+        const AActor* SourceActor = SourceLevel->Actors[Index];
+        const AActor* CopiedActor = CopiedLevel->Actors[Index];
+
+        CheckObject(SourceActor, CopiedActor);
+        Check(CopiedActor->GetOwner() == MapReference(SourceActor->GetOwner()), SourceActor, TEXT("actor owner"));
+        Check(CopiedActor->GetRootComponent() == MapReference(SourceActor->GetRootComponent()), SourceActor, TEXT("root component"));
+        Check(CopiedActor->GetActorLocation().Equals(SourceActor->GetActorLocation()), SourceActor, TEXT("actor location"));
+        Check(CopiedActor->GetActorRotation().Equals(SourceActor->GetActorRotation()), SourceActor, TEXT("actor rotation"));
+        Check(CopiedActor->GetActorScale().Equals(SourceActor->GetActorScale()), SourceActor, TEXT("actor scale"));
+        Check(CopiedActor->GetComponents().Num() == SourceActor->GetComponents().Num(), SourceActor, TEXT("component count"));
+
+        for (const UActorComponent* SourceComponent : SourceActor->GetComponents())
+        {
+            UObject* const* Found = SourceToCopy.Find(SourceComponent);
+            Check(Found != nullptr, SourceComponent, TEXT("component copied"));
+            if (!Found)
+            {
+                continue;
+            }
+
+            const UActorComponent* CopiedComponent = static_cast<const UActorComponent*>(*Found);
+            CheckObject(SourceComponent, CopiedComponent);
+            Check(CopiedComponent->GetOwner() == CopiedActor, SourceComponent, TEXT("component owner"));
+            CheckProperties(SourceComponent, CopiedComponent);
+
+            if (const USceneComponent* SourceScene = Cast<USceneComponent>(SourceComponent))
+            {
+                const USceneComponent* CopiedScene = static_cast<const USceneComponent*>(CopiedComponent);
+                Check(CopiedScene->GetAttachParent() == MapReference(SourceScene->GetAttachParent()), SourceComponent, TEXT("attach parent"));
+                Check(CopiedScene->GetComponentLocation().Equals(SourceScene->GetComponentLocation()), SourceComponent, TEXT("component location"));
+                Check(CopiedScene->GetComponentRotation().Equals(SourceScene->GetComponentRotation()), SourceComponent, TEXT("component rotation"));
+                Check(CopiedScene->GetComponentScale3D().Equals(SourceScene->GetComponentScale3D()), SourceComponent, TEXT("component scale"));
+            }
+
+            if (const UPointLightComponent* SourcePointLight = Cast<UPointLightComponent>(SourceComponent))
+            {
+                const UPointLightComponent* CopiedPointLight = static_cast<const UPointLightComponent*>(CopiedComponent);
+                Check(
+                    CopiedPointLight->GetRadius() == SourcePointLight->GetRadius()
+                    && CopiedPointLight->GetIntensity() == SourcePointLight->GetIntensity()
+                    && CopiedPointLight->GetLightColor() == SourcePointLight->GetLightColor(),
+                    SourceComponent, TEXT("point light info")
+                );
+            }
+            else if (const USpotLightComponent* SourceSpotLight = Cast<USpotLightComponent>(SourceComponent))
+            {
+                const USpotLightComponent* CopiedSpotLight = static_cast<const USpotLightComponent*>(CopiedComponent);
+                Check(
+                    CopiedSpotLight->GetRadius() == SourceSpotLight->GetRadius()
+                    && CopiedSpotLight->GetInnerRad() == SourceSpotLight->GetInnerRad()
+                    && CopiedSpotLight->GetOuterRad() == SourceSpotLight->GetOuterRad(),
+                    SourceComponent, TEXT("spot light info")
+                );
+            }
+            else if (const UHeightFogComponent* SourceHeightFog = Cast<UHeightFogComponent>(SourceComponent))
+            {
+                const UHeightFogComponent* CopiedHeightFog = static_cast<const UHeightFogComponent*>(CopiedComponent);
+                Check(
+                    CopiedHeightFog->GetFogDensity() == SourceHeightFog->GetFogDensity()
+                    && CopiedHeightFog->GetFogColor() == SourceHeightFog->GetFogColor(),
+                    SourceComponent, TEXT("height fog")
+                );
+            }
+            else if (const USphereComponent* SourceSphere = Cast<USphereComponent>(SourceComponent))
+            {
+                Check(static_cast<const USphereComponent*>(CopiedComponent)->GetRadius() == SourceSphere->GetRadius(), SourceComponent, TEXT("sphere radius"));
+            }
+            else if (const UCapsuleComponent* SourceCapsule = Cast<UCapsuleComponent>(SourceComponent))
+            {
+                Check(static_cast<const UCapsuleComponent*>(CopiedComponent)->GetHalfHeight() == SourceCapsule->GetHalfHeight(), SourceComponent, TEXT("capsule half height"));
+            }
+            else if (const ULuaScriptComponent* SourceLuaScript = Cast<ULuaScriptComponent>(SourceComponent))
+            {
+                const ULuaScriptComponent* CopiedLuaScript = static_cast<const ULuaScriptComponent*>(CopiedComponent);
+                Check(
+                    CopiedLuaScript->GetScriptPath() == SourceLuaScript->GetScriptPath()
+                    && CopiedLuaScript->GetDisplayName() == SourceLuaScript->GetDisplayName(),
+                    SourceComponent, TEXT("lua script path")
+                );
+            }
+        }
+    }
+
+    // 같은 원본은 항상 같은 Snapshot이 되어야 Snapshot을 캐시해서 다시 쓸 수 있음
+    FWorldSnapshot RecapturedSnapshot;
+    RecapturedSnapshot.Capture(SourceWorld);
+    Check(Snapshot.Matches(RecapturedSnapshot), SourceWorld, TEXT("capture is deterministic"));
+
+    const bool bPassed = NumFailed == 0;
+    UE_LOG(
+        bPassed ? ELogLevel::Display : ELogLevel::Error,
+        TEXT("World snapshot test: %s (%d failed), %d actors, %d objects, %d KB snapshot, per-actor Duplicate %.2f ms, snapshot capture %.2f ms + instantiate %.2f ms, arena %d blocks %.1f MB"),
+        bPassed ? TEXT("PASS") : TEXT("FAIL"), NumFailed, NumActors, Snapshot.GetNumObjects(), Snapshot.GetDataSize() / 1024,
+        DuplicateMs, CaptureMs, InstantiateMs, Arena->GetNumBlocks(), static_cast<double>(Arena->GetCapacityBytes()) / (1024.0 * 1024.0)
+    );
+
+    CopiedWorld->Release();
+    GUObjectArray.MarkRemoveObject(CopiedWorld);
+    GUObjectArray.ProcessPendingDestroyObjects();
+    Arena->ReleaseWhenEmpty();
+
+    DuplicatedLevel->Release();
+    GUObjectArray.MarkRemoveObject(DuplicatedLevel);
+
+    SourceWorld->Release();
+    GUObjectArray.MarkRemoveObject(SourceWorld);
+    GUObjectArray.ProcessPendingDestroyObjects();
+
+    return bPassed;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "CoreMiscDefines.h"
+#include "UObject/NameTypes.h"
+
+class AActor;
+class UClass;
+class UObject;
+class UWorld;
+class FObjectArena;
+
+
+/** Snapshot에 담긴 객체 하나, Index는 모두 같은 Snapshot의 객체 테이블 Index */
+struct FWorldSnapshotObject
+{
+    UClass* Class = nullptr;
+    FName Name;
+
+    /** INDEX_NONE이면 Instantiate에 넘긴 Outer */
+    int32 OuterIndex = INDEX_NONE;
+
+    /** Actor라면 바로 뒤에 이어지는 Component의 수 */
+    int32 NumComponents = 0;
+
+    /** Actor라면 RootComponent, 없으면 INDEX_NONE */
+    int32 RootComponentIndex = INDEX_NONE;
+
+    /** SceneComponent라면 AttachParent, 없으면 INDEX_NONE */
+    int32 AttachParentIndex = INDEX_NONE;
+
+    /** Serialize 결과가 Data의 어디에 있는지 */
+    int32 DataOffset = 0;
+    int32 DataSize = 0;
+};
+
+/**
+ * World 하나를 Serialize한 결과를 한 버퍼에 담아 두고, 같은 World를 빠르게 다시 만듦
+ *
+ * - 객체 순서는 World, Level, 그리고 Actor마다 Actor 뒤에 그 Actor의 Component들, CaptureActor는 World와 Level 없이 Actor 하나만 담음
+ * - 객체끼리의 참조는 테이블 Index로 저장되므로 Instantiate한 World 안의 참조는 새 객체를 가리킴
+ * - Actor 생성자가 만든 기본 Component는 이름과 Class가 같으면 지우지 않고 그대로 사용
+ * - Snapshot에 에셋 포인터가 그대로 들어가므로 같은 프로세스 안에서만 사용
+ */
+class FWorldSnapshot
+{
+public:
+    void Capture(UWorld* World);
+
+    /**
+     * Snapshot과 같은 World를 만듭니다.
+     * @param InOuter 새 World의 Outer
+     * @param Arena nullptr이 아니면 새 객체를 모두 이 Arena에서 할당
+     */
+    UWorld* Instantiate(UObject* InOuter, FObjectArena* Arena = nullptr) const;
+
+    /** Actor와 그 Component만 담음, Snapshot 밖의 객체를 가리키는 참조(Owner 등)는 원본이 가리키던 객체를 그대로 가리킴 */
+    void CaptureActor(AActor* Actor);
+
+    /** CaptureActor로 담은 Actor를 InOuter 아래에 새 이름으로 만듦, Level에는 추가하지 않음 */
+    AActor* InstantiateActor(UObject* InOuter) const;
+
+    /** Actor 하나를 Component까지 복제, UWorld::DuplicateActor와 ULevel::Duplicate가 사용 */
+    static AActor* DuplicateActor(AActor* Actor, UObject* InOuter);
+
+    /** 두 Snapshot의 객체 구성과 Serialize 결과가 같은지 비교, 다르면 처음 다른 객체를 로그로 출력 */
+    bool Matches(const FWorldSnapshot& Other) const;
+
+    int32 GetNumObjects() const { return Objects.Num(); }
+    int32 GetDataSize() const { return Data.Num(); }
+
+    /** Instantiate에 필요한 객체 메모리의 합, Arena의 크기를 정할 때 사용 */
+    size_t GetObjectMemorySize() const { return ObjectMemorySize; }
+
+    /**
+     * NumActors개의 Actor가 있는 World를 만들어 Actor마다 DuplicateActor하는 ULevel::Duplicate와 World Snapshot의 시간을 비교하고,
+     * 복제본의 Class, Outer와 Owner, 부착 관계, Transform, Component 프로퍼티를 원본 객체와 직접 비교
+     */
+    static bool RunSelfTest(int32 NumActors);
+
+private:
+    /** RootObjects(World와 Level 또는 없음)를 먼저 담고 Actor마다 Actor와 Component를 담음 */
+    void CaptureObjects(const TArray<UObject*>& RootObjects, const TArray<AActor*>& Actors);
+
+    /** 객체를 만들고 프로퍼티와 부착 관계를 되돌림, World를 담았다면 Actor를 새 Level에 추가 */
+    void InstantiateObjects(UObject* InOuter, bool bRenameActors, TArray<UObject*>& NewObjects) const;
+
+    /** Capture면 World와 Level의 2, CaptureActor면 0 */
+    int32 NumRootObjects = 0;
+
+    TArray<FWorldSnapshotObject> Objects;
+    TArray<uint8> Data;
+    size_t ObjectMemorySize = 0;
+};
@@ -499,6 +499,22 @@ struct FLinePrimitiveBatchArgs
     int OBBCount;
 };
 
+/** 픽셀이 속한 라이트 클러스터를 찾는 데 필요한 값, FLightClusterGrid 참고 */
+struct FLightClusterConstants
+{
+    uint32 ClusterCountX;
+    uint32 ClusterCountY;
+    uint32 ClusterCountZ;
+    uint32 bOrthographic;
+
+    float ZSliceScale;
+    float ZSliceBias;
+    FVector2D ViewportOffset;
+
+    FVector2D ViewportSize;
+    FVector2D Padding;
+};
+
 struct FViewportSize
 {
     FVector2D ViewportSize;
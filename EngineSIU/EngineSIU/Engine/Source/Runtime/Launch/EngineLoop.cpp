@@ -16,7 +16,12 @@
 #include "Renderer/TileLightCullingPass.h"
 
 #include "SoundManager.h"
+#include "Animation/AnimPoseCache.h"
+#include "Animation/AnimUpdateRateManager.h"
+#include "Async/JobSystem.h"
 #include "Engine/PhysicsManager.h"
+#include "Engine/TextureStreamer.h"
+#include "Stats/CpuProfiler.h"
 
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
 
@@ -81,8 +86,19 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
         EngineProfiler.RegisterStatScope(TEXT("|- CompositingPass"), FName(TEXT("CompositingPass_CPU")), FName(TEXT("CompositingPass_GPU")));
         EngineProfiler.RegisterStatScope(TEXT("|- SkinningPass"), FName(TEXT("SkinningPass_CPU")), FName(TEXT("SkinningPass_GPU")));
         EngineProfiler.RegisterStatScope(TEXT("SlatePass"), FName(TEXT("SlatePass_CPU")), FName(TEXT("SlatePass_GPU")));
+        EngineProfiler.RegisterStatScope(TEXT("TickGroup_PrePhysics"), FName(TEXT("TickGroup_PrePhysics")), NAME_None);
+        EngineProfiler.RegisterStatScope(TEXT("TickGroup_DuringPhysics"), FName(TEXT("TickGroup_DuringPhysics")), NAME_None);
+        EngineProfiler.RegisterStatScope(TEXT("TickGroup_PostPhysics"), FName(TEXT("TickGroup_PostPhysics")), NAME_None);
+        EngineProfiler.RegisterStatScope(TEXT("TickGroup_PostUpdateWork"), FName(TEXT("TickGroup_PostUpdateWork")), NAME_None);
     }
 
+    FCpuProfiler::Get().SetCurrentThreadName(TEXT("GameThread"));
+    FJobSystem::Get().SetOnWorkerThreadStarted([](int32 WorkerIndex)
+    {
+        FCpuProfiler::Get().SetCurrentThreadName(FString::Printf(TEXT("Worker %d"), WorkerIndex));
+    });
+    FJobSystem::Get().Initialize();
+
     BufferManager->Initialize(GraphicDevice.Device, GraphicDevice.DeviceContext);
     Renderer.Initialize(&GraphicDevice, BufferManager, &GPUTimingManager);
     PrimitiveDrawBatch.Initialize(&GraphicDevice);
@@ -99,9 +115,9 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
     GEngine->Init();
 
 
+    // 로드는 백그라운드에서 진행되므로 처음 재생할 때 멈추지 않도록 시작할 때 전부 요청해 둠
     FSoundManager::GetInstance().Initialize();
-    FSoundManager::GetInstance().LoadSound("fishdream", "Contents/Sounds/fishdream.mp3");
-    FSoundManager::GetInstance().LoadSound("sizzle", "Contents/Sounds/sizzle.mp3");
+    FSoundManager::GetInstance().PreloadDirectory("Contents/Sounds");
     //FSoundManager::GetInstance().PlaySound("fishdream");
 
     UpdateUI();
@@ -149,7 +165,7 @@ void FEngineLoop::Tick()
 
     while (bIsExit == false)
     {
-        FProfilerStatsManager::BeginFrame();    // Clear previous frame stats
+        FCpuProfiler::Get().BeginFrame();       // Frame marker for CPU profiler
         if (GPUTimingManager.IsInitialized())
         {
             GPUTimingManager.BeginFrame();      // Start GPU frame timing
@@ -172,8 +188,25 @@ void FEngineLoop::Tick()
 
         const float DeltaTime = static_cast<float>(ElapsedTime / 1000.f);
 
+        // 애니메이션 Update Rate는 직전 프레임에 렌더링한 시점을 기준으로 정함
+        if (const std::shared_ptr<FEditorViewportClient> ActiveViewport = LevelEditor->GetActiveViewportClient())
+        {
+            FAnimUpdateRateManager::Get().BeginFrame(ActiveViewport->GetCameraLocation(), ActiveViewport->GetViewMatrix(), ActiveViewport->GetProjectionMatrix());
+        }
+        FAnimPoseCache::Get().BeginFrame();
+
+        // 백그라운드에서 읽은 텍스처 밉을 반영
+        FTextureStreamer::Get().Tick();
+
         GEngine->Tick(DeltaTime);
         LevelEditor->Tick(DeltaTime);
+
+        if (const std::shared_ptr<FEditorViewportClient> ActiveViewport = LevelEditor->GetActiveViewportClient())
+        {
+            FSoundManager::GetInstance().SetListenerLocation(ActiveViewport->GetCameraLocation());
+        }
+        FSoundManager::GetInstance().Update(DeltaTime);
+
         Render();
         UIManager->BeginFrame();
         UnrealEditor->Render();
@@ -198,6 +231,8 @@ void FEngineLoop::Tick()
         }
 
         GraphicDevice.SwapBuffer();
+        FCpuProfiler::Get().EndFrame();         // Collect per-thread CPU events
+
         do
         {
             Sleep(0);
@@ -205,7 +240,6 @@ void FEngineLoop::Tick()
             ElapsedTime = (static_cast<double>(EndTime.QuadPart - StartTime.QuadPart) * 1000.f / static_cast<double>(Frequency.QuadPart));
         } while (ElapsedTime < TargetFrameTime);
     }
-    FSoundManager::GetInstance().Update();
 }
 
 void FEngineLoop::GetClientSize(uint32& OutWidth, uint32& OutHeight) const
@@ -227,6 +261,10 @@ void FEngineLoop::Exit()
     
     GEngine->Release();
 
+    // PhysX Dispatcher가 Job System의 Worker를 사용하므로 Job System보다 먼저 종료
+    UPhysicsManager::Get().Shutdown();
+    FJobSystem::Get().Shutdown();
+
     delete UnrealEditor;
     delete BufferManager;
     delete UIManager;
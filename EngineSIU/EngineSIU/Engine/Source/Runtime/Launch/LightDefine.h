@@ -60,8 +60,11 @@ struct FPointLightInfo
     
     uint32 CastShadows;
     float ShadowBias;
-    uint32 ShadowMapArrayIndex = 0;
-    float Padding2; // 필요시
+    float Padding2;
+    float Padding3;
+
+    // 면별 섀도우 아틀라스 영역 (xy: UV 오프셋, zw: UV 크기), 전부 0이면 이번 프레임에 영역을 받지 못한 면
+    FVector4 ShadowAtlasRects[6];
 };
 
 struct FSpotLightInfo
@@ -84,8 +87,11 @@ struct FSpotLightInfo
     
     uint32 CastShadows;
     float ShadowBias;
-    uint32 ShadowMapArrayIndex;
-    float Padding2; // 필요시
+    float Padding2;
+    float Padding3;
+
+    // 섀도우 아틀라스 영역 (xy: UV 오프셋, zw: UV 크기), 전부 0이면 영역을 받지 못함
+    FVector4 ShadowAtlasRect;
 };
 
 struct FLightInfoBuffer
@@ -0,0 +1,17 @@
+#include "PhysXJobDispatcher.h"
+#include "Async/JobSystem.h"
+
+void FPhysXJobDispatcher::submitTask(PxBaseTask& Task)
+{
+    // Job System이 초기화되지 않았다면 Dispatch가 호출한 스레드에서 바로 실행함
+    FJobSystem::Get().Dispatch([&Task]()
+    {
+        Task.run();
+        Task.release();
+    });
+}
+
+PxU32 FPhysXJobDispatcher::getWorkerCount() const
+{
+    return static_cast<PxU32>(FJobSystem::Get().GetNumWorkers());
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+
+using namespace physx;
+
+/**
+ * PhysX의 Task를 엔진의 FJobSystem Worker에서 실행하는 CPU Dispatcher입니다.
+ * PhysX 전용 스레드를 따로 만들지 않으므로, 게임 로직과 Physics가 코어를 나눠 쓰며 과구독되지 않습니다.
+ */
+class FPhysXJobDispatcher : public PxCpuDispatcher
+{
+public:
+    virtual void submitTask(PxBaseTask& Task) override;
+    virtual PxU32 getWorkerCount() const override;
+};
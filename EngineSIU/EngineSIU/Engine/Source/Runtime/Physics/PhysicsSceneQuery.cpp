@@ -0,0 +1,568 @@
+#include "PhysicsSceneQuery.h"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+
+#include "BodyInstance.h"
+#include "Async/JobSystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Casts.h"
+#include "Userinterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    /** Job 하나가 처리할 최소 요청 수, Raycast 하나는 수 마이크로초 수준이라 너무 잘게 나누면 Dispatch 비용이 더 큼 */
+    constexpr int32 QUERY_BATCH_GRAIN_SIZE = 64;
+
+    FVector ToFVector(const PxVec3& V)
+    {
+        return FVector(V.x, V.y, V.z);
+    }
+
+    UPrimitiveComponent* GetOwnerComponent(const PxRigidActor* Actor)
+    {
+        // 자동차처럼 FBodyInstance 없이 직접 만든 Actor는 userData가 nullptr
+        const FBodyInstance* BodyInstance = Actor ? static_cast<const FBodyInstance*>(Actor->userData) : nullptr;
+        return BodyInstance ? Cast<UPrimitiveComponent>(BodyInstance->Owner) : nullptr;
+    }
+
+    /**
+     * Shape의 채널과 무시 목록으로 후보를 거르는 Filter, 스레드마다 따로 만들어 씀
+     * 채널은 Simulation Filter Data의 word0를 그대로 쓰고, 쿼리 쪽 마스크는 PxQueryFilterData의 word0로 넘어옴
+     */
+    class FQueryFilterCallback : public PxQueryFilterCallback
+    {
+    public:
+        FQueryFilterCallback(const FCollisionQueryParams& InParams, PxQueryHitType::Enum InHitType)
+            : Params(InParams)
+            , HitType(InHitType)
+        {
+        }
+
+        virtual PxQueryHitType::Enum preFilter(const PxFilterData& FilterData, const PxShape* Shape, const PxRigidActor* Actor, PxHitFlags& QueryFlags) override
+        {
+            uint32 Channel = Shape->getSimulationFilterData().word0;
+            if (Channel == 0)
+            {
+                Channel = ECC_WorldDefault;
+            }
+
+            if ((Channel & FilterData.word0) == 0)
+            {
+                return PxQueryHitType::eNONE;
+            }
+
+            if (Params.IgnoredComponents.Num() > 0 || Params.IgnoredActors.Num() > 0)
+            {
+                if (const UPrimitiveComponent* Component = GetOwnerComponent(Actor))
+                {
+                    if (Params.IgnoredComponents.Contains(Component) || Params.IgnoredActors.Contains(Component->GetOwner()))
+                    {
+                        return PxQueryHitType::eNONE;
+                    }
+                }
+            }
+
+            return HitType;
+        }
+
+        /** Sweep에서 bFindInitialOverlaps가 false일 때만 호출됨 */
+        virtual PxQueryHitType::Enum postFilter(const PxFilterData& FilterData, const PxQueryHit& Hit) override
+        {
+            const PxLocationHit& LocationHit = static_cast<const PxLocationHit&>(Hit);
+            return LocationHit.hadInitialOverlap() ? PxQueryHitType::eNONE : HitType;
+        }
+
+    private:
+        const FCollisionQueryParams& Params;
+        PxQueryHitType::Enum HitType;
+    };
+
+    PxQueryFilterData MakeFilterData(const FCollisionQueryParams& Params, bool bUsePostFilter)
+    {
+        PxQueryFlags Flags = PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER;
+        if (bUsePostFilter)
+        {
+            Flags |= PxQueryFlag::ePOSTFILTER;
+        }
+        return PxQueryFilterData(PxFilterData(Params.ChannelMask, 0, 0, 0), Flags);
+    }
+
+    PxGeometryHolder MakeGeometry(const FCollisionShape& Shape)
+    {
+        switch (Shape.ShapeType)
+        {
+        case ECollisionShapeType::Box:
+            return PxGeometryHolder(PxBoxGeometry(Shape.BoxHalfExtent.ToPxVec3()));
+        case ECollisionShapeType::Capsule:
+            return PxGeometryHolder(PxCapsuleGeometry(Shape.Radius, Shape.CapsuleHalfHeight));
+        case ECollisionShapeType::Sphere:
+        default:
+            return PxGeometryHolder(PxSphereGeometry(Shape.Radius));
+        }
+    }
+
+    PxTransform MakePose(const FVector& Location, const FQuat& Rotation, const FCollisionShape& Shape)
+    {
+        PxQuat PoseRotation = Rotation.ToPxQuat();
+        if (Shape.ShapeType == ECollisionShapeType::Capsule)
+        {
+            // PhysX의 Capsule은 X축 방향이므로 Y축으로 90도 돌려 Z축으로 세움
+            PoseRotation = PoseRotation * PxQuat(PxHalfPi, PxVec3(0.f, 1.f, 0.f));
+        }
+        return PxTransform(Location.ToPxVec3(), PoseRotation);
+    }
+
+    /** Start에서 End로 향하는 단위 벡터와 거리, 길이가 0이면 Dir은 임의의 단위 벡터 */
+    void GetTraceDirection(const FVector& Start, const FVector& End, PxVec3& OutDir, float& OutDistance)
+    {
+        const FVector Delta = End - Start;
+        OutDistance = Delta.Length();
+        OutDir = OutDistance > SMALL_NUMBER ? (Delta / OutDistance).ToPxVec3() : PxVec3(1.f, 0.f, 0.f);
+    }
+
+    void FillHitResult(const PxLocationHit& Hit, const FVector& Start, const FVector& End, float TraceDistance, bool bSweep, FHitResult& OutHit)
+    {
+        OutHit.Init(Start, End);
+        OutHit.bBlockingHit = true;
+        OutHit.bStartPenetrating = Hit.hadInitialOverlap();
+        OutHit.Distance = OutHit.bStartPenetrating ? 0.f : Hit.distance;
+        OutHit.Time = TraceDistance > SMALL_NUMBER ? OutHit.Distance / TraceDistance : 0.f;
+        OutHit.FaceIndex = Hit.faceIndex == 0xFFFFFFFF ? INDEX_NONE : static_cast<int32>(Hit.faceIndex);
+        OutHit.Item = INDEX_NONE;
+
+        if (OutHit.bStartPenetrating)
+        {
+            OutHit.Location = Start;
+            OutHit.ImpactPoint = Start;
+        }
+        else
+        {
+            OutHit.Location = bSweep ? Start + (End - Start) * OutHit.Time : ToFVector(Hit.position);
+            OutHit.ImpactPoint = ToFVector(Hit.position);
+        }
+        OutHit.ImpactNormal = ToFVector(Hit.normal);
+        OutHit.Normal = OutHit.ImpactNormal;
+
+        if (const FBodyInstance* BodyInstance = static_cast<const FBodyInstance*>(Hit.actor->userData))
+        {
+            OutHit.Component = Cast<UPrimitiveComponent>(BodyInstance->Owner);
+            OutHit.HitActor = OutHit.Component ? OutHit.Component->GetOwner() : nullptr;
+            OutHit.BoneName = BodyInstance->GetBoneName();
+        }
+    }
+
+    void FillOverlapResult(const PxOverlapHit& Hit, FOverlapResult& OutOverlap)
+    {
+        OutOverlap = FOverlapResult();
+        OutOverlap.Component = GetOwnerComponent(Hit.actor);
+        OutOverlap.Actor = OutOverlap.Component ? OutOverlap.Component->GetOwner() : nullptr;
+        OutOverlap.ItemIndex = INDEX_NONE;
+        OutOverlap.bBlockingHit = false;
+    }
+
+    /** 아래 함수들은 Read Lock을 잡은 상태에서 호출 */
+    bool RaycastClosest(const PxScene& Scene, const FVector& Start, const FVector& End, const FCollisionQueryParams& Params, FQueryFilterCallback& Callback, FHitResult& OutHit)
+    {
+        PxVec3 Dir;
+        float Distance;
+        GetTraceDirection(Start, End, Dir, Distance);
+
+        PxRaycastBuffer Buffer;
+        if (Distance <= SMALL_NUMBER || !Scene.raycast(Start.ToPxVec3(), Dir, Distance, Buffer, PxHitFlag::eDEFAULT, MakeFilterData(Params, false), &Callback))
+        {
+            OutHit.Init(Start, End);
+            return false;
+        }
+
+        FillHitResult(Buffer.block, Start, End, Distance, false, OutHit);
+        return true;
+    }
+
+    bool SweepClosest(
+        const PxScene& Scene, const FVector& Start, const FVector& End, const FQuat& Rotation, const FCollisionShape& Shape,
+        const FCollisionQueryParams& Params, FQueryFilterCallback& Callback, FHitResult& OutHit
+    )
+    {
+        PxVec3 Dir;
+        float Distance;
+        GetTraceDirection(Start, End, Dir, Distance);
+
+        const PxGeometryHolder Geometry = MakeGeometry(Shape);
+        const PxTransform Pose = MakePose(Start, Rotation, Shape);
+
+        PxSweepBuffer Buffer;
+        if (!Scene.sweep(Geometry.any(), Pose, Dir, Distance, Buffer, PxHitFlag::eDEFAULT, MakeFilterData(Params, !Params.bFindInitialOverlaps), &Callback))
+        {
+            OutHit.Init(Start, End);
+            return false;
+        }
+
+        FillHitResult(Buffer.block, Start, End, Distance, true, OutHit);
+        return true;
+    }
+
+    /** 결과는 OutOverlaps[0, MaxOverlaps)에 기록하고 개수를 반환 */
+    uint32 OverlapAll(
+        const PxScene& Scene, const FVector& Location, const FQuat& Rotation, const FCollisionShape& Shape,
+        const FCollisionQueryParams& Params, FQueryFilterCallback& Callback, PxOverlapHit* Touches, uint32 MaxOverlaps, FOverlapResult* OutOverlaps
+    )
+    {
+        const PxGeometryHolder Geometry = MakeGeometry(Shape);
+        const PxTransform Pose = MakePose(Location, Rotation, Shape);
+
+        PxOverlapBuffer Buffer(Touches, MaxOverlaps);
+        Scene.overlap(Geometry.any(), Pose, Buffer, MakeFilterData(Params, false), &Callback);
+
+        const uint32 NumTouches = Buffer.getNbTouches();
+        for (uint32 Index = 0; Index < NumTouches; ++Index)
+        {
+            FillOverlapResult(Buffer.getTouch(Index), OutOverlaps[Index]);
+        }
+        return NumTouches;
+    }
+}
+
+FCollisionShape FCollisionShape::MakeSphere(float InRadius)
+{
+    FCollisionShape Shape;
+    Shape.ShapeType = ECollisionShapeType::Sphere;
+    Shape.Radius = InRadius;
+    return Shape;
+}
+
+FCollisionShape FCollisionShape::MakeBox(const FVector& InHalfExtent)
+{
+    FCollisionShape Shape;
+    Shape.ShapeType = ECollisionShapeType::Box;
+    Shape.BoxHalfExtent = InHalfExtent;
+    return Shape;
+}
+
+FCollisionShape FCollisionShape::MakeCapsule(float InRadius, float InHalfHeight)
+{
+    FCollisionShape Shape;
+    Shape.ShapeType = ECollisionShapeType::Capsule;
+    Shape.Radius = InRadius;
+    Shape.CapsuleHalfHeight = InHalfHeight;
+    return Shape;
+}
+
+bool FPhysicsSceneQuery::RaycastSingle(const FVector& Start, const FVector& End, FHitResult& OutHit, const FCollisionQueryParams& Params) const
+{
+    if (!Scene)
+    {
+        OutHit.Init(Start, End);
+        return false;
+    }
+
+    SCOPED_READ_LOCK(*Scene);
+    FQueryFilterCallback Callback(Params, PxQueryHitType::eBLOCK);
+    return RaycastClosest(*Scene, Start, End, Params, Callback, OutHit);
+}
+
+bool FPhysicsSceneQuery::RaycastMulti(const FVector& Start, const FVector& End, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params) const
+{
+    OutHits.SetNum(0);
+
+    PxVec3 Dir;
+    float Distance;
+    GetTraceDirection(Start, End, Dir, Distance);
+    if (!Scene || Distance <= SMALL_NUMBER)
+    {
+        return false;
+    }
+
+    PxRaycastHit Touches[MAX_MULTI_HITS];
+    PxRaycastBuffer Buffer(Touches, MAX_MULTI_HITS);
+    {
+        SCOPED_READ_LOCK(*Scene);
+        FQueryFilterCallback Callback(Params, PxQueryHitType::eTOUCH);
+        Scene->raycast(Start.ToPxVec3(), Dir, Distance, Buffer, PxHitFlag::eDEFAULT, MakeFilterData(Params, false), &Callback);
+
+        // Touch는 순서가 보장되지 않으므로 거리 순서로 정렬
+        const uint32 NumTouches = Buffer.getNbTouches();
+        std::sort(Touches, Touches + NumTouches, [](const PxRaycastHit& A, const PxRaycastHit& B) { return A.distance < B.distance; });
+
+        OutHits.SetNum(static_cast<int32>(NumTouches));
+        for (uint32 Index = 0; Index < NumTouches; ++Index)
+        {
+            FillHitResult(Touches[Index], Start, End, Distance, false, OutHits[static_cast<int32>(Index)]);
+        }
+    }
+    return OutHits.Num() > 0;
+}
+
+bool FPhysicsSceneQuery::SweepSingle(
+    const FVector& Start, const FVector& End, const FQuat& Rotation, const FCollisionShape& Shape,
+    FHitResult& OutHit, const FCollisionQueryParams& Params
+) const
+{
+    if (!Scene)
+    {
+        OutHit.Init(Start, End);
+        return false;
+    }
+
+    SCOPED_READ_LOCK(*Scene);
+    FQueryFilterCallback Callback(Params, PxQueryHitType::eBLOCK);
+    return SweepClosest(*Scene, Start, End, Rotation, Shape, Params, Callback, OutHit);
+}
+
+bool FPhysicsSceneQuery::OverlapMulti(
+    const FVector& Location, const FQuat& Rotation, const FCollisionShape& Shape,
+    TArray<FOverlapResult>& OutOverlaps, const FCollisionQueryParams& Params
+) const
+{
+    OutOverlaps.SetNum(0);
+    if (!Scene)
+    {
+        return false;
+    }
+
+    PxOverlapHit Touches[MAX_MULTI_HITS];
+    FOverlapResult Results[MAX_MULTI_HITS];
+    uint32 NumOverlaps;
+    {
+        SCOPED_READ_LOCK(*Scene);
+        // Overlap에서 eBLOCK을 반환하면 결과가 정의되지 않으므로 항상 Touch로 받음
+        FQueryFilterCallback Callback(Params, PxQueryHitType::eTOUCH);
+        NumOverlaps = OverlapAll(*Scene, Location, Rotation, Shape, Params, Callback, Touches, MAX_MULTI_HITS, Results);
+    }
+
+    OutOverlaps.SetNum(static_cast<int32>(NumOverlaps));
+    for (uint32 Index = 0; Index < NumOverlaps; ++Index)
+    {
+        OutOverlaps[static_cast<int32>(Index)] = Results[Index];
+    }
+    return NumOverlaps > 0;
+}
+
+int32 FPhysicsSceneQuery::RaycastBatch(const TArray<FRaycastRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params) const
+{
+    const int32 NumRequests = Requests.Num();
+    OutHits.SetNum(NumRequests);
+
+    if (!Scene)
+    {
+        for (int32 Index = 0; Index < NumRequests; ++Index)
+        {
+            OutHits[Index].Init(Requests[Index].Start, Requests[Index].End);
+        }
+        return 0;
+    }
+
+    std::atomic<int32> NumHits = 0;
+    FJobSystem::Get().ParallelForRange(
+        NumRequests,
+        [this, &Requests, &OutHits, &Params, &NumHits](int32 Begin, int32 End)
+        {
+            SCOPED_READ_LOCK(*Scene);
+            FQueryFilterCallback Callback(Params, PxQueryHitType::eBLOCK);
+
+            int32 LocalHits = 0;
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                const FRaycastRequest& Request = Requests[Index];
+                LocalHits += RaycastClosest(*Scene, Request.Start, Request.End, Params, Callback, OutHits[Index]) ? 1 : 0;
+            }
+            NumHits.fetch_add(LocalHits, std::memory_order_relaxed);
+        },
+        QUERY_BATCH_GRAIN_SIZE
+    );
+
+    return NumHits.load(std::memory_order_relaxed);
+}
+
+int32 FPhysicsSceneQuery::SweepBatch(const TArray<FSweepRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params) const
+{
+    const int32 NumRequests = Requests.Num();
+    OutHits.SetNum(NumRequests);
+
+    if (!Scene)
+    {
+        for (int32 Index = 0; Index < NumRequests; ++Index)
+        {
+            OutHits[Index].Init(Requests[Index].Start, Requests[Index].End);
+        }
+        return 0;
+    }
+
+    std::atomic<int32> NumHits = 0;
+    FJobSystem::Get().ParallelForRange(
+        NumRequests,
+        [this, &Requests, &OutHits, &Params, &NumHits](int32 Begin, int32 End)
+        {
+            SCOPED_READ_LOCK(*Scene);
+            FQueryFilterCallback Callback(Params, PxQueryHitType::eBLOCK);
+
+            int32 LocalHits = 0;
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                const FSweepRequest& Request = Requests[Index];
+                LocalHits += SweepClosest(*Scene, Request.Start, Request.End, Request.Rotation, Request.Shape, Params, Callback, OutHits[Index]) ? 1 : 0;
+            }
+            NumHits.fetch_add(LocalHits, std::memory_order_relaxed);
+        },
+        QUERY_BATCH_GRAIN_SIZE
+    );
+
+    return NumHits.load(std::memory_order_relaxed);
+}
+
+int32 FPhysicsSceneQuery::OverlapBatch(
+    const TArray<FOverlapRequest>& Requests, TArray<FOverlapResult>& OutOverlaps, TArray<FOverlapResultRange>& OutRanges,
+    const FCollisionQueryParams& Params, uint32 MaxOverlapsPerRequest
+) const
+{
+    const int32 NumRequests = Requests.Num();
+    OutRanges.SetNum(NumRequests);
+
+    if (!Scene || MaxOverlapsPerRequest == 0)
+    {
+        for (int32 Index = 0; Index < NumRequests; ++Index)
+        {
+            OutRanges[Index] = { 0, 0 };
+        }
+        OutOverlaps.SetNum(0);
+        return 0;
+    }
+
+    // 요청마다 MaxOverlapsPerRequest 칸을 미리 잡아두고 기록한 뒤, 끝나면 앞으로 당겨서 빈칸을 없앰
+    OutOverlaps.SetNum(NumRequests * static_cast<int32>(MaxOverlapsPerRequest));
+
+    FJobSystem::Get().ParallelForRange(
+        NumRequests,
+        [this, &Requests, &OutOverlaps, &OutRanges, &Params, MaxOverlapsPerRequest](int32 Begin, int32 End)
+        {
+            SCOPED_READ_LOCK(*Scene);
+            FQueryFilterCallback Callback(Params, PxQueryHitType::eTOUCH);
+
+            TArray<PxOverlapHit> Touches;
+            Touches.SetNum(static_cast<int32>(MaxOverlapsPerRequest));
+
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                const FOverlapRequest& Request = Requests[Index];
+                const uint32 Offset = static_cast<uint32>(Index) * MaxOverlapsPerRequest;
+                const uint32 Count = OverlapAll(
+                    *Scene, Request.Location, Request.Rotation, Request.Shape, Params, Callback,
+                    Touches.GetData(), MaxOverlapsPerRequest, OutOverlaps.GetData() + Offset
+                );
+                OutRanges[Index] = { Offset, Count };
+            }
+        },
+        QUERY_BATCH_GRAIN_SIZE
+    );
+
+    uint32 NumOverlaps = 0;
+    for (int32 Index = 0; Index < NumRequests; ++Index)
+    {
+        FOverlapResultRange& Range = OutRanges[Index];
+        if (Range.Offset != NumOverlaps)
+        {
+            std::copy_n(OutOverlaps.GetData() + Range.Offset, Range.Count, OutOverlaps.GetData() + NumOverlaps);
+        }
+        Range.Offset = NumOverlaps;
+        NumOverlaps += Range.Count;
+    }
+    OutOverlaps.SetNum(static_cast<int32>(NumOverlaps));
+
+    return static_cast<int32>(NumOverlaps);
+}
+
+void FPhysicsSceneQuery::RunRaycastBenchmark(PxPhysics* Physics, int32 NumRays, int32 NumBoxes)
+{
+    if (!Physics || NumRays <= 0)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("[SceneQuery] Benchmark needs an initialized PxPhysics and a positive ray count"));
+        return;
+    }
+
+    // 시뮬레이션은 하지 않으므로 Dispatcher는 스레드 없이 만듦
+    PxDefaultCpuDispatcher* BenchDispatcher = PxDefaultCpuDispatcherCreate(0);
+    PxSceneDesc SceneDesc(Physics->getTolerancesScale());
+    SceneDesc.cpuDispatcher = BenchDispatcher;
+    SceneDesc.filterShader = PxDefaultSimulationFilterShader;
+    PxScene* BenchScene = Physics->createScene(SceneDesc);
+    PxMaterial* Material = Physics->createMaterial(0.5f, 0.5f, 0.6f);
+
+    constexpr float HalfWorldSize = 100.f;
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Position(-HalfWorldSize, HalfWorldSize);
+    std::uniform_real_distribution<float> Height(0.f, 20.f);
+    std::uniform_real_distribution<float> Extent(0.5f, 3.f);
+    std::uniform_real_distribution<float> Angle(-PxPi, PxPi);
+
+    // 바닥 하나와 임의의 크기, 방향을 가진 Box
+    TArray<PxRigidStatic*> Actors;
+    Actors.Reserve(NumBoxes + 1);
+    Actors.Add(PxCreateStatic(*Physics, PxTransform(PxVec3(0.f, 0.f, -1.f)), PxBoxGeometry(HalfWorldSize, HalfWorldSize, 1.f), *Material));
+    for (int32 Index = 0; Index < NumBoxes; ++Index)
+    {
+        const PxTransform Pose(PxVec3(Position(Random), Position(Random), Height(Random)), PxQuat(Angle(Random), PxVec3(0.f, 0.f, 1.f)));
+        const PxBoxGeometry Geometry(Extent(Random), Extent(Random), Extent(Random));
+        Actors.Add(PxCreateStatic(*Physics, Pose, Geometry, *Material));
+    }
+    for (PxRigidStatic* Actor : Actors)
+    {
+        BenchScene->addActor(*Actor);
+    }
+    BenchScene->flushQueryUpdates();
+
+    TArray<FRaycastRequest> Requests;
+    Requests.SetNum(NumRays);
+    for (FRaycastRequest& Request : Requests)
+    {
+        Request.Start = FVector(Position(Random), Position(Random), 50.f);
+        Request.End = FVector(Position(Random), Position(Random), -10.f);
+    }
+
+    const FPhysicsSceneQuery Query(BenchScene);
+
+    TArray<FHitResult> SerialHits;
+    SerialHits.SetNum(NumRays);
+    const uint64 SerialStart = FPlatformTime::Cycles64();
+    int32 NumSerialHits = 0;
+    for (int32 Index = 0; Index < NumRays; ++Index)
+    {
+        NumSerialHits += Query.RaycastSingle(Requests[Index].Start, Requests[Index].End, SerialHits[Index]) ? 1 : 0;
+    }
+    const double SerialMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SerialStart);
+
+    TArray<FHitResult> BatchHits;
+    const uint64 BatchStart = FPlatformTime::Cycles64();
+    const int32 NumBatchHits = Query.RaycastBatch(Requests, BatchHits);
+    const double BatchMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BatchStart);
+
+    int32 NumMismatches = 0;
+    for (int32 Index = 0; Index < NumRays; ++Index)
+    {
+        const FHitResult& A = SerialHits[Index];
+        const FHitResult& B = BatchHits[Index];
+        if (A.bBlockingHit != B.bBlockingHit || A.Distance != B.Distance)
+        {
+            ++NumMismatches;
+        }
+    }
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("[SceneQuery] %d rays, %d boxes: serial %.2f ms, batch %.2f ms (%d workers), hits %d"),
+        NumRays, NumBoxes, SerialMs, BatchMs, FJobSystem::Get().GetNumWorkers(), NumBatchHits
+    );
+    if (NumMismatches > 0 || NumSerialHits != NumBatchHits)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("[SceneQuery] Batch results differ from serial results in %d rays"), NumMismatches);
+    }
+
+    for (PxRigidStatic* Actor : Actors)
+    {
+        Actor->release();
+    }
+    BenchScene->release();
+    Material->release();
+    BenchDispatcher->release();
+}
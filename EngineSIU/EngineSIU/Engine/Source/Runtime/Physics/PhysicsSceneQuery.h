@@ -0,0 +1,142 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Quat.h"
+#include "Math/Vector.h"
+#include "Engine/HitResult.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/PhysicsManager.h"
+
+using namespace physx;
+
+class AActor;
+class UPrimitiveComponent;
+
+enum class ECollisionShapeType : uint8
+{
+    Sphere,
+    Box,
+    Capsule,
+};
+
+/** Sweep, Overlap에 사용하는 형상, Capsule은 엔진 좌표계의 Z축 방향으로 세워짐 */
+struct FCollisionShape
+{
+    ECollisionShapeType ShapeType = ECollisionShapeType::Sphere;
+
+    /** Box일 때만 사용 */
+    FVector BoxHalfExtent = FVector::ZeroVector;
+
+    /** Sphere, Capsule일 때 사용 */
+    float Radius = 0.f;
+
+    /** Capsule일 때만 사용, 반구를 제외한 원통 부분의 절반 길이 */
+    float CapsuleHalfHeight = 0.f;
+
+    static FCollisionShape MakeSphere(float InRadius);
+    static FCollisionShape MakeBox(const FVector& InHalfExtent);
+    static FCollisionShape MakeCapsule(float InRadius, float InHalfHeight);
+};
+
+/** 쿼리 공통 설정 */
+struct FCollisionQueryParams
+{
+    /** ECollisionChannel의 조합, Simulation Filter Data의 word0가 0인 Shape는 ECC_WorldDefault로 취급 */
+    uint32 ChannelMask = ECC_AllChannels;
+
+    TArray<const AActor*> IgnoredActors;
+    TArray<const UPrimitiveComponent*> IgnoredComponents;
+
+    /** false라면 시작 지점에서 이미 겹친 Shape는 Sweep 결과에서 제외 */
+    bool bFindInitialOverlaps = true;
+
+    void AddIgnoredActor(const AActor* Actor) { IgnoredActors.AddUnique(Actor); }
+    void AddIgnoredComponent(const UPrimitiveComponent* Component) { IgnoredComponents.AddUnique(Component); }
+};
+
+struct FRaycastRequest
+{
+    FVector Start;
+    FVector End;
+};
+
+struct FSweepRequest
+{
+    FVector Start;
+    FVector End;
+    FQuat Rotation = FQuat::Identity;
+    FCollisionShape Shape;
+};
+
+struct FOverlapRequest
+{
+    FVector Location;
+    FQuat Rotation = FQuat::Identity;
+    FCollisionShape Shape;
+};
+
+/** 배치 Overlap에서 요청 하나의 결과가 OutOverlaps에서 차지하는 구간 */
+struct FOverlapResultRange
+{
+    uint32 Offset;
+    uint32 Count;
+};
+
+/**
+ * PxScene에 대한 Raycast, Sweep, Overlap 쿼리
+ *
+ * - Single은 가장 가까운 Blocking Hit 하나, Multi는 필터를 통과한 Hit 전부를 거리 순서로 반환
+ * - Batch는 요청을 FJobSystem Worker에 나눠 각 Worker가 Read Lock을 잡고 scene 쿼리를 직접 호출
+ * - 결과는 호출한 쪽의 배열에 요청 순서대로 기록하므로 배열을 프레임마다 재사용하면 할당이 없음
+ */
+class FPhysicsSceneQuery
+{
+public:
+    explicit FPhysicsSceneQuery(PxScene* InScene) : Scene(InScene) {}
+
+    bool RaycastSingle(const FVector& Start, const FVector& End, FHitResult& OutHit, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+    bool RaycastMulti(const FVector& Start, const FVector& End, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
+    bool SweepSingle(
+        const FVector& Start, const FVector& End, const FQuat& Rotation, const FCollisionShape& Shape,
+        FHitResult& OutHit, const FCollisionQueryParams& Params = FCollisionQueryParams()
+    ) const;
+
+    bool OverlapMulti(
+        const FVector& Location, const FQuat& Rotation, const FCollisionShape& Shape,
+        TArray<FOverlapResult>& OutOverlaps, const FCollisionQueryParams& Params = FCollisionQueryParams()
+    ) const;
+
+    /**
+     * 요청마다 RaycastSingle을 수행, OutHits[i]는 Requests[i]의 결과이고 맞지 않았다면 bBlockingHit가 false
+     * @return Hit한 요청의 수
+     */
+    int32 RaycastBatch(const TArray<FRaycastRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
+    /** 요청마다 SweepSingle을 수행, 결과 배치는 RaycastBatch와 같음 */
+    int32 SweepBatch(const TArray<FSweepRequest>& Requests, TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
+    /**
+     * 요청마다 OverlapMulti를 수행, Requests[i]의 결과는 OutOverlaps의 OutRanges[i] 구간
+     * @param MaxOverlapsPerRequest 요청 하나가 기록할 수 있는 최대 결과 수, 넘치는 결과는 버림
+     * @return 전체 결과 수
+     */
+    int32 OverlapBatch(
+        const TArray<FOverlapRequest>& Requests, TArray<FOverlapResult>& OutOverlaps, TArray<FOverlapResultRange>& OutRanges,
+        const FCollisionQueryParams& Params = FCollisionQueryParams(), uint32 MaxOverlapsPerRequest = 32
+    ) const;
+
+    /**
+     * 별도의 PxScene에 Static Box를 흩뿌리고 같은 Ray들을 순차 쿼리와 RaycastBatch로 돌려 시간을 비교
+     * 결과가 서로 다르면 에러 로그를 남김, 게임 월드에는 영향이 없음
+     */
+    static void RunRaycastBenchmark(PxPhysics* Physics, int32 NumRays = 100000, int32 NumBoxes = 4096);
+
+    /** Multi 쿼리 한 번이 받는 최대 Hit 수 */
+    static constexpr uint32 MAX_MULTI_HITS = 64;
+
+private:
+    PxScene* Scene = nullptr;
+};
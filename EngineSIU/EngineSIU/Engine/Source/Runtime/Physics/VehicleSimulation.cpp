@@ -0,0 +1,649 @@
+#include "VehicleSimulation.h"
+
+#include <cmath>
+
+#include "Async/JobSystem.h"
+#include "Userinterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    /** 바퀴의 회전 속도를 0 쪽으로 줄이되 방향이 뒤집히지는 않게 함 */
+    void ApplyWheelBrake(float& AngularSpeed, float BrakeTorque, float WheelInertia, float DeltaTime)
+    {
+        const float Delta = BrakeTorque / WheelInertia * DeltaTime;
+        if (PxAbs(AngularSpeed) <= Delta)
+        {
+            AngularSpeed = 0.f;
+        }
+        else
+        {
+            AngularSpeed -= AngularSpeed > 0.f ? Delta : -Delta;
+        }
+    }
+}
+
+float FTireFrictionCurve::Evaluate(float Slip) const
+{
+    Slip = PxAbs(Slip);
+    if (Slip <= PeakSlip)
+    {
+        return PeakSlip > 0.f ? PeakFriction * Slip / PeakSlip : PeakFriction;
+    }
+    if (Slip >= SlidingSlip)
+    {
+        return SlidingFriction;
+    }
+    const float Alpha = (Slip - PeakSlip) / (SlidingSlip - PeakSlip);
+    return PeakFriction + (SlidingFriction - PeakFriction) * Alpha;
+}
+
+FVehicleSetup::FVehicleSetup()
+{
+    // FR, FL, RR, RL
+    const float HalfWheelBase = 1.35f;
+    const float HalfTrack = 0.8f;
+    const float AttachmentHeight = -0.1f;
+    Wheels.Add({ PxVec3(HalfWheelBase, HalfTrack, AttachmentHeight), true, false, false });
+    Wheels.Add({ PxVec3(HalfWheelBase, -HalfTrack, AttachmentHeight), true, false, false });
+    Wheels.Add({ PxVec3(-HalfWheelBase, HalfTrack, AttachmentHeight), false, true, true });
+    Wheels.Add({ PxVec3(-HalfWheelBase, -HalfTrack, AttachmentHeight), false, true, true });
+
+    LateralFriction.PeakSlip = 0.15f;
+    LateralFriction.SlidingSlip = 0.6f;
+
+    TorqueCurve.Add({ 1000.f, 300.f });
+    TorqueCurve.Add({ 4500.f, 400.f });
+    TorqueCurve.Add({ 6800.f, 320.f });
+
+    GearRatios = { 3.5f, 2.2f, 1.5f, 1.1f, 0.9f };
+}
+
+FVehicleSimulation::FVehicleSimulation(const FVehicleSetup& InSetup, const PxTransform& InPose)
+    : Setup(InSetup)
+    , Pose(InPose)
+{
+    // 균일한 상자의 관성 텐서
+    const PxVec3& Half = Setup.ChassisHalfExtent;
+    const float Scale = Setup.Mass / 3.f;
+    const PxVec3 Inertia(
+        Scale * (Half.y * Half.y + Half.z * Half.z),
+        Scale * (Half.x * Half.x + Half.z * Half.z),
+        Scale * (Half.x * Half.x + Half.y * Half.y)
+    );
+    InvInertiaLocal = PxVec3(1.f / Inertia.x, 1.f / Inertia.y, 1.f / Inertia.z);
+    WheelInertia = 0.5f * Setup.WheelMass * Setup.WheelRadius * Setup.WheelRadius;
+
+    Wheels.SetNum(Setup.Wheels.Num());
+    for (int32 WheelIndex = 0; WheelIndex < Wheels.Num(); ++WheelIndex)
+    {
+        Wheels[WheelIndex] = FVehicleWheelState();
+        Wheels[WheelIndex].SuspensionLength = Setup.SuspensionMaxLength;
+        if (Setup.Wheels[WheelIndex].bDriven)
+        {
+            ++NumDrivenWheels;
+        }
+    }
+    EngineRPM = Setup.IdleRPM;
+}
+
+PxVec3 FVehicleSimulation::GetInertiaTensor() const
+{
+    return PxVec3(1.f / InvInertiaLocal.x, 1.f / InvInertiaLocal.y, 1.f / InvInertiaLocal.z);
+}
+
+void FVehicleSimulation::SetBodyState(const PxTransform& InPose, const PxVec3& InLinearVelocity, const PxVec3& InAngularVelocity)
+{
+    Pose = InPose;
+    LinearVelocity = InLinearVelocity;
+    AngularVelocity = InAngularVelocity;
+}
+
+float FVehicleSimulation::GetForwardSpeed() const
+{
+    return LinearVelocity.dot(Pose.q.getBasisVector0());
+}
+
+PxTransform FVehicleSimulation::GetWheelLocalTransform(int32 WheelIndex) const
+{
+    const FVehicleWheelState& Wheel = Wheels[WheelIndex];
+    const PxVec3 Center = Setup.Wheels[WheelIndex].AttachmentPosition - PxVec3(0.f, 0.f, Wheel.SuspensionLength);
+    const PxQuat Steer(Wheel.SteerAngle, PxVec3(0.f, 0.f, 1.f));
+    const PxQuat Spin(Wheel.SpinAngle, PxVec3(0.f, 1.f, 0.f));
+    return PxTransform(Center, Steer * Spin);
+}
+
+void FVehicleSimulation::GetWheelRays(FVehicleWheelRay* OutRays) const
+{
+    const PxVec3 Down = -Pose.q.getBasisVector2();
+    const float Length = Setup.SuspensionMaxLength + Setup.WheelRadius;
+    for (int32 WheelIndex = 0; WheelIndex < Wheels.Num(); ++WheelIndex)
+    {
+        OutRays[WheelIndex] = { Pose.transform(Setup.Wheels[WheelIndex].AttachmentPosition), Down, Length };
+    }
+}
+
+void FVehicleSimulation::UpdateSteering(float DeltaTime)
+{
+    const float TargetAngle = PxClamp(Input.Steer, -1.f, 1.f) * Setup.MaxSteerAngle;
+    const float MaxDelta = Setup.SteerSpeed * DeltaTime;
+    for (int32 WheelIndex = 0; WheelIndex < Wheels.Num(); ++WheelIndex)
+    {
+        if (Setup.Wheels[WheelIndex].bSteered)
+        {
+            float& SteerAngle = Wheels[WheelIndex].SteerAngle;
+            SteerAngle += PxClamp(TargetAngle - SteerAngle, -MaxDelta, MaxDelta);
+        }
+    }
+}
+
+float FVehicleSimulation::GetTotalGearRatio() const
+{
+    if (CurrentGear < 0)
+    {
+        return -Setup.ReverseGearRatio * Setup.FinalDriveRatio;
+    }
+    return Setup.GearRatios[CurrentGear - 1] * Setup.FinalDriveRatio;
+}
+
+float FVehicleSimulation::EvaluateEngineTorque(float RPM) const
+{
+    const TArray<FEngineTorquePoint>& Curve = Setup.TorqueCurve;
+    if (Curve.Num() == 0)
+    {
+        return 0.f;
+    }
+    if (RPM <= Curve[0].RPM)
+    {
+        return Curve[0].Torque;
+    }
+    for (int32 Index = 1; Index < Curve.Num(); ++Index)
+    {
+        if (RPM <= Curve[Index].RPM)
+        {
+            const FEngineTorquePoint& Prev = Curve[Index - 1];
+            const FEngineTorquePoint& Next = Curve[Index];
+            const float Alpha = (RPM - Prev.RPM) / (Next.RPM - Prev.RPM);
+            return Prev.Torque + (Next.Torque - Prev.Torque) * Alpha;
+        }
+    }
+    return Curve.Last().Torque;
+}
+
+void FVehicleSimulation::UpdateDrivetrain(float DeltaTime)
+{
+    DriveTorquePerWheel = 0.f;
+    if (NumDrivenWheels == 0 || Setup.GearRatios.Num() == 0)
+    {
+        return;
+    }
+
+    ShiftTimer = PxMax(ShiftTimer - DeltaTime, 0.f);
+    if (Input.bReverse)
+    {
+        CurrentGear = -1;
+    }
+    else if (CurrentGear < 1)
+    {
+        CurrentGear = 1;
+    }
+
+    float DrivenWheelSpeed = 0.f;
+    for (int32 WheelIndex = 0; WheelIndex < Wheels.Num(); ++WheelIndex)
+    {
+        if (Setup.Wheels[WheelIndex].bDriven)
+        {
+            DrivenWheelSpeed += Wheels[WheelIndex].AngularSpeed;
+        }
+    }
+    DrivenWheelSpeed /= static_cast<float>(NumDrivenWheels);
+
+    auto ComputeRPM = [this, DrivenWheelSpeed]()
+    {
+        return PxMax(PxAbs(DrivenWheelSpeed * GetTotalGearRatio()) * 60.f / PxTwoPi, Setup.IdleRPM);
+    };
+    EngineRPM = ComputeRPM();
+
+    if (CurrentGear > 0 && ShiftTimer <= 0.f)
+    {
+        if (EngineRPM > Setup.UpshiftRPM && CurrentGear < Setup.GearRatios.Num())
+        {
+            ++CurrentGear;
+            ShiftTimer = Setup.ShiftCooldown;
+        }
+        else if (EngineRPM < Setup.DownshiftRPM && CurrentGear > 1)
+        {
+            --CurrentGear;
+            ShiftTimer = Setup.ShiftCooldown;
+        }
+        EngineRPM = ComputeRPM();
+    }
+
+    // 레드존에서는 연료를 끊음
+    const float EngineTorque = EngineRPM < Setup.MaxRPM ? EvaluateEngineTorque(EngineRPM) * PxClamp(Input.Throttle, 0.f, 1.f) : 0.f;
+    DriveTorquePerWheel = EngineTorque * GetTotalGearRatio() * Setup.DrivetrainEfficiency / static_cast<float>(NumDrivenWheels);
+}
+
+void FVehicleSimulation::Substep(float DeltaTime, const FVehicleWheelHit* Hits)
+{
+    const PxMat33 Rotation(Pose.q);
+    const PxVec3 Forward = Rotation.column0;
+    const PxVec3 Right = Rotation.column1;
+    const PxVec3 Up = Rotation.column2;
+
+    UpdateSteering(DeltaTime);
+    UpdateDrivetrain(DeltaTime);
+
+    const float Radius = Setup.WheelRadius;
+    const float MaxLength = Setup.SuspensionMaxLength;
+
+    int32 NumGroundedWheels = 0;
+    for (int32 WheelIndex = 0; WheelIndex < Wheels.Num(); ++WheelIndex)
+    {
+        if (Hits[WheelIndex].bHit && Hits[WheelIndex].Distance <= MaxLength + Radius)
+        {
+            ++NumGroundedWheels;
+        }
+    }
+    // 접지한 바퀴 하나가 떠맡는 차체 질량, 한 서브스텝 안에 미끄러짐을 없애는 힘을 구할 때 사용
+    const float EffectiveMass = Setup.Mass / static_cast<float>(PxMax(NumGroundedWheels, 1));
+
+    PxVec3 Force = Setup.Gravity * Setup.Mass;
+    PxVec3 Torque(0.f);
+
+    for (int32 WheelIndex = 0; WheelIndex < Wheels.Num(); ++WheelIndex)
+    {
+        const FVehicleWheelSetup& WheelSetup = Setup.Wheels[WheelIndex];
+        FVehicleWheelState& Wheel = Wheels[WheelIndex];
+        const FVehicleWheelHit& Hit = Hits[WheelIndex];
+
+        float BrakeTorque = PxClamp(Input.Brake, 0.f, 1.f) * Setup.BrakeTorque;
+        if (WheelSetup.bHandbrake && Input.bHandbrake)
+        {
+            BrakeTorque += Setup.HandbrakeTorque;
+        }
+        if (WheelSetup.bDriven)
+        {
+            Wheel.AngularSpeed += DriveTorquePerWheel / WheelInertia * DeltaTime;
+        }
+
+        Wheel.bOnGround = Hit.bHit && Hit.Distance <= MaxLength + Radius;
+        if (!Wheel.bOnGround)
+        {
+            Wheel.SuspensionLength = MaxLength;
+            Wheel.TireLoad = 0.f;
+            Wheel.LongitudinalSlip = 0.f;
+            Wheel.LateralSlip = 0.f;
+            ApplyWheelBrake(Wheel.AngularSpeed, BrakeTorque, WheelInertia, DeltaTime);
+            Wheel.SpinAngle = std::fmod(Wheel.SpinAngle + Wheel.AngularSpeed * DeltaTime, PxTwoPi);
+            continue;
+        }
+
+        // 서스펜션
+        const PxVec3 Attachment = Pose.transform(WheelSetup.AttachmentPosition);
+        Wheel.SuspensionLength = PxClamp(Hit.Distance - Radius, 0.f, MaxLength);
+        const PxVec3 ContactPoint = Attachment - Up * (Wheel.SuspensionLength + Radius);
+        const PxVec3 Arm = ContactPoint - Pose.p;
+        const PxVec3 ContactVelocity = LinearVelocity + AngularVelocity.cross(Arm);
+
+        const float SpringForce = Setup.SuspensionStiffness * (MaxLength - Wheel.SuspensionLength);
+        const float DamperForce = -Setup.SuspensionDamping * ContactVelocity.dot(Up);
+        Wheel.TireLoad = PxMax(SpringForce + DamperForce, 0.f);
+
+        // 타이어 방향, 조향한 앞 방향을 접지면에 투영
+        const float SteerCos = PxCos(Wheel.SteerAngle);
+        const float SteerSin = PxSin(Wheel.SteerAngle);
+        const PxVec3 SteeredForward = Forward * SteerCos + Right * SteerSin;
+        PxVec3 LongitudinalDir = SteeredForward - Hit.Normal * SteeredForward.dot(Hit.Normal);
+        if (LongitudinalDir.normalize() < 1e-4f)
+        {
+            LongitudinalDir = SteeredForward;
+        }
+        const PxVec3 LateralDir = Hit.Normal.cross(LongitudinalDir);
+
+        const float LongitudinalVelocity = ContactVelocity.dot(LongitudinalDir);
+        const float LateralVelocity = ContactVelocity.dot(LateralDir);
+        const float SlipDenominator = PxMax(PxAbs(LongitudinalVelocity), Setup.LowSpeedThreshold);
+
+        // 브레이크(구름 저항 포함)를 먼저 걸고, 바퀴가 멈췄다면 타이어 힘이 브레이크를 넘지 않는 한 잠긴 채로 둠
+        const float TotalBrakeTorque = BrakeTorque + Setup.RollingResistance * Wheel.TireLoad * Radius;
+        ApplyWheelBrake(Wheel.AngularSpeed, TotalBrakeTorque, WheelInertia, DeltaTime);
+        const bool bLocked = Wheel.AngularSpeed == 0.f && TotalBrakeTorque > 0.f;
+
+        // 힘이 이번 서브스텝 안에 미끄러짐을 0으로 만드는 크기를 넘으면 부호가 뒤집히며 진동하므로 그 크기로 제한
+        // 잠긴 바퀴는 돌지 않으므로 차체만 움직여서 미끄러짐을 없앰
+        const float SlipVelocity = Wheel.AngularSpeed * Radius - LongitudinalVelocity;
+        Wheel.LongitudinalSlip = SlipVelocity / SlipDenominator;
+        const float WheelResponse = bLocked ? 0.f : Radius * Radius / WheelInertia;
+        const float NoSlipLongitudinalForce = SlipVelocity / ((WheelResponse + 1.f / EffectiveMass) * DeltaTime);
+        const float MaxLongitudinalForce = Setup.LongitudinalFriction.Evaluate(Wheel.LongitudinalSlip) * Wheel.TireLoad;
+        float LongitudinalForce = PxClamp(NoSlipLongitudinalForce, -MaxLongitudinalForce, MaxLongitudinalForce);
+
+        Wheel.LateralSlip = PxAtan2(LateralVelocity, SlipDenominator);
+        const float NoSlipLateralForce = -LateralVelocity * EffectiveMass / DeltaTime;
+        const float MaxLateralForce = Setup.LateralFriction.Evaluate(Wheel.LateralSlip) * Wheel.TireLoad;
+        float LateralForce = PxClamp(NoSlipLateralForce, -MaxLateralForce, MaxLateralForce);
+
+        // 마찰 타원, 두 방향의 합력이 최대 마찰력을 넘지 않게 함
+        const float MaxFriction = PxMax(Setup.LongitudinalFriction.PeakFriction, Setup.LateralFriction.PeakFriction) * Wheel.TireLoad;
+        const float CombinedForce = PxSqrt(LongitudinalForce * LongitudinalForce + LateralForce * LateralForce);
+        if (CombinedForce > MaxFriction && CombinedForce > 0.f)
+        {
+            const float Scale = MaxFriction / CombinedForce;
+            LongitudinalForce *= Scale;
+            LateralForce *= Scale;
+        }
+
+        const float TireTorque = -LongitudinalForce * Radius;
+        if (!bLocked)
+        {
+            Wheel.AngularSpeed += TireTorque / WheelInertia * DeltaTime;
+        }
+        else if (PxAbs(TireTorque) > TotalBrakeTorque)
+        {
+            const float ExcessTorque = TireTorque > 0.f ? TireTorque - TotalBrakeTorque : TireTorque + TotalBrakeTorque;
+            Wheel.AngularSpeed = ExcessTorque / WheelInertia * DeltaTime;
+        }
+        Wheel.SpinAngle = std::fmod(Wheel.SpinAngle + Wheel.AngularSpeed * DeltaTime, PxTwoPi);
+
+        // 바퀴 질량을 무시하므로 차체가 받는 힘은 접지면의 수직 항력과 마찰력
+        const PxVec3 WheelForce = Hit.Normal * Wheel.TireLoad + LongitudinalDir * LongitudinalForce + LateralDir * LateralForce;
+        Force += WheelForce;
+        Torque += Arm.cross(WheelForce);
+    }
+
+    Force -= LinearVelocity * (Setup.AirDrag * LinearVelocity.magnitude());
+
+    // Semi-implicit Euler, 각가속도는 차체 로컬 공간의 대각 관성 텐서로 계산
+    LinearVelocity += Force * (DeltaTime / Setup.Mass);
+    const PxVec3 LocalAngularAcceleration = Rotation.transformTranspose(Torque).multiply(InvInertiaLocal);
+    AngularVelocity += Rotation.transform(LocalAngularAcceleration) * DeltaTime;
+
+    Pose.p += LinearVelocity * DeltaTime;
+    const PxQuat AngularQuat(AngularVelocity.x, AngularVelocity.y, AngularVelocity.z, 0.f);
+    Pose.q = (Pose.q + AngularQuat * Pose.q * (0.5f * DeltaTime)).getNormalized();
+}
+
+void FVehicleManager::AddVehicle(FVehicleSimulation* Vehicle)
+{
+    if (Vehicle)
+    {
+        Vehicles.AddUnique(Vehicle);
+    }
+}
+
+void FVehicleManager::RemoveVehicle(FVehicleSimulation* Vehicle)
+{
+    Vehicles.Remove(Vehicle);
+}
+
+void FVehicleManager::Simulate(float DeltaTime, const FWheelRaycastFunction& RaycastWheels)
+{
+    Stats = FVehicleManagerStats();
+    Stats.NumVehicles = Vehicles.Num();
+    if (DeltaTime <= 0.f || Vehicles.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 NumSubsteps = PxClamp(static_cast<int32>(std::ceil(DeltaTime / MaxSubstepDeltaTime)), 1, MaxSubsteps);
+    const float SubstepDeltaTime = DeltaTime / static_cast<float>(NumSubsteps);
+
+    int32 NumRays = 0;
+    WheelOffsets.SetNum(Vehicles.Num());
+    for (int32 VehicleIndex = 0; VehicleIndex < Vehicles.Num(); ++VehicleIndex)
+    {
+        WheelOffsets[VehicleIndex] = NumRays;
+        NumRays += Vehicles[VehicleIndex]->GetNumWheels();
+    }
+    WheelRays.SetNum(NumRays);
+    WheelHits.SetNum(NumRays);
+
+    for (int32 VehicleIndex = 0; VehicleIndex < Vehicles.Num(); ++VehicleIndex)
+    {
+        Vehicles[VehicleIndex]->GetWheelRays(&WheelRays[WheelOffsets[VehicleIndex]]);
+    }
+
+    // 서브스텝 계산과 다음 서브스텝의 Ray 생성은 차마다 독립적
+    auto StepVehicle = [this, SubstepDeltaTime](int32 VehicleIndex)
+    {
+        FVehicleSimulation* Vehicle = Vehicles[VehicleIndex];
+        const int32 Offset = WheelOffsets[VehicleIndex];
+        Vehicle->Substep(SubstepDeltaTime, &WheelHits[Offset]);
+        Vehicle->GetWheelRays(&WheelRays[Offset]);
+    };
+    const bool bParallel = Vehicles.Num() >= ParallelVehicleThreshold;
+
+    for (int32 Step = 0; Step < NumSubsteps; ++Step)
+    {
+        RaycastWheels(WheelRays, WheelHits);
+
+        if (bParallel)
+        {
+            FJobSystem::Get().ParallelFor(Vehicles.Num(), StepVehicle, 4);
+        }
+        else
+        {
+            for (int32 VehicleIndex = 0; VehicleIndex < Vehicles.Num(); ++VehicleIndex)
+            {
+                StepVehicle(VehicleIndex);
+            }
+        }
+    }
+
+    Stats.NumSubsteps = NumSubsteps;
+    Stats.NumWheelRays = NumRays * NumSubsteps;
+}
+
+namespace
+{
+    /** z = 0 평면 */
+    void RaycastFlatGround(const TArray<FVehicleWheelRay>& Rays, TArray<FVehicleWheelHit>& OutHits)
+    {
+        for (int32 Index = 0; Index < Rays.Num(); ++Index)
+        {
+            const FVehicleWheelRay& Ray = Rays[Index];
+            FVehicleWheelHit& Hit = OutHits[Index];
+            Hit = FVehicleWheelHit();
+            if (Ray.Direction.z < 0.f && Ray.Start.z >= 0.f)
+            {
+                const float Distance = Ray.Start.z / -Ray.Direction.z;
+                if (Distance <= Ray.Length)
+                {
+                    Hit.bHit = true;
+                    Hit.Distance = Distance;
+                }
+            }
+        }
+    }
+
+    bool IsFiniteState(const FVehicleSimulation& Vehicle)
+    {
+        return Vehicle.GetPose().isFinite() && Vehicle.GetLinearVelocity().isFinite() && Vehicle.GetAngularVelocity().isFinite();
+    }
+
+    float GetTiltDegrees(const FVehicleSimulation& Vehicle)
+    {
+        return PxAcos(PxClamp(Vehicle.GetPose().q.getBasisVector2().z, -1.f, 1.f)) * 180.f / PxPi;
+    }
+
+    struct FBrakingTestResult
+    {
+        bool bFinite = true;
+        bool bReachedSpeed = false;
+        bool bStopped = false;
+
+        /** 내려놓은 뒤 정지한 상태 */
+        float RestSpeed = 0.f;
+        float RestTiltDegrees = 0.f;
+        int32 RestGroundedWheels = 0;
+
+        float AccelerationTime = 0.f;
+        float StoppingDistance = 0.f;
+        float StoppingTime = 0.f;
+
+        /** 제동 중 최대값 */
+        float MaxTiltDegrees = 0.f;
+        float MaxLateralDrift = 0.f;
+        float MaxYawDegrees = 0.f;
+    };
+
+    /** 평평한 바닥에 차를 내려놓고, TargetSpeed까지 가속한 뒤 완전히 제동 */
+    FBrakingTestResult RunBrakingTest(float FrameDeltaTime, float TargetSpeed)
+    {
+        FBrakingTestResult Result;
+
+        const FVehicleSetup Setup;
+        FVehicleSimulation Vehicle(Setup, PxTransform(PxVec3(0.f, 0.f, 1.f)));
+        FVehicleManager Manager;
+        Manager.AddVehicle(&Vehicle);
+
+        auto Advance = [&](float Seconds, auto&& Condition)
+        {
+            for (float Time = 0.f; Time < Seconds; Time += FrameDeltaTime)
+            {
+                Manager.Simulate(FrameDeltaTime, RaycastFlatGround);
+                if (!IsFiniteState(Vehicle))
+                {
+                    Result.bFinite = false;
+                    return -1.f;
+                }
+                if (Condition())
+                {
+                    return Time + FrameDeltaTime;
+                }
+            }
+            return -1.f;
+        };
+
+        Advance(3.f, [] { return false; });
+        if (!Result.bFinite)
+        {
+            return Result;
+        }
+        Result.RestSpeed = Vehicle.GetLinearVelocity().magnitude();
+        Result.RestTiltDegrees = GetTiltDegrees(Vehicle);
+        for (int32 WheelIndex = 0; WheelIndex < Vehicle.GetNumWheels(); ++WheelIndex)
+        {
+            Result.RestGroundedWheels += Vehicle.GetWheelState(WheelIndex).bOnGround ? 1 : 0;
+        }
+
+        FVehicleInput Input;
+        Input.Throttle = 1.f;
+        Vehicle.SetInput(Input);
+        Result.AccelerationTime = Advance(30.f, [&] { return Vehicle.GetForwardSpeed() >= TargetSpeed; });
+        Result.bReachedSpeed = Result.AccelerationTime > 0.f;
+        if (!Result.bReachedSpeed)
+        {
+            return Result;
+        }
+
+        Input.Throttle = 0.f;
+        Input.Brake = 1.f;
+        Vehicle.SetInput(Input);
+
+        const PxVec3 BrakeStart = Vehicle.GetPose().p;
+        const PxVec3 Forward = Vehicle.GetPose().q.getBasisVector0();
+        const PxVec3 Right = Vehicle.GetPose().q.getBasisVector1();
+        const float StartYaw = PxAtan2(Forward.y, Forward.x);
+        Result.StoppingTime = Advance(30.f, [&]
+        {
+            const PxVec3 Offset = Vehicle.GetPose().p - BrakeStart;
+            const PxVec3 CurrentForward = Vehicle.GetPose().q.getBasisVector0();
+            Result.MaxTiltDegrees = PxMax(Result.MaxTiltDegrees, GetTiltDegrees(Vehicle));
+            Result.MaxLateralDrift = PxMax(Result.MaxLateralDrift, PxAbs(Offset.dot(Right)));
+            Result.MaxYawDegrees = PxMax(Result.MaxYawDegrees, PxAbs(PxAtan2(CurrentForward.y, CurrentForward.x) - StartYaw) * 180.f / PxPi);
+            Result.StoppingDistance = Offset.dot(Forward);
+            return Vehicle.GetLinearVelocity().magnitude() < 0.1f;
+        });
+        Result.bStopped = Result.StoppingTime > 0.f;
+        return Result;
+    }
+}
+
+bool FVehicleManager::RunSelfTest()
+{
+    constexpr float TargetSpeed = 20.f;
+    const FVehicleSetup Setup;
+    const float Gravity = Setup.Gravity.magnitude();
+
+    // 바퀴가 미끄러지지 않을 때와 완전히 잠겼을 때의 이론상 제동 거리, 하중 이동과 공기 저항 때문에 여유를 둠
+    const float MinDistance = TargetSpeed * TargetSpeed / (2.f * Setup.LongitudinalFriction.PeakFriction * Gravity) * 0.9f;
+    const float MaxDistance = TargetSpeed * TargetSpeed / (2.f * Setup.LongitudinalFriction.SlidingFriction * Gravity) * 1.2f;
+
+    const float FrameRates[] = { 30.f, 60.f, 144.f };
+    float ReferenceDistance = 0.f;
+    bool bPassed = true;
+
+    for (const float FrameRate : FrameRates)
+    {
+        const FBrakingTestResult Result = RunBrakingTest(1.f / FrameRate, TargetSpeed);
+
+        bool bCasePassed = Result.bFinite && Result.bReachedSpeed && Result.bStopped;
+        bCasePassed &= Result.RestSpeed < 0.05f && Result.RestTiltDegrees < 1.f && Result.RestGroundedWheels == 4;
+        bCasePassed &= Result.StoppingDistance >= MinDistance && Result.StoppingDistance <= MaxDistance;
+        bCasePassed &= Result.MaxTiltDegrees < 5.f && Result.MaxLateralDrift < 0.2f && Result.MaxYawDegrees < 1.f;
+
+        // 프레임레이트가 달라도 서브스텝 간격이 비슷하므로 결과도 비슷해야 함
+        if (ReferenceDistance <= 0.f)
+        {
+            ReferenceDistance = Result.StoppingDistance;
+        }
+        else if (PxAbs(Result.StoppingDistance - ReferenceDistance) > ReferenceDistance * 0.03f)
+        {
+            bCasePassed = false;
+        }
+
+        UE_LOG(
+            bCasePassed ? ELogLevel::Display : ELogLevel::Error,
+            TEXT("Vehicle test %.0f fps: %s, rest %.3f m/s tilt %.2f deg, 0-%.0f m/s %.2f s, stop %.2f m in %.2f s (expected %.1f ~ %.1f), tilt %.2f deg, drift %.3f m, yaw %.2f deg"),
+            FrameRate, bCasePassed ? TEXT("PASS") : TEXT("FAIL"),
+            Result.RestSpeed, Result.RestTiltDegrees, TargetSpeed, Result.AccelerationTime,
+            Result.StoppingDistance, Result.StoppingTime, MinDistance, MaxDistance,
+            Result.MaxTiltDegrees, Result.MaxLateralDrift, Result.MaxYawDegrees
+        );
+        bPassed &= bCasePassed;
+    }
+    return bPassed;
+}
+
+void FVehicleManager::RunBenchmark(int32 NumVehicles, int32 NumFrames)
+{
+    if (NumVehicles <= 0 || NumFrames <= 0)
+    {
+        return;
+    }
+
+    const FVehicleSetup Setup;
+    TArray<FVehicleSimulation> Simulations;
+    Simulations.Reserve(NumVehicles);
+    FVehicleManager Manager;
+    for (int32 Index = 0; Index < NumVehicles; ++Index)
+    {
+        const PxVec3 Location(static_cast<float>(Index % 32) * 4.f, static_cast<float>(Index / 32) * 8.f, 1.f);
+        Simulations.Emplace(Setup, PxTransform(Location));
+
+        FVehicleInput Input;
+        Input.Throttle = 1.f;
+        Input.Steer = static_cast<float>(Index % 5 - 2) * 0.25f;
+        Simulations.Last().SetInput(Input);
+    }
+    for (FVehicleSimulation& Simulation : Simulations)
+    {
+        Manager.AddVehicle(&Simulation);
+    }
+
+    constexpr float FrameDeltaTime = 1.f / 60.f;
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Manager.Simulate(FrameDeltaTime, RaycastFlatGround);
+    }
+    const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("Vehicle bench: %d vehicles x %d frames, %d substeps/frame, %.3f ms/frame (%.2f us/vehicle)"),
+        NumVehicles, NumFrames, Manager.GetStats().NumSubsteps,
+        ElapsedMs / NumFrames, ElapsedMs * 1000.0 / NumFrames / NumVehicles
+    );
+}
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Templates/Function.h"
+
+using namespace physx;
+
+/**
+ * 미끄러짐에 따른 타이어 마찰 계수
+ * 0에서 PeakSlip까지 PeakFriction으로 선형 증가하고, SlidingSlip까지 SlidingFriction으로 줄어든 뒤 그대로 유지
+ */
+struct FTireFrictionCurve
+{
+    float PeakSlip = 0.1f;
+    float PeakFriction = 1.0f;
+    float SlidingSlip = 0.5f;
+    float SlidingFriction = 0.8f;
+
+    float Evaluate(float Slip) const;
+};
+
+struct FEngineTorquePoint
+{
+    float RPM;
+    float Torque;
+};
+
+/** 바퀴 하나의 장착 정보, 좌표는 차체 로컬(X 앞, Y 오른쪽, Z 위) */
+struct FVehicleWheelSetup
+{
+    /** 서스펜션이 시작되는 지점, 바퀴 중심은 여기서 차체 아래 방향으로 서스펜션 길이만큼 내려감 */
+    PxVec3 AttachmentPosition = PxVec3(0.f);
+
+    bool bSteered = false;
+    bool bDriven = false;
+    bool bHandbrake = false;
+};
+
+/** 차 한 대의 설정, 기본값은 1.2톤 후륜 구동 승용차 */
+struct FVehicleSetup
+{
+    FVehicleSetup();
+
+    float Mass = 1200.f;
+
+    /** 관성 텐서 계산에 쓰는 차체 상자의 절반 크기 */
+    PxVec3 ChassisHalfExtent = PxVec3(2.2f, 0.9f, 0.6f);
+
+    PxVec3 Gravity = PxVec3(0.f, 0.f, -9.81f);
+
+    TArray<FVehicleWheelSetup> Wheels;
+
+    float WheelRadius = 0.35f;
+    float WheelMass = 20.f;
+
+    float SuspensionMaxLength = 0.4f;
+    float SuspensionStiffness = 30000.f;
+    float SuspensionDamping = 3000.f;
+
+    float MaxSteerAngle = PxPi / 6.f;
+    /** 초당 조향 각속도 */
+    float SteerSpeed = PxPi;
+
+    /** 바퀴 하나에 거는 최대 토크 */
+    float BrakeTorque = 2000.f;
+    float HandbrakeTorque = 3000.f;
+
+    float RollingResistance = 0.015f;
+    /** 공기 저항 계수, 저항력 = AirDrag * 속력^2 */
+    float AirDrag = 0.4f;
+
+    FTireFrictionCurve LongitudinalFriction;
+    /** Slip은 미끄러짐 각(라디안) */
+    FTireFrictionCurve LateralFriction;
+
+    /** 이 속력 아래에서는 미끄러짐 비율의 분모를 고정해서 정지 근처에서 값이 튀지 않게 함 */
+    float LowSpeedThreshold = 1.f;
+
+    /** RPM 오름차순 */
+    TArray<FEngineTorquePoint> TorqueCurve;
+    float IdleRPM = 900.f;
+    float MaxRPM = 6800.f;
+
+    TArray<float> GearRatios;
+    float ReverseGearRatio = 3.2f;
+    float FinalDriveRatio = 3.7f;
+    float DrivetrainEfficiency = 0.85f;
+
+    float UpshiftRPM = 5800.f;
+    float DownshiftRPM = 2500.f;
+    /** 변속 후 이 시간 동안은 다시 변속하지 않음 */
+    float ShiftCooldown = 0.3f;
+};
+
+struct FVehicleInput
+{
+    /** 0 ~ 1 */
+    float Throttle = 0.f;
+    float Brake = 0.f;
+
+    /** -1(왼쪽) ~ 1(오른쪽) */
+    float Steer = 0.f;
+
+    bool bHandbrake = false;
+
+    /** true라면 후진 기어, 변속기는 전진 기어 안에서만 자동으로 변속함 */
+    bool bReverse = false;
+};
+
+struct FVehicleWheelRay
+{
+    PxVec3 Start;
+    PxVec3 Direction;
+    float Length;
+};
+
+struct FVehicleWheelHit
+{
+    bool bHit = false;
+    float Distance = 0.f;
+    PxVec3 Normal = PxVec3(0.f, 0.f, 1.f);
+};
+
+struct FVehicleWheelState
+{
+    float SuspensionLength = 0.f;
+    float SteerAngle = 0.f;
+
+    /** 굴러가는 방향이 양수 */
+    float AngularSpeed = 0.f;
+    float SpinAngle = 0.f;
+
+    float TireLoad = 0.f;
+    float LongitudinalSlip = 0.f;
+    float LateralSlip = 0.f;
+
+    bool bOnGround = false;
+};
+
+/**
+ * 강체 하나와 바퀴마다의 서스펜션 Raycast로 움직이는 차
+ *
+ * - 서스펜션은 스프링과 댐퍼, 타이어 힘은 미끄러짐 비율과 미끄러짐 각에 마찰 곡선을 적용하고 마찰 타원으로 합침
+ * - 엔진은 토크 곡선, 기어비, 종감속비로 구동 바퀴에 토크를 나누고 전진 기어는 RPM에 따라 자동 변속
+ * - 차체 상태를 직접 적분하므로 PhysX 없이도 돌릴 수 있고, PhysX 강체와 쓸 때는 SetBodyState로 상태를 맞춤
+ * - 바퀴 Raycast는 밖에서 처리, 보통 FVehicleManager가 여러 대의 Ray를 모아 한 번에 처리함
+ */
+class FVehicleSimulation
+{
+public:
+    explicit FVehicleSimulation(const FVehicleSetup& InSetup, const PxTransform& InPose = PxTransform(PxIdentity));
+
+    const FVehicleSetup& GetSetup() const { return Setup; }
+
+    void SetInput(const FVehicleInput& InInput) { Input = InInput; }
+    const FVehicleInput& GetInput() const { return Input; }
+
+    /** Pose는 무게 중심의 Transform */
+    void SetBodyState(const PxTransform& InPose, const PxVec3& InLinearVelocity, const PxVec3& InAngularVelocity);
+
+    const PxTransform& GetPose() const { return Pose; }
+    const PxVec3& GetLinearVelocity() const { return LinearVelocity; }
+    const PxVec3& GetAngularVelocity() const { return AngularVelocity; }
+
+    /** 차체 로컬 관성 텐서의 대각 성분, 같은 차체를 PhysX 강체로 만들 때 사용 */
+    PxVec3 GetInertiaTensor() const;
+
+    /** 차체 앞 방향 속력, 후진 중이면 음수 */
+    float GetForwardSpeed() const;
+
+    int32 GetNumWheels() const { return Wheels.Num(); }
+    const FVehicleWheelState& GetWheelState(int32 WheelIndex) const { return Wheels[WheelIndex]; }
+
+    /** 차체 로컬 공간에서 바퀴 중심의 위치와 조향, 회전이 반영된 방향, 바퀴 축은 Y */
+    PxTransform GetWheelLocalTransform(int32 WheelIndex) const;
+
+    /** 1 ~ 기어 수, 후진은 -1 */
+    int32 GetCurrentGear() const { return CurrentGear; }
+    float GetEngineRPM() const { return EngineRPM; }
+
+    /** 현재 자세에서 바퀴마다 쏠 서스펜션 Ray, OutRays는 GetNumWheels()개 이상이어야 함 */
+    void GetWheelRays(FVehicleWheelRay* OutRays) const;
+
+    /** Hits[i]는 GetWheelRays가 만든 i번째 Ray의 결과 */
+    void Substep(float DeltaTime, const FVehicleWheelHit* Hits);
+
+private:
+    void UpdateSteering(float DeltaTime);
+    void UpdateDrivetrain(float DeltaTime);
+    float EvaluateEngineTorque(float RPM) const;
+    float GetTotalGearRatio() const;
+
+    FVehicleSetup Setup;
+    FVehicleInput Input;
+
+    PxTransform Pose;
+    PxVec3 LinearVelocity = PxVec3(0.f);
+    PxVec3 AngularVelocity = PxVec3(0.f);
+
+    /** 차체 로컬 관성 텐서의 역수 대각 성분 */
+    PxVec3 InvInertiaLocal;
+    float WheelInertia;
+
+    TArray<FVehicleWheelState> Wheels;
+
+    int32 CurrentGear = 1;
+    float EngineRPM = 0.f;
+    float ShiftTimer = 0.f;
+    float DriveTorquePerWheel = 0.f;
+    int32 NumDrivenWheels = 0;
+};
+
+struct FVehicleManagerStats
+{
+    int32 NumVehicles = 0;
+    int32 NumSubsteps = 0;
+    int32 NumWheelRays = 0;
+};
+
+/**
+ * 등록된 모든 차를 같은 서브스텝으로 진행
+ *
+ * - 프레임 시간을 MaxSubstepDeltaTime 이하의 같은 간격으로 나누므로 프레임레이트와 무관하게 적분 간격이 일정 범위 안에 있음
+ * - 서브스텝마다 모든 차의 바퀴 Ray를 모아 RaycastWheels를 한 번만 호출
+ * - 차가 많으면 서브스텝의 힘 계산과 적분을 FJobSystem으로 나눠 처리
+ */
+class FVehicleManager
+{
+public:
+    /** Rays[i]의 결과를 OutHits[i]에 기록, OutHits는 Rays와 같은 크기로 맞춰서 넘어옴 */
+    using FWheelRaycastFunction = TFunction<void(const TArray<FVehicleWheelRay>& Rays, TArray<FVehicleWheelHit>& OutHits)>;
+
+    void AddVehicle(FVehicleSimulation* Vehicle);
+    void RemoveVehicle(FVehicleSimulation* Vehicle);
+    int32 GetNumVehicles() const { return Vehicles.Num(); }
+
+    void Simulate(float DeltaTime, const FWheelRaycastFunction& RaycastWheels);
+
+    const FVehicleManagerStats& GetStats() const { return Stats; }
+
+    /** 평평한 바닥에서 정지, 가속, 제동을 여러 프레임레이트로 돌려 제동 거리와 자세를 검사하고 결과를 로그로 출력 */
+    static bool RunSelfTest();
+
+    /** 평평한 바닥에서 NumVehicles대를 NumFrames 프레임 동안 돌린 시간을 로그로 출력 */
+    static void RunBenchmark(int32 NumVehicles, int32 NumFrames);
+
+    float MaxSubstepDeltaTime = 1.f / 120.f;
+    int32 MaxSubsteps = 16;
+
+    /** 이 대수 이상이면 서브스텝의 차량 계산을 병렬로 처리 */
+    int32 ParallelVehicleThreshold = 16;
+
+private:
+    TArray<FVehicleSimulation*> Vehicles;
+
+    /** Simulate에서 재사용 */
+    TArray<FVehicleWheelRay> WheelRays;
+    TArray<FVehicleWheelHit> WheelHits;
+    TArray<int32> WheelOffsets;
+
+    FVehicleManagerStats Stats;
+};
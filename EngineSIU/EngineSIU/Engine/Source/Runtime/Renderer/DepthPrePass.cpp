@@ -46,13 +46,15 @@ void FDepthPrePass::ClearRenderArr()
 
 void FDepthPrePass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
+    UpdateStaticMeshLODs(Viewport);
+
     PrepareRender(Viewport);
 
     PrepareStaticMesh();
     RenderStaticMesh();
 
     PrepareSkeletalMesh();
-    RenderSkeletalMesh();
+    RenderSkeletalMesh(Viewport);
     
     CleanUpRender(Viewport);
 }
@@ -82,6 +84,20 @@ void FDepthPrePass::CleanUpRender(const std::shared_ptr<FEditorViewportClient>&
     Graphics->DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
 }
 
+void FDepthPrePass::UpdateStaticMeshLODs(const std::shared_ptr<FEditorViewportClient>& Viewport)
+{
+    const FVector ViewLocation = Viewport->GetCameraLocation();
+    const FMatrix& Projection = Viewport->GetProjectionMatrix();
+
+    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    {
+        if (Comp)
+        {
+            Comp->UpdateLOD(ViewLocation, Projection);
+        }
+    }
+}
+
 void FDepthPrePass::PrepareStaticMesh()
 {
     ID3D11VertexShader* VertexShader = ShaderManager->GetVertexShaderByKey(L"StaticMeshVertexShader");
@@ -93,11 +109,10 @@ void FDepthPrePass::PrepareStaticMesh()
 
 void FDepthPrePass::PrepareSkeletalMesh()
 {
-    ID3D11VertexShader* VertexShader = ShaderManager->GetVertexShaderByKey(L"SkeletalMeshVertexShader");
-    ID3D11InputLayout* InputLayout = ShaderManager->GetInputLayoutByKey(L"SkeletalMeshVertexShader");
-    
-    Graphics->DeviceContext->VSSetShader(VertexShader, nullptr, 0);
-    Graphics->DeviceContext->IASetInputLayout(InputLayout);
+    VertexShader_SkeletalMesh = ShaderManager->GetVertexShaderByKey(L"SkeletalMeshVertexShader");
+    InputLayout_SkeletalMesh = ShaderManager->GetInputLayoutByKey(L"SkeletalMeshVertexShader");
+    VertexShader_PackedSkeletalMesh = ShaderManager->GetVertexShaderByKey(L"PACKED_SkeletalMeshVertexShader");
+    InputLayout_PackedSkeletalMesh = ShaderManager->GetInputLayoutByKey(L"PACKED_SkeletalMeshVertexShader");
 }
 
 void FDepthPrePass::RenderStaticMesh()
@@ -121,15 +136,15 @@ void FDepthPrePass::RenderStaticMesh()
 
         UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
 
-        RenderStaticMesh_Internal(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderStaticMesh_Internal(RenderData->GetLOD(Comp->GetLOD()), Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
     }
 }
 
-void FDepthPrePass::RenderSkeletalMesh()
+void FDepthPrePass::RenderSkeletalMesh(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
     for (const USkeletalMeshComponent* Comp : SkeletalMeshComponents)
     {
-        if (!Comp || !Comp->GetSkeletalMeshAsset())
+        if (!Comp || !Comp->GetSkeletalMeshAsset() || IsSkeletalMeshCulled(Comp, Viewport))
         {
             continue;
         }
@@ -147,6 +162,10 @@ void FDepthPrePass::RenderSkeletalMesh()
 
         UpdateBones(Comp);
 
+        const bool bPacked = UsePackedSkeletalMeshVertices(RenderData);
+        Graphics->DeviceContext->VSSetShader(bPacked ? VertexShader_PackedSkeletalMesh : VertexShader_SkeletalMesh, nullptr, 0);
+        Graphics->DeviceContext->IASetInputLayout(bPacked ? InputLayout_PackedSkeletalMesh : InputLayout_SkeletalMesh);
+
         RenderSkeletalMesh_Internal(RenderData);
     }
 }
@@ -25,13 +25,21 @@ protected:
     virtual void PrepareRender(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
     virtual void CleanUpRender(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
     
+    /** 이후 패스들이 같은 LOD를 그리도록 뷰포트마다 Depth Pre Pass에서 한 번 LOD를 고름 */
+    void UpdateStaticMeshLODs(const std::shared_ptr<FEditorViewportClient>& Viewport);
+
     void PrepareStaticMesh();
     void PrepareSkeletalMesh();
 
     void RenderStaticMesh();
-    void RenderSkeletalMesh();
+    void RenderSkeletalMesh(const std::shared_ptr<FEditorViewportClient>& Viewport);
     
     TArray<UStaticMeshComponent*> StaticMeshComponents;
     TArray<USkeletalMeshComponent*> SkeletalMeshComponents;
+
+    ID3D11VertexShader* VertexShader_SkeletalMesh = nullptr;
+    ID3D11InputLayout* InputLayout_SkeletalMesh = nullptr;
+    ID3D11VertexShader* VertexShader_PackedSkeletalMesh = nullptr;
+    ID3D11InputLayout* InputLayout_PackedSkeletalMesh = nullptr;
 };
 
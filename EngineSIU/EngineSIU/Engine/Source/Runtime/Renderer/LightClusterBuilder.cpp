@@ -0,0 +1,776 @@
+#include "LightClusterBuilder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
+#include "Math/JungleMath.h"
+#include "Math/MathSSE.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    constexpr uint32 MaxLightsPerClusterType = 0xFFFF;
+
+    /** 이 각도 이상으로 벌어진 스팟 라이트는 원뿔 검사가 의미 없어서 구로만 검사 */
+    constexpr float MaxConeAngle = 1.5607963f; // 89.4도
+
+    struct FViewSpaceLight
+    {
+        FVector Position;
+        float Radius;
+        FVector Direction;
+        float CosAngle;
+        float SinAngle;
+        bool bUseCone;
+    };
+
+    FViewSpaceLight ToViewSpace(const FMatrix& ViewMatrix, const FVector& Position, float Radius)
+    {
+        FViewSpaceLight Light = {};
+        Light.Position = ViewMatrix.TransformPosition(Position);
+        Light.Radius = Radius;
+        return Light;
+    }
+
+    FViewSpaceLight ToViewSpace(const FMatrix& ViewMatrix, const FClusterSpotLight& SpotLight)
+    {
+        FViewSpaceLight Light = ToViewSpace(ViewMatrix, SpotLight.Position, SpotLight.Radius);
+        Light.Direction = FMatrix::TransformVector(SpotLight.Direction, ViewMatrix).GetSafeNormal();
+        Light.bUseCone = SpotLight.OuterAngle < MaxConeAngle && !Light.Direction.IsNearlyZero();
+        Light.CosAngle = std::cos(SpotLight.OuterAngle);
+        Light.SinAngle = std::sin(SpotLight.OuterAngle);
+        return Light;
+    }
+
+    /** 슬라이스 경계의 뷰 공간 Z, 원근이면 지수 분포라서 가까운 슬라이스가 얇음 */
+    float GetSliceDepth(const FLightClusterView& View, uint32 Slice, uint32 CountZ)
+    {
+        if (Slice == 0)
+        {
+            return View.NearZ;
+        }
+        if (Slice >= CountZ)
+        {
+            return View.FarZ;
+        }
+
+        const float Alpha = static_cast<float>(Slice) / static_cast<float>(CountZ);
+        if (View.bOrthographic)
+        {
+            return View.NearZ + (View.FarZ - View.NearZ) * Alpha;
+        }
+        return View.NearZ * std::pow(View.FarZ / View.NearZ, Alpha);
+    }
+
+    template <typename BoundsType>
+    void ComputeClusterBounds(const FLightClusterSettings& Settings, const FLightClusterView& View, TArray<BoundsType>& OutBounds)
+    {
+        OutBounds.SetNum(static_cast<int32>(Settings.CountX * Settings.CountY * Settings.CountZ));
+
+        for (uint32 Z = 0; Z < Settings.CountZ; ++Z)
+        {
+            const float SliceNear = GetSliceDepth(View, Z, Settings.CountZ);
+            const float SliceFar = GetSliceDepth(View, Z + 1, Settings.CountZ);
+
+            for (uint32 Y = 0; Y < Settings.CountY; ++Y)
+            {
+                // 화면 위쪽이 0번 행
+                const float NdcTop = 1.f - 2.f * static_cast<float>(Y) / static_cast<float>(Settings.CountY);
+                const float NdcBottom = 1.f - 2.f * static_cast<float>(Y + 1) / static_cast<float>(Settings.CountY);
+
+                for (uint32 X = 0; X < Settings.CountX; ++X)
+                {
+                    const float NdcLeft = -1.f + 2.f * static_cast<float>(X) / static_cast<float>(Settings.CountX);
+                    const float NdcRight = -1.f + 2.f * static_cast<float>(X + 1) / static_cast<float>(Settings.CountX);
+
+                    BoundsType& Bounds = OutBounds[static_cast<int32>((Z * Settings.CountY + Y) * Settings.CountX + X)];
+                    Bounds.MinZ = SliceNear;
+                    Bounds.MaxZ = SliceFar;
+                    if (View.bOrthographic)
+                    {
+                        Bounds.MinX = NdcLeft / View.ProjectionScaleX;
+                        Bounds.MaxX = NdcRight / View.ProjectionScaleX;
+                        Bounds.MinY = NdcBottom / View.ProjectionScaleY;
+                        Bounds.MaxY = NdcTop / View.ProjectionScaleY;
+                    }
+                    else
+                    {
+                        // 타일의 네 모서리 광선이 슬라이스 앞뒤 평면과 만나는 점을 모두 감싸는 AABB
+                        Bounds.MinX = std::min(NdcLeft * SliceNear, NdcLeft * SliceFar) / View.ProjectionScaleX;
+                        Bounds.MaxX = std::max(NdcRight * SliceNear, NdcRight * SliceFar) / View.ProjectionScaleX;
+                        Bounds.MinY = std::min(NdcBottom * SliceNear, NdcBottom * SliceFar) / View.ProjectionScaleY;
+                        Bounds.MaxY = std::max(NdcTop * SliceNear, NdcTop * SliceFar) / View.ProjectionScaleY;
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename BoundsType>
+    void MergeBounds(BoundsType& InOutBounds, const BoundsType& Other)
+    {
+        InOutBounds.MinX = std::min(InOutBounds.MinX, Other.MinX);
+        InOutBounds.MinY = std::min(InOutBounds.MinY, Other.MinY);
+        InOutBounds.MinZ = std::min(InOutBounds.MinZ, Other.MinZ);
+        InOutBounds.MaxX = std::max(InOutBounds.MaxX, Other.MaxX);
+        InOutBounds.MaxY = std::max(InOutBounds.MaxY, Other.MaxY);
+        InOutBounds.MaxZ = std::max(InOutBounds.MaxZ, Other.MaxZ);
+    }
+
+    /**
+     * 아래 스칼라 검사와 SIMD 검사는 연산 순서가 같아서 결과도 비트 단위로 같음
+     * 순서를 바꾸려면 두 쪽을 함께 바꿔야 함
+     */
+    template <typename BoundsType>
+    bool SphereIntersectsBounds(float X, float Y, float Z, float Radius, const BoundsType& Bounds)
+    {
+        const float Dx = std::max(std::max(Bounds.MinX - X, X - Bounds.MaxX), 0.f);
+        const float Dy = std::max(std::max(Bounds.MinY - Y, Y - Bounds.MaxY), 0.f);
+        const float Dz = std::max(std::max(Bounds.MinZ - Z, Z - Bounds.MaxZ), 0.f);
+        return Dx * Dx + Dy * Dy + Dz * Dz <= Radius * Radius;
+    }
+
+    /** AABB를 감싸는 구로 근사한 원뿔 검사 */
+    struct FConeTestSphere
+    {
+        float X, Y, Z;
+        float Radius;
+    };
+
+    template <typename BoundsType>
+    FConeTestSphere MakeConeTestSphere(const BoundsType& Bounds)
+    {
+        const float ExtentX = (Bounds.MaxX - Bounds.MinX) * 0.5f;
+        const float ExtentY = (Bounds.MaxY - Bounds.MinY) * 0.5f;
+        const float ExtentZ = (Bounds.MaxZ - Bounds.MinZ) * 0.5f;
+        return {
+            (Bounds.MinX + Bounds.MaxX) * 0.5f,
+            (Bounds.MinY + Bounds.MaxY) * 0.5f,
+            (Bounds.MinZ + Bounds.MaxZ) * 0.5f,
+            std::sqrt(ExtentX * ExtentX + ExtentY * ExtentY + ExtentZ * ExtentZ)
+        };
+    }
+
+    bool ConeIntersectsSphere(const FViewSpaceLight& Light, const FConeTestSphere& Sphere)
+    {
+        const float Vx = Sphere.X - Light.Position.X;
+        const float Vy = Sphere.Y - Light.Position.Y;
+        const float Vz = Sphere.Z - Light.Position.Z;
+        const float LengthSq = Vx * Vx + Vy * Vy + Vz * Vz;
+        const float AxisLength = Vx * Light.Direction.X + Vy * Light.Direction.Y + Vz * Light.Direction.Z;
+        const float PerpLength = std::sqrt(std::max(LengthSq - AxisLength * AxisLength, 0.f));
+        const float ClosestDistance = Light.CosAngle * PerpLength - AxisLength * Light.SinAngle;
+
+        const bool bAngleCull = ClosestDistance > Sphere.Radius;
+        const bool bFrontCull = AxisLength > Sphere.Radius + Light.Radius;
+        const bool bBackCull = AxisLength < -Sphere.Radius;
+        return !(bAngleCull || bFrontCull || bBackCull);
+    }
+
+    FORCEINLINE int32 SphereIntersectsBounds4(
+        const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z, const VectorRegister4Float& Radius,
+        const VectorRegister4Float* BoundsMin, const VectorRegister4Float* BoundsMax
+    )
+    {
+        const VectorRegister4Float Zero = _mm_setzero_ps();
+        const VectorRegister4Float Dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(BoundsMin[0], X), _mm_sub_ps(X, BoundsMax[0])), Zero);
+        const VectorRegister4Float Dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(BoundsMin[1], Y), _mm_sub_ps(Y, BoundsMax[1])), Zero);
+        const VectorRegister4Float Dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(BoundsMin[2], Z), _mm_sub_ps(Z, BoundsMax[2])), Zero);
+        const VectorRegister4Float DistSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Dx, Dx), _mm_mul_ps(Dy, Dy)), _mm_mul_ps(Dz, Dz));
+        return _mm_movemask_ps(_mm_cmple_ps(DistSq, _mm_mul_ps(Radius, Radius)));
+    }
+
+    template <typename BoundsType>
+    void LoadBounds(const BoundsType& Bounds, VectorRegister4Float* OutMin, VectorRegister4Float* OutMax)
+    {
+        OutMin[0] = _mm_set1_ps(Bounds.MinX);
+        OutMin[1] = _mm_set1_ps(Bounds.MinY);
+        OutMin[2] = _mm_set1_ps(Bounds.MinZ);
+        OutMax[0] = _mm_set1_ps(Bounds.MaxX);
+        OutMax[1] = _mm_set1_ps(Bounds.MaxY);
+        OutMax[2] = _mm_set1_ps(Bounds.MaxZ);
+    }
+
+    int32 GetValidLaneMask(int32 First, int32 Num)
+    {
+        const int32 Remaining = Num - First;
+        return Remaining >= 4 ? 0xF : (1 << Remaining) - 1;
+    }
+
+    void InitGrid(const FLightClusterSettings& Settings, const FLightClusterView& View, FLightClusterGrid& OutGrid)
+    {
+        OutGrid.CountX = Settings.CountX;
+        OutGrid.CountY = Settings.CountY;
+        OutGrid.CountZ = Settings.CountZ;
+        OutGrid.bOrthographic = View.bOrthographic;
+
+        if (View.bOrthographic)
+        {
+            OutGrid.ZSliceScale = static_cast<float>(Settings.CountZ) / (View.FarZ - View.NearZ);
+            OutGrid.ZSliceBias = -View.NearZ * OutGrid.ZSliceScale;
+        }
+        else
+        {
+            OutGrid.ZSliceScale = static_cast<float>(Settings.CountZ) / std::log(View.FarZ / View.NearZ);
+            OutGrid.ZSliceBias = -std::log(View.NearZ) * OutGrid.ZSliceScale;
+        }
+
+        OutGrid.Ranges.SetNum(static_cast<int32>(OutGrid.GetNumClusters()));
+        OutGrid.LightIndices.SetNum(0);
+    }
+}
+
+FLightClusterView FLightClusterView::Make(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix, float NearZ, float FarZ, bool bOrthographic)
+{
+    FLightClusterView View;
+    View.ViewMatrix = ViewMatrix;
+    View.ProjectionScaleX = ProjectionMatrix.M[0][0];
+    View.ProjectionScaleY = ProjectionMatrix.M[1][1];
+    // 원근은 로그 분포라서 Near가 0 이하면 안 됨
+    View.NearZ = bOrthographic ? NearZ : std::max(NearZ, 1.e-3f);
+    View.FarZ = std::max(FarZ, View.NearZ + 1.e-3f);
+    View.bOrthographic = bOrthographic;
+    return View;
+}
+
+void FLightClusterBuilder::FLightSoA::SetNum(int32 InNum, bool bSpot)
+{
+    Num = InNum;
+    const int32 Padded = (InNum + 3) & ~3;
+    X.SetNum(Padded);
+    Y.SetNum(Padded);
+    Z.SetNum(Padded);
+    Radius.SetNum(Padded);
+    if (bSpot)
+    {
+        DirX.SetNum(Padded);
+        DirY.SetNum(Padded);
+        DirZ.SetNum(Padded);
+        CosAngle.SetNum(Padded);
+        SinAngle.SetNum(Padded);
+        bUseCone.SetNum(Padded);
+    }
+}
+
+/** 한 행에서 행 AABB와 겹치는 라이트만 모아 둔 SoA */
+struct FLightClusterBuilder::FRowScratch
+{
+    TArray<uint32> PointIndex;
+    TArray<float> PointX, PointY, PointZ, PointRadius;
+
+    TArray<uint32> SpotIndex;
+    TArray<float> SpotX, SpotY, SpotZ, SpotRadius;
+    TArray<float> SpotDirX, SpotDirY, SpotDirZ, SpotCos, SpotSin;
+    TArray<uint32> SpotUseCone;
+
+    void Reset()
+    {
+        for (TArray<float>* Stream : { &PointX, &PointY, &PointZ, &PointRadius, &SpotX, &SpotY, &SpotZ, &SpotRadius, &SpotDirX, &SpotDirY, &SpotDirZ, &SpotCos, &SpotSin })
+        {
+            Stream->SetNum(0);
+        }
+        PointIndex.SetNum(0);
+        SpotIndex.SetNum(0);
+        SpotUseCone.SetNum(0);
+    }
+
+    /** SIMD 로드가 배열 끝을 넘지 않도록 4의 배수로 채움, 패딩 레인은 마스크로 버려짐 */
+    void Pad()
+    {
+        while (PointIndex.Num() & 3)
+        {
+            PointIndex.Add(0);
+            PointX.Add(0.f);
+            PointY.Add(0.f);
+            PointZ.Add(0.f);
+            PointRadius.Add(0.f);
+        }
+        while (SpotIndex.Num() & 3)
+        {
+            SpotIndex.Add(0);
+            SpotX.Add(0.f);
+            SpotY.Add(0.f);
+            SpotZ.Add(0.f);
+            SpotRadius.Add(0.f);
+            SpotDirX.Add(0.f);
+            SpotDirY.Add(0.f);
+            SpotDirZ.Add(0.f);
+            SpotCos.Add(0.f);
+            SpotSin.Add(0.f);
+            SpotUseCone.Add(0);
+        }
+    }
+};
+
+void FLightClusterBuilder::Build(
+    const FLightClusterView& View, const TArray<FClusterPointLight>& PointLights, const TArray<FClusterSpotLight>& SpotLights, FLightClusterGrid& OutGrid
+)
+{
+    Grid = &OutGrid;
+    InitGrid(Settings, View, OutGrid);
+
+    const int32 NumSlices = static_cast<int32>(Settings.CountZ);
+    const int32 NumRows = static_cast<int32>(Settings.CountZ * Settings.CountY);
+
+    // 1. 클러스터, 행, 슬라이스 AABB
+    ComputeClusterBounds(Settings, View, ClusterBounds);
+    RowBounds.SetNum(NumRows);
+    SliceBounds.SetNum(NumSlices);
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        const int32 FirstCluster = Row * static_cast<int32>(Settings.CountX);
+        RowBounds[Row] = ClusterBounds[FirstCluster];
+        for (uint32 X = 1; X < Settings.CountX; ++X)
+        {
+            MergeBounds(RowBounds[Row], ClusterBounds[FirstCluster + static_cast<int32>(X)]);
+        }
+
+        const int32 Slice = Row / static_cast<int32>(Settings.CountY);
+        if (Row % static_cast<int32>(Settings.CountY) == 0)
+        {
+            SliceBounds[Slice] = RowBounds[Row];
+        }
+        else
+        {
+            MergeBounds(SliceBounds[Slice], RowBounds[Row]);
+        }
+    }
+
+    // 2. 뷰 공간 SoA
+    PointSoA.SetNum(PointLights.Num(), false);
+    SpotSoA.SetNum(SpotLights.Num(), true);
+
+    FJobSystem::Get().ParallelForRange(PointLights.Num(), [&](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FViewSpaceLight Light = ToViewSpace(View.ViewMatrix, PointLights[Index].Position, PointLights[Index].Radius);
+            PointSoA.X[Index] = Light.Position.X;
+            PointSoA.Y[Index] = Light.Position.Y;
+            PointSoA.Z[Index] = Light.Position.Z;
+            PointSoA.Radius[Index] = Light.Radius;
+        }
+    }, 1024);
+
+    FJobSystem::Get().ParallelForRange(SpotLights.Num(), [&](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FViewSpaceLight Light = ToViewSpace(View.ViewMatrix, SpotLights[Index]);
+            SpotSoA.X[Index] = Light.Position.X;
+            SpotSoA.Y[Index] = Light.Position.Y;
+            SpotSoA.Z[Index] = Light.Position.Z;
+            SpotSoA.Radius[Index] = Light.Radius;
+            SpotSoA.DirX[Index] = Light.Direction.X;
+            SpotSoA.DirY[Index] = Light.Direction.Y;
+            SpotSoA.DirZ[Index] = Light.Direction.Z;
+            SpotSoA.CosAngle[Index] = Light.CosAngle;
+            SpotSoA.SinAngle[Index] = Light.SinAngle;
+            SpotSoA.bUseCone[Index] = Light.bUseCone ? 1 : 0;
+        }
+    }, 1024);
+
+    // 3. 슬라이스마다 후보 라이트
+    SlicePointCandidates.SetNum(NumSlices);
+    SliceSpotCandidates.SetNum(NumSlices);
+    FJobSystem::Get().ParallelFor(NumSlices, [this](int32 Slice)
+    {
+        VectorRegister4Float BoundsMin[3];
+        VectorRegister4Float BoundsMax[3];
+        LoadBounds(SliceBounds[Slice], BoundsMin, BoundsMax);
+
+        auto GatherCandidates = [&BoundsMin, &BoundsMax](const FLightSoA& SoA, TArray<uint32>& OutCandidates)
+        {
+            OutCandidates.SetNum(0);
+            for (int32 First = 0; First < SoA.Num; First += 4)
+            {
+                int32 Mask = SphereIntersectsBounds4(
+                    _mm_loadu_ps(&SoA.X[First]), _mm_loadu_ps(&SoA.Y[First]), _mm_loadu_ps(&SoA.Z[First]), _mm_loadu_ps(&SoA.Radius[First]),
+                    BoundsMin, BoundsMax
+                ) & GetValidLaneMask(First, SoA.Num);
+
+                for (int32 Lane = 0; Mask; ++Lane, Mask >>= 1)
+                {
+                    if (Mask & 1)
+                    {
+                        OutCandidates.Add(static_cast<uint32>(First + Lane));
+                    }
+                }
+            }
+        };
+
+        GatherCandidates(PointSoA, SlicePointCandidates[Slice]);
+        GatherCandidates(SpotSoA, SliceSpotCandidates[Slice]);
+    }, 1);
+
+    // 4. 행 단위로 클러스터 배정
+    RowIndices.SetNum(NumRows);
+    FJobSystem::Get().ParallelForRange(NumRows, [this](int32 Begin, int32 End)
+    {
+        FRowScratch Scratch;
+        for (int32 Row = Begin; Row < End; ++Row)
+        {
+            ProcessRow(static_cast<uint32>(Row) / Settings.CountY, static_cast<uint32>(Row) % Settings.CountY, Scratch);
+        }
+    }, 4);
+
+    // 5. 행 결과를 하나의 인덱스 목록으로 합침
+    TArray<uint32> RowOffsets;
+    RowOffsets.SetNum(NumRows);
+    uint32 TotalIndices = 0;
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        RowOffsets[Row] = TotalIndices;
+        TotalIndices += static_cast<uint32>(RowIndices[Row].Num());
+    }
+
+    OutGrid.LightIndices.SetNum(static_cast<int32>(TotalIndices));
+    FJobSystem::Get().ParallelFor(NumRows, [this, &RowOffsets, &OutGrid](int32 Row)
+    {
+        const uint32 RowOffset = RowOffsets[Row];
+        const int32 FirstCluster = Row * static_cast<int32>(Settings.CountX);
+        for (uint32 X = 0; X < Settings.CountX; ++X)
+        {
+            OutGrid.Ranges[FirstCluster + static_cast<int32>(X)].Offset += RowOffset;
+        }
+
+        if (!RowIndices[Row].IsEmpty())
+        {
+            std::memcpy(OutGrid.LightIndices.GetData() + RowOffset, RowIndices[Row].GetData(), RowIndices[Row].Num() * sizeof(uint32));
+        }
+    }, 8);
+
+    Grid = nullptr;
+}
+
+void FLightClusterBuilder::ProcessRow(uint32 SliceIndex, uint32 RowIndex, FRowScratch& Scratch)
+{
+    const int32 Row = static_cast<int32>(SliceIndex * Settings.CountY + RowIndex);
+    TArray<uint32>& OutIndices = RowIndices[Row];
+    OutIndices.SetNum(0);
+
+    // 행 AABB와 겹치는 후보만 연속된 SoA로 모음
+    Scratch.Reset();
+    {
+        VectorRegister4Float BoundsMin[3];
+        VectorRegister4Float BoundsMax[3];
+        LoadBounds(RowBounds[Row], BoundsMin, BoundsMax);
+
+        const TArray<uint32>& PointCandidates = SlicePointCandidates[SliceIndex];
+        for (int32 First = 0; First < PointCandidates.Num(); First += 4)
+        {
+            uint32 Index[4] = {};
+            for (int32 Lane = 0; Lane < 4 && First + Lane < PointCandidates.Num(); ++Lane)
+            {
+                Index[Lane] = PointCandidates[First + Lane];
+            }
+
+            int32 Mask = SphereIntersectsBounds4(
+                _mm_setr_ps(PointSoA.X[Index[0]], PointSoA.X[Index[1]], PointSoA.X[Index[2]], PointSoA.X[Index[3]]),
+                _mm_setr_ps(PointSoA.Y[Index[0]], PointSoA.Y[Index[1]], PointSoA.Y[Index[2]], PointSoA.Y[Index[3]]),
+                _mm_setr_ps(PointSoA.Z[Index[0]], PointSoA.Z[Index[1]], PointSoA.Z[Index[2]], PointSoA.Z[Index[3]]),
+                _mm_setr_ps(PointSoA.Radius[Index[0]], PointSoA.Radius[Index[1]], PointSoA.Radius[Index[2]], PointSoA.Radius[Index[3]]),
+                BoundsMin, BoundsMax
+            ) & GetValidLaneMask(First, PointCandidates.Num());
+
+            for (int32 Lane = 0; Mask; ++Lane, Mask >>= 1)
+            {
+                if (Mask & 1)
+                {
+                    const uint32 LightIndex = Index[Lane];
+                    Scratch.PointIndex.Add(LightIndex);
+                    Scratch.PointX.Add(PointSoA.X[LightIndex]);
+                    Scratch.PointY.Add(PointSoA.Y[LightIndex]);
+                    Scratch.PointZ.Add(PointSoA.Z[LightIndex]);
+                    Scratch.PointRadius.Add(PointSoA.Radius[LightIndex]);
+                }
+            }
+        }
+
+        const TArray<uint32>& SpotCandidates = SliceSpotCandidates[SliceIndex];
+        for (int32 First = 0; First < SpotCandidates.Num(); First += 4)
+        {
+            uint32 Index[4] = {};
+            for (int32 Lane = 0; Lane < 4 && First + Lane < SpotCandidates.Num(); ++Lane)
+            {
+                Index[Lane] = SpotCandidates[First + Lane];
+            }
+
+            int32 Mask = SphereIntersectsBounds4(
+                _mm_setr_ps(SpotSoA.X[Index[0]], SpotSoA.X[Index[1]], SpotSoA.X[Index[2]], SpotSoA.X[Index[3]]),
+                _mm_setr_ps(SpotSoA.Y[Index[0]], SpotSoA.Y[Index[1]], SpotSoA.Y[Index[2]], SpotSoA.Y[Index[3]]),
+                _mm_setr_ps(SpotSoA.Z[Index[0]], SpotSoA.Z[Index[1]], SpotSoA.Z[Index[2]], SpotSoA.Z[Index[3]]),
+                _mm_setr_ps(SpotSoA.Radius[Index[0]], SpotSoA.Radius[Index[1]], SpotSoA.Radius[Index[2]], SpotSoA.Radius[Index[3]]),
+                BoundsMin, BoundsMax
+            ) & GetValidLaneMask(First, SpotCandidates.Num());
+
+            for (int32 Lane = 0; Mask; ++Lane, Mask >>= 1)
+            {
+                if (Mask & 1)
+                {
+                    const uint32 LightIndex = Index[Lane];
+                    Scratch.SpotIndex.Add(LightIndex);
+                    Scratch.SpotX.Add(SpotSoA.X[LightIndex]);
+                    Scratch.SpotY.Add(SpotSoA.Y[LightIndex]);
+                    Scratch.SpotZ.Add(SpotSoA.Z[LightIndex]);
+                    Scratch.SpotRadius.Add(SpotSoA.Radius[LightIndex]);
+                    Scratch.SpotDirX.Add(SpotSoA.DirX[LightIndex]);
+                    Scratch.SpotDirY.Add(SpotSoA.DirY[LightIndex]);
+                    Scratch.SpotDirZ.Add(SpotSoA.DirZ[LightIndex]);
+                    Scratch.SpotCos.Add(SpotSoA.CosAngle[LightIndex]);
+                    Scratch.SpotSin.Add(SpotSoA.SinAngle[LightIndex]);
+                    Scratch.SpotUseCone.Add(SpotSoA.bUseCone[LightIndex]);
+                }
+            }
+        }
+    }
+
+    const int32 NumPoints = Scratch.PointIndex.Num();
+    const int32 NumSpots = Scratch.SpotIndex.Num();
+    Scratch.Pad();
+
+    const VectorRegister4Float Zero = _mm_setzero_ps();
+    const int32 FirstCluster = Row * static_cast<int32>(Settings.CountX);
+    for (uint32 X = 0; X < Settings.CountX; ++X)
+    {
+        const FClusterBounds& Bounds = ClusterBounds[FirstCluster + static_cast<int32>(X)];
+        VectorRegister4Float BoundsMin[3];
+        VectorRegister4Float BoundsMax[3];
+        LoadBounds(Bounds, BoundsMin, BoundsMax);
+
+        FLightClusterRange& Range = Grid->Ranges[FirstCluster + static_cast<int32>(X)];
+        Range.Offset = static_cast<uint32>(OutIndices.Num());
+
+        uint32 NumClusterPoints = 0;
+        for (int32 First = 0; First < NumPoints; First += 4)
+        {
+            int32 Mask = SphereIntersectsBounds4(
+                _mm_loadu_ps(&Scratch.PointX[First]), _mm_loadu_ps(&Scratch.PointY[First]),
+                _mm_loadu_ps(&Scratch.PointZ[First]), _mm_loadu_ps(&Scratch.PointRadius[First]),
+                BoundsMin, BoundsMax
+            ) & GetValidLaneMask(First, NumPoints);
+
+            for (int32 Lane = 0; Mask && NumClusterPoints < MaxLightsPerClusterType; ++Lane, Mask >>= 1)
+            {
+                if (Mask & 1)
+                {
+                    OutIndices.Add(Scratch.PointIndex[First + Lane]);
+                    ++NumClusterPoints;
+                }
+            }
+        }
+
+        const FConeTestSphere ConeSphere = MakeConeTestSphere(Bounds);
+        const VectorRegister4Float SphereX = _mm_set1_ps(ConeSphere.X);
+        const VectorRegister4Float SphereY = _mm_set1_ps(ConeSphere.Y);
+        const VectorRegister4Float SphereZ = _mm_set1_ps(ConeSphere.Z);
+        const VectorRegister4Float SphereRadius = _mm_set1_ps(ConeSphere.Radius);
+        const VectorRegister4Float NegSphereRadius = _mm_set1_ps(-ConeSphere.Radius);
+
+        uint32 NumClusterSpots = 0;
+        for (int32 First = 0; First < NumSpots; First += 4)
+        {
+            const VectorRegister4Float LightX = _mm_loadu_ps(&Scratch.SpotX[First]);
+            const VectorRegister4Float LightY = _mm_loadu_ps(&Scratch.SpotY[First]);
+            const VectorRegister4Float LightZ = _mm_loadu_ps(&Scratch.SpotZ[First]);
+            const VectorRegister4Float LightRadius = _mm_loadu_ps(&Scratch.SpotRadius[First]);
+
+            int32 Mask = SphereIntersectsBounds4(LightX, LightY, LightZ, LightRadius, BoundsMin, BoundsMax) & GetValidLaneMask(First, NumSpots);
+            if (Mask == 0)
+            {
+                continue;
+            }
+
+            // ConeIntersectsSphere와 같은 순서
+            const VectorRegister4Float Vx = _mm_sub_ps(SphereX, LightX);
+            const VectorRegister4Float Vy = _mm_sub_ps(SphereY, LightY);
+            const VectorRegister4Float Vz = _mm_sub_ps(SphereZ, LightZ);
+            const VectorRegister4Float LengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Vx, Vx), _mm_mul_ps(Vy, Vy)), _mm_mul_ps(Vz, Vz));
+            const VectorRegister4Float AxisLength = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(Vx, _mm_loadu_ps(&Scratch.SpotDirX[First])), _mm_mul_ps(Vy, _mm_loadu_ps(&Scratch.SpotDirY[First]))),
+                _mm_mul_ps(Vz, _mm_loadu_ps(&Scratch.SpotDirZ[First]))
+            );
+            const VectorRegister4Float PerpLength = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(LengthSq, _mm_mul_ps(AxisLength, AxisLength)), Zero));
+            const VectorRegister4Float ClosestDistance = _mm_sub_ps(
+                _mm_mul_ps(_mm_loadu_ps(&Scratch.SpotCos[First]), PerpLength),
+                _mm_mul_ps(AxisLength, _mm_loadu_ps(&Scratch.SpotSin[First]))
+            );
+
+            const VectorRegister4Float Cull = _mm_or_ps(
+                _mm_or_ps(_mm_cmpgt_ps(ClosestDistance, SphereRadius), _mm_cmpgt_ps(AxisLength, _mm_add_ps(SphereRadius, LightRadius))),
+                _mm_cmplt_ps(AxisLength, NegSphereRadius)
+            );
+            const int32 NoConeMask = _mm_movemask_ps(_mm_castsi128_ps(
+                _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&Scratch.SpotUseCone[First])), _mm_setzero_si128())
+            ));
+            Mask &= ~_mm_movemask_ps(Cull) | NoConeMask;
+
+            for (int32 Lane = 0; Mask && NumClusterSpots < MaxLightsPerClusterType; ++Lane, Mask >>= 1)
+            {
+                if (Mask & 1)
+                {
+                    OutIndices.Add(Scratch.SpotIndex[First + Lane]);
+                    ++NumClusterSpots;
+                }
+            }
+        }
+
+        Range.Count = NumClusterPoints | (NumClusterSpots << 16);
+    }
+}
+
+void FLightClusterBuilder::BuildReference(
+    const FLightClusterSettings& Settings, const FLightClusterView& View,
+    const TArray<FClusterPointLight>& PointLights, const TArray<FClusterSpotLight>& SpotLights, FLightClusterGrid& OutGrid
+)
+{
+    InitGrid(Settings, View, OutGrid);
+
+    TArray<FClusterBounds> Bounds;
+    ComputeClusterBounds(Settings, View, Bounds);
+
+    TArray<FViewSpaceLight> ViewPointLights;
+    ViewPointLights.Reserve(PointLights.Num());
+    for (const FClusterPointLight& Light : PointLights)
+    {
+        ViewPointLights.Add(ToViewSpace(View.ViewMatrix, Light.Position, Light.Radius));
+    }
+
+    TArray<FViewSpaceLight> ViewSpotLights;
+    ViewSpotLights.Reserve(SpotLights.Num());
+    for (const FClusterSpotLight& Light : SpotLights)
+    {
+        ViewSpotLights.Add(ToViewSpace(View.ViewMatrix, Light));
+    }
+
+    for (uint32 Cluster = 0; Cluster < OutGrid.GetNumClusters(); ++Cluster)
+    {
+        const FClusterBounds& ClusterBounds = Bounds[static_cast<int32>(Cluster)];
+        FLightClusterRange& Range = OutGrid.Ranges[static_cast<int32>(Cluster)];
+        Range.Offset = static_cast<uint32>(OutGrid.LightIndices.Num());
+
+        uint32 NumClusterPoints = 0;
+        for (int32 Index = 0; Index < ViewPointLights.Num() && NumClusterPoints < MaxLightsPerClusterType; ++Index)
+        {
+            const FViewSpaceLight& Light = ViewPointLights[Index];
+            if (SphereIntersectsBounds(Light.Position.X, Light.Position.Y, Light.Position.Z, Light.Radius, ClusterBounds))
+            {
+                OutGrid.LightIndices.Add(static_cast<uint32>(Index));
+                ++NumClusterPoints;
+            }
+        }
+
+        const FConeTestSphere ConeSphere = MakeConeTestSphere(ClusterBounds);
+        uint32 NumClusterSpots = 0;
+        for (int32 Index = 0; Index < ViewSpotLights.Num() && NumClusterSpots < MaxLightsPerClusterType; ++Index)
+        {
+            const FViewSpaceLight& Light = ViewSpotLights[Index];
+            if (SphereIntersectsBounds(Light.Position.X, Light.Position.Y, Light.Position.Z, Light.Radius, ClusterBounds)
+                && (!Light.bUseCone || ConeIntersectsSphere(Light, ConeSphere)))
+            {
+                OutGrid.LightIndices.Add(static_cast<uint32>(Index));
+                ++NumClusterSpots;
+            }
+        }
+
+        Range.Count = NumClusterPoints | (NumClusterSpots << 16);
+    }
+}
+
+bool FLightClusterBuilder::RunSelfTest(int32 NumPointLights, int32 NumSpotLights, int32 NumTrials)
+{
+    std::mt19937 Random(7);
+    std::uniform_real_distribution<float> Signed(-1.f, 1.f);
+    std::uniform_real_distribution<float> Unsigned(0.f, 1.f);
+
+    FLightClusterBuilder Builder;
+    int32 NumFailedTrials = 0;
+
+    for (int32 Trial = 0; Trial < NumTrials; ++Trial)
+    {
+        // 원근과 직교를 번갈아 쓰고, 카메라는 라이트가 흩어진 공간 안에서 원점을 바라봄
+        const bool bOrthographic = (Trial & 1) != 0;
+        const FVector Eye(Signed(Random) * 50.f, Signed(Random) * 50.f, Signed(Random) * 50.f);
+        const FMatrix ViewMatrix = JungleMath::CreateViewMatrix(Eye, FVector::ZeroVector, FVector(0.f, 0.f, 1.f));
+        const FMatrix ProjectionMatrix = bOrthographic
+            ? JungleMath::CreateOrthoProjectionMatrix(200.f, 120.f, 0.1f, 300.f)
+            : JungleMath::CreateProjectionMatrix(1.2f, 16.f / 9.f, 0.1f, 300.f);
+        const FLightClusterView View = FLightClusterView::Make(ViewMatrix, ProjectionMatrix, 0.1f, 300.f, bOrthographic);
+
+        TArray<FClusterPointLight> PointLights;
+        PointLights.Reserve(NumPointLights);
+        for (int32 Index = 0; Index < NumPointLights; ++Index)
+        {
+            PointLights.Add({ FVector(Signed(Random) * 100.f, Signed(Random) * 100.f, Signed(Random) * 100.f), 2.f + Unsigned(Random) * 20.f });
+        }
+
+        // 일부 스팟 라이트는 90도 이상으로 벌려서 구로만 검사하는 경로도 포함
+        TArray<FClusterSpotLight> SpotLights;
+        SpotLights.Reserve(NumSpotLights);
+        for (int32 Index = 0; Index < NumSpotLights; ++Index)
+        {
+            const FVector Direction = FVector(Signed(Random), Signed(Random), Signed(Random)).GetSafeNormal();
+            const float OuterAngle = Index % 7 == 0 ? 1.7f : Unsigned(Random) * 1.4f;
+            SpotLights.Add({ FVector(Signed(Random) * 100.f, Signed(Random) * 100.f, Signed(Random) * 100.f), 2.f + Unsigned(Random) * 30.f, Direction, OuterAngle });
+        }
+
+        FLightClusterGrid Grid;
+        FLightClusterGrid ReferenceGrid;
+        Builder.Build(View, PointLights, SpotLights, Grid);
+
+        const uint64 BuildStartCycles = FPlatformTime::Cycles64();
+        Builder.Build(View, PointLights, SpotLights, Grid);
+        const double BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BuildStartCycles);
+
+        const uint64 ReferenceStartCycles = FPlatformTime::Cycles64();
+        BuildReference(Builder.GetSettings(), View, PointLights, SpotLights, ReferenceGrid);
+        const double ReferenceMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ReferenceStartCycles);
+
+        // 클러스터마다 포인트, 스팟 라이트 목록이 같은지 비교, 오프셋은 앞 클러스터에 따라 밀리므로 비교하지 않음
+        int32 NumMismatchedClusters = 0;
+        int32 FirstMismatch = INDEX_NONE;
+        const bool bSameLayout = Grid.GetNumClusters() == ReferenceGrid.GetNumClusters()
+            && Grid.Ranges.Num() == ReferenceGrid.Ranges.Num()
+            && Grid.ZSliceScale == ReferenceGrid.ZSliceScale && Grid.ZSliceBias == ReferenceGrid.ZSliceBias;
+        for (int32 Cluster = 0; bSameLayout && Cluster < Grid.Ranges.Num(); ++Cluster)
+        {
+            const FLightClusterRange& Range = Grid.Ranges[Cluster];
+            const FLightClusterRange& ReferenceRange = ReferenceGrid.Ranges[Cluster];
+            bool bMatches = Range.Count == ReferenceRange.Count;
+            const uint32 NumLights = Range.GetNumPointLights() + Range.GetNumSpotLights();
+            for (uint32 Index = 0; bMatches && Index < NumLights; ++Index)
+            {
+                bMatches = Grid.LightIndices[static_cast<int32>(Range.Offset + Index)] == ReferenceGrid.LightIndices[static_cast<int32>(ReferenceRange.Offset + Index)];
+            }
+
+            if (!bMatches)
+            {
+                FirstMismatch = FirstMismatch == INDEX_NONE ? Cluster : FirstMismatch;
+                ++NumMismatchedClusters;
+            }
+        }
+
+        const bool bPassed = bSameLayout && NumMismatchedClusters == 0 && Grid.LightIndices.Num() == ReferenceGrid.LightIndices.Num();
+        NumFailedTrials += bPassed ? 0 : 1;
+
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error,
+            TEXT("Light cluster trial %d (%s): %d point, %d spot lights, %d indices, Build %.3f ms, Reference %.3f ms, %d mismatched clusters"),
+            Trial, bOrthographic ? TEXT("ortho") : TEXT("perspective"), NumPointLights, NumSpotLights, Grid.LightIndices.Num(),
+            BuildMs, ReferenceMs, bSameLayout ? NumMismatchedClusters : static_cast<int32>(ReferenceGrid.GetNumClusters()));
+        if (FirstMismatch != INDEX_NONE)
+        {
+            const uint32 X = static_cast<uint32>(FirstMismatch) % Grid.CountX;
+            const uint32 Y = static_cast<uint32>(FirstMismatch) / Grid.CountX % Grid.CountY;
+            const uint32 Z = static_cast<uint32>(FirstMismatch) / (Grid.CountX * Grid.CountY);
+            const FLightClusterRange& Range = Grid.Ranges[FirstMismatch];
+            const FLightClusterRange& ReferenceRange = ReferenceGrid.Ranges[FirstMismatch];
+            UE_LOG(ELogLevel::Error, TEXT("  First mismatch at cluster (%u, %u, %u): Build %u point %u spot, Reference %u point %u spot"),
+                X, Y, Z, Range.GetNumPointLights(), Range.GetNumSpotLights(), ReferenceRange.GetNumPointLights(), ReferenceRange.GetNumSpotLights());
+        }
+    }
+
+    return NumFailedTrials == 0;
+}
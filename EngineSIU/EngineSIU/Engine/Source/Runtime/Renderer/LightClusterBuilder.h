@@ -0,0 +1,136 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+struct FLightClusterSettings
+{
+    uint32 CountX = 16;
+    uint32 CountY = 9;
+    uint32 CountZ = 24;
+};
+
+/** 클러스터 배정에 쓰는 포인트 라이트, 월드 공간 */
+struct FClusterPointLight
+{
+    FVector Position;
+    float Radius;
+};
+
+/** 클러스터 배정에 쓰는 스팟 라이트, 월드 공간 */
+struct FClusterSpotLight
+{
+    FVector Position;
+    float Radius;
+    FVector Direction;
+    float OuterAngle; // 라디안, 90도 이상이면 구로만 검사
+};
+
+/** 클러스터를 나눌 카메라, 프로젝션은 JungleMath로 만든 대칭 프러스텀만 지원 */
+struct FLightClusterView
+{
+    FMatrix ViewMatrix;
+    float ProjectionScaleX;
+    float ProjectionScaleY;
+    float NearZ;
+    float FarZ;
+    bool bOrthographic;
+
+    static FLightClusterView Make(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix, float NearZ, float FarZ, bool bOrthographic);
+};
+
+/** 클러스터 하나가 LightIndices에서 차지하는 구간, 포인트 라이트 인덱스 뒤에 스팟 라이트 인덱스가 이어짐 */
+struct FLightClusterRange
+{
+    uint32 Offset;
+    uint32 Count; // 하위 16비트는 포인트 라이트 수, 상위 16비트는 스팟 라이트 수
+
+    uint32 GetNumPointLights() const { return Count & 0xFFFF; }
+    uint32 GetNumSpotLights() const { return Count >> 16; }
+};
+
+struct FLightClusterGrid
+{
+    uint32 CountX = 0;
+    uint32 CountY = 0;
+    uint32 CountZ = 0;
+
+    /** 셰이더에서 Slice = floor(SliceInput * ZSliceScale + ZSliceBias), SliceInput은 원근이면 log(ViewZ), 직교면 ViewZ */
+    float ZSliceScale = 0.f;
+    float ZSliceBias = 0.f;
+    bool bOrthographic = false;
+
+    /** (Z * CountY + Y) * CountX + X 순서, Y는 화면 위쪽이 0 */
+    TArray<FLightClusterRange> Ranges;
+    TArray<uint32> LightIndices;
+
+    uint32 GetClusterIndex(uint32 X, uint32 Y, uint32 Z) const { return (Z * CountY + Y) * CountX + X; }
+    uint32 GetNumClusters() const { return CountX * CountY * CountZ; }
+};
+
+/**
+ * 뷰 프러스텀을 X, Y는 화면 타일로, Z는 지수 분포 슬라이스로 나눈 클러스터마다 영향을 주는 라이트를 CPU에서 찾음
+ *
+ * - 라이트를 뷰 공간 SoA로 바꾼 뒤 SSE로 라이트 4개씩 클러스터 AABB와 검사
+ * - 슬라이스 전체 AABB, 행 AABB 순서로 후보를 줄인 뒤 행 단위로 FJobSystem에서 병렬로 처리
+ * - 상위 AABB는 하위 AABB를 포함하므로 후보 축소가 결과를 바꾸지 않고, 결과는 BuildReference와 같음
+ */
+class FLightClusterBuilder
+{
+public:
+    void SetSettings(const FLightClusterSettings& InSettings) { Settings = InSettings; }
+    const FLightClusterSettings& GetSettings() const { return Settings; }
+
+    void Build(const FLightClusterView& View, const TArray<FClusterPointLight>& PointLights, const TArray<FClusterSpotLight>& SpotLights, FLightClusterGrid& OutGrid);
+
+    /** 모든 클러스터와 모든 라이트를 스칼라로 검사, Build의 결과를 확인하는 용도 */
+    static void BuildReference(
+        const FLightClusterSettings& Settings, const FLightClusterView& View,
+        const TArray<FClusterPointLight>& PointLights, const TArray<FClusterSpotLight>& SpotLights, FLightClusterGrid& OutGrid
+    );
+
+    /** 무작위 라이트와 카메라로 Build와 BuildReference를 NumTrials번 실행하고, 결과가 다른 클러스터 수와 시간을 로그로 출력 */
+    static bool RunSelfTest(int32 NumPointLights, int32 NumSpotLights, int32 NumTrials);
+
+private:
+    struct FClusterBounds
+    {
+        float MinX, MinY, MinZ;
+        float MaxX, MaxY, MaxZ;
+    };
+
+    /** 뷰 공간 라이트, SIMD 로드를 위해 4의 배수로 패딩 */
+    struct FLightSoA
+    {
+        TArray<float> X, Y, Z, Radius;
+        TArray<float> DirX, DirY, DirZ, CosAngle, SinAngle;
+        TArray<uint32> bUseCone;
+        int32 Num = 0;
+
+        void SetNum(int32 InNum, bool bSpot);
+    };
+
+    struct FRowScratch;
+
+    void ProcessRow(uint32 SliceIndex, uint32 RowIndex, FRowScratch& Scratch);
+
+    FLightClusterSettings Settings;
+
+    FLightSoA PointSoA;
+    FLightSoA SpotSoA;
+
+    /** 슬라이스, 행, 클러스터 순서로 포함 관계가 성립하는 AABB */
+    TArray<FClusterBounds> ClusterBounds;
+    TArray<FClusterBounds> RowBounds;
+    TArray<FClusterBounds> SliceBounds;
+
+    /** 슬라이스 AABB와 겹치는 라이트 */
+    TArray<TArray<uint32>> SlicePointCandidates;
+    TArray<TArray<uint32>> SliceSpotCandidates;
+
+    /** 행마다 클러스터 순서로 이어 붙인 라이트 인덱스, 마지막에 하나로 합침 */
+    TArray<TArray<uint32>> RowIndices;
+
+    FLightClusterGrid* Grid = nullptr;
+};
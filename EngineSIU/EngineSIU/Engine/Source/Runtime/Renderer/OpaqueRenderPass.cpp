@@ -97,17 +97,20 @@ void FOpaqueRenderPass::ChangeViewMode(EViewModeIndex ViewMode)
     // Input Layout
     InputLayout_StaticMesh = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
     InputLayout_SkeletalMesh = ShaderManager->GetInputLayoutByKey(L"SkeletalMeshVertexShader");
+    InputLayout_PackedSkeletalMesh = ShaderManager->GetInputLayoutByKey(L"PACKED_SkeletalMeshVertexShader");
 
     // Vertex Shader
     if (ViewMode == EViewModeIndex::VMI_Lit_Gouraud)
     {
         VertexShader_StaticMesh = ShaderManager->GetVertexShaderByKey(L"GOURAUD_StaticMeshVertexShader");
         VertexShader_SkeletalMesh = ShaderManager->GetVertexShaderByKey(L"GOURAUD_SkeletalMeshVertexShader");
+        VertexShader_PackedSkeletalMesh = ShaderManager->GetVertexShaderByKey(L"GOURAUD_PACKED_SkeletalMeshVertexShader");
     }
     else
     {
         VertexShader_StaticMesh = ShaderManager->GetVertexShaderByKey(L"StaticMeshVertexShader");
         VertexShader_SkeletalMesh = ShaderManager->GetVertexShaderByKey(L"SkeletalMeshVertexShader");
+        VertexShader_PackedSkeletalMesh = ShaderManager->GetVertexShaderByKey(L"PACKED_SkeletalMeshVertexShader");
     }
 
     // Pixel Shader
@@ -187,9 +190,8 @@ void FOpaqueRenderPass::CleanUpRender(const std::shared_ptr<FEditorViewportClien
     Graphics->DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
     
     ID3D11ShaderResourceView* NullSRV[1] = { nullptr };
-    Graphics->DeviceContext->PSSetShaderResources(static_cast<int>(EShaderSRVSlot::SRV_PointLight), 1, NullSRV); // t51 슬롯을 NULL로 설정
     Graphics->DeviceContext->PSSetShaderResources(static_cast<int>(EShaderSRVSlot::SRV_DirectionalLight), 1, NullSRV); // t51 슬롯을 NULL로 설정
-    Graphics->DeviceContext->PSSetShaderResources(static_cast<int>(EShaderSRVSlot::SRV_SpotLight), 1, NullSRV); // t51 슬롯을 NULL로 설정
+    Graphics->DeviceContext->PSSetShaderResources(static_cast<int>(EShaderSRVSlot::SRV_LocalLightShadowAtlas), 1, NullSRV); // t50 슬롯을 NULL로 설정
 
     // 머티리얼 리소스 해제
     constexpr UINT NumViews = static_cast<UINT>(EMaterialTextureSlots::MTS_MAX);
@@ -259,7 +261,7 @@ void FOpaqueRenderPass::RenderStaticMesh(const std::shared_ptr<FEditorViewportCl
 
         UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
 
-        RenderStaticMesh_Internal(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderStaticMesh_Internal(RenderData->GetLOD(Comp->GetLOD()), Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
 
         if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
         {
@@ -278,7 +280,7 @@ void FOpaqueRenderPass::RenderSkeletalMesh(const std::shared_ptr<FEditorViewport
 {
     for (const USkeletalMeshComponent* Comp : SkeletalMeshComponents)
     {
-        if (!Comp || !Comp->GetSkeletalMeshAsset())
+        if (!Comp || !Comp->GetSkeletalMeshAsset() || IsSkeletalMeshCulled(Comp, Viewport))
         {
             continue;
         }
@@ -312,6 +314,10 @@ void FOpaqueRenderPass::RenderSkeletalMesh(const std::shared_ptr<FEditorViewport
 
         UpdateBones(Comp);
 
+        const bool bPacked = UsePackedSkeletalMeshVertices(RenderData);
+        Graphics->DeviceContext->VSSetShader(bPacked ? VertexShader_PackedSkeletalMesh : VertexShader_SkeletalMesh, nullptr, 0);
+        Graphics->DeviceContext->IASetInputLayout(bPacked ? InputLayout_PackedSkeletalMesh : InputLayout_SkeletalMesh);
+
         RenderSkeletalMesh_Internal(RenderData);
 
         if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
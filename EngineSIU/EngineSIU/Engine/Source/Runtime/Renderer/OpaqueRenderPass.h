@@ -54,5 +54,8 @@ protected:
     ID3D11VertexShader* VertexShader_SkeletalMesh = nullptr;
     ID3D11InputLayout* InputLayout_SkeletalMesh = nullptr;
 
+    ID3D11VertexShader* VertexShader_PackedSkeletalMesh = nullptr;
+    ID3D11InputLayout* InputLayout_PackedSkeletalMesh = nullptr;
+
     ID3D11PixelShader* PixelShader = nullptr;
 };
@@ -2,10 +2,12 @@
 
 #include "Define.h"
 #include "RendererHelpers.h"
+#include "Animation/AnimUpdateRateManager.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "D3D11RHI/DXDBufferManager.h"
 #include "Engine/SkeletalMesh.h"
 #include "Engine/Asset/StaticMeshAsset.h"
+#include "UnrealEd/EditorViewportClient.h"
 
 FRenderPassBase::FRenderPassBase()
     : BufferManager(nullptr)
@@ -158,9 +160,14 @@ void FRenderPassBase::RenderStaticMeshInstanced_Internal(const FStaticMeshRender
     }
 }
 
+bool FRenderPassBase::UsePackedSkeletalMeshVertices(const FSkeletalMeshRenderData* RenderData)
+{
+    return !USkeletalMeshComponent::GetCPUSkinning() && USkeletalMeshComponent::GetPackedVertices() && !RenderData->PackedVertices.IsEmpty();
+}
+
 void FRenderPassBase::RenderSkeletalMesh_Internal(const FSkeletalMeshRenderData* RenderData)
 {
-    constexpr UINT Stride = sizeof(FSkeletalMeshVertex);
+    UINT Stride = sizeof(FSkeletalMeshVertex);
     constexpr UINT Offset = 0;
 
     FCPUSkinningConstants CPUSkinningData;
@@ -173,6 +180,11 @@ void FRenderPassBase::RenderSkeletalMesh_Internal(const FSkeletalMeshRenderData*
         BufferManager->CreateDynamicVertexBuffer(RenderData->ObjectName, RenderData->Vertices, VertexInfo);
         BufferManager->UpdateDynamicVertexBuffer(RenderData->ObjectName, RenderData->Vertices);
     }
+    else if (UsePackedSkeletalMeshVertices(RenderData))
+    {
+        Stride = sizeof(FPackedSkeletalMeshVertex);
+        BufferManager->CreateVertexBuffer(RenderData->ObjectName + L"_Packed", RenderData->PackedVertices, VertexInfo);
+    }
     else
     {
         BufferManager->CreateVertexBuffer(RenderData->ObjectName, RenderData->Vertices, VertexInfo);
@@ -205,6 +217,19 @@ void FRenderPassBase::RenderSkeletalMesh_Internal(const FSkeletalMeshRenderData*
     }
 }
 
+bool FRenderPassBase::IsSkeletalMeshCulled(const USkeletalMeshComponent* SkeletalMeshComponent, const std::shared_ptr<FEditorViewportClient>& Viewport)
+{
+    if (!SkeletalMeshComponent->bSkipSkinningWhenOffscreen || !Viewport)
+    {
+        return false;
+    }
+
+    FVector Center;
+    float Radius;
+    SkeletalMeshComponent->GetBoundingSphere(Center, Radius);
+    return !FAnimUpdateRateManager::IsSphereInView(Center, Radius, Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix());
+}
+
 void FRenderPassBase::UpdateBones(const USkeletalMeshComponent* SkeletalMeshComponent)
 {
     if (!SkeletalMeshComponent ||
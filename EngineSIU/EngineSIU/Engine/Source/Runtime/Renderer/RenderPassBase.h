@@ -5,6 +5,7 @@
 #include "Math/Vector4.h"
 
 
+class FEditorViewportClient;
 class USkeletalMeshComponent;
 class UMaterial;
 struct FStaticMaterial;
@@ -34,8 +35,14 @@ protected:
 
     void RenderSkeletalMesh_Internal(const FSkeletalMeshRenderData* RenderData);
 
+    /** GPU 스키닝이고 압축된 버텍스가 있다면 압축 버텍스로 그림, 이때는 PACKED_VERTEX로 컴파일한 셰이더를 바인딩해야 함 */
+    static bool UsePackedSkeletalMeshVertices(const FSkeletalMeshRenderData* RenderData);
+
     void UpdateBones(const USkeletalMeshComponent* SkeletalMeshComponent);
 
+    /** 화면 밖의 Skeletal Mesh는 Bone 갱신과 그리기를 생략 */
+    static bool IsSkeletalMeshCulled(const USkeletalMeshComponent* SkeletalMeshComponent, const std::shared_ptr<FEditorViewportClient>& Viewport);
+
     virtual void Release();
     
     FDXDBufferManager* BufferManager;
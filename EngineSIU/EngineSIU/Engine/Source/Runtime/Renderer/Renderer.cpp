@@ -61,6 +61,7 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
     {
         assert(ShadowManager->Initialize(Graphics, BufferManager) && "ShadowManager Initialize Failed");
         ShadowRenderPass->InitializeShadowManager(ShadowManager);
+        UpdateLightBufferPass->InitializeShadowManager(ShadowManager);
     }
 
     // Opaque Passes
@@ -113,6 +114,7 @@ void FRenderer::CreateConstantBuffers()
     // Light
     BufferManager->CreateBufferGeneric<FLightInfoBuffer>("FLightInfoBuffer", nullptr, sizeof(FLightInfoBuffer), D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
     BufferManager->CreateBufferGeneric<FLitUnlitConstants>("FLitUnlitConstants", nullptr, sizeof(FLitUnlitConstants), D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+    BufferManager->CreateBufferGeneric<FLightClusterConstants>("FLightClusterConstants", nullptr, sizeof(FLightClusterConstants), D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
 
     // Shadow
     BufferManager->CreateBufferGeneric<FPointLightGSBuffer>("FPointLightGSBuffer", nullptr, sizeof(FPointLightGSBuffer), D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
@@ -193,6 +195,28 @@ void FRenderer::CreateCommonShader() const
     {
         return;
     }
+
+    // FPackedSkeletalMeshVertex
+    D3D11_INPUT_ELEMENT_DESC PackedSkeletalMeshLayoutDesc[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TANGENT", 0, DXGI_FORMAT_R32_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"BONE_INDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"BONE_WEIGHTS", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+    };
+
+    D3D_SHADER_MACRO DefinesPacked[] =
+    {
+        { "PACKED_VERTEX", "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"PACKED_SkeletalMeshVertexShader", L"Shaders/SkeletalMeshVertexShader.hlsl", "mainVS", PackedSkeletalMeshLayoutDesc, ARRAYSIZE(PackedSkeletalMeshLayoutDesc), DefinesPacked);
+    if (FAILED(hr))
+    {
+        return;
+    }
     
 #pragma region UberShader
     D3D_SHADER_MACRO DefinesGouraud[] =
@@ -211,6 +235,18 @@ void FRenderer::CreateCommonShader() const
     {
         return;
     }
+
+    D3D_SHADER_MACRO DefinesGouraudPacked[] =
+    {
+        { GOURAUD, "1" },
+        { "PACKED_VERTEX", "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"GOURAUD_PACKED_SkeletalMeshVertexShader", L"Shaders/SkeletalMeshVertexShader.hlsl", "mainVS", PackedSkeletalMeshLayoutDesc, ARRAYSIZE(PackedSkeletalMeshLayoutDesc), DefinesGouraudPacked);
+    if (FAILED(hr))
+    {
+        return;
+    }
 #pragma endregion UberShader
 
     hr = ShaderManager->AddVertexShader(L"FullScreenQuadVertexShader", L"Shaders/FullScreenQuadVertexShader.hlsl", "main");
@@ -323,34 +359,27 @@ void FRenderer::RenderPreScene(const std::shared_ptr<FEditorViewportClient>& Vie
             DepthPrePass->Render(Viewport);
         }
 
-        // Added Compute Shader Pass
-        if (TileLightCullingPass)
+        // 라이트 버퍼 갱신과 클러스터 배정, 이후 패스에서 사용할 수 있도록 바인딩
         {
+            QUICK_SCOPE_CYCLE_COUNTER(UpdateLightBufferPass_CPU)
+            QUICK_GPU_SCOPE_CYCLE_COUNTER(UpdateLightBufferPass_GPU, *GPUTimingManager)
+            UpdateLightBufferPass->Render(Viewport);
+        }
+
+        // 라이팅은 CPU 클러스터 결과를 쓰므로 타일 컬링 컴퓨트 셰이더는 히트맵을 볼 때만 돌림
+        if (TileLightCullingPass && (ShowFlag & EEngineShowFlags::SF_LightHeatMap))
+        {
+            TileLightCullingPass->SetLightData(UpdateLightBufferPass->GetPointLights(), UpdateLightBufferPass->GetSpotLights());
             {
                 QUICK_SCOPE_CYCLE_COUNTER(TileLightCulling_CPU)
                 QUICK_GPU_SCOPE_CYCLE_COUNTER(TileLightCulling_GPU, *GPUTimingManager)
                 TileLightCullingPass->Render(Viewport);
             }
-
-            // 이후 패스에서 사용할 수 있도록 리소스 생성
-            // @todo UpdateLightBuffer에서 병목 발생 -> 필요한 라이트에 대하여만 업데이트 필요, Tiled Culling으로 GPU->CPU 전송은 주객전도
-            UpdateLightBufferPass->SetLightData(
-                TileLightCullingPass->GetPointLights(),
-                TileLightCullingPass->GetSpotLights(),
-                TileLightCullingPass->GetPerTilePointLightIndexMaskBufferSRV(),
-                TileLightCullingPass->GetPerTileSpotLightIndexMaskBufferSRV()
-            );
-
-            {
-                QUICK_SCOPE_CYCLE_COUNTER(UpdateLightBufferPass_CPU)
-                QUICK_GPU_SCOPE_CYCLE_COUNTER(UpdateLightBufferPass_GPU, *GPUTimingManager)
-                UpdateLightBufferPass->Render(Viewport);
-            }
         }
 
         if (Viewport->GetViewMode() != EViewModeIndex::VMI_Unlit)
         {
-            ShadowRenderPass->SetLightData(TileLightCullingPass->GetPointLights(), TileLightCullingPass->GetSpotLights());
+            ShadowRenderPass->SetLightData(UpdateLightBufferPass->GetPointLights(), UpdateLightBufferPass->GetSpotLights());
             {
                 QUICK_SCOPE_CYCLE_COUNTER(ShadowPass_CPU)
                 QUICK_GPU_SCOPE_CYCLE_COUNTER(ShadowPass_GPU, *GPUTimingManager)
@@ -1,11 +1,11 @@
 #pragma once
 #include "Launch/EngineLoop.h"
+#include "Engine/TextureStreamer.h"
 
 enum class EShaderSRVSlot : int8
 {
-    SRV_SpotLight = 50,
+    SRV_LocalLightShadowAtlas = 50,
     SRV_DirectionalLight = 51,
-    SRV_PointLight = 52,
     SRV_DepthOfField_LayerInfo = 90,
     SRV_DepthOfField_LayerNear = 91,
     SRV_DepthOfField_LayerFar = 92,
@@ -55,6 +55,9 @@ namespace MaterialUtils
             {
                 std::shared_ptr<FTexture> Texture = FEngineLoop::ResourceManager.GetTexture(MaterialInfo.TextureInfos[Idx].TexturePath);
 
+                // 최근에 그려진 텍스처일수록 스트리밍 우선순위가 높음
+                Texture->LastRenderedFrame = FTextureStreamer::Get().GetFrameNumber();
+
                 SRVs[Idx] = Texture->TextureSRV;
                 Samplers[Idx] = Graphics->GetSamplerState(Texture->SamplerType);
 
@@ -0,0 +1,435 @@
+#include "ShadowAtlas.h"
+#include <cmath>
+
+#include "Math/MathUtility.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    bool RemoveNode(TArray<uint32>& Nodes, uint32 Node)
+    {
+        for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+        {
+            if (Nodes[Index] == Node)
+            {
+                Nodes[Index] = Nodes[Nodes.Num() - 1];
+                Nodes.Pop();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32 FloorPowerOfTwo(uint32 Value)
+    {
+        uint32 Result = 1;
+        while (Result <= Value / 2)
+        {
+            Result *= 2;
+        }
+        return Result;
+    }
+}
+
+FShadowAtlasAllocator::FShadowAtlasAllocator(uint32 InAtlasSize, uint32 InMinTileSize, uint32 InMaxTileSize)
+{
+    AtlasSize = FloorPowerOfTwo(FMath::Max(InAtlasSize, 1u));
+    MinTileSize = FloorPowerOfTwo(FMath::Clamp(InMinTileSize, 1u, AtlasSize));
+    MaxTileSize = FloorPowerOfTwo(FMath::Clamp(InMaxTileSize, MinTileSize, AtlasSize));
+
+    NumLevels = GetLevelForSize(MinTileSize) + 1;
+    FreeNodes.SetNum(static_cast<int32>(NumLevels));
+}
+
+uint32 FShadowAtlasAllocator::GetLevelForSize(uint32 Size) const
+{
+    uint32 Level = 0;
+    while ((AtlasSize >> (Level + 1)) >= Size && (AtlasSize >> (Level + 1)) > 0)
+    {
+        ++Level;
+    }
+    return Level;
+}
+
+uint32 FShadowAtlasAllocator::ClampTileSize(uint32 Size) const
+{
+    return FloorPowerOfTwo(FMath::Clamp(Size, MinTileSize, MaxTileSize));
+}
+
+void FShadowAtlasAllocator::ResetNodes()
+{
+    for (TArray<uint32>& Nodes : FreeNodes)
+    {
+        Nodes.Empty();
+    }
+    FreeNodes[0].Add(PackNode(0, 0));
+}
+
+bool FShadowAtlasAllocator::AllocateNodeAt(uint32 Level, uint32 X, uint32 Y)
+{
+    // (X, Y)를 덮고 있는 빈 노드를 가장 작은 레벨부터 찾음
+    for (int32 FreeLevel = static_cast<int32>(Level); FreeLevel >= 0; --FreeLevel)
+    {
+        const uint32 Shift = Level - FreeLevel;
+        if (!RemoveNode(FreeNodes[FreeLevel], PackNode(X >> Shift, Y >> Shift)))
+        {
+            continue;
+        }
+
+        // 찾은 노드를 (X, Y)까지 나누면서 경로에서 벗어난 형제 노드를 빈 노드로 돌려놓음
+        for (uint32 SplitLevel = FreeLevel + 1; SplitLevel <= Level; ++SplitLevel)
+        {
+            const uint32 PathX = X >> (Level - SplitLevel);
+            const uint32 PathY = Y >> (Level - SplitLevel);
+            const uint32 BaseX = PathX & ~1u;
+            const uint32 BaseY = PathY & ~1u;
+            for (uint32 Child = 0; Child < 4; ++Child)
+            {
+                const uint32 ChildX = BaseX + (Child & 1);
+                const uint32 ChildY = BaseY + (Child >> 1);
+                if (ChildX != PathX || ChildY != PathY)
+                {
+                    FreeNodes[SplitLevel].Add(PackNode(ChildX, ChildY));
+                }
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+bool FShadowAtlasAllocator::AllocateAnyNode(uint32 Level, uint32& OutX, uint32& OutY)
+{
+    // 같은 크기의 빈 노드를 먼저 쓰고, 없으면 가장 작은 큰 노드를 나눠서 큰 노드를 최대한 남겨둠
+    for (int32 FreeLevel = static_cast<int32>(Level); FreeLevel >= 0; --FreeLevel)
+    {
+        if (FreeNodes[FreeLevel].Num() == 0)
+        {
+            continue;
+        }
+
+        const uint32 Node = FreeNodes[FreeLevel].Pop();
+        uint32 X = Node & 0xFFFF;
+        uint32 Y = Node >> 16;
+        for (uint32 SplitLevel = FreeLevel + 1; SplitLevel <= Level; ++SplitLevel)
+        {
+            X *= 2;
+            Y *= 2;
+            FreeNodes[SplitLevel].Add(PackNode(X + 1, Y + 1));
+            FreeNodes[SplitLevel].Add(PackNode(X, Y + 1));
+            FreeNodes[SplitLevel].Add(PackNode(X + 1, Y));
+        }
+        OutX = X;
+        OutY = Y;
+        return true;
+    }
+    return false;
+}
+
+int32 FShadowAtlasAllocator::Allocate(const TArray<FShadowAtlasRequest>& Requests, TArray<FShadowAtlasRegion>& OutRegions)
+{
+    const int32 NumRequests = Requests.Num();
+
+    EffectiveSizes.SetNum(NumRequests);
+    uint64 TotalArea = 0;
+    for (int32 Index = 0; Index < NumRequests; ++Index)
+    {
+        EffectiveSizes[Index] = Requests[Index].DesiredSize > 0 ? ClampTileSize(Requests[Index].DesiredSize) : 0;
+        TotalArea += static_cast<uint64>(EffectiveSizes[Index]) * EffectiveSizes[Index];
+    }
+
+    // 면적이 넘치면 우선순위가 낮은 요청부터 한 번씩 절반으로 줄이는 것을 반복
+    const uint64 AtlasArea = static_cast<uint64>(AtlasSize) * AtlasSize;
+    if (TotalArea > AtlasArea)
+    {
+        SortedRequests.SetNum(NumRequests);
+        for (int32 Index = 0; Index < NumRequests; ++Index)
+        {
+            SortedRequests[Index] = Index;
+        }
+        SortedRequests.Sort([&Requests](int32 A, int32 B)
+        {
+            if (Requests[A].Priority != Requests[B].Priority)
+            {
+                return Requests[A].Priority < Requests[B].Priority;
+            }
+            return Requests[A].Key > Requests[B].Key;
+        });
+
+        bool bShrunk = true;
+        while (TotalArea > AtlasArea && bShrunk)
+        {
+            bShrunk = false;
+            for (int32 Index : SortedRequests)
+            {
+                if (TotalArea <= AtlasArea)
+                {
+                    break;
+                }
+                uint32& Size = EffectiveSizes[Index];
+                if (Size > MinTileSize)
+                {
+                    TotalArea -= static_cast<uint64>(Size) * Size * 3 / 4;
+                    Size /= 2;
+                    bShrunk = true;
+                }
+            }
+        }
+    }
+
+    OutRegions.SetNum(NumRequests);
+    bPlaced.SetNum(NumRequests);
+
+    auto PlaceAll = [&](bool bKeepPrevious) -> bool
+    {
+        ResetNodes();
+        for (int32 Index = 0; Index < NumRequests; ++Index)
+        {
+            OutRegions[Index] = FShadowAtlasRegion();
+            bPlaced[Index] = 0;
+        }
+
+        // 1. 크기가 그대로인 요청은 지난 자리에 두어서 아틀라스 내용이 크게 흔들리지 않게 함
+        if (bKeepPrevious)
+        {
+            for (int32 Index = 0; Index < NumRequests; ++Index)
+            {
+                const FShadowAtlasRegion* Previous = Regions.Find(Requests[Index].Key);
+                const uint32 Size = EffectiveSizes[Index];
+                if (Size == 0 || !Previous || Previous->Size != Size)
+                {
+                    continue;
+                }
+                if (AllocateNodeAt(GetLevelForSize(Size), Previous->X / Size, Previous->Y / Size))
+                {
+                    OutRegions[Index] = *Previous;
+                    bPlaced[Index] = 1;
+                }
+            }
+        }
+
+        // 2. 나머지는 큰 요청부터, 크기가 같으면 우선순위가 높은 요청부터 배치
+        SortedRequests.Empty();
+        for (int32 Index = 0; Index < NumRequests; ++Index)
+        {
+            if (!bPlaced[Index] && EffectiveSizes[Index] > 0)
+            {
+                SortedRequests.Add(Index);
+            }
+        }
+        SortedRequests.Sort([this, &Requests](int32 A, int32 B)
+        {
+            if (EffectiveSizes[A] != EffectiveSizes[B])
+            {
+                return EffectiveSizes[A] > EffectiveSizes[B];
+            }
+            if (Requests[A].Priority != Requests[B].Priority)
+            {
+                return Requests[A].Priority > Requests[B].Priority;
+            }
+            return Requests[A].Key < Requests[B].Key;
+        });
+
+        bool bAllFit = true;
+        for (int32 Index : SortedRequests)
+        {
+            uint32 Size = EffectiveSizes[Index];
+            uint32 X = 0;
+            uint32 Y = 0;
+            while (!AllocateAnyNode(GetLevelForSize(Size), X, Y))
+            {
+                bAllFit = false;
+                if (Size <= MinTileSize)
+                {
+                    Size = 0;
+                    break;
+                }
+                Size /= 2;
+            }
+            if (Size > 0)
+            {
+                OutRegions[Index] = { X * Size, Y * Size, Size };
+            }
+        }
+        return bAllFit;
+    };
+
+    // 면적은 충분한데 지난 자리를 고집하다가 조각나서 못 들어간 요청이 생기면 처음부터 다시 배치
+    if (!PlaceAll(true) && TotalArea <= AtlasArea)
+    {
+        PlaceAll(false);
+    }
+
+    int32 NumChanged = 0;
+    for (int32 Index = 0; Index < NumRequests; ++Index)
+    {
+        const FShadowAtlasRegion* Previous = Regions.Find(Requests[Index].Key);
+        if (!Previous || *Previous != OutRegions[Index])
+        {
+            ++NumChanged;
+        }
+    }
+
+    Regions.Empty();
+    for (int32 Index = 0; Index < NumRequests; ++Index)
+    {
+        if (OutRegions[Index].IsValid())
+        {
+            Regions.Add(Requests[Index].Key, OutRegions[Index]);
+        }
+    }
+
+    return NumChanged;
+}
+
+FShadowAtlasRegion FShadowAtlasAllocator::FindRegion(uint64 Key) const
+{
+    const FShadowAtlasRegion* Region = Regions.Find(Key);
+    return Region ? *Region : FShadowAtlasRegion();
+}
+
+uint32 FShadowAtlasAllocator::ComputeDesiredSize(const FVector& LightPosition, float LightRadius, const FVector& ViewLocation, float ViewFOVDegrees, float ViewportHeight) const
+{
+    const float Distance = FVector::Distance(LightPosition, ViewLocation);
+    if (Distance <= LightRadius)
+    {
+        return MaxTileSize;
+    }
+
+    // 라이트 구가 화면 세로에서 차지하는 비율만큼 픽셀을 주면 섀도우 텍셀이 화면 픽셀과 비슷한 크기가 됨
+    const float HalfFOVTan = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(ViewFOVDegrees, 1.f, 179.f)) * 0.5f);
+    const float ScreenFraction = LightRadius / (Distance * HalfFOVTan);
+    const float ProjectedPixels = ScreenFraction * ViewportHeight;
+
+    return ClampTileSize(static_cast<uint32>(FMath::Max(ProjectedPixels, 0.f)));
+}
+
+namespace
+{
+    /** 유효한 영역이 모두 아틀라스 안에 있고, 크기에 맞게 정렬되어 있고, 서로 겹치지 않는지 */
+    bool IsValidPacking(const TArray<FShadowAtlasRegion>& Regions, uint32 AtlasSize, uint64& OutUsedArea)
+    {
+        OutUsedArea = 0;
+        for (int32 Index = 0; Index < Regions.Num(); ++Index)
+        {
+            const FShadowAtlasRegion& A = Regions[Index];
+            if (!A.IsValid())
+            {
+                continue;
+            }
+            if (A.X % A.Size != 0 || A.Y % A.Size != 0 || A.X + A.Size > AtlasSize || A.Y + A.Size > AtlasSize)
+            {
+                return false;
+            }
+            OutUsedArea += static_cast<uint64>(A.Size) * A.Size;
+
+            for (int32 Other = Index + 1; Other < Regions.Num(); ++Other)
+            {
+                const FShadowAtlasRegion& B = Regions[Other];
+                if (B.IsValid() && A.X < B.X + B.Size && B.X < A.X + A.Size && A.Y < B.Y + B.Size && B.Y < A.Y + A.Size)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+bool FShadowAtlasAllocator::RunSelfTest()
+{
+    int32 NumFailures = 0;
+    auto Check = [&NumFailures](bool bCondition, const char* Description)
+    {
+        UE_LOG(bCondition ? ELogLevel::Display : ELogLevel::Error, TEXT("[Shadow Atlas Test] %s: %s"), bCondition ? TEXT("ok") : TEXT("FAILED"), Description);
+        NumFailures += bCondition ? 0 : 1;
+    };
+
+    // 1024, 512, 256, 128 요청 10개씩, 면적 합이 4096 아틀라스보다 작으므로 모두 원하는 크기로 들어가야 함
+    FShadowAtlasAllocator Allocator(4096, 64, 1024);
+    TArray<FShadowAtlasRequest> Requests;
+    for (int32 Index = 0; Index < 40; ++Index)
+    {
+        Requests.Add({ static_cast<uint64>(Index), 1024u >> (Index % 4), static_cast<float>(Index) });
+    }
+
+    TArray<FShadowAtlasRegion> Regions;
+    uint64 UsedArea = 0;
+    int32 NumChanged = Allocator.Allocate(Requests, Regions);
+    bool bAllDesired = true;
+    for (int32 Index = 0; Index < Requests.Num(); ++Index)
+    {
+        bAllDesired &= Regions[Index].Size == Requests[Index].DesiredSize;
+    }
+    Check(IsValidPacking(Regions, Allocator.GetAtlasSize(), UsedArea) && bAllDesired && NumChanged == Requests.Num(),
+        "Requests that fit are packed at their desired size without overlap");
+
+    const TArray<FShadowAtlasRegion> FirstRegions = Regions;
+    NumChanged = Allocator.Allocate(Requests, Regions);
+    Check(NumChanged == 0, "Same requests keep their regions");
+
+    // 요청 하나의 크기만 바꾸면 그 요청만 움직이고 나머지는 제자리
+    Requests[5].DesiredSize = 64;
+    NumChanged = Allocator.Allocate(Requests, Regions);
+    bool bOthersKept = true;
+    for (int32 Index = 0; Index < Requests.Num(); ++Index)
+    {
+        bOthersKept &= Index == 5 || Regions[Index] == FirstRegions[Index];
+    }
+    Check(IsValidPacking(Regions, Allocator.GetAtlasSize(), UsedArea) && NumChanged == 1 && bOthersKept && Regions[5].Size == 64,
+        "Resizing one request moves only that request");
+
+    // 빠진 요청의 영역은 더 이상 찾을 수 없어야 함
+    const uint64 RemovedKey = Requests[Requests.Num() - 1].Key;
+    Requests.Pop();
+    Allocator.Allocate(Requests, Regions);
+    Check(!Allocator.FindRegion(RemovedKey).IsValid() && Allocator.FindRegion(Requests[0].Key) == Regions[0], "Removed request loses its region");
+
+    // 면적이 넘치면 우선순위가 낮은 요청부터 줄어들어서 높은 요청은 낮은 요청보다 작아지지 않아야 함
+    {
+        TArray<FShadowAtlasRequest> Oversized;
+        for (int32 Index = 0; Index < 24; ++Index)
+        {
+            Oversized.Add({ static_cast<uint64>(100 + Index), 1024, static_cast<float>(Index) });
+        }
+        Allocator.Allocate(Oversized, Regions);
+
+        bool bPriorityOrder = true;
+        bool bAllPlaced = true;
+        for (int32 Index = 0; Index < Oversized.Num(); ++Index)
+        {
+            bAllPlaced &= Regions[Index].IsValid();
+            if (Index > 0)
+            {
+                bPriorityOrder &= Regions[Index].Size >= Regions[Index - 1].Size;
+            }
+        }
+        const bool bValid = IsValidPacking(Regions, Allocator.GetAtlasSize(), UsedArea);
+        Check(bValid && bAllPlaced && bPriorityOrder && Regions[Oversized.Num() - 1].Size == 1024,
+            "Oversubscribed atlas shrinks lower priority requests first");
+        UE_LOG(ELogLevel::Display, TEXT("[Shadow Atlas Test] 24 x 1024 requests: highest %u, lowest %u, %.1f%% of the atlas used"),
+            Regions[Oversized.Num() - 1].Size, Regions[0].Size, 100.0 * static_cast<double>(UsedArea) / (4096.0 * 4096.0));
+    }
+
+    // 최소 크기로도 자리가 모자라면 우선순위가 가장 낮은 요청부터 영역을 받지 못함
+    {
+        FShadowAtlasAllocator SmallAllocator(256, 64, 256);
+        TArray<FShadowAtlasRequest> Tiny;
+        for (int32 Index = 0; Index < 20; ++Index)
+        {
+            Tiny.Add({ static_cast<uint64>(Index), 64, static_cast<float>(Index) });
+        }
+        SmallAllocator.Allocate(Tiny, Regions);
+
+        bool bEvictedLowest = true;
+        for (int32 Index = 0; Index < Tiny.Num(); ++Index)
+        {
+            bEvictedLowest &= Regions[Index].IsValid() == (Index >= 4);
+            bEvictedLowest &= SmallAllocator.FindRegion(Tiny[Index].Key).IsValid() == (Index >= 4);
+        }
+        Check(IsValidPacking(Regions, SmallAllocator.GetAtlasSize(), UsedArea) && bEvictedLowest && UsedArea == 256ull * 256,
+            "Full atlas evicts the lowest priority requests");
+    }
+
+    return NumFailures == 0;
+}
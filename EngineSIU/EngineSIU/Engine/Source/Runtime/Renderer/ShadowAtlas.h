@@ -0,0 +1,98 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+#include "Math/Vector.h"
+
+/** 아틀라스에서 라이트 면 하나가 차지하는 정사각형 영역, 픽셀 단위 */
+struct FShadowAtlasRegion
+{
+    uint32 X = 0;
+    uint32 Y = 0;
+    uint32 Size = 0;
+
+    bool IsValid() const { return Size > 0; }
+
+    bool operator==(const FShadowAtlasRegion& Other) const { return X == Other.X && Y == Other.Y && Size == Other.Size; }
+    bool operator!=(const FShadowAtlasRegion& Other) const { return !(*this == Other); }
+};
+
+struct FShadowAtlasRequest
+{
+    /** 라이트 면을 구분하는 키, 프레임이 바뀌어도 같은 면은 같은 키여야 지난 영역을 유지함 */
+    uint64 Key = 0;
+
+    /** 원하는 한 변의 크기, Allocate에서 [MinTileSize, MaxTileSize]의 2의 거듭제곱으로 맞춤 */
+    uint32 DesiredSize = 0;
+
+    /** 공간이 모자랄 때 높은 요청부터 원하는 크기를 유지함 */
+    float Priority = 0.f;
+};
+
+/**
+ * 스팟 라이트와 포인트 라이트 면의 섀도우 맵을 텍스처 하나에 배치하는 2의 거듭제곱 쿼드트리 할당기
+ *
+ * - 요청 면적의 합이 아틀라스보다 크면 우선순위가 낮은 요청부터 크기를 절반씩 줄임
+ * - 지난 배치와 키, 크기가 같은 요청은 먼저 같은 자리에 두고, 나머지는 큰 요청부터 빈 노드를 나눠서 배치
+ * - D3D 리소스와 무관한 CPU 코드라서 렌더러 없이 돌려볼 수 있음
+ */
+class FShadowAtlasAllocator
+{
+public:
+    explicit FShadowAtlasAllocator(uint32 InAtlasSize = 4096, uint32 InMinTileSize = 64, uint32 InMaxTileSize = 1024);
+
+    /**
+     * Requests 전체를 다시 배치, OutRegions[i]는 Requests[i]의 영역이고 자리가 없으면 IsValid()가 false
+     * @return 지난 배치와 자리나 크기가 달라진 요청 수
+     */
+    int32 Allocate(const TArray<FShadowAtlasRequest>& Requests, TArray<FShadowAtlasRegion>& OutRegions);
+
+    /** 지난 Allocate에서 Key가 받은 영역, 없으면 IsValid()가 false */
+    FShadowAtlasRegion FindRegion(uint64 Key) const;
+
+    /**
+     * 반경 LightRadius의 라이트가 화면 세로에서 차지하는 픽셀 수로 원하는 크기를 정함
+     * 카메라가 라이트 안에 있으면 MaxTileSize
+     */
+    uint32 ComputeDesiredSize(const FVector& LightPosition, float LightRadius, const FVector& ViewLocation, float ViewFOVDegrees, float ViewportHeight) const;
+
+    uint32 GetAtlasSize() const { return AtlasSize; }
+    uint32 GetMinTileSize() const { return MinTileSize; }
+    uint32 GetMaxTileSize() const { return MaxTileSize; }
+
+    /** 고정된 요청으로 겹침, 배치 유지, 우선순위에 따른 축소와 제외를 검사하고 결과를 로그로 출력 */
+    static bool RunSelfTest();
+
+private:
+    /** 레벨 0은 아틀라스 전체, 레벨이 하나 내려갈 때마다 한 변이 절반 */
+    uint32 GetLevelForSize(uint32 Size) const;
+    uint32 GetSizeForLevel(uint32 Level) const { return AtlasSize >> Level; }
+
+    /** [MinTileSize, MaxTileSize]로 자르고 2의 거듭제곱으로 내림 */
+    uint32 ClampTileSize(uint32 Size) const;
+
+    void ResetNodes();
+
+    /** 레벨 Level의 (X, Y) 노드를 차지, 이미 일부라도 사용 중이면 false */
+    bool AllocateNodeAt(uint32 Level, uint32 X, uint32 Y);
+
+    /** 레벨 Level의 아무 빈 노드를 차지, 큰 빈 노드가 있으면 나눠서 사용 */
+    bool AllocateAnyNode(uint32 Level, uint32& OutX, uint32& OutY);
+
+    static uint32 PackNode(uint32 X, uint32 Y) { return (Y << 16) | X; }
+
+    uint32 AtlasSize;
+    uint32 MinTileSize;
+    uint32 MaxTileSize;
+    uint32 NumLevels;
+
+    /** 레벨별 빈 노드, 노드 좌표는 그 레벨의 타일 단위 */
+    TArray<TArray<uint32>> FreeNodes;
+
+    TMap<uint64, FShadowAtlasRegion> Regions;
+
+    /** Allocate에서 재사용 */
+    TArray<uint32> EffectiveSizes;
+    TArray<int32> SortedRequests;
+    TArray<uint8> bPlaced;
+};
@@ -0,0 +1,382 @@
+#include "ShadowCasterCache.h"
+#include <cstring>
+#include <initializer_list>
+
+#include "Math/JungleMath.h"
+#include "Math/MathUtility.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /** ax + by + cz + d >= 0 이 안쪽 */
+    struct FFrustumPlane
+    {
+        float A, B, C, D;
+    };
+
+    /** 행 벡터 규약(clip = p * M)의 ViewProj에서 D3D 클립 공간(0 <= z <= w)의 여섯 평면을 뽑음 */
+    void ExtractFrustumPlanes(const FMatrix& ViewProj, FFrustumPlane OutPlanes[6])
+    {
+        auto Column = [&ViewProj](int32 Col, int32 Row) { return ViewProj.M[Row][Col]; };
+        auto MakePlane = [&](int32 ColA, float SignA, int32 ColB, float SignB) -> FFrustumPlane
+        {
+            FFrustumPlane Plane;
+            float* Out = &Plane.A;
+            for (int32 Row = 0; Row < 4; ++Row)
+            {
+                Out[Row] = SignA * Column(ColA, Row) + (ColB >= 0 ? SignB * Column(ColB, Row) : 0.f);
+            }
+            return Plane;
+        };
+
+        OutPlanes[0] = MakePlane(3, 1.f, 0, 1.f);  // Left
+        OutPlanes[1] = MakePlane(3, 1.f, 0, -1.f); // Right
+        OutPlanes[2] = MakePlane(3, 1.f, 1, 1.f);  // Bottom
+        OutPlanes[3] = MakePlane(3, 1.f, 1, -1.f); // Top
+        OutPlanes[4] = MakePlane(2, 1.f, -1, 0.f); // Near
+        OutPlanes[5] = MakePlane(3, 1.f, 2, -1.f); // Far
+    }
+
+    bool IntersectsFrustum(const FFrustumPlane Planes[6], const FVector& Min, const FVector& Max)
+    {
+        for (int32 Index = 0; Index < 6; ++Index)
+        {
+            const FFrustumPlane& Plane = Planes[Index];
+            const float X = Plane.A >= 0.f ? Max.X : Min.X;
+            const float Y = Plane.B >= 0.f ? Max.Y : Min.Y;
+            const float Z = Plane.C >= 0.f ? Max.Z : Min.Z;
+            if (Plane.A * X + Plane.B * Y + Plane.C * Z + Plane.D < 0.f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void TransformBounds(const FMatrix& WorldMatrix, const FVector& LocalMin, const FVector& LocalMax, FVector& OutMin, FVector& OutMax)
+    {
+        OutMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+        OutMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const FVector Local(
+                (Corner & 1) ? LocalMax.X : LocalMin.X,
+                (Corner & 2) ? LocalMax.Y : LocalMin.Y,
+                (Corner & 4) ? LocalMax.Z : LocalMin.Z
+            );
+            const FVector World = WorldMatrix.TransformPosition(Local);
+            OutMin = FVector(FMath::Min(OutMin.X, World.X), FMath::Min(OutMin.Y, World.Y), FMath::Min(OutMin.Z, World.Z));
+            OutMax = FVector(FMath::Max(OutMax.X, World.X), FMath::Max(OutMax.Y, World.Y), FMath::Max(OutMax.Z, World.Z));
+        }
+    }
+
+    bool IsSameMatrix(const FMatrix& A, const FMatrix& B)
+    {
+        return std::memcmp(A.M, B.M, sizeof(A.M)) == 0;
+    }
+
+    bool IsSameVector(const FVector& A, const FVector& B)
+    {
+        return A.X == B.X && A.Y == B.Y && A.Z == B.Z;
+    }
+}
+
+void FShadowCasterCache::MarkDirty(const FVector& Min, const FVector& Max)
+{
+    if (bAllDirty)
+    {
+        return;
+    }
+    if (DirtyBoxes.Num() >= MaxDirtyBoxes)
+    {
+        bAllDirty = true;
+        DirtyBoxes.Empty();
+        return;
+    }
+    DirtyBoxes.Add({ Min, Max });
+}
+
+void FShadowCasterCache::UpdateCasters(const TArray<FShadowCasterDesc>& Casters)
+{
+    ++FrameCounter;
+    DirtyBoxes.Empty();
+    Stats.NumDirtyCasters = 0;
+    Stats.NumRebuiltFaces = 0;
+    Stats.NumReusedFaces = 0;
+
+    for (const FShadowCasterDesc& Desc : Casters)
+    {
+        if (!Desc.Component)
+        {
+            continue;
+        }
+
+        FCasterEntry* Entry = CasterEntries.Find(Desc.Component);
+        if (!Entry)
+        {
+            Entry = &CasterEntries.Emplace(Desc.Component, FCasterEntry());
+            Entry->WorldMatrix = Desc.WorldMatrix;
+            Entry->LocalMin = Desc.LocalMin;
+            Entry->LocalMax = Desc.LocalMax;
+            Entry->SortKey = Desc.SortKey;
+            TransformBounds(Desc.WorldMatrix, Desc.LocalMin, Desc.LocalMax, Entry->WorldMin, Entry->WorldMax);
+            MarkDirty(Entry->WorldMin, Entry->WorldMax);
+            ++Stats.NumDirtyCasters;
+        }
+        else if (!IsSameMatrix(Entry->WorldMatrix, Desc.WorldMatrix)
+            || !IsSameVector(Entry->LocalMin, Desc.LocalMin) || !IsSameVector(Entry->LocalMax, Desc.LocalMax)
+            || Entry->SortKey != Desc.SortKey)
+        {
+            // 움직인 캐스터는 떠난 자리와 새 자리 모두에 영향을 줌
+            MarkDirty(Entry->WorldMin, Entry->WorldMax);
+            Entry->WorldMatrix = Desc.WorldMatrix;
+            Entry->LocalMin = Desc.LocalMin;
+            Entry->LocalMax = Desc.LocalMax;
+            Entry->SortKey = Desc.SortKey;
+            TransformBounds(Desc.WorldMatrix, Desc.LocalMin, Desc.LocalMax, Entry->WorldMin, Entry->WorldMax);
+            MarkDirty(Entry->WorldMin, Entry->WorldMax);
+            ++Stats.NumDirtyCasters;
+        }
+        Entry->LastSeenFrame = FrameCounter;
+    }
+
+    RemovedCasters.Empty();
+    for (auto& [Component, Entry] : CasterEntries)
+    {
+        if (Entry.LastSeenFrame != FrameCounter)
+        {
+            MarkDirty(Entry.WorldMin, Entry.WorldMax);
+            RemovedCasters.Add(Component);
+        }
+    }
+    for (UStaticMeshComponent* Component : RemovedCasters)
+    {
+        CasterEntries.Remove(Component);
+        ++Stats.NumDirtyCasters;
+    }
+
+    Stats.NumCasters = static_cast<int32>(CasterEntries.Num());
+}
+
+const TArray<UStaticMeshComponent*>& FShadowCasterCache::GetCasterList(uint64 FaceKey, const FMatrix& ViewProj, bool* bOutRebuilt)
+{
+    FFaceEntry* Face = Faces.Find(FaceKey);
+    bool bRebuild = false;
+    if (!Face)
+    {
+        Face = &Faces.Emplace(FaceKey, FFaceEntry());
+        bRebuild = true;
+    }
+    else if (!IsSameMatrix(Face->ViewProj, ViewProj))
+    {
+        bRebuild = true;
+    }
+    else if (Face->BuiltFrame != FrameCounter)
+    {
+        // 이번 프레임에 이미 만든 목록이라면 이번 프레임의 변경 영역이 이미 반영되어 있음
+        if (bAllDirty)
+        {
+            bRebuild = true;
+        }
+        else if (DirtyBoxes.Num() > 0)
+        {
+            FFrustumPlane Planes[6];
+            ExtractFrustumPlanes(ViewProj, Planes);
+            for (const FDirtyBox& Box : DirtyBoxes)
+            {
+                if (IntersectsFrustum(Planes, Box.Min, Box.Max))
+                {
+                    bRebuild = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    Face->LastUsedFrame = FrameCounter;
+    if (bRebuild)
+    {
+        Face->ViewProj = ViewProj;
+        RebuildFace(*Face);
+        ++Stats.NumRebuiltFaces;
+    }
+    else
+    {
+        ++Stats.NumReusedFaces;
+    }
+
+    if (bOutRebuilt)
+    {
+        *bOutRebuilt = bRebuild;
+    }
+    return Face->Casters;
+}
+
+void FShadowCasterCache::RebuildFace(FFaceEntry& Face) const
+{
+    FFrustumPlane Planes[6];
+    ExtractFrustumPlanes(Face.ViewProj, Planes);
+
+    Face.Casters.Empty();
+    for (const auto& [Component, Entry] : CasterEntries)
+    {
+        if (IntersectsFrustum(Planes, Entry.WorldMin, Entry.WorldMax))
+        {
+            Face.Casters.Add(Component);
+        }
+    }
+
+    // 같은 메시를 연달아 그려서 버퍼 바인딩 변경을 줄이고, 순서를 고정해서 프레임마다 결과가 흔들리지 않게 함
+    Face.Casters.Sort([this](UStaticMeshComponent* A, UStaticMeshComponent* B)
+    {
+        const uint64 KeyA = CasterEntries.Find(A)->SortKey;
+        const uint64 KeyB = CasterEntries.Find(B)->SortKey;
+        if (KeyA != KeyB)
+        {
+            return KeyA < KeyB;
+        }
+        return A < B;
+    });
+
+    Face.BuiltFrame = FrameCounter;
+}
+
+void FShadowCasterCache::EndFrame()
+{
+    RemovedFaces.Empty();
+    for (const auto& [FaceKey, Face] : Faces)
+    {
+        if (Face.LastUsedFrame != FrameCounter)
+        {
+            RemovedFaces.Add(FaceKey);
+        }
+    }
+    for (uint64 FaceKey : RemovedFaces)
+    {
+        Faces.Remove(FaceKey);
+    }
+
+    Stats.NumFaces = static_cast<int32>(Faces.Num());
+    bAllDirty = false;
+    DirtyBoxes.Empty();
+}
+
+void FShadowCasterCache::Reset()
+{
+    CasterEntries.Empty();
+    Faces.Empty();
+    DirtyBoxes.Empty();
+    bAllDirty = true;
+    Stats = FShadowCasterCacheStats();
+}
+
+bool FShadowCasterCache::RunSelfTest()
+{
+    int32 NumFailures = 0;
+    auto Check = [&NumFailures](bool bCondition, const char* Description)
+    {
+        UE_LOG(bCondition ? ELogLevel::Display : ELogLevel::Error, TEXT("[Shadow Caster Cache Test] %s: %s"), bCondition ? TEXT("ok") : TEXT("FAILED"), Description);
+        NumFailures += bCondition ? 0 : 1;
+    };
+
+    // 원점의 포인트 라이트 면 6개, UPointLightComponent와 같은 방향과 90도 프로젝션
+    const FVector Directions[6] = {
+        FVector::ForwardVector, -FVector::ForwardVector, FVector::RightVector, -FVector::RightVector, FVector::UpVector, -FVector::UpVector
+    };
+    const FVector Ups[6] = { FVector::RightVector, FVector::RightVector, FVector::DownVector, FVector::UpVector, FVector::RightVector, FVector::RightVector };
+    const FMatrix Projection = JungleMath::CreateProjectionMatrix(PI / 2.f, 1.f, 1.f, 50.f);
+    FMatrix FaceViewProjs[6];
+    for (int32 Face = 0; Face < 6; ++Face)
+    {
+        FaceViewProjs[Face] = JungleMath::CreateViewMatrix(FVector::ZeroVector, Directions[Face], Ups[Face]) * Projection;
+    }
+
+    // 캐스터는 키로만 쓰이고 역참조하지 않으므로 더미 주소를 사용
+    uint8 DummyComponents[6] = {};
+    TArray<FShadowCasterDesc> Casters;
+    for (int32 Index = 0; Index < 6; ++Index)
+    {
+        FShadowCasterDesc Desc;
+        Desc.Component = reinterpret_cast<UStaticMeshComponent*>(&DummyComponents[Index]);
+        Desc.WorldMatrix = FMatrix::CreateTranslationMatrix(Directions[Index] * 10.f);
+        Desc.LocalMin = FVector(-1.f, -1.f, -1.f);
+        Desc.LocalMax = FVector(1.f, 1.f, 1.f);
+        Desc.SortKey = static_cast<uint64>(Index);
+        Casters.Add(Desc);
+    }
+
+    FShadowCasterCache Cache;
+    uint8 Rebuilt[6] = {};
+    int32 Counts[6] = {};
+    auto RunFrame = [&]()
+    {
+        Cache.UpdateCasters(Casters);
+        for (int32 Face = 0; Face < 6; ++Face)
+        {
+            bool bRebuilt = false;
+            Counts[Face] = Cache.GetCasterList(static_cast<uint64>(Face), FaceViewProjs[Face], &bRebuilt).Num();
+            Rebuilt[Face] = bRebuilt ? 1 : 0;
+        }
+        Cache.EndFrame();
+    };
+    auto RebuiltOnly = [&Rebuilt](std::initializer_list<int32> ExpectedFaces)
+    {
+        for (int32 Face = 0; Face < 6; ++Face)
+        {
+            bool bExpected = false;
+            for (const int32 Expected : ExpectedFaces)
+            {
+                bExpected |= Expected == Face;
+            }
+            if ((Rebuilt[Face] != 0) != bExpected)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    RunFrame();
+    bool bOnePerFace = true;
+    for (const int32 Count : Counts)
+    {
+        bOnePerFace &= Count == 1;
+    }
+    Check(RebuiltOnly({ 0, 1, 2, 3, 4, 5 }) && bOnePerFace, "First frame builds every face with one caster each");
+
+    RunFrame();
+    Check(RebuiltOnly({}) && Cache.GetStats().NumReusedFaces == 6, "Nothing moved, every face is reused");
+
+    // +X 면 안에서만 움직이면 +X 면만 다시 만듦
+    Casters[0].WorldMatrix = FMatrix::CreateTranslationMatrix(FVector(20.f, 0.f, 0.f));
+    RunFrame();
+    Check(RebuiltOnly({ 0 }) && Counts[0] == 1, "Caster moved inside one face invalidates only that face");
+
+    // +X에서 +Y로 옮기면 떠난 면과 들어간 면만 다시 만듦
+    Casters[0].WorldMatrix = FMatrix::CreateTranslationMatrix(FVector(0.f, 20.f, 0.f));
+    RunFrame();
+    Check(RebuiltOnly({ 0, 2 }) && Counts[0] == 0 && Counts[2] == 2, "Caster moved across faces invalidates the old and new faces");
+
+    // 정렬 키만 바뀌어도 목록 순서가 달라지므로 그 캐스터가 있는 면을 다시 만듦
+    Casters[4].SortKey = 100;
+    RunFrame();
+    Check(RebuiltOnly({ 4 }), "Sort key change invalidates the caster's face");
+
+    // 캐스터를 빼면 그 캐스터가 있던 면만 다시 만듦
+    Casters.RemoveAt(5);
+    RunFrame();
+    Check(RebuiltOnly({ 5 }) && Counts[5] == 0 && Cache.GetStats().NumCasters == 5, "Removed caster invalidates only its face");
+
+    // 라이트가 움직여 ViewProj가 바뀐 면은 캐스터와 상관없이 다시 만듦
+    FaceViewProjs[1] = JungleMath::CreateViewMatrix(FVector(0.f, 0.f, 0.5f), FVector(0.f, 0.f, 0.5f) + Directions[1], Ups[1]) * Projection;
+    RunFrame();
+    Check(RebuiltOnly({ 1 }), "Changed face ViewProj invalidates only that face");
+
+    // 이번 프레임에 쓰지 않은 면은 EndFrame에서 버림
+    Cache.UpdateCasters(Casters);
+    Cache.GetCasterList(0, FaceViewProjs[0]);
+    Cache.EndFrame();
+    Check(Cache.GetStats().NumFaces == 1, "Faces not used in a frame are dropped");
+
+    return NumFailures == 0;
+}
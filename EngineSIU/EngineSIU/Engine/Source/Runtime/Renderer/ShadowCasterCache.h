@@ -0,0 +1,108 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+class UStaticMeshComponent;
+
+/** 섀도우 캐스터 하나의 이번 프레임 상태 */
+struct FShadowCasterDesc
+{
+    UStaticMeshComponent* Component = nullptr;
+    FMatrix WorldMatrix = FMatrix::Identity;
+
+    /** 로컬 공간 AABB */
+    FVector LocalMin = FVector::ZeroVector;
+    FVector LocalMax = FVector::ZeroVector;
+
+    /** 캐스터 목록 정렬 키, 같은 메시끼리 붙어서 그려지도록 렌더 데이터 주소 같은 값을 넣음 */
+    uint64 SortKey = 0;
+};
+
+struct FShadowCasterCacheStats
+{
+    int32 NumCasters = 0;
+    int32 NumDirtyCasters = 0;
+    int32 NumFaces = 0;
+    int32 NumRebuiltFaces = 0;
+    int32 NumReusedFaces = 0;
+};
+
+/**
+ * 섀도우 면(스팟 라이트 하나 또는 포인트 라이트 면 하나)별로 컬링과 정렬이 끝난 캐스터 목록을 유지
+ *
+ * - UpdateCasters에서 추가, 이동, 제거된 캐스터의 이전/현재 월드 AABB를 변경 영역으로 모음
+ * - GetCasterList는 면의 ViewProj가 그대로이고 변경 영역이 면의 프러스텀과 겹치지 않으면 지난 목록을 그대로 돌려줌
+ * - 이번 프레임에 쓰이지 않은 면은 EndFrame에서 버림
+ * - D3D와 무관한 CPU 코드
+ */
+class FShadowCasterCache
+{
+public:
+    /** 프레임마다 한 번, 섀도우를 그리기 전에 모든 캐스터로 호출 */
+    void UpdateCasters(const TArray<FShadowCasterDesc>& Casters);
+
+    /**
+     * FaceKey 면에 그릴 캐스터 목록, 다음 UpdateCasters 전까지만 유효
+     * @param bOutRebuilt 목록을 다시 만들었다면 true, false라면 지난 프레임과 같은 캐스터가 같은 자리에 있으므로 깊이도 그대로임
+     */
+    const TArray<UStaticMeshComponent*>& GetCasterList(uint64 FaceKey, const FMatrix& ViewProj, bool* bOutRebuilt = nullptr);
+
+    void EndFrame();
+
+    void Reset();
+
+    const FShadowCasterCacheStats& GetStats() const { return Stats; }
+
+    /** 포인트 라이트 면 6개와 캐스터 6개로 캐스터를 옮기거나 빼거나 면이 움직일 때 영향받는 면만 다시 만드는지 검사 */
+    static bool RunSelfTest();
+
+    /** 변경 영역이 이보다 많으면 하나씩 검사하지 않고 모든 면을 다시 만듦 */
+    static constexpr int32 MaxDirtyBoxes = 64;
+
+private:
+    struct FCasterEntry
+    {
+        FMatrix WorldMatrix;
+        FVector LocalMin;
+        FVector LocalMax;
+        FVector WorldMin;
+        FVector WorldMax;
+        uint64 SortKey = 0;
+        uint64 LastSeenFrame = 0;
+    };
+
+    struct FDirtyBox
+    {
+        FVector Min;
+        FVector Max;
+    };
+
+    struct FFaceEntry
+    {
+        FMatrix ViewProj;
+        TArray<UStaticMeshComponent*> Casters;
+        uint64 BuiltFrame = 0;
+        uint64 LastUsedFrame = 0;
+    };
+
+    void MarkDirty(const FVector& Min, const FVector& Max);
+
+    void RebuildFace(FFaceEntry& Face) const;
+
+    TMap<UStaticMeshComponent*, FCasterEntry> CasterEntries;
+    TMap<uint64, FFaceEntry> Faces;
+
+    TArray<FDirtyBox> DirtyBoxes;
+    bool bAllDirty = true;
+
+    uint64 FrameCounter = 0;
+
+    /** UpdateCasters, EndFrame에서 재사용 */
+    TArray<UStaticMeshComponent*> RemovedCasters;
+    TArray<uint64> RemovedFaces;
+
+    FShadowCasterCacheStats Stats;
+};
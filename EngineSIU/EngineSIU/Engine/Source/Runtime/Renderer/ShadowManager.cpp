@@ -3,6 +3,8 @@
 #include <utility>
 
 #include "Components/Light/DirectionalLightComponent.h"
+#include "Components/Light/PointLightComponent.h"
+#include "Components/Light/SpotLightComponent.h"
 #include "Math/JungleMath.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "D3D11RHI/DXDBufferManager.h"
@@ -15,8 +17,7 @@ FShadowManager::FShadowManager()
     D3DContext = nullptr;
     ShadowSamplerCmp = nullptr;
     ShadowPointSampler = nullptr; // <<< 초기화 추가
-    SpotShadowDepthRHI = nullptr;
-    PointShadowCubeMapRHI = nullptr; // <<< 초기화 추가
+    LocalLightShadowAtlasRHI = nullptr;
     DirectionalShadowCascadeDepthRHI = nullptr;
 }
 
@@ -32,8 +33,7 @@ FShadowManager::~FShadowManager()
 
 
 bool FShadowManager::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBufferManager,
-    uint32 InMaxSpotShadows, uint32 InSpotResolution,
-    uint32 InMaxPointShadows, uint32 InPointResolution, uint32 InNumCascades, uint32 InDirResolution)
+    uint32 InAtlasResolution, uint32 InNumCascades, uint32 InDirResolution)
 {
     if (D3DDevice) // 이미 초기화된 경우 방지
     {
@@ -51,31 +51,20 @@ bool FShadowManager::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager*
     BufferManager = InBufferManager;
 
     // RHI 구조체 할당
-    SpotShadowDepthRHI = new FShadowDepthRHI();
-    PointShadowCubeMapRHI = new FShadowCubeMapArrayRHI(); // << 추가
+    LocalLightShadowAtlasRHI = new FShadowDepthRHI();
     DirectionalShadowCascadeDepthRHI = new FShadowDepthRHI();
 
     // 설정 값 저장
-    MaxSpotLightShadows = InMaxSpotShadows;
-                           
-
-    MaxPointLightShadows = InMaxPointShadows; // << 추가
     //NumCascades = InNumCascades; // 차후 명시적인 바인딩 위해 주석처리 
 
-    SpotShadowDepthRHI->ShadowMapResolution = InSpotResolution;
-    PointShadowCubeMapRHI->ShadowMapResolution = InPointResolution; // << 추가
+    AtlasAllocator = FShadowAtlasAllocator(InAtlasResolution);
+    LocalLightShadowAtlasRHI->ShadowMapResolution = AtlasAllocator.GetAtlasSize();
     DirectionalShadowCascadeDepthRHI->ShadowMapResolution = InDirResolution;
 
     // 리소스 생성 시도
-    if (!CreateSpotShadowResources())
-    {
-        // UE_LOG(LogTemp, Error, TEXT("Failed to create spot shadow resources!"));
-        Release();
-        return false;
-    }
-    if (!CreatePointShadowResources()) // << 추가된 호출
+    if (!CreateLocalLightShadowAtlasResources())
     {
-        // UE_LOG(LogTemp, Error, TEXT("Failed to create point shadow resources!"));
+        UE_LOG(ELogLevel::Error, TEXT("Failed to create local light shadow atlas resources!"));
         Release();
         return false;
     }
@@ -104,8 +93,7 @@ void FShadowManager::Release()
     // 생성된 역순 또는 그룹별로 리소스 해제
     ReleaseSamplers();
     ReleaseDirectionalShadowResources();
-    ReleasePointShadowResources(); // << 추가
-    ReleaseSpotShadowResources();
+    ReleaseLocalLightShadowAtlasResources();
 
     // 배열 클리어
     CascadesViewProjMatrices.Empty();
@@ -115,56 +103,181 @@ void FShadowManager::Release()
     D3DContext = nullptr;
 }
 
-void FShadowManager::BeginSpotShadowPass(uint32 SliceIndex)
+void FShadowManager::AllocateLocalLightShadows(const TArray<UPointLightComponent*>& PointLights, const TArray<USpotLightComponent*>& SpotLights)
 {
-    // 유효성 검사
-    if (!D3DContext || std::cmp_greater_equal(SliceIndex, SpotShadowDepthRHI->ShadowDSVs.Num()) || !SpotShadowDepthRHI->ShadowDSVs[SliceIndex])
+    // 지난 프레임에 그린 뷰로 배치, 아무 뷰도 그리지 않은 프레임이었다면 그 전 뷰를 그대로 사용
+    if (PendingShadowViews.Num() > 0)
+    {
+        ShadowViews = PendingShadowViews;
+        PendingShadowViews.Empty();
+    }
+
+    // 지난 배치를 아틀라스에 그리지 못하고 지나갔다면 그때 바뀐 영역을 알 수 없으므로 전부 다시 그림
+    if (bPendingAtlasRender)
+    {
+        bAtlasContentsLost = true;
+    }
+    bPendingAtlasRender = true;
+
+    auto ComputeRequest = [this](uint64 Key, const FVector& Position, float Radius, uint32 SizeDivisor) -> FShadowAtlasRequest
+    {
+        FShadowAtlasRequest Request;
+        Request.Key = Key;
+        if (ShadowViews.Num() == 0)
+        {
+            Request.DesiredSize = AtlasAllocator.GetMaxTileSize() / 2 / SizeDivisor;
+            return Request;
+        }
+
+        // 여러 뷰포트 중 라이트가 가장 크게 보이는 뷰 기준
+        for (const FShadowView& View : ShadowViews)
+        {
+            const uint32 Size = AtlasAllocator.ComputeDesiredSize(Position, Radius, View.Location, View.FOV, View.Height) / SizeDivisor;
+            Request.DesiredSize = FMath::Max(Request.DesiredSize, Size);
+            Request.Priority = FMath::Max(Request.Priority, Radius / FMath::Max(FVector::Distance(Position, View.Location), 1.f));
+        }
+        return Request;
+    };
+
+    AtlasRequests.Empty();
+    for (USpotLightComponent* SpotLight : SpotLights)
+    {
+        if (SpotLight->GetCastShadows())
+        {
+            AtlasRequests.Add(ComputeRequest(GetSpotLightShadowKey(SpotLight), SpotLight->GetComponentLocation(), SpotLight->GetRadius(), 1));
+        }
+    }
+    for (UPointLightComponent* PointLight : PointLights)
+    {
+        if (!PointLight->GetCastShadows())
+        {
+            continue;
+        }
+        // 포인트 라이트 면 하나는 구의 1/6만 담으므로 스팟 라이트의 절반 크기로 요청
+        const FShadowAtlasRequest FaceRequest = ComputeRequest(0, PointLight->GetComponentLocation(), PointLight->GetRadius(), 2);
+        for (int32 Face = 0; Face < 6; ++Face)
+        {
+            FShadowAtlasRequest& Request = AtlasRequests[AtlasRequests.Add(FaceRequest)];
+            Request.Key = GetPointLightShadowKey(PointLight, Face);
+        }
+    }
+
+    PreviousAtlasRegions.SetNum(AtlasRequests.Num());
+    for (int32 Index = 0; Index < AtlasRequests.Num(); ++Index)
+    {
+        PreviousAtlasRegions[Index] = AtlasAllocator.FindRegion(AtlasRequests[Index].Key);
+    }
+
+    AtlasStats = FShadowAtlasStats();
+    AtlasStats.NumRequests = AtlasRequests.Num();
+    AtlasStats.NumChangedRegions = AtlasAllocator.Allocate(AtlasRequests, AtlasRegions);
+
+    ChangedRegionKeys.Empty();
+    for (int32 Index = 0; Index < AtlasRequests.Num(); ++Index)
+    {
+        const FShadowAtlasRegion& Region = AtlasRegions[Index];
+        if (Region.IsValid())
+        {
+            ++AtlasStats.NumAllocated;
+            AtlasStats.UsedTexels += static_cast<uint64>(Region.Size) * Region.Size;
+            if (Region != PreviousAtlasRegions[Index])
+            {
+                ChangedRegionKeys.Add(AtlasRequests[Index].Key);
+            }
+        }
+    }
+
+    // 라이트 정보에 UV 영역 기록, 영역을 받지 못했거나 섀도우를 끈 라이트는 0으로 두어 셰이더에서 그림자 없음으로 처리
+    const float InvAtlasSize = 1.f / static_cast<float>(AtlasAllocator.GetAtlasSize());
+    auto ToAtlasRect = [this, InvAtlasSize](uint64 Key) -> FVector4
+    {
+        const FShadowAtlasRegion Region = AtlasAllocator.FindRegion(Key);
+        if (!Region.IsValid())
+        {
+            return FVector4(0.f, 0.f, 0.f, 0.f);
+        }
+        return FVector4(Region.X * InvAtlasSize, Region.Y * InvAtlasSize, Region.Size * InvAtlasSize, Region.Size * InvAtlasSize);
+    };
+
+    for (USpotLightComponent* SpotLight : SpotLights)
+    {
+        SpotLight->GetSpotLightInfo().ShadowAtlasRect = ToAtlasRect(GetSpotLightShadowKey(SpotLight));
+    }
+    for (UPointLightComponent* PointLight : PointLights)
+    {
+        FPointLightInfo& LightInfo = PointLight->GetPointLightInfo();
+        for (int32 Face = 0; Face < 6; ++Face)
+        {
+            LightInfo.ShadowAtlasRects[Face] = ToAtlasRect(GetPointLightShadowKey(PointLight, Face));
+        }
+    }
+}
+
+void FShadowManager::AddShadowView(const std::shared_ptr<FEditorViewportClient>& Viewport)
+{
+    // 직교 뷰포트는 라이트 크기가 줌에 따라 달라지므로 배치에 사용하지 않음
+    if (!Viewport->IsPerspective())
     {
-        // UE_LOG(LogTemp, Warning, TEXT("BeginSpotShadowPass: Invalid slice index or DSV."));
         return;
     }
 
-    // 렌더 타겟 설정 (DSV만 설정)
-    ID3D11RenderTargetView* NullRTV = nullptr;
-    D3DContext->OMSetRenderTargets(1, &NullRTV, SpotShadowDepthRHI->ShadowDSVs[SliceIndex]);
+    FShadowView View;
+    View.Location = Viewport->GetCameraLocation();
+    View.FOV = Viewport->GetCameraFOV();
+    View.Height = Viewport->GetViewportResource()->GetD3DViewport().Height;
+    PendingShadowViews.Add(View);
+}
 
-    // 뷰포트 설정
-    D3D11_VIEWPORT Viewport;
-    Viewport.Width = static_cast<float>(SpotShadowDepthRHI->ShadowMapResolution);
-    Viewport.Height = static_cast<float>(SpotShadowDepthRHI->ShadowMapResolution);
-    Viewport.MinDepth = 0.0f;
-    Viewport.MaxDepth = 1.0f;
-    Viewport.TopLeftX = 0;
-    Viewport.TopLeftY = 0;
-    D3DContext->RSSetViewports(1, &Viewport);
+uint64 FShadowManager::GetSpotLightShadowKey(const USpotLightComponent* SpotLight)
+{
+    return reinterpret_cast<uint64>(SpotLight);
+}
 
-    // DSV 클리어
-    D3DContext->ClearDepthStencilView(SpotShadowDepthRHI->ShadowDSVs[SliceIndex], D3D11_CLEAR_DEPTH, 1.0f, 0);
+uint64 FShadowManager::GetPointLightShadowKey(const UPointLightComponent* PointLight, int32 FaceIndex)
+{
+    // 컴포넌트 주소는 8바이트 이상으로 정렬되어 있으므로 아래 3비트에 면 번호를 넣어도 다른 라이트와 겹치지 않음
+    return reinterpret_cast<uint64>(PointLight) | static_cast<uint64>(FaceIndex);
 }
 
-void FShadowManager::BeginPointShadowPass(uint32 SliceIndex)
+void FShadowManager::BeginLocalLightShadowAtlasPass()
 {
-    if (!D3DContext || !PointShadowCubeMapRHI || std::cmp_greater_equal(SliceIndex, PointShadowCubeMapRHI->ShadowDSVs.Num()) || !PointShadowCubeMapRHI->ShadowDSVs[SliceIndex])
+    if (!D3DContext || !LocalLightShadowAtlasRHI || LocalLightShadowAtlasRHI->ShadowDSVs.Num() == 0)
     {
-        // UE_LOG(LogTemp, Warning, TEXT("BeginPointShadowPass: Invalid slice index (%u) or DSV."), sliceIndex);
-        return; // 유효성 검사
+        return;
     }
 
-    // 포인트 라이트의 DSV 바인딩 (이 DSV는 TextureCubeArray의 특정 슬라이스(큐브맵)를 가리킴)
     ID3D11RenderTargetView* NullRTV = nullptr;
-    D3DContext->OMSetRenderTargets(1, &NullRTV, PointShadowCubeMapRHI->ShadowDSVs[SliceIndex]);
+    D3DContext->OMSetRenderTargets(1, &NullRTV, LocalLightShadowAtlasRHI->ShadowDSVs[0]);
 
-    // 뷰포트 설정 (큐브맵 한 면의 해상도)
-    D3D11_VIEWPORT Viewport = {};
-    Viewport.Width = static_cast<float>(PointShadowCubeMapRHI->ShadowMapResolution);
-    Viewport.Height = static_cast<float>(PointShadowCubeMapRHI->ShadowMapResolution);
-    Viewport.MinDepth = 0.0f; Viewport.MaxDepth = 1.0f;
-    D3DContext->RSSetViewports(1, &Viewport);
+    // 평소에는 바뀐 영역만 다시 그리므로 전체 클리어는 아틀라스 내용이 없을 때만
+    if (bAtlasContentsLost)
+    {
+        D3DContext->ClearDepthStencilView(LocalLightShadowAtlasRHI->ShadowDSVs[0], D3D11_CLEAR_DEPTH, 1.0f, 0);
+    }
+}
 
-    // DSV 클리어 (바인딩된 큐브맵 슬라이스의 모든 면을 클리어)
-    D3DContext->ClearDepthStencilView(PointShadowCubeMapRHI->ShadowDSVs[SliceIndex], D3D11_CLEAR_DEPTH, 1.0f, 0);
+void FShadowManager::SetLocalLightShadowViewport(const FShadowAtlasRegion& Region) const
+{
+    D3D11_VIEWPORT Viewport;
+    Viewport.TopLeftX = static_cast<float>(Region.X);
+    Viewport.TopLeftY = static_cast<float>(Region.Y);
+    Viewport.Width = static_cast<float>(Region.Size);
+    Viewport.Height = static_cast<float>(Region.Size);
+    Viewport.MinDepth = 0.0f;
+    Viewport.MaxDepth = 1.0f;
+    D3DContext->RSSetViewports(1, &Viewport);
 }
 
+void FShadowManager::EndLocalLightShadowAtlasPass()
+{
+    if (D3DContext)
+    {
+        D3DContext->RSSetViewports(0, nullptr);
+        D3DContext->OMSetRenderTargets(0, nullptr, nullptr);
+    }
+    bAtlasContentsLost = false;
+    bPendingAtlasRender = false;
+}
 
 void FShadowManager::BeginDirectionalShadowCascadePass(uint32 CascadeIndex)
 {
@@ -194,7 +307,7 @@ void FShadowManager::BeginDirectionalShadowCascadePass(uint32 CascadeIndex)
 }
 
 void FShadowManager::BindResourcesForSampling(
-    uint32 SpotShadowSlot, uint32 PointShadowSlot, uint32 DirectionalShadowSlot, // << pointShadowSlot 추가
+    uint32 LocalLightShadowSlot, uint32 DirectionalShadowSlot,
     uint32 SamplerCmpSlot, uint32 SamplerPointSlot)
 {
     if (!D3DContext)
@@ -203,13 +316,9 @@ void FShadowManager::BindResourcesForSampling(
     }
 
     // SRV 바인딩
-    if (SpotShadowDepthRHI && SpotShadowDepthRHI->ShadowSRV)
-    {
-        D3DContext->PSSetShaderResources(SpotShadowSlot, 1, &SpotShadowDepthRHI->ShadowSRV);
-    }
-    if (PointShadowCubeMapRHI && PointShadowCubeMapRHI->ShadowSRV) // << 추가
+    if (LocalLightShadowAtlasRHI && LocalLightShadowAtlasRHI->ShadowSRV)
     {
-        D3DContext->PSSetShaderResources(PointShadowSlot, 1, &PointShadowCubeMapRHI->ShadowSRV);
+        D3DContext->PSSetShaderResources(LocalLightShadowSlot, 1, &LocalLightShadowAtlasRHI->ShadowSRV);
     }
     if (DirectionalShadowCascadeDepthRHI && DirectionalShadowCascadeDepthRHI->ShadowSRV)
     {
@@ -259,204 +368,91 @@ FMatrix FShadowManager::GetCascadeViewProjMatrix(int Idx) const
 
 // --- Private 멤버 함수 구현 (리소스 생성/해제 헬퍼) ---
 
-bool FShadowManager::CreateSpotShadowResources()
+bool FShadowManager::CreateLocalLightShadowAtlasResources()
 {
     // 유효성 검사
-    if (!D3DDevice || MaxSpotLightShadows == 0 || SpotShadowDepthRHI->ShadowMapResolution == 0)
+    if (!D3DDevice || LocalLightShadowAtlasRHI->ShadowMapResolution == 0)
     {
         return false;
     }
 
-    // 1. Texture2DArray 생성
+    // 1. 아틀라스 텍스처 생성, 라이트 면마다 영역을 나눠 쓰므로 배열이 아닌 Texture2D 하나
     D3D11_TEXTURE2D_DESC TexDesc = {};
-    TexDesc.Width = SpotShadowDepthRHI->ShadowMapResolution;
-    TexDesc.Height = SpotShadowDepthRHI->ShadowMapResolution;
+    TexDesc.Width = LocalLightShadowAtlasRHI->ShadowMapResolution;
+    TexDesc.Height = LocalLightShadowAtlasRHI->ShadowMapResolution;
     TexDesc.MipLevels = 1;
-    TexDesc.ArraySize = MaxSpotLightShadows;
+    TexDesc.ArraySize = 1;
     TexDesc.Format = DXGI_FORMAT_R32_TYPELESS; // 깊이 포맷
     TexDesc.SampleDesc.Count = 1;
     TexDesc.SampleDesc.Quality = 0;
     TexDesc.Usage = D3D11_USAGE_DEFAULT;
     TexDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL | D3D11_BIND_SHADER_RESOURCE;
-    TexDesc.CPUAccessFlags = 0;
-    TexDesc.MiscFlags = 0;
 
-    HRESULT hr = D3DDevice->CreateTexture2D(&TexDesc, nullptr, &SpotShadowDepthRHI->ShadowTexture);
+    HRESULT hr = D3DDevice->CreateTexture2D(&TexDesc, nullptr, &LocalLightShadowAtlasRHI->ShadowTexture);
     if (FAILED(hr))
     {
-        // UE_LOG(LogTemp, Error, TEXT("CreateTexture2D failed for SpotShadowArrayTexture (HR=0x%X)"), hr);
         return false;
     }
 
-    // 2. 전체 배열용 SRV 생성
+    // 2. 샘플링용 SRV, ImGui에서도 같은 SRV에 UV 영역만 지정해서 사용
     D3D11_SHADER_RESOURCE_VIEW_DESC SrvDesc = {};
     SrvDesc.Format = DXGI_FORMAT_R32_FLOAT; // 읽기용 포맷
-    SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
-    SrvDesc.Texture2DArray.MostDetailedMip = 0;
-    SrvDesc.Texture2DArray.MipLevels = 1;
-    SrvDesc.Texture2DArray.FirstArraySlice = 0;
-    SrvDesc.Texture2DArray.ArraySize = MaxSpotLightShadows;
+    SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+    SrvDesc.Texture2D.MostDetailedMip = 0;
+    SrvDesc.Texture2D.MipLevels = 1;
 
-    hr = D3DDevice->CreateShaderResourceView(SpotShadowDepthRHI->ShadowTexture, &SrvDesc, &SpotShadowDepthRHI->ShadowSRV);
+    hr = D3DDevice->CreateShaderResourceView(LocalLightShadowAtlasRHI->ShadowTexture, &SrvDesc, &LocalLightShadowAtlasRHI->ShadowSRV);
     if (FAILED(hr))
     {
-        // UE_LOG(LogTemp, Error, TEXT("CreateShaderResourceView failed for SpotShadowArraySRV (HR=0x%X)"), hr);
-        ReleaseSpotShadowResources(); // 생성된 텍스처 정리
+        ReleaseLocalLightShadowAtlasResources();
         return false;
     }
 
-    
-    SpotShadowDepthRHI->ShadowDSVs.SetNum(MaxSpotLightShadows);
-    for (uint32 Idx = 0; Idx < MaxSpotLightShadows; ++Idx)
-    {
-        D3D11_DEPTH_STENCIL_VIEW_DESC DsvDesc = {};
-        DsvDesc.Format = DXGI_FORMAT_D32_FLOAT; // 깊이 포맷
-        DsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
-        DsvDesc.Texture2DArray.MipSlice = 0;
-        DsvDesc.Texture2DArray.FirstArraySlice = Idx;
-        DsvDesc.Texture2DArray.ArraySize = 1;
-        DsvDesc.Flags = 0;
-
-        hr = D3DDevice->CreateDepthStencilView(SpotShadowDepthRHI->ShadowTexture, &DsvDesc, &SpotShadowDepthRHI->ShadowDSVs[Idx]);
-        if (FAILED(hr))
-        {
-            // UE_LOG(LogTemp, Error, TEXT("CreateDepthStencilView failed for SpotShadowSliceDSV[%u] (HR=0x%X)"), i, hr);
-            ReleaseSpotShadowResources(); // 생성된 것들 정리
-            return false;
-        }
-    }
+    // 3. DSV 하나, 영역은 뷰포트로 나눔
+    LocalLightShadowAtlasRHI->ShadowDSVs.SetNum(1);
 
-    SpotShadowDepthRHI->ShadowSRVs.SetNum(MaxSpotLightShadows);
-    for (uint32 Idx = 0; Idx < MaxSpotLightShadows; ++Idx)
-    {
-        D3D11_SHADER_RESOURCE_VIEW_DESC SrvDesc = {};
-        SrvDesc.Format = DXGI_FORMAT_R32_FLOAT;
-        SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
-        SrvDesc.Texture2DArray.MostDetailedMip = 0;
-        SrvDesc.Texture2DArray.MipLevels = 1;
-        SrvDesc.Texture2DArray.FirstArraySlice = Idx;
-        SrvDesc.Texture2DArray.ArraySize = 1;
-
-        hr = D3DDevice->CreateShaderResourceView(SpotShadowDepthRHI->ShadowTexture, &SrvDesc, & SpotShadowDepthRHI->ShadowSRVs[Idx]);
-        if (FAILED(hr)) { ReleaseDirectionalShadowResources(); return false; }
-    }
-
-    return true;
-}
-
-void FShadowManager::ReleaseSpotShadowResources()
-{
-    if (SpotShadowDepthRHI)
-    {
-        SpotShadowDepthRHI->Release();
-        delete SpotShadowDepthRHI;
-        SpotShadowDepthRHI = nullptr;
-    }
-}
+    D3D11_DEPTH_STENCIL_VIEW_DESC DsvDesc = {};
+    DsvDesc.Format = DXGI_FORMAT_D32_FLOAT; // 깊이 포맷
+    DsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
+    DsvDesc.Texture2D.MipSlice = 0;
 
-bool FShadowManager::CreatePointShadowResources() // << 추가된 함수 구현
-{
-    if (!D3DDevice || !PointShadowCubeMapRHI || MaxPointLightShadows == 0 || PointShadowCubeMapRHI->ShadowMapResolution == 0)
+    hr = D3DDevice->CreateDepthStencilView(LocalLightShadowAtlasRHI->ShadowTexture, &DsvDesc, &LocalLightShadowAtlasRHI->ShadowDSVs[0]);
+    if (FAILED(hr))
     {
+        ReleaseLocalLightShadowAtlasResources();
         return false;
     }
 
-    // 1. TextureCubeArray 생성 (Texture2D로 생성 후 MiscFlags 사용)
-    D3D11_TEXTURE2D_DESC TexDesc = {};
-    TexDesc.Width = PointShadowCubeMapRHI->ShadowMapResolution;
-    TexDesc.Height = PointShadowCubeMapRHI->ShadowMapResolution;
-    TexDesc.MipLevels = 1;
-    TexDesc.ArraySize = MaxPointLightShadows * 6; // <<< 총 면의 개수 (큐브맵 개수 * 6)
-    TexDesc.Format = DXGI_FORMAT_R32_TYPELESS;     // TYPELESS 사용
-    TexDesc.SampleDesc.Count = 1;
-    TexDesc.Usage = D3D11_USAGE_DEFAULT;
-    TexDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL | D3D11_BIND_SHADER_RESOURCE;
-    TexDesc.MiscFlags = D3D11_RESOURCE_MISC_TEXTURECUBE; // <<< 큐브맵임을 명시
+    // 4. 영역 클리어용 깊이 상태, 깊이 비교 없이 덮어씀
+    D3D11_DEPTH_STENCIL_DESC ClearDepthDesc = {};
+    ClearDepthDesc.DepthEnable = TRUE;
+    ClearDepthDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ALL;
+    ClearDepthDesc.DepthFunc = D3D11_COMPARISON_ALWAYS;
+    ClearDepthDesc.StencilEnable = FALSE;
 
-    HRESULT hr = D3DDevice->CreateTexture2D(&TexDesc, nullptr, &PointShadowCubeMapRHI->ShadowTexture);
+    hr = D3DDevice->CreateDepthStencilState(&ClearDepthDesc, &AtlasClearDepthState);
     if (FAILED(hr))
     {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to create Shadow Cube Map texture!"));
-        return hr;
-    }
-
-    // 2. 전체 배열용 SRV 생성 (TEXTURECUBEARRAY 사용)
-    D3D11_SHADER_RESOURCE_VIEW_DESC SrvDesc = {};
-    SrvDesc.Format = DXGI_FORMAT_R32_FLOAT; // 읽기 형식
-    SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBEARRAY; // <<< 큐브맵 배열 뷰
-    SrvDesc.TextureCubeArray.MostDetailedMip = 0;
-    SrvDesc.TextureCubeArray.MipLevels = 1;
-    SrvDesc.TextureCubeArray.First2DArrayFace = 0;      // 첫 번째 큐브맵의 인덱스
-    SrvDesc.TextureCubeArray.NumCubes = MaxPointLightShadows; // <<< 총 큐브맵 개수
-
-    hr = D3DDevice->CreateShaderResourceView(PointShadowCubeMapRHI->ShadowTexture, &SrvDesc, &PointShadowCubeMapRHI->ShadowSRV);
-    if (FAILED(hr))
-    {
-        // UE_LOG(LogTemp, Error, TEXT("CreateShaderResourceView failed for PointShadowCubeMap SRV (HR=0x%X)"), hr);
-        ReleasePointShadowResources();
+        ReleaseLocalLightShadowAtlasResources();
         return false;
     }
 
-    // 3. 각 큐브맵 슬라이스용 DSV 생성 (렌더링 시 GS의 SV_RenderTargetArrayIndex 사용)
-    PointShadowCubeMapRHI->ShadowDSVs.SetNum(MaxPointLightShadows);
-    for (uint32 Idx = 0; Idx < MaxPointLightShadows; ++Idx)
-    {
-        D3D11_DEPTH_STENCIL_VIEW_DESC DsvDesc = {};
-        DsvDesc.Format = DXGI_FORMAT_D32_FLOAT; // 쓰기 형식
-        DsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY; // DSV는 2D Array View 사용
-        DsvDesc.Texture2DArray.MipSlice = 0;
-        DsvDesc.Texture2DArray.FirstArraySlice = Idx * 6; // <<< 각 큐브맵의 시작 인덱스 (i번째 큐브맵의 +X 면)
-        DsvDesc.Texture2DArray.ArraySize = 6;       // <<< 각 DSV는 큐브맵 하나(6면)를 가리킴
-        DsvDesc.Flags = 0;
-
-        hr = D3DDevice->CreateDepthStencilView(PointShadowCubeMapRHI->ShadowTexture, &DsvDesc, &PointShadowCubeMapRHI->ShadowDSVs[Idx]);
-        if (FAILED(hr))
-        {
-            // UE_LOG(LogTemp, Error, TEXT("CreateDepthStencilView failed for PointShadowCubeMap DSV[%u] (HR=0x%X)"), i, hr);
-            ReleasePointShadowResources();
-            return false;
-        }
-    }
-
-    // --- 4. ImGui 디버그용: 각 면에 대한 개별 SRV 생성 ---
-    PointShadowCubeMapRHI->ShadowFaceSRVs.SetNum(MaxPointLightShadows); // 외부 배열 크기 설정
-    for (uint32 PointLightIdx = 0; PointLightIdx < MaxPointLightShadows; ++PointLightIdx) // 각 포인트 라이트 루프
-    {
-        PointShadowCubeMapRHI->ShadowFaceSRVs[PointLightIdx].SetNum(6); // 내부 배열 크기 설정 (6개 면)
-        for (uint32 FaceIdx = 0; FaceIdx < 6; ++FaceIdx) // 각 면 루프 (+X, -X, +Y, -Y, +Z, -Z 순서 가정)
-        {
-            // 이 면의 플랫 배열 인덱스 계산
-            uint32 FlatArrayIndex = PointLightIdx * 6 + FaceIdx;
-
-            D3D11_SHADER_RESOURCE_VIEW_DESC FaceSrvDesc = {};
-            FaceSrvDesc.Format = DXGI_FORMAT_R32_FLOAT; // 읽기 형식
-            FaceSrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY; // 소스는 배열이지만, 뷰는 단일 슬라이스
-            FaceSrvDesc.Texture2DArray.MostDetailedMip = 0;
-            FaceSrvDesc.Texture2DArray.MipLevels = 1;
-            FaceSrvDesc.Texture2DArray.FirstArraySlice = FlatArrayIndex; // <<< 이 면의 인덱스 지정
-            FaceSrvDesc.Texture2DArray.ArraySize = 1; // <<< SRV는 단 1개의 슬라이스만 가리킴
-
-            hr = D3DDevice->CreateShaderResourceView(PointShadowCubeMapRHI->ShadowTexture, &FaceSrvDesc, &PointShadowCubeMapRHI->ShadowFaceSRVs[PointLightIdx][FaceIdx]);
-            if (FAILED(hr))
-            {
-                // UE_LOG(LogTemp, Error, TEXT("CreateShaderResourceView failed for PointShadow Face SRV [%u][%u] (HR=0x%X)"), i, j, hr);
-                // 실패 시, 지금까지 생성된 모든 리소스 정리 필요 (더 복잡한 롤백 로직 또는 단순하게 전체 해제)
-                ReleasePointShadowResources();
-                return false;
-            }
-        }
-    }
-
+    bAtlasContentsLost = true;
     return true;
 }
 
-void FShadowManager::ReleasePointShadowResources() // << 추가된 함수 구현
+void FShadowManager::ReleaseLocalLightShadowAtlasResources()
 {
-    if (PointShadowCubeMapRHI)
+    if (AtlasClearDepthState)
+    {
+        AtlasClearDepthState->Release();
+        AtlasClearDepthState = nullptr;
+    }
+    if (LocalLightShadowAtlasRHI)
     {
-        PointShadowCubeMapRHI->Release();
-        delete PointShadowCubeMapRHI; // Initialize에서 new 했으므로 delete 필요
-        PointShadowCubeMapRHI = nullptr;
+        LocalLightShadowAtlasRHI->Release();
+        delete LocalLightShadowAtlasRHI;
+        LocalLightShadowAtlasRHI = nullptr;
     }
 }
 
@@ -4,7 +4,9 @@
 #include <d3d11.h>
 
 #include "RendererHelpers.h"
+#include "ShadowAtlas.h"
 #include "Container/Array.h"
+#include "Container/Set.h"
 #include "Math/Matrix.h"     // FMatrix (UE 스타일)
 
 struct FShadowDepthRHI
@@ -49,62 +51,19 @@ struct FShadowDepthRHI
 };
 
 class UDirectionalLightComponent;
+class UPointLightComponent;
+class USpotLightComponent;
 class FDXDBufferManager;
 
-// TextureCubeArray 기반 섀도우 맵 리소스 관리 구조체
-struct FShadowCubeMapArrayRHI
+struct FShadowAtlasStats
 {
-    ID3D11Texture2D* ShadowTexture = nullptr;         // TextureCubeArray 리소스
-    ID3D11ShaderResourceView* ShadowSRV = nullptr;    // 전체 배열을 위한 SRV (메인 패스 샘플링용)
-    TArray<ID3D11DepthStencilView*> ShadowDSVs;       // 각 큐브맵 슬라이스(포인트 라이트)를 위한 DSV 배열
+    int32 NumRequests = 0;
+    int32 NumAllocated = 0;
 
-    // ImGui 디버그용: 각 포인트 라이트(outer TArray)의 각 면(inner TArray, 0~5)에 대한 SRV
-    TArray<TArray<ID3D11ShaderResourceView*>> ShadowFaceSRVs;
+    /** 이번 프레임에 자리나 크기가 바뀌어서 다시 그려야 하는 면 수 */
+    int32 NumChangedRegions = 0;
 
-    uint32 ShadowMapResolution = 512; // 큐브맵 각 면의 해상도
-
-    // 리소스 해제 함수
-    void Release()
-    {
-        // ImGui용 개별 면 SRV 해제
-        for (auto& FaceSrvArray : ShadowFaceSRVs)
-        {
-            for (auto& Srv : FaceSrvArray)
-            {
-                if (Srv)
-                {
-                    Srv->Release();
-                    Srv = nullptr;
-                }
-            }
-            FaceSrvArray.Empty(); // 내부 배열 비우기
-        }
-        ShadowFaceSRVs.Empty(); // 외부 배열 비우기
-
-        // 개별 DSV 해제
-        for (auto& DSV : ShadowDSVs)
-        {
-            if (DSV)
-            {
-                DSV->Release();
-                DSV = nullptr;
-            }
-        }
-        ShadowDSVs.Empty();
-
-        // 전체 SRV 해제
-        if (ShadowSRV)
-        {
-            ShadowSRV->Release();
-            ShadowSRV = nullptr;
-        }
-        // 텍스처 해제
-        if (ShadowTexture)
-        {
-            ShadowTexture->Release();
-            ShadowTexture = nullptr;
-        }
-    }
+    uint64 UsedTexels = 0;
 };
 
 class FEditorViewportClient;
@@ -122,34 +81,48 @@ public:
     /**
      * 섀도우 매니저를 초기화하고 필요한 D3D 리소스를 생성합니다.
      * @param InGraphics FGraphicsDevice 포인터 (Device 및 Context 포함)
-     * @param InMaxSpotShadows 지원할 최대 스포트라이트 섀도우 개수
-     * @param InSpotResolution 스포트라이트 섀도우 맵 해상도
-     * @param InMaxPointShadows 지원할 최대 포인트 라이트 섀도우 개수 << 추가
-     * @param InPointResolution 포인트 라이트 큐브맵 면 해상도 << 추가
+     * @param InAtlasResolution 스포트라이트와 포인트 라이트 면이 함께 들어가는 섀도우 아틀라스 해상도
      * @param InNumCascades 방향성 광원 CSM 캐스케이드 개수
      * @param InDirResolution 방향성 광원 섀도우 맵 해상도
      * @return 초기화 성공 여부
      */
 
     bool Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBufferManager,
-                    uint32_t InMaxSpotShadows = 128, uint32_t InSpotResolution = 1024,
-                    uint32_t InMaxPointShadows = 128,uint32_t InPointResolution = 512, uint32_t InNumCascades = 4, uint32_t InDirResolution = 4096); // NUM Cascades 바인딩 위치가 불명확합니다.
+                    uint32_t InAtlasResolution = 4096, uint32_t InNumCascades = 4, uint32_t InDirResolution = 4096); // NUM Cascades 바인딩 위치가 불명확합니다.
 
 
     /** 생성된 모든 D3D 리소스를 해제합니다. */
     void Release();
 
     /**
-     * 특정 스포트라이트 섀도우 맵 렌더링 패스를 시작하기 위해 DSV와 뷰포트를 설정하고 클리어합니다.
-     * @param SliceIndex 렌더링할 Texture2DArray의 슬라이스 인덱스
+     * 섀도우를 드리우는 스팟 라이트와 포인트 라이트 면에 아틀라스 영역을 배정하고, 라이트 정보의 ShadowAtlasRect에 기록합니다.
+     * 라이트 버퍼를 패킹하기 전에 프레임마다 한 번 호출해야 영역이 바뀐 라이트만 다시 올라갑니다.
+     * 원하는 크기는 지난 프레임에 그린 원근 뷰포트에서 라이트가 차지하는 화면 크기로 정합니다.
      */
-    void BeginSpotShadowPass(uint32_t SliceIndex);
+    void AllocateLocalLightShadows(const TArray<UPointLightComponent*>& PointLights, const TArray<USpotLightComponent*>& SpotLights);
 
-    /**
-  * 특정 포인트 라이트 섀도우 맵 렌더링 패스를 시작합니다.
-  * @param SliceIndex 렌더링할 포인트 라이트의 인덱스 (DSV 선택용)
-  */
-    void BeginPointShadowPass(uint32_t SliceIndex); // << 추가
+    /** 이번 프레임에 그린 뷰포트를 기록, 다음 프레임의 아틀라스 배치에 사용 */
+    void AddShadowView(const std::shared_ptr<FEditorViewportClient>& Viewport);
+
+    static uint64 GetSpotLightShadowKey(const USpotLightComponent* SpotLight);
+    static uint64 GetPointLightShadowKey(const UPointLightComponent* PointLight, int32 FaceIndex);
+
+    FShadowAtlasRegion GetLocalLightShadowRegion(uint64 Key) const { return AtlasAllocator.FindRegion(Key); }
+
+    /** 이번 배치에서 새로 받았거나 자리, 크기가 바뀐 영역이라 이전 깊이를 쓸 수 없으면 true */
+    bool IsLocalLightShadowRegionChanged(uint64 Key) const { return bAtlasContentsLost || ChangedRegionKeys.Contains(Key); }
+
+    /** 아틀라스 DSV를 바인딩, 아틀라스 내용이 없다면(처음 생성 등) 전체를 클리어합니다. */
+    void BeginLocalLightShadowAtlasPass();
+
+    /** 아틀라스의 Region만 그리도록 뷰포트를 설정합니다. */
+    void SetLocalLightShadowViewport(const FShadowAtlasRegion& Region) const;
+
+    /** 아틀라스 DSV를 해제하고, 이번 프레임에 모든 영역을 채웠으므로 다음 프레임부터 바뀐 영역만 다시 그리게 합니다. */
+    void EndLocalLightShadowAtlasPass();
+
+    const FShadowAtlasStats& GetShadowAtlasStats() const { return AtlasStats; }
+    uint32 GetLocalLightShadowAtlasSize() const { return AtlasAllocator.GetAtlasSize(); }
 
     /**
      * 특정 방향성 광원 캐스케이드 섀도우 맵 렌더링 패스를 시작하기 위해 DSV와 뷰포트를 설정하고 클리어합니다.
@@ -159,31 +132,25 @@ public:
 
     /**
      * 메인 렌더링 패스에서 픽셀 셰이더가 섀도우 맵을 샘플링할 수 있도록 관련 리소스를 바인딩합니다.
-     * @param SpotShadowSlot 스포트라이트 섀도우 맵 SRV 슬롯
-     * @param PointShadowSlot 포인트 라이트 섀도우 맵 SRV 슬롯 << 추가
+     * @param LocalLightShadowSlot 스포트라이트, 포인트 라이트 섀도우 아틀라스 SRV 슬롯
      * @param DirectionalShadowSlot 방향성 광원 섀도우 맵 SRV 슬롯
      * @param SamplerCmpSlot 비교 샘플러 슬롯
      * @param SamplerPointSlot 포인트 샘플러 슬롯 (필요시)
      */
     void BindResourcesForSampling(
-        uint32_t SpotShadowSlot = static_cast<uint32_t>(EShaderSRVSlot::SRV_SpotLight), // 예시 슬롯 번호 조정
-        uint32_t PointShadowSlot = static_cast<uint32_t>(EShaderSRVSlot::SRV_PointLight), // << 추가
+        uint32_t LocalLightShadowSlot = static_cast<uint32_t>(EShaderSRVSlot::SRV_LocalLightShadowAtlas),
         uint32_t DirectionalShadowSlot = static_cast<uint32_t>(EShaderSRVSlot::SRV_DirectionalLight),
         uint32_t SamplerCmpSlot = 10, // 예시 샘플러 슬롯
         uint32_t SamplerPointSlot = 11 // 예시 샘플러 슬롯
         );
     
-    FShadowDepthRHI* GetSpotShadowDepthRHI() const { return SpotShadowDepthRHI; }
-    FShadowCubeMapArrayRHI* GetPointShadowCubeMapRHI() const { return PointShadowCubeMapRHI; } // << 추가
+    FShadowDepthRHI* GetLocalLightShadowAtlasRHI() const { return LocalLightShadowAtlasRHI; }
     FShadowDepthRHI* GetDirectionalShadowCascadeDepthRHI() const { return DirectionalShadowCascadeDepthRHI; }
 
     FMatrix GetCascadeViewProjMatrix(int Idx) const;
     uint32 GetNumCasCades() const { return NumCascades; }
     float GetCascadeSplitDistance(int Idx) const { return CascadeSplits[Idx]; }
 
-    int32 GetMaxPointLightCount() const { return MaxPointLightShadows; } 
-    int32 GetMaxSpotLightCount() const { return MaxSpotLightShadows; }
-
 private:
     
     // D3D 디바이스 및 컨텍스트
@@ -192,8 +159,7 @@ private:
     FDXDBufferManager* BufferManager = nullptr;         // 상수버퍼 바인딩 위함
 
     // 각 라이트 타입별 섀도우 리소스 RHI
-    FShadowDepthRHI* SpotShadowDepthRHI = nullptr;
-    FShadowCubeMapArrayRHI* PointShadowCubeMapRHI = nullptr; // << 추가
+    FShadowDepthRHI* LocalLightShadowAtlasRHI = nullptr; // 스팟 라이트와 포인트 라이트 면을 함께 담는 아틀라스
     FShadowDepthRHI* DirectionalShadowCascadeDepthRHI = nullptr; // 방향성 광원 섀도우 맵을 위한 Depth RHI
     //uint32 MaxDirectionalLightShadows = 1;
 
@@ -203,9 +169,27 @@ private:
     TArray<FMatrix> CascadesInvProjMatrices;    // 캐스케이드 InvProj 행렬
     TArray<float> CascadeSplits;                  // 캐스케이드 분할 거리 (NearClip ~ FarClip)
 
-    // 설정 값
-    uint32_t MaxSpotLightShadows = 16;
-    uint32_t MaxPointLightShadows = 8; // << 추가
+    // 로컬 라이트 섀도우 아틀라스 배치
+    struct FShadowView
+    {
+        FVector Location;
+        float FOV;
+        float Height;
+    };
+
+    FShadowAtlasAllocator AtlasAllocator;
+    TArray<FShadowView> ShadowViews;        // 배치에 사용하는 지난 프레임의 뷰
+    TArray<FShadowView> PendingShadowViews; // 이번 프레임에 그린 뷰
+    TArray<FShadowAtlasRequest> AtlasRequests;
+    TArray<FShadowAtlasRegion> AtlasRegions;
+    TArray<FShadowAtlasRegion> PreviousAtlasRegions;
+    TSet<uint64> ChangedRegionKeys;
+    bool bAtlasContentsLost = true;
+    bool bPendingAtlasRender = false; // 배치한 뒤 아직 아틀라스에 그리지 않음
+    FShadowAtlasStats AtlasStats;
+
+    /** 아틀라스 영역을 클리어할 때 깊이 테스트 없이 1을 쓰는 상태 */
+    ID3D11DepthStencilState* AtlasClearDepthState = nullptr;
 
 
     // 방향성 광원 뷰-프로젝션 행렬 (CSM용)
@@ -216,11 +200,8 @@ private:
     ID3D11SamplerState* ShadowPointSampler = nullptr; // 하드 섀도우 또는 VSM/ESM의 초기 샘플링용
 
     // --- Private 멤버 함수 (리소스 생성/해제 헬퍼) ---
-    bool CreateSpotShadowResources();
-    void ReleaseSpotShadowResources();
-
-    bool CreatePointShadowResources(); // << 추가
-    void ReleasePointShadowResources(); // << 추가
+    bool CreateLocalLightShadowAtlasResources();
+    void ReleaseLocalLightShadowAtlasResources();
 
     bool CreateDirectionalShadowResources();
     void ReleaseDirectionalShadowResources();
@@ -17,6 +17,7 @@
 #include "UObject/UObjectIterator.h"
 #include "Editor/PropertyEditor/ShowFlags.h"
 #include "Engine/AssetManager.h"
+#include "Engine/TextureStreamer.h"
 
 class UEditorEngine;
 class UStaticMeshComponent;
@@ -43,6 +44,7 @@ void FShadowRenderPass::PrepareRenderState()
     StaticMeshIL = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
     DepthOnlyVS = ShaderManager->GetVertexShaderByKey(L"DepthOnlyVS");
     DepthOnlyPS = ShaderManager->GetPixelShaderByKey(L"DepthOnlyPS");
+    ShadowAtlasClearVS = ShaderManager->GetVertexShaderByKey(L"ShadowAtlasClearVS");
     
     Graphics->DeviceContext->IASetInputLayout(StaticMeshIL);
     Graphics->DeviceContext->VSSetShader(DepthOnlyVS, nullptr, 0);
@@ -141,37 +143,125 @@ void FShadowRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Vie
             Graphics->DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
        
     }
+
+    ShadowManager->AddShadowView(Viewport);
+
+    // 스팟/포인트 라이트 섀도우는 뷰포트와 무관하므로 프레임마다 한 번만 그림
+    const uint64 FrameNumber = FTextureStreamer::Get().GetFrameNumber();
+    if (FrameNumber != LastLocalShadowFrame)
+    {
+        LastLocalShadowFrame = FrameNumber;
+        RenderLocalLightShadows();
+    }
+}
+
+void FShadowRenderPass::RenderLocalLightShadows()
+{
+    NumRedrawnLocalShadowFaces = 0;
+
+    CasterDescs.SetNum(0);
+    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    {
+        if (!Comp || !Comp->GetStaticMesh() || !Comp->GetStaticMesh()->GetRenderData())
+        {
+            continue;
+        }
+
+        const FBoundingBox LocalBounds = Comp->GetBoundingBox();
+        FShadowCasterDesc& Desc = CasterDescs[CasterDescs.Add(FShadowCasterDesc())];
+        Desc.Component = Comp;
+        Desc.WorldMatrix = Comp->GetWorldMatrix();
+        Desc.LocalMin = LocalBounds.MinLocation;
+        Desc.LocalMax = LocalBounds.MaxLocation;
+        Desc.SortKey = reinterpret_cast<uint64>(Comp->GetStaticMesh()->GetRenderData()->GetLOD(Comp->GetShadowLOD()));
+    }
+    CasterCache.UpdateCasters(CasterDescs);
+
     PrepareRenderState();
-    for (int Idx = 0 ; Idx < SpotLights.Num(); Idx++)
+    ShadowManager->BeginLocalLightShadowAtlasPass();
+
+    for (USpotLightComponent* SpotLight : SpotLights)
+    {
+        if (SpotLight->GetCastShadows())
+        {
+            RenderLocalLightShadowFace(FShadowManager::GetSpotLightShadowKey(SpotLight), SpotLight->GetSpotLightInfo().LightViewProj);
+        }
+    }
+
+    for (UPointLightComponent* PointLight : PointLights)
+    {
+        if (!PointLight->GetCastShadows())
+        {
+            continue;
+        }
+        const FPointLightInfo& LightInfo = PointLight->GetPointLightInfo();
+        for (int32 Face = 0; Face < 6; ++Face)
+        {
+            RenderLocalLightShadowFace(FShadowManager::GetPointLightShadowKey(PointLight, Face), LightInfo.LightViewProjs[Face]);
+        }
+    }
+
+    CasterCache.EndFrame();
+    ShadowManager->EndLocalLightShadowAtlasPass();
+}
+
+void FShadowRenderPass::RenderLocalLightShadowFace(uint64 Key, const FMatrix& ViewProj)
+{
+    const FShadowAtlasRegion Region = ShadowManager->GetLocalLightShadowRegion(Key);
+    if (!Region.IsValid())
     {
-        const auto& SpotLight = SpotLights[Idx];
-        FShadowConstantBuffer ShadowData;
-        FMatrix LightViewMatrix = SpotLight->GetViewMatrix();
-        FMatrix LightProjectionMatrix = SpotLight->GetProjectionMatrix();
-        ShadowData.ShadowViewProj = LightViewMatrix * LightProjectionMatrix;
-
-        BufferManager->UpdateConstantBuffer(TEXT("FShadowConstantBuffer"), ShadowData);
-
-        ShadowManager->BeginSpotShadowPass(Idx);
-        RenderAllStaticMeshes(Viewport);
-           
-        Graphics->DeviceContext->RSSetViewports(0, nullptr);
-        Graphics->DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
+        return;
     }
 
-    PrepareCubeMapRenderState();
-    for (int Idx = 0 ; Idx < PointLights.Num(); Idx++)
+    bool bRebuilt = false;
+    const TArray<UStaticMeshComponent*>& Casters = CasterCache.GetCasterList(Key, ViewProj, &bRebuilt);
+    if (!bRebuilt && !ShadowManager->IsLocalLightShadowRegionChanged(Key))
     {
-        
-        ShadowManager->BeginPointShadowPass(Idx);
-        RenderAllStaticMeshesForPointLight(Viewport, PointLights[Idx]);
-           
-        Graphics->DeviceContext->RSSetViewports(0, nullptr);
-        Graphics->DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
+        // 같은 캐스터가 같은 자리에 있고 아틀라스 영역도 그대로이므로 지난 깊이를 그대로 사용
+        return;
     }
-    Graphics->DeviceContext->GSSetShader(nullptr, nullptr, 0);
+
+    ShadowManager->SetLocalLightShadowViewport(Region);
+    ClearLocalLightShadowRegion();
+
+    FShadowConstantBuffer ShadowData;
+    ShadowData.ShadowViewProj = ViewProj;
+    BufferManager->UpdateConstantBuffer(TEXT("FShadowConstantBuffer"), ShadowData);
+
+    RenderCasterList(Casters);
+    ++NumRedrawnLocalShadowFaces;
 }
 
+void FShadowRenderPass::ClearLocalLightShadowRegion()
+{
+    // ClearDepthStencilView는 영역을 지정할 수 없으므로 깊이 1인 삼각형으로 뷰포트를 덮음
+    Graphics->DeviceContext->IASetInputLayout(nullptr);
+    Graphics->DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    Graphics->DeviceContext->VSSetShader(ShadowAtlasClearVS, nullptr, 0);
+    Graphics->DeviceContext->OMSetDepthStencilState(ShadowManager->AtlasClearDepthState, 0);
+    Graphics->DeviceContext->RSSetState(Graphics->RasterizerSolidBack);
+    Graphics->DeviceContext->Draw(3, 0);
+
+    Graphics->DeviceContext->IASetInputLayout(StaticMeshIL);
+    Graphics->DeviceContext->VSSetShader(DepthOnlyVS, nullptr, 0);
+    Graphics->DeviceContext->OMSetDepthStencilState(Graphics->DepthStencilState_Default, 1);
+    Graphics->DeviceContext->RSSetState(Graphics->RasterizerShadow);
+}
+
+void FShadowRenderPass::RenderCasterList(const TArray<UStaticMeshComponent*>& Casters)
+{
+    UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    for (UStaticMeshComponent* Comp : Casters)
+    {
+        const FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData()->GetLOD(Comp->GetShadowLOD());
+
+        const FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
+        const bool bIsSelected = (Engine && Engine->GetSelectedActor() == Comp->GetOwner());
+        UpdateObjectConstant(Comp->GetWorldMatrix(), UUIDColor, bIsSelected);
+
+        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+    }
+}
 
 void FShadowRenderPass::ClearRenderArr()
 {
@@ -184,7 +274,7 @@ void FShadowRenderPass::SetLightData(const TArray<class UPointLightComponent*>&
     SpotLights = InSpotLights;
 }
 
-void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int32 SelectedSubMeshIndex)
+void FShadowRenderPass::RenderPrimitive(const FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int32 SelectedSubMeshIndex)
 {
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
@@ -234,34 +324,6 @@ void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const
     }
 }
 
-void FShadowRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport)
-{
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
-    {
-        if (!Comp || !Comp->GetStaticMesh())
-        {
-            continue;
-        }
-
-        FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
-        if (RenderData == nullptr)
-        {
-            continue;
-        }
-
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
-        const bool bIsSelected = (Engine && Engine->GetSelectedActor() == Comp->GetOwner());
-
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
-
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
-        
-    }
-}
-
 void FShadowRenderPass::RenderAllStaticMeshesForCSM(const std::shared_ptr<FEditorViewportClient>& Viewport, FCascadeConstantBuffer FCasCadeData)
 {
     for (UStaticMeshComponent* Comp : StaticMeshComponents)
@@ -282,37 +344,18 @@ void FShadowRenderPass::RenderAllStaticMeshesForCSM(const std::shared_ptr<FEdito
         FCasCadeData.World = WorldMatrix;
         BufferManager->UpdateConstantBuffer(TEXT("FCascadeConstantBuffer"), FCasCadeData);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderPrimitive(RenderData->GetLOD(Comp->GetShadowLOD()), Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
 
     }
 }
 
 void FShadowRenderPass::BindResourcesForSampling()
 {
-    ShadowManager->BindResourcesForSampling(static_cast<UINT>(EShaderSRVSlot::SRV_SpotLight),
+    ShadowManager->BindResourcesForSampling(static_cast<UINT>(EShaderSRVSlot::SRV_LocalLightShadowAtlas),
         static_cast<UINT>(EShaderSRVSlot::SRV_DirectionalLight),
     10);
 }
 
-void FShadowRenderPass::RenderAllStaticMeshesForPointLight(const std::shared_ptr<FEditorViewportClient>& Viewport, UPointLightComponent*& PointLight)
-{
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
-    {
-        if (!Comp || !Comp->GetStaticMesh()) { continue; }
-
-        FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
-        if (RenderData == nullptr) { continue; }
-
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-
-        UpdateCubeMapConstantBuffer(PointLight, WorldMatrix);
-
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
-    }
-}
-
 void FShadowRenderPass::PrepareRender(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
 }
@@ -328,16 +371,10 @@ void FShadowRenderPass::CreateShader()
     {
         UE_LOG(ELogLevel::Error, TEXT("Failed to create DepthOnlyVS shader!"));
     }
-    hr = ShaderManager->AddVertexShader(L"DepthCubeMapVS", L"Shaders/DepthCubeMapVS.hlsl", "mainVS");
-    if (FAILED(hr))
-    {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to create DepthCubeMapVS shader!"));
-    }
-
-    hr = ShaderManager->AddGeometryShader(L"DepthCubeMapGS", L"Shaders/PointLightCubemapGS.hlsl", "mainGS");
+    hr = ShaderManager->AddVertexShader(L"ShadowAtlasClearVS", L"Shaders/ShadowAtlasClearVS.hlsl", "mainVS");
     if (FAILED(hr))
     {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to create DepthCubeMapGS shader!"));
+        UE_LOG(ELogLevel::Error, TEXT("Failed to create ShadowAtlasClearVS shader!"));
     }
 
     hr = ShaderManager->AddVertexShader(L"CascadedShadowMapVS", L"Shaders/CascadedShadowMap.hlsl", "mainVS");
@@ -362,62 +399,9 @@ void FShadowRenderPass::CreateShader()
     StaticMeshIL = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
     DepthOnlyVS = ShaderManager->GetVertexShaderByKey(L"DepthOnlyVS");
     DepthOnlyPS = ShaderManager->GetPixelShaderByKey(L"DepthOnlyPS");
+    ShadowAtlasClearVS = ShaderManager->GetVertexShaderByKey(L"ShadowAtlasClearVS");
 
     CascadedShadowMapVS = ShaderManager->GetVertexShaderByKey(L"CascadedShadowMapVS");
     CascadedShadowMapGS = ShaderManager->GetGeometryShaderByKey(L"CascadedShadowMapGS");
     CascadedShadowMapPS = ShaderManager->GetPixelShaderByKey(L"CascadedShadowMapPS");
 }
-
-
-void FShadowRenderPass::PrepareCubeMapRenderState()
-{
-    /*auto*& DSV = Viewport->GetViewportResource()->GetDepthStencil(EResourceType::ERT_Scene)->DSV;*/
-    // auto sm = PointLight->GetShadowMap();
-    // auto*& DSV = sm[1].DSV;
-    // Graphics->DeviceContext->ClearDepthStencilView(DSV,
-    //     D3D11_CLEAR_DEPTH, 1.0f, 0);
-    //Graphics->DeviceContext->ClearRenderTargetView(PointLight->DepthRTVArray, ClearColor);
-    //Graphics->DeviceContext->OMSetRenderTargets(1, &PointLight->DepthRTVArray, DSV);
-
-    DepthCubeMapVS = ShaderManager->GetVertexShaderByKey(L"DepthCubeMapVS");
-    DepthCubeMapGS = ShaderManager->GetGeometryShaderByKey(L"DepthCubeMapGS");
-    DepthOnlyPS = ShaderManager->GetPixelShaderByKey(L"DepthOnlyPS");
-
-    Graphics->DeviceContext->VSSetShader(DepthCubeMapVS, nullptr, 0);
-    Graphics->DeviceContext->IASetInputLayout(StaticMeshIL);
-    
-    Graphics->DeviceContext->GSSetShader(DepthCubeMapGS, nullptr, 0);
-    
-    Graphics->DeviceContext->PSSetShader(DepthOnlyPS, nullptr, 0);
-    Graphics->DeviceContext->RSSetState(Graphics->RasterizerSolidBack);
-    
-    // VS, GS에 대한 상수버퍼 업데이트
-    BufferManager->BindConstantBuffer(TEXT("FPointLightGSBuffer"), 0, EShaderStage::Geometry);
-    BufferManager->BindConstantBuffer(TEXT("FShadowConstantBuffer"), 11, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FShadowConstantBuffer"), 11, EShaderStage::Pixel);
-
-    //UpdateViewport(ShadowMapWidth, ShadowMapHeight);
-    //Graphics->DeviceContext->RSSetViewports(1, &ShadowViewport);
-}
-
-void FShadowRenderPass::UpdateCubeMapConstantBuffer(UPointLightComponent*& PointLight,
-    const FMatrix& WorldMatrix
-    ) const
-{
-    FPointLightGSBuffer DepthCubeMapBuffer;
-    DepthCubeMapBuffer.World = WorldMatrix;
-    for (int32 Idx = 0; Idx < 6; ++Idx)
-    {
-        DepthCubeMapBuffer.ViewProj[Idx] = PointLight->GetViewMatrix(Idx) * PointLight->GetProjectionMatrix();
-    }
-    BufferManager->UpdateConstantBuffer(TEXT("FPointLightGSBuffer"), DepthCubeMapBuffer);
-}
-
-void FShadowRenderPass::RenderCubeMap(const std::shared_ptr<FEditorViewportClient>& Viewport, UPointLightComponent*& PointLight)
-{
-    //UpdateCubeMapConstantBuffer(PointLight);
-    PrepareCubeMapRenderState();
-
-}
-
-
@@ -6,6 +6,7 @@
 #include "UnrealClient.h" // Depth Stencil View
 #include <d3d11.h>
 
+#include "ShadowCasterCache.h"
 #include "Components/Light/PointLightComponent.h"
 
 
@@ -13,6 +14,8 @@
 // Depth 값만을 추출하는 Vertex Shader Only 패스
 // 모든 Light에 대한 Depth Map Texture를 생성합니다.
 // ViewMode != Unlit일 때에만 Static Mesh Render Pass 에서 실행됩니다
+// 방향성 광원 CSM은 뷰포트마다, 스팟/포인트 라이트는 프레임마다 한 번 섀도우 아틀라스의 각자 영역에 그립니다.
+// 스팟/포인트 라이트 면은 FShadowCasterCache의 캐스터 목록이 그대로이고 영역도 그대로라면 다시 그리지 않습니다.
 
 struct FStaticMeshRenderData;
 class FDXDBufferManager;
@@ -27,9 +30,6 @@ public:
     virtual ~FShadowRenderPass() override = default;
     
     void CreateShader();
-    void PrepareCubeMapRenderState();
-    void UpdateCubeMapConstantBuffer(UPointLightComponent*& PointLight, const FMatrix& WorldMatrix) const;
-    void RenderCubeMap(const std::shared_ptr<FEditorViewportClient>& Viewport, UPointLightComponent*& PointLight);
     void SetLightData(const TArray<class UPointLightComponent*>& InPointLights, const TArray<class USpotLightComponent*>& InSpotLights);
 
     virtual void Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager) override;
@@ -42,32 +42,49 @@ public:
     virtual void Render(const std::shared_ptr<FEditorViewportClient>& Viewport) override;    
     virtual void ClearRenderArr() override;
 
-    void RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int32 SelectedSubMeshIndex);
-    virtual void RenderAllStaticMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport);
+    void RenderPrimitive(const FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int32 SelectedSubMeshIndex);
     void RenderAllStaticMeshesForCSM(const std::shared_ptr<FEditorViewportClient>& Viewport,
                                      FCascadeConstantBuffer FCasCadeData);
     void BindResourcesForSampling();
 
-    void RenderAllStaticMeshesForPointLight(const std::shared_ptr<FEditorViewportClient>& Viewport, UPointLightComponent*& PointLight);
+    const FShadowCasterCacheStats& GetCasterCacheStats() const { return CasterCache.GetStats(); }
+
+    /** 마지막 프레임에 실제로 다시 그린 스팟/포인트 라이트 면 수 */
+    int32 GetNumRedrawnLocalShadowFaces() const { return NumRedrawnLocalShadowFaces; }
 
 protected:
     virtual void PrepareRender(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
     virtual void CleanUpRender(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
     
 private:
+    /** 스팟 라이트와 포인트 라이트 면을 아틀라스에 그림, 프레임마다 한 번 */
+    void RenderLocalLightShadows();
+
+    /** Key 면의 캐스터 목록을 받아서 목록이 바뀌었거나 영역이 바뀌었을 때만 영역을 비우고 다시 그림 */
+    void RenderLocalLightShadowFace(uint64 Key, const FMatrix& ViewProj);
+
+    /** 현재 뷰포트로 지정한 아틀라스 영역을 깊이 1로 덮음 */
+    void ClearLocalLightShadowRegion();
+
+    void RenderCasterList(const TArray<UStaticMeshComponent*>& Casters);
+
     TArray<class UStaticMeshComponent*> StaticMeshComponents;
     TArray<UPointLightComponent*> PointLights;
     TArray<USpotLightComponent*> SpotLights;
     
     FShadowManager* ShadowManager;
 
+    FShadowCasterCache CasterCache;
+    TArray<FShadowCasterDesc> CasterDescs;
+    uint64 LastLocalShadowFrame = UINT64_MAX;
+    int32 NumRedrawnLocalShadowFaces = 0;
+
     ID3D11InputLayout* StaticMeshIL;
     ID3D11VertexShader* DepthOnlyVS;
     ID3D11PixelShader* DepthOnlyPS;
     ID3D11SamplerState* Sampler;
 
-    ID3D11VertexShader* DepthCubeMapVS;
-    ID3D11GeometryShader* DepthCubeMapGS;
+    ID3D11VertexShader* ShadowAtlasClearVS;
 
 
     ID3D11VertexShader* CascadedShadowMapVS;
@@ -41,24 +41,13 @@ void FTileLightCullingPass::Initialize(FDXDBufferManager* InBufferManager, FGrap
 
 void FTileLightCullingPass::PrepareRenderArr()
 {
-    for (const auto Iter : TObjectRange<ULightComponentBase>())
-    {
-        if (Iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(Iter))
-            {
-                PointLights.Add(PointLight);
-            }
-            else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(Iter))
-            {
-                SpotLight->GetDirection();
-                SpotLights.Add(SpotLight);
-            }
-            // [주의] : Directional Light에 대한 CasCade Shadow Map을 만들 때에 아래 View,Proj 갱신을 전제
-            Iter->UpdateViewMatrix();
-            Iter->UpdateProjectionMatrix();
-        }
-    }
+    // 라이트 수집과 View, Proj 갱신은 FUpdateLightBufferPass에서 함
+}
+
+void FTileLightCullingPass::SetLightData(const TArray<UPointLightComponent*>& InPointLights, const TArray<USpotLightComponent*>& InSpotLights)
+{
+    PointLights = InPointLights;
+    SpotLights = InSpotLights;
 
     CreatePointLightBufferGPU();
     CreateSpotLightBufferGPU();
@@ -74,7 +63,6 @@ void FTileLightCullingPass::ClearRenderArr()
 
 void FTileLightCullingPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
-    Graphics->DeviceContext->PSSetConstantBuffers(8, 1, &TileLightConstantBuffer);
     UpdateTileLightConstantBuffer(Viewport);
     
     DepthSRV = Viewport->GetViewportResource()->GetDepthStencil(EResourceType::ERT_Debug)->SRV;
@@ -58,6 +58,9 @@ public:
     virtual void ClearRenderArr() override;
     virtual void Render(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
 
+    /** 라이팅에는 CPU 클러스터 결과를 쓰고, 이 패스는 히트맵 디버그 표시에만 사용 */
+    void SetLightData(const TArray<UPointLightComponent*>& InPointLights, const TArray<USpotLightComponent*>& InSpotLights);
+
     void CreateShader();
     void CreatePointLightBufferGPU();
     void CreateSpotLightBufferGPU();
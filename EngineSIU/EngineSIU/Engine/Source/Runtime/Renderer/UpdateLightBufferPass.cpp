@@ -3,7 +3,9 @@
 #include "UpdateLightBufferPass.h"
 
 #include <algorithm>
+#include <cstring>
 #include <utility>
+#include "ShadowManager.h"
 #include "D3D11RHI/DXDBufferManager.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "D3D11RHI/DXDShaderManager.h"
@@ -13,36 +15,63 @@
 #include "Components/Light/DirectionalLightComponent.h"
 #include "Components/Light/AmbientLightComponent.h"
 #include "Engine/EditorEngine.h"
+#include "Engine/TextureStreamer.h"
 #include "GameFramework/Actor.h"
 #include "UObject/UObjectIterator.h"
-#include "TileLightCullingPass.h"
+#include "UnrealEd/EditorViewportClient.h"
 
 void FUpdateLightBufferPass::Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager)
 {
     FRenderPassBase::Initialize(InBufferManager, InGraphics, InShaderManager);
 
     CreatePointLightBuffer();
-    CreatePointLightPerTilesBuffer();
     CreateSpotLightBuffer();
-    CreateSpotLightPerTilesBuffer();
+    CreateLightClusterBuffers();
+}
+
+void FUpdateLightBufferPass::InitializeShadowManager(FShadowManager* InShadowManager)
+{
+    ShadowManager = InShadowManager;
 }
 
 void FUpdateLightBufferPass::PrepareRenderArr()
 {
+    // 뷰포트마다 호출되지만 라이트는 뷰포트와 무관하므로 프레임마다 한 번만 모음
+    const uint64 FrameNumber = FTextureStreamer::Get().GetFrameNumber();
+    if (FrameNumber == LastPreparedFrame)
+    {
+        return;
+    }
+    LastPreparedFrame = FrameNumber;
+
+    PointLights.SetNum(0);
+    SpotLights.SetNum(0);
+    DirectionalLights.SetNum(0);
+    AmbientLights.SetNum(0);
+
     for (const auto Iter : TObjectRange<ULightComponentBase>())
     {
         if (Iter->GetWorld() == GEngine->ActiveWorld)
         {
             if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(Iter))
             {
-                //PointLights.Add(PointLight); // 당분간 UnUsed : Structured Buffer로 전달
+                if (std::cmp_less(PointLights.Num(), MAX_NUM_POINTLIGHTS))
+                {
+                    PointLights.Add(PointLight);
+                }
             }
             else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(Iter))
             {
-                //SpotLights.Add(SpotLight); // UnUsed : Structured Buffer로 전달
+                if (std::cmp_less(SpotLights.Num(), MAX_NUM_SPOTLIGHTS))
+                {
+                    SpotLights.Add(SpotLight);
+                }
             }
             else if (UDirectionalLightComponent* DirectionalLight = Cast<UDirectionalLightComponent>(Iter))
             {
+                // [주의] : Directional Light에 대한 CasCade Shadow Map을 만들 때에 아래 View,Proj 갱신을 전제
+                DirectionalLight->UpdateViewMatrix();
+                DirectionalLight->UpdateProjectionMatrix();
                 DirectionalLights.Add(DirectionalLight);
             }
             else if (UAmbientLightComponent* AmbientLight = Cast<UAmbientLightComponent>(Iter))
@@ -51,26 +80,48 @@ void FUpdateLightBufferPass::PrepareRenderArr()
             }
         }
     }
+
+    if (ShadowManager)
+    {
+        ShadowManager->AllocateLocalLightShadows(PointLights, SpotLights);
+    }
+
+    // 포인트, 스팟 라이트의 View, Proj 갱신은 바뀐 라이트에 대해서만 패킹하면서 함
+    UpdatePointLightBuffer();
+    UpdateSpotLightBuffer();
+
+    ClusterPointLights.SetNum(PackedPointLights.Num());
+    for (int32 Index = 0; Index < PackedPointLights.Num(); ++Index)
+    {
+        ClusterPointLights[Index] = { PackedPointLights[Index].Position, PackedPointLights[Index].Radius };
+    }
+
+    ClusterSpotLights.SetNum(PackedSpotLights.Num());
+    for (int32 Index = 0; Index < PackedSpotLights.Num(); ++Index)
+    {
+        const FSpotLightInfo& LightInfo = PackedSpotLights[Index];
+        ClusterSpotLights[Index] = { LightInfo.Position, LightInfo.Radius, LightInfo.Direction, LightInfo.OuterRad };
+    }
 }
 
 void FUpdateLightBufferPass::ClearRenderArr()
 {
-    PointLights.Empty();
-    SpotLights.Empty();
-    DirectionalLights.Empty();
-    AmbientLights.Empty();
+    // 다음 뷰포트에서도 같은 라이트를 쓰므로 비우지 않음, PrepareRenderArr에서 프레임이 바뀌면 다시 모음
 }
 
 void FUpdateLightBufferPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
     UpdateLightBuffer();
+    UpdateLightClusters(Viewport);
 
     // 전역 조명 리스트
     Graphics->DeviceContext->PSSetShaderResources(10, 1, &PointLightSRV);
     Graphics->DeviceContext->PSSetShaderResources(11, 1, &SpotLightSRV);
-    // 타일별 조명 인덱스 리스트
-    Graphics->DeviceContext->PSSetShaderResources(12, 1, &PointLightIndexBufferSRV);
-    Graphics->DeviceContext->PSSetShaderResources(13, 1, &SpotLightIndexBufferSRV);
+    // 클러스터별 조명 인덱스 리스트
+    Graphics->DeviceContext->PSSetShaderResources(12, 1, &LightClusterRangeSRV);
+    Graphics->DeviceContext->PSSetShaderResources(13, 1, &LightClusterIndexSRV);
+
+    BufferManager->BindConstantBuffer(TEXT("FLightClusterConstants"), 6, EShaderStage::Pixel);
 }
 
 
@@ -82,7 +133,7 @@ void FUpdateLightBufferPass::UpdateLightBuffer() const
     int PointLightsCount=0;
     int SpotLightsCount=0;
     int AmbientLightsCount=0;
-    
+
     for (auto Light : SpotLights)
     {
         if (SpotLightsCount < MAX_SPOT_LIGHT)
@@ -114,10 +165,10 @@ void FUpdateLightBufferPass::UpdateLightBuffer() const
             LightBufferData.Directional[DirectionalLightsCount].LightInvProj = FMatrix::Inverse(Light->GetProjectionMatrix());
             //ShadowData.LightNearZ = Light->GetShadowNearPlane();
             //ShadowData.LightFrustumWidth = Light->GetShadowFrustumWidth();
-                        
+
             //ShadowData.ShadowMapWidth = Light->GetShadowMapWidth();
             //ShadowData.ShadowMapHeight = Light->GetShadowMapHeight();
-           
+
             DirectionalLightsCount++;
         }
     }
@@ -131,83 +182,14 @@ void FUpdateLightBufferPass::UpdateLightBuffer() const
             AmbientLightsCount++;
         }
     }
-    
+
     LightBufferData.DirectionalLightsCount = DirectionalLightsCount;
     LightBufferData.PointLightsCount = PointLightsCount;
     LightBufferData.SpotLightsCount = SpotLightsCount;
     LightBufferData.AmbientLightsCount = AmbientLightsCount;
 
     BufferManager->UpdateConstantBuffer(TEXT("FLightInfoBuffer"), LightBufferData);
-    
-}
-
-void FUpdateLightBufferPass::SetPointLightData(
-    const TArray<UPointLightComponent*>& InPointLights, TArray<TArray<uint32>> InPointLightPerTiles)
-{
-    PointLights = InPointLights; 
-    PointLightPerTiles = InPointLightPerTiles;
-
-    uint32 TotalTiles = PointLightPerTiles.Num();
-    GPointLightPerTiles.Empty();
-    GPointLightPerTiles.SetNum(TotalTiles);
 
-    for (uint32 TileIndex = 0; TileIndex < TotalTiles; ++TileIndex)
-    {
-        const TArray<uint32>& TileLightList = InPointLightPerTiles[TileIndex];
-        PointLightPerTile TileData = {};
-        TileData.NumLights = TileLightList.Num();
-        TileData.NumLights = FMath::Min<uint32>(TileData.NumLights, MAX_POINTLIGHT_PER_TILE);
-
-        // 각 조명 인덱스를 TileData.Indice 배열에 복사합니다.
-        for (uint32 Idx = 0; Idx < TileData.NumLights; ++Idx)
-        {
-            TileData.Indices[Idx] = TileLightList[Idx];
-        }
-        GPointLightPerTiles[TileIndex] = TileData;
-    }
-
-    UpdatePointLightBuffer();
-    UpdatePointLightPerTilesBuffer();
-}
-
-void FUpdateLightBufferPass::SetSpotLightData(const TArray<USpotLightComponent*>& InSpotLights, TArray<TArray<uint32>> InSpotLightPerTiles)
-{
-    SpotLights = InSpotLights;
-    SpotLightPerTiles = InSpotLightPerTiles;
-
-    uint32 TotalTiles = SpotLightPerTiles.Num();
-    GSpotLightPerTiles.Empty();
-    GSpotLightPerTiles.SetNum(TotalTiles);
-
-    for (uint32 TileIndex = 0; TileIndex < TotalTiles; ++TileIndex)
-    {
-        const TArray<uint32>& TileLightList = InSpotLightPerTiles[TileIndex];
-        SpotLightPerTile TileData = {};
-        TileData.NumLights = TileLightList.Num();
-        TileData.NumLights = FMath::Min<uint32>(TileData.NumLights, MAX_SPOTLIGHT_PER_TILE);
-
-        // 각 조명 인덱스를 TileData.Indice 배열에 복사합니다.
-        for (uint32 i = 0; i < TileData.NumLights; ++i)
-        {
-            TileData.Indices[i] = TileLightList[i];
-        }
-        GSpotLightPerTiles[TileIndex] = TileData;
-    }
-
-    UpdateSpotLightBuffer();
-    UpdateSpotLightPerTilesBuffer();
-}
-
-void FUpdateLightBufferPass::SetLightData(const TArray<UPointLightComponent*>& InPointLights, const TArray<USpotLightComponent*>& InSpotLights,
-    ID3D11ShaderResourceView* InPointLightIndexBufferSRV, ID3D11ShaderResourceView* InSpotLightIndexBufferSRV)
-{
-    PointLights = InPointLights;
-    SpotLights = InSpotLights;
-    PointLightIndexBufferSRV = InPointLightIndexBufferSRV;
-    SpotLightIndexBufferSRV = InSpotLightIndexBufferSRV;
-
-    UpdatePointLightBuffer();
-    UpdateSpotLightBuffer();
 }
 
 void FUpdateLightBufferPass::CreatePointLightBuffer()
@@ -263,145 +245,228 @@ void FUpdateLightBufferPass::CreateSpotLightBuffer()
     }
 }
 
-void FUpdateLightBufferPass::CreatePointLightPerTilesBuffer()
-{    
+void FUpdateLightBufferPass::CreateLightClusterBuffers()
+{
+    // 클러스터 수는 설정으로 고정이므로 Offset/Count 버퍼는 한 번만 만듦
+    const FLightClusterSettings& Settings = ClusterBuilder.GetSettings();
+    const uint32 NumClusters = Settings.CountX * Settings.CountY * Settings.CountZ;
+
     D3D11_BUFFER_DESC Desc = {};
     Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    Desc.ByteWidth = sizeof(PointLightPerTile) * MAX_TILE;
-    Desc.Usage = D3D11_USAGE_DEFAULT;
+    Desc.ByteWidth = sizeof(FLightClusterRange) * NumClusters;
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
     Desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-    Desc.StructureByteStride = sizeof(PointLightPerTile);       // 타일당 라이트 : 기존 1024에서 256으로 변경
-
-    /* D3D11_SUBRESOURCE_DATA initData = {};
-     initData.pSysMem = GPointLightPerTiles.GetData();*/
-
-    HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &PointLightPerTilesBuffer);
+    Desc.StructureByteStride = sizeof(FLightClusterRange);
+    HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &LightClusterRangeBuffer);
     if (FAILED(hr))
     {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to create PointLightPerTilesBuffer"));
+        UE_LOG(ELogLevel::Error, TEXT("Failed to create LightClusterRangeBuffer"));
     }
 
     D3D11_SHADER_RESOURCE_VIEW_DESC SrvDesc = {};
     SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
     SrvDesc.Format = DXGI_FORMAT_UNKNOWN;
     SrvDesc.Buffer.FirstElement = 0;
-    SrvDesc.Buffer.NumElements = MAX_TILE;
-
-    hr = Graphics->Device->CreateShaderResourceView(PointLightPerTilesBuffer, &SrvDesc, &PointLightPerTilesSRV);
+    SrvDesc.Buffer.NumElements = NumClusters;
+    hr = Graphics->Device->CreateShaderResourceView(LightClusterRangeBuffer, &SrvDesc, &LightClusterRangeSRV);
     if (FAILED(hr))
     {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to create PointLightPerTiles SRV"));
+        UE_LOG(ELogLevel::Error, TEXT("Failed to create LightClusterRange SRV"));
     }
+
+    CreateLightClusterIndexBuffer(INITIAL_CLUSTER_INDEX_CAPACITY);
 }
 
-void FUpdateLightBufferPass::CreateSpotLightPerTilesBuffer()
+bool FUpdateLightBufferPass::CreateLightClusterIndexBuffer(uint32 NumIndices)
 {
+    if (LightClusterIndexSRV)
+    {
+        LightClusterIndexSRV->Release();
+        LightClusterIndexSRV = nullptr;
+    }
+    if (LightClusterIndexBuffer)
+    {
+        LightClusterIndexBuffer->Release();
+        LightClusterIndexBuffer = nullptr;
+    }
+    LightClusterIndexCapacity = 0;
+
     D3D11_BUFFER_DESC Desc = {};
     Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    Desc.ByteWidth = sizeof(SpotLightPerTile) * MAX_TILE;
-    Desc.Usage = D3D11_USAGE_DEFAULT;
+    Desc.ByteWidth = sizeof(uint32) * NumIndices;
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
     Desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-    Desc.StructureByteStride = sizeof(SpotLightPerTile);       // 타일당 라이트 : 기존 1024에서 256으로 변경
-
-    HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &SpotLightPerTilesBuffer);
+    Desc.StructureByteStride = sizeof(uint32);
+    HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &LightClusterIndexBuffer);
     if (FAILED(hr))
     {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to create SpotLightPerTilesBuffer"));
+        UE_LOG(ELogLevel::Error, TEXT("Failed to create LightClusterIndexBuffer"));
+        return false;
     }
+
     D3D11_SHADER_RESOURCE_VIEW_DESC SrvDesc = {};
     SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
     SrvDesc.Format = DXGI_FORMAT_UNKNOWN;
     SrvDesc.Buffer.FirstElement = 0;
-    SrvDesc.Buffer.NumElements = MAX_TILE;
-    hr = Graphics->Device->CreateShaderResourceView(SpotLightPerTilesBuffer, &SrvDesc, &SpotLightPerTilesSRV);
+    SrvDesc.Buffer.NumElements = NumIndices;
+    hr = Graphics->Device->CreateShaderResourceView(LightClusterIndexBuffer, &SrvDesc, &LightClusterIndexSRV);
     if (FAILED(hr))
     {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to create SpotLightPerTiles SRV"));
+        UE_LOG(ELogLevel::Error, TEXT("Failed to create LightClusterIndex SRV"));
+        return false;
     }
+
+    LightClusterIndexCapacity = NumIndices;
+    return true;
 }
 
 void FUpdateLightBufferPass::UpdatePointLightBuffer()
 {
-    if (PointLights.Num() == 0 || !PointLightBuffer)
-    {
-        return;
-    }
+    DirtyLightIndices.SetNum(0);
+    PackedPointLights.SetNum(PointLights.Num());
+    PointLightStates.SetNum(PointLights.Num());
 
-    TArray<FPointLightInfo> TempBuffer;
-    TempBuffer.SetNum(MAX_NUM_POINTLIGHTS);
     for (uint32 LightIdx = 0; std::cmp_less(LightIdx, PointLights.Num()); ++LightIdx)
     {
-        FPointLightInfo& LightInfo = PointLights[LightIdx]->GetPointLightInfo();
-        LightInfo.Position = PointLights[LightIdx]->GetComponentLocation();
+        UPointLightComponent* PointLight = PointLights[LightIdx];
+        FPointLightInfo& LightInfo = PointLight->GetPointLightInfo();
+        FPackedLightState& State = PointLightStates[LightIdx];
+        const FVector Location = PointLight->GetComponentLocation();
+
+        // 패킹 결과를 컴포넌트에도 써 두므로, 그 뒤로 컴포넌트나 속성이 바뀌지 않았다면 그대로 둠
+        if (State.Component == PointLight && State.Location == Location
+            && std::memcmp(&LightInfo, &PackedPointLights[LightIdx], sizeof(FPointLightInfo)) == 0)
+        {
+            continue;
+        }
+
+        PointLight->UpdateViewMatrix();
+        PointLight->UpdateProjectionMatrix();
+
+        LightInfo.Position = Location;
         for (int ProjectionIndex = 0; ProjectionIndex < 6; ++ProjectionIndex)
         {
-            LightInfo.LightViewProjs[ProjectionIndex] = PointLights[LightIdx]->GetViewProjectionMatrix(ProjectionIndex);
+            LightInfo.LightViewProjs[ProjectionIndex] = PointLight->GetViewProjectionMatrix(ProjectionIndex);
         }
-        LightInfo.ShadowMapArrayIndex = LightIdx;
         LightInfo.ShadowBias = 0.005f;
-        TempBuffer[LightIdx] = LightInfo;
+
+        PackedPointLights[LightIdx] = LightInfo;
+        State.Component = PointLight;
+        State.Location = Location;
+        DirtyLightIndices.Add(LightIdx);
     }
-    // 이제 TempBuffer에 대해 업데이트
-    Graphics->DeviceContext->UpdateSubresource(PointLightBuffer, 0, nullptr,
-        TempBuffer.GetData(), 0, 0);
+
+    UploadDirtyLightRanges(PointLightBuffer, PackedPointLights.GetData(), sizeof(FPointLightInfo), DirtyLightIndices);
 }
- 
+
 void FUpdateLightBufferPass::UpdateSpotLightBuffer()
 {
-    if (SpotLights.Num() == 0 || !SpotLightBuffer)
-    {
-        return;
-    }
-    TArray<FSpotLightInfo> TempBuffer;
-    TempBuffer.SetNum(MAX_NUM_SPOTLIGHTS);
+    DirtyLightIndices.SetNum(0);
+    PackedSpotLights.SetNum(SpotLights.Num());
+    SpotLightStates.SetNum(SpotLights.Num());
+
     for (uint32 Idx = 0; std::cmp_less(Idx, SpotLights.Num()); ++Idx)
     {
-        FSpotLightInfo& LightInfo = SpotLights[Idx]->GetSpotLightInfo();
-        LightInfo.Position = SpotLights[Idx]->GetComponentLocation();
-        LightInfo.Direction = SpotLights[Idx]->GetDirection();
-        LightInfo.LightViewProj = SpotLights[Idx]->GetViewMatrix() * SpotLights[Idx]->GetProjectionMatrix();
-        LightInfo.ShadowMapArrayIndex = Idx;
+        USpotLightComponent* SpotLight = SpotLights[Idx];
+        FSpotLightInfo& LightInfo = SpotLight->GetSpotLightInfo();
+        FPackedLightState& State = SpotLightStates[Idx];
+        const FVector Location = SpotLight->GetComponentLocation();
+        // 섀도우 View 행렬은 Roll까지 반영하므로 방향이 아니라 회전을 비교
+        const FRotator Rotation = SpotLight->GetComponentRotation();
+
+        if (State.Component == SpotLight && State.Location == Location && State.Rotation == Rotation
+            && std::memcmp(&LightInfo, &PackedSpotLights[Idx], sizeof(FSpotLightInfo)) == 0)
+        {
+            continue;
+        }
+
+        SpotLight->UpdateViewMatrix();
+        SpotLight->UpdateProjectionMatrix();
+
+        LightInfo.Position = Location;
+        LightInfo.Direction = SpotLight->GetDirection();
+        LightInfo.LightViewProj = SpotLight->GetViewMatrix() * SpotLight->GetProjectionMatrix();
         LightInfo.ShadowBias = 0.005f;
-        TempBuffer[Idx] = LightInfo;
+
+        PackedSpotLights[Idx] = LightInfo;
+        State.Component = SpotLight;
+        State.Location = Location;
+        State.Rotation = Rotation;
+        DirtyLightIndices.Add(Idx);
     }
-    // 이제 TempBuffer에 대해 업데이트
-    Graphics->DeviceContext->UpdateSubresource(SpotLightBuffer, 0, nullptr,
-        TempBuffer.GetData(), 0, 0);
+
+    UploadDirtyLightRanges(SpotLightBuffer, PackedSpotLights.GetData(), sizeof(FSpotLightInfo), DirtyLightIndices);
 }
 
-void FUpdateLightBufferPass::UpdatePointLightPerTilesBuffer()
+void FUpdateLightBufferPass::UploadDirtyLightRanges(ID3D11Buffer* Buffer, const void* Data, uint32 Stride, const TArray<uint32>& DirtyIndices) const
 {
-    if (GPointLightPerTiles.Num() == 0 || !PointLightPerTilesBuffer)
+    if (!Buffer)
     {
         return;
     }
 
-    TArray<PointLightPerTile> TempBuffer;
-    TempBuffer.SetNum(MAX_TILE);
-    for (uint32 Idx = 0; std::cmp_less(Idx, GPointLightPerTiles.Num()); ++Idx)
+    for (int32 First = 0; First < DirtyIndices.Num();)
     {
-        TempBuffer[Idx] = GPointLightPerTiles[Idx];
+        int32 Last = First;
+        while (Last + 1 < DirtyIndices.Num() && DirtyIndices[Last + 1] - DirtyIndices[Last] <= DIRTY_RANGE_MERGE_GAP)
+        {
+            ++Last;
+        }
+
+        D3D11_BOX Box = {};
+        Box.left = DirtyIndices[First] * Stride;
+        Box.right = (DirtyIndices[Last] + 1) * Stride;
+        Box.top = 0;
+        Box.bottom = 1;
+        Box.front = 0;
+        Box.back = 1;
+        Graphics->DeviceContext->UpdateSubresource(Buffer, 0, &Box, static_cast<const uint8*>(Data) + Box.left, 0, 0);
+
+        First = Last + 1;
     }
-    // 이제 TempBuffer에 대해 업데이트
-    Graphics->DeviceContext->UpdateSubresource(PointLightPerTilesBuffer, 0, nullptr,
-        TempBuffer.GetData(), 0, 0);
 }
 
-void FUpdateLightBufferPass::UpdateSpotLightPerTilesBuffer()
+void FUpdateLightBufferPass::UpdateLightClusters(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
-    if (GSpotLightPerTiles.Num() == 0 || !SpotLightPerTilesBuffer)
+    const FLightClusterView View = FLightClusterView::Make(
+        Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(),
+        Viewport->GetCameraNearClip(), Viewport->GetCameraFarClip(), Viewport->IsOrthographic()
+    );
+    ClusterBuilder.Build(View, ClusterPointLights, ClusterSpotLights, ClusterGrid);
+
+    D3D11_MAPPED_SUBRESOURCE MSR;
+    if (LightClusterRangeBuffer && SUCCEEDED(Graphics->DeviceContext->Map(LightClusterRangeBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR)))
     {
-        return;
+        memcpy(MSR.pData, ClusterGrid.Ranges.GetData(), sizeof(FLightClusterRange) * ClusterGrid.Ranges.Num());
+        Graphics->DeviceContext->Unmap(LightClusterRangeBuffer, 0);
+    }
+
+    const uint32 NumIndices = static_cast<uint32>(ClusterGrid.LightIndices.Num());
+    if (NumIndices > LightClusterIndexCapacity)
+    {
+        CreateLightClusterIndexBuffer(std::max(NumIndices, LightClusterIndexCapacity * 2));
     }
-    TArray<SpotLightPerTile> TempBuffer;
-    TempBuffer.SetNum(MAX_TILE);
-    for (uint32 Idx = 0; std::cmp_less(Idx, GSpotLightPerTiles.Num()); ++Idx)
+    if (NumIndices > 0 && NumIndices <= LightClusterIndexCapacity
+        && SUCCEEDED(Graphics->DeviceContext->Map(LightClusterIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR)))
     {
-        TempBuffer[Idx] = GSpotLightPerTiles[Idx];
+        memcpy(MSR.pData, ClusterGrid.LightIndices.GetData(), sizeof(uint32) * NumIndices);
+        Graphics->DeviceContext->Unmap(LightClusterIndexBuffer, 0);
     }
-    // 이제 TempBuffer에 대해 업데이트
-    Graphics->DeviceContext->UpdateSubresource(SpotLightPerTilesBuffer, 0, nullptr,
-        TempBuffer.GetData(), 0, 0);
+
+    const D3D11_VIEWPORT& D3DViewport = Viewport->GetD3DViewport();
+
+    FLightClusterConstants ClusterConstants = {};
+    ClusterConstants.ClusterCountX = ClusterGrid.CountX;
+    ClusterConstants.ClusterCountY = ClusterGrid.CountY;
+    ClusterConstants.ClusterCountZ = ClusterGrid.CountZ;
+    ClusterConstants.bOrthographic = ClusterGrid.bOrthographic ? 1 : 0;
+    ClusterConstants.ZSliceScale = ClusterGrid.ZSliceScale;
+    ClusterConstants.ZSliceBias = ClusterGrid.ZSliceBias;
+    ClusterConstants.ViewportOffset = FVector2D(D3DViewport.TopLeftX, D3DViewport.TopLeftY);
+    ClusterConstants.ViewportSize = FVector2D(D3DViewport.Width, D3DViewport.Height);
+    BufferManager->UpdateConstantBuffer(TEXT("FLightClusterConstants"), ClusterConstants);
 }
 
 void FUpdateLightBufferPass::PrepareRender(const std::shared_ptr<FEditorViewportClient>& Viewport)
@@ -2,33 +2,30 @@
 
 #include "RenderPassBase.h"
 #include "EngineBaseTypes.h"
+#include "LightClusterBuilder.h"
 #include "Container/Set.h"
 #include "Define.h"
-
-#define MAX_POINTLIGHT_PER_TILE 256
-#define MAX_SPOTLIGHT_PER_TILE 256
+#include "Math/Rotator.h"
 
 class FDXDShaderManager;
+class FShadowManager;
 class UWorld;
 class FEditorViewportClient;
 
+class ULightComponentBase;
 class UPointLightComponent;
 class USpotLightComponent;
 class UDirectionalLightComponent;
 class UAmbientLightComponent;
 
-struct PointLightPerTile {
-    uint32 NumLights;
-    uint32 Indices[MAX_POINTLIGHT_PER_TILE];
-    uint32 Padding[3];
-};
-
-struct SpotLightPerTile {
-    uint32 NumLights;
-    uint32 Indices[MAX_SPOTLIGHT_PER_TILE];
-    uint32 Padding[3];
-};
-
+/**
+ * 라이트를 모아 GPU 버퍼에 올리고, 뷰포트마다 클러스터별 라이트 목록을 만들어 바인딩
+ *
+ * - 라이트 수집과 패킹은 뷰포트 수와 관계없이 프레임마다 한 번
+ * - 지난 프레임과 같은 라이트는 다시 패킹하지 않고, 바뀐 라이트가 있는 구간만 UpdateSubresource로 올림
+ * - 클러스터 배정은 FLightClusterBuilder로 CPU에서 하고 Offset/Count와 인덱스 목록을 t12, t13에 바인딩
+ * - 패킹 전에 FShadowManager가 섀도우 아틀라스 영역을 라이트 정보에 기록하므로 영역이 바뀐 라이트도 다시 올라감
+ */
 class FUpdateLightBufferPass : public FRenderPassBase
 {
 public:
@@ -36,59 +33,83 @@ public:
     virtual ~FUpdateLightBufferPass() override = default;
 
     virtual void Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager) override;
+    void InitializeShadowManager(FShadowManager* InShadowManager);
     virtual void PrepareRenderArr() override;
     virtual void ClearRenderArr() override;
     virtual void Render(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
     void UpdateLightBuffer() const;
 
-    void SetPointLightData(const TArray<UPointLightComponent*>& InPointLights, TArray<TArray<uint32>> InPointLightPerTiles);
-    void SetSpotLightData(const TArray<USpotLightComponent*>& InSpotLights, TArray<TArray<uint32>> InSpotLightPerTiles);
-    void SetLightData(const TArray<UPointLightComponent*>& InPointLights, const TArray<USpotLightComponent*>& InSpotLights, ID3D11ShaderResourceView* InPointLightIndexBufferSRV, ID3D11ShaderResourceView* InSpotLightIndexBufferSRV);
+    const TArray<UPointLightComponent*>& GetPointLights() const { return PointLights; }
+    const TArray<USpotLightComponent*>& GetSpotLights() const { return SpotLights; }
+
+    const FLightClusterGrid& GetLightClusterGrid() const { return ClusterGrid; }
 
     void CreatePointLightBuffer();
     void CreateSpotLightBuffer();
-
-    void CreatePointLightPerTilesBuffer();
-    void CreateSpotLightPerTilesBuffer();
+    void CreateLightClusterBuffers();
 
     void UpdatePointLightBuffer();
     void UpdateSpotLightBuffer();
 
-    void UpdatePointLightPerTilesBuffer();
-    void UpdateSpotLightPerTilesBuffer();
+    void UpdateLightClusters(const std::shared_ptr<FEditorViewportClient>& Viewport);
 
 protected:
     virtual void PrepareRender(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
     virtual void CleanUpRender(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
 
 private:
+    /** 마지막으로 패킹했을 때의 라이트 상태, 이 상태와 패킹 결과가 그대로면 다시 패킹하지 않음 */
+    struct FPackedLightState
+    {
+        const ULightComponentBase* Component = nullptr;
+        FVector Location;
+        FRotator Rotation;
+    };
+
+    /** 정렬된 DirtyIndices를 가까운 것끼리 묶어서 Buffer의 해당 구간만 갱신 */
+    void UploadDirtyLightRanges(ID3D11Buffer* Buffer, const void* Data, uint32 Stride, const TArray<uint32>& DirtyIndices) const;
+
+    bool CreateLightClusterIndexBuffer(uint32 NumIndices);
+
+    uint64 LastPreparedFrame = UINT64_MAX;
+
+    FShadowManager* ShadowManager = nullptr;
+
     TArray<USpotLightComponent*> SpotLights;
     TArray<UPointLightComponent*> PointLights;
     TArray<UDirectionalLightComponent*> DirectionalLights;
     TArray<UAmbientLightComponent*> AmbientLights;
 
-    TArray<TArray<uint32>> PointLightPerTiles;
-    TArray<PointLightPerTile> GPointLightPerTiles;
+    /** GPU 버퍼와 같은 내용의 CPU 사본 */
+    TArray<FPointLightInfo> PackedPointLights;
+    TArray<FSpotLightInfo> PackedSpotLights;
+    TArray<FPackedLightState> PointLightStates;
+    TArray<FPackedLightState> SpotLightStates;
+    TArray<uint32> DirtyLightIndices;
 
-    TArray<TArray<uint32>> SpotLightPerTiles;
-    TArray<SpotLightPerTile> GSpotLightPerTiles;
+    FLightClusterBuilder ClusterBuilder;
+    FLightClusterGrid ClusterGrid;
+    TArray<FClusterPointLight> ClusterPointLights;
+    TArray<FClusterSpotLight> ClusterSpotLights;
 
-    ID3D11Buffer* PointLightBuffer;
-    ID3D11ShaderResourceView* PointLightSRV;
+    ID3D11Buffer* PointLightBuffer = nullptr;
+    ID3D11ShaderResourceView* PointLightSRV = nullptr;
 
-    ID3D11Buffer* SpotLightBuffer;
-    ID3D11ShaderResourceView* SpotLightSRV;
-    
-    ID3D11Buffer* PointLightPerTilesBuffer;
-    ID3D11ShaderResourceView* PointLightPerTilesSRV;
+    ID3D11Buffer* SpotLightBuffer = nullptr;
+    ID3D11ShaderResourceView* SpotLightSRV = nullptr;
 
-    ID3D11Buffer* SpotLightPerTilesBuffer;
-    ID3D11ShaderResourceView* SpotLightPerTilesSRV;
+    ID3D11Buffer* LightClusterRangeBuffer = nullptr;
+    ID3D11ShaderResourceView* LightClusterRangeSRV = nullptr;
 
-    ID3D11ShaderResourceView* PointLightIndexBufferSRV;
-    ID3D11ShaderResourceView* SpotLightIndexBufferSRV;
+    ID3D11Buffer* LightClusterIndexBuffer = nullptr;
+    ID3D11ShaderResourceView* LightClusterIndexSRV = nullptr;
+    uint32 LightClusterIndexCapacity = 0;
 
     static constexpr uint32 MAX_NUM_POINTLIGHTS = 50000;
     static constexpr uint32 MAX_NUM_SPOTLIGHTS = 50000;
-    static constexpr uint32 MAX_TILE = 10000;
+
+    /** 바뀐 라이트 사이의 간격이 이보다 작으면 사이의 라이트까지 한 번에 올림 */
+    static constexpr uint32 DIRTY_RANGE_MERGE_GAP = 64;
+
+    static constexpr uint32 INITIAL_CLUSTER_INDEX_CAPACITY = 64 * 1024;
 };
@@ -0,0 +1,182 @@
+#include "FmodSoundBackend.h"
+#include <fmod.hpp>
+#include <iostream>
+
+namespace
+{
+    FMOD::Sound* ToSound(FSoundBackendHandle Handle)
+    {
+        return reinterpret_cast<FMOD::Sound*>(Handle);
+    }
+
+    /** FMOD 채널 포인터는 재사용되면 내부 세대 값이 달라져서, 이미 끝난 채널에 호출해도 FMOD_ERR_INVALID_HANDLE만 돌려줌 */
+    FMOD::Channel* ToChannel(FSoundBackendHandle Handle)
+    {
+        return reinterpret_cast<FMOD::Channel*>(Handle);
+    }
+}
+
+bool FFmodSoundBackend::Initialize(int32 MaxRealChannels)
+{
+    FMOD_RESULT Result = FMOD::System_Create(&System);
+    if (Result != FMOD_OK)
+    {
+        std::cerr << "FMOD System_Create failed!" << std::endl;
+        System = nullptr;
+        return false;
+    }
+
+    Result = System->init(MaxRealChannels, FMOD_INIT_NORMAL, nullptr);
+    if (Result != FMOD_OK)
+    {
+        std::cerr << "FMOD system init failed!" << std::endl;
+        System->release();
+        System = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void FFmodSoundBackend::Shutdown()
+{
+    if (System)
+    {
+        System->close();
+        System->release();
+        System = nullptr;
+    }
+}
+
+void FFmodSoundBackend::Update(float DeltaTime)
+{
+    if (System)
+    {
+        System->update();
+    }
+}
+
+FSoundBackendHandle FFmodSoundBackend::LoadSoundAsync(const std::string& FilePath, bool bLoop)
+{
+    if (!System)
+    {
+        return 0;
+    }
+
+    const FMOD_MODE Mode = FMOD_DEFAULT | FMOD_CREATECOMPRESSEDSAMPLE | FMOD_NONBLOCKING | (bLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF);
+
+    FMOD::Sound* Sound = nullptr;
+    if (System->createSound(FilePath.c_str(), Mode, nullptr, &Sound) != FMOD_OK)
+    {
+        std::cerr << "Failed to load sound: " << FilePath << std::endl;
+        return 0;
+    }
+    return reinterpret_cast<FSoundBackendHandle>(Sound);
+}
+
+ESoundLoadState FFmodSoundBackend::GetLoadState(FSoundBackendHandle Sound)
+{
+    FMOD_OPENSTATE OpenState = FMOD_OPENSTATE_ERROR;
+    if (!Sound || ToSound(Sound)->getOpenState(&OpenState, nullptr, nullptr, nullptr) != FMOD_OK)
+    {
+        return ESoundLoadState::Failed;
+    }
+
+    switch (OpenState)
+    {
+    case FMOD_OPENSTATE_READY:
+    case FMOD_OPENSTATE_PLAYING:
+        return ESoundLoadState::Ready;
+    case FMOD_OPENSTATE_ERROR:
+        return ESoundLoadState::Failed;
+    default:
+        return ESoundLoadState::Loading;
+    }
+}
+
+float FFmodSoundBackend::GetSoundLength(FSoundBackendHandle Sound)
+{
+    unsigned int LengthMs = 0;
+    if (!Sound || ToSound(Sound)->getLength(&LengthMs, FMOD_TIMEUNIT_MS) != FMOD_OK)
+    {
+        return 0.f;
+    }
+    return static_cast<float>(LengthMs) / 1000.f;
+}
+
+void FFmodSoundBackend::ReleaseSound(FSoundBackendHandle Sound)
+{
+    if (Sound)
+    {
+        ToSound(Sound)->release();
+    }
+}
+
+FSoundBackendHandle FFmodSoundBackend::PlayChannel(FSoundBackendHandle Sound, float Volume, float StartSeconds)
+{
+    if (!System || !Sound)
+    {
+        return 0;
+    }
+
+    // 위치와 볼륨을 정한 뒤에 재생해야 가상 보이스가 다시 들릴 때 처음 몇 샘플이 튀지 않음
+    FMOD::Channel* Channel = nullptr;
+    if (System->playSound(ToSound(Sound), nullptr, true, &Channel) != FMOD_OK || !Channel)
+    {
+        return 0;
+    }
+
+    Channel->setVolume(Volume);
+    if (StartSeconds > 0.f)
+    {
+        Channel->setPosition(static_cast<unsigned int>(StartSeconds * 1000.f), FMOD_TIMEUNIT_MS);
+    }
+    Channel->setPaused(false);
+
+    return reinterpret_cast<FSoundBackendHandle>(Channel);
+}
+
+void FFmodSoundBackend::StopChannel(FSoundBackendHandle Channel)
+{
+    if (Channel)
+    {
+        ToChannel(Channel)->stop();
+    }
+}
+
+bool FFmodSoundBackend::IsChannelPlaying(FSoundBackendHandle Channel)
+{
+    bool bPlaying = false;
+    if (!Channel || ToChannel(Channel)->isPlaying(&bPlaying) != FMOD_OK)
+    {
+        return false;
+    }
+    return bPlaying;
+}
+
+void FFmodSoundBackend::SetChannelVolume(FSoundBackendHandle Channel, float Volume)
+{
+    if (Channel)
+    {
+        ToChannel(Channel)->setVolume(Volume);
+    }
+}
+
+float FFmodSoundBackend::GetChannelPosition(FSoundBackendHandle Channel)
+{
+    unsigned int PositionMs = 0;
+    if (!Channel || ToChannel(Channel)->getPosition(&PositionMs, FMOD_TIMEUNIT_MS) != FMOD_OK)
+    {
+        return 0.f;
+    }
+    return static_cast<float>(PositionMs) / 1000.f;
+}
+
+void FFmodSoundBackend::StopAllChannels()
+{
+    FMOD::ChannelGroup* MasterGroup = nullptr;
+    if (System && System->getMasterChannelGroup(&MasterGroup) == FMOD_OK && MasterGroup)
+    {
+        MasterGroup->stop();
+    }
+}
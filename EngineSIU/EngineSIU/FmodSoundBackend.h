@@ -0,0 +1,34 @@
+#pragma once
+#include "SoundBackend.h"
+
+namespace FMOD
+{
+    class System;
+}
+
+/** FMOD Core API 백엔드, 사운드는 FMOD_NONBLOCKING으로 FMOD의 로딩 스레드에서 읽음 */
+class FFmodSoundBackend : public ISoundBackend
+{
+public:
+    FFmodSoundBackend() = default;
+    virtual ~FFmodSoundBackend() override { Shutdown(); }
+
+    virtual bool Initialize(int32 MaxRealChannels) override;
+    virtual void Shutdown() override;
+    virtual void Update(float DeltaTime) override;
+
+    virtual FSoundBackendHandle LoadSoundAsync(const std::string& FilePath, bool bLoop) override;
+    virtual ESoundLoadState GetLoadState(FSoundBackendHandle Sound) override;
+    virtual float GetSoundLength(FSoundBackendHandle Sound) override;
+    virtual void ReleaseSound(FSoundBackendHandle Sound) override;
+
+    virtual FSoundBackendHandle PlayChannel(FSoundBackendHandle Sound, float Volume, float StartSeconds) override;
+    virtual void StopChannel(FSoundBackendHandle Channel) override;
+    virtual bool IsChannelPlaying(FSoundBackendHandle Channel) override;
+    virtual void SetChannelVolume(FSoundBackendHandle Channel, float Volume) override;
+    virtual float GetChannelPosition(FSoundBackendHandle Channel) override;
+    virtual void StopAllChannels() override;
+
+private:
+    FMOD::System* System = nullptr;
+};
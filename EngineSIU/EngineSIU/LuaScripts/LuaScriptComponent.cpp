@@ -1,5 +1,5 @@
 #include "LuaScriptComponent.h"
-#include "LuaBindingHelpers.h"
+#include "LuaScriptManager.h"
 #include "LuaScriptFileUtils.h"
 #include "World/World.h"
 #include "Engine/EditorEngine.h"
@@ -45,25 +45,29 @@ void ULuaScriptComponent::BeginPlay()
 
     DelegateHandles.Empty();
     
-    CallLuaFunction("BeginPlay");
+    CallScriptFunction(BeginPlayFunction, TEXT("BeginPlay"));
 }
 
 void ULuaScriptComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 { 
     Super::EndPlay(EndPlayReason);
 
-    CallLuaFunction("EndPlay");
+    CallScriptFunction(EndPlayFunction, TEXT("EndPlay"));
+
+    FLuaScriptManager::Get().CancelBatchTick(this);
+
+    // 공유 VM이 환경 테이블을 계속 붙잡고 있지 않도록 참조 해제
+    bScriptValid = false;
+    ScriptEnv = sol::environment();
+    CacheScriptFunctions();
 }
 
-UObject* ULuaScriptComponent::Duplicate(UObject* InOuter)
+void ULuaScriptComponent::Serialize(FArchive& Ar)
 {
-    ULuaScriptComponent* NewComponent = Cast<ULuaScriptComponent>(Super::Duplicate(InOuter));
-    if (NewComponent)
-    {
-        NewComponent->ScriptPath = ScriptPath;
-        NewComponent->DisplayName = DisplayName;
-    }
-    return NewComponent;
+    Super::Serialize(Ar);
+
+    // PIE 복제본이 InitializeComponent에서 템플릿 경로를 새로 만들지 않도록 스크립트 경로를 그대로 가져감
+    Ar << ScriptPath << DisplayName;
 }
 
 /* ActorComponent가 Actor와 World에 등록이 되었다는 전제하에 호출됩니다
@@ -110,94 +114,85 @@ void ULuaScriptComponent::InitializeLuaState()
         }
     }*/
 
-    LuaState.open_libraries();
-    BindEngineAPI();
-
-    try {
-        LuaState.script_file((*ScriptPath));
-        bScriptValid = true;
-        const std::wstring FilePath = ScriptPath.ToWideString();
-        LastWriteTime = std::filesystem::last_write_time(FilePath);
-    }
-    catch (const sol::error& err) {
-        UE_LOG(ELogLevel::Error, TEXT("Lua Initialization error: %s"), err.what());
-    }
+    // VM과 엔진 바인딩은 공유하고, 스크립트의 전역은 컴포넌트마다 따로 둠
+    FLuaScriptManager& ScriptManager = FLuaScriptManager::Get();
+    ScriptEnv = ScriptManager.CreateEnvironment(GetOwner());
+    bScriptValid = ScriptManager.RunScript(ScriptPath, ScriptEnv, LoadedRevision);
+    CacheScriptFunctions();
 
     CallLuaFunction("InitializeLua");
 }
 
-void ULuaScriptComponent::BindEngineAPI()
+void ULuaScriptComponent::CacheScriptFunctions()
 {
-    // [1] 바인딩 전 글로벌 키 스냅샷
-    TArray<FString> Before = LuaDebugHelper::CaptureGlobalNames(LuaState);
-
-    LuaBindingHelpers::BindPrint(LuaState);    // 0) Print 바인딩
-    LuaBindingHelpers::BindFVector(LuaState);   // 2) FVector 바인딩
-    LuaBindingHelpers::BindFRotator(LuaState);
-    LuaBindingHelpers::BindController(LuaState);
-    
-    auto ActorType = LuaState.new_usertype<AActor>("Actor",
-        sol::constructors<>(),
-        "Location", sol::property(
-            &AActor::GetActorLocation,
-            &AActor::SetActorLocation
-        ),
-        "Rotator", sol::property(
-            &AActor::GetActorRotation,
-            &AActor::SetActorRotation
-        ),
-        "Forward", &AActor::GetActorForwardVector
-    );
-    
-    // 프로퍼티 바인딩
-    LuaState["actor"] = GetOwner();
+    if (!bScriptValid)
+    {
+        BeginPlayFunction = sol::protected_function();
+        EndPlayFunction = sol::protected_function();
+        TickFunction = sol::protected_function();
+        BatchTickFunction = sol::protected_function();
+        return;
+    }
 
-    // [2] 바인딩 후, 새로 추가된 글로벌 키만 자동 로그
-    LuaDebugHelper::LogNewBindings(LuaState, Before);
+    // 환경 테이블에 없으면 공유 전역까지 찾아보므로 nil이 아닌 함수만 남김
+    const auto Resolve = [this](const char* Name)
+    {
+        sol::object Object = ScriptEnv[Name];
+        return Object.get_type() == sol::type::function ? Object.as<sol::protected_function>() : sol::protected_function();
+    };
+    BeginPlayFunction = Resolve("BeginPlay");
+    EndPlayFunction = Resolve("EndPlay");
+    TickFunction = Resolve("Tick");
+
+    // 인스턴스 환경의 TickBatch를 그대로 쓰지 않고 리비전마다 공유하는 배치용 함수를 받음, 거부되면 Tick으로 동작
+    const sol::protected_function InstanceBatchTick = Resolve("TickBatch");
+    BatchTickFunction = InstanceBatchTick.valid()
+        ? FLuaScriptManager::Get().GetBatchTickFunction(ScriptPath, LoadedRevision, InstanceBatchTick)
+        : sol::protected_function();
 }
 
 bool ULuaScriptComponent::CheckFileModified()
 {
     if (ScriptPath.IsEmpty()) return false;
 
-    try {
-        std::wstring FilePath = ScriptPath.ToWideString();
-        const auto CurrentTime = std::filesystem::last_write_time(FilePath);
+    // 파일 확인과 재컴파일은 매니저가 파일마다 한 번만 하고, 컴포넌트는 리비전만 비교
+    FLuaScriptManager& ScriptManager = FLuaScriptManager::Get();
+    ScriptManager.PollModifiedScripts();
 
-        if (CurrentTime > LastWriteTime) {
-            LastWriteTime = CurrentTime;
-            return true;
-        }
-    }
-    catch (const std::exception& e) {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to check lua script file"));
-    }
-    return false;
+    const uint32 CurrentRevision = ScriptManager.GetScriptRevision(ScriptPath);
+    return CurrentRevision != 0 && CurrentRevision != LoadedRevision;
 }
 
 void ULuaScriptComponent::ReloadScript()
 {
     sol::table PersistentData;
-    if (bScriptValid && LuaState["PersistentData"].valid()) {
-        PersistentData = LuaState["PersistentData"];
+    if (bScriptValid && ScriptEnv["PersistentData"].valid()) {
+        PersistentData = ScriptEnv["PersistentData"];
     }
 
-    LuaState = sol::state();
     InitializeLuaState();
 
     if (PersistentData.valid()) {
-        LuaState["PersistentData"] = PersistentData;
+        ScriptEnv["PersistentData"] = PersistentData;
     }
 
     CallLuaFunction("OnHotReload");
-    CallLuaFunction("BeginPlay");
+    CallScriptFunction(BeginPlayFunction, TEXT("BeginPlay"));
 }
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
 
-    CallLuaFunction("Tick", DeltaTime);
+    if (BatchTickFunction.valid())
+    {
+        // 같은 스크립트를 쓰는 인스턴스를 모아 TickGroup이 끝날 때 TickBatch 한 번으로 처리
+        FLuaScriptManager::Get().QueueBatchTick(this, DeltaTime);
+    }
+    else
+    {
+        CallScriptFunction(TickFunction, TEXT("Tick"), DeltaTime);
+    }
 
     if (CheckFileModified()) {
         try {
@@ -2,7 +2,6 @@
 #include "Runtime/CoreUObject/UObject/ObjectMacros.h"
 #include "Components/ActorComponent.h"
 #include <sol/sol.hpp>
-#include <filesystem>
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnLocationTenUp, const FVector);
 
@@ -25,11 +24,24 @@ public:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime) override;
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void Serialize(FArchive& Ar) override;
     virtual void InitializeComponent() override;
 
     // Lua 함수 호출 메서드
     template<typename... Arguments> void CallLuaFunction(const FString& FunctionName, Arguments... args);
+
+    /** 캐시된 핸들로 호출, 매 프레임 불리는 이벤트는 이름으로 찾지 않고 이 함수를 씀 */
+    template<typename... Arguments> void CallScriptFunction(const sol::protected_function& Function, const TCHAR* FunctionName, Arguments... args);
+
+    const sol::environment& GetScriptEnvironment() const { return ScriptEnv; }
+
+    /**
+     * 스크립트에 TickBatch가 있으면 Tick 대신 FLuaScriptManager가 같은 스크립트, 같은 리비전의 인스턴스를 모아 한 번에 호출
+     * 인스턴스 환경이 아닌 배치 환경에 묶인 함수라서 이 컴포넌트의 전역을 직접 읽지 않음
+     */
+    const sol::protected_function& GetBatchTickFunction() const { return BatchTickFunction; }
+
+    uint32 GetLoadedRevision() const { return LoadedRevision; }
     
     FString GetScriptPath() const { return ScriptPath; }
     void SetScriptPath(const FString& InScriptPath);
@@ -48,18 +60,25 @@ private:
     // Lua 환경 초기화
     void InitializeLuaState();
 
-    // Lua-Engine 바인딩
-    void BindEngineAPI();
+    /** 스크립트 이벤트 함수 핸들을 다시 찾음, 스크립트를 실행하거나 리로드한 뒤 호출 */
+    void CacheScriptFunctions();
 
     FString ScriptPath;
     FString DisplayName;
 
     TArray<FDelegateHandle> DelegateHandles;
     
-    sol::state LuaState;
+    /** 공유 VM 위에서 이 컴포넌트의 스크립트가 쓰는 전역 테이블 */
+    sol::environment ScriptEnv;
     bool bScriptValid = false;
 
-    std::filesystem::file_time_type LastWriteTime;
+    sol::protected_function BeginPlayFunction;
+    sol::protected_function EndPlayFunction;
+    sol::protected_function TickFunction;
+    sol::protected_function BatchTickFunction;
+
+    /** 마지막으로 실행한 청크의 리비전, FLuaScriptManager의 리비전과 다르면 핫 리로드 */
+    uint32 LoadedRevision = 0;
     bool CheckFileModified();
     void ReloadScript();
 };
@@ -67,8 +86,27 @@ private:
 template <typename ... Arguments>
 void ULuaScriptComponent::CallLuaFunction(const FString& FunctionName, Arguments... args)
 {
-    if (bScriptValid && LuaState[*FunctionName].valid())
+    if (!bScriptValid)
+    {
+        return;
+    }
+
+    sol::protected_function Function = ScriptEnv[*FunctionName];
+    CallScriptFunction(Function, *FunctionName, args...);
+}
+
+template <typename ... Arguments>
+void ULuaScriptComponent::CallScriptFunction(const sol::protected_function& Function, const TCHAR* FunctionName, Arguments... args)
+{
+    if (!bScriptValid || !Function.valid())
+    {
+        return;
+    }
+
+    const sol::protected_function_result Result = Function(args...);
+    if (!Result.valid())
     {
-        LuaState[*FunctionName](args...);
+        const sol::error Error = Result;
+        UE_LOG(ELogLevel::Error, TEXT("Lua error in %s: %s"), FunctionName, Error.what());
     }
 }
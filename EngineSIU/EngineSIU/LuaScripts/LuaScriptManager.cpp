@@ -0,0 +1,653 @@
+#include "LuaScriptManager.h"
+#include <fstream>
+#include <iterator>
+#include "LuaBindingHelpers.h"
+#include "LuaScriptComponent.h"
+#include "Runtime/Engine/Classes/GameFramework/Actor.h"
+#include "World/TickTaskManager.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    uint64 HashScriptSource(const std::string& Source)
+    {
+        // FNV-1a 64
+        uint64 Hash = 14695981039346656037ull;
+        for (const char Char : Source)
+        {
+            Hash ^= static_cast<uint8>(Char);
+            Hash *= 1099511628211ull;
+        }
+        return Hash;
+    }
+
+    bool ReadScriptFile(const FString& ScriptPath, std::string& OutSource)
+    {
+        std::ifstream File(std::filesystem::path(ScriptPath.ToWideString()), std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        OutSource.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    double GetSecondsNow()
+    {
+        return static_cast<double>(FPlatformTime::Cycles64()) * FPlatformTime::GetSecondsPerCycle();
+    }
+
+    /** RunTickBenchmark에서 쓰는 스크립트, Tick은 actor.Location처럼 usertype을 읽고 쓰고 TickBatch는 펼친 배열을 씀 */
+    constexpr const char* TickBenchmarkSource = R"(
+Position = FVector(0, 0, 0)
+Speed = 1
+
+function Tick(DeltaTime)
+    local NewPosition = Position
+    NewPosition.X = NewPosition.X + Speed * DeltaTime
+    Position = NewPosition
+end
+
+function TickBatch(Instances, Locations, Rotations, DeltaTime)
+    for Index = 1, #Instances do
+        local Base = Index * 3 - 2
+        Locations[Base] = Locations[Base] + Instances[Index].Speed * DeltaTime
+    end
+end
+)";
+}
+
+sol::state& FLuaScriptManager::GetLuaState()
+{
+    if (!LuaState)
+    {
+        InitializeLuaState();
+    }
+    return *LuaState;
+}
+
+void FLuaScriptManager::InitializeLuaState()
+{
+    LuaState = new sol::state();
+    LuaState->open_libraries();
+
+    // [1] 바인딩 전 글로벌 키 스냅샷
+    const TArray<FString> Before = LuaDebugHelper::CaptureGlobalNames(*LuaState);
+
+    BindEngineAPI(*LuaState);
+
+    // [2] 바인딩 후, 새로 추가된 글로벌 키만 자동 로그
+    LuaDebugHelper::LogNewBindings(*LuaState, Before);
+
+    EnvironmentMetatable = LuaState->create_table();
+    EnvironmentMetatable[sol::meta_function::index] = LuaState->globals();
+
+    // TickBatch가 전역에 값을 남겨 다음 배치나 다른 스크립트로 상태를 흘리지 못하도록 쓰기를 막음
+    sol::table BatchMetatable = LuaState->create_table();
+    BatchMetatable[sol::meta_function::index] = LuaState->globals();
+    sol::load_result NewIndexChunk = LuaState->load(
+        "local _, Key = ...; error(\"TickBatch must not write globals ('\" .. tostring(Key) .. \"'), keep per-instance state in Instances\", 2)"
+    );
+    const sol::protected_function NewIndex = NewIndexChunk;
+    BatchMetatable[sol::meta_function::new_index] = NewIndex;
+    BatchEnvironment = sol::environment(*LuaState, sol::create);
+    BatchEnvironment[sol::metatable_key] = BatchMetatable;
+}
+
+void FLuaScriptManager::BindEngineAPI(sol::state& State)
+{
+    LuaBindingHelpers::BindPrint(State);    // 0) Print 바인딩
+    LuaBindingHelpers::BindFVector(State);   // 2) FVector 바인딩
+    LuaBindingHelpers::BindFRotator(State);
+    LuaBindingHelpers::BindController(State);
+
+    State.new_usertype<AActor>("Actor",
+        sol::constructors<>(),
+        "Location", sol::property(
+            &AActor::GetActorLocation,
+            &AActor::SetActorLocation
+        ),
+        "Rotator", sol::property(
+            &AActor::GetActorRotation,
+            &AActor::SetActorRotation
+        ),
+        "Forward", &AActor::GetActorForwardVector
+    );
+}
+
+sol::environment FLuaScriptManager::CreateEnvironment(AActor* Owner)
+{
+    sol::state& Lua = GetLuaState();
+
+    sol::environment Env(Lua, sol::create);
+    Env[sol::metatable_key] = EnvironmentMetatable;
+    Env["actor"] = Owner;
+
+    ++NumEnvironments;
+    return Env;
+}
+
+bool FLuaScriptManager::CompileChunk(const FString& ScriptPath, FCompiledChunk& OutChunk, bool bSkipIfUnchanged)
+{
+    std::string Source;
+    if (!ReadScriptFile(ScriptPath, Source))
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Failed to read lua script: %s"), *ScriptPath);
+        return false;
+    }
+
+    const uint64 ContentHash = HashScriptSource(Source);
+    if (bSkipIfUnchanged && ContentHash == OutChunk.ContentHash)
+    {
+        return false;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    sol::state& Lua = GetLuaState();
+    sol::load_result Loaded = Lua.load(Source, "@" + ScriptPath.ToAnsiString(), sol::load_mode::text);
+    if (!Loaded.valid())
+    {
+        const sol::error Error = Loaded;
+        UE_LOG(ELogLevel::Error, TEXT("Lua compile error: %s"), Error.what());
+        return false;
+    }
+
+    const sol::protected_function Chunk = Loaded;
+    OutChunk.Bytecode = Chunk.dump();
+    OutChunk.ContentHash = ContentHash;
+    OutChunk.Revision = NextRevision++;
+    OutChunk.BatchTickFunction = sol::protected_function();
+    OutChunk.bBatchTickResolved = false;
+
+    TotalCompileMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    ++NumCompiles;
+    return true;
+}
+
+bool FLuaScriptManager::RunScript(const FString& ScriptPath, const sol::environment& Env, uint32& OutRevision)
+{
+    FCompiledChunk* Chunk = Chunks.Find(ScriptPath);
+    if (!Chunk)
+    {
+        FCompiledChunk NewChunk;
+        if (!CompileChunk(ScriptPath, NewChunk, false))
+        {
+            return false;
+        }
+
+        std::error_code ErrorCode;
+        NewChunk.LastWriteTime = std::filesystem::last_write_time(ScriptPath.ToWideString(), ErrorCode);
+        Chunk = &Chunks.Emplace(ScriptPath, std::move(NewChunk));
+    }
+
+    // 실행에 실패해도 리비전은 기록해서, 같은 코드로 매 프레임 다시 리로드하지 않게 함
+    OutRevision = Chunk->Revision;
+
+    return RunBytecode(Chunk->Bytecode, "@" + ScriptPath.ToAnsiString(), Env);
+}
+
+bool FLuaScriptManager::RunBytecode(const sol::bytecode& Bytecode, const std::string& ChunkName, const sol::environment& Env)
+{
+    // 같은 바이트코드라도 로드할 때마다 새 클로저가 만들어지므로 환경은 인스턴스마다 독립적
+    sol::state& Lua = GetLuaState();
+    sol::load_result Loaded = Lua.load(Bytecode.as_string_view(), ChunkName, sol::load_mode::binary);
+    if (!Loaded.valid())
+    {
+        const sol::error Error = Loaded;
+        UE_LOG(ELogLevel::Error, TEXT("Lua Initialization error: %s"), Error.what());
+        return false;
+    }
+
+    sol::protected_function Function = Loaded;
+    sol::set_environment(Env, Function);
+
+    const sol::protected_function_result Result = Function();
+    if (!Result.valid())
+    {
+        const sol::error Error = Result;
+        UE_LOG(ELogLevel::Error, TEXT("Lua Initialization error: %s"), Error.what());
+        return false;
+    }
+
+    return true;
+}
+
+uint32 FLuaScriptManager::GetScriptRevision(const FString& ScriptPath) const
+{
+    const FCompiledChunk* Chunk = Chunks.Find(ScriptPath);
+    return Chunk ? Chunk->Revision : 0;
+}
+
+void FLuaScriptManager::PollModifiedScripts()
+{
+    const double NowSeconds = GetSecondsNow();
+    if (NowSeconds - LastPollSeconds < POLL_INTERVAL_SECONDS)
+    {
+        return;
+    }
+    LastPollSeconds = NowSeconds;
+
+    for (auto& [ScriptPath, Chunk] : Chunks)
+    {
+        std::error_code ErrorCode;
+        const auto CurrentTime = std::filesystem::last_write_time(ScriptPath.ToWideString(), ErrorCode);
+        if (ErrorCode || CurrentTime <= Chunk.LastWriteTime)
+        {
+            continue;
+        }
+        Chunk.LastWriteTime = CurrentTime;
+
+        // 컴파일에 실패하면 리비전이 그대로라서 기존 인스턴스는 이전 코드로 계속 동작
+        if (CompileChunk(ScriptPath, Chunk, true))
+        {
+            UE_LOG(ELogLevel::Display, TEXT("Lua script recompiled: %s"), *ScriptPath);
+        }
+    }
+}
+
+sol::protected_function FLuaScriptManager::GetBatchTickFunction(const FString& ScriptPath, uint32 Revision, const sol::protected_function& InstanceFunction)
+{
+    // 리비전이 다르면 이미 다시 컴파일된 청크이므로 캐시하지 않고 그때만 만듦
+    FCompiledChunk* Chunk = Chunks.Find(ScriptPath);
+    const bool bCacheable = Chunk && Chunk->Revision == Revision;
+    if (bCacheable && Chunk->bBatchTickResolved)
+    {
+        return Chunk->BatchTickFunction;
+    }
+
+    sol::protected_function BatchFunction = CreateBatchTickFunction(ScriptPath, InstanceFunction);
+    if (bCacheable)
+    {
+        Chunk->BatchTickFunction = BatchFunction;
+        Chunk->bBatchTickResolved = true;
+    }
+    return BatchFunction;
+}
+
+sol::protected_function FLuaScriptManager::CreateBatchTickFunction(const FString& ScriptPath, const sol::protected_function& InstanceFunction)
+{
+    sol::state& Lua = GetLuaState();
+    lua_State* L = Lua.lua_state();
+
+    // _ENV 말고 다른 업밸류가 있다면 청크의 local을 읽는 것이라 인스턴스마다 값이 다를 수 있음
+    InstanceFunction.push();
+    const bool bIsLuaFunction = lua_isfunction(L, -1) && !lua_iscfunction(L, -1);
+    std::string CapturedName;
+    for (int UpvalueIndex = 1; bIsLuaFunction; ++UpvalueIndex)
+    {
+        const char* Name = lua_getupvalue(L, -1, UpvalueIndex);
+        if (!Name)
+        {
+            break;
+        }
+        lua_pop(L, 1);
+
+        if (std::string_view(Name) != "_ENV")
+        {
+            CapturedName = Name;
+            break;
+        }
+    }
+    lua_pop(L, 1);
+
+    if (!bIsLuaFunction || !CapturedName.empty())
+    {
+        UE_LOG(
+            ELogLevel::Warning, TEXT("TickBatch in %s captures '%s', running Tick per instance instead; read instance state through Instances"),
+            *ScriptPath, bIsLuaFunction ? CapturedName.c_str() : "a C function"
+        );
+        return sol::protected_function();
+    }
+
+    // 덤프한 바이트코드로 새 클로저를 만들면 인스턴스 청크와 _ENV 업밸류를 공유하지 않음
+    sol::load_result Loaded = Lua.load(InstanceFunction.dump().as_string_view(), "@" + ScriptPath.ToAnsiString(), sol::load_mode::binary);
+    if (!Loaded.valid())
+    {
+        const sol::error Error = Loaded;
+        UE_LOG(ELogLevel::Error, TEXT("Failed to create TickBatch for %s: %s"), *ScriptPath, Error.what());
+        return sol::protected_function();
+    }
+
+    sol::protected_function BatchFunction = Loaded;
+    sol::set_environment(BatchEnvironment, BatchFunction);
+    return BatchFunction;
+}
+
+void FLuaScriptManager::QueueBatchTick(ULuaScriptComponent* Component, float DeltaTime)
+{
+    FBatchTickGroup& Group = BatchTickGroups.FindOrAdd({ Component->GetScriptPath(), Component->GetLoadedRevision() });
+    if (Group.Components.IsEmpty())
+    {
+        Group.BatchFunction = Component->GetBatchTickFunction();
+    }
+    Group.Components.Add(Component);
+    BatchDeltaTime = DeltaTime;
+
+    if (!bBatchFlushQueued)
+    {
+        bBatchFlushQueued = true;
+        FTickTaskManager::EnqueueGameThreadTask([this]() { FlushBatchTicks(); });
+    }
+}
+
+void FLuaScriptManager::CancelBatchTick(ULuaScriptComponent* Component)
+{
+    if (!bBatchFlushQueued)
+    {
+        return;
+    }
+
+    for (auto& [Key, Group] : BatchTickGroups)
+    {
+        for (ULuaScriptComponent*& Queued : Group.Components)
+        {
+            if (Queued == Component)
+            {
+                Queued = nullptr;
+            }
+        }
+    }
+}
+
+void FLuaScriptManager::FlushBatchTicks()
+{
+    bBatchFlushQueued = false;
+
+    TArray<FLuaBatchTickKey> StaleKeys;
+    for (auto& [Key, Group] : BatchTickGroups)
+    {
+        Group.Components.RemoveAll([](const ULuaScriptComponent* Component) { return Component == nullptr; });
+        if (Group.Components.Num() > 0)
+        {
+            FlushBatchTickGroup(Group);
+            Group.Components.SetNum(0);
+        }
+        else if (Key.Revision != GetScriptRevision(Key.ScriptPath))
+        {
+            // 핫 리로드 이후 모든 인스턴스가 새 리비전으로 넘어가면 이전 리비전의 배열과 함수를 놓아줌
+            StaleKeys.Add(Key);
+        }
+    }
+
+    for (const FLuaBatchTickKey& Key : StaleKeys)
+    {
+        BatchTickGroups.Remove(Key);
+    }
+}
+
+void FLuaScriptManager::FlushBatchTickGroup(FBatchTickGroup& Group)
+{
+    sol::state& Lua = GetLuaState();
+    if (!Group.Instances.valid())
+    {
+        Group.Instances = Lua.create_table();
+        Group.Locations = Lua.create_table();
+        Group.Rotations = Lua.create_table();
+    }
+
+    const int32 NumInstances = Group.Components.Num();
+    Group.PackedLocations.SetNum(NumInstances);
+    Group.PackedRotations.SetNum(NumInstances);
+
+    for (int32 Index = 0; Index < NumInstances; ++Index)
+    {
+        const ULuaScriptComponent* Component = Group.Components[Index];
+        const AActor* Owner = Component->GetOwner();
+        const FVector Location = Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
+        const FRotator Rotation = Owner ? Owner->GetActorRotation() : FRotator();
+        Group.PackedLocations[Index] = Location;
+        Group.PackedRotations[Index] = Rotation;
+
+        const int32 Base = Index * 3;
+        Group.Instances.raw_set(Index + 1, Component->GetScriptEnvironment());
+        Group.Locations.raw_set(Base + 1, Location.X, Base + 2, Location.Y, Base + 3, Location.Z);
+        Group.Rotations.raw_set(Base + 1, Rotation.Pitch, Base + 2, Rotation.Yaw, Base + 3, Rotation.Roll);
+    }
+
+    // 지난번보다 인스턴스가 줄었다면 남은 항목을 지워서 #Instances가 이번 인스턴스 수가 되도록 함
+    for (int32 Index = NumInstances; Index < Group.NumPacked; ++Index)
+    {
+        const int32 Base = Index * 3;
+        Group.Instances.raw_set(Index + 1, sol::lua_nil);
+        Group.Locations.raw_set(Base + 1, sol::lua_nil, Base + 2, sol::lua_nil, Base + 3, sol::lua_nil);
+        Group.Rotations.raw_set(Base + 1, sol::lua_nil, Base + 2, sol::lua_nil, Base + 3, sol::lua_nil);
+    }
+    Group.NumPacked = NumInstances;
+
+    const sol::protected_function_result Result = Group.BatchFunction(Group.Instances, Group.Locations, Group.Rotations, BatchDeltaTime);
+    if (!Result.valid())
+    {
+        const sol::error Error = Result;
+        UE_LOG(ELogLevel::Error, TEXT("Lua error in TickBatch: %s"), Error.what());
+        return;
+    }
+
+    for (int32 Index = 0; Index < NumInstances; ++Index)
+    {
+        AActor* Owner = Group.Components[Index]->GetOwner();
+        if (!Owner)
+        {
+            continue;
+        }
+
+        const int32 Base = Index * 3;
+        const FVector& OldLocation = Group.PackedLocations[Index];
+        const FVector NewLocation(
+            Group.Locations.raw_get_or<float>(Base + 1, OldLocation.X),
+            Group.Locations.raw_get_or<float>(Base + 2, OldLocation.Y),
+            Group.Locations.raw_get_or<float>(Base + 3, OldLocation.Z)
+        );
+        if (NewLocation.X != OldLocation.X || NewLocation.Y != OldLocation.Y || NewLocation.Z != OldLocation.Z)
+        {
+            Owner->SetActorLocation(NewLocation);
+        }
+
+        const FRotator& OldRotation = Group.PackedRotations[Index];
+        const FRotator NewRotation(
+            Group.Rotations.raw_get_or<float>(Base + 1, OldRotation.Pitch),
+            Group.Rotations.raw_get_or<float>(Base + 2, OldRotation.Yaw),
+            Group.Rotations.raw_get_or<float>(Base + 3, OldRotation.Roll)
+        );
+        if (NewRotation.Pitch != OldRotation.Pitch || NewRotation.Yaw != OldRotation.Yaw || NewRotation.Roll != OldRotation.Roll)
+        {
+            Owner->SetActorRotation(NewRotation);
+        }
+    }
+}
+
+void FLuaScriptManager::LogStats()
+{
+    sol::state& Lua = GetLuaState();
+    Lua.collect_garbage();
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("Lua VM: %.2f KB, %d cached chunks, %d compiles (%.2f ms), %d environments created"),
+        static_cast<double>(Lua.memory_used()) / 1024.0, Chunks.Num(), NumCompiles, TotalCompileMs, NumEnvironments
+    );
+}
+
+void FLuaScriptManager::RunStartupBenchmark(int32 NumInstances, const FString& ScriptPath)
+{
+    if (NumInstances <= 0)
+    {
+        return;
+    }
+
+    // 이전 방식: 인스턴스마다 VM 생성, 라이브러리 로드, 바인딩, 소스 파싱
+    double SeparateMs = 0.0;
+    uint64 SeparateBytes = 0;
+    {
+        TArray<sol::state*> States;
+        States.Reserve(NumInstances);
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < NumInstances; ++Index)
+        {
+            sol::state* State = new sol::state();
+            State->open_libraries();
+            BindEngineAPI(*State);
+            State->safe_script_file(ScriptPath.ToAnsiString(), sol::script_pass_on_error);
+            States.Add(State);
+        }
+        SeparateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        for (sol::state* State : States)
+        {
+            SeparateBytes += State->memory_used();
+            delete State;
+        }
+    }
+
+    // 공유 VM: 환경 테이블 생성과 캐시된 바이트코드 실행
+    double SharedMs = 0.0;
+    uint64 SharedBytes = 0;
+    {
+        sol::state& Lua = GetLuaState();
+        Lua.collect_garbage();
+        const uint64 BaseBytes = Lua.memory_used();
+
+        TArray<sol::environment> Environments;
+        Environments.Reserve(NumInstances);
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < NumInstances; ++Index)
+        {
+            sol::environment Env = CreateEnvironment(nullptr);
+            uint32 Revision = 0;
+            RunScript(ScriptPath, Env, Revision);
+            Environments.Add(std::move(Env));
+        }
+        SharedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        Lua.collect_garbage();
+        const uint64 UsedBytes = Lua.memory_used();
+        SharedBytes = UsedBytes > BaseBytes ? UsedBytes - BaseBytes : 0;
+
+        Environments.Empty();
+        Lua.collect_garbage();
+    }
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("Lua startup x%d: separate VMs %.2f ms, %.2f MB / shared VM %.2f ms, %.2f MB"),
+        NumInstances,
+        SeparateMs, static_cast<double>(SeparateBytes) / (1024.0 * 1024.0),
+        SharedMs, static_cast<double>(SharedBytes) / (1024.0 * 1024.0)
+    );
+}
+
+void FLuaScriptManager::RunTickBenchmark(int32 NumInstances, int32 NumFrames)
+{
+    if (NumInstances <= 0 || NumFrames <= 0)
+    {
+        return;
+    }
+
+    sol::state& Lua = GetLuaState();
+    sol::load_result Loaded = Lua.load(TickBenchmarkSource, "=TickBenchmark", sol::load_mode::text);
+    if (!Loaded.valid())
+    {
+        const sol::error Error = Loaded;
+        UE_LOG(ELogLevel::Error, TEXT("Lua tick benchmark compile error: %s"), Error.what());
+        return;
+    }
+    const sol::protected_function Chunk = Loaded;
+    const sol::bytecode Bytecode = Chunk.dump();
+
+    TArray<sol::environment> Environments;
+    Environments.Reserve(NumInstances);
+    for (int32 Index = 0; Index < NumInstances; ++Index)
+    {
+        sol::environment Env = CreateEnvironment(nullptr);
+        RunBytecode(Bytecode, "=TickBenchmark", Env);
+        Environments.Add(std::move(Env));
+    }
+
+    constexpr float DeltaTime = 1.f / 60.f;
+
+    // 이전 방식: 프레임마다 환경에서 이름으로 Tick을 찾아 호출
+    double ByNameMs = 0.0;
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (const sol::environment& Env : Environments)
+            {
+                sol::protected_function Function = Env["Tick"];
+                Function(DeltaTime);
+            }
+        }
+        ByNameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    // 캐시된 핸들로 호출
+    double CachedMs = 0.0;
+    {
+        TArray<sol::protected_function> Functions;
+        Functions.Reserve(NumInstances);
+        for (const sol::environment& Env : Environments)
+        {
+            Functions.Add(Env["Tick"]);
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (const sol::protected_function& Function : Functions)
+            {
+                Function(DeltaTime);
+            }
+        }
+        CachedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    // 프레임마다 TickBatch 한 번, FlushBatchTickGroup과 같은 방식으로 펼친 배열을 채우고 다시 읽음
+    double BatchMs = 0.0;
+    {
+        TArray<FVector> Locations;
+        Locations.SetNum(NumInstances);
+
+        sol::table InstanceTable = Lua.create_table(NumInstances, 0);
+        sol::table LocationTable = Lua.create_table(NumInstances * 3, 0);
+        sol::table RotationTable = Lua.create_table(NumInstances * 3, 0);
+        for (int32 Index = 0; Index < NumInstances; ++Index)
+        {
+            const int32 Base = Index * 3;
+            InstanceTable.raw_set(Index + 1, Environments[Index]);
+            RotationTable.raw_set(Base + 1, 0.f, Base + 2, 0.f, Base + 3, 0.f);
+        }
+        const sol::protected_function BatchFunction = CreateBatchTickFunction(TEXT("TickBenchmark"), Environments[0]["TickBatch"]);
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Index = 0; Index < NumInstances; ++Index)
+            {
+                const int32 Base = Index * 3;
+                const FVector& Location = Locations[Index];
+                LocationTable.raw_set(Base + 1, Location.X, Base + 2, Location.Y, Base + 3, Location.Z);
+            }
+
+            BatchFunction(InstanceTable, LocationTable, RotationTable, DeltaTime);
+
+            for (int32 Index = 0; Index < NumInstances; ++Index)
+            {
+                const int32 Base = Index * 3;
+                FVector& Location = Locations[Index];
+                Location.X = LocationTable.raw_get_or<float>(Base + 1, Location.X);
+                Location.Y = LocationTable.raw_get_or<float>(Base + 2, Location.Y);
+                Location.Z = LocationTable.raw_get_or<float>(Base + 3, Location.Z);
+            }
+        }
+        BatchMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    Environments.Empty();
+    Lua.collect_garbage();
+
+    UE_LOG(
+        ELogLevel::Display, TEXT("Lua tick x%d, %d frames: by name %.3f ms/frame / cached %.3f ms/frame / TickBatch %.3f ms/frame"),
+        NumInstances, NumFrames,
+        ByNameMs / NumFrames, CachedMs / NumFrames, BatchMs / NumFrames
+    );
+}
@@ -0,0 +1,177 @@
+#pragma once
+#include <sol/sol.hpp>
+#include <filesystem>
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "Math/Rotator.h"
+#include "Math/Vector.h"
+
+class AActor;
+class ULuaScriptComponent;
+
+/** 같은 청크 리비전에서 나온 인스턴스만 한 배치로 묶음, 핫 리로드 직후에는 이전 리비전 인스턴스가 따로 묶임 */
+struct FLuaBatchTickKey
+{
+    FString ScriptPath;
+    uint32 Revision = 0;
+
+    bool operator==(const FLuaBatchTickKey& Other) const
+    {
+        return Revision == Other.Revision && ScriptPath == Other.ScriptPath;
+    }
+};
+
+template <>
+struct std::hash<FLuaBatchTickKey>
+{
+    size_t operator()(const FLuaBatchTickKey& Key) const noexcept
+    {
+        return std::hash<FString>()(Key.ScriptPath) * 31 + std::hash<uint32>()(Key.Revision);
+    }
+};
+
+/**
+ * 모든 ULuaScriptComponent가 공유하는 Lua VM
+ *
+ * - open_libraries와 엔진 API 바인딩은 VM을 만들 때 한 번만 수행
+ * - 컴포넌트마다 환경 테이블을 따로 두어 스크립트의 전역 변수와 함수가 섞이지 않음, 없는 이름은 공유 전역에서 찾음
+ * - 스크립트는 경로별로 한 번 컴파일한 바이트코드를 캐시하고, 수정 시간이 바뀌어도 내용 해시가 같으면 다시 컴파일하지 않음
+ * - TickBatch를 정의한 스크립트는 인스턴스별 Tick 대신 TickGroup마다 (스크립트, 청크 리비전)당 한 번 TickBatch(Instances, Locations, Rotations, DeltaTime)로 호출
+ *   Locations와 Rotations는 Actor Transform을 x, y, z / Pitch, Yaw, Roll 순서로 펼친 숫자 배열이고, 바뀐 값만 Actor에 다시 반영
+ *   TickBatch는 인자만 읽어야 함, 인스턴스 전역은 Instances[i].Name으로 읽고 전역 쓰기는 에러이며 청크의 local을 캡처하면 배치하지 않음
+ */
+class FLuaScriptManager
+{
+public:
+    static FLuaScriptManager& Get()
+    {
+        static FLuaScriptManager Instance;
+        return Instance;
+    }
+
+    sol::state& GetLuaState();
+
+    /** Owner를 actor로 노출하는 새 환경 테이블 */
+    sol::environment CreateEnvironment(AActor* Owner);
+
+    /**
+     * ScriptPath의 청크를 Env에서 실행, 처음 요청된 경로라면 컴파일해서 캐시에 넣음
+     * @param OutRevision 실행한 청크의 리비전, GetScriptRevision과 비교해 핫 리로드 여부를 판단
+     */
+    bool RunScript(const FString& ScriptPath, const sol::environment& Env, uint32& OutRevision);
+
+    /** 캐시된 청크의 현재 리비전, 캐시에 없으면 0 */
+    uint32 GetScriptRevision(const FString& ScriptPath) const;
+
+    /**
+     * 캐시된 스크립트 파일의 수정 시간을 확인하고 내용이 바뀐 파일만 다시 컴파일
+     * 컴포넌트마다 호출해도 POLL_INTERVAL_SECONDS에 한 번만 파일 시스템을 확인함
+     */
+    void PollModifiedScripts();
+
+    void LogStats();
+
+    /** Component를 이번 TickGroup의 배치에 넣고, 처음 넣을 때 TickGroup이 끝나면 FlushBatchTicks가 실행되도록 예약 */
+    void QueueBatchTick(ULuaScriptComponent* Component, float DeltaTime);
+
+    /** 아직 실행되지 않은 배치에서 Component를 제거, EndPlay에서 호출 */
+    void CancelBatchTick(ULuaScriptComponent* Component);
+
+    void FlushBatchTicks();
+
+    /**
+     * InstanceFunction(인스턴스 환경에서 찾은 TickBatch)을 인스턴스와 분리한 배치용 함수로 바꿈, 리비전마다 한 번 만들어 공유
+     * 복사본은 공유 전역만 보이고 쓰기가 막힌 배치 환경에서 실행되어 어떤 인스턴스의 _ENV도 읽지 않음
+     * _ENV 외의 업밸류(청크의 local 등)를 캡처했다면 인스턴스마다 값이 다를 수 있으므로 빈 함수를 돌려주고, 컴포넌트는 Tick으로 대신함
+     */
+    sol::protected_function GetBatchTickFunction(const FString& ScriptPath, uint32 Revision, const sol::protected_function& InstanceFunction);
+
+    /** 엔진 API를 State의 전역에 등록, 공유 VM과 비교용 독립 VM이 같이 씀 */
+    static void BindEngineAPI(sol::state& State);
+
+    /**
+     * NumInstances개의 스크립트 인스턴스를 컴포넌트마다 VM을 만들던 방식과 공유 VM 방식으로 각각 만들고
+     * 걸린 시간과 Lua 메모리 사용량을 로그로 남김
+     */
+    void RunStartupBenchmark(int32 NumInstances, const FString& ScriptPath);
+
+    /** NumInstances개의 인스턴스를 이름으로 찾아 호출, 캐시된 핸들로 호출, TickBatch 한 번 호출하는 방식으로 각각 NumFrames 프레임 Tick해서 비교 */
+    void RunTickBenchmark(int32 NumInstances, int32 NumFrames);
+
+private:
+    FLuaScriptManager() = default;
+    ~FLuaScriptManager() = default;
+
+    struct FCompiledChunk
+    {
+        sol::bytecode Bytecode;
+        uint64 ContentHash = 0;
+        std::filesystem::file_time_type LastWriteTime;
+        uint32 Revision = 0;
+
+        /** 이 리비전의 배치용 TickBatch, 처음 요청될 때 만들고 거부되었으면 빈 함수 */
+        sol::protected_function BatchTickFunction;
+        bool bBatchTickResolved = false;
+    };
+
+    /** 같은 스크립트, 같은 청크 리비전을 쓰는 인스턴스들의 이번 TickGroup 배치 */
+    struct FBatchTickGroup
+    {
+        /** CancelBatchTick으로 제거된 항목은 nullptr */
+        TArray<ULuaScriptComponent*> Components;
+
+        /** 그룹의 리비전으로 만든 배치용 TickBatch, 모든 인스턴스가 같은 함수를 가짐 */
+        sol::protected_function BatchFunction;
+
+        /** Lua로 넘기는 배열, 프레임마다 다시 만들지 않고 재사용 */
+        sol::table Instances;
+        sol::table Locations;
+        sol::table Rotations;
+        int32 NumPacked = 0;
+
+        /** Lua로 넘긴 값, 돌려받은 값과 비교해서 바뀐 Actor에만 Set을 호출 */
+        TArray<FVector> PackedLocations;
+        TArray<FRotator> PackedRotations;
+    };
+
+    void InitializeLuaState();
+
+    void FlushBatchTickGroup(FBatchTickGroup& Group);
+
+    sol::protected_function CreateBatchTickFunction(const FString& ScriptPath, const sol::protected_function& InstanceFunction);
+
+    /** 바이트코드로 새 클로저를 만들어 Env에서 실행 */
+    bool RunBytecode(const sol::bytecode& Bytecode, const std::string& ChunkName, const sol::environment& Env);
+
+    /** ScriptPath를 읽어 컴파일, 실패하면 OutChunk를 건드리지 않음 */
+    bool CompileChunk(const FString& ScriptPath, FCompiledChunk& OutChunk, bool bSkipIfUnchanged);
+
+    /**
+     * 컴포넌트가 엔진 종료 중 늦게 소멸되어도 환경 테이블 참조 해제가 유효하도록
+     * 프로세스가 끝날 때까지 해제하지 않음
+     */
+    sol::state* LuaState = nullptr;
+
+    /** 모든 환경 테이블이 공유하는 { __index = _G } */
+    sol::table EnvironmentMetatable;
+
+    /** 배치용 TickBatch의 _ENV, { __index = _G, __newindex = error } */
+    sol::environment BatchEnvironment;
+
+    TMap<FString, FCompiledChunk> Chunks;
+
+    /** (스크립트 경로, 청크 리비전)별 배치 */
+    TMap<FLuaBatchTickKey, FBatchTickGroup> BatchTickGroups;
+    float BatchDeltaTime = 0.f;
+    bool bBatchFlushQueued = false;
+    uint32 NextRevision = 1;
+
+    double LastPollSeconds = 0.0;
+    double TotalCompileMs = 0.0;
+    uint32 NumCompiles = 0;
+    uint32 NumEnvironments = 0;
+
+    static constexpr double POLL_INTERVAL_SECONDS = 0.25;
+};
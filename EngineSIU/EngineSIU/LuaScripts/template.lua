@@ -52,6 +52,15 @@ function Tick(dt)
     -- actor.Location.X = actor.Location.X + dt
 end
 
+-- TickBatch를 정의하면 Tick 대신 같은 스크립트의 인스턴스 전체에 대해 프레임마다 한 번 호출됨
+-- Locations, Rotations는 x, y, z / Pitch, Yaw, Roll 순서로 펼친 배열이고 바꾼 값은 Actor에 반영됨
+-- function TickBatch(Instances, Locations, Rotations, dt)
+--     for i = 1, #Instances do
+--         local Base = i * 3 - 2
+--         Rotations[Base + 1] = Rotations[Base + 1] + Instances[i].turnSpeed * dt
+--     end
+-- end
+
 function BeginOverlap()
 end
 
@@ -0,0 +1,133 @@
+#include "NullSoundBackend.h"
+#include <filesystem>
+#include <cmath>
+#include "Container/Array.h"
+
+bool FNullSoundBackend::Initialize(int32 MaxRealChannels)
+{
+    MaxChannels = MaxRealChannels;
+    return true;
+}
+
+void FNullSoundBackend::Shutdown()
+{
+    Channels.Empty();
+    Sounds.Empty();
+}
+
+void FNullSoundBackend::Update(float DeltaTime)
+{
+    for (auto& [Handle, Sound] : Sounds)
+    {
+        if (Sound.State == ESoundLoadState::Loading)
+        {
+            Sound.State = ESoundLoadState::Ready;
+        }
+    }
+
+    TArray<FSoundBackendHandle> FinishedChannels;
+    for (auto& [Handle, Channel] : Channels)
+    {
+        const FNullSound* Sound = Sounds.Find(Channel.Sound);
+        if (!Sound)
+        {
+            FinishedChannels.Add(Handle);
+            continue;
+        }
+
+        Channel.Position += DeltaTime;
+        if (Channel.Position >= DefaultSoundLength)
+        {
+            if (Sound->bLoop)
+            {
+                Channel.Position = std::fmod(Channel.Position, DefaultSoundLength);
+            }
+            else
+            {
+                FinishedChannels.Add(Handle);
+            }
+        }
+    }
+
+    for (const FSoundBackendHandle Handle : FinishedChannels)
+    {
+        Channels.Remove(Handle);
+    }
+}
+
+FSoundBackendHandle FNullSoundBackend::LoadSoundAsync(const std::string& FilePath, bool bLoop)
+{
+    FNullSound Sound;
+    Sound.bLoop = bLoop;
+    if (!std::filesystem::exists(FilePath))
+    {
+        Sound.State = ESoundLoadState::Failed;
+    }
+
+    const FSoundBackendHandle Handle = NextHandle++;
+    Sounds.Add(Handle, Sound);
+    return Handle;
+}
+
+ESoundLoadState FNullSoundBackend::GetLoadState(FSoundBackendHandle Sound)
+{
+    const FNullSound* Found = Sounds.Find(Sound);
+    return Found ? Found->State : ESoundLoadState::Failed;
+}
+
+float FNullSoundBackend::GetSoundLength(FSoundBackendHandle Sound)
+{
+    const FNullSound* Found = Sounds.Find(Sound);
+    return Found && Found->State == ESoundLoadState::Ready ? DefaultSoundLength : 0.f;
+}
+
+void FNullSoundBackend::ReleaseSound(FSoundBackendHandle Sound)
+{
+    Sounds.Remove(Sound);
+}
+
+FSoundBackendHandle FNullSoundBackend::PlayChannel(FSoundBackendHandle Sound, float Volume, float StartSeconds)
+{
+    if (GetLoadState(Sound) != ESoundLoadState::Ready || static_cast<int32>(Channels.Num()) >= MaxChannels)
+    {
+        return 0;
+    }
+
+    FNullChannel Channel;
+    Channel.Sound = Sound;
+    Channel.Position = StartSeconds;
+    Channel.Volume = Volume;
+
+    const FSoundBackendHandle Handle = NextHandle++;
+    Channels.Add(Handle, Channel);
+    return Handle;
+}
+
+void FNullSoundBackend::StopChannel(FSoundBackendHandle Channel)
+{
+    Channels.Remove(Channel);
+}
+
+bool FNullSoundBackend::IsChannelPlaying(FSoundBackendHandle Channel)
+{
+    return Channels.Contains(Channel);
+}
+
+void FNullSoundBackend::SetChannelVolume(FSoundBackendHandle Channel, float Volume)
+{
+    if (FNullChannel* Found = Channels.Find(Channel))
+    {
+        Found->Volume = Volume;
+    }
+}
+
+float FNullSoundBackend::GetChannelPosition(FSoundBackendHandle Channel)
+{
+    const FNullChannel* Found = Channels.Find(Channel);
+    return Found ? Found->Position : 0.f;
+}
+
+void FNullSoundBackend::StopAllChannels()
+{
+    Channels.Empty();
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "SoundBackend.h"
+#include "Container/Map.h"
+
+/**
+ * 소리를 내지 않는 백엔드, 장치나 FMOD 없이 FSoundManager의 보이스 정책을 돌려볼 때 사용
+ *
+ * - 파일이 있으면 다음 Update에서 로드가 끝난 것으로 처리하고, 없으면 Failed
+ * - 파일을 디코딩하지 않으므로 모든 사운드의 길이는 DefaultSoundLength
+ * - 채널은 Update의 DeltaTime만큼 재생 위치가 흐르고, 루프가 아니면 길이에 도달할 때 끝남
+ */
+class FNullSoundBackend : public ISoundBackend
+{
+public:
+    explicit FNullSoundBackend(float InDefaultSoundLength = 1.f) : DefaultSoundLength(InDefaultSoundLength) {}
+
+    virtual bool Initialize(int32 MaxRealChannels) override;
+    virtual void Shutdown() override;
+    virtual void Update(float DeltaTime) override;
+
+    virtual FSoundBackendHandle LoadSoundAsync(const std::string& FilePath, bool bLoop) override;
+    virtual ESoundLoadState GetLoadState(FSoundBackendHandle Sound) override;
+    virtual float GetSoundLength(FSoundBackendHandle Sound) override;
+    virtual void ReleaseSound(FSoundBackendHandle Sound) override;
+
+    virtual FSoundBackendHandle PlayChannel(FSoundBackendHandle Sound, float Volume, float StartSeconds) override;
+    virtual void StopChannel(FSoundBackendHandle Channel) override;
+    virtual bool IsChannelPlaying(FSoundBackendHandle Channel) override;
+    virtual void SetChannelVolume(FSoundBackendHandle Channel, float Volume) override;
+    virtual float GetChannelPosition(FSoundBackendHandle Channel) override;
+    virtual void StopAllChannels() override;
+
+    int32 GetNumPlayingChannels() const { return static_cast<int32>(Channels.Num()); }
+
+private:
+    struct FNullSound
+    {
+        ESoundLoadState State = ESoundLoadState::Loading;
+        bool bLoop = false;
+    };
+
+    struct FNullChannel
+    {
+        FSoundBackendHandle Sound = 0;
+        float Position = 0.f;
+        float Volume = 1.f;
+    };
+
+    float DefaultSoundLength;
+    int32 MaxChannels = 0;
+    FSoundBackendHandle NextHandle = 1;
+
+    TMap<FSoundBackendHandle, FNullSound> Sounds;
+    TMap<FSoundBackendHandle, FNullChannel> Channels;
+};
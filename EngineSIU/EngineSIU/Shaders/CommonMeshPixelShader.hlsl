@@ -24,22 +24,6 @@ cbuffer TextureConstants : register(b4)
     float2 TexturePad0;
 }
 
-cbuffer TileLightCullSettings : register(b8)
-{
-    uint2 ScreenSize; // 화면 해상도
-    uint2 TileSize; // 한 타일의 크기 (예: 16x16)
-
-    float NearZ; // 카메라 near plane
-    float FarZ; // 카메라 far plane
-
-    row_major matrix TileViewMatrix; // View 행렬
-    row_major matrix TileProjectionMatrix; // Projection 행렬
-    row_major matrix TileInverseProjection; // Projection^-1, 뷰스페이스 복원용
-
-    uint NumLights; // 총 라이트 수
-    uint Enable25DCulling; // 1이면 2.5D 컬링 사용
-}
-
 #include "Light.hlsl"
 
 float4 mainPS(PS_INPUT_CommonMesh Input) : SV_Target
@@ -72,8 +56,7 @@ float4 mainPS(PS_INPUT_CommonMesh Input) : SV_Target
 
         float3x3 TBN = float3x3(Tangent, BiTangent, WorldNormal);
         
-        float3 Normal = MaterialTextures[TEXTURE_SLOT_NORMAL].Sample(MaterialSamplers[TEXTURE_SLOT_NORMAL], Input.UV).rgb;
-        Normal = normalize(2.f * Normal - 1.f);
+        float3 Normal = DecodeNormalMap(MaterialTextures[TEXTURE_SLOT_NORMAL].Sample(MaterialSamplers[TEXTURE_SLOT_NORMAL], Input.UV));
         WorldNormal = normalize(mul(Normal, TBN));
     }
 
@@ -118,13 +101,8 @@ float4 mainPS(PS_INPUT_CommonMesh Input) : SV_Target
     }
 #endif
     
-    // Begin for Tile based light culled result
-    // 현재 픽셀이 속한 타일 계산 (input.position = 화면 픽셀좌표계)
-    uint2 PixelCoord = uint2(Input.Position.xy);
-    uint2 TileCoord = PixelCoord / TileSize; // 각 성분별 나눔
-    uint TilesX = ScreenSize.x / TileSize.x; // 한 행에 존재하는 타일 수
-    uint FlatTileIndex = TileCoord.x + TileCoord.y * TilesX;
-    // End for Tile based light culled result
+    // 현재 픽셀이 속한 라이트 클러스터 (input.position = 화면 픽셀좌표계)
+    uint ClusterIndex = GetLightClusterIndex(Input.Position.xy, Input.WorldPosition);
     
     // Lighting
     float4 FinalPixelColor = float4(0.f, 0.f, 0.f, 1.f);
@@ -147,7 +125,7 @@ float4 mainPS(PS_INPUT_CommonMesh Input) : SV_Target
             Shininess,
     #endif
             BaseAlpha,
-            FlatTileIndex
+            ClusterIndex
         );
 
         // Apply Emissive
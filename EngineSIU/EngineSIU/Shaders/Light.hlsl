@@ -11,8 +11,6 @@
 #define DIRECTIONAL_LIGHT   3
 #define AMBIENT_LIGHT       4
 
-#define MAX_LIGHT_PER_TILE 1024
-
 #define NEAR_PLANE 0.1
 #define LIGHT_RADIUS_WORLD 7
 
@@ -64,8 +62,10 @@ struct FPointLightInfo
     
     uint CastShadows;
     float ShadowBias;
-    uint ShadowMapArrayIndex; // 필요시
-    float Padding2; // 필요시
+    float Padding2;
+    float Padding3;
+
+    float4 ShadowAtlasRects[6]; // xy: UV 오프셋, zw: UV 크기
 };
 
 struct FSpotLightInfo
@@ -88,8 +88,10 @@ struct FSpotLightInfo
     
     uint CastShadows;
     float ShadowBias;
-    uint ShadowMapArrayIndex; // 필요시
-    float Padding2; // 필요시
+    float Padding2;
+    float Padding3;
+
+    float4 ShadowAtlasRect; // xy: UV 오프셋, zw: UV 크기
 };
 
 cbuffer FLightInfoBuffer : register(b0)
@@ -121,13 +123,6 @@ cbuffer CascadeConstantBuffer : register(b9)
     float2 cascadepad;
 };
 
-struct LightPerTiles
-{
-    uint NumLights;
-    uint Indices[MAX_LIGHT_PER_TILE];
-    uint Padding[3];
-};
-
 // 인덱스별 색 지정 함수
 float4 DebugCSMColor(uint idx)
 {
@@ -149,16 +144,44 @@ float4 DebugCSMColor(uint idx)
 StructuredBuffer<FPointLightInfo> gPointLights : register(t10);
 StructuredBuffer<FSpotLightInfo> gSpotLights   : register(t11);
 
-StructuredBuffer<uint> PerTilePointLightIndexBuffer : register(t12);
-StructuredBuffer<uint> PerTileSpotLightIndexBuffer  : register(t13);
+// 클러스터별 (Offset, Count), Count의 하위 16비트는 포인트 라이트 수, 상위 16비트는 스팟 라이트 수
+StructuredBuffer<uint2> LightClusterRanges : register(t12);
+StructuredBuffer<uint> LightClusterIndices : register(t13);
+
+cbuffer LightClusterConstants : register(b6)
+{
+    uint ClusterCountX;
+    uint ClusterCountY;
+    uint ClusterCountZ;
+    uint bClusterOrthographic;
+
+    float ClusterZSliceScale;
+    float ClusterZSliceBias;
+    float2 ClusterViewportOffset;
+
+    float2 ClusterViewportSize;
+    float2 ClusterPad0;
+}
+
+// 화면 타일(X, Y)과 뷰 공간 깊이 슬라이스(Z)로 픽셀이 속한 클러스터를 찾음, 원근이면 슬라이스는 깊이의 로그에 비례
+uint GetLightClusterIndex(float2 PixelPosition, float3 WorldPosition)
+{
+    float2 ScreenUV = saturate((PixelPosition - ClusterViewportOffset) / ClusterViewportSize);
+    uint2 Tile = min(uint2(ScreenUV * float2(ClusterCountX, ClusterCountY)), uint2(ClusterCountX - 1, ClusterCountY - 1));
+
+    float ViewZ = mul(float4(WorldPosition, 1), ViewMatrix).z;
+    float SliceInput = bClusterOrthographic ? ViewZ : log(max(ViewZ, 1e-4));
+    uint Slice = (uint)clamp(floor(SliceInput * ClusterZSliceScale + ClusterZSliceBias), 0.0, (float)ClusterCountZ - 1.0);
+
+    return (Slice * ClusterCountY + Tile.y) * ClusterCountX + Tile.x;
+}
 
 // Begin Shadow
 SamplerComparisonState ShadowSamplerCmp : register(s10);
 SamplerState ShadowPointSampler : register(s11);
 
-Texture2DArray SpotShadowMapArray : register(t50);
+Texture2D LocalLightShadowAtlas : register(t50); // 스팟 라이트와 포인트 라이트 면이 함께 들어있는 아틀라스
 Texture2DArray DirectionShadowMapArray : register(t51);
-TextureCubeArray PointShadowMapArray : register(t52);
 
 uint GetCascadeIndex(float ViewDepth)
 {
@@ -301,58 +324,54 @@ int GetMajorFaceIndex(float3 Dir)
     return Dir.z > 0.0f ? 4 : 5;
 }
 
+// 라이트 클립 공간 좌표를 아틀라스 영역 안의 비교 샘플로 바꿈, 영역이 없으면 그림자 없음
+float SampleShadowAtlas(float4 PosLightClip, float4 AtlasRect, float ShadowBias,
+                        Texture2D ShadowAtlas, SamplerComparisonState ShadowSampler)
+{
+    if (AtlasRect.z <= 0.0f)
+    {
+        return 1.0f;
+    }
+
+    float2 TileUV = PosLightClip.xy / PosLightClip.w * float2(0.5, -0.5) + 0.5;
+    if (any(TileUV < 0.0f) || any(TileUV > 1.0f))
+    {
+        return 1.0f;
+    }
+
+    // 선형 비교 필터가 옆 영역의 텍셀을 섞지 않도록 영역 안쪽 반 텍셀까지만 샘플링
+    float2 AtlasSize;
+    ShadowAtlas.GetDimensions(AtlasSize.x, AtlasSize.y);
+    const float2 HalfTexel = 0.5f / AtlasSize;
+    float2 AtlasUV = AtlasRect.xy + TileUV * AtlasRect.zw;
+    AtlasUV = clamp(AtlasUV, AtlasRect.xy + HalfTexel, AtlasRect.xy + AtlasRect.zw - HalfTexel);
+
+    float CurrentDepth = PosLightClip.z / PosLightClip.w;
+    return ShadowAtlas.SampleCmpLevelZero(ShadowSampler, AtlasUV, CurrentDepth - ShadowBias);
+}
+
 float CalculatePointShadowFactor(float3 WorldPosition, FPointLightInfo LightInfo, // 라이트 정보 전체 전달
-                                TextureCubeArray ShadowMapArray,
+                                Texture2D ShadowAtlas,
                                 SamplerComparisonState ShadowSampler)
 {
-    // 1) 광원→조각 방향 (큐브맵 샘플링 좌표)
+    // 광원→조각 방향으로 면을 고르고, 그 면의 뷰·프로젝션으로 아틀라스 영역을 샘플링
     float3 Dir = normalize(WorldPosition - LightInfo.Position);
-    // 2) 해당 face의 뷰·프로젝션 적용
     int face = GetMajorFaceIndex(Dir);
     float4 posCS = mul(float4(WorldPosition, 1.0f), LightInfo.LightViewProj[face]);
-    // 3) 클립스페이스 깊이
-    float refDepth = posCS.z / posCS.w;
-    // 5) 하드웨어 비교 샘플
-    float3 SampleDir = normalize(WorldPosition - LightInfo.Position);
-    float shadow = ShadowMapArray.SampleCmpLevelZero(ShadowSampler, float4(SampleDir, (float)LightInfo.ShadowMapArrayIndex), refDepth - LightInfo.ShadowBias).r;
-    return shadow;
+    return SampleShadowAtlas(posCS, LightInfo.ShadowAtlasRects[face], LightInfo.ShadowBias, ShadowAtlas, ShadowSampler);
 }
 
 // 기본적인 그림자 계산 함수 (Directional/Spot 용)
 // 하드웨어 PCF (SamplerComparisonState 사용) 예시
 float CalculateSpotShadowFactor(float3 WorldPosition, FSpotLightInfo LightInfo, // 라이트 정보 전체 전달
-                                Texture2DArray ShadowMapArray,
+                                Texture2D ShadowAtlas,
                                 SamplerComparisonState ShadowSampler)
 {
-    // if (!LightInfo.CastShadows)
-    // {
-    //     return 1.0f; // 그림자 안 드리움
-    // }
-
     // 1 & 2. 라이트 클립 공간 좌표 계산
     float4 PixelPosLightClip = mul(float4(WorldPosition, 1.0f), LightInfo.LightViewProj);
 
-    // 3. 섀도우 맵 UV 계산 [0, 1]
-    float2 ShadowMapUV = PixelPosLightClip.xy / PixelPosLightClip.w;
-    ShadowMapUV = ShadowMapUV * float2(0.5, -0.5) + 0.5; // Y 반전 필요시
-
-    // 4. 현재 깊이 계산
-    float CurrentDepth = PixelPosLightClip.z / PixelPosLightClip.w;
-
-    // UV 범위 체크 (라이트 범위 밖)
-    if (any(ShadowMapUV < 0.0f) || any(ShadowMapUV > 1.0f))
-    {
-        return 1.0f;
-    }
-
-    // 5 & 6. 배열의 특정 슬라이스 샘플링 및 비교
-    float ShadowFactor = ShadowMapArray.SampleCmpLevelZero(
-        ShadowSampler,
-        float3(ShadowMapUV, (float)LightInfo.ShadowMapArrayIndex), // UV와 배열 인덱스 사용
-        CurrentDepth - LightInfo.ShadowBias  // 바이어스 적용
-    );
-
-    return ShadowFactor;
+    // 3. 아틀라스의 라이트 영역에서 비교 샘플링
+    return SampleShadowAtlas(PixelPosLightClip, LightInfo.ShadowAtlasRect, LightInfo.ShadowBias, ShadowAtlas, ShadowSampler);
 }
 // End Shadow
 
@@ -534,7 +553,7 @@ FLightOutput PointLight(int Index, float3 WorldPosition, float3 WorldNormal, flo
     if (LightInfo.CastShadows && IsShadow)
     {
         // 그림자 계산
-        Shadow = CalculatePointShadowFactor(WorldPosition, LightInfo, PointShadowMapArray, ShadowSamplerCmp);
+        Shadow = CalculatePointShadowFactor(WorldPosition, LightInfo, LocalLightShadowAtlas, ShadowSamplerCmp);
         // 그림자 계수가 0 이하면 더 이상 계산 불필요
         if (Shadow <= 0.0)
         {
@@ -594,7 +613,7 @@ FLightOutput SpotLight(int Index, float3 WorldPosition, float3 WorldNormal, floa
     if (LightInfo.CastShadows && IsShadow)
     {
         // 그림자 계산
-        Shadow  = CalculateSpotShadowFactor(WorldPosition, LightInfo, SpotShadowMapArray, ShadowSamplerCmp);
+        Shadow  = CalculateSpotShadowFactor(WorldPosition, LightInfo, LocalLightShadowAtlas, ShadowSamplerCmp);
         // 그림자 계수가 0 이하면 더 이상 계산 불필요
         if (Shadow <= 0.0)
         {
@@ -713,7 +732,7 @@ float4 Lighting(float3 WorldPosition, float3 WorldNormal, float3 WorldViewPositi
     float3 DiffuseColor, float3 SpecularColor, float Shininess,
 #endif
     float BaseAlpha,
-    uint TileIndex
+    uint ClusterIndex
 )
 {
     /**
@@ -729,56 +748,41 @@ float4 Lighting(float3 WorldPosition, float3 WorldNormal, float3 WorldViewPositi
     float MaxObservedSpecularLuminance = 0.0f;
 
     
-    // 조명 계산
-    int BucketsPerTile = MAX_LIGHT_PER_TILE / 32;
-    int StartIndex = TileIndex * BucketsPerTile;
-    for (int Bucket = 0; Bucket < BucketsPerTile; ++Bucket)
+    // 조명 계산, 클러스터 목록은 포인트 라이트 인덱스 뒤에 스팟 라이트 인덱스가 이어짐
+    uint2 ClusterRange = LightClusterRanges[ClusterIndex];
+    uint NumClusterPointLights = ClusterRange.y & 0xFFFF;
+    uint NumClusterSpotLights = ClusterRange.y >> 16;
+    for (uint i = 0; i < NumClusterPointLights; ++i)
     {
-        int PointMask = PerTilePointLightIndexBuffer[StartIndex + Bucket];
-        int SpotMask = PerTileSpotLightIndexBuffer[StartIndex + Bucket];
-        for (int bit = 0; bit < 32; ++bit)
-        {
-            if (PointMask & (1u << bit))
-            {
-                // 전역 조명 인덱스는 bucket * 32 + bit 로 계산됨.
-                // 전역 조명 인덱스가 총 조명 수보다 작은 경우에만 추가
-                int GlobalPointLightIndex = Bucket * 32 + bit;
-                if (GlobalPointLightIndex < MAX_LIGHT_PER_TILE) // TODO: MAX_LIGHT_PER_TILE 대신 실제 포인트 라이트 개수와 비교해야 함. (중요)
-                {
-                    FLightOutput Result = PointLight(
-                        GlobalPointLightIndex, WorldPosition, WorldNormal, WorldViewPosition,
+        FLightOutput Result = PointLight(
+            LightClusterIndices[ClusterRange.x + i], WorldPosition, WorldNormal, WorldViewPosition,
 #ifdef LIGHTING_MODEL_PBR
-                        BaseColor, Metallic, Roughness
+            BaseColor, Metallic, Roughness
 #else
-                        DiffuseColor, SpecularColor, Shininess
+            DiffuseColor, SpecularColor, Shininess
 #endif
-                    );
-                    AccumulatedDiffuseColor += Result.DiffuseContribution;
-                    AccumulatedSpecularColor += Result.SpecularContribution;
-                    
-                    MaxObservedSpecularLuminance = max(MaxObservedSpecularLuminance, dot(Result.SpecularContribution, LUMINANCE));
-                }
-            }
-            if (SpotMask & (1u << bit))
-            {
-                int GlobalSpotLightIndex = Bucket * 32 + bit;
-                if (GlobalSpotLightIndex < MAX_LIGHT_PER_TILE) // TODO: MAX_LIGHT_PER_TILE 대신 실제 스팟 라이트 개수와 비교해야 함. (중요)
-                {
-                    FLightOutput Result = SpotLight(
-                        GlobalSpotLightIndex, WorldPosition, WorldNormal, WorldViewPosition,
+        );
+        AccumulatedDiffuseColor += Result.DiffuseContribution;
+        AccumulatedSpecularColor += Result.SpecularContribution;
+
+        MaxObservedSpecularLuminance = max(MaxObservedSpecularLuminance, dot(Result.SpecularContribution, LUMINANCE));
+    }
+
+    uint SpotListStart = ClusterRange.x + NumClusterPointLights;
+    for (uint j = 0; j < NumClusterSpotLights; ++j)
+    {
+        FLightOutput Result = SpotLight(
+            LightClusterIndices[SpotListStart + j], WorldPosition, WorldNormal, WorldViewPosition,
 #ifdef LIGHTING_MODEL_PBR
-                        BaseColor, Metallic, Roughness
+            BaseColor, Metallic, Roughness
 #else
-                        DiffuseColor, SpecularColor, Shininess
+            DiffuseColor, SpecularColor, Shininess
 #endif
-                    );
-                    AccumulatedDiffuseColor += Result.DiffuseContribution;
-                    AccumulatedSpecularColor += Result.SpecularContribution;
-                    
-                    MaxObservedSpecularLuminance = max(MaxObservedSpecularLuminance, dot(Result.SpecularContribution, LUMINANCE));
-                }
-            }
-        }
+        );
+        AccumulatedDiffuseColor += Result.DiffuseContribution;
+        AccumulatedSpecularColor += Result.SpecularContribution;
+
+        MaxObservedSpecularLuminance = max(MaxObservedSpecularLuminance, dot(Result.SpecularContribution, LUMINANCE));
     }
     
     [unroll(MAX_DIRECTIONAL_LIGHT)]
@@ -94,6 +94,59 @@ struct VS_INPUT_SkeletalMesh
     float4 BoneWeights : BONE_WEIGHTS;
 };
 
+/**
+ * FPackedSkeletalMeshVertex, 복원 방식은 FVertexQuantization과 같아야 함
+ * 노멀은 팔면체 매핑(SNORM16 x2), 탄젠트는 팔면체 매핑(UNORM15 x2) + 30번 비트에 Bitangent 부호
+ */
+struct VS_INPUT_PackedSkeletalMesh
+{
+    float3 Position : POSITION;
+    float2 Normal : NORMAL;
+    uint Tangent : TANGENT;
+    float2 UV : TEXCOORD;
+    float4 Color : COLOR;
+    uint4 BoneIndices : BONE_INDICES;
+    float4 BoneWeights : BONE_WEIGHTS;
+};
+
+float3 DecodeOctahedron(float2 Encoded)
+{
+    float3 Vector = float3(Encoded.xy, 1.0 - abs(Encoded.x) - abs(Encoded.y));
+    float Fold = saturate(-Vector.z);
+    Vector.xy += (Vector.xy >= 0.0) ? -Fold : Fold;
+    return normalize(Vector);
+}
+
+/**
+ * 노멀 맵의 XY만 사용하고 Z는 단위 길이가 되도록 복원
+ * BC5로 쿡된 노멀 맵은 B 채널이 없으므로 RGB 노멀 맵도 같은 방식으로 해석
+ */
+float3 DecodeNormalMap(float4 Sampled)
+{
+    float2 XY = Sampled.xy * 2.0 - 1.0;
+    return float3(XY, sqrt(saturate(1.0 - dot(XY, XY))));
+}
+
+float4 DecodePackedTangent(uint Packed)
+{
+    float2 Encoded = float2(Packed & 0x7FFF, (Packed >> 15) & 0x7FFF) / 32767.0 * 2.0 - 1.0;
+    float Sign = (Packed & (1u << 30)) ? -1.0 : 1.0;
+    return float4(DecodeOctahedron(Encoded), Sign);
+}
+
+VS_INPUT_SkeletalMesh UnpackSkeletalMeshVertex(VS_INPUT_PackedSkeletalMesh Packed)
+{
+    VS_INPUT_SkeletalMesh Vertex;
+    Vertex.Position = Packed.Position;
+    Vertex.Color = Packed.Color;
+    Vertex.Normal = DecodeOctahedron(Packed.Normal);
+    Vertex.Tangent = DecodePackedTangent(Packed.Tangent);
+    Vertex.UV = Packed.UV;
+    Vertex.BoneIndices = Packed.BoneIndices;
+    Vertex.BoneWeights = Packed.BoneWeights;
+    return Vertex;
+}
+
 struct PS_INPUT_CommonMesh
 {
     float4 Position : SV_POSITION;
@@ -0,0 +1,8 @@
+// Shadow Atlas Clear Vertex Shader
+// 뷰포트로 지정한 아틀라스 영역 전체를 덮는 삼각형 하나를 깊이 1로 그림
+
+float4 mainVS(uint VertexID : SV_VertexID) : SV_POSITION
+{
+    float2 UV = float2((VertexID << 1) & 2, VertexID & 2);
+    return float4(UV * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 1.0f, 1.0f);
+}
@@ -22,8 +22,14 @@ cbuffer MaterialConstants : register(b1)
 #include "Light.hlsl"
 #endif
 
+#ifdef PACKED_VERTEX
+PS_INPUT_CommonMesh mainVS(VS_INPUT_PackedSkeletalMesh PackedInput)
+{
+    VS_INPUT_SkeletalMesh Input = UnpackSkeletalMeshVertex(PackedInput);
+#else
 PS_INPUT_CommonMesh mainVS(VS_INPUT_SkeletalMesh Input)
 {
+#endif
     PS_INPUT_CommonMesh Output;
 
     float4 SkinnedPosition = float4(0, 0, 0, 0);
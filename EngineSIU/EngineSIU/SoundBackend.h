@@ -0,0 +1,56 @@
+#pragma once
+#include <string>
+
+#include "HAL/PlatformType.h"
+
+/** ISoundBackend가 돌려주는 사운드, 채널 식별자, 0은 유효하지 않음 */
+using FSoundBackendHandle = uint64;
+
+enum class ESoundLoadState : uint8
+{
+    Loading,
+    Ready,
+    Failed,
+};
+
+/**
+ * FSoundManager 아래의 오디오 API
+ *
+ * 어떤 보이스를 실제 채널로 재생할지는 FSoundManager가 정하고, 백엔드는 사운드 로딩과 채널 재생만 담당
+ * FMOD 없이도 보이스 정책을 돌려볼 수 있도록 FNullSoundBackend를 같이 둠
+ */
+class ISoundBackend
+{
+public:
+    virtual ~ISoundBackend() {}
+
+    virtual bool Initialize(int32 MaxRealChannels) = 0;
+
+    virtual void Shutdown() = 0;
+
+    virtual void Update(float DeltaTime) = 0;
+
+    /** 로드를 시작하고 바로 반환, 완료 여부는 GetLoadState로 확인 */
+    virtual FSoundBackendHandle LoadSoundAsync(const std::string& FilePath, bool bLoop) = 0;
+
+    virtual ESoundLoadState GetLoadState(FSoundBackendHandle Sound) = 0;
+
+    /** 초 단위 길이, 로드가 끝나지 않았으면 0 */
+    virtual float GetSoundLength(FSoundBackendHandle Sound) = 0;
+
+    virtual void ReleaseSound(FSoundBackendHandle Sound) = 0;
+
+    /** StartSeconds부터 재생하는 채널, 실패하면 0 */
+    virtual FSoundBackendHandle PlayChannel(FSoundBackendHandle Sound, float Volume, float StartSeconds) = 0;
+
+    virtual void StopChannel(FSoundBackendHandle Channel) = 0;
+
+    virtual bool IsChannelPlaying(FSoundBackendHandle Channel) = 0;
+
+    virtual void SetChannelVolume(FSoundBackendHandle Channel, float Volume) = 0;
+
+    /** 초 단위 재생 위치 */
+    virtual float GetChannelPosition(FSoundBackendHandle Channel) = 0;
+
+    virtual void StopAllChannels() = 0;
+};
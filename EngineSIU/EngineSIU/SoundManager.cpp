@@ -1 +1,602 @@
 #include "SoundManager.h"
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+
+#include "NullSoundBackend.h"
+#include "UserInterface/Console.h"
+#if defined(_WIN32)
+#include "FmodSoundBackend.h"
+#endif
+
+FSoundManager::FSoundManager()
+{
+    CategorySettings.SetNum(static_cast<int32>(ESoundCategory::Max));
+    CategorySettings[static_cast<int32>(ESoundCategory::Music)] = { 4, 1.f };
+    CategorySettings[static_cast<int32>(ESoundCategory::Effect)] = { 32, 1.f };
+    CategorySettings[static_cast<int32>(ESoundCategory::Footstep)] = { 8, 1.f };
+    CategorySettings[static_cast<int32>(ESoundCategory::UI)] = { 8, 1.f };
+
+    NumCategoryVoices.Init(0, static_cast<int32>(ESoundCategory::Max));
+}
+
+bool FSoundManager::Initialize(std::unique_ptr<ISoundBackend> InBackend)
+{
+    Shutdown();
+
+    Backend = std::move(InBackend);
+    if (!Backend)
+    {
+#if defined(_WIN32)
+        Backend = std::make_unique<FFmodSoundBackend>();
+#else
+        Backend = std::make_unique<FNullSoundBackend>();
+#endif
+    }
+
+    // 실제 채널 수는 보이스 관리에서 제한하므로 백엔드에는 약간의 여유만 둠
+    if (!Backend->Initialize(MAX_REAL_VOICES + 8))
+    {
+        Backend.reset();
+        return false;
+    }
+
+    Stats = FSoundVoiceStats();
+    return true;
+}
+
+void FSoundManager::Shutdown()
+{
+    if (!Backend)
+    {
+        return;
+    }
+
+    StopAllSounds();
+
+    for (auto& pair : soundMap)
+    {
+        Backend->ReleaseSound(pair.second.Handle);
+    }
+    soundMap.clear();
+    NumLoadingSounds = 0;
+
+    Backend->Shutdown();
+    Backend.reset();
+}
+
+bool FSoundManager::LoadSound(const std::string& name, const std::string& filePath, bool loop)
+{
+    if (soundMap.find(name) != soundMap.end())
+    {
+        return true;
+    }
+    if (!Backend)
+    {
+        return false;
+    }
+
+    const FSoundBackendHandle Handle = Backend->LoadSoundAsync(filePath, loop);
+    if (!Handle)
+    {
+        return false;
+    }
+
+    FSoundAsset& Asset = soundMap[name];
+    Asset.Handle = Handle;
+    Asset.bLoop = loop;
+    Asset.State = ESoundLoadState::Loading;
+    ++NumLoadingSounds;
+    return true;
+}
+
+void FSoundManager::PreloadDirectory(const std::string& Directory)
+{
+    std::error_code ErrorCode;
+    for (const auto& Entry : std::filesystem::directory_iterator(Directory, ErrorCode))
+    {
+        if (!Entry.is_regular_file())
+        {
+            continue;
+        }
+
+        const std::string Extension = Entry.path().extension().string();
+        if (Extension == ".mp3" || Extension == ".wav" || Extension == ".ogg")
+        {
+            LoadSound(Entry.path().stem().string(), Entry.path().generic_string());
+        }
+    }
+}
+
+bool FSoundManager::IsSoundReady(const std::string& name) const
+{
+    const auto it = soundMap.find(name);
+    return it != soundMap.end() && it->second.State == ESoundLoadState::Ready;
+}
+
+FSoundVoiceHandle FSoundManager::PlaySound(const std::string& name, const FSoundPlayParams& Params)
+{
+    auto it = soundMap.find(name);
+    if (it == soundMap.end() || it->second.State == ESoundLoadState::Failed)
+    {
+        return FSoundVoiceHandle();
+    }
+
+    const int32 CategoryIndex = static_cast<int32>(Params.Category);
+
+    FSoundVoice NewVoice;
+    NewVoice.Asset = &it->second;
+    NewVoice.Params = Params;
+    NewVoice.Audibility = ComputeAudibility(Params);
+    NewVoice.StartOrder = NextStartOrder++;
+
+    // 카테고리가 가득 찼다면 점수가 가장 낮은 보이스를 뺏고, 새 보이스가 가장 낮다면 재생하지 않음
+    if (NumCategoryVoices[CategoryIndex] >= CategorySettings[CategoryIndex].MaxVoices)
+    {
+        int32 LowestIndex = INDEX_NONE;
+        for (int32 Index = 0; Index < Voices.Num(); ++Index)
+        {
+            const FSoundVoice& Voice = Voices[Index];
+            if (Voice.Generation == 0 || Voice.Params.Category != Params.Category)
+            {
+                continue;
+            }
+            if (LowestIndex == INDEX_NONE || IsHigherScore(Voices[LowestIndex], Voice))
+            {
+                LowestIndex = Index;
+            }
+        }
+
+        if (LowestIndex == INDEX_NONE || !IsHigherScore(NewVoice, Voices[LowestIndex]))
+        {
+            ++Stats.NumRejectedPlays;
+            return FSoundVoiceHandle();
+        }
+
+        StopVoice(LowestIndex);
+        ++Stats.NumStolenVoices;
+    }
+
+    uint32 VoiceIndex;
+    if (FreeVoices.Num() > 0)
+    {
+        VoiceIndex = FreeVoices.Pop();
+    }
+    else
+    {
+        VoiceIndex = Voices.AddDefaulted();
+    }
+
+    NewVoice.Generation = NextGeneration++;
+    if (NextGeneration == 0)
+    {
+        NextGeneration = 1;
+    }
+
+    // 채널은 다음 Update에서 점수 순서대로 배정
+    Voices[VoiceIndex] = NewVoice;
+    ++NumCategoryVoices[CategoryIndex];
+
+    return FSoundVoiceHandle{ VoiceIndex, NewVoice.Generation };
+}
+
+void FSoundManager::StopSound(FSoundVoiceHandle Handle)
+{
+    if (FindVoice(Handle))
+    {
+        StopVoice(Handle.Index);
+    }
+}
+
+bool FSoundManager::IsVoiceActive(FSoundVoiceHandle Handle) const
+{
+    return FindVoice(Handle) != nullptr;
+}
+
+bool FSoundManager::IsVoiceAudible(FSoundVoiceHandle Handle) const
+{
+    const FSoundVoice* Voice = FindVoice(Handle);
+    return Voice && Voice->Channel != 0;
+}
+
+void FSoundManager::SetVoiceLocation(FSoundVoiceHandle Handle, const FVector& Location)
+{
+    if (FSoundVoice* Voice = FindVoice(Handle))
+    {
+        Voice->Params.Location = Location;
+    }
+}
+
+void FSoundManager::SetCategorySettings(ESoundCategory Category, const FSoundCategorySettings& Settings)
+{
+    CategorySettings[static_cast<int32>(Category)] = Settings;
+}
+
+const FSoundCategorySettings& FSoundManager::GetCategorySettings(ESoundCategory Category) const
+{
+    return CategorySettings[static_cast<int32>(Category)];
+}
+
+void FSoundManager::Update(float DeltaTime)
+{
+    if (!Backend)
+    {
+        return;
+    }
+
+    Backend->Update(DeltaTime);
+
+    if (NumLoadingSounds > 0)
+    {
+        NumLoadingSounds = 0;
+        for (auto& pair : soundMap)
+        {
+            FSoundAsset& Asset = pair.second;
+            if (Asset.State != ESoundLoadState::Loading)
+            {
+                continue;
+            }
+
+            Asset.State = Backend->GetLoadState(Asset.Handle);
+            if (Asset.State == ESoundLoadState::Ready)
+            {
+                Asset.Length = Backend->GetSoundLength(Asset.Handle);
+            }
+            else if (Asset.State == ESoundLoadState::Failed)
+            {
+                std::cerr << "Failed to load sound: " << pair.first << std::endl;
+            }
+            else
+            {
+                ++NumLoadingSounds;
+            }
+        }
+    }
+
+    // 끝난 보이스를 정리하고 남은 보이스의 재생 위치와 들리는 정도를 갱신
+    SortedVoices.SetNum(0);
+    for (int32 Index = 0; Index < Voices.Num(); ++Index)
+    {
+        FSoundVoice& Voice = Voices[Index];
+        if (Voice.Generation == 0)
+        {
+            continue;
+        }
+
+        const FSoundAsset& Asset = *Voice.Asset;
+        if (Asset.State == ESoundLoadState::Failed)
+        {
+            StopVoice(Index);
+            continue;
+        }
+
+        if (Voice.Channel)
+        {
+            if (!Backend->IsChannelPlaying(Voice.Channel))
+            {
+                Voice.Channel = 0;
+                StopVoice(Index);
+                continue;
+            }
+            Voice.PlaybackSeconds = Backend->GetChannelPosition(Voice.Channel);
+        }
+        else if (Asset.State == ESoundLoadState::Ready)
+        {
+            Voice.PlaybackSeconds += DeltaTime;
+            if (Asset.Length > 0.f && Voice.PlaybackSeconds >= Asset.Length)
+            {
+                if (!Asset.bLoop)
+                {
+                    StopVoice(Index);
+                    continue;
+                }
+                Voice.PlaybackSeconds = std::fmod(Voice.PlaybackSeconds, Asset.Length);
+            }
+        }
+
+        Voice.Audibility = ComputeAudibility(Voice.Params);
+        SortedVoices.Add(Index);
+    }
+
+    SortedVoices.Sort([this](uint32 A, uint32 B) { return IsHigherScore(Voices[A], Voices[B]); });
+
+    int32 NumReal = 0;
+    for (const uint32 Index : SortedVoices)
+    {
+        FSoundVoice& Voice = Voices[Index];
+
+        // 이미 채널이 있는 보이스는 기준을 낮게 잡아 경계에서 채널을 계속 멈췄다 켜지 않도록 함
+        const float MinAudibility = Voice.Channel ? VIRTUALIZE_VOLUME : VIRTUALIZE_VOLUME * 2.f;
+        const bool bWantsChannel = NumReal < MAX_REAL_VOICES
+            && Voice.Asset->State == ESoundLoadState::Ready
+            && Voice.Audibility >= MinAudibility;
+
+        if (bWantsChannel)
+        {
+            if (!Voice.Channel)
+            {
+                Voice.Channel = Backend->PlayChannel(Voice.Asset->Handle, Voice.Audibility, Voice.PlaybackSeconds);
+                if (!Voice.Channel)
+                {
+                    continue;
+                }
+            }
+            else if (Voice.AppliedVolume != Voice.Audibility)
+            {
+                Backend->SetChannelVolume(Voice.Channel, Voice.Audibility);
+            }
+            Voice.AppliedVolume = Voice.Audibility;
+            ++NumReal;
+        }
+        else if (Voice.Channel)
+        {
+            Voice.PlaybackSeconds = Backend->GetChannelPosition(Voice.Channel);
+            Backend->StopChannel(Voice.Channel);
+            Voice.Channel = 0;
+            Voice.AppliedVolume = -1.f;
+        }
+    }
+
+    Stats.NumRealVoices = NumReal;
+    Stats.NumVirtualVoices = SortedVoices.Num() - NumReal;
+    Stats.NumLoadingSounds = NumLoadingSounds;
+}
+
+void FSoundManager::StopAllSounds()
+{
+    for (int32 Index = 0; Index < Voices.Num(); ++Index)
+    {
+        if (Voices[Index].Generation != 0)
+        {
+            StopVoice(Index);
+        }
+    }
+
+    if (Backend)
+    {
+        Backend->StopAllChannels();
+    }
+}
+
+TArray<std::string> FSoundManager::GetAllSoundNames() const
+{
+    TArray<std::string> names;
+    for (const auto& pair : soundMap)
+    {
+        names.Add(pair.first);
+    }
+    return names;
+}
+
+FSoundManager::FSoundVoice* FSoundManager::FindVoice(FSoundVoiceHandle Handle)
+{
+    if (!Handle.IsValid() || Handle.Index >= static_cast<uint32>(Voices.Num()) || Voices[Handle.Index].Generation != Handle.Generation)
+    {
+        return nullptr;
+    }
+    return &Voices[Handle.Index];
+}
+
+const FSoundManager::FSoundVoice* FSoundManager::FindVoice(FSoundVoiceHandle Handle) const
+{
+    return const_cast<FSoundManager*>(this)->FindVoice(Handle);
+}
+
+void FSoundManager::StopVoice(uint32 VoiceIndex)
+{
+    FSoundVoice& Voice = Voices[VoiceIndex];
+    if (Voice.Channel && Backend)
+    {
+        Backend->StopChannel(Voice.Channel);
+    }
+
+    --NumCategoryVoices[static_cast<int32>(Voice.Params.Category)];
+    Voice = FSoundVoice();
+    FreeVoices.Add(VoiceIndex);
+}
+
+float FSoundManager::ComputeAudibility(const FSoundPlayParams& Params) const
+{
+    float Audibility = Params.Volume * CategorySettings[static_cast<int32>(Params.Category)].Volume;
+    if (Params.bSpatial)
+    {
+        const float Distance = FVector::Distance(Params.Location, ListenerLocation);
+        if (Distance >= Params.MaxDistance)
+        {
+            return 0.f;
+        }
+        if (Distance > Params.MinDistance)
+        {
+            Audibility *= 1.f - (Distance - Params.MinDistance) / (Params.MaxDistance - Params.MinDistance);
+        }
+    }
+    return Audibility;
+}
+
+bool FSoundManager::IsHigherScore(const FSoundVoice& A, const FSoundVoice& B)
+{
+    if (A.Params.Priority != B.Params.Priority)
+    {
+        return A.Params.Priority > B.Params.Priority;
+    }
+    if (A.Audibility != B.Audibility)
+    {
+        return A.Audibility > B.Audibility;
+    }
+    return A.StartOrder > B.StartOrder;
+}
+
+bool FSoundManager::RunSelfTest(const std::string& SoundFilePath)
+{
+    constexpr float SoundLength = 2.f;
+    constexpr float DeltaTime = 1.f / 60.f;
+
+    FSoundManager Manager;
+    if (!Manager.Initialize(std::make_unique<FNullSoundBackend>(SoundLength)))
+    {
+        return false;
+    }
+
+    int32 NumFailures = 0;
+    auto Check = [&NumFailures](bool bCondition, const char* Description)
+    {
+        UE_LOG(bCondition ? ELogLevel::Display : ELogLevel::Error, "[Sound Test] %s: %s", bCondition ? "ok" : "FAILED", Description);
+        NumFailures += bCondition ? 0 : 1;
+    };
+
+    Manager.LoadSound("OneShot", SoundFilePath, false);
+    Manager.LoadSound("Loop", SoundFilePath, true);
+    Manager.LoadSound("Missing", SoundFilePath + ".missing", false);
+
+    // 로드가 끝나기 전에 재생한 보이스는 가상으로 기다리다가 로드가 끝난 Update에서 채널을 얻음
+    const FSoundVoiceHandle EarlyVoice = Manager.PlaySound("OneShot");
+    Check(EarlyVoice.IsValid() && !Manager.IsVoiceAudible(EarlyVoice), "Voice played before loading waits as a virtual voice");
+    Manager.Update(DeltaTime);
+    Check(Manager.IsSoundReady("OneShot") && Manager.IsVoiceAudible(EarlyVoice), "Voice becomes real once its sound is loaded");
+    Check(!Manager.PlaySound("Missing").IsValid(), "Sound that failed to load is not played");
+    Manager.StopSound(EarlyVoice);
+
+    // 카테고리가 가득 차면 점수가 가장 낮은 보이스를 뺏고, 새 보이스가 가장 낮으면 거부
+    {
+        const FSoundCategorySettings& Footstep = Manager.GetCategorySettings(ESoundCategory::Footstep);
+        FSoundPlayParams Params;
+        Params.Category = ESoundCategory::Footstep;
+
+        TArray<FSoundVoiceHandle> Footsteps;
+        for (int32 Index = 0; Index < Footstep.MaxVoices; ++Index)
+        {
+            Footsteps.Add(Manager.PlaySound("Loop", Params));
+        }
+
+        // 점수가 같다면 나중에 시작한 보이스가 이기므로 가장 오래된 보이스를 뺏음
+        const FSoundVoiceHandle Newest = Manager.PlaySound("Loop", Params);
+        Check(Newest.IsValid() && !Manager.IsVoiceActive(Footsteps[0]) && Manager.IsVoiceActive(Footsteps[1]),
+            "Full category steals the oldest voice of equal priority");
+
+        Params.Priority = -1;
+        Check(!Manager.PlaySound("Loop", Params).IsValid() && Manager.GetStats().NumRejectedPlays == 1,
+            "Full category rejects a lower priority voice");
+
+        Params.Priority = 1;
+        Params.Volume = 0.5f;
+        const FSoundVoiceHandle Important = Manager.PlaySound("Loop", Params);
+        Check(Important.IsValid() && !Manager.IsVoiceActive(Footsteps[1]) && Manager.GetStats().NumStolenVoices == 2,
+            "Higher priority voice steals from a full category even when quieter");
+
+        Manager.StopAllSounds();
+    }
+
+    // 실제 채널은 점수 순서로 MAX_REAL_VOICES개까지만, 너무 조용한 보이스는 예산이 남아도 가상
+    {
+        constexpr int32 NumVoices = MAX_REAL_VOICES * 2;
+        Manager.SetCategorySettings(ESoundCategory::Effect, { NumVoices, 1.f });
+
+        TArray<FSoundVoiceHandle> Handles;
+        TArray<float> Volumes;
+        for (int32 Index = 0; Index < NumVoices; ++Index)
+        {
+            FSoundPlayParams Params;
+            // 앞쪽 절반은 크게, 뒤쪽은 점점 작게 해서 마지막 몇 개는 가상 기준보다 조용함
+            Params.Volume = Index < MAX_REAL_VOICES ? 1.f - Index * 0.001f : 0.5f - (Index - MAX_REAL_VOICES) * 0.008f;
+            Volumes.Add(Params.Volume);
+            Handles.Add(Manager.PlaySound("Loop", Params));
+        }
+        Manager.Update(DeltaTime);
+
+        int32 NumWrongVoices = 0;
+        for (int32 Index = 0; Index < NumVoices; ++Index)
+        {
+            NumWrongVoices += Manager.IsVoiceAudible(Handles[Index]) == (Index < MAX_REAL_VOICES) ? 0 : 1;
+        }
+        Check(NumWrongVoices == 0 && Manager.GetStats().NumRealVoices == MAX_REAL_VOICES && Manager.GetStats().NumVirtualVoices == MAX_REAL_VOICES,
+            "Only the loudest MAX_REAL_VOICES voices get channels");
+
+        // 실제 보이스를 멈추면 가상 보이스 중 충분히 들리는 것만 채널을 얻음
+        for (int32 Index = 0; Index < MAX_REAL_VOICES; ++Index)
+        {
+            Manager.StopSound(Handles[Index]);
+        }
+        Manager.Update(DeltaTime);
+
+        NumWrongVoices = 0;
+        for (int32 Index = MAX_REAL_VOICES; Index < NumVoices; ++Index)
+        {
+            NumWrongVoices += Manager.IsVoiceAudible(Handles[Index]) == (Volumes[Index] >= VIRTUALIZE_VOLUME * 2.f) ? 0 : 1;
+        }
+        Check(NumWrongVoices == 0 && Manager.GetStats().NumRealVoices < MAX_REAL_VOICES,
+            "Virtual voices are promoted when channels free up, except those below the audibility threshold");
+
+        Manager.StopAllSounds();
+        Manager.SetCategorySettings(ESoundCategory::Effect, { 32, 1.f });
+    }
+
+    // 거리 밖의 보이스는 가상이 되고, 가상인 동안에도 재생 위치가 흘러 원래 길이에 맞춰 끝남
+    {
+        FSoundPlayParams Params;
+        Params.bSpatial = true;
+        Params.Location = FVector(10000.f, 0.f, 0.f);
+
+        Manager.SetListenerLocation(FVector::ZeroVector);
+        const FSoundVoiceHandle FarVoice = Manager.PlaySound("OneShot", Params);
+        Manager.Update(DeltaTime);
+        Check(FarVoice.IsValid() && Manager.IsVoiceActive(FarVoice) && !Manager.IsVoiceAudible(FarVoice), "Voice beyond MaxDistance is virtual");
+
+        float Elapsed = DeltaTime;
+        for (; Elapsed < SoundLength * 0.6f; Elapsed += DeltaTime)
+        {
+            Manager.Update(DeltaTime);
+        }
+
+        Manager.SetListenerLocation(Params.Location);
+        Manager.Update(DeltaTime);
+        Elapsed += DeltaTime;
+        Check(Manager.IsVoiceAudible(FarVoice), "Virtual voice becomes real when the listener moves close");
+
+        // 처음부터 다시 재생했다면 SoundLength만큼 더 재생되어야 하지만, 이어서 재생하면 남은 시간만에 끝남
+        float FinishedAt = -1.f;
+        for (; Elapsed < SoundLength * 2.f; Elapsed += DeltaTime)
+        {
+            Manager.Update(DeltaTime);
+            if (!Manager.IsVoiceActive(FarVoice))
+            {
+                FinishedAt = Elapsed;
+                break;
+            }
+        }
+        Check(FinishedAt > 0.f && FinishedAt <= SoundLength + DeltaTime * 3.f, "Voice resumes from its virtual playback position");
+        UE_LOG(ELogLevel::Display, "[Sound Test] Spatial voice finished after %.2f s (sound length %.2f s)", FinishedAt, SoundLength);
+    }
+
+    // 경계 근처에서는 이미 채널이 있는 보이스만 유지
+    {
+        FSoundPlayParams Params;
+        Params.Volume = VIRTUALIZE_VOLUME * 1.5f;
+        const FSoundVoiceHandle Quiet = Manager.PlaySound("Loop", Params);
+        Manager.Update(DeltaTime);
+        Check(!Manager.IsVoiceAudible(Quiet), "Quiet new voice below twice the threshold stays virtual");
+
+        // 거리로 들리는 정도를 임계값의 1.5배, 0.5배로 낮춰 봄
+        Params.Volume = 1.f;
+        Params.bSpatial = true;
+        Params.Location = FVector::ZeroVector;
+        Manager.SetListenerLocation(FVector::ZeroVector);
+        const FSoundVoiceHandle Fading = Manager.PlaySound("Loop", Params);
+        Manager.Update(DeltaTime);
+
+        const float Range = Params.MaxDistance - Params.MinDistance;
+        Manager.SetVoiceLocation(Fading, FVector(Params.MinDistance + Range * (1.f - VIRTUALIZE_VOLUME * 1.5f), 0.f, 0.f));
+        Manager.Update(DeltaTime);
+        Check(Manager.IsVoiceAudible(Fading), "Real voice below twice the threshold keeps its channel");
+
+        Manager.SetVoiceLocation(Fading, FVector(Params.MinDistance + Range * (1.f - VIRTUALIZE_VOLUME * 0.5f), 0.f, 0.f));
+        Manager.Update(DeltaTime);
+        Check(Manager.IsVoiceActive(Fading) && !Manager.IsVoiceAudible(Fading), "Real voice below the threshold becomes virtual");
+
+        Manager.StopAllSounds();
+    }
+
+    Manager.Shutdown();
+
+    UE_LOG(NumFailures == 0 ? ELogLevel::Display : ELogLevel::Error, "[Sound Test] %s, %d failed checks", NumFailures == 0 ? "Passed" : "Failed", NumFailures);
+    return NumFailures == 0;
+}
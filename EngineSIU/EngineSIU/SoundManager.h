@@ -1,130 +1,195 @@
-#include <fmod.hpp>
-#include <iostream>
-#include <unordered_map>
-#include <vector>
+#pragma once
+#include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "Container/Array.h"
+#include "Math/Vector.h"
+#include "SoundBackend.h"
+
+enum class ESoundCategory : uint8
+{
+    Music,
+    Effect,
+    Footstep,
+    UI,
+    Max,
+};
+
+struct FSoundCategorySettings
+{
+    /** 카테고리에 동시에 존재할 수 있는 보이스 수(가상 보이스 포함), 가득 차면 점수가 가장 낮은 보이스를 뺏어서 씀 */
+    int32 MaxVoices = 16;
+
+    float Volume = 1.f;
+};
+
+struct FSoundPlayParams
+{
+    ESoundCategory Category = ESoundCategory::Effect;
+
+    /** 높을수록 카테고리 슬롯과 실제 채널을 먼저 차지함 */
+    int32 Priority = 0;
+
+    float Volume = 1.f;
+
+    /** false라면 거리 감쇠 없이 항상 Volume으로 들림 */
+    bool bSpatial = false;
+    FVector Location = FVector::ZeroVector;
+
+    /** MinDistance 안에서는 감쇠가 없고, MaxDistance 밖에서는 들리지 않아 가상 보이스가 됨 */
+    float MinDistance = 100.f;
+    float MaxDistance = 3000.f;
+};
+
+/** PlaySound가 돌려주는 보이스 핸들, 보이스가 끝나 슬롯이 재사용되면 Generation이 달라져 무효가 됨 */
+struct FSoundVoiceHandle
+{
+    uint32 Index = 0;
+    uint32 Generation = 0;
 
-class FSoundManager {
+    bool IsValid() const { return Generation != 0; }
+};
+
+struct FSoundVoiceStats
+{
+    int32 NumRealVoices = 0;
+    int32 NumVirtualVoices = 0;
+    int32 NumLoadingSounds = 0;
+
+    /** Initialize 이후 누적 값 */
+    uint32 NumStolenVoices = 0;
+    uint32 NumRejectedPlays = 0;
+};
+
+/**
+ * 사운드 로딩과 보이스 관리
+ *
+ * - LoadSound는 백엔드에 비동기 로드만 요청하고 바로 반환, 로드가 끝나기 전에 PlaySound된 보이스는 가상 보이스로 기다림
+ * - 보이스는 카테고리별 MaxVoices 안에서만 존재하고, 가득 차면 우선순위, 들리는 정도, 시작 순서로 가장 낮은 보이스를 뺏음
+ * - Update마다 들리는 보이스를 점수 순서로 MAX_REAL_VOICES개까지만 실제 채널로 재생하고
+ *   나머지는 채널 없이 재생 위치만 흘려보내다가 다시 들리게 되면 그 위치부터 재생
+ * - 보이스 슬롯은 재사용하므로 재생 중에 할당이 없음
+ */
+class FSoundManager
+{
 public:
-    static FSoundManager& GetInstance() {
+    static FSoundManager& GetInstance()
+    {
         static FSoundManager instance;
         return instance;
     }
 
-    bool Initialize() {
-        FMOD_RESULT result = FMOD::System_Create(&system);
-        if (result != FMOD_OK) {
-            std::cerr << "FMOD System_Create failed!" << std::endl;
-            return false;
-        }
+    /** InBackend가 없으면 플랫폼 기본 백엔드(Windows는 FMOD)를 사용 */
+    bool Initialize(std::unique_ptr<ISoundBackend> InBackend = nullptr);
 
-        result = system->init(1024, FMOD_INIT_NORMAL, nullptr);
-        if (result != FMOD_OK) {
-            std::cerr << "FMOD system init failed!" << std::endl;
-            return false;
-        }
+    void Shutdown();
 
-        return true;
-    }
+    /** 비동기 로드 요청, 이미 있는 이름이면 아무것도 하지 않음 */
+    bool LoadSound(const std::string& name, const std::string& filePath, bool loop = false);
 
-    void Shutdown() {
-        for (auto& pair : soundMap) {
-            pair.second->release();
-        }
-        soundMap.clear();
+    /** Directory의 오디오 파일을 확장자를 뺀 파일 이름으로 전부 LoadSound */
+    void PreloadDirectory(const std::string& Directory);
 
-        if (system) {
-            system->close();
-            system->release();
-        }
-    }
+    bool IsSoundReady(const std::string& name) const;
 
-    bool LoadSound(const std::string& name, const std::string& filePath, bool loop = false) {
-        if (soundMap.find(name) != soundMap.end()) {
-            return true;
-        }
+    /** 카테고리가 가득 찼고 새 보이스의 점수가 가장 낮다면 재생하지 않고 무효 핸들을 돌려줌 */
+    FSoundVoiceHandle PlaySound(const std::string& name, const FSoundPlayParams& Params = FSoundPlayParams());
 
-        FMOD::Sound* sound = nullptr;
-        FMOD_MODE mode = FMOD_DEFAULT | FMOD_LOOP_OFF | FMOD_CREATECOMPRESSEDSAMPLE;
+    void StopSound(FSoundVoiceHandle Handle);
 
-        if (system->createSound(filePath.c_str(), mode, nullptr, &sound) != FMOD_OK) {
-            std::cerr << "Failed to load sound: " << filePath << std::endl;
-            return false;
-        }
-        soundMap[name] = sound;
-        return true;
-    }
+    bool IsVoiceActive(FSoundVoiceHandle Handle) const;
 
-    void PlaySound(const std::string& name) {
-        auto it = soundMap.find(name);
-        if (it != soundMap.end()) {
-            FMOD::Channel* newChannel = nullptr;
-            system->playSound(it->second, nullptr, false, &newChannel);
-            if (newChannel) {
-                activeChannels.push_back(newChannel);
-            }
-        }
-    }
+    /** 실제 채널로 재생 중이면 true, 가상 보이스거나 끝났으면 false */
+    bool IsVoiceAudible(FSoundVoiceHandle Handle) const;
 
-    void Update() {
-        system->update();
-        activeChannels.erase(
-    std::remove_if(activeChannels.begin(), activeChannels.end(),
-        [](FMOD::Channel* channel) {
-            bool isPlaying = false;
-            if (channel) {
-                FMOD_RESULT result = channel->isPlaying(&isPlaying);
-                if (result != FMOD_OK) {
-                    return true; 
-                }
-            }
-            return !isPlaying;
-        }),
-    activeChannels.end()
-);
+    void SetVoiceLocation(FSoundVoiceHandle Handle, const FVector& Location);
 
-    }
+    void SetListenerLocation(const FVector& Location) { ListenerLocation = Location; }
 
-    void StopAllSounds()
-    {
-        // 1) 개별 채널을 멈추기
-        for (FMOD::Channel* channel : activeChannels)
-        {
-            if (channel)
-            {
-                channel->stop();
-            }
-        }
-        activeChannels.clear();
-
-        // 2) 시스템 전체(마스터 채널 그룹) 정지 (Optional)
-        FMOD::ChannelGroup* masterGroup = nullptr;
-        if (system->getMasterChannelGroup(&masterGroup) == FMOD_OK && masterGroup)
-        {
-            masterGroup->stop();
-        }
-    }
+    void SetCategorySettings(ESoundCategory Category, const FSoundCategorySettings& Settings);
 
+    const FSoundCategorySettings& GetCategorySettings(ESoundCategory Category) const;
 
-    TArray<std::string> GetAllSoundNames() const {
-        TArray<std::string> names;
-        for (const auto& pair : soundMap)
-        {
-            names.Add(pair.first);
-        }
-        return names;
-    }
+    void Update(float DeltaTime);
+
+    void StopAllSounds();
+
+    TArray<std::string> GetAllSoundNames() const;
+
+    const FSoundVoiceStats& GetStats() const { return Stats; }
+
+    /**
+     * 싱글톤과 별개의 FSoundManager를 FNullSoundBackend로 만들어 로딩 대기, 카테고리 제한과 보이스 뺏기,
+     * 실제 채널 예산, 거리에 따른 가상화와 재생 위치 유지를 검사하고 결과를 로그로 출력
+     * @param SoundFilePath 존재하는 파일이어야 함, 내용은 읽지 않음
+     */
+    static bool RunSelfTest(const std::string& SoundFilePath);
+
+    /** 동시에 실제 채널로 재생하는 최대 보이스 수 */
+    static constexpr int32 MAX_REAL_VOICES = 64;
+
+    /** 들리는 정도가 이보다 낮으면 가상 보이스, 다시 실제 채널을 얻으려면 두 배 이상이어야 함 */
+    static constexpr float VIRTUALIZE_VOLUME = 0.01f;
 
-    
 private:
-    FSoundManager() : system(nullptr) {}
+    FSoundManager();
     ~FSoundManager() { Shutdown(); }
     FSoundManager(const FSoundManager&) = delete;
     FSoundManager& operator=(const FSoundManager&) = delete;
 
-    FMOD::System* system;
-    std::unordered_map<std::string, FMOD::Sound*> soundMap;
-    std::vector<FMOD::Channel*> activeChannels; // ���� ä���� ����
+    struct FSoundAsset
+    {
+        FSoundBackendHandle Handle = 0;
+        ESoundLoadState State = ESoundLoadState::Loading;
+        float Length = 0.f;
+        bool bLoop = false;
+    };
+
+    struct FSoundVoice
+    {
+        FSoundAsset* Asset = nullptr;
+        FSoundPlayParams Params;
+
+        /** 0이면 가상 보이스 */
+        FSoundBackendHandle Channel = 0;
+
+        float PlaybackSeconds = 0.f;
+        float Audibility = 0.f;
+        float AppliedVolume = -1.f;
+
+        /** 점수가 같으면 나중에 시작한 보이스가 이김 */
+        uint64 StartOrder = 0;
+
+        /** 0이면 빈 슬롯 */
+        uint32 Generation = 0;
+    };
+
+    FSoundVoice* FindVoice(FSoundVoiceHandle Handle);
+    const FSoundVoice* FindVoice(FSoundVoiceHandle Handle) const;
+
+    void StopVoice(uint32 VoiceIndex);
+
+    float ComputeAudibility(const FSoundPlayParams& Params) const;
+
+    /** 우선순위, 들리는 정도, 시작 순서 순서로 비교 */
+    static bool IsHigherScore(const FSoundVoice& A, const FSoundVoice& B);
+
+    std::unique_ptr<ISoundBackend> Backend;
+    std::unordered_map<std::string, FSoundAsset> soundMap;
+    int32 NumLoadingSounds = 0;
+
+    TArray<FSoundVoice> Voices;
+    TArray<uint32> FreeVoices;
+    TArray<int32> NumCategoryVoices;
+    TArray<FSoundCategorySettings> CategorySettings;
+
+    /** Update에서 보이스를 점수 순서로 정렬할 때 재사용 */
+    TArray<uint32> SortedVoices;
+
+    FVector ListenerLocation = FVector::ZeroVector;
+    uint32 NextGeneration = 1;
+    uint64 NextStartOrder = 0;
+
+    FSoundVoiceStats Stats;
 };